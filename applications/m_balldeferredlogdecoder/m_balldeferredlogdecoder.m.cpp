@@ -0,0 +1,124 @@
+// m_balldeferredlogdecoder.m.cpp                                     -*-C++-*-
+
+// This application prints, as text, the binary log files written by a
+// `ball::DeferredLogger` (see `ball_deferredlogger`):
+// ```
+// m_balldeferredlogdecoder [-f <format>] <file>...
+// ```
+// Each record is formatted by a `ball::RecordStringFormatter` having the
+// optionally specified format specification (by default, that of a
+// default-constructed formatter).  A file named `-` is read from the standard
+// input.  The exit status is 0 if every file was decoded successfully, and
+// non-zero otherwise.
+
+#include <ball_deferredlogfileutil.h>
+#include <ball_recordstringformatter.h>
+
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+/// Print the usage of this application, named by the specified `program`,
+/// to the standard error.
+void printUsage(const char *program)
+{
+    bsl::cerr << "usage: " << program << " [-f <format>] <file>..."
+              << bsl::endl
+              << "  Print the binary logs written by `ball::DeferredLogger`."
+              << bsl::endl
+              << "  -f <format>  record format (ball_recordstringformatter)"
+              << bsl::endl
+              << "  <file>       binary log file, or `-` for standard input"
+              << bsl::endl;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const char               *format =
+                                 ball::RecordStringFormatter::k_DEFAULT_FORMAT;
+    bsl::vector<bsl::string>  files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (0 == bsl::strcmp(argv[i], "-f") && i + 1 < argc) {
+            format = argv[++i];
+        }
+        else if (0 == bsl::strcmp(argv[i], "-h")
+              || 0 == bsl::strcmp(argv[i], "--help")) {
+            u::printUsage(argv[0]);
+            return 0;                                                 // RETURN
+        }
+        else if ('-' == argv[i][0] && '\0' != argv[i][1]) {
+            u::printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.empty()) {
+        u::printUsage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    const ball::RecordStringFormatter formatter(format);
+
+    int status = 0;
+    for (bsl::size_t i = 0; i < files.size(); ++i) {
+        int rc;
+        if ("-" == files[i]) {
+            rc = ball::DeferredLogFileUtil::decode(bsl::cout,
+                                                   bsl::cin,
+                                                   formatter);
+        }
+        else {
+            bsl::ifstream input(files[i].c_str(), bsl::ios_base::binary);
+            if (!input.is_open()) {
+                bsl::cerr << argv[0] << ": cannot open " << files[i]
+                          << bsl::endl;
+                status = 1;
+                continue;
+            }
+            rc = ball::DeferredLogFileUtil::decode(bsl::cout,
+                                                   input,
+                                                   formatter);
+        }
+
+        if (0 != rc) {
+            bsl::cerr << argv[0] << ": " << files[i]
+                      << ": invalid binary log (" << rc << ")" << bsl::endl;
+            status = 1;
+        }
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,906 @@
+// m_balllogbenchmark.m.cpp                                           -*-C++-*-
+
+// This application measures the caller-side latency and the sustained
+// throughput of `BALL_LOG_*` statements, for a set of logging configurations:
+// ```
+// m_balllogbenchmark [--threads=<n>,...] [--sizes=<n>,...]
+//                    [--observers=<name>,...] [--severities=<name>,...]
+//                    [--duration=<ms>] [--samples=<n>] [--output=<file>]
+//                    [--directory=<dir>]
+// ```
+// The benchmark is run for every combination of the number of logging
+// threads (`--threads`, default `1,4`), the size of the logged message in
+// bytes (`--sizes`, default `64,1024`), the observer configuration
+// (`--observers`, default all of them), and whether the severity of the
+// logged messages is enabled or disabled (`--severities`, default both):
+//
+// * `file`: a `ball::FileObserver` writing to a file.
+// * `async`: a `ball::AsyncFileObserver` writing to a file.
+// * `file2`: a `ball::FileObserver2` writing to a file.
+// * `buffer`: records are retained in the record buffer of the logger
+//   manager, and published to a `ball::FileObserver2` when a trigger (a
+//   record of `e_ERROR` severity, logged once every 10000 records by each
+//   thread) is logged.
+// * `rules`: a `ball::FileObserver2` writing to a file, with each record
+//   logged in the scope of two `ball::ScopedAttribute` objects, and 16 rules
+//   (none of which match) installed in the logger manager.
+//
+// Each benchmark is run by a `bslmt::ThroughputBenchmark` for `--samples`
+// (default 3) samples of `--duration` (default 500) milliseconds.  For each
+// benchmark, the following are reported:
+//
+// * the median throughput (records per second, over all threads),
+// * the 50th, 99th, and 99.9th percentiles of the time (in nanoseconds) taken
+//   by a `BALL_LOG_*` statement, computed over the most recent statements of
+//   each thread,
+// * the number of allocations (and of bytes allocated) per record, counted
+//   over all threads of the process (including publication threads).
+//
+// The results are written as JSON to the standard output or to `--output`,
+// and a summary is written to the standard error.  Log files are written to
+// a temporary directory created under `--directory` (default: the current
+// directory), which is removed when the benchmark completes.  Note that the
+// latency of a statement includes the overhead of reading the timer twice,
+// which is measured and reported as `timerOverheadNs`.
+
+#include <ball_asyncfileobserver.h>
+#include <ball_fileobserver.h>
+#include <ball_fileobserver2.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_managedattribute.h>
+#include <ball_observer.h>
+#include <ball_rule.h>
+#include <ball_scopedattribute.h>
+#include <ball_severity.h>
+
+#include <balscm_version.h>
+
+#include <baljsn_encoderoptions.h>
+#include <baljsn_simpleformatter.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+#include <bdlt_iso8601util.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64 Int64;
+
+                          // =======================
+                          // class CountingAllocator
+                          // =======================
+
+/// This class implements the `bslma::Allocator` protocol by forwarding to
+/// another allocator, and counts the number of allocations and of bytes
+/// allocated.  The counters are updated atomically, without a lock, so that
+/// installing this allocator as the default and global allocator disturbs
+/// the measured code as little as possible.
+class CountingAllocator : public bslma::Allocator {
+
+    // DATA
+    bslma::Allocator  *d_allocator_p;     // underlying allocator (held)
+    bsls::AtomicInt64  d_numAllocations;  // number of allocations
+    bsls::AtomicInt64  d_numBytes;        // number of bytes allocated
+
+  private:
+    // NOT IMPLEMENTED
+    CountingAllocator(const CountingAllocator&) BSLS_KEYWORD_DELETED;
+    CountingAllocator& operator=(const CountingAllocator&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a counting allocator that forwards to the specified
+    /// `basicAllocator`.
+    explicit CountingAllocator(bslma::Allocator *basicAllocator)
+    : d_allocator_p(basicAllocator)
+    , d_numAllocations(0)
+    , d_numBytes(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Return a newly allocated block of memory of (at least) the specified
+    /// positive `size` (in bytes), and count the allocation.
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+    {
+        d_numAllocations.addRelaxed(1);
+        d_numBytes.addRelaxed(static_cast<Int64>(size));
+        return d_allocator_p->allocate(size);
+    }
+
+    /// Return the memory block at the specified `address` back to this
+    /// allocator.
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE
+    {
+        d_allocator_p->deallocate(address);
+    }
+
+    // ACCESSORS
+
+    /// Return the number of allocations made by this allocator.
+    Int64 numAllocations() const
+    {
+        return d_numAllocations.loadRelaxed();
+    }
+
+    /// Return the number of bytes allocated by this allocator.
+    Int64 numBytes() const
+    {
+        return d_numBytes.loadRelaxed();
+    }
+};
+
+                               // ==============
+                               // struct Options
+                               // ==============
+
+/// This `struct` holds the options of the application.
+struct Options {
+
+    // PUBLIC DATA
+    bsl::vector<int>         d_threads;      // numbers of logging threads
+    bsl::vector<int>         d_sizes;        // message sizes, in bytes
+    bsl::vector<bsl::string> d_observers;    // observer configurations
+    bsl::vector<bool>        d_enabled;      // whether the severity is
+                                             // enabled
+    int                      d_durationMs;   // duration of a sample
+    int                      d_numSamples;   // number of samples
+    bsl::string              d_output;       // JSON output file, or empty
+                                             // for the standard output
+    bsl::string              d_directory;    // parent of the log directory
+};
+
+                               // =============
+                               // struct Result
+                               // =============
+
+/// This `struct` holds the result of a benchmark.
+struct Result {
+
+    // PUBLIC DATA
+    bsl::string d_observer;              // observer configuration
+    int         d_numThreads;            // number of logging threads
+    int         d_messageSize;           // message size, in bytes
+    bool        d_enabled;               // whether the severity is enabled
+    double      d_recordsPerSecond;      // median throughput
+    Int64       d_numRecords;            // records logged in all samples
+    Int64       d_p50Ns;                 // 50th percentile latency
+    Int64       d_p99Ns;                 // 99th percentile latency
+    Int64       d_p999Ns;                // 99.9th percentile latency
+    double      d_allocationsPerRecord;  // allocations per record
+    double      d_bytesPerRecord;        // bytes allocated per record
+};
+
+                              // ================
+                              // class ThreadData
+                              // ================
+
+/// This class holds the measurements of a logging thread.  Each object is
+/// allocated separately, so that the measurements of different threads do
+/// not share a cache line.
+class ThreadData {
+
+  public:
+    // PUBLIC TYPES
+    enum { k_NUM_LATENCIES = 1 << 18 };  // number of most recent latencies
+                                         // retained
+
+    // PUBLIC DATA
+    Int64              d_numRecords;     // number of records logged
+    bsl::vector<Int64> d_latencies;      // ring of the most recent
+                                         // latencies, in nanoseconds
+
+    // CREATORS
+
+    /// Create an object holding no measurement.  Use the specified
+    /// `basicAllocator` to supply memory.
+    explicit ThreadData(bslma::Allocator *basicAllocator)
+    : d_numRecords(0)
+    , d_latencies(k_NUM_LATENCIES, 0, basicAllocator)
+    {
+    }
+};
+
+                                // ============
+                                // class Runner
+                                // ============
+
+/// This class provides the function run by each logging thread of a
+/// benchmark.
+class Runner {
+
+    // PRIVATE TYPES
+    enum { k_TRIGGER_INTERVAL = 10000 };  // records between two triggers
+
+    // DATA
+    bsl::string_view           d_message;         // message to log
+    bool                       d_enabled;         // log at enabled severity
+    bool                       d_useTriggers;     // log triggers
+    bool                       d_useAttributes;   // log within attributes
+    bsl::vector<ThreadData *>  d_threadData;      // per-thread measurements
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    Runner(const Runner&) BSLS_KEYWORD_DELETED;
+    Runner& operator=(const Runner&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a runner for the specified `numThreads` threads, logging the
+    /// specified `message` at an enabled severity if the specified
+    /// `enabled` flag is `true`, and at a disabled severity otherwise.  If
+    /// the specified `useTriggers` flag is `true`, periodically log a
+    /// record of `e_ERROR` severity.  If the specified `useAttributes` flag
+    /// is `true`, log each record in the scope of two attributes.  Use the
+    /// specified `basicAllocator` to supply memory.
+    Runner(int                      numThreads,
+           const bsl::string_view&  message,
+           bool                     enabled,
+           bool                     useTriggers,
+           bool                     useAttributes,
+           bslma::Allocator        *basicAllocator)
+    : d_message(message)
+    , d_enabled(enabled)
+    , d_useTriggers(useTriggers)
+    , d_useAttributes(useAttributes)
+    , d_threadData(basicAllocator)
+    , d_allocator_p(basicAllocator)
+    {
+        for (int i = 0; i < numThreads; ++i) {
+            d_threadData.push_back(
+                      new (*d_allocator_p) ThreadData(d_allocator_p));
+        }
+    }
+
+    /// Destroy this object.
+    ~Runner()
+    {
+        for (bsl::size_t i = 0; i < d_threadData.size(); ++i) {
+            d_allocator_p->deleteObject(d_threadData[i]);
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Log one record from the thread having the specified `threadIndex`,
+    /// and record the time taken.
+    void run(int threadIndex)
+    {
+        BALL_LOG_SET_CATEGORY("BENCHMARK.BALL");
+
+        ThreadData& data = *d_threadData[threadIndex];
+
+        const Int64 numRecords = data.d_numRecords++;
+        Int64       start;
+        Int64       end;
+
+        if (d_useAttributes) {
+            ball::ScopedAttribute requestId("requestId", numRecords);
+            ball::ScopedAttribute service("service", "benchmark");
+
+            start = bsls::TimeUtil::getTimer();
+            if (d_enabled) {
+                BALL_LOG_INFO << d_message;
+            }
+            else {
+                BALL_LOG_TRACE << d_message;
+            }
+            end   = bsls::TimeUtil::getTimer();
+        }
+        else if (!d_enabled) {
+            start = bsls::TimeUtil::getTimer();
+            BALL_LOG_TRACE << d_message;
+            end   = bsls::TimeUtil::getTimer();
+        }
+        else if (d_useTriggers
+              && 0 == (numRecords + 1) % k_TRIGGER_INTERVAL) {
+            start = bsls::TimeUtil::getTimer();
+            BALL_LOG_ERROR << d_message;
+            end   = bsls::TimeUtil::getTimer();
+        }
+        else {
+            start = bsls::TimeUtil::getTimer();
+            BALL_LOG_INFO << d_message;
+            end   = bsls::TimeUtil::getTimer();
+        }
+
+        data.d_latencies[numRecords % ThreadData::k_NUM_LATENCIES] =
+                                                                   end - start;
+    }
+
+    // ACCESSORS
+
+    /// Load into the specified `latencies` the latencies retained by all
+    /// threads, and return the total number of records logged.
+    Int64 collect(bsl::vector<Int64> *latencies) const
+    {
+        Int64 numRecords = 0;
+
+        for (bsl::size_t i = 0; i < d_threadData.size(); ++i) {
+            const ThreadData& data = *d_threadData[i];
+
+            const Int64 numRetained = bsl::min<Int64>(
+                                                data.d_numRecords,
+                                                ThreadData::k_NUM_LATENCIES);
+            latencies->insert(latencies->end(),
+                              data.d_latencies.begin(),
+                              data.d_latencies.begin() + numRetained);
+            numRecords += data.d_numRecords;
+        }
+        return numRecords;
+    }
+};
+
+// FREE FUNCTIONS
+
+/// Return the specified `percentile` (in the range `[0.0 .. 1.0]`) of the
+/// specified `values`, reordering `values`.  Return 0 if `values` is empty.
+Int64 percentile(bsl::vector<Int64> *values, double percentile)
+{
+    if (values->empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t index = bsl::min(
+                         values->size() - 1,
+                         static_cast<bsl::size_t>(
+                               percentile * static_cast<double>(
+                                                           values->size())));
+
+    bsl::nth_element(values->begin(), values->begin() + index, values->end());
+    return (*values)[index];
+}
+
+/// Return the median time, in nanoseconds, taken by two consecutive calls
+/// of `bsls::TimeUtil::getTimer`.
+Int64 timerOverhead()
+{
+    enum { k_NUM_MEASUREMENTS = 100000 };
+
+    bsl::vector<Int64> values;
+    values.reserve(k_NUM_MEASUREMENTS);
+
+    for (int i = 0; i < k_NUM_MEASUREMENTS; ++i) {
+        const Int64 start = bsls::TimeUtil::getTimer();
+        const Int64 end   = bsls::TimeUtil::getTimer();
+        values.push_back(end - start);
+    }
+    return percentile(&values, 0.5);
+}
+
+/// Run the benchmark for the observer configuration named by the specified
+/// `observer`, with the specified `numThreads` threads logging messages of
+/// the specified `messageSize` bytes at an enabled severity if the specified
+/// `enabled` flag is `true`, and a disabled severity otherwise.  Write the
+/// log files to the specified `directory`, and run the specified
+/// `numSamples` samples of the specified `durationMs` milliseconds.  Use
+/// the specified `allocator`, which is also the default and global
+/// allocator, to count allocations.  Load the result into the specified
+/// `result`.  Return 0 on success, and a non-zero value otherwise.
+int runBenchmark(Result                  *result,
+                 const bsl::string&       observer,
+                 int                      numThreads,
+                 int                      messageSize,
+                 bool                     enabled,
+                 const bsl::string&       directory,
+                 int                      durationMs,
+                 int                      numSamples,
+                 CountingAllocator       *allocator)
+{
+    enum { k_NUM_RULES = 16 };
+
+    const bool useBuffer = "buffer" == observer;
+    const bool useRules  = "rules"  == observer;
+
+    // Records of `e_INFO` severity are published (or, for the `buffer`
+    // configuration, retained in the record buffer), records of `e_ERROR`
+    // severity trigger the publication of the record buffer, and records of
+    // `e_TRACE` severity are disabled.
+
+    ball::LoggerManagerConfiguration configuration;
+    if (useBuffer) {
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_ERROR,
+                                                       ball::Severity::e_OFF);
+    }
+    else {
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+    }
+
+    ball::LoggerManagerScopedGuard guard(configuration, allocator);
+    ball::LoggerManager&           manager = ball::LoggerManager::singleton();
+
+    bsl::string logFile(allocator);
+    bdls::PathUtil::appendRaw(&logFile, directory.c_str());
+    bdls::PathUtil::appendRaw(&logFile, (observer + ".log").c_str());
+
+    bsl::shared_ptr<ball::AsyncFileObserver> asyncObserver;
+    bsl::shared_ptr<ball::Observer>          fileObserver;
+    int                                      rc;
+
+    if ("file" == observer) {
+        bsl::shared_ptr<ball::FileObserver> fo =
+                     bsl::allocate_shared<ball::FileObserver>(
+                                                       allocator,
+                                                       ball::Severity::e_OFF);
+        rc           = fo->enableFileLogging(logFile.c_str());
+        fileObserver = fo;
+    }
+    else if ("async" == observer) {
+        asyncObserver = bsl::allocate_shared<ball::AsyncFileObserver>(
+                                                       allocator,
+                                                       ball::Severity::e_OFF);
+        rc = asyncObserver->enableFileLogging(logFile.c_str());
+        if (0 == rc) {
+            rc = asyncObserver->startPublicationThread();
+        }
+        fileObserver = asyncObserver;
+    }
+    else {
+        bsl::shared_ptr<ball::FileObserver2> fo =
+                        bsl::allocate_shared<ball::FileObserver2>(allocator);
+        rc           = fo->enableFileLogging(logFile.c_str());
+        fileObserver = fo;
+    }
+
+    if (0 != rc) {
+        bsl::cerr << "cannot open log file " << logFile << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    manager.registerObserver(fileObserver, "benchmark");
+
+    if (useRules) {
+        for (int i = 0; i < k_NUM_RULES; ++i) {
+            ball::Rule rule("BENCHMARK.*",
+                            ball::Severity::e_TRACE,
+                            ball::Severity::e_TRACE,
+                            ball::Severity::e_OFF,
+                            ball::Severity::e_OFF,
+                            allocator);
+            rule.addAttribute(ball::ManagedAttribute("requestId",
+                                                     -1 - i,
+                                                     allocator));
+            manager.addRule(rule);
+        }
+    }
+
+    const bsl::string message(messageSize, 'x', allocator);
+
+    Runner runner(numThreads,
+                  message,
+                  enabled,
+                  useBuffer,
+                  useRules,
+                  allocator);
+
+    bslmt::ThroughputBenchmark benchmark(allocator);
+    benchmark.addThreadGroup(bdlf::BindUtil::bindS(allocator,
+                                                   &Runner::run,
+                                                   &runner,
+                                                   bdlf::PlaceHolders::_1),
+                             numThreads,
+                             0);
+
+    bslmt::ThroughputBenchmarkResult benchmarkResult(allocator);
+
+    const Int64 numAllocations = allocator->numAllocations();
+    const Int64 numBytes       = allocator->numBytes();
+
+    benchmark.execute(&benchmarkResult, durationMs, numSamples);
+
+    const double allocations = static_cast<double>(
+                                 allocator->numAllocations() - numAllocations);
+    const double bytes       = static_cast<double>(
+                                 allocator->numBytes()       - numBytes);
+
+    if (asyncObserver) {
+        asyncObserver->stopPublicationThread();
+    }
+    manager.deregisterObserver("benchmark");
+
+    bsl::vector<Int64> latencies(allocator);
+    const Int64        numRecords = runner.collect(&latencies);
+
+    result->d_observer    = observer;
+    result->d_numThreads  = numThreads;
+    result->d_messageSize = messageSize;
+    result->d_enabled     = enabled;
+    result->d_numRecords  = numRecords;
+
+    benchmarkResult.getMedian(&result->d_recordsPerSecond, 0);
+
+    result->d_p50Ns  = percentile(&latencies, 0.5);
+    result->d_p99Ns  = percentile(&latencies, 0.99);
+    result->d_p999Ns = percentile(&latencies, 0.999);
+
+    result->d_allocationsPerRecord = numRecords
+                                   ? allocations / static_cast<double>(
+                                                                  numRecords)
+                                   : 0;
+    result->d_bytesPerRecord       = numRecords
+                                   ? bytes / static_cast<double>(numRecords)
+                                   : 0;
+
+    fileObserver.reset();
+    asyncObserver.reset();
+    bdls::FilesystemUtil::remove(logFile);
+
+    return 0;
+}
+
+/// Write to the specified `stream` the specified `results`, obtained with
+/// the specified `options` and having the specified `timerOverheadNs`, as
+/// JSON.
+void writeJson(bsl::ostream&              stream,
+               const bsl::vector<Result>& results,
+               const Options&             options,
+               Int64                      timerOverheadNs)
+{
+    baljsn::EncoderOptions encoderOptions;
+    encoderOptions.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+    encoderOptions.setSpacesPerLevel(2);
+
+    char timestamp[bdlt::Iso8601Util::k_DATETIME_STRLEN + 1];
+    bdlt::Iso8601Util::generate(timestamp,
+                                sizeof timestamp,
+                                bdlt::CurrentTime::utc());
+
+    baljsn::SimpleFormatter formatter(stream, encoderOptions);
+
+    formatter.openObject();
+    formatter.addValue("benchmark",       "m_balllogbenchmark");
+    formatter.addValue("version",         balscm::Version::version());
+    formatter.addValue("timestamp",       timestamp);
+    formatter.addValue("durationMs",      options.d_durationMs);
+    formatter.addValue("samples",         options.d_numSamples);
+    formatter.addValue("timerOverheadNs", timerOverheadNs);
+
+    formatter.openArray("results");
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+
+        formatter.openObject();
+        formatter.addValue("observer",         result.d_observer);
+        formatter.addValue("threads",          result.d_numThreads);
+        formatter.addValue("messageSize",      result.d_messageSize);
+        formatter.addValue("severity",
+                           result.d_enabled ? "enabled" : "disabled");
+        formatter.addValue("records",          result.d_numRecords);
+        formatter.addValue("recordsPerSecond", result.d_recordsPerSecond);
+
+        formatter.openObject("latencyNs");
+        formatter.addValue("p50",              result.d_p50Ns);
+        formatter.addValue("p99",              result.d_p99Ns);
+        formatter.addValue("p999",             result.d_p999Ns);
+        formatter.closeObject();
+
+        formatter.addValue("allocationsPerRecord",
+                           result.d_allocationsPerRecord);
+        formatter.addValue("bytesAllocatedPerRecord",
+                           result.d_bytesPerRecord);
+        formatter.closeObject();
+    }
+    formatter.closeArray();
+
+    formatter.closeObject();
+    stream << bsl::endl;
+}
+
+/// Write to the specified `stream` a one-line summary of the specified
+/// `result`.
+void printSummary(bsl::ostream& stream, const Result& result)
+{
+    stream << bsl::left
+           << bsl::setw(7)  << result.d_observer
+           << " threads="   << bsl::setw(3) << result.d_numThreads
+           << " size="      << bsl::setw(6) << result.d_messageSize
+           << bsl::setw(9)  << (result.d_enabled ? "enabled" : "disabled")
+           << bsl::right
+           << " rec/s="     << bsl::setw(11)
+           << static_cast<Int64>(result.d_recordsPerSecond)
+           << " p50="       << bsl::setw(7) << result.d_p50Ns
+           << " p99="       << bsl::setw(8) << result.d_p99Ns
+           << " p999="      << bsl::setw(8) << result.d_p999Ns
+           << " alloc/rec=" << bsl::fixed << bsl::setprecision(2)
+           << result.d_allocationsPerRecord
+           << bsl::endl;
+}
+
+/// Load into the specified `result` the comma-separated positive integers
+/// in the specified `list`.  Return 0 on success, and a non-zero value
+/// otherwise.
+int parseIntegers(bsl::vector<int> *result, const char *list)
+{
+    result->clear();
+
+    while (*list) {
+        char *end;
+        long  value = bsl::strtol(list, &end, 10);
+
+        if (end == list || value <= 0 || value > 1000000000) {
+            return -1;                                                // RETURN
+        }
+        result->push_back(static_cast<int>(value));
+
+        if (',' == *end) {
+            ++end;
+        }
+        else if ('\0' != *end) {
+            return -1;                                                // RETURN
+        }
+        list = end;
+    }
+    return result->empty() ? -1 : 0;
+}
+
+/// Load into the specified `result` the comma-separated names in the
+/// specified `list`.  Return 0 on success, and a non-zero value if `list`
+/// holds an empty name or a name that is not one of the specified
+/// `numValid` `validNames`.
+int parseNames(bsl::vector<bsl::string> *result,
+               const char               *list,
+               const char *const        *validNames,
+               int                       numValid)
+{
+    result->clear();
+
+    const char *begin = list;
+    for (const char *p = list; ; ++p) {
+        if (',' == *p || '\0' == *p) {
+            const bsl::string name(begin, p);
+
+            if (validNames + numValid == bsl::find(validNames,
+                                                   validNames + numValid,
+                                                   name)) {
+                return -1;                                            // RETURN
+            }
+            result->push_back(name);
+
+            if ('\0' == *p) {
+                break;                                                 // BREAK
+            }
+            begin = p + 1;
+        }
+    }
+    return 0;
+}
+
+/// Print the usage of this application, named by the specified `program`,
+/// to the standard error.
+void printUsage(const char *program)
+{
+    bsl::cerr
+        << "usage: " << program << " [--threads=<n>,...] [--sizes=<n>,...]\n"
+        << "           [--observers=<name>,...] [--severities=<name>,...]\n"
+        << "           [--duration=<ms>] [--samples=<n>] [--output=<file>]\n"
+        << "           [--directory=<dir>]\n"
+        << "  Measure the latency and throughput of `BALL_LOG_*`.\n"
+        << "  --threads     numbers of logging threads (default 1,4)\n"
+        << "  --sizes       message sizes in bytes (default 64,1024)\n"
+        << "  --observers   any of file,async,file2,buffer,rules (default"
+           " all)\n"
+        << "  --severities  any of enabled,disabled (default both)\n"
+        << "  --duration    duration of a sample in ms (default 500)\n"
+        << "  --samples     number of samples (default 3)\n"
+        << "  --output      JSON output file (default standard output)\n"
+        << "  --directory   directory for the log files (default .)"
+        << bsl::endl;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    static const char *const k_OBSERVERS[] = {
+        "file", "async", "file2", "buffer", "rules"
+    };
+    static const char *const k_SEVERITIES[] = { "enabled", "disabled" };
+
+    enum {
+        k_NUM_OBSERVERS  = sizeof k_OBSERVERS  / sizeof *k_OBSERVERS,
+        k_NUM_SEVERITIES = sizeof k_SEVERITIES / sizeof *k_SEVERITIES
+    };
+
+    // Count every allocation of the process, including those of the
+    // publication threads of the observers.
+
+    u::CountingAllocator allocator(&bslma::NewDeleteAllocator::singleton());
+    bslma::Default::setDefaultAllocator(&allocator);
+    bslma::Default::setGlobalAllocator(&allocator);
+
+    u::Options options;
+    options.d_threads.push_back(1);
+    options.d_threads.push_back(4);
+    options.d_sizes.push_back(64);
+    options.d_sizes.push_back(1024);
+    options.d_observers.assign(k_OBSERVERS, k_OBSERVERS + k_NUM_OBSERVERS);
+    options.d_enabled.push_back(true);
+    options.d_enabled.push_back(false);
+    options.d_durationMs = 500;
+    options.d_numSamples = 3;
+    options.d_directory  = ".";
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        value             = value ? value + 1 : "";
+
+        int rc = 0;
+        if (0 == bsl::strcmp(arg, "-h") || 0 == bsl::strcmp(arg, "--help")) {
+            u::printUsage(argv[0]);
+            return 0;                                                 // RETURN
+        }
+        else if (0 == bsl::strncmp(arg, "--threads=", 10)) {
+            rc = u::parseIntegers(&options.d_threads, value);
+        }
+        else if (0 == bsl::strncmp(arg, "--sizes=", 8)) {
+            rc = u::parseIntegers(&options.d_sizes, value);
+        }
+        else if (0 == bsl::strncmp(arg, "--observers=", 12)) {
+            rc = u::parseNames(&options.d_observers,
+                               value,
+                               k_OBSERVERS,
+                               k_NUM_OBSERVERS);
+        }
+        else if (0 == bsl::strncmp(arg, "--severities=", 13)) {
+            bsl::vector<bsl::string> names;
+            rc = u::parseNames(&names, value, k_SEVERITIES, k_NUM_SEVERITIES);
+
+            options.d_enabled.clear();
+            for (bsl::size_t j = 0; j < names.size(); ++j) {
+                options.d_enabled.push_back("enabled" == names[j]);
+            }
+        }
+        else if (0 == bsl::strncmp(arg, "--duration=", 11)) {
+            bsl::vector<int> values;
+            rc = u::parseIntegers(&values, value);
+            if (0 == rc) {
+                options.d_durationMs = values.front();
+            }
+        }
+        else if (0 == bsl::strncmp(arg, "--samples=", 10)) {
+            bsl::vector<int> values;
+            rc = u::parseIntegers(&values, value);
+            if (0 == rc) {
+                options.d_numSamples = values.front();
+            }
+        }
+        else if (0 == bsl::strncmp(arg, "--output=", 9)) {
+            options.d_output = value;
+        }
+        else if (0 == bsl::strncmp(arg, "--directory=", 12)) {
+            options.d_directory = value;
+        }
+        else {
+            rc = -1;
+        }
+
+        if (0 != rc) {
+            bsl::cerr << argv[0] << ": invalid argument " << arg << bsl::endl;
+            u::printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    bsl::string directory;
+    bsl::string prefix(options.d_directory);
+    bdls::PathUtil::appendRaw(&prefix, "m_balllogbenchmark.");
+    if (0 != bdls::FilesystemUtil::createTemporaryDirectory(&directory,
+                                                            prefix)) {
+        bsl::cerr << argv[0] << ": cannot create a directory in "
+                  << options.d_directory << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    const u::Int64 timerOverheadNs = u::timerOverhead();
+
+    bsl::vector<u::Result> results;
+    int                    status = 0;
+
+    for (bsl::size_t oi = 0; oi < options.d_observers.size(); ++oi) {
+        for (bsl::size_t ei = 0; ei < options.d_enabled.size(); ++ei) {
+            for (bsl::size_t ti = 0; ti < options.d_threads.size(); ++ti) {
+                for (bsl::size_t si = 0; si < options.d_sizes.size(); ++si) {
+                    u::Result result;
+
+                    if (0 != u::runBenchmark(&result,
+                                             options.d_observers[oi],
+                                             options.d_threads[ti],
+                                             options.d_sizes[si],
+                                             options.d_enabled[ei],
+                                             directory,
+                                             options.d_durationMs,
+                                             options.d_numSamples,
+                                             &allocator)) {
+                        status = 1;
+                        continue;                                   // CONTINUE
+                    }
+
+                    u::printSummary(bsl::cerr, result);
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+
+    bdls::FilesystemUtil::remove(directory, true);
+
+    if (options.d_output.empty()) {
+        u::writeJson(bsl::cout, results, options, timerOverheadNs);
+    }
+    else {
+        bsl::ofstream output(options.d_output.c_str());
+        u::writeJson(output, results, options, timerOverheadNs);
+        if (!output) {
+            bsl::cerr << argv[0] << ": cannot write " << options.d_output
+                      << bsl::endl;
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,115 @@
+// m_balllogdecompressor.m.cpp                                        -*-C++-*-
+
+// This application prints, as text, the compressed log files written by a
+// `ball::FileObserver2` having compression enabled (see `ball_fileobserver2`):
+// ```
+// m_balllogdecompressor <file>...
+// ```
+// A file named `-` is read from the standard input.  Regions of a file that do
+// not hold a valid frame (e.g., the incomplete last frame written by a process
+// that crashed) are skipped, and reported to the standard error.  The exit
+// status is 0 if every file consists only of valid frames and was printed
+// successfully, and non-zero otherwise.
+
+#include <ball_logfilecompressionutil.h>
+
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+/// Print the usage of this application, named by the specified `program`,
+/// to the standard error.
+void printUsage(const char *program)
+{
+    bsl::cerr << "usage: " << program << " <file>..." << bsl::endl
+              << "  Print the compressed logs written by "
+                 "`ball::FileObserver2`."
+              << bsl::endl
+              << "  <file>  compressed log file, or `-` for standard input"
+              << bsl::endl;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bsl::vector<bsl::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (0 == bsl::strcmp(argv[i], "-h")
+         || 0 == bsl::strcmp(argv[i], "--help")) {
+            u::printUsage(argv[0]);
+            return 0;                                                 // RETURN
+        }
+        else if ('-' == argv[i][0] && '\0' != argv[i][1]) {
+            u::printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.empty()) {
+        u::printUsage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    int status = 0;
+    for (bsl::size_t i = 0; i < files.size(); ++i) {
+        int rc;
+        if ("-" == files[i]) {
+            rc = ball::LogFileCompressionUtil::decompress(bsl::cout, bsl::cin);
+        }
+        else {
+            bsl::ifstream input(files[i].c_str(), bsl::ios_base::binary);
+            if (!input.is_open()) {
+                bsl::cerr << argv[0] << ": cannot open " << files[i]
+                          << bsl::endl;
+                status = 1;
+                continue;
+            }
+            rc = ball::LogFileCompressionUtil::decompress(bsl::cout, input);
+        }
+
+        if (0 > rc) {
+            bsl::cerr << argv[0] << ": " << files[i]
+                      << ": cannot write the standard output" << bsl::endl;
+            return 1;                                                 // RETURN
+        }
+        if (0 < rc) {
+            bsl::cerr << argv[0] << ": " << files[i] << ": skipped " << rc
+                      << " invalid region(s)" << bsl::endl;
+            status = 1;
+        }
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
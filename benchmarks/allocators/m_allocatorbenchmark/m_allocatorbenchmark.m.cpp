@@ -0,0 +1,941 @@
+// m_allocatorbenchmark.m.cpp                                         -*-C++-*-
+
+// This application measures the performance of the `bslma` and `bdlma`
+// allocators on the workloads described in the ISO WG21 papers N4468 and
+// P0089 ("On Quantifying Memory-Allocation Strategies"):
+// ```
+// m_allocatorbenchmark [--allocators=<name>,...] [--workloads=<name>,...]
+//                      [--elements=<n>,...] [--threads=<n>,...]
+//                      [--samples=<n>] [--output=<file>]
+// ```
+// The benchmark is run for every combination of the allocator
+// (`--allocators`, default all of them), the workload (`--workloads`, default
+// all of them), and the number of elements processed by an iteration of the
+// workload (`--elements`, default `1024,65536`).  The allocators are:
+//
+// * `newdelete`: `bslma::NewDeleteAllocator`.
+// * `sequential`: `bdlma::SequentialAllocator`.
+// * `bufferedsequential`: `bdlma::BufferedSequentialAllocator`, with a 16K
+//   buffer on the stack.
+// * `multipool`: `bdlma::MultipoolAllocator`.
+// * `concurrentmultipool`: `bdlma::ConcurrentMultipoolAllocator`.
+// * `localsequential`: `bdlma::LocalSequentialAllocator<16384>`.
+//
+// Other than `newdelete`, a new allocator (obtaining its memory from
+// `bslma::NewDeleteAllocator`) is created before each iteration of a
+// workload and destroyed after it, so that the cost of releasing all of its
+// memory at once is included in the measurements.  The workloads are:
+//
+// * `churn`: populate a `bsl::vector<bsl::string>`, a `bsl::list<int>`, and
+//   a `bsl::unordered_set<int>`, erase half of their elements, insert as many
+//   new elements, and destroy the containers.
+// * `shuffle`: allocate blocks of random sizes (between 8 and 256 bytes),
+//   deallocate them in a random order, then allocate and traverse as many
+//   blocks, so that the locality of the memory obtained from a fragmented
+//   allocator is measured.
+// * `prodcons`: `--threads` (default `1,4`) producer threads allocate
+//   messages and pass them through a `bdlcc::SingleConsumerQueue` to the
+//   main thread, which deallocates them.  The allocators that are not
+//   thread-safe (`sequential`, `bufferedsequential`, `multipool`, and
+//   `localsequential`) are used through a `bdlma::ConcurrentAllocatorAdapter`
+//   for this workload, and the corresponding results are reported as
+//   `synchronized`.
+//
+// Each sample runs enough iterations to process (at least) 2^18 elements,
+// and `--samples` (default 5) samples are measured after one iteration of
+// warm-up.  For each benchmark, the median and minimum time (in nanoseconds)
+// of an iteration, and the median throughput (elements per second), are
+// reported.  The results are written as JSON to the standard output or to
+// `--output`, so that they can be compared across releases, and a summary is
+// written to the standard error.
+
+#include <balscm_version.h>
+
+#include <baljsn_encoderoptions.h>
+#include <baljsn_simpleformatter.h>
+
+#include <bdlb_pcgrandomgenerator.h>
+
+#include <bdlcc_singleconsumerqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+#include <bdlt_iso8601util.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64 Int64;
+
+enum {
+    k_BUFFER_SIZE         = 16 * 1024,  // size of the buffer of the
+                                        // buffered and local allocators
+
+    k_ELEMENTS_PER_SAMPLE = 1 << 18     // minimum number of elements
+                                        // processed by a sample
+};
+
+/// Names of the benchmarked allocators, in the order of `AllocatorKind`.
+static const char *const k_ALLOCATORS[] = {
+    "newdelete",
+    "sequential",
+    "bufferedsequential",
+    "multipool",
+    "concurrentmultipool",
+    "localsequential"
+};
+
+/// Names of the workloads.
+static const char *const k_WORKLOADS[] = { "churn", "shuffle", "prodcons" };
+
+enum {
+    k_NUM_ALLOCATORS = sizeof k_ALLOCATORS / sizeof *k_ALLOCATORS,
+    k_NUM_WORKLOADS  = sizeof k_WORKLOADS  / sizeof *k_WORKLOADS
+};
+
+/// This enumeration identifies the benchmarked allocators.
+enum AllocatorKind {
+    e_NEW_DELETE,
+    e_SEQUENTIAL,
+    e_BUFFERED_SEQUENTIAL,
+    e_MULTIPOOL,
+    e_CONCURRENT_MULTIPOOL,
+    e_LOCAL_SEQUENTIAL
+};
+
+                               // ==============
+                               // struct Options
+                               // ==============
+
+/// This `struct` holds the options of the application.
+struct Options {
+
+    // PUBLIC DATA
+    bsl::vector<bsl::string> d_allocators;   // benchmarked allocators
+    bsl::vector<bsl::string> d_workloads;    // workloads
+    bsl::vector<int>         d_elements;     // numbers of elements processed
+                                             // by an iteration
+    bsl::vector<int>         d_threads;      // numbers of producer threads
+    int                      d_numSamples;   // number of samples
+    bsl::string              d_output;       // JSON output file, or empty
+                                             // for the standard output
+};
+
+                               // =============
+                               // struct Result
+                               // =============
+
+/// This `struct` holds the result of a benchmark.
+struct Result {
+
+    // PUBLIC DATA
+    bsl::string d_allocator;          // allocator
+    bsl::string d_workload;           // workload
+    int         d_numElements;        // elements processed by an iteration
+    int         d_numThreads;         // number of producer threads
+    bool        d_synchronized;       // whether the allocator is used
+                                      // through a mutex
+    int         d_numIterations;      // iterations per sample
+    Int64       d_medianNs;           // median time of an iteration
+    Int64       d_minNs;              // minimum time of an iteration
+    double      d_elementsPerSecond;  // median throughput
+};
+
+                               // ==============
+                               // class Workload
+                               // ==============
+
+/// This class defines a protocol for the work measured by a benchmark, one
+/// iteration of which is performed using an allocator supplied by the
+/// caller.
+class Workload {
+
+  public:
+    // CREATORS
+
+    /// Destroy this object.
+    virtual ~Workload()
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Perform one iteration of this workload, using the specified
+    /// `allocator` to supply memory.  Release, before returning, all the
+    /// memory obtained from `allocator`.
+    virtual void run(bslma::Allocator *allocator) = 0;
+
+    // ACCESSORS
+
+    /// Return `true` if `run` uses the allocator from more than one thread,
+    /// and `false` otherwise.
+    virtual bool isConcurrent() const = 0;
+
+    /// Return the number of elements processed by an iteration of this
+    /// workload.
+    virtual int numElements() const = 0;
+};
+
+                            // ===================
+                            // class ChurnWorkload
+                            // ===================
+
+/// This class implements the `churn` workload: containers are populated,
+/// half of their elements are replaced, and the containers are destroyed.
+class ChurnWorkload : public Workload {
+
+    // DATA
+    int   d_numElements;  // number of elements of each container
+    Int64 d_checksum;     // accumulated to keep the work observable
+
+  private:
+    // NOT IMPLEMENTED
+    ChurnWorkload(const ChurnWorkload&) BSLS_KEYWORD_DELETED;
+    ChurnWorkload& operator=(const ChurnWorkload&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a workload populating containers of the specified
+    /// `numElements` elements.
+    explicit ChurnWorkload(int numElements)
+    : d_numElements(numElements)
+    , d_checksum(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Populate, churn, and destroy containers using the specified
+    /// `allocator`.
+    void run(bslma::Allocator *allocator) BSLS_KEYWORD_OVERRIDE
+    {
+        // The strings are longer than the short-string buffer of
+        // `bsl::string`, so that each of them allocates.
+
+        static const char k_TEXT[] =
+                            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKL";
+        enum { k_TEXT_LENGTH = sizeof k_TEXT - 1 };
+
+        bsl::vector<bsl::string> strings(allocator);
+        bsl::list<int>           list(allocator);
+        bsl::unordered_set<int>  set(allocator);
+
+        for (int i = 0; i < d_numElements; ++i) {
+            strings.emplace_back(k_TEXT, k_TEXT_LENGTH - (i & 7));
+            list.push_back(i);
+            set.insert(i);
+        }
+
+        // Erase every other element of the list and the set, and the second
+        // half of the strings.
+
+        bsl::list<int>::iterator it = list.begin();
+        while (it != list.end()) {
+            it = list.erase(it);
+            if (it != list.end()) {
+                ++it;
+            }
+        }
+        for (int i = 0; i < d_numElements; i += 2) {
+            set.erase(i);
+        }
+        strings.resize(d_numElements / 2);
+
+        // Insert as many new elements.
+
+        for (int i = 0; i < d_numElements / 2; ++i) {
+            strings.emplace_back(k_TEXT, k_TEXT_LENGTH - (i & 7));
+            list.push_back(i);
+            set.insert(d_numElements + i);
+        }
+
+        d_checksum += static_cast<Int64>(strings.back().size() +
+                                         list.size()           +
+                                         set.size());
+    }
+
+    // ACCESSORS
+
+    /// Return `false`.
+    bool isConcurrent() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+
+    /// Return the number of elements of each container.
+    int numElements() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_numElements;
+    }
+};
+
+                           // =====================
+                           // class ShuffleWorkload
+                           // =====================
+
+/// This class implements the `shuffle` workload: blocks of random sizes are
+/// allocated and deallocated in a random order, then as many blocks are
+/// allocated and traversed.
+class ShuffleWorkload : public Workload {
+
+    // DATA
+    bsl::vector<int>     d_sizes;     // size of each block
+    bsl::vector<int>     d_order;     // order in which blocks are freed
+    bsl::vector<void *>  d_blocks;    // allocated blocks
+    Int64                d_checksum;  // accumulated to keep the work
+                                      // observable
+
+  private:
+    // NOT IMPLEMENTED
+    ShuffleWorkload(const ShuffleWorkload&) BSLS_KEYWORD_DELETED;
+    ShuffleWorkload& operator=(const ShuffleWorkload&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Allocate, using the specified `allocator`, the blocks of this
+    /// workload, and fill each of them.
+    void allocateBlocks(bslma::Allocator *allocator)
+    {
+        for (bsl::size_t i = 0; i < d_blocks.size(); ++i) {
+            d_blocks[i] = allocator->allocate(d_sizes[i]);
+            bsl::memset(d_blocks[i], static_cast<int>(i), d_sizes[i]);
+        }
+    }
+
+    /// Deallocate, in a random order, the blocks of this workload to the
+    /// specified `allocator`.
+    void deallocateBlocks(bslma::Allocator *allocator)
+    {
+        for (bsl::size_t i = 0; i < d_order.size(); ++i) {
+            allocator->deallocate(d_blocks[d_order[i]]);
+        }
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a workload allocating the specified `numElements` blocks.
+    /// Use the specified `basicAllocator` to supply memory.
+    ShuffleWorkload(int numElements, bslma::Allocator *basicAllocator)
+    : d_sizes(basicAllocator)
+    , d_order(basicAllocator)
+    , d_blocks(numElements, 0, basicAllocator)
+    , d_checksum(0)
+    {
+        // Use a fixed seed, so that every allocator sees the same sequence
+        // of requests.
+
+        bdlb::PcgRandomGenerator generator(0x5eed, 1);
+
+        d_sizes.reserve(numElements);
+        d_order.reserve(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            d_sizes.push_back(
+                            8 + static_cast<int>(generator.generate() % 249));
+            d_order.push_back(i);
+        }
+        for (int i = numElements - 1; i > 0; --i) {
+            const int j = static_cast<int>(generator.generate() % (i + 1));
+            bsl::swap(d_order[i], d_order[j]);
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Fragment, and then reuse and traverse, memory obtained from the
+    /// specified `allocator`.
+    void run(bslma::Allocator *allocator) BSLS_KEYWORD_OVERRIDE
+    {
+        allocateBlocks(allocator);
+        deallocateBlocks(allocator);
+        allocateBlocks(allocator);
+
+        for (bsl::size_t i = 0; i < d_blocks.size(); ++i) {
+            const unsigned char *block =
+                                static_cast<unsigned char *>(d_blocks[i]);
+            for (int j = 0; j < d_sizes[i]; j += 8) {
+                d_checksum += block[j];
+            }
+        }
+
+        deallocateBlocks(allocator);
+    }
+
+    // ACCESSORS
+
+    /// Return `false`.
+    bool isConcurrent() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+
+    /// Return the number of blocks allocated by this workload.
+    int numElements() const BSLS_KEYWORD_OVERRIDE
+    {
+        return static_cast<int>(d_blocks.size());
+    }
+};
+
+                       // ==============================
+                       // class ProducerConsumerWorkload
+                       // ==============================
+
+/// This class implements the `prodcons` workload: producer threads allocate
+/// messages and pass them to the calling thread, which deallocates them.
+class ProducerConsumerWorkload : public Workload {
+
+    // DATA
+    int                                d_numProducers;  // producer threads
+    int                                d_numMessages;   // messages per
+                                                        // producer
+    bdlcc::SingleConsumerQueue<void *> d_queue;         // produced messages
+    Int64                              d_checksum;      // accumulated to
+                                                        // keep the work
+                                                        // observable
+    bslma::Allocator                  *d_allocator_p;   // memory allocator
+                                                        // (held)
+
+  private:
+    // NOT IMPLEMENTED
+    ProducerConsumerWorkload(const ProducerConsumerWorkload&)
+                                                          BSLS_KEYWORD_DELETED;
+    ProducerConsumerWorkload& operator=(const ProducerConsumerWorkload&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Allocate, using the specified `allocator`, the messages of one
+    /// producer, and push them to the queue.
+    void produce(bslma::Allocator *allocator)
+    {
+        for (int i = 0; i < d_numMessages; ++i) {
+            const int size    = 16 << (i & 3);
+            void     *message = allocator->allocate(size);
+
+            bsl::memset(message, 0, size);
+            *static_cast<int *>(message) = size;
+            d_queue.pushBack(message);
+        }
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a workload in which the specified `numProducers` threads
+    /// produce a total of (at least) the specified `numElements` messages.
+    /// Use the specified `basicAllocator` to supply memory.
+    ProducerConsumerWorkload(int               numElements,
+                             int               numProducers,
+                             bslma::Allocator *basicAllocator)
+    : d_numProducers(numProducers)
+    , d_numMessages(bsl::max(1, numElements / numProducers))
+    , d_queue(basicAllocator)
+    , d_checksum(0)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Produce messages allocated from the specified `allocator` in the
+    /// producer threads, and consume and deallocate them in this thread.
+    void run(bslma::Allocator *allocator) BSLS_KEYWORD_OVERRIDE
+    {
+        bslmt::ThreadGroup threads(d_allocator_p);
+
+        const int numCreated = threads.addThreads(
+                    bdlf::BindUtil::bind(&ProducerConsumerWorkload::produce,
+                                         this,
+                                         allocator),
+                    d_numProducers);
+        BSLS_ASSERT_OPT(numCreated == d_numProducers);
+
+        const int numElements = d_numMessages * numCreated;
+        for (int i = 0; i < numElements; ++i) {
+            void *message = 0;
+            d_queue.popFront(&message);
+            d_checksum += *static_cast<int *>(message);
+            allocator->deallocate(message);
+        }
+
+        threads.joinAll();
+    }
+
+    // ACCESSORS
+
+    /// Return `true`.
+    bool isConcurrent() const BSLS_KEYWORD_OVERRIDE
+    {
+        return true;
+    }
+
+    /// Return the number of messages produced by an iteration of this
+    /// workload.
+    int numElements() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_numMessages * d_numProducers;
+    }
+};
+
+// FREE FUNCTIONS
+
+/// Return `true` if the allocator identified by the specified `kind` can be
+/// used concurrently from several threads, and `false` otherwise.
+bool isThreadSafe(AllocatorKind kind)
+{
+    return e_NEW_DELETE == kind || e_CONCURRENT_MULTIPOOL == kind;
+}
+
+/// Perform one iteration of the specified `workload` using the specified
+/// `allocator`, which is not thread-safe.  If `workload` is concurrent,
+/// serialize the use of `allocator` with a mutex.
+void runSerialized(Workload *workload, bslma::Allocator *allocator)
+{
+    if (workload->isConcurrent()) {
+        bslmt::Mutex                      mutex;
+        bdlma::ConcurrentAllocatorAdapter adapter(&mutex, allocator);
+
+        workload->run(&adapter);
+    }
+    else {
+        workload->run(allocator);
+    }
+}
+
+/// Perform one iteration of the specified `workload` using a new allocator
+/// of the specified `kind`.
+void runIteration(Workload *workload, AllocatorKind kind)
+{
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    switch (kind) {
+      case e_NEW_DELETE: {
+        workload->run(upstream);
+      } break;
+      case e_SEQUENTIAL: {
+        bdlma::SequentialAllocator allocator(upstream);
+        runSerialized(workload, &allocator);
+      } break;
+      case e_BUFFERED_SEQUENTIAL: {
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+        bdlma::BufferedSequentialAllocator allocator(buffer.buffer(),
+                                                     k_BUFFER_SIZE,
+                                                     upstream);
+        runSerialized(workload, &allocator);
+      } break;
+      case e_MULTIPOOL: {
+        bdlma::MultipoolAllocator allocator(upstream);
+        runSerialized(workload, &allocator);
+      } break;
+      case e_CONCURRENT_MULTIPOOL: {
+        bdlma::ConcurrentMultipoolAllocator allocator(upstream);
+        workload->run(&allocator);
+      } break;
+      case e_LOCAL_SEQUENTIAL: {
+        bdlma::LocalSequentialAllocator<k_BUFFER_SIZE> allocator(upstream);
+        runSerialized(workload, &allocator);
+      } break;
+    }
+}
+
+/// Return the time, in nanoseconds, taken by the specified `numIterations`
+/// iterations of the specified `workload`, each using a new allocator of
+/// the specified `kind`.
+Int64 runSample(Workload *workload, AllocatorKind kind, int numIterations)
+{
+    const Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numIterations; ++i) {
+        runIteration(workload, kind);
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+/// Return the index in the specified `names` of the specified `name`, which
+/// must be one of the specified `numNames` `names`.
+int indexOf(const char *const *names, int numNames, const bsl::string& name)
+{
+    const int index = static_cast<int>(
+                             bsl::find(names, names + numNames, name) - names);
+
+    BSLS_ASSERT_OPT(index < numNames);
+    return index;
+}
+
+/// Run the benchmark of the workload named by the specified `workloadName`,
+/// processing the specified `numElements` elements per iteration (with the
+/// specified `numThreads` producer threads for `prodcons`), using the
+/// allocator named by the specified `allocatorName`, for the specified
+/// `numSamples` samples.  Load the result into the specified `result`.
+void runBenchmark(Result             *result,
+                  const bsl::string&  allocatorName,
+                  const bsl::string&  workloadName,
+                  int                 numElements,
+                  int                 numThreads,
+                  int                 numSamples)
+{
+    bslma::Allocator *allocator = bslma::Default::allocator();
+
+    const AllocatorKind kind = static_cast<AllocatorKind>(
+                       indexOf(k_ALLOCATORS, k_NUM_ALLOCATORS, allocatorName));
+
+    bslma::ManagedPtr<Workload> workload;
+    switch (indexOf(k_WORKLOADS, k_NUM_WORKLOADS, workloadName)) {
+      case 0: {
+        workload.load(new (*allocator) ChurnWorkload(numElements), allocator);
+      } break;
+      case 1: {
+        workload.load(new (*allocator) ShuffleWorkload(numElements,
+                                                       allocator),
+                      allocator);
+      } break;
+      default: {
+        workload.load(new (*allocator) ProducerConsumerWorkload(numElements,
+                                                                numThreads,
+                                                                allocator),
+                      allocator);
+      } break;
+    }
+
+    const int numIterations = bsl::max(
+                                  1,
+                                  k_ELEMENTS_PER_SAMPLE /
+                                                     workload->numElements());
+
+    runIteration(workload.get(), kind);  // warm up
+
+    bsl::vector<Int64> times;
+    for (int i = 0; i < numSamples; ++i) {
+        times.push_back(runSample(workload.get(), kind, numIterations));
+    }
+    bsl::sort(times.begin(), times.end());
+
+    const Int64 medianNs = times[times.size() / 2];
+
+    result->d_allocator         = allocatorName;
+    result->d_workload          = workloadName;
+    result->d_numElements       = workload->numElements();
+    result->d_numThreads        = workload->isConcurrent() ? numThreads : 1;
+    result->d_synchronized      = workload->isConcurrent() &&
+                                                           !isThreadSafe(kind);
+    result->d_numIterations     = numIterations;
+    result->d_medianNs          = medianNs / numIterations;
+    result->d_minNs             = times.front() / numIterations;
+    result->d_elementsPerSecond =
+                            1e9 * workload->numElements() * numIterations /
+                            static_cast<double>(bsl::max<Int64>(1, medianNs));
+}
+
+/// Write to the specified `stream` the specified `results`, obtained with
+/// the specified `options`, as JSON.
+void writeJson(bsl::ostream&              stream,
+               const bsl::vector<Result>& results,
+               const Options&             options)
+{
+    baljsn::EncoderOptions encoderOptions;
+    encoderOptions.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+    encoderOptions.setSpacesPerLevel(2);
+
+    char timestamp[bdlt::Iso8601Util::k_DATETIME_STRLEN + 1];
+    bdlt::Iso8601Util::generate(timestamp,
+                                sizeof timestamp,
+                                bdlt::CurrentTime::utc());
+
+    baljsn::SimpleFormatter formatter(stream, encoderOptions);
+
+    formatter.openObject();
+    formatter.addValue("benchmark",  "m_allocatorbenchmark");
+    formatter.addValue("version",    balscm::Version::version());
+    formatter.addValue("timestamp",  timestamp);
+    formatter.addValue("samples",    options.d_numSamples);
+    formatter.addValue("bufferSize", static_cast<int>(k_BUFFER_SIZE));
+
+    formatter.openArray("results");
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+
+        formatter.openObject();
+        formatter.addValue("allocator",         result.d_allocator);
+        formatter.addValue("workload",          result.d_workload);
+        formatter.addValue("elements",          result.d_numElements);
+        formatter.addValue("threads",           result.d_numThreads);
+        formatter.addValue("synchronized",      result.d_synchronized);
+        formatter.addValue("iterations",        result.d_numIterations);
+
+        formatter.openObject("iterationNs");
+        formatter.addValue("median",            result.d_medianNs);
+        formatter.addValue("min",               result.d_minNs);
+        formatter.closeObject();
+
+        formatter.addValue("elementsPerSecond", result.d_elementsPerSecond);
+        formatter.closeObject();
+    }
+    formatter.closeArray();
+
+    formatter.closeObject();
+    stream << bsl::endl;
+}
+
+/// Write to the specified `stream` a one-line summary of the specified
+/// `result`.
+void printSummary(bsl::ostream& stream, const Result& result)
+{
+    stream << bsl::left
+           << bsl::setw(20) << result.d_allocator
+           << bsl::setw(9)  << result.d_workload
+           << " elements="  << bsl::setw(8) << result.d_numElements
+           << " threads="   << bsl::setw(3) << result.d_numThreads
+           << bsl::setw(6)  << (result.d_synchronized ? "sync" : "")
+           << bsl::right
+           << " median="    << bsl::setw(11) << result.d_medianNs
+           << " min="       << bsl::setw(11) << result.d_minNs
+           << " elem/s="    << bsl::setw(11)
+           << static_cast<Int64>(result.d_elementsPerSecond)
+           << bsl::endl;
+}
+
+/// Load into the specified `result` the comma-separated positive integers
+/// in the specified `list`.  Return 0 on success, and a non-zero value
+/// otherwise.
+int parseIntegers(bsl::vector<int> *result, const char *list)
+{
+    result->clear();
+
+    while (*list) {
+        char *end;
+        long  value = bsl::strtol(list, &end, 10);
+
+        if (end == list || value <= 0 || value > 1000000000) {
+            return -1;                                                // RETURN
+        }
+        result->push_back(static_cast<int>(value));
+
+        if (',' == *end) {
+            ++end;
+        }
+        else if ('\0' != *end) {
+            return -1;                                                // RETURN
+        }
+        list = end;
+    }
+    return result->empty() ? -1 : 0;
+}
+
+/// Load into the specified `result` the comma-separated names in the
+/// specified `list`.  Return 0 on success, and a non-zero value if `list`
+/// holds an empty name or a name that is not one of the specified
+/// `numValid` `validNames`.
+int parseNames(bsl::vector<bsl::string> *result,
+               const char               *list,
+               const char *const        *validNames,
+               int                       numValid)
+{
+    result->clear();
+
+    const char *begin = list;
+    for (const char *p = list; ; ++p) {
+        if (',' == *p || '\0' == *p) {
+            const bsl::string name(begin, p);
+
+            if (validNames + numValid == bsl::find(validNames,
+                                                   validNames + numValid,
+                                                   name)) {
+                return -1;                                            // RETURN
+            }
+            result->push_back(name);
+
+            if ('\0' == *p) {
+                break;                                                 // BREAK
+            }
+            begin = p + 1;
+        }
+    }
+    return 0;
+}
+
+/// Print the usage of this application, named by the specified `program`,
+/// to the standard error.
+void printUsage(const char *program)
+{
+    bsl::cerr
+        << "usage: " << program << " [--allocators=<name>,...]\n"
+        << "           [--workloads=<name>,...] [--elements=<n>,...]\n"
+        << "           [--threads=<n>,...] [--samples=<n>] [--output=<file>]\n"
+        << "  Measure the performance of the `bslma` and `bdlma` allocators.\n"
+        << "  --allocators  any of newdelete,sequential,bufferedsequential,\n"
+        << "                multipool,concurrentmultipool,localsequential\n"
+        << "                (default all)\n"
+        << "  --workloads   any of churn,shuffle,prodcons (default all)\n"
+        << "  --elements    elements per iteration (default 1024,65536)\n"
+        << "  --threads     producer threads of prodcons (default 1,4)\n"
+        << "  --samples     number of samples (default 5)\n"
+        << "  --output      JSON output file (default standard output)"
+        << bsl::endl;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    u::Options options;
+    options.d_allocators.assign(u::k_ALLOCATORS,
+                                u::k_ALLOCATORS + u::k_NUM_ALLOCATORS);
+    options.d_workloads.assign(u::k_WORKLOADS,
+                               u::k_WORKLOADS + u::k_NUM_WORKLOADS);
+    options.d_elements.push_back(1024);
+    options.d_elements.push_back(65536);
+    options.d_threads.push_back(1);
+    options.d_threads.push_back(4);
+    options.d_numSamples = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        value             = value ? value + 1 : "";
+
+        int rc = 0;
+        if (0 == bsl::strcmp(arg, "-h") || 0 == bsl::strcmp(arg, "--help")) {
+            u::printUsage(argv[0]);
+            return 0;                                                 // RETURN
+        }
+        else if (0 == bsl::strncmp(arg, "--allocators=", 13)) {
+            rc = u::parseNames(&options.d_allocators,
+                               value,
+                               u::k_ALLOCATORS,
+                               u::k_NUM_ALLOCATORS);
+        }
+        else if (0 == bsl::strncmp(arg, "--workloads=", 12)) {
+            rc = u::parseNames(&options.d_workloads,
+                               value,
+                               u::k_WORKLOADS,
+                               u::k_NUM_WORKLOADS);
+        }
+        else if (0 == bsl::strncmp(arg, "--elements=", 11)) {
+            rc = u::parseIntegers(&options.d_elements, value);
+        }
+        else if (0 == bsl::strncmp(arg, "--threads=", 10)) {
+            rc = u::parseIntegers(&options.d_threads, value);
+        }
+        else if (0 == bsl::strncmp(arg, "--samples=", 10)) {
+            bsl::vector<int> values;
+            rc = u::parseIntegers(&values, value);
+            if (0 == rc) {
+                options.d_numSamples = values.front();
+            }
+        }
+        else if (0 == bsl::strncmp(arg, "--output=", 9)) {
+            options.d_output = value;
+        }
+        else {
+            rc = -1;
+        }
+
+        if (0 != rc) {
+            bsl::cerr << argv[0] << ": invalid argument " << arg << bsl::endl;
+            u::printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    bsl::vector<u::Result> results;
+
+    for (bsl::size_t wi = 0; wi < options.d_workloads.size(); ++wi) {
+        const bsl::string& workload   = options.d_workloads[wi];
+        const bool         concurrent = "prodcons" == workload;
+
+        for (bsl::size_t ai = 0; ai < options.d_allocators.size(); ++ai) {
+            for (bsl::size_t ei = 0; ei < options.d_elements.size(); ++ei) {
+                for (bsl::size_t ti = 0; ti < options.d_threads.size(); ++ti) {
+                    if (!concurrent && 0 < ti) {
+                        break;                                         // BREAK
+                    }
+
+                    u::Result result;
+                    u::runBenchmark(&result,
+                                    options.d_allocators[ai],
+                                    workload,
+                                    options.d_elements[ei],
+                                    options.d_threads[ti],
+                                    options.d_numSamples);
+
+                    u::printSummary(bsl::cerr, result);
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+
+    int status = 0;
+
+    if (options.d_output.empty()) {
+        u::writeJson(bsl::cout, results, options);
+    }
+    else {
+        bsl::ofstream output(options.d_output.c_str());
+        u::writeJson(output, results, options);
+        if (!output) {
+            bsl::cerr << argv[0] << ": cannot write " << options.d_output
+                      << bsl::endl;
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
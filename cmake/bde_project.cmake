@@ -116,6 +116,6 @@ function(bde_project_process_uors proj listDir)
     find_uors(standalones "adapters" "standalones")
     bde_project_process_standalone_packages(${proj} "${standalones}")
 
-    find_uors(applications "applications")
+    find_uors(applications "applications" "benchmarks/allocators")
     bde_project_process_applications(${proj} "${applications}")
 endfunction()
@@ -0,0 +1,278 @@
+// balb_contentionprofiler.cpp                                        -*-C++-*-
+#include <balb_contentionprofiler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balb_contentionprofiler_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_contentionutil.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef bsls::AtomicOperations AtomicOps;
+
+/// The active profiler, or 0 if no profiler is active.
+AtomicOps::AtomicTypes::Pointer g_activeProfiler = { 0 };
+
+/// The number of invocations of the wait callback in progress.
+AtomicOps::AtomicTypes::Int     g_numCallbacksInProgress = { 0 };
+
+/// Return `true` if the specified `lhs` call site has a larger total wait
+/// time than the specified `rhs` call site, and `false` otherwise.
+bool hasLongerTotalWait(const balb::ContentionProfiler::CallSite& lhs,
+                        const balb::ContentionProfiler::CallSite& rhs)
+{
+    return lhs.d_totalWaitTime > rhs.d_totalWaitTime;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace balb {
+
+                    // ----------------------------------
+                    // struct ContentionProfiler::CallSite
+                    // ----------------------------------
+
+// CREATORS
+ContentionProfiler::CallSite::CallSite(bslma::Allocator *basicAllocator)
+: d_addresses(basicAllocator)
+, d_numSamples(0)
+, d_totalWaitTime(0)
+, d_maxWaitTime(0)
+{
+}
+
+ContentionProfiler::CallSite::CallSite(const CallSite&   original,
+                                       bslma::Allocator *basicAllocator)
+: d_addresses(original.d_addresses, basicAllocator)
+, d_numSamples(original.d_numSamples)
+, d_totalWaitTime(original.d_totalWaitTime)
+, d_maxWaitTime(original.d_maxWaitTime)
+{
+}
+
+                         // ------------------------
+                         // class ContentionProfiler
+                         // ------------------------
+
+// PRIVATE CLASS METHODS
+void ContentionProfiler::waitCallback(const void         *,
+                                      bsls::Types::Int64  waitTime)
+{
+    // `stop` clears the active profiler and then waits for the count of
+    // callbacks in progress to drop to zero, so the profiler loaded here
+    // remains valid until the count is decremented.
+
+    u::AtomicOps::addInt(&u::g_numCallbacksInProgress, 1);
+
+    ContentionProfiler *profiler = static_cast<ContentionProfiler *>(
+                                u::AtomicOps::getPtr(&u::g_activeProfiler));
+    if (profiler) {
+        profiler->record(waitTime);
+    }
+
+    u::AtomicOps::addInt(&u::g_numCallbacksInProgress, -1);
+}
+
+// PRIVATE MANIPULATORS
+void ContentionProfiler::record(bsls::Types::Int64 waitTime)
+{
+    const bsls::Types::Int64 numReports = ++d_numReports;
+    if (0 != (numReports - 1) % d_sampleInterval) {
+        return;                                                       // RETURN
+    }
+
+    static const int k_IGNORE_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES;
+    static const int k_BUFFER_SIZE   = k_MAX_FRAMES + k_IGNORE_FRAMES;
+
+    // A failure to walk the stack is recorded as an empty stack.
+
+    void      *buffer[k_BUFFER_SIZE];
+    const int  numFrames = bsl::max<int>(
+                      bsls::StackAddressUtil::getStackAddresses(buffer,
+                                                                k_BUFFER_SIZE),
+                      k_IGNORE_FRAMES);
+
+    const bsl::vector<void *> stack(buffer + k_IGNORE_FRAMES,
+                                    buffer + numFrames,
+                                    d_allocator_p);
+
+    ++d_numSamples;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Statistics& statistics = d_sites[stack];
+
+    ++statistics.d_numSamples;
+    statistics.d_totalWaitTime += waitTime;
+    statistics.d_maxWaitTime    = bsl::max(statistics.d_maxWaitTime,
+                                           waitTime);
+}
+
+// CREATORS
+ContentionProfiler::ContentionProfiler(bsls::Types::Int64  threshold,
+                                       int                 sampleInterval,
+                                       bslma::Allocator   *basicAllocator)
+: d_threshold(threshold)
+, d_sampleInterval(sampleInterval)
+, d_numReports(0)
+, d_numSamples(0)
+, d_sites(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= threshold);
+    BSLS_ASSERT(1 <= sampleInterval);
+}
+
+ContentionProfiler::~ContentionProfiler()
+{
+    stop();
+}
+
+// MANIPULATORS
+void ContentionProfiler::reset()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_sites.clear();
+    d_numReports = 0;
+    d_numSamples = 0;
+}
+
+int ContentionProfiler::start()
+{
+    void *previous = u::AtomicOps::testAndSwapPtr(&u::g_activeProfiler,
+                                                  0,
+                                                  this);
+    if (0 != previous && this != previous) {
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::ContentionUtil::setWaitCallback(&waitCallback, d_threshold);
+    return 0;
+}
+
+void ContentionProfiler::stop()
+{
+    if (this != u::AtomicOps::testAndSwapPtr(&u::g_activeProfiler,
+                                             this,
+                                             0)) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::ContentionUtil::setWaitCallback(0, 0);
+
+    while (0 != u::AtomicOps::getInt(&u::g_numCallbacksInProgress)) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+// ACCESSORS
+bool ContentionProfiler::isActive() const
+{
+    return this == u::AtomicOps::getPtr(&u::g_activeProfiler);
+}
+
+void ContentionProfiler::loadCallSites(bsl::vector<CallSite> *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        result->reserve(d_sites.size());
+        for (SiteMap::const_iterator it = d_sites.begin();
+             it != d_sites.end();
+             ++it) {
+            CallSite site(result->get_allocator().mechanism());
+
+            site.d_addresses     = it->first;
+            site.d_numSamples    = it->second.d_numSamples;
+            site.d_totalWaitTime = it->second.d_totalWaitTime;
+            site.d_maxWaitTime   = it->second.d_maxWaitTime;
+
+            result->push_back(site);
+        }
+    }
+
+    bsl::stable_sort(result->begin(), result->end(), &u::hasLongerTotalWait);
+}
+
+bsl::ostream& ContentionProfiler::print(bsl::ostream& stream,
+                                        int           maxCallSites) const
+{
+    bsl::vector<CallSite> callSites(d_allocator_p);
+    loadCallSites(&callSites);
+
+    const bsl::size_t numCallSites =
+                     0 <= maxCallSites
+                     ? bsl::min(callSites.size(),
+                                static_cast<bsl::size_t>(maxCallSites))
+                     : callSites.size();
+
+    stream << "Lock contention profile: "
+           << numReports() << " reports, "
+           << numSamples() << " samples, "
+           << callSites.size() << " call sites\n";
+
+    for (bsl::size_t i = 0; i < numCallSites; ++i) {
+        const CallSite& site = callSites[i];
+
+        stream << "\nCall site " << i + 1 << ": "
+               << site.d_numSamples    << " samples, total wait "
+               << site.d_totalWaitTime << " ns, max wait "
+               << site.d_maxWaitTime   << " ns\n";
+
+        balst::StackTrace stackTrace(d_allocator_p);
+        if (site.d_addresses.empty()
+         || 0 != balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                           &stackTrace,
+                           &site.d_addresses[0],
+                           static_cast<int>(site.d_addresses.size()))) {
+            stream << "(stack unavailable)\n";
+            continue;
+        }
+
+        balst::StackTraceUtil::printFormatted(stream, stackTrace);
+    }
+
+    return stream << bsl::flush;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,351 @@
+// balb_contentionprofiler.h                                          -*-C++-*-
+#ifndef INCLUDED_BALB_CONTENTIONPROFILER
+#define INCLUDED_BALB_CONTENTIONPROFILER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to find the call sites of contended locks.
+//
+//@CLASSES:
+//  balb::ContentionProfiler: records stacks of slow lock acquisitions
+//
+//@SEE_ALSO: bslmt_contentionutil, bslmt_adaptivemutex, balst_stacktraceutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `balb::ContentionProfiler`, that records the call sites at which threads
+// waited longer than a threshold to acquire a lock.  While a profiler is
+// *active* (between calls to `start` and `stop`), it is installed as the wait
+// callback of `bslmt::ContentionUtil`, so every acquisition of a profiling
+// lock (such as `bslmt::AdaptiveMutex` or `bslmt::AdaptiveReaderWriterMutex`)
+// that waits at least `threshold()` nanoseconds is *reported* to it.
+//
+// To bound its overhead, the profiler *samples* one of every
+// `sampleInterval()` reports.  For each sample it captures the return
+// addresses on the stack of the waiting thread (using
+// `bsls::StackAddressUtil`), and aggregates the samples by stack: a
+// `balb::ContentionProfiler::CallSite` holds the stack addresses, the number
+// of samples taken with that stack, and their total and maximum wait times.
+// Stacks are resolved to symbols (using `balst::StackTraceUtil`) only when the
+// profile is printed, so capturing a sample costs little more than walking the
+// stack and updating a map.
+//
+// At most one profiler is active in a process at any time; `start` fails if
+// another profiler is active.  Note that starting a profiler replaces any wait
+// callback installed directly with `bslmt::ContentionUtil`, and that stopping
+// it uninstalls the callback.
+//
+///Thread Safety
+///-------------
+// `balb::ContentionProfiler` is fully thread-safe, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.  `stop` (and the destructor) wait for reports in
+// progress on other threads to complete.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding a Hot Lock
+///- - - - - - - - - - - - - - -
+// Suppose that a service protects its state with `bslmt::AdaptiveMutex`
+// objects, and that we want to find out which acquisitions block for more than
+// 10 milliseconds.
+//
+// First, we create a profiler having that threshold, and start it:
+// ```
+// balb::ContentionProfiler profiler(10 * 1000 * 1000);
+//
+// int rc = profiler.start();
+// assert(0 == rc);
+// ```
+// Then, we run the service; here, the main thread holds a mutex for 50
+// milliseconds while another thread tries to acquire it:
+// ```
+// bslmt::AdaptiveMutex mutex;
+//
+// mutex.lock();
+//
+// bslmt::ThreadUtil::Handle handle;
+// bslmt::ThreadUtil::create(&handle, &lockAndUnlock, &mutex);
+// bslmt::ThreadUtil::microSleep(50 * 1000);
+//
+// mutex.unlock();
+// bslmt::ThreadUtil::join(handle);
+// ```
+// where `lockAndUnlock` is a thread function that locks and unlocks the
+// `bslmt::AdaptiveMutex` supplied as its argument.
+//
+// Next, we stop the profiler, and find one call site:
+// ```
+// profiler.stop();
+//
+// bsl::vector<balb::ContentionProfiler::CallSite> callSites;
+// profiler.loadCallSites(&callSites);
+//
+// assert(1 == callSites.size());
+// assert(1 == callSites[0].d_numSamples);
+// ```
+// Finally, we print the profile, which shows the stack of the thread that
+// waited, including `lockAndUnlock`:
+// ```
+// profiler.print(bsl::cout);
+// ```
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balb {
+
+                         // ========================
+                         // class ContentionProfiler
+                         // ========================
+
+/// This mechanism records the stacks of threads that waited for a lock
+/// longer than a threshold.  See {Description}.
+class ContentionProfiler {
+
+  public:
+    // TYPES
+
+    /// This `struct` describes the samples having a common stack.
+    struct CallSite {
+
+        // PUBLIC DATA
+        bsl::vector<void *> d_addresses;      // return addresses, from the
+                                              // innermost frame outward
+
+        bsls::Types::Int64  d_numSamples;     // number of samples
+
+        bsls::Types::Int64  d_totalWaitTime;  // sum of the wait times, in
+                                              // nanoseconds
+
+        bsls::Types::Int64  d_maxWaitTime;    // largest wait time, in
+                                              // nanoseconds
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(CallSite, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+
+        /// Create a call site having no addresses and no samples.
+        /// Optionally specify a `basicAllocator` used to supply memory.  If
+        /// `basicAllocator` is 0, the currently installed default allocator
+        /// is used.
+        explicit CallSite(bslma::Allocator *basicAllocator = 0);
+
+        /// Create a call site having the value of the specified `original`
+        /// call site.  Optionally specify a `basicAllocator` used to supply
+        /// memory.  If `basicAllocator` is 0, the currently installed
+        /// default allocator is used.
+        CallSite(const CallSite&   original,
+                 bslma::Allocator *basicAllocator = 0);
+    };
+
+    enum {
+        k_MAX_FRAMES = 32  // maximum number of frames captured per sample
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// This `struct` holds the statistics of the samples having a stack.
+    struct Statistics {
+        bsls::Types::Int64 d_numSamples;
+        bsls::Types::Int64 d_totalWaitTime;
+        bsls::Types::Int64 d_maxWaitTime;
+    };
+
+    typedef bsl::map<bsl::vector<void *>, Statistics> SiteMap;
+
+    // DATA
+    const bsls::Types::Int64  d_threshold;       // minimum reported wait, in
+                                                 // nanoseconds
+
+    const int                 d_sampleInterval;  // one report in this many
+                                                 // is sampled
+
+    bsls::AtomicInt64         d_numReports;      // reports received
+
+    bsls::AtomicInt64         d_numSamples;      // reports sampled
+
+    mutable bslmt::Mutex      d_mutex;           // protects `d_sites`
+
+    SiteMap                   d_sites;           // statistics by stack
+
+    bslma::Allocator         *d_allocator_p;     // memory allocator (held,
+                                                 // not owned)
+
+    // PRIVATE CLASS METHODS
+
+    /// Forward the report of the specified `lock` having the specified
+    /// `waitTime` to the active profiler, if any.  This function is
+    /// installed as the wait callback of `bslmt::ContentionUtil`.
+    static void waitCallback(const void *lock, bsls::Types::Int64 waitTime);
+
+    // PRIVATE MANIPULATORS
+
+    /// Count a report of the specified `waitTime`, and, if it is sampled,
+    /// record it under the stack of the calling thread.
+    void record(bsls::Types::Int64 waitTime);
+
+  private:
+    // NOT IMPLEMENTED
+    ContentionProfiler(const ContentionProfiler&) BSLS_KEYWORD_DELETED;
+    ContentionProfiler& operator=(const ContentionProfiler&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ContentionProfiler,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an inactive profiler that samples one of every specified
+    /// `sampleInterval` lock acquisitions that wait at least the specified
+    /// `threshold` nanoseconds.  If `sampleInterval` is not specified, every
+    /// such acquisition is sampled.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.  The behavior is undefined
+    /// unless `0 <= threshold` and `1 <= sampleInterval`.
+    explicit ContentionProfiler(bsls::Types::Int64  threshold,
+                                int                 sampleInterval = 1,
+                                bslma::Allocator   *basicAllocator = 0);
+
+    /// Stop this profiler, if it is active, and destroy it.
+    ~ContentionProfiler();
+
+    // MANIPULATORS
+
+    /// Discard the samples and report counts recorded by this profiler.
+    void reset();
+
+    /// Make this profiler the active profiler of the process, installing
+    /// it as the wait callback of `bslmt::ContentionUtil`.  Return 0 on
+    /// success, and a non-zero value, with no effect, if another profiler
+    /// is active.  Starting an active profiler has no effect and succeeds.
+    int start();
+
+    /// Make this profiler inactive, uninstalling it as the wait callback
+    /// of `bslmt::ContentionUtil`, and wait for reports in progress to
+    /// complete.  The recorded samples are retained.  This method has no
+    /// effect if this profiler is not active.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return `true` if this profiler is the active profiler of the
+    /// process, and `false` otherwise.
+    bool isActive() const;
+
+    /// Load into the specified `result` the call sites recorded by this
+    /// profiler, in decreasing order of total wait time.
+    void loadCallSites(bsl::vector<CallSite> *result) const;
+
+    /// Return the number of reports received by this profiler since its
+    /// creation or the most recent call to `reset`.
+    bsls::Types::Int64 numReports() const;
+
+    /// Return the number of reports sampled by this profiler since its
+    /// creation or the most recent call to `reset`.
+    bsls::Types::Int64 numSamples() const;
+
+    /// Write the call sites recorded by this profiler, in decreasing order
+    /// of total wait time, to the specified `stream`, with their statistics
+    /// and symbolized stacks, and return a reference to `stream`.
+    /// Optionally specify `maxCallSites`, the maximum number of call sites
+    /// to write; if `maxCallSites` is negative or not specified, all call
+    /// sites are written.  Note that the format is not fully specified, and
+    /// can change without notice.
+    bsl::ostream& print(bsl::ostream& stream, int maxCallSites = -1) const;
+
+    /// Return the number of reports of which one is sampled.
+    int sampleInterval() const;
+
+    /// Return the minimum wait time, in nanoseconds, reported to this
+    /// profiler.
+    bsls::Types::Int64 threshold() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class ContentionProfiler
+                         // ------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 ContentionProfiler::numReports() const
+{
+    return d_numReports.load();
+}
+
+inline
+bsls::Types::Int64 ContentionProfiler::numSamples() const
+{
+    return d_numSamples.load();
+}
+
+inline
+int ContentionProfiler::sampleInterval() const
+{
+    return d_sampleInterval;
+}
+
+inline
+bsls::Types::Int64 ContentionProfiler::threshold() const
+{
+    return d_threshold;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *ContentionProfiler::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
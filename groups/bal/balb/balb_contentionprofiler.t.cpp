@@ -0,0 +1,761 @@
+// balb_contentionprofiler.t.cpp                                      -*-C++-*-
+#include <balb_contentionprofiler.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_adaptivemutex.h>
+#include <bslmt_barrier.h>
+#include <bslmt_contentionutil.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that installs itself as the wait
+// callback of `bslmt::ContentionUtil`.  We drive it both by reporting waits
+// directly through `bslmt::ContentionUtil::reportWait` (which lets us control
+// the call site and wait time exactly) and by contending a
+// `bslmt::AdaptiveMutex`.
+// ----------------------------------------------------------------------------
+// CallSite
+// [ 2] CallSite(bslma::Allocator *basicAllocator = 0);
+// [ 2] CallSite(const CallSite& original, bslma::Allocator *ba = 0);
+//
+// CREATORS
+// [ 3] ContentionProfiler(Int64 threshold, int interval = 1, *ba = 0);
+// [ 3] ~ContentionProfiler();
+//
+// MANIPULATORS
+// [ 4] void reset();
+// [ 3] int start();
+// [ 3] void stop();
+//
+// ACCESSORS
+// [ 3] bool isActive() const;
+// [ 4] void loadCallSites(bsl::vector<CallSite> *result) const;
+// [ 4] bsls::Types::Int64 numReports() const;
+// [ 4] bsls::Types::Int64 numSamples() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream, int maxCallSites) const;
+// [ 3] int sampleInterval() const;
+// [ 3] bsls::Types::Int64 threshold() const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balb::ContentionProfiler Obj;
+typedef Obj::CallSite            CallSite;
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int lockDummy;
+int numReportsFromSiteA = 0;
+int numReportsFromSiteB = 0;
+
+/// Report a wait of the specified `waitTime` from a first call site.
+void reportFromSiteA(bsls::Types::Int64 waitTime)
+{
+    bslmt::ContentionUtil::reportWait(&lockDummy, waitTime);
+
+    // Prevent the report from being a tail call, which would remove this
+    // frame from the stack.
+
+    ++numReportsFromSiteA;
+}
+
+/// Report a wait of the specified `waitTime` from a second call site.
+void reportFromSiteB(bsls::Types::Int64 waitTime)
+{
+    bslmt::ContentionUtil::reportWait(&lockDummy, waitTime);
+
+    ++numReportsFromSiteB;
+}
+
+typedef void (*ReportFunction)(bsls::Types::Int64);
+
+// The report functions are called through `volatile` pointers, so that they
+// are not inlined, and calls to both from a single line of a test have
+// distinct stacks.
+
+ReportFunction volatile siteA = &reportFromSiteA;
+ReportFunction volatile siteB = &reportFromSiteB;
+
+}  // close unnamed namespace
+
+namespace MUTEX_TEST {
+
+struct Data {
+    bslmt::AdaptiveMutex d_mutex;
+    bslmt::Barrier       d_barrier;
+
+    Data() : d_barrier(2) {}
+};
+
+/// Wait on the barrier of the specified `arg` `Data`, then lock and unlock
+/// its mutex.
+extern "C" void *lockAfterBarrier(void *arg)
+{
+    Data *data = static_cast<Data *>(arg);
+
+    data->d_barrier.wait();
+    data->d_mutex.lock();
+    data->d_mutex.unlock();
+
+    return 0;
+}
+
+}  // close namespace MUTEX_TEST
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+/// Lock and unlock the `bslmt::AdaptiveMutex` at the specified `arg`.
+extern "C" void *lockAndUnlock(void *arg)
+{
+    bslmt::AdaptiveMutex *mutex = static_cast<bslmt::AdaptiveMutex *>(arg);
+
+    mutex->lock();
+    mutex->unlock();
+
+    return 0;
+}
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding a Hot Lock
+///- - - - - - - - - - - - - - -
+// Suppose that a service protects its state with `bslmt::AdaptiveMutex`
+// objects, and that we want to find out which acquisitions block for more than
+// 10 milliseconds.
+//
+// First, we create a profiler having that threshold, and start it:
+// ```
+    balb::ContentionProfiler profiler(10 * 1000 * 1000);
+
+    int rc = profiler.start();
+    ASSERT(0 == rc);
+// ```
+// Then, we run the service; here, the main thread holds a mutex for 50
+// milliseconds while another thread tries to acquire it:
+// ```
+    bslmt::AdaptiveMutex mutex;
+
+    mutex.lock();
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::create(&handle, &lockAndUnlock, &mutex);
+    bslmt::ThreadUtil::microSleep(50 * 1000);
+
+    mutex.unlock();
+    bslmt::ThreadUtil::join(handle);
+// ```
+// where `lockAndUnlock` is a thread function that locks and unlocks the
+// `bslmt::AdaptiveMutex` supplied as its argument.
+//
+// Next, we stop the profiler, and find one call site:
+// ```
+    profiler.stop();
+
+    bsl::vector<balb::ContentionProfiler::CallSite> callSites;
+    profiler.loadCallSites(&callSites);
+
+    ASSERT(1 == callSites.size());
+    ASSERT(1 == callSites[0].d_numSamples);
+// ```
+// Finally, we print the profile, which shows the stack of the thread that
+// waited, including `lockAndUnlock`:
+// ```
+    if (veryVerbose) {
+        profiler.print(bsl::cout);
+    }
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `print`
+        //
+        // Concerns:
+        // 1. `print` writes a summary line, followed by one section per call
+        //    site, in decreasing order of total wait time.
+        //
+        // 2. `maxCallSites` limits the number of sections written.
+        //
+        // Plan:
+        // 1. Record samples from two call sites and verify the output of
+        //    `print` with and without a limit.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream, int maxCallSites) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `print`" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(0, 1, &oa);  const Obj& X = mX;
+
+        ASSERT(0 == mX.start());
+        siteA(100);
+        siteB(1000);
+        mX.stop();
+
+        bslma::TestAllocator        sa("stream", veryVerbose);
+        bsl::ostringstream          all(&sa);
+        bsl::ostringstream          one(&sa);
+
+        X.print(all);
+        X.print(one, 1);
+
+        const bsl::string ALL(all.str(), &sa);
+        const bsl::string ONE(one.str(), &sa);
+
+        if (veryVerbose) { P(ALL) }
+
+        ASSERT(0 == ALL.find("Lock contention profile: 2 reports, 2 samples,"
+                             " 2 call sites"));
+        ASSERT(bsl::string::npos != ALL.find("Call site 1: 1 samples,"
+                                             " total wait 1000 ns"));
+        ASSERT(bsl::string::npos != ALL.find("Call site 2: 1 samples,"
+                                             " total wait 100 ns"));
+        ASSERT(ALL.find("Call site 1") < ALL.find("Call site 2"));
+
+        ASSERT(bsl::string::npos != ONE.find("Call site 1"));
+        ASSERT(bsl::string::npos == ONE.find("Call site 2"));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING RECORDING
+        //
+        // Concerns:
+        // 1. Every report received while active is counted, and one of every
+        //    `sampleInterval()` reports is sampled, starting with the first.
+        //
+        // 2. Samples are aggregated by stack, so distinct call sites are
+        //    recorded separately, with their sample count and total and
+        //    maximum wait times.
+        //
+        // 3. `loadCallSites` orders call sites by decreasing total wait, and
+        //    uses the allocator of the supplied vector.
+        //
+        // 4. Reports below the threshold, or received while inactive, are not
+        //    counted.
+        //
+        // 5. A contended `bslmt::AdaptiveMutex` is profiled.
+        //
+        // 6. `reset` discards the samples and counts.
+        //
+        // 7. Memory is supplied by the object allocator.
+        //
+        // Plan:
+        // 1. Report waits from two call sites with sampling intervals of 1
+        //    and 3, and verify the counts and call sites.  (C-1..3, 7)
+        //
+        // 2. Report waits below the threshold and while stopped, and verify
+        //    that nothing is recorded.  (C-4)
+        //
+        // 3. Contend an adaptive mutex while active, and verify that a call
+        //    site is recorded.  (C-5)
+        //
+        // 4. Call `reset` and verify that the profiler is empty.  (C-6)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadCallSites(bsl::vector<CallSite> *result) const;
+        //   bsls::Types::Int64 numReports() const;
+        //   bsls::Types::Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RECORDING" << endl
+                          << "=================" << endl;
+
+        if (verbose) cout << "\nAggregating by call site." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+            bslma::TestAllocator va("vector", veryVerbose);
+
+            Obj mX(10, 1, &oa);  const Obj& X = mX;
+
+            static const struct {
+                int                d_line;      // source line number
+                char               d_site;      // 'A' or 'B'
+                bsls::Types::Int64 d_waitTime;  // reported wait time
+            } DATA[] = {
+                //LINE  SITE  WAIT TIME
+                //----  ----  ---------
+                { L_,   'A',         10 },
+                { L_,   'A',         30 },
+                { L_,   'B',        100 },
+                { L_,   'A',          9 },  // below threshold
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            ASSERT(0 == mX.start());
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                ('A' == DATA[ti].d_site ? siteA : siteB)(DATA[ti].d_waitTime);
+            }
+
+            mX.stop();
+
+            siteB(100);  // inactive
+
+            ASSERTV(X.numReports(), 3 == X.numReports());
+            ASSERTV(X.numSamples(), 3 == X.numSamples());
+            ASSERT(0 < oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksInUse());
+
+            bsl::vector<CallSite> sites(&va);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 2 == sites.size());
+            ASSERT(0 < va.numBlocksInUse());
+
+            if (2 == sites.size()) {
+                ASSERTV(sites[0].d_numSamples,    1 == sites[0].d_numSamples);
+                ASSERTV(sites[0].d_totalWaitTime,
+                        100 == sites[0].d_totalWaitTime);
+                ASSERTV(sites[0].d_maxWaitTime,
+                        100 == sites[0].d_maxWaitTime);
+
+                ASSERTV(sites[1].d_numSamples,    2 == sites[1].d_numSamples);
+                ASSERTV(sites[1].d_totalWaitTime,
+                        40 == sites[1].d_totalWaitTime);
+                ASSERTV(sites[1].d_maxWaitTime,  30 == sites[1].d_maxWaitTime);
+
+                ASSERT(!sites[0].d_addresses.empty());
+                ASSERT(sites[0].d_addresses != sites[1].d_addresses);
+                ASSERT(&va == sites[0].d_addresses.get_allocator());
+            }
+
+            mX.reset();
+
+            ASSERT(0 == X.numReports());
+            ASSERT(0 == X.numSamples());
+
+            X.loadCallSites(&sites);
+            ASSERT(sites.empty());
+        }
+
+        if (verbose) cout << "\nSampling." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(0, 3, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            for (int i = 1; i <= 7; ++i) {
+                siteA(i);
+            }
+
+            mX.stop();
+
+            ASSERTV(X.numReports(), 7 == X.numReports());
+            ASSERTV(X.numSamples(), 3 == X.numSamples());
+
+            bsl::vector<CallSite> sites(&oa);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 1 == sites.size());
+
+            if (1 == sites.size()) {
+                // Reports 1, 4 and 7 are sampled.
+
+                ASSERTV(sites[0].d_totalWaitTime,
+                        12 == sites[0].d_totalWaitTime);
+                ASSERTV(sites[0].d_maxWaitTime, 7 == sites[0].d_maxWaitTime);
+            }
+        }
+
+        if (verbose) cout << "\nProfiling an adaptive mutex." << endl;
+        {
+            using namespace MUTEX_TEST;
+
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(1000 * 1000, 1, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            Data data;
+
+            data.d_mutex.lock();
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &lockAfterBarrier,
+                                                  &data));
+            data.d_barrier.wait();
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+            data.d_mutex.unlock();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            mX.stop();
+
+            ASSERTV(X.numReports(), 1 == X.numReports());
+
+            bsl::vector<CallSite> sites(&oa);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 1 == sites.size());
+
+            if (1 == sites.size()) {
+                ASSERTV(sites[0].d_maxWaitTime,
+                        50 * 1000 * 1000 < sites[0].d_maxWaitTime);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, `start`, AND `stop`
+        //
+        // Concerns:
+        // 1. The constructor sets the threshold, sample interval, and
+        //    allocator, and creates an inactive profiler.
+        //
+        // 2. `start` installs the profiler as the wait callback with its
+        //    threshold, and `stop` uninstalls it.
+        //
+        // 3. Only one profiler is active at a time; `start` on an active
+        //    profiler succeeds.
+        //
+        // 4. The destructor stops an active profiler.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create profilers and verify their attributes, and the state of
+        //    `bslmt::ContentionUtil`, around calls to `start` and `stop`.
+        //    (C-1..4)
+        //
+        // 2. Verify that invalid arguments are detected.  (C-5)
+        //
+        // Testing:
+        //   ContentionProfiler(Int64 threshold, int interval = 1, *ba = 0);
+        //   ~ContentionProfiler();
+        //   int start();
+        //   void stop();
+        //   bool isActive() const;
+        //   int sampleInterval() const;
+        //   bsls::Types::Int64 threshold() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, `start`, AND `stop`" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        if (verbose) cout << "\nTesting attributes." << endl;
+        {
+            Obj mX(123);  const Obj& X = mX;
+
+            ASSERT(123 == X.threshold());
+            ASSERT(  1 == X.sampleInterval());
+            ASSERT(&da == X.allocator());
+            ASSERT(!X.isActive());
+
+            Obj mY(0, 7, &oa);  const Obj& Y = mY;
+
+            ASSERT(  0 == Y.threshold());
+            ASSERT(  7 == Y.sampleInterval());
+            ASSERT(&oa == Y.allocator());
+            ASSERT(!Y.isActive());
+        }
+
+        if (verbose) cout << "\nTesting `start` and `stop`." << endl;
+        {
+            Obj mX(500, 1, &oa);  const Obj& X = mX;
+            Obj mY(600, 1, &oa);  const Obj& Y = mY;
+
+            ASSERT(0   == mX.start());
+            ASSERT(X.isActive());
+            ASSERT(0   != bslmt::ContentionUtil::waitCallback());
+            ASSERT(500 == bslmt::ContentionUtil::waitThreshold());
+
+            ASSERT(0   == mX.start());
+            ASSERT(0   != mY.start());
+            ASSERT(!Y.isActive());
+            ASSERT(500 == bslmt::ContentionUtil::waitThreshold());
+
+            mY.stop();
+            ASSERT(X.isActive());
+
+            mX.stop();
+            ASSERT(!X.isActive());
+            ASSERT(0   == bslmt::ContentionUtil::waitCallback());
+
+            ASSERT(0   == mY.start());
+            ASSERT(Y.isActive());
+            ASSERT(600 == bslmt::ContentionUtil::waitThreshold());
+
+            mY.stop();
+            mY.stop();
+            ASSERT(!Y.isActive());
+        }
+
+        if (verbose) cout << "\nTesting the destructor." << endl;
+        {
+            {
+                Obj mX(0, 1, &oa);
+                ASSERT(0 == mX.start());
+            }
+
+            ASSERT(0 == bslmt::ContentionUtil::waitCallback());
+
+            Obj mY(0, 1, &oa);
+            ASSERT(0 == mY.start());
+        }
+
+        ASSERT(0 == bslmt::ContentionUtil::waitCallback());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj( 0,  1, &oa));
+            ASSERT_FAIL(Obj(-1,  1, &oa));
+            ASSERT_FAIL(Obj( 0,  0, &oa));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `CallSite`
+        //
+        // Concerns:
+        // 1. The default constructor creates a call site having no addresses
+        //    and no samples, using the supplied allocator.
+        //
+        // 2. The copy constructor copies every member, using the supplied
+        //    allocator.
+        //
+        // Plan:
+        // 1. Create call sites with and without an allocator, and verify
+        //    their members and allocators.  (C-1..2)
+        //
+        // Testing:
+        //   CallSite(bslma::Allocator *basicAllocator = 0);
+        //   CallSite(const CallSite& original, bslma::Allocator *ba = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `CallSite`" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        CallSite mX(&oa);  const CallSite& X = mX;
+
+        ASSERT(X.d_addresses.empty());
+        ASSERT(0   == X.d_numSamples);
+        ASSERT(0   == X.d_totalWaitTime);
+        ASSERT(0   == X.d_maxWaitTime);
+        ASSERT(&oa == X.d_addresses.get_allocator());
+
+        CallSite mD;
+        ASSERT(&da == mD.d_addresses.get_allocator());
+
+        mX.d_addresses.push_back(&mX);
+        mX.d_numSamples    = 2;
+        mX.d_totalWaitTime = 30;
+        mX.d_maxWaitTime   = 20;
+
+        const CallSite Y(X, &sa);
+
+        ASSERT(X.d_addresses == Y.d_addresses);
+        ASSERT(2             == Y.d_numSamples);
+        ASSERT(30            == Y.d_totalWaitTime);
+        ASSERT(20            == Y.d_maxWaitTime);
+        ASSERT(&sa           == Y.d_addresses.get_allocator());
+        ASSERT(1             == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a profiler, start it, report a wait, stop it, and verify
+        //    the recorded call site.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(0, 1, &oa);  const Obj& X = mX;
+
+        ASSERT(0 == mX.start());
+        siteA(42);
+        mX.stop();
+
+        ASSERT(1 == X.numReports());
+        ASSERT(1 == X.numSamples());
+
+        bsl::vector<CallSite> sites(&oa);
+        X.loadCallSites(&sites);
+
+        ASSERT(1  == sites.size());
+        ASSERT(42 == sites[0].d_totalWaitTime);
+
+        if (veryVerbose) {
+            X.print(cout);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
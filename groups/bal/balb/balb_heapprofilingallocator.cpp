@@ -0,0 +1,531 @@
+// balb_heapprofilingallocator.cpp                                    -*-C++-*-
+#include <balb_heapprofilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balb_heapprofilingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstddef.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+
+///Implementation Notes
+///--------------------
+// Each thread runs a single Poisson process whose unit is the expected
+// number of samples: an allocation of `size` bytes from a profiler having the
+// sample interval `N` consumes `size / N` units, and is sampled if a point of
+// the process falls among them.  The gaps between points are exponentially
+// distributed with mean 1, so the thread-local count of the units remaining
+// until the next point is unbiased whichever profilers a thread allocates
+// from, and however their sample intervals differ.
+//
+// Each block supplied by the profiler is preceded by a `u::Header` recording
+// the address of the statistics of the call site of the block if it was
+// sampled, and 0 otherwise.  The statistics are the values of a `bsl::map`,
+// from which no element is ever erased, so that address remains valid for the
+// lifetime of the profiler.
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+/// This `struct` precedes each block supplied by the profiler.
+struct Header {
+    void                    *d_statistics_p;  // statistics of the call site,
+                                              // or 0 if not sampled
+
+    bsls::Types::size_type   d_size;          // size requested, if sampled
+};
+
+/// The number of bytes by which the address returned to the user is offset
+/// from the address of the block supplied by the upstream allocator.
+const bsls::Types::size_type k_OFFSET =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+BSLMF_ASSERT(sizeof(Header) <= k_OFFSET);
+
+/// The number of units of the sampling process of the calling thread
+/// remaining until its next sample.
+BSLMT_THREAD_LOCAL_VARIABLE(double, t_unitsUntilSample, 0.0)
+
+/// The state of the random number generator of the calling thread, or 0 if
+/// the thread has not yet drawn a number.
+BSLMT_THREAD_LOCAL_VARIABLE(Uint64, t_randomState, 0)
+
+/// Return a value derived from the specified `value` by the finalizer of
+/// the "SplitMix64" generator, which is distinct from 0 for every nonzero
+/// `value`.
+Uint64 mix(Uint64 value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+/// Return an exponentially distributed random number having mean 1, drawn
+/// from the generator of the calling thread, seeding the generator if
+/// necessary.
+double nextExponential()
+{
+    Uint64 state = t_randomState;
+    if (0 == state) {
+        state = mix(static_cast<Uint64>(bsls::TimeUtil::getTimer())
+                  ^ reinterpret_cast<bsls::Types::UintPtr>(&t_randomState));
+        state = 0 == state ? 1 : state;
+    }
+
+    // Advance the "xorshift64*" generator, and scale the 53 high bits of its
+    // output to the interval (0, 1].
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    t_randomState = state;
+
+    const Uint64 bits = (state * 0x2545f4914f6cdd1dULL) >> 11;
+    const double uniform = static_cast<double>(bits + 1) / 9007199254740992.0;
+
+    return -bsl::log(uniform);
+}
+
+/// Return `true` if an allocation consuming the specified `units` of the
+/// sampling process of the calling thread is sampled, and `false`
+/// otherwise.  See {Implementation Notes}.
+inline
+bool isSampled(double units)
+{
+    t_unitsUntilSample -= units;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0.0 < t_unitsUntilSample)) {
+        return false;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    if (0 == t_randomState) {
+        // This is the first allocation of the thread, so its process starts
+        // at the start of the allocation.
+
+        t_unitsUntilSample += nextExponential();
+        if (0.0 < t_unitsUntilSample) {
+            return false;                                             // RETURN
+        }
+    }
+
+    t_unitsUntilSample = nextExponential();
+    return true;
+}
+
+/// Return the number of allocations of the specified `size` bytes that a
+/// sample of that size represents, given the specified `sampleRate`, in
+/// samples per byte.
+double weight(bsls::Types::size_type size, double sampleRate)
+{
+    return 1.0 / -bsl::expm1(-static_cast<double>(size) * sampleRate);
+}
+
+/// Return the specified `estimate` rounded to the nearest integer, or 0 if
+/// `estimate` is negative (due to rounding).
+Int64 round(double estimate)
+{
+    return estimate < 0.5 ? 0 : static_cast<Int64>(estimate + 0.5);
+}
+
+/// Return `true` if the specified `lhs` call site has more estimated live
+/// bytes than the specified `rhs` call site, or as many and more estimated
+/// total bytes, and `false` otherwise.
+bool hasMoreBytes(const balb::HeapProfilingAllocator::CallSite& lhs,
+                  const balb::HeapProfilingAllocator::CallSite& rhs)
+{
+    if (lhs.d_liveBytes != rhs.d_liveBytes) {
+        return lhs.d_liveBytes > rhs.d_liveBytes;                     // RETURN
+    }
+    return lhs.d_totalBytes > rhs.d_totalBytes;
+}
+
+/// Write the specified `liveCount`, `liveBytes`, `totalCount`, and
+/// `totalBytes` to the specified `stream` in the format of the statistics
+/// of a legacy heap profile.
+void writeCounts(bsl::ostream& stream,
+                 Int64         liveCount,
+                 Int64         liveBytes,
+                 Int64         totalCount,
+                 Int64         totalBytes)
+{
+    stream << bsl::setw(6) << liveCount  << ": "
+           << bsl::setw(8) << liveBytes  << " ["
+           << bsl::setw(6) << totalCount << ": "
+           << bsl::setw(8) << totalBytes << "] @";
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace balb {
+
+                  // ---------------------------------------
+                  // struct HeapProfilingAllocator::CallSite
+                  // ---------------------------------------
+
+// CREATORS
+HeapProfilingAllocator::CallSite::CallSite(bslma::Allocator *basicAllocator)
+: d_addresses(basicAllocator)
+, d_numLiveSamples(0)
+, d_numTotalSamples(0)
+, d_liveAllocations(0)
+, d_liveBytes(0)
+, d_totalAllocations(0)
+, d_totalBytes(0)
+{
+}
+
+HeapProfilingAllocator::CallSite::CallSite(const CallSite&   original,
+                                           bslma::Allocator *basicAllocator)
+: d_addresses(original.d_addresses, basicAllocator)
+, d_numLiveSamples(original.d_numLiveSamples)
+, d_numTotalSamples(original.d_numTotalSamples)
+, d_liveAllocations(original.d_liveAllocations)
+, d_liveBytes(original.d_liveBytes)
+, d_totalAllocations(original.d_totalAllocations)
+, d_totalBytes(original.d_totalBytes)
+{
+}
+
+                        // ----------------------------
+                        // class HeapProfilingAllocator
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+HeapProfilingAllocator::Statistics *
+HeapProfilingAllocator::recordAllocation(void *const *addresses,
+                                         int          numAddresses,
+                                         size_type    size)
+{
+    const bsl::vector<void *> stack(addresses,
+                                    addresses + numAddresses,
+                                    d_allocator_p);
+
+    const double weight = u::weight(size, d_sampleRate);
+    const double bytes  = weight * static_cast<double>(size);
+
+    ++d_numSamples;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // The element is emplaced, rather than inserted with `operator[]`, so
+    // that no temporary is supplied by the default allocator, which may be
+    // this object.
+
+    SiteMap::iterator it = d_sites.find(stack);
+    if (d_sites.end() == it) {
+        const Statistics empty = { 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0 };
+
+        it = d_sites.emplace(stack, empty).first;
+    }
+
+    Statistics& statistics = it->second;
+
+    ++statistics.d_numLiveSamples;
+    ++statistics.d_numTotalSamples;
+    statistics.d_numLiveSampledBytes  += size;
+    statistics.d_numTotalSampledBytes += size;
+    statistics.d_liveAllocations      += weight;
+    statistics.d_liveBytes            += bytes;
+    statistics.d_totalAllocations     += weight;
+    statistics.d_totalBytes           += bytes;
+
+    return &statistics;
+}
+
+void HeapProfilingAllocator::recordDeallocation(Statistics *statistics,
+                                                size_type   size)
+{
+    const double weight = u::weight(size, d_sampleRate);
+    const double bytes  = weight * static_cast<double>(size);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    --statistics->d_numLiveSamples;
+    statistics->d_numLiveSampledBytes -= size;
+    statistics->d_liveAllocations     -= weight;
+    statistics->d_liveBytes           -= bytes;
+}
+
+// CREATORS
+HeapProfilingAllocator::HeapProfilingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_sampleInterval(k_DEFAULT_SAMPLE_INTERVAL)
+, d_sampleRate(1.0 / static_cast<double>(k_DEFAULT_SAMPLE_INTERVAL))
+, d_numSamples(0)
+, d_sites(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+HeapProfilingAllocator::HeapProfilingAllocator(
+                                        bsls::Types::Int64  sampleInterval,
+                                        bslma::Allocator   *basicAllocator)
+: d_sampleInterval(sampleInterval)
+, d_sampleRate(1.0 / static_cast<double>(sampleInterval))
+, d_numSamples(0)
+, d_sites(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= sampleInterval);
+}
+
+HeapProfilingAllocator::~HeapProfilingAllocator()
+{
+}
+
+// MANIPULATORS
+void *HeapProfilingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    u::Header *header = static_cast<u::Header *>(
+                                  d_allocator_p->allocate(size + u::k_OFFSET));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                u::isSampled(static_cast<double>(size) * d_sampleRate))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The stack is captured here, rather than in `recordAllocation`
+        // (which could be inlined), so that exactly one frame, that of this
+        // function, precedes the frame of the caller.  A failure to walk the
+        // stack is recorded as an empty stack.
+
+        enum {
+            k_IGNORE_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1,
+            k_BUFFER_SIZE   = k_MAX_FRAMES + k_IGNORE_FRAMES
+        };
+
+        void      *buffer[k_BUFFER_SIZE];
+        const int  numFrames = bsl::max<int>(
+                      bsls::StackAddressUtil::getStackAddresses(buffer,
+                                                                k_BUFFER_SIZE),
+                      k_IGNORE_FRAMES);
+
+        // If recording the sample throws, the block is returned to the
+        // upstream allocator.
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(header,
+                                                            d_allocator_p);
+
+        header->d_statistics_p = recordAllocation(buffer + k_IGNORE_FRAMES,
+                                                  numFrames - k_IGNORE_FRAMES,
+                                                  size);
+        header->d_size         = size;
+
+        proctor.release();
+    }
+    else {
+        header->d_statistics_p = 0;
+    }
+
+    return reinterpret_cast<char *>(header) + u::k_OFFSET;
+}
+
+void HeapProfilingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    u::Header *header = reinterpret_cast<u::Header *>(
+                                 static_cast<char *>(address) - u::k_OFFSET);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(header->d_statistics_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        recordDeallocation(static_cast<Statistics *>(header->d_statistics_p),
+                           header->d_size);
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+void HeapProfilingAllocator::loadCallSites(bsl::vector<CallSite> *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        result->reserve(d_sites.size());
+        for (SiteMap::const_iterator it = d_sites.begin();
+             it != d_sites.end();
+             ++it) {
+            const Statistics& statistics = it->second;
+
+            CallSite site(result->get_allocator().mechanism());
+
+            site.d_addresses        = it->first;
+            site.d_numLiveSamples   = statistics.d_numLiveSamples;
+            site.d_numTotalSamples  = statistics.d_numTotalSamples;
+            site.d_liveAllocations  = u::round(statistics.d_liveAllocations);
+            site.d_liveBytes        = u::round(statistics.d_liveBytes);
+            site.d_totalAllocations = u::round(statistics.d_totalAllocations);
+            site.d_totalBytes       = u::round(statistics.d_totalBytes);
+
+            result->push_back(site);
+        }
+    }
+
+    bsl::stable_sort(result->begin(), result->end(), &u::hasMoreBytes);
+}
+
+bsl::ostream& HeapProfilingAllocator::print(bsl::ostream& stream,
+                                            int           maxCallSites) const
+{
+    bsl::vector<CallSite> callSites(d_allocator_p);
+    loadCallSites(&callSites);
+
+    const bsl::size_t numCallSites =
+                     0 <= maxCallSites
+                     ? bsl::min(callSites.size(),
+                                static_cast<bsl::size_t>(maxCallSites))
+                     : callSites.size();
+
+    stream << "Heap profile: "
+           << numSamples() << " samples, sample interval "
+           << d_sampleInterval << " bytes, "
+           << callSites.size() << " call sites\n";
+
+    for (bsl::size_t i = 0; i < numCallSites; ++i) {
+        const CallSite& site = callSites[i];
+
+        stream << "\nCall site " << i + 1 << ": live "
+               << site.d_liveAllocations  << " allocations, "
+               << site.d_liveBytes        << " bytes; total "
+               << site.d_totalAllocations << " allocations, "
+               << site.d_totalBytes       << " bytes ("
+               << site.d_numTotalSamples  << " samples)\n";
+
+        balst::StackTrace stackTrace(d_allocator_p);
+        if (site.d_addresses.empty()
+         || 0 != balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                           &stackTrace,
+                           &site.d_addresses[0],
+                           static_cast<int>(site.d_addresses.size()))) {
+            stream << "(stack unavailable)\n";
+            continue;
+        }
+
+        balst::StackTraceUtil::printFormatted(stream, stackTrace);
+    }
+
+    return stream << bsl::flush;
+}
+
+bsl::ostream& HeapProfilingAllocator::writeProfile(bsl::ostream& stream) const
+{
+    // Copy the samples, so that the mutex is not held while writing.
+
+    SiteMap sites(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        sites = d_sites;
+    }
+
+    Statistics totals = { 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0 };
+    for (SiteMap::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        totals.d_numLiveSamples       += it->second.d_numLiveSamples;
+        totals.d_numLiveSampledBytes  += it->second.d_numLiveSampledBytes;
+        totals.d_numTotalSamples      += it->second.d_numTotalSamples;
+        totals.d_numTotalSampledBytes += it->second.d_numTotalSampledBytes;
+    }
+
+    const bsl::ios_base::fmtflags flags = stream.flags();
+    stream.flags(bsl::ios_base::dec | bsl::ios_base::right);
+
+    stream << "heap profile: ";
+    u::writeCounts(stream,
+                   totals.d_numLiveSamples,
+                   totals.d_numLiveSampledBytes,
+                   totals.d_numTotalSamples,
+                   totals.d_numTotalSampledBytes);
+    stream << " heap_v2/" << d_sampleInterval << '\n';
+
+    for (SiteMap::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        u::writeCounts(stream,
+                       it->second.d_numLiveSamples,
+                       it->second.d_numLiveSampledBytes,
+                       it->second.d_numTotalSamples,
+                       it->second.d_numTotalSampledBytes);
+
+        stream << bsl::hex;
+        for (bsl::size_t i = 0; i < it->first.size(); ++i) {
+            stream << " 0x"
+                   << reinterpret_cast<bsls::Types::UintPtr>(it->first[i]);
+        }
+        stream << bsl::dec << '\n';
+    }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n";
+
+        bsl::string line(d_allocator_p);
+        while (bsl::getline(maps, line)) {
+            stream << line << '\n';
+        }
+    }
+#endif
+
+    stream.flags(flags);
+    return stream << bsl::flush;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,419 @@
+// balb_heapprofilingallocator.h                                      -*-C++-*-
+#ifndef INCLUDED_BALB_HEAPPROFILINGALLOCATOR
+#define INCLUDED_BALB_HEAPPROFILINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator adaptor that samples heap allocation stacks.
+//
+//@CLASSES:
+//  balb::HeapProfilingAllocator: sampling heap profiler allocator adaptor
+//
+//@SEE_ALSO: balb_contentionprofiler, bdlma_countingallocator,
+//           balst_stacktraceutil
+//
+//@DESCRIPTION: This component provides an allocator adaptor,
+// `balb::HeapProfilingAllocator`, that implements the `bslma::Allocator`
+// protocol by forwarding every request to an *upstream* allocator, and that
+// records the call sites of a random sample of the allocations it supplies.
+// Unlike `bslma::TestAllocator`, which tracks every block, the profiler is
+// cheap enough to leave enabled in production.
+//
+///Sampling
+///--------
+// The profiler samples, on average, one allocation per `sampleInterval()`
+// bytes allocated.  Sampling is a Poisson process over the bytes allocated by
+// each thread: an allocation of `size` bytes is sampled with probability
+// `1 - exp(-size / sampleInterval())`, so large allocations are (almost)
+// always sampled, and small ones rarely.  Each thread counts down the bytes
+// remaining until its next sample, so an allocation that is not sampled costs
+// little more than a thread-local subtraction and a comparison, and does not
+// touch memory shared with other threads.
+//
+// For each sample, the profiler captures the return addresses on the stack of
+// the allocating thread (using `bsls::StackAddressUtil`), and aggregates the
+// samples by stack: a `balb::HeapProfilingAllocator::CallSite` holds the stack
+// addresses, the numbers of sampled allocations that are *live* (not yet
+// deallocated) and *total* (since the creation of the profiler), and the
+// numbers of allocations and bytes estimated from them.  A sample of `size`
+// bytes stands for `1 / (1 - exp(-size / sampleInterval()))` allocations of
+// that size, which makes the estimates unbiased.  Stacks are resolved to
+// symbols (using `balst::StackTraceUtil`) only when the profile is printed.
+// The innermost frame of each stack is that of the caller of `allocate`.
+//
+///Profile Formats
+///---------------
+// `print` writes the call sites, with estimated statistics and symbolized
+// stacks, in a format intended to be read by people.  `writeProfile` writes
+// the samples in the legacy text heap profile format of gperftools
+// ("heap_v2"), which `pprof` reads directly:
+// ```
+// $ pprof --text <binary> <profile>
+// ```
+// In that format the statistics are those of the samples, and `pprof` derives
+// the estimates itself from the sampling interval named in the header.  On
+// Linux the profile ends with the mappings of the process, so that `pprof` can
+// symbolize addresses in shared libraries.  A profile can be written on demand
+// from a running service, for example by a handler registered with a
+// `balb::ControlManager` (see {Example 2}).
+//
+///Memory Overhead
+///---------------
+// To recognize a sampled block when it is deallocated, the profiler prepends a
+// maximally-aligned header to every block it supplies, recording whether the
+// block was sampled.  Each allocation therefore requests
+// `bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT` (typically 16) more bytes from the
+// upstream allocator.  (This is the layout used by `bdlma::CountingAllocator`;
+// for small blocks, the larger requests, rather than sampling, account for
+// most of the cost of the profiler.)  The records of the samples are also
+// supplied by the upstream allocator, so the profiler never profiles itself.
+//
+///Thread Safety
+///-------------
+// `balb::HeapProfilingAllocator` is fully thread-safe, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads, provided that the upstream allocator is thread-safe.
+// The mutex of the profiler is acquired only to record a sample, to deallocate
+// a sampled block, and to read the profile.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Source of Heap Growth
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the heap of a service grows, and that we want to find which
+// call sites hold the memory.
+//
+// First, we create a profiler that samples one allocation per 1024 bytes,
+// forwarding to the default allocator, and supply it to the containers of the
+// service:
+// ```
+// balb::HeapProfilingAllocator profiler(1024);
+//
+// bsl::vector<bsl::string> cache(&profiler);
+// ```
+// Then, we run the service; here, we fill the cache with one megabyte of
+// strings:
+// ```
+// for (int i = 0; i < 1024; ++i) {
+//     cache.push_back(bsl::string(1000, 'x'));
+// }
+// ```
+// Next, we load the call sites, and find that the live allocations made by
+// the call sites are estimated at roughly one megabyte:
+// ```
+// bsl::vector<balb::HeapProfilingAllocator::CallSite> callSites;
+// profiler.loadCallSites(&callSites);
+//
+// bsls::Types::Int64 liveBytes = 0;
+// for (bsl::size_t i = 0; i < callSites.size(); ++i) {
+//     liveBytes += callSites[i].d_liveBytes;
+// }
+// assert(900 * 1024 < liveBytes && liveBytes < 1200 * 1024);
+// ```
+// Finally, we print the profile, in which the call sites are ordered by their
+// estimated live bytes:
+// ```
+// profiler.print(bsl::cout, 3);
+// ```
+//
+///Example 2: Writing a Profile on Demand
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a service is controlled through a `balb::ControlManager`, and
+// that we want to write a heap profile when an operator asks for one.
+//
+// First, we define a control handler that writes the profile of a profiler to
+// the file named by the argument of the message:
+// ```
+// void onHeapProfile(balb::HeapProfilingAllocator *profiler,
+//                    const bsl::string&            ,
+//                    bsl::istream&                 message)
+// {
+//     bsl::string path;
+//     message >> path;
+//
+//     bsl::ofstream file(path.c_str());
+//     profiler->writeProfile(file);
+// }
+// ```
+// Then, we register the handler with the control manager of the service:
+// ```
+// balb::ControlManager manager;
+//
+// manager.registerHandler("HEAPPROFILE",
+//                         "<path>",
+//                         "Write a heap profile to the specified file",
+//                         bdlf::BindUtil::bind(&onHeapProfile,
+//                                              &profiler,
+//                                              bdlf::PlaceHolders::_1,
+//                                              bdlf::PlaceHolders::_2));
+// ```
+// Finally, an operator sends the message "HEAPPROFILE /tmp/service.heap" to
+// the service (for example through a `balb::PipeControlChannel`), and reads
+// the file with `pprof`:
+// ```
+// manager.dispatchMessage("HEAPPROFILE /tmp/service.heap");
+// ```
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balb {
+
+                        // ============================
+                        // class HeapProfilingAllocator
+                        // ============================
+
+/// This allocator adaptor forwards requests to an upstream allocator, and
+/// records the stacks of a sample of the allocations it supplies.  See
+/// {Description}.
+class HeapProfilingAllocator : public bslma::Allocator {
+
+  public:
+    // TYPES
+
+    /// This `struct` describes the sampled allocations having a common
+    /// stack.
+    struct CallSite {
+
+        // PUBLIC DATA
+        bsl::vector<void *> d_addresses;         // return addresses, from the
+                                                 // innermost frame outward
+
+        bsls::Types::Int64  d_numLiveSamples;    // sampled allocations not
+                                                 // yet deallocated
+
+        bsls::Types::Int64  d_numTotalSamples;   // sampled allocations
+
+        bsls::Types::Int64  d_liveAllocations;   // estimated allocations not
+                                                 // yet deallocated
+
+        bsls::Types::Int64  d_liveBytes;         // estimated bytes not yet
+                                                 // deallocated
+
+        bsls::Types::Int64  d_totalAllocations;  // estimated allocations
+
+        bsls::Types::Int64  d_totalBytes;        // estimated bytes allocated
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(CallSite, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+
+        /// Create a call site having no addresses and no samples.
+        /// Optionally specify a `basicAllocator` used to supply memory.  If
+        /// `basicAllocator` is 0, the currently installed default allocator
+        /// is used.
+        explicit CallSite(bslma::Allocator *basicAllocator = 0);
+
+        /// Create a call site having the value of the specified `original`
+        /// call site.  Optionally specify a `basicAllocator` used to supply
+        /// memory.  If `basicAllocator` is 0, the currently installed
+        /// default allocator is used.
+        CallSite(const CallSite&   original,
+                 bslma::Allocator *basicAllocator = 0);
+    };
+
+    enum {
+        k_DEFAULT_SAMPLE_INTERVAL = 512 * 1024,  // default mean number of
+                                                 // bytes per sample
+
+        k_MAX_FRAMES              = 32           // maximum number of frames
+                                                 // captured per sample
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// This `struct` holds the statistics of the samples having a stack.
+    /// The estimates are accumulated in floating point, so that removing
+    /// the weight of a deallocated sample restores the previous value.
+    struct Statistics {
+        bsls::Types::Int64 d_numLiveSamples;
+        bsls::Types::Int64 d_numLiveSampledBytes;
+        bsls::Types::Int64 d_numTotalSamples;
+        bsls::Types::Int64 d_numTotalSampledBytes;
+        double             d_liveAllocations;
+        double             d_liveBytes;
+        double             d_totalAllocations;
+        double             d_totalBytes;
+    };
+
+    typedef bsl::map<bsl::vector<void *>, Statistics> SiteMap;
+
+    // DATA
+    const bsls::Types::Int64  d_sampleInterval;  // mean number of bytes per
+                                                 // sample
+
+    const double              d_sampleRate;      // samples per byte, the
+                                                 // reciprocal of
+                                                 // `d_sampleInterval`
+
+    bsls::AtomicInt64         d_numSamples;      // allocations sampled
+
+    mutable bslmt::Mutex      d_mutex;           // protects `d_sites`
+
+    SiteMap                   d_sites;           // statistics by stack
+
+    bslma::Allocator         *d_allocator_p;     // upstream allocator (held,
+                                                 // not owned)
+
+    // PRIVATE MANIPULATORS
+
+    /// Record the allocation of the specified `size` bytes under the stack
+    /// having the specified `numAddresses` return `addresses`, and return
+    /// the address of the statistics of that stack.
+    Statistics *recordAllocation(void *const *addresses,
+                                 int          numAddresses,
+                                 size_type    size);
+
+    /// Remove the sampled allocation of the specified `size` bytes from the
+    /// live statistics of the specified `statistics`.
+    void recordDeallocation(Statistics *statistics, size_type size);
+
+  private:
+    // NOT IMPLEMENTED
+    HeapProfilingAllocator(const HeapProfilingAllocator&) BSLS_KEYWORD_DELETED;
+    HeapProfilingAllocator& operator=(const HeapProfilingAllocator&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a heap profiling allocator that samples, on average, one
+    /// allocation per `k_DEFAULT_SAMPLE_INTERVAL` bytes allocated.
+    /// Optionally specify a `basicAllocator` used to supply the memory of
+    /// the allocations and of the profile.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.
+    explicit HeapProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+
+    /// Create a heap profiling allocator that samples, on average, one
+    /// allocation per the specified `sampleInterval` bytes allocated.
+    /// Optionally specify a `basicAllocator` used to supply the memory of
+    /// the allocations and of the profile.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.  The behavior is
+    /// undefined unless `1 <= sampleInterval`.
+    explicit HeapProfilingAllocator(bsls::Types::Int64  sampleInterval,
+                                    bslma::Allocator   *basicAllocator = 0);
+
+    /// Destroy this allocator.  The behavior is undefined unless all memory
+    /// allocated from this allocator has been deallocated.
+    ~HeapProfilingAllocator() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Return a newly allocated block of memory of (at least) the specified
+    /// positive `size` (in bytes), supplied by the upstream allocator, and
+    /// sample the allocation as described in {Sampling}.  If `size` is 0, a
+    /// null pointer is returned with no other effect.  The returned block is
+    /// maximally aligned.
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the memory block at the specified `address` back to the
+    /// upstream allocator, removing it from the live statistics of its call
+    /// site if it was sampled.  If `address` is 0, this function has no
+    /// effect.  The behavior is undefined unless `address` was allocated
+    /// using this allocator object and has not already been deallocated.
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Load into the specified `result` the call sites sampled by this
+    /// allocator, in decreasing order of estimated live bytes, and then of
+    /// estimated total bytes.
+    void loadCallSites(bsl::vector<CallSite> *result) const;
+
+    /// Return the number of allocations sampled by this allocator since its
+    /// creation.
+    bsls::Types::Int64 numSamples() const;
+
+    /// Write the call sites sampled by this allocator, in decreasing order
+    /// of estimated live bytes, to the specified `stream`, with their
+    /// statistics and symbolized stacks, and return a reference to `stream`.
+    /// Optionally specify `maxCallSites`, the maximum number of call sites
+    /// to write; if `maxCallSites` is negative or not specified, all call
+    /// sites are written.  Note that the format is not fully specified, and
+    /// can change without notice.
+    bsl::ostream& print(bsl::ostream& stream, int maxCallSites = -1) const;
+
+    /// Return the mean number of bytes allocated per sample.
+    bsls::Types::Int64 sampleInterval() const;
+
+    /// Write the samples of this allocator to the specified `stream` in the
+    /// legacy text heap profile format of gperftools, read by `pprof` (see
+    /// {Profile Formats}), and return a reference to `stream`.
+    bsl::ostream& writeProfile(bsl::ostream& stream) const;
+
+                                  // Aspects
+
+    /// Return the upstream allocator of this object, which also supplies
+    /// the memory of its profile.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class HeapProfilingAllocator
+                        // ----------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HeapProfilingAllocator::numSamples() const
+{
+    return d_numSamples.load();
+}
+
+inline
+bsls::Types::Int64 HeapProfilingAllocator::sampleInterval() const
+{
+    return d_sampleInterval;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *HeapProfilingAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1297 @@
+// balb_heapprofilingallocator.t.cpp                                  -*-C++-*-
+#include <balb_heapprofilingallocator.h>
+
+#include <balb_controlmanager.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlma_countingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an allocator adaptor that samples the stacks of
+// the allocations it forwards.  A sample interval of 1 byte samples every
+// allocation of more than a few dozen bytes (with a probability that differs
+// from 1 by less than `exp(-64)`), which lets us verify the bookkeeping
+// deterministically; the unbiasedness of the estimates under random sampling
+// is verified statistically, with tolerances of several standard deviations.
+// Distinct call sites are obtained by allocating through functions called via
+// `volatile` pointers.
+// ----------------------------------------------------------------------------
+// CallSite
+// [ 2] CallSite(bslma::Allocator *basicAllocator = 0);
+// [ 2] CallSite(const CallSite& original, bslma::Allocator *ba = 0);
+//
+// CREATORS
+// [ 3] HeapProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 3] HeapProfilingAllocator(Int64 sampleInterval, *ba = 0);
+// [ 3] ~HeapProfilingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 4] void loadCallSites(bsl::vector<CallSite> *result) const;
+// [ 4] bsls::Types::Int64 numSamples() const;
+// [ 7] bsl::ostream& print(bsl::ostream& stream, int maxCallSites) const;
+// [ 3] bsls::Types::Int64 sampleInterval() const;
+// [ 6] bsl::ostream& writeProfile(bsl::ostream& stream) const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] SAMPLING IS UNBIASED
+// [ 8] CONCURRENCY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD AT THE DEFAULT SAMPLE INTERVAL
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balb::HeapProfilingAllocator Obj;
+typedef Obj::CallSite                CallSite;
+typedef bsls::Types::Int64           Int64;
+
+const bsls::Types::size_type OFFSET = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+bsls::AtomicInt numAllocationsFromSiteA(0);
+bsls::AtomicInt numAllocationsFromSiteB(0);
+
+/// Return a block of the specified `size` bytes allocated from the specified
+/// `allocator` at a first call site.
+void *allocateFromSiteA(bslma::Allocator *allocator, int size)
+{
+    void *block = allocator->allocate(size);
+
+    // Prevent the allocation from being a tail call, which would remove this
+    // frame from the stack.
+
+    ++numAllocationsFromSiteA;
+    return block;
+}
+
+/// Return a block of the specified `size` bytes allocated from the specified
+/// `allocator` at a second call site.
+void *allocateFromSiteB(bslma::Allocator *allocator, int size)
+{
+    void *block = allocator->allocate(size);
+
+    ++numAllocationsFromSiteB;
+    return block;
+}
+
+typedef void *(*AllocateFunction)(bslma::Allocator *, int);
+
+// The allocating functions are called through `volatile` pointers, so that
+// they are not inlined, and calls to both from a single line of a test have
+// distinct stacks.
+
+AllocateFunction volatile siteA = &allocateFromSiteA;
+AllocateFunction volatile siteB = &allocateFromSiteB;
+
+/// Return the sums of the estimated total allocations and bytes of the call
+/// sites of the specified `profiler`, loaded into the specified
+/// `allocations` and `bytes`.
+void loadTotals(Int64 *allocations, Int64 *bytes, const Obj& profiler)
+{
+    bsl::vector<CallSite> sites;
+    profiler.loadCallSites(&sites);
+
+    *allocations = 0;
+    *bytes       = 0;
+    for (bsl::size_t i = 0; i < sites.size(); ++i) {
+        *allocations += sites[i].d_totalAllocations;
+        *bytes       += sites[i].d_totalBytes;
+    }
+}
+
+/// Return `true` if the specified `estimate` is within the specified
+/// `tolerance` (a fraction) of the specified `expected` value, and `false`
+/// otherwise.
+bool isNear(Int64 estimate, Int64 expected, double tolerance)
+{
+    const double error = static_cast<double>(estimate - expected);
+    return (error < 0 ? -error : error)
+                                  <= tolerance * static_cast<double>(expected);
+}
+
+/// Allocate and deallocate, through the `balb::HeapProfilingAllocator` at
+/// the specified `profiler` address, blocks of varying sizes, writing to
+/// each.
+extern "C" void *heapProfilingAllocatorThread(void *profiler)
+{
+    Obj *mX = static_cast<Obj *>(profiler);
+
+    bsl::vector<void *> blocks(&bslma::NewDeleteAllocator::singleton());
+    blocks.reserve(1000);
+
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            const int size = 1 + (i * 37 + round) % 500;
+
+            void *p = 0 == i % 2 ? siteA(mX, size) : siteB(mX, size);
+            bsl::memset(p, round, size);
+            blocks.push_back(p);
+        }
+        while (!blocks.empty()) {
+            mX->deallocate(blocks.back());
+            blocks.pop_back();
+        }
+    }
+    return 0;
+}
+
+/// Allocate and deallocate, through the specified `allocator`, the
+/// specified `numOperations` blocks of sizes between 16 and 527 bytes,
+/// writing to each, and keeping 1024 blocks live in a ring.  Return the
+/// average time, in nanoseconds, per allocation-deallocation pair.
+double churn(bslma::Allocator *allocator, int numOperations)
+{
+    enum { k_RING_SIZE = 1024 };
+
+    void     *ring[k_RING_SIZE] = { 0 };
+    unsigned  state             = 12345;
+
+    bsls::Stopwatch sw;
+    sw.start();
+
+    for (int i = 0; i < numOperations; ++i) {
+        state = state * 1103515245u + 12345u;
+
+        const int  size = 16 + static_cast<int>((state >> 16) % 512);
+        void     *&slot = ring[i % k_RING_SIZE];
+
+        allocator->deallocate(slot);
+        slot = allocator->allocate(size);
+        bsl::memset(slot, i, size);
+    }
+
+    sw.stop();
+
+    for (int i = 0; i < k_RING_SIZE; ++i) {
+        allocator->deallocate(ring[i]);
+    }
+    return sw.elapsedTime() * 1e9 / numOperations;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+/// Write the profile of the specified `profiler` to the file named by the
+/// first word of the specified `message`.
+void onHeapProfile(balb::HeapProfilingAllocator *profiler,
+                   const bsl::string&            ,
+                   bsl::istream&                 message)
+{
+    bsl::string path;
+    message >> path;
+
+    bsl::ofstream file(path.c_str());
+    profiler->writeProfile(file);
+}
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    Write the profile of Example 2 to a file in the current
+        //    directory, and remove it.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Source of Heap Growth
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the heap of a service grows, and that we want to find which
+// call sites hold the memory.
+//
+// First, we create a profiler that samples one allocation per 1024 bytes,
+// forwarding to the default allocator, and supply it to the containers of the
+// service:
+// ```
+    balb::HeapProfilingAllocator profiler(1024);
+
+    bsl::vector<bsl::string> cache(&profiler);
+// ```
+// Then, we run the service; here, we fill the cache with one megabyte of
+// strings:
+// ```
+    for (int i = 0; i < 1024; ++i) {
+        cache.push_back(bsl::string(1000, 'x'));
+    }
+// ```
+// Next, we load the call sites, and find that the live allocations made by
+// the call sites are estimated at roughly one megabyte:
+// ```
+    bsl::vector<balb::HeapProfilingAllocator::CallSite> callSites;
+    profiler.loadCallSites(&callSites);
+
+    bsls::Types::Int64 liveBytes = 0;
+    for (bsl::size_t i = 0; i < callSites.size(); ++i) {
+        liveBytes += callSites[i].d_liveBytes;
+    }
+    ASSERTV(liveBytes, 900 * 1024 < liveBytes && liveBytes < 1200 * 1024);
+// ```
+// Finally, we print the profile, in which the call sites are ordered by their
+// estimated live bytes:
+// ```
+    if (veryVerbose) {
+        profiler.print(bsl::cout, 3);
+    }
+// ```
+//
+///Example 2: Writing a Profile on Demand
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a service is controlled through a `balb::ControlManager`, and
+// that we want to write a heap profile when an operator asks for one.
+//
+// First, we define a control handler that writes the profile of a profiler to
+// the file named by the argument of the message (see `onHeapProfile` above).
+//
+// Then, we register the handler with the control manager of the service:
+// ```
+    balb::ControlManager manager;
+
+    manager.registerHandler("HEAPPROFILE",
+                            "<path>",
+                            "Write a heap profile to the specified file",
+                            bdlf::BindUtil::bind(&onHeapProfile,
+                                                 &profiler,
+                                                 bdlf::PlaceHolders::_1,
+                                                 bdlf::PlaceHolders::_2));
+// ```
+// Finally, an operator sends the message "HEAPPROFILE /tmp/service.heap" to
+// the service (for example through a `balb::PipeControlChannel`), and reads
+// the file with `pprof`:
+// ```
+    const char *PATH = "balb_heapprofilingallocator.t.heap";
+
+    manager.dispatchMessage(bsl::string("HEAPPROFILE ") + PATH);
+// ```
+
+    bsl::ifstream file(PATH);
+    bsl::string   header;
+    bsl::getline(file, header);
+    file.close();
+
+    if (veryVerbose) { P(header) }
+
+    ASSERTV(header, 0 == header.find("heap profile: "));
+    ASSERTV(header, bsl::string::npos != header.find("@ heap_v2/1024"));
+
+    bsl::remove(PATH);
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        // 1. Allocations and deallocations from many threads at once are
+        //    forwarded and sampled correctly.
+        //
+        // 2. The sampled statistics are consistent after the threads finish:
+        //    no sample remains live, and the samples of the call sites add up
+        //    to `numSamples()`.
+        //
+        // Plan:
+        // 1. Run four threads that allocate and deallocate blocks of varying
+        //    sizes from two call sites through a profiler having a sample
+        //    interval of 256 bytes, and verify the upstream allocator and the
+        //    call sites afterward.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(256, &oa);  const Obj& X = mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                             &handles[i],
+                                             &u::heapProfilingAllocatorThread,
+                                             &mX));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        bsl::vector<CallSite> sites(&da);
+        X.loadCallSites(&sites);
+
+        Int64 numSamples = 0;
+        for (bsl::size_t i = 0; i < sites.size(); ++i) {
+            ASSERTV(i, sites[i].d_numLiveSamples,
+                    0 == sites[i].d_numLiveSamples);
+            ASSERTV(i, sites[i].d_liveBytes, 0 == sites[i].d_liveBytes);
+
+            numSamples += sites[i].d_numTotalSamples;
+        }
+
+        if (veryVerbose) { P_(sites.size()) P(X.numSamples()) }
+
+        ASSERTV(sites.size(), 2 <= sites.size());
+        ASSERTV(numSamples, X.numSamples(), numSamples == X.numSamples());
+        ASSERTV(X.numSamples(), 1000 < X.numSamples());
+
+        // Only the profile remains allocated.
+
+        ASSERTV(oa.numBlocksInUse(),
+                static_cast<Int64>(2 * sites.size()) == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `print`
+        //
+        // Concerns:
+        // 1. `print` writes a summary line, followed by one section per call
+        //    site, in decreasing order of estimated live bytes.
+        //
+        // 2. `maxCallSites` limits the number of sections written.
+        //
+        // Plan:
+        // 1. Sample allocations from two call sites and verify the output of
+        //    `print` with and without a limit.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream, int maxCallSites) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `print`" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(1, &oa);  const Obj& X = mX;
+
+        void *a = u::siteA(&mX, 100);
+        void *b = u::siteB(&mX, 1000);
+
+        bslma::TestAllocator        sa("stream", veryVerbose);
+        bsl::ostringstream          all(&sa);
+        bsl::ostringstream          one(&sa);
+
+        X.print(all);
+        X.print(one, 1);
+
+        const bsl::string ALL(all.str(), &sa);
+        const bsl::string ONE(one.str(), &sa);
+
+        if (veryVerbose) { P(ALL) }
+
+        ASSERT(0 == ALL.find("Heap profile: 2 samples, sample interval 1"
+                             " bytes, 2 call sites"));
+        ASSERT(bsl::string::npos != ALL.find(
+                              "Call site 1: live 1 allocations, 1000 bytes;"
+                              " total 1 allocations, 1000 bytes (1 samples)"));
+        ASSERT(bsl::string::npos != ALL.find(
+                               "Call site 2: live 1 allocations, 100 bytes;"
+                               " total 1 allocations, 100 bytes (1 samples)"));
+        ASSERT(ALL.find("Call site 1") < ALL.find("Call site 2"));
+
+        ASSERT(bsl::string::npos != ONE.find("Call site 1"));
+        ASSERT(bsl::string::npos == ONE.find("Call site 2"));
+
+        mX.deallocate(a);
+        mX.deallocate(b);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING `writeProfile`
+        //
+        // Concerns:
+        // 1. The profile begins with the header line of a legacy heap profile,
+        //    holding the sums of the live and total sample counts and sampled
+        //    bytes, and naming "heap_v2" and the sample interval.
+        //
+        // 2. Each call site is written on one line, with its sample counts
+        //    and sampled bytes, followed by its stack as hexadecimal
+        //    addresses.
+        //
+        // 3. On Linux, the profile ends with the mappings of the process.
+        //
+        // 4. The format flags of the stream are restored.
+        //
+        // Plan:
+        // 1. Sample allocations from two call sites, deallocating some, write
+        //    the profile to a stream set to hexadecimal output, and verify
+        //    its lines and the flags of the stream.  (C-1..4)
+        //
+        // Testing:
+        //   bsl::ostream& writeProfile(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `writeProfile`" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(1, &oa);  const Obj& X = mX;
+
+        void *a[2];
+        for (int i = 0; X.numSamples() < 2; ++i) {
+            a[i] = u::siteA(&mX, 100);
+        }
+        void *b = u::siteB(&mX, 200);
+
+        mX.deallocate(a[1]);
+        mX.deallocate(b);
+
+        bslma::TestAllocator sa("stream", veryVerbose);
+        bsl::ostringstream   stream(&sa);
+
+        stream << bsl::hex;
+        const bsl::ios_base::fmtflags FLAGS = stream.flags();
+
+        X.writeProfile(stream);
+
+        ASSERT(FLAGS == stream.flags());
+
+        bsl::istringstream  in(stream.str(), &sa);
+        bsl::string         line(&sa);
+        bsl::vector<bsl::string> lines(&sa);
+        while (bsl::getline(in, line)) {
+            lines.push_back(line);
+        }
+
+        if (veryVerbose) { P(stream.str()) }
+
+        ASSERTV(lines.size(), 3 <= lines.size());
+
+        ASSERTV(lines[0],
+                "heap profile:      1:      100 [     3:      400]"
+                " @ heap_v2/1" == lines[0]);
+
+        const bsl::string SITE_A = "     1:      100 [     2:      200] @ 0x";
+        const bsl::string SITE_B = "     0:        0 [     1:      200] @ 0x";
+
+        ASSERTV(lines[1], lines[2],
+                (0 == lines[1].find(SITE_A) && 0 == lines[2].find(SITE_B))
+             || (0 == lines[1].find(SITE_B) && 0 == lines[2].find(SITE_A)));
+
+        for (int i = 1; i <= 2; ++i) {
+            const bsl::string STACK = lines[i].substr(lines[i].find('@') + 1);
+            ASSERTV(STACK, bsl::string::npos == STACK.find_first_not_of(
+                                                       " 0123456789abcdefx"));
+        }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        ASSERTV(lines.size(), 5 <= lines.size());
+        ASSERTV(lines[3], lines[3].empty());
+        ASSERTV(lines[4], "MAPPED_LIBRARIES:" == lines[4]);
+#endif
+
+        mX.deallocate(a[0]);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SAMPLING IS UNBIASED
+        //
+        // Concerns:
+        // 1. About one allocation per `sampleInterval()` bytes is sampled.
+        //
+        // 2. The estimated allocations and bytes are unbiased, for small and
+        //    large allocations alike.
+        //
+        // 3. The estimates remain unbiased when a thread allocates from
+        //    profilers having different sample intervals.
+        //
+        // Plan:
+        // 1. Allocate many blocks of a single size from a profiler, and verify
+        //    that the number of samples and the estimated total allocations
+        //    and bytes are within several standard deviations of the exact
+        //    values, for several sizes.  (C-1..2)
+        //
+        // 2. Alternate allocations between two profilers having sample
+        //    intervals that differ by a factor of 64, and verify the
+        //    estimates of both.  (C-3)
+        //
+        // Testing:
+        //   SAMPLING IS UNBIASED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING IS UNBIASED" << endl
+                          << "====================" << endl;
+
+        bslma::NewDeleteAllocator& nda =
+                                      bslma::NewDeleteAllocator::singleton();
+
+        if (verbose) cout << "\nA single profiler." << endl;
+        {
+            // The expected number of samples is at least 2500 in each row,
+            // so the tolerances are more than 5 standard deviations.
+
+            static const struct {
+                int d_line;      // source line number
+                int d_interval;  // sample interval
+                int d_size;      // allocation size
+                int d_count;     // number of allocations
+            } DATA[] = {
+                //LINE  INTERVAL   SIZE   COUNT
+                //----  --------  -----  ------
+                { L_,       1024,     8, 400000 },
+                { L_,       1024,    64,  50000 },
+                { L_,       1024,  1000,   5000 },
+                { L_,       1024,  4000,   5000 },
+                { L_,      65536, 10000,  20000 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int INTERVAL = DATA[ti].d_interval;
+                const int SIZE     = DATA[ti].d_size;
+                const int COUNT    = DATA[ti].d_count;
+
+                Obj mX(INTERVAL, &nda);  const Obj& X = mX;
+
+                for (int i = 0; i < COUNT; ++i) {
+                    mX.deallocate(mX.allocate(SIZE));
+                }
+
+                Int64 allocations, bytes;
+                u::loadTotals(&allocations, &bytes, X);
+
+                const double P_SAMPLE = 1.0 - bsl::exp(-double(SIZE)
+                                                             / INTERVAL);
+                const Int64  EXPECTED = static_cast<Int64>(COUNT * P_SAMPLE);
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(X.numSamples()) P_(EXPECTED)
+                    P_(allocations) P(bytes)
+                }
+
+                ASSERTV(LINE, X.numSamples(), EXPECTED,
+                        u::isNear(X.numSamples(), EXPECTED, 0.1));
+                ASSERTV(LINE, allocations, COUNT,
+                        u::isNear(allocations, COUNT, 0.1));
+                ASSERTV(LINE, bytes, Int64(COUNT) * SIZE,
+                        u::isNear(bytes, Int64(COUNT) * SIZE, 0.1));
+            }
+        }
+
+        if (verbose) cout << "\nTwo profilers in one thread." << endl;
+        {
+            Obj mA(  1024, &nda);  const Obj& A = mA;
+            Obj mB(65536, &nda);   const Obj& B = mB;
+
+            const int COUNT = 200000;
+
+            for (int i = 0; i < COUNT; ++i) {
+                mA.deallocate(mA.allocate(16));
+                mB.deallocate(mB.allocate(512));
+            }
+
+            Int64 allocationsA, bytesA, allocationsB, bytesB;
+            u::loadTotals(&allocationsA, &bytesA, A);
+            u::loadTotals(&allocationsB, &bytesB, B);
+
+            if (veryVerbose) {
+                P_(A.numSamples()) P_(allocationsA) P(bytesA)
+                P_(B.numSamples()) P_(allocationsB) P(bytesB)
+            }
+
+            // About 3100 and 1560 samples are expected.
+
+            ASSERTV(bytesA, u::isNear(bytesA, Int64(COUNT) * 16,  0.15));
+            ASSERTV(bytesB, u::isNear(bytesB, Int64(COUNT) * 512, 0.15));
+            ASSERTV(allocationsA, u::isNear(allocationsA, COUNT, 0.15));
+            ASSERTV(allocationsB, u::isNear(allocationsB, COUNT, 0.15));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING RECORDING
+        //
+        // Concerns:
+        // 1. Sampled allocations are aggregated by stack, so distinct call
+        //    sites are recorded separately.
+        //
+        // 2. A sampled allocation is counted as live until it is deallocated,
+        //    and as total thereafter.
+        //
+        // 3. A sample of `size` bytes is weighted by
+        //    `1 / (1 - exp(-size / sampleInterval()))`.
+        //
+        // 4. `loadCallSites` orders call sites by decreasing estimated live
+        //    bytes, then total bytes, and uses the allocator of the supplied
+        //    vector.
+        //
+        // 5. Allocations are not sampled when the sample interval greatly
+        //    exceeds the bytes allocated.
+        //
+        // 6. The profile is supplied by the upstream allocator.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using a sample interval of 1 byte, allocate from two call sites,
+        //    deallocate some of the blocks, and verify the call sites.
+        //    (C-1..2, 4, 6)
+        //
+        // 2. Using a sample interval of 100 bytes, sample one allocation of
+        //    100 bytes, and verify its estimates.  (C-3)
+        //
+        // 3. Using a sample interval of 2^40 bytes, allocate a megabyte and
+        //    verify that nothing is sampled.  (C-5)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void loadCallSites(bsl::vector<CallSite> *result) const;
+        //   bsls::Types::Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RECORDING" << endl
+                          << "=================" << endl;
+
+        if (verbose) cout << "\nAggregating by call site." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+            bslma::TestAllocator va("vector", veryVerbose);
+
+            Obj mX(1, &oa);  const Obj& X = mX;
+
+            // The blocks of site A are allocated from a single call, so that
+            // they have the same stack (the condition prevents the loop from
+            // being unrolled).
+
+            void *a[3];
+            for (int i = 0; X.numSamples() < 3; ++i) {
+                a[i] = u::siteA(&mX, 100);
+            }
+            void *b = u::siteB(&mX, 250);
+
+            ASSERTV(X.numSamples(), 4 == X.numSamples());
+
+            // Sampling does not use the default allocator.
+
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+            bsl::vector<CallSite> sites(&va);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 2 == sites.size());
+            ASSERT(&va == sites.get_allocator().mechanism());
+            ASSERT(&va == sites[0].d_addresses.get_allocator().mechanism());
+
+            // Site A has 300 live bytes, and site B 250.
+
+            ASSERTV(sites[0].d_liveBytes, 300 == sites[0].d_liveBytes);
+            ASSERTV(sites[1].d_liveBytes, 250 == sites[1].d_liveBytes);
+
+            const bsl::vector<void *> STACK_A(sites[0].d_addresses, &va);
+            const bsl::vector<void *> STACK_B(sites[1].d_addresses, &va);
+
+            ASSERT(!STACK_A.empty());
+            ASSERT(!STACK_B.empty());
+            ASSERT(STACK_A != STACK_B);
+
+            mX.deallocate(a[0]);
+            mX.deallocate(a[1]);
+
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 2 == sites.size());
+
+            // Now site B has more live bytes.
+
+            ASSERT(STACK_B == sites[0].d_addresses);
+            ASSERT(STACK_A == sites[1].d_addresses);
+
+            static const struct {
+                int   d_line;              // source line number
+                Int64 d_numLiveSamples;
+                Int64 d_numTotalSamples;
+                Int64 d_liveAllocations;
+                Int64 d_liveBytes;
+                Int64 d_totalAllocations;
+                Int64 d_totalBytes;
+            } EXP[] = {
+                //LINE  NLS  NTS  LA   LB  TA   TB
+                //----  ---  ---  --  ---  --  ---
+                { L_,     1,   1,  1, 250,  1, 250 },  // site B
+                { L_,     1,   3,  1, 100,  3, 300 },  // site A
+            };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                const int       LINE = EXP[ti].d_line;
+                const CallSite& SITE = sites[ti];
+
+                ASSERTV(LINE, SITE.d_numLiveSamples,
+                        EXP[ti].d_numLiveSamples == SITE.d_numLiveSamples);
+                ASSERTV(LINE, SITE.d_numTotalSamples,
+                        EXP[ti].d_numTotalSamples == SITE.d_numTotalSamples);
+                ASSERTV(LINE, SITE.d_liveAllocations,
+                        EXP[ti].d_liveAllocations == SITE.d_liveAllocations);
+                ASSERTV(LINE, SITE.d_liveBytes,
+                        EXP[ti].d_liveBytes == SITE.d_liveBytes);
+                ASSERTV(LINE, SITE.d_totalAllocations,
+                        EXP[ti].d_totalAllocations
+                                                 == SITE.d_totalAllocations);
+                ASSERTV(LINE, SITE.d_totalBytes,
+                        EXP[ti].d_totalBytes == SITE.d_totalBytes);
+            }
+
+            // The blocks and the profile are supplied by `oa`: two stacks,
+            // two map nodes, and two blocks.
+
+            ASSERTV(oa.numBlocksInUse(), 6 == oa.numBlocksInUse());
+
+            mX.deallocate(a[2]);
+            mX.deallocate(b);
+
+            ASSERTV(oa.numBlocksInUse(), 4 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nWeighting samples." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(100, &oa);  const Obj& X = mX;
+
+            // Allocate until a block is sampled.
+
+            bsl::vector<void *> blocks(&oa);
+            while (0 == X.numSamples()) {
+                blocks.push_back(mX.allocate(100));
+            }
+
+            bsl::vector<CallSite> sites(&oa);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), 1 == sites.size());
+
+            // The weight is `1 / (1 - exp(-1))`, or about 1.582.
+
+            ASSERTV(sites[0].d_liveAllocations,
+                    2 == sites[0].d_liveAllocations);
+            ASSERTV(sites[0].d_liveBytes, 158 == sites[0].d_liveBytes);
+            ASSERTV(sites[0].d_totalBytes, 158 == sites[0].d_totalBytes);
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites[0].d_liveAllocations,
+                    0 == sites[0].d_liveAllocations);
+            ASSERTV(sites[0].d_liveBytes, 0 == sites[0].d_liveBytes);
+            ASSERTV(sites[0].d_totalBytes, 158 == sites[0].d_totalBytes);
+        }
+
+        if (verbose) cout << "\nA very large sample interval." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(Int64(1) << 40, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 1024; ++i) {
+                mX.deallocate(mX.allocate(1024));
+            }
+
+            ASSERTV(X.numSamples(), 0 == X.numSamples());
+
+            bsl::vector<CallSite> sites(&oa);
+            X.loadCallSites(&sites);
+
+            ASSERTV(sites.size(), sites.empty());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(1, &oa);  const Obj& X = mX;
+
+            bsl::vector<CallSite> sites(&oa);
+
+            ASSERT_PASS(X.loadCallSites(&sites));
+            ASSERT_FAIL(X.loadCallSites(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, `allocate`, AND `deallocate`
+        //
+        // Concerns:
+        // 1. The default constructor uses `k_DEFAULT_SAMPLE_INTERVAL`, and
+        //    the value constructor the specified interval.
+        //
+        // 2. If an allocator is not specified, the default allocator is used.
+        //
+        // 3. `allocate` returns a maximally-aligned block, supplied by the
+        //    upstream allocator, that is `BSLS_MAX_ALIGNMENT` bytes larger
+        //    than requested, whether or not it is sampled.
+        //
+        // 4. `deallocate` returns the block to the upstream allocator.
+        //
+        // 5. Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //
+        // 6. If recording a sample throws, the block is returned to the
+        //    upstream allocator.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create objects with and without an allocator and a sample
+        //    interval, and verify the accessors.  (C-1..2)
+        //
+        // 2. Allocate blocks of various sizes with sample intervals of 1 and
+        //    2^40 bytes, and verify their alignment and the upstream
+        //    allocator.  (C-3..5)
+        //
+        // 3. Sample allocations from a test allocator in an exception test
+        //    loop, and verify that no memory leaks.  (C-6)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   HeapProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+        //   HeapProfilingAllocator(Int64 sampleInterval, *ba = 0);
+        //   ~HeapProfilingAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 sampleInterval() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, `allocate`, AND `deallocate`" << endl
+                          << "======================================" << endl;
+
+        if (verbose) cout << "\nCreators." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            const Obj W;
+            ASSERT(Obj::k_DEFAULT_SAMPLE_INTERVAL == W.sampleInterval());
+            ASSERT(&da == W.allocator());
+
+            const Obj X(&oa);
+            ASSERT(Obj::k_DEFAULT_SAMPLE_INTERVAL == X.sampleInterval());
+            ASSERT(&oa == X.allocator());
+
+            const Obj Y(4096);
+            ASSERT(4096 == Y.sampleInterval());
+            ASSERT(&da  == Y.allocator());
+
+            const Obj Z(1, &oa);
+            ASSERT(1   == Z.sampleInterval());
+            ASSERT(&oa == Z.allocator());
+            ASSERT(0   == Z.numSamples());
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nForwarding to the upstream allocator." << endl;
+        {
+            static const Int64 INTERVALS[] = { 1, Int64(1) << 40 };
+
+            for (int ii = 0; ii < 2; ++ii) {
+                const Int64 INTERVAL = INTERVALS[ii];
+
+                bslma::TestAllocator oa("object", veryVerbose);
+
+                Obj mX(INTERVAL, &oa);
+
+                ASSERT(0 == mX.allocate(0));
+                ASSERT(0 == oa.numBlocksTotal());
+
+                mX.deallocate(0);
+                ASSERT(0 == oa.numBlocksTotal());
+
+                for (int size = 1; size <= 1000; size = size * 3 + 1) {
+                    void *p = mX.allocate(size);
+
+                    ASSERTV(INTERVAL, size, 0 ==
+                             reinterpret_cast<bsls::Types::UintPtr>(p)
+                                % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+                    // Unless the block is sampled, it is the last block
+                    // supplied by `oa`.
+
+                    const Int64 REQUESTED = size + OFFSET;
+                    const Int64 PROFILE   = oa.numBytesInUse() - REQUESTED;
+
+                    ASSERTV(INTERVAL, size, oa.lastAllocatedNumBytes(),
+                            1 == INTERVAL
+                         || REQUESTED == Int64(oa.lastAllocatedNumBytes()));
+
+                    bsl::memset(p, 0xa5, size);
+                    mX.deallocate(p);
+
+                    ASSERTV(INTERVAL, size,
+                            PROFILE == oa.numBytesInUse());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nException safety." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(1, &oa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                void *p = u::siteA(&mX, 64);
+                mX.deallocate(p);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            // The failed attempts leave at most the profile of one call site.
+
+            ASSERTV(oa.numBlocksInUse(), 2 >= oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(Int64(0)));
+            ASSERT_FAIL(Obj(Int64(-1)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CALLSITE CREATORS
+        //
+        // Concerns:
+        // 1. The default constructor creates a call site having no addresses
+        //    and no samples.
+        //
+        // 2. The copy constructor copies every member, using the specified
+        //    allocator.
+        //
+        // Plan:
+        // 1. Create call sites with and without an allocator, and verify their
+        //    members and allocators.  (C-1..2)
+        //
+        // Testing:
+        //   CallSite(bslma::Allocator *basicAllocator = 0);
+        //   CallSite(const CallSite& original, bslma::Allocator *ba = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CALLSITE CREATORS" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        CallSite mX(&oa);  const CallSite& X = mX;
+
+        ASSERT(X.d_addresses.empty());
+        ASSERT(0   == X.d_numLiveSamples);
+        ASSERT(0   == X.d_numTotalSamples);
+        ASSERT(0   == X.d_liveAllocations);
+        ASSERT(0   == X.d_liveBytes);
+        ASSERT(0   == X.d_totalAllocations);
+        ASSERT(0   == X.d_totalBytes);
+        ASSERT(&oa == X.d_addresses.get_allocator().mechanism());
+
+        mX.d_addresses.push_back(&mX);
+        mX.d_numLiveSamples   = 1;
+        mX.d_numTotalSamples  = 2;
+        mX.d_liveAllocations  = 3;
+        mX.d_liveBytes        = 4;
+        mX.d_totalAllocations = 5;
+        mX.d_totalBytes       = 6;
+
+        const CallSite Y(X, &sa);
+
+        ASSERT(X.d_addresses == Y.d_addresses);
+        ASSERT(1   == Y.d_numLiveSamples);
+        ASSERT(2   == Y.d_numTotalSamples);
+        ASSERT(3   == Y.d_liveAllocations);
+        ASSERT(4   == Y.d_liveBytes);
+        ASSERT(5   == Y.d_totalAllocations);
+        ASSERT(6   == Y.d_totalBytes);
+        ASSERT(&sa == Y.d_addresses.get_allocator().mechanism());
+
+        const CallSite Z(X);
+
+        ASSERT(X.d_addresses == Z.d_addresses);
+        ASSERT(&da == Z.d_addresses.get_allocator().mechanism());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Sample an allocation, and verify its call site.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(1, &oa);  const Obj& X = mX;
+
+        void *p = mX.allocate(42);
+        ASSERT(p);
+        ASSERT(1 == X.numSamples());
+
+        bsl::vector<CallSite> sites(&oa);
+        X.loadCallSites(&sites);
+
+        ASSERT(1  == sites.size());
+        ASSERT(42 == sites[0].d_liveBytes);
+
+        mX.deallocate(p);
+
+        X.loadCallSites(&sites);
+
+        ASSERT(0  == sites[0].d_liveBytes);
+        ASSERT(42 == sites[0].d_totalBytes);
+
+        if (veryVerbose) {
+            X.print(cout);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD AT THE DEFAULT SAMPLE INTERVAL
+        //
+        // Concerns:
+        // 1. Measure the cost of profiling an allocation-heavy workload at
+        //    the default sample interval.
+        //
+        // Plan:
+        // 1. Allocate, write to, and deallocate blocks of 16 to 527 bytes,
+        //    keeping 1024 live, through `bslma::NewDeleteAllocator` directly,
+        //    through `bdlma::CountingAllocator` (which also prepends a header
+        //    to every block), and through `balb::HeapProfilingAllocator` with
+        //    the default sample interval, and report the fastest of three
+        //    times per operation and the overhead relative to the unprofiled
+        //    allocator.  The number of operations is 20 million, or the
+        //    number of millions given as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD AT THE DEFAULT SAMPLE INTERVAL
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: OVERHEAD AT THE DEFAULT SAMPLE INTERVAL" << endl
+             << "====================================================" << endl;
+
+        const int MILLIONS = argc > 2 && 0 < bsl::atoi(argv[2])
+                           ? bsl::atoi(argv[2])
+                           : 20;
+        const int NUM_OPS  = MILLIONS * 1000 * 1000;
+
+        bslma::NewDeleteAllocator& nda =
+                                      bslma::NewDeleteAllocator::singleton();
+
+        bdlma::CountingAllocator ca(&nda);
+        Obj                      mX(&nda);  const Obj& X = mX;
+
+        // Warm up the heap.
+
+        u::churn(&nda, NUM_OPS / 10);
+
+        // The allocators are measured in turn, three times, and the fastest
+        // time of each is reported, to reduce the noise of the heap.
+
+        double NEW_DELETE = 0, COUNTING = 0, PROFILING = 0;
+        for (int i = 0; i < 3; ++i) {
+            const double ND = u::churn(&nda, NUM_OPS);
+            const double CA = u::churn(&ca,  NUM_OPS);
+            const double HP = u::churn(&mX,  NUM_OPS);
+
+            NEW_DELETE = 0 == i ? ND : bsl::min(NEW_DELETE, ND);
+            COUNTING   = 0 == i ? CA : bsl::min(COUNTING,   CA);
+            PROFILING  = 0 == i ? HP : bsl::min(PROFILING,  HP);
+        }
+
+        cout << "bslma::NewDeleteAllocator     : " << NEW_DELETE << " ns/op"
+             << endl
+             << "bdlma::CountingAllocator      : " << COUNTING   << " ns/op ("
+             << (COUNTING / NEW_DELETE - 1) * 100 << "%)" << endl
+             << "balb::HeapProfilingAllocator  : " << PROFILING  << " ns/op ("
+             << (PROFILING / NEW_DELETE - 1) * 100 << "%), "
+             << X.numSamples() << " samples" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,515 @@
+// ball_adaptivesamplingobserver.cpp                                  -*-C++-*-
+#include <ball_adaptivesamplingobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_adaptivesamplingobserver_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The state of each category is held by an
+// `AdaptiveSamplingObserver_Category` object, which owns the name of the
+// category (viewed by the key of the category map), and is never destroyed
+// before the observer.  Publishing a record of a category that is not sampled
+// reads the category map under a read lock, and increments one of the
+// `k_NUM_SHARDS` counters of the category, chosen by hashing the identifier
+// of the publishing thread; each counter occupies its own cache line.  Only
+// the records of a sampled category increment the shared sequence number
+// that selects the sample.
+//
+// The load is evaluated by at most one thread at a time: the publishing
+// thread that finds the evaluation interval elapsed tries to lock
+// `d_evaluationMutex`, and returns immediately if another thread holds it.
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdls_processutil.h>
+#include <bdlt_currenttime.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_iomanip.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_MAX_SAMPLING_SHIFT  = 10,  // sampling ratio of at most 1 in 1024
+
+    k_RECOVERY_INTERVALS  = 4,   // consecutive intervals without overload
+                                 // before the sampling ratios are halved
+
+    k_NUM_SHARDS_LOG2     = 4,   // base-2 logarithm of the number of counter
+                                 // shards of a category
+
+    k_CACHE_LINE_SIZE     = 64   // assumed size of a cache line
+};
+
+const Int64 k_NANOSECONDS_PER_MILLISECOND = 1000 * 1000;
+
+/// Return the index of the counter shard used by the calling thread.
+inline
+int shardIndex()
+{
+    // Thread identifiers are frequently aligned addresses: multiply by the
+    // 64-bit golden ratio, and keep the top bits.
+
+    const Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    return static_cast<int>((id * 0x9E3779B97F4A7C15ULL)
+                                                >> (64 - k_NUM_SHARDS_LOG2));
+}
+
+/// Return the number of nanoseconds in the specified `interval`, or the
+/// maximum `Int64` value if `interval` cannot be represented in
+/// nanoseconds.
+Int64 toNanoseconds(const bsls::TimeInterval& interval)
+{
+    const Int64 k_MAX_SECONDS = 9000000000LL;  // about 285 years
+
+    if (k_MAX_SECONDS <= interval.seconds()) {
+        return k_MAX_SECONDS * 1000000000LL;                          // RETURN
+    }
+    return interval.totalNanoseconds();
+}
+
+}  // close unnamed namespace
+
+                  // =======================================
+                  // class AdaptiveSamplingObserver_Category
+                  // =======================================
+
+/// This component-private class holds the state of a category of an
+/// `AdaptiveSamplingObserver`.
+class AdaptiveSamplingObserver_Category {
+
+  public:
+    // PUBLIC TYPES
+    enum { k_NUM_SHARDS = 1 << k_NUM_SHARDS_LOG2 };
+
+    /// This `struct` holds a counter occupying its own cache line.
+    struct Shard {
+
+        // PUBLIC DATA
+        bsls::AtomicInt64 d_count;
+        char              d_padding[k_CACHE_LINE_SIZE -
+                                                   sizeof(bsls::AtomicInt64)];
+    };
+
+    // PUBLIC DATA
+    Shard             d_shards[k_NUM_SHARDS];  // records received during the
+                                               // current interval
+
+    bsls::AtomicInt   d_samplingShift;         // base-2 logarithm of the
+                                               // sampling ratio
+
+    bsls::AtomicInt64 d_sequence;              // sequence number of the
+                                               // sampled records
+
+    bsls::AtomicInt64 d_numSuppressed;         // records suppressed since
+                                               // the previous summary
+
+    bsl::string       d_name;                  // name of the category
+
+    // CREATORS
+
+    /// Create the state of the category having the specified `name`, not
+    /// sampled.  Use the specified `basicAllocator` to supply memory.
+    AdaptiveSamplingObserver_Category(const bsl::string_view&  name,
+                                      bslma::Allocator        *basicAllocator)
+    : d_samplingShift(0)
+    , d_sequence(0)
+    , d_numSuppressed(0)
+    , d_name(name, basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Return the number of records received during the current interval,
+    /// and reset it to 0.
+    Int64 takeCount()
+    {
+        Int64 count = 0;
+        for (int i = 0; i < k_NUM_SHARDS; ++i) {
+            count += d_shards[i].d_count.swap(0);
+        }
+        return count;
+    }
+};
+
+                       // ------------------------------
+                       // class AdaptiveSamplingObserver
+                       // ------------------------------
+
+// PRIVATE MANIPULATORS
+AdaptiveSamplingObserver_Category *AdaptiveSamplingObserver::lookupCategory(
+                                                  const bsl::string_view& name)
+{
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                            &d_categoriesLock);
+
+        CategoryMap::const_iterator it = d_categories.find(name);
+        if (d_categories.end() != it) {
+            return it->second;                                        // RETURN
+        }
+    }
+
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_categoriesLock);
+
+    CategoryMap::const_iterator it = d_categories.find(name);
+    if (d_categories.end() != it) {
+        return it->second;                                            // RETURN
+    }
+
+    AdaptiveSamplingObserver_Category *category =
+                  new (*d_allocator_p) AdaptiveSamplingObserver_Category(
+                                                                name,
+                                                                d_allocator_p);
+
+    d_categories.insert(bsl::make_pair(bsl::string_view(category->d_name),
+                                       category));
+    return category;
+}
+
+void AdaptiveSamplingObserver::evaluateImp(Int64 now)
+{
+    typedef bsl::pair<Int64, AdaptiveSamplingObserver_Category *> Count;
+
+    bsl::vector<Count> counts(d_allocator_p);
+    Int64              total = 0;
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                            &d_categoriesLock);
+
+        counts.reserve(d_categories.size());
+        for (CategoryMap::const_iterator it  = d_categories.begin();
+                                         it != d_categories.end();
+                                       ++it) {
+            const Int64 count = it->second->takeCount();
+
+            counts.push_back(Count(count, it->second));
+            total += count;
+        }
+    }
+
+    bool overloaded = d_loadProbe && d_loadProbe();
+
+    const Int64 publishNanos = d_publishNanos.swap(0);
+    const Int64 publishCount = d_publishCount.swap(0);
+    const Int64 budget       = d_latencyBudget.loadRelaxed();
+
+    if (0 < budget && 0 < publishCount && budget < publishNanos / publishCount)
+    {
+        overloaded = true;
+    }
+
+    if (overloaded) {
+        d_numHealthyIntervals = 0;
+
+        // Sample the noisiest categories, accounting for at least half of the
+        // records received during the interval, more strictly.
+
+        bsl::sort(counts.begin(), counts.end(), bsl::greater<Count>());
+
+        Int64 covered = 0;
+        for (bsl::size_t i = 0; i < counts.size() && 2 * covered < total;
+                                                                        ++i) {
+            AdaptiveSamplingObserver_Category *category = counts[i].second;
+
+            const int shift = category->d_samplingShift.loadRelaxed();
+            if (shift < k_MAX_SAMPLING_SHIFT) {
+                category->d_samplingShift.storeRelaxed(shift + 1);
+            }
+            covered += counts[i].first;
+        }
+    }
+    else if (k_RECOVERY_INTERVALS <= ++d_numHealthyIntervals) {
+        d_numHealthyIntervals = 0;
+
+        for (bsl::size_t i = 0; i < counts.size(); ++i) {
+            AdaptiveSamplingObserver_Category *category = counts[i].second;
+
+            const int shift = category->d_samplingShift.loadRelaxed();
+            if (0 < shift) {
+                category->d_samplingShift.storeRelaxed(shift - 1);
+            }
+        }
+    }
+
+    d_intervalStart = now;
+    d_nextEvaluation.storeRelaxed(now + d_evaluationInterval.loadRelaxed());
+
+    if (d_lastSummary + d_summaryInterval.loadRelaxed() <= now) {
+        publishSummariesImp(now);
+    }
+}
+
+void AdaptiveSamplingObserver::publishSummariesImp(Int64 now)
+{
+    typedef bsl::pair<Int64, AdaptiveSamplingObserver_Category *> Suppressed;
+
+    bsl::vector<Suppressed> suppressed(d_allocator_p);
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                            &d_categoriesLock);
+
+        for (CategoryMap::const_iterator it  = d_categories.begin();
+                                         it != d_categories.end();
+                                       ++it) {
+            const Int64 count = it->second->d_numSuppressed.swap(0);
+            if (0 < count) {
+                suppressed.push_back(Suppressed(count, it->second));
+            }
+        }
+    }
+
+    const Int64 elapsedMs = (now - d_lastSummary)
+                                               / k_NANOSECONDS_PER_MILLISECOND;
+    d_lastSummary         = now;
+
+    if (suppressed.empty()) {
+        return;                                                       // RETURN
+    }
+
+    const int            protectedSeverity = d_protectedSeverity.loadRelaxed();
+    const Context        context(Transmission::e_PASSTHROUGH, 0, 1);
+    const bdlt::Datetime timestamp         = bdlt::CurrentTime::utc();
+    const int            processId         = bdls::ProcessUtil::getProcessId();
+
+    for (bsl::size_t i = 0; i < suppressed.size(); ++i) {
+        const AdaptiveSamplingObserver_Category& category =
+                                                        *suppressed[i].second;
+
+        bsl::ostringstream message(d_allocator_p);
+        message << "suppressed " << suppressed[i].first
+                << " records less severe than "
+                << Severity::toAscii(
+                          static_cast<Severity::Level>(protectedSeverity))
+                << " in the last " << elapsedMs / 1000 << '.'
+                << bsl::setw(3) << bsl::setfill('0') << elapsedMs % 1000
+                << " seconds; sampling 1 in "
+                << (1 << category.d_samplingShift.loadRelaxed());
+
+        bsl::shared_ptr<Record> record =
+                                   bsl::allocate_shared<Record>(d_allocator_p);
+
+        RecordAttributes& fixedFields = record->fixedFields();
+        fixedFields.setTimestamp(timestamp);
+        fixedFields.setProcessID(processId);
+        fixedFields.setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+        fixedFields.setFileName(__FILE__);
+        fixedFields.setLineNumber(__LINE__);
+        fixedFields.setCategory(category.d_name);
+        fixedFields.setSeverity(Severity::e_WARN);
+        fixedFields.setMessage(message.view());
+
+        d_innerObserver->publish(record, context);
+    }
+}
+
+// CREATORS
+AdaptiveSamplingObserver::AdaptiveSamplingObserver(
+                              const bsl::shared_ptr<Observer>&  observer,
+                              bslma::Allocator                 *basicAllocator)
+: d_innerObserver(observer)
+, d_categories(basicAllocator)
+, d_protectedSeverity(Severity::e_WARN)
+, d_evaluationInterval(100 * k_NANOSECONDS_PER_MILLISECOND)
+, d_summaryInterval(10 * 1000 * k_NANOSECONDS_PER_MILLISECOND)
+, d_latencyBudget(0)
+, d_nextEvaluation(0)
+, d_publishNanos(0)
+, d_publishCount(0)
+, d_numSuppressed(0)
+, d_loadProbe(bsl::allocator_arg, basicAllocator)
+, d_intervalStart(0)
+, d_lastSummary(0)
+, d_numHealthyIntervals(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+
+    const Int64 now = bsls::TimeUtil::getTimer();
+
+    d_intervalStart = now;
+    d_lastSummary   = now;
+    d_nextEvaluation.storeRelaxed(now + d_evaluationInterval.loadRelaxed());
+}
+
+AdaptiveSamplingObserver::~AdaptiveSamplingObserver()
+{
+    for (CategoryMap::iterator it  = d_categories.begin();
+                               it != d_categories.end();
+                             ++it) {
+        d_allocator_p->deleteObject(it->second);
+    }
+}
+
+// MANIPULATORS
+void AdaptiveSamplingObserver::publish(
+                                  const bsl::shared_ptr<const Record>& record,
+                                  const Context&                       context)
+{
+    BSLS_ASSERT(record);
+
+    const RecordAttributes& fixedFields = record->fixedFields();
+
+    AdaptiveSamplingObserver_Category *category =
+                                      lookupCategory(fixedFields.category());
+
+    category->d_shards[shardIndex()].d_count.addRelaxed(1);
+
+    bool forward = true;
+
+    if (fixedFields.severity() > d_protectedSeverity.loadRelaxed()) {
+        const int shift = category->d_samplingShift.loadRelaxed();
+
+        if (0 < shift) {
+            const Int64 sequence = category->d_sequence.addRelaxed(1);
+
+            if (0 != (sequence & ((Int64(1) << shift) - 1))) {
+                category->d_numSuppressed.addRelaxed(1);
+                d_numSuppressed.addRelaxed(1);
+                forward = false;
+            }
+        }
+    }
+
+    Int64 now;
+
+    if (!forward) {
+        now = bsls::TimeUtil::getTimer();
+    }
+    else if (0 < d_latencyBudget.loadRelaxed()) {
+        const Int64 start = bsls::TimeUtil::getTimer();
+
+        d_innerObserver->publish(record, context);
+
+        now = bsls::TimeUtil::getTimer();
+        d_publishNanos.addRelaxed(now - start);
+        d_publishCount.addRelaxed(1);
+    }
+    else {
+        d_innerObserver->publish(record, context);
+
+        now = bsls::TimeUtil::getTimer();
+    }
+
+    if (d_nextEvaluation.loadRelaxed() <= now
+     && 0 == d_evaluationMutex.tryLock()) {
+        if (d_nextEvaluation.loadRelaxed() <= now) {
+            evaluateImp(now);
+        }
+        d_evaluationMutex.unlock();
+    }
+}
+
+void AdaptiveSamplingObserver::evaluate()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_evaluationMutex);
+
+    evaluateImp(bsls::TimeUtil::getTimer());
+}
+
+void AdaptiveSamplingObserver::publishSummaries()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_evaluationMutex);
+
+    publishSummariesImp(bsls::TimeUtil::getTimer());
+}
+
+void AdaptiveSamplingObserver::setEvaluationInterval(
+                                            const bsls::TimeInterval& interval)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < interval);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_evaluationMutex);
+
+    const Int64 nanoseconds = toNanoseconds(interval);
+
+    d_evaluationInterval.storeRelaxed(nanoseconds);
+    d_nextEvaluation.storeRelaxed(d_intervalStart + nanoseconds);
+}
+
+void AdaptiveSamplingObserver::setLoadProbe(const LoadProbe& loadProbe)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_evaluationMutex);
+
+    d_loadProbe = loadProbe;
+}
+
+void AdaptiveSamplingObserver::setProtectedSeverity(int severity)
+{
+    BSLS_ASSERT(0 <= severity);
+    BSLS_ASSERT(severity <= 255);
+
+    d_protectedSeverity.storeRelaxed(severity);
+}
+
+void AdaptiveSamplingObserver::setPublishLatencyBudget(
+                                              const bsls::TimeInterval& budget)
+{
+    BSLS_ASSERT(bsls::TimeInterval() <= budget);
+
+    d_latencyBudget.storeRelaxed(toNanoseconds(budget));
+}
+
+void AdaptiveSamplingObserver::setSummaryInterval(
+                                            const bsls::TimeInterval& interval)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < interval);
+
+    d_summaryInterval.storeRelaxed(toNanoseconds(interval));
+}
+
+// ACCESSORS
+int AdaptiveSamplingObserver::samplingRatio(
+                                        const bsl::string_view& category) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_categoriesLock);
+
+    CategoryMap::const_iterator it = d_categories.find(category);
+    if (d_categories.end() == it) {
+        return 1;                                                     // RETURN
+    }
+    return 1 << it->second->d_samplingShift.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
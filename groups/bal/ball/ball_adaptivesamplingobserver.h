@@ -0,0 +1,454 @@
+// ball_adaptivesamplingobserver.h                                    -*-C++-*-
+#ifndef INCLUDED_BALL_ADAPTIVESAMPLINGOBSERVER
+#define INCLUDED_BALL_ADAPTIVESAMPLINGOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that samples the noisiest categories on load.
+//
+//@CLASSES:
+//  ball::AdaptiveSamplingObserver: observer sampling records under load
+//
+//@SEE_ALSO: ball_filteringobserver, ball_logthrottle, ball_asyncfileobserver
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// `ball::Observer` protocol, `ball::AdaptiveSamplingObserver`, that forwards
+// the log records it receives to an inner observer supplied at construction,
+// and, when that observer falls behind, samples the records of the
+// categories that contribute most to the load:
+// ```
+//           ,------------------------------.
+//          ( ball::AdaptiveSamplingObserver )
+//           `------------------------------'
+//                          |              ctor
+//                          |              setEvaluationInterval
+//                          |              setLoadProbe
+//                          |              setProtectedSeverity
+//                          |              setPublishLatencyBudget
+//                          |              setSummaryInterval
+//                          |              evaluate
+//                          |              publishSummaries
+//                          |              numSuppressed
+//                          |              samplingRatio
+//                          V
+//                   ,--------------.
+//                  ( ball::Observer )
+//                   `--------------'
+//                                         publish
+//                                         releaseRecords
+//                                         dtor
+// ```
+// Unlike `ball::LogThrottle`, which limits each logging statement to a fixed
+// budget independently of the state of the logging system, an adaptive
+// sampling observer does not suppress any record while its inner observer
+// keeps up, and reacts to an overload by sampling only the categories that
+// cause it.
+//
+///Load Evaluation
+///---------------
+// An adaptive sampling observer counts the records of each category it
+// receives, in counters that are sharded by thread so that concurrent
+// publishers rarely contend on a cache line.  Once per *evaluation interval*
+// (100 milliseconds by default, see `setEvaluationInterval`), the thread
+// publishing a record evaluates the load of the inner observer, which is
+// deemed *overloaded* if either:
+//
+// * the *load probe* installed by `setLoadProbe` returns `true` (e.g., when
+//   the record queue of a `ball::AsyncFileObserver` is above a watermark),
+//   or
+// * a *publish latency budget* has been set by `setPublishLatencyBudget`, and
+//   the mean time taken by the `publish` method of the inner observer (e.g.,
+//   the time taken by a `ball::FileObserver2` to write a record) during the
+//   evaluation interval exceeds that budget.
+//
+// If the inner observer is overloaded, the *sampling ratio* of the noisiest
+// categories -- the categories that, taken in decreasing order of the number
+// of records received during the interval, account for at least half of
+// those records -- is doubled, up to 1 in 1024.  Once the inner observer has
+// not been overloaded for 4 consecutive intervals, the sampling ratio of
+// every sampled category is halved, until no category is sampled.
+//
+// A category having a sampling ratio of 1 in `N` forwards only one of every
+// `N` records of a severity less severe than the *protected severity*
+// (`ball::Severity::e_WARN` by default, see `setProtectedSeverity`) to the
+// inner observer, and suppresses the others.  Records of the protected
+// severity, or of a more severe severity, are always forwarded.  Note that
+// sampling a category effectively raises its threshold for all but a sample
+// of its less severe records, without modifying the thresholds of the
+// category held by the logger manager.
+//
+///Suppressed Record Summaries
+///---------------------------
+// Once per *summary interval* (10 seconds by default, see
+// `setSummaryInterval`), or when `publishSummaries` is called, an adaptive
+// sampling observer publishes to its inner observer, for each category having
+// suppressed records since the previous summary, a record of
+// `ball::Severity::e_WARN` severity in that category, whose message reports
+// the number of suppressed records and the current sampling ratio of the
+// category.
+//
+///Thread Safety
+///-------------
+// `ball::AdaptiveSamplingObserver` is *thread-safe*, meaning that multiple
+// threads may use their own instances of the class or use a shared instance
+// without further synchronization.  The load of the inner observer is
+// evaluated, and the summaries are published, by the threads calling
+// `publish`: an adaptive sampling observer does not own any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sampling the Records Queued by an Asynchronous Observer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A `ball::AsyncFileObserver` queues records that are written to a file by a
+// publication thread.  If one subsystem logs faster than the records can be
+// written, the queue fills up, and the records of every subsystem are either
+// dropped or block the logging threads.  In this example, we protect such an
+// observer by sampling the records of the noisiest categories while its
+// queue is above a watermark.
+//
+// First, we define a load probe that returns `true` if the record queue of
+// an asynchronous observer is above a watermark:
+// ```
+// class QueueWatermarkProbe {
+//     // DATA
+//     const ball::AsyncFileObserver *d_observer_p;  // observed (held)
+//     bsl::size_t                    d_watermark;   // queue watermark
+//
+//   public:
+//     // CREATORS
+//     QueueWatermarkProbe(const ball::AsyncFileObserver *observer,
+//                         bsl::size_t                    watermark)
+//     : d_observer_p(observer)
+//     , d_watermark(watermark)
+//     {
+//     }
+//
+//     // ACCESSORS
+//     bool operator()() const
+//     {
+//         return d_observer_p->recordQueueLength() > d_watermark;
+//     }
+// };
+// ```
+// Then, we create the asynchronous observer and start its publication
+// thread:
+// ```
+// bslma::Allocator *allocator = bslma::Default::globalAllocator();
+//
+// bsl::shared_ptr<ball::AsyncFileObserver> asyncObserver =
+//                  bsl::allocate_shared<ball::AsyncFileObserver>(allocator);
+//
+// asyncObserver->enableFileLogging("myapplication.log.%T");
+// asyncObserver->startPublicationThread();
+// ```
+// Next, we wrap the asynchronous observer in an adaptive sampling observer,
+// and install a probe deeming it overloaded while more than 8000 records are
+// queued:
+// ```
+// bsl::shared_ptr<ball::AdaptiveSamplingObserver> samplingObserver =
+//         bsl::allocate_shared<ball::AdaptiveSamplingObserver>(allocator,
+//                                                              asyncObserver);
+//
+// samplingObserver->setLoadProbe(QueueWatermarkProbe(asyncObserver.get(),
+//                                                    8000));
+// ```
+// Finally, we register the adaptive sampling observer, instead of the
+// asynchronous observer, with the logger manager:
+// ```
+// ball::LoggerManager::singleton().registerObserver(samplingObserver,
+//                                                   "default");
+// ```
+// If a category now floods the logging system, only a sample of its records
+// of `e_INFO` (and less severe) severity is queued, and a summary of the
+// number of records suppressed is written to the log file every 10 seconds.
+//
+///Example 2: Keeping the Write Latency of a File Observer Within Budget
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A `ball::FileObserver2` writes each record in the thread that logs it.  In
+// this example, we sample the noisiest categories while writing a record
+// takes, on average, more than 20 microseconds:
+// ```
+// bsl::shared_ptr<ball::FileObserver2> fileObserver =
+//                    bsl::allocate_shared<ball::FileObserver2>(allocator);
+//
+// fileObserver->enableFileLogging("myapplication.log.%T");
+//
+// bsl::shared_ptr<ball::AdaptiveSamplingObserver> budgetObserver =
+//          bsl::allocate_shared<ball::AdaptiveSamplingObserver>(allocator,
+//                                                               fileObserver);
+//
+// budgetObserver->setPublishLatencyBudget(bsls::TimeInterval(0, 20000));
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_readerwritermutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string_view.h>
+#include <bsl_unordered_map.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class AdaptiveSamplingObserver_Category;
+class Context;
+class Record;
+
+                       // ==============================
+                       // class AdaptiveSamplingObserver
+                       // ==============================
+
+/// This class provides a concrete implementation of the `Observer` protocol
+/// that forwards the records passed to its `publish` method to an inner
+/// observer supplied at construction and, while that observer is
+/// overloaded, samples the less severe records of the categories that
+/// publish the most records (see {Load Evaluation}).
+class AdaptiveSamplingObserver : public Observer {
+
+  public:
+    // PUBLIC TYPES
+
+    /// `LoadProbe` is the type of a user-supplied callback returning `true`
+    /// if the inner observer is overloaded, and `false` otherwise.
+    typedef bsl::function<bool()> LoadProbe;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<bsl::string_view,
+                               AdaptiveSamplingObserver_Category *>
+                                                                   CategoryMap;
+
+    // DATA
+    bsl::shared_ptr<Observer>  d_innerObserver;        // inner observer
+
+    CategoryMap                d_categories;           // per-category state,
+                                                       // keyed by the name it
+                                                       // owns
+
+    mutable bslmt::ReaderWriterMutex
+                               d_categoriesLock;       // guards `d_categories`
+
+    bsls::AtomicInt            d_protectedSeverity;    // least severe
+                                                       // severity never
+                                                       // suppressed
+
+    bsls::AtomicInt64          d_evaluationInterval;   // nanoseconds between
+                                                       // evaluations
+
+    bsls::AtomicInt64          d_summaryInterval;      // nanoseconds between
+                                                       // summaries
+
+    bsls::AtomicInt64          d_latencyBudget;        // mean publish latency
+                                                       // budget, in
+                                                       // nanoseconds, or 0
+
+    bsls::AtomicInt64          d_nextEvaluation;       // timer value at which
+                                                       // to evaluate the load
+
+    bsls::AtomicInt64          d_publishNanos;         // time spent in the
+                                                       // inner `publish`
+                                                       // during this interval
+
+    bsls::AtomicInt64          d_publishCount;         // records timed during
+                                                       // this interval
+
+    bsls::AtomicInt64          d_numSuppressed;        // records suppressed
+                                                       // since construction
+
+    bslmt::Mutex               d_evaluationMutex;      // serializes
+                                                       // evaluations, and
+                                                       // guards the following
+
+    LoadProbe                  d_loadProbe;            // load probe, or empty
+
+    bsls::Types::Int64         d_intervalStart;        // timer value at the
+                                                       // start of the
+                                                       // interval
+
+    bsls::Types::Int64         d_lastSummary;          // timer value of the
+                                                       // previous summary
+
+    int                        d_numHealthyIntervals;  // consecutive
+                                                       // intervals without
+                                                       // overload
+
+    bslma::Allocator          *d_allocator_p;          // memory allocator
+                                                       // (held)
+
+    // NOT IMPLEMENTED
+    AdaptiveSamplingObserver(const AdaptiveSamplingObserver&)
+                                                          BSLS_KEYWORD_DELETED;
+    AdaptiveSamplingObserver& operator=(const AdaptiveSamplingObserver&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of the state of the category having the specified
+    /// `name`, creating it if it does not exist.
+    AdaptiveSamplingObserver_Category *lookupCategory(
+                                                const bsl::string_view& name);
+
+    /// Evaluate the load of the inner observer, and adjust the sampling
+    /// ratios of the categories, as of the specified timer value `now`, and
+    /// publish the summaries if the summary interval has elapsed.  The
+    /// behavior is undefined unless `d_evaluationMutex` is locked by the
+    /// calling thread.
+    void evaluateImp(bsls::Types::Int64 now);
+
+    /// Publish the summaries of the suppressed records to the inner
+    /// observer, as of the specified timer value `now`.  The behavior is
+    /// undefined unless `d_evaluationMutex` is locked by the calling thread.
+    void publishSummariesImp(bsls::Types::Int64 now);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AdaptiveSamplingObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an adaptive sampling observer that forwards log records to the
+    /// specified `observer`, having no load probe and no publish latency
+    /// budget (i.e., that never deems `observer` overloaded until either is
+    /// set), an evaluation interval of 100 milliseconds, a summary interval
+    /// of 10 seconds, and a protected severity of `Severity::e_WARN`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined if `observer` is 0 or a cycle is
+    /// created among observers.
+    explicit AdaptiveSamplingObserver(
+                        const bsl::shared_ptr<Observer>&  observer,
+                        bslma::Allocator                 *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~AdaptiveSamplingObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    /// Process the specified log `record` having the specified publishing
+    /// `context`: count `record` in its category, forward `record` and
+    /// `context` to the inner observer unless the category of `record` is
+    /// sampled and `record` is not part of the sample, and evaluate the
+    /// load of the inner observer if the evaluation interval has elapsed.
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context)
+                                                         BSLS_KEYWORD_OVERRIDE;
+
+    /// Discard any shared reference to a `Record` object that was supplied
+    /// to the `publish` method, and is held by the inner observer.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    /// Evaluate the load of the inner observer, and adjust the sampling
+    /// ratios of the categories, now, for the records received since the
+    /// previous evaluation (see {Load Evaluation}), and restart the
+    /// evaluation interval.
+    void evaluate();
+
+    /// Publish to the inner observer a summary record for each category
+    /// having suppressed records since the previous summary (see
+    /// {Suppressed Record Summaries}), and restart the summary interval.
+    void publishSummaries();
+
+    /// Set the interval between two evaluations of the load of the inner
+    /// observer to the specified `interval`.  The behavior is undefined
+    /// unless `bsls::TimeInterval() < interval`.
+    void setEvaluationInterval(const bsls::TimeInterval& interval);
+
+    /// Install the specified `loadProbe`, called once per evaluation, as
+    /// the load probe of this observer.  An empty `loadProbe` uninstalls
+    /// the load probe.
+    void setLoadProbe(const LoadProbe& loadProbe);
+
+    /// Set the protected severity of this observer to the specified
+    /// `severity`: records of `severity`, or of a more severe severity, are
+    /// never suppressed.  The behavior is undefined unless
+    /// `0 <= severity <= 255`.
+    void setProtectedSeverity(int severity);
+
+    /// Set the budget for the mean time taken by the `publish` method of
+    /// the inner observer, above which the inner observer is deemed
+    /// overloaded, to the specified `budget`.  A `budget` of 0 disables the
+    /// budget and the timing of the inner observer.  The behavior is
+    /// undefined unless `bsls::TimeInterval() <= budget`.
+    void setPublishLatencyBudget(const bsls::TimeInterval& budget);
+
+    /// Set the interval between two summaries of the suppressed records to
+    /// the specified `interval`.  The behavior is undefined unless
+    /// `bsls::TimeInterval() < interval`.
+    void setSummaryInterval(const bsls::TimeInterval& interval);
+
+    // ACCESSORS
+
+    /// Return the number of records suppressed by this observer since its
+    /// construction.
+    bsls::Types::Int64 numSuppressed() const;
+
+    /// Return `N`, where the category having the specified `category` name
+    /// currently forwards one of every `N` records less severe than the
+    /// protected severity to the inner observer.  Return 1 if `category` is
+    /// not sampled, or if this observer has not received a record of
+    /// `category`.
+    int samplingRatio(const bsl::string_view& category) const;
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class AdaptiveSamplingObserver
+                       // ------------------------------
+
+// MANIPULATORS
+inline
+void AdaptiveSamplingObserver::releaseRecords()
+{
+    d_innerObserver->releaseRecords();
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 AdaptiveSamplingObserver::numSuppressed() const
+{
+    return d_numSuppressed.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
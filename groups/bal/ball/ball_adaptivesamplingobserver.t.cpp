@@ -0,0 +1,1063 @@
+// ball_adaptivesamplingobserver.t.cpp                                -*-C++-*-
+#include <ball_adaptivesamplingobserver.h>
+
+#include <ball_asyncfileobserver.h>
+#include <ball_context.h>
+#include <ball_fileobserver2.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that forwards records to an inner
+// observer, and samples the records of the noisiest categories while the
+// inner observer is overloaded.  We drive the load evaluation explicitly
+// with `evaluate`, using a load probe returning a flag set by the test, and
+// a slow inner observer to exceed a publish latency budget.  We then verify
+// that the evaluations and summaries are triggered by `publish` once their
+// intervals elapse, and that concurrent publishers neither lose nor
+// duplicate records.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] AdaptiveSamplingObserver(const shared_ptr<Observer>&, Allocator *);
+// [ 2] ~AdaptiveSamplingObserver();
+//
+// MANIPULATORS
+// [ 2] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 2] void releaseRecords();
+// [ 3] void evaluate();
+// [ 5] void publishSummaries();
+// [ 6] void setEvaluationInterval(const bsls::TimeInterval& interval);
+// [ 3] void setLoadProbe(const LoadProbe& loadProbe);
+// [ 3] void setProtectedSeverity(int severity);
+// [ 4] void setPublishLatencyBudget(const bsls::TimeInterval& budget);
+// [ 6] void setSummaryInterval(const bsls::TimeInterval& interval);
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 numSuppressed() const;
+// [ 3] int samplingRatio(const bsl::string_view& category) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: CONCURRENT PUBLISHERS
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::AdaptiveSamplingObserver Obj;
+typedef bsl::shared_ptr<ball::Record>  Handle;
+typedef bsls::Types::Int64             Int64;
+
+const ball::Context CONTEXT(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return a new record, allocated by the specified `allocator`, having the
+/// specified `category` and `severity`.
+Handle makeRecord(const char       *category,
+                  int               severity,
+                  bslma::Allocator *allocator)
+{
+    Handle record = bsl::allocate_shared<ball::Record>(allocator);
+
+    record->fixedFields().setCategory(category);
+    record->fixedFields().setSeverity(severity);
+    return record;
+}
+
+/// Publish the specified `numRecords` records having the specified
+/// `category` and `severity` to the specified `observer`, using the
+/// specified `allocator` to supply memory.
+void publish(Obj              *observer,
+             const char       *category,
+             int               severity,
+             int               numRecords,
+             bslma::Allocator *allocator)
+{
+    Handle record = makeRecord(category, severity, allocator);
+
+    for (int i = 0; i < numRecords; ++i) {
+        observer->publish(record, CONTEXT);
+    }
+}
+
+                              // ===============
+                              // class FlagProbe
+                              // ===============
+
+/// This load probe returns the value of a flag owned by the test.
+class FlagProbe {
+
+    // DATA
+    const bool *d_flag_p;  // flag (held)
+
+  public:
+    // CREATORS
+
+    /// Create a probe returning the value of the specified `flag`.
+    explicit FlagProbe(const bool *flag)
+    : d_flag_p(flag)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return the value of the flag supplied at construction.
+    bool operator()() const
+    {
+        return *d_flag_p;
+    }
+};
+
+                             // ==================
+                             // class SlowObserver
+                             // ==================
+
+/// This observer spins for a configurable time in `publish`, and counts the
+/// records it receives.
+class SlowObserver : public ball::Observer {
+
+    // DATA
+    bsls::AtomicInt64 d_delayNanos;  // time to spin in `publish`
+    bsls::AtomicInt   d_numRecords;  // records received
+
+  public:
+    // CREATORS
+
+    /// Create an observer spinning for the specified `delayNanos`
+    /// nanoseconds in `publish`.
+    explicit SlowObserver(Int64 delayNanos)
+    : d_delayNanos(delayNanos)
+    , d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    /// Spin, then count the record.
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        const Int64 end = bsls::TimeUtil::getTimer() + d_delayNanos;
+        while (bsls::TimeUtil::getTimer() < end) {
+        }
+        ++d_numRecords;
+    }
+
+    /// Set the time spent in `publish` to the specified `delayNanos`.
+    void setDelay(Int64 delayNanos)
+    {
+        d_delayNanos = delayNanos;
+    }
+
+    // ACCESSORS
+
+    /// Return the number of records received.
+    int numRecords() const
+    {
+        return d_numRecords;
+    }
+};
+
+                              // ================
+                              // struct Publisher
+                              // ================
+
+/// This functor publishes records of a few categories to an observer.
+struct Publisher {
+
+    // DATA
+    Obj            *d_observer_p;
+    int             d_numRecords;
+    bslmt::Barrier *d_barrier_p;
+
+    // ACCESSORS
+
+    /// Wait on `d_barrier_p`, then publish `d_numRecords` records, of
+    /// alternating categories and severities, to `d_observer_p`.
+    void operator()() const
+    {
+        static const char *const CATEGORIES[] = { "A", "A", "A", "B" };
+
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        Handle records[4];
+        for (int i = 0; i < 4; ++i) {
+            records[i] = makeRecord(CATEGORIES[i],
+                                    i == 2 ? ball::Severity::e_ERROR
+                                           : ball::Severity::e_INFO,
+                                    allocator);
+        }
+
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numRecords; ++i) {
+            d_observer_p->publish(records[i % 4], CONTEXT);
+        }
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Example 1: Sampling the Records Queued by an Asynchronous Observer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A `ball::AsyncFileObserver` queues records that are written to a file by a
+// publication thread.  If one subsystem logs faster than the records can be
+// written, the queue fills up, and the records of every subsystem are either
+// dropped or block the logging threads.  In this example, we protect such an
+// observer by sampling the records of the noisiest categories while its
+// queue is above a watermark.
+//
+// First, we define a load probe that returns `true` if the record queue of
+// an asynchronous observer is above a watermark:
+// ```
+class QueueWatermarkProbe {
+    // DATA
+    const ball::AsyncFileObserver *d_observer_p;  // observed (held)
+    bsl::size_t                    d_watermark;   // queue watermark
+
+  public:
+    // CREATORS
+    QueueWatermarkProbe(const ball::AsyncFileObserver *observer,
+                        bsl::size_t                    watermark)
+    : d_observer_p(observer)
+    , d_watermark(watermark)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()() const
+    {
+        return d_observer_p->recordQueueLength() > d_watermark;
+    }
+};
+// ```
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    Write the log files to a temporary directory.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ga("global", veryVerbose);
+        bslma::Default::setGlobalAllocator(&ga);
+
+        ball::LoggerManagerConfiguration configuration;
+        ball::LoggerManagerScopedGuard   managerGuard(configuration, &ga);
+
+        bsl::string directory(&ga);
+        ASSERT(0 == bdls::FilesystemUtil::createTemporaryDirectory(
+                                                  &directory,
+                                                  "ball_adaptivesampling"));
+
+        bsl::string asyncLog(directory, &ga);
+        bdls::PathUtil::appendRaw(&asyncLog, "myapplication.log.%T");
+
+        bsl::string fileLog(directory, &ga);
+        bdls::PathUtil::appendRaw(&fileLog, "myapplication2.log.%T");
+
+// Then, we create the asynchronous observer and start its publication
+// thread:
+// ```
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    bsl::shared_ptr<ball::AsyncFileObserver> asyncObserver =
+                     bsl::allocate_shared<ball::AsyncFileObserver>(allocator);
+
+    asyncObserver->enableFileLogging(asyncLog.c_str());
+    asyncObserver->startPublicationThread();
+// ```
+// Next, we wrap the asynchronous observer in an adaptive sampling observer,
+// and install a probe deeming it overloaded while more than 8000 records are
+// queued:
+// ```
+    bsl::shared_ptr<ball::AdaptiveSamplingObserver> samplingObserver =
+           bsl::allocate_shared<ball::AdaptiveSamplingObserver>(allocator,
+                                                                asyncObserver);
+
+    samplingObserver->setLoadProbe(QueueWatermarkProbe(asyncObserver.get(),
+                                                       8000));
+// ```
+// Finally, we register the adaptive sampling observer, instead of the
+// asynchronous observer, with the logger manager:
+// ```
+    ball::LoggerManager::singleton().registerObserver(samplingObserver,
+                                                      "default");
+// ```
+// If a category now floods the logging system, only a sample of its records
+// of `e_INFO` (and less severe) severity is queued, and a summary of the
+// number of records suppressed is written to the log file every 10 seconds.
+//
+///Example 2: Keeping the Write Latency of a File Observer Within Budget
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A `ball::FileObserver2` writes each record in the thread that logs it.  In
+// this example, we sample the noisiest categories while writing a record
+// takes, on average, more than 20 microseconds:
+// ```
+    bsl::shared_ptr<ball::FileObserver2> fileObserver =
+                       bsl::allocate_shared<ball::FileObserver2>(allocator);
+
+    fileObserver->enableFileLogging(fileLog.c_str());
+
+    bsl::shared_ptr<ball::AdaptiveSamplingObserver> budgetObserver =
+            bsl::allocate_shared<ball::AdaptiveSamplingObserver>(allocator,
+                                                                 fileObserver);
+
+    budgetObserver->setPublishLatencyBudget(bsls::TimeInterval(0, 20000));
+// ```
+
+        u::publish(samplingObserver.get(),
+                   "EXAMPLE",
+                   ball::Severity::e_INFO,
+                   10,
+                   &ga);
+        u::publish(budgetObserver.get(),
+                   "EXAMPLE",
+                   ball::Severity::e_INFO,
+                   10,
+                   &ga);
+        ASSERT(0 == samplingObserver->numSuppressed());
+        ASSERT(0 == budgetObserver->numSuppressed());
+
+        ball::LoggerManager::singleton().deregisterObserver("default");
+        asyncObserver->stopPublicationThread();
+        fileObserver->disableFileLogging();
+
+        ASSERT(0 == bdls::FilesystemUtil::remove(directory, true));
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUBLISHERS
+        //
+        // Concerns:
+        // 1. Records published concurrently, while the load is evaluated by
+        //    the publishing threads, are each either forwarded or
+        //    suppressed.
+        //
+        // 2. Records of a protected severity are never suppressed.
+        //
+        // Plan:
+        // 1. Publish records of two categories from several threads to an
+        //    observer evaluating the load every millisecond with a probe
+        //    always reporting an overload, and verify that the number of
+        //    records forwarded plus the number of records suppressed is the
+        //    number of records published, and that all the records of
+        //    `e_ERROR` severity are forwarded.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUBLISHERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT PUBLISHERS" << endl
+                          << "==============================" << endl;
+
+        const int NUM_THREADS = 4;
+        const int NUM_RECORDS = 40000;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ga("global", veryVerbose);
+        bslma::Default::setGlobalAllocator(&ga);
+        {
+            bsl::shared_ptr<u::SlowObserver> inner =
+                                bsl::allocate_shared<u::SlowObserver>(&oa, 0);
+
+            Obj  mX(inner, &oa);
+            bool overloaded = true;
+
+            mX.setLoadProbe(u::FlagProbe(&overloaded));
+            mX.setEvaluationInterval(bsls::TimeInterval(0, 1000000));
+
+            bslmt::Barrier barrier(NUM_THREADS);
+
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS, &oa);
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                u::Publisher publisher = { &mX, NUM_RECORDS, &barrier };
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                                   &handles[i],
+                                                                   publisher,
+                                                                   &oa));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            const Int64 TOTAL = NUM_THREADS * NUM_RECORDS;
+
+            ASSERTV(inner->numRecords(),
+                    mX.numSuppressed(),
+                    TOTAL == inner->numRecords() + mX.numSuppressed());
+            ASSERTV(inner->numRecords(), TOTAL / 4 <= inner->numRecords());
+
+            if (veryVerbose) {
+                P_(inner->numRecords());
+                P_(mX.samplingRatio("A"));
+                P(mX.samplingRatio("B"));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EVALUATION AND SUMMARY INTERVALS
+        //
+        // Concerns:
+        // 1. `publish` evaluates the load once the evaluation interval has
+        //    elapsed, and not before.
+        //
+        // 2. `publish` publishes the summaries once the summary interval has
+        //    elapsed.
+        //
+        // Plan:
+        // 1. With a probe reporting an overload and an evaluation interval of
+        //    10 milliseconds, publish records, and verify that the sampling
+        //    ratio is unchanged; sleep for the interval, publish a record,
+        //    and verify that the sampling ratio has doubled.  (C-1)
+        //
+        // 2. Set a summary interval of 1 millisecond, sleep beyond both
+        //    intervals, publish a record, and verify that a summary has been
+        //    published.  (C-2)
+        //
+        // Testing:
+        //   void setEvaluationInterval(const bsls::TimeInterval& interval);
+        //   void setSummaryInterval(const bsls::TimeInterval& interval);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVALUATION AND SUMMARY INTERVALS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::ostringstream output(&oa);
+
+            bsl::shared_ptr<ball::TestObserver> inner =
+                 bsl::allocate_shared<ball::TestObserver>(&oa, &output);
+
+            Obj  mX(inner, &oa);  const Obj& X = mX;
+            bool overloaded = true;
+
+            mX.setLoadProbe(u::FlagProbe(&overloaded));
+            mX.setEvaluationInterval(bsls::TimeInterval(0, 10000000));
+            mX.setSummaryInterval(bsls::TimeInterval(3600, 0));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 10, &oa);
+            ASSERTV(X.samplingRatio("A"), 1 == X.samplingRatio("A"));
+
+            bslmt::ThreadUtil::microSleep(20000);
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 1, &oa);
+            ASSERTV(X.samplingRatio("A"), 2 == X.samplingRatio("A"));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 10, &oa);
+            ASSERTV(X.numSuppressed(), 5 == X.numSuppressed());
+
+            const int NUM_PUBLISHED = inner->numPublishedRecords();
+
+            mX.setSummaryInterval(bsls::TimeInterval(0, 1000000));
+            bslmt::ThreadUtil::microSleep(20000);
+
+            u::publish(&mX, "B", ball::Severity::e_WARN, 1, &oa);
+
+            ASSERTV(NUM_PUBLISHED,
+                    inner->numPublishedRecords(),
+                    NUM_PUBLISHED + 2 == inner->numPublishedRecords());
+            ASSERTV(inner->lastPublishedRecord().fixedFields().category(),
+                    bsl::string_view("A") ==
+                     inner->lastPublishedRecord().fixedFields().category());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `publishSummaries`
+        //
+        // Concerns:
+        // 1. `publishSummaries` publishes one record of `e_WARN` severity for
+        //    each category having suppressed records, in that category,
+        //    reporting the number of suppressed records and the sampling
+        //    ratio.
+        //
+        // 2. The suppressed records are counted from the previous summary.
+        //
+        // Plan:
+        // 1. Sample a category, publish records, call `publishSummaries`, and
+        //    verify the record published to the inner observer.  (C-1)
+        //
+        // 2. Call `publishSummaries` again, and verify that no record is
+        //    published.  (C-2)
+        //
+        // Testing:
+        //   void publishSummaries();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `publishSummaries`" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::ostringstream output(&oa);
+
+            bsl::shared_ptr<ball::TestObserver> inner =
+                 bsl::allocate_shared<ball::TestObserver>(&oa, &output);
+
+            Obj  mX(inner, &oa);
+            bool overloaded = true;
+
+            mX.setLoadProbe(u::FlagProbe(&overloaded));
+            mX.setEvaluationInterval(bsls::TimeInterval(3600, 0));
+            mX.setSummaryInterval(bsls::TimeInterval(3600, 0));
+
+            for (int i = 0; i < 2; ++i) {
+                u::publish(&mX, "NOISY", ball::Severity::e_INFO, 10, &oa);
+                u::publish(&mX, "QUIET", ball::Severity::e_INFO,  1, &oa);
+                mX.evaluate();
+            }
+            ASSERTV(mX.samplingRatio("NOISY"), 4 == mX.samplingRatio("NOISY"));
+            ASSERTV(mX.samplingRatio("QUIET"), 1 == mX.samplingRatio("QUIET"));
+            ASSERTV(mX.numSuppressed(), 5 == mX.numSuppressed());
+
+            u::publish(&mX, "NOISY", ball::Severity::e_INFO, 40, &oa);
+            ASSERTV(mX.numSuppressed(), 35 == mX.numSuppressed());
+
+            const int NUM_PUBLISHED = inner->numPublishedRecords();
+
+            mX.publishSummaries();
+
+            ASSERTV(inner->numPublishedRecords(),
+                    NUM_PUBLISHED + 1 == inner->numPublishedRecords());
+
+            const ball::RecordAttributes& fields =
+                                   inner->lastPublishedRecord().fixedFields();
+
+            ASSERTV(fields.category(),
+                    bsl::string_view("NOISY") == fields.category());
+            ASSERTV(fields.severity(),
+                    ball::Severity::e_WARN == fields.severity());
+
+            const bsl::string_view message = fields.message();
+            if (veryVerbose) {
+                P(message);
+            }
+            ASSERTV(message,
+                    bsl::string_view::npos != message.find("suppressed 35 "));
+            ASSERTV(message,
+                    bsl::string_view::npos != message.find("1 in 4"));
+
+            mX.publishSummaries();
+            ASSERTV(inner->numPublishedRecords(),
+                    NUM_PUBLISHED + 1 == inner->numPublishedRecords());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `setPublishLatencyBudget`
+        //
+        // Concerns:
+        // 1. The inner observer is overloaded if its mean `publish` latency
+        //    exceeds the budget, and is not otherwise.
+        //
+        // 2. A budget of 0 disables the budget.
+        //
+        // Plan:
+        // 1. Publish records to an inner observer spinning for 200
+        //    microseconds, with a budget of 20 microseconds, evaluate, and
+        //    verify that the category is sampled.  Make the inner observer
+        //    fast, and verify that the category is no longer sampled after 4
+        //    evaluations.  (C-1)
+        //
+        // 2. Disable the budget, make the inner observer slow again, and
+        //    verify that the category is not sampled.  (C-2)
+        //
+        // Testing:
+        //   void setPublishLatencyBudget(const bsls::TimeInterval& budget);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `setPublishLatencyBudget`" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::shared_ptr<u::SlowObserver> inner =
+                           bsl::allocate_shared<u::SlowObserver>(&oa, 200000);
+
+            Obj mX(inner, &oa);  const Obj& X = mX;
+
+            mX.setEvaluationInterval(bsls::TimeInterval(3600, 0));
+            mX.setPublishLatencyBudget(bsls::TimeInterval(0, 20000));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 4, &oa);
+            mX.evaluate();
+            ASSERTV(X.samplingRatio("A"), 2 == X.samplingRatio("A"));
+
+            inner->setDelay(0);
+            for (int i = 0; i < 4; ++i) {
+                u::publish(&mX, "A", ball::Severity::e_INFO, 4, &oa);
+                ASSERTV(i, X.samplingRatio("A"), 2 == X.samplingRatio("A"));
+                mX.evaluate();
+            }
+            ASSERTV(X.samplingRatio("A"), 1 == X.samplingRatio("A"));
+
+            mX.setPublishLatencyBudget(bsls::TimeInterval());
+            inner->setDelay(200000);
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 4, &oa);
+            mX.evaluate();
+            ASSERTV(X.samplingRatio("A"), 1 == X.samplingRatio("A"));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::shared_ptr<u::SlowObserver> inner =
+                                bsl::allocate_shared<u::SlowObserver>(&oa, 0);
+
+            Obj mX(inner, &oa);
+
+            ASSERT_PASS(mX.setPublishLatencyBudget(bsls::TimeInterval()));
+            ASSERT_FAIL(mX.setPublishLatencyBudget(
+                                                 bsls::TimeInterval(0, -1)));
+            ASSERT_PASS(mX.setEvaluationInterval(bsls::TimeInterval(0, 1)));
+            ASSERT_FAIL(mX.setEvaluationInterval(bsls::TimeInterval()));
+            ASSERT_PASS(mX.setSummaryInterval(bsls::TimeInterval(0, 1)));
+            ASSERT_FAIL(mX.setSummaryInterval(bsls::TimeInterval()));
+            ASSERT_PASS(mX.setProtectedSeverity(255));
+            ASSERT_FAIL(mX.setProtectedSeverity(256));
+            ASSERT_FAIL(mX.setProtectedSeverity(-1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `evaluate`
+        //
+        // Concerns:
+        // 1. While the inner observer is not overloaded, no category is
+        //    sampled.
+        //
+        // 2. When the inner observer is overloaded, the sampling ratio of the
+        //    noisiest categories, accounting for at least half of the
+        //    records of the interval, is doubled, and the other categories
+        //    are not sampled.
+        //
+        // 3. A sampled category forwards one of every `N` records less severe
+        //    than the protected severity, and all the other records.
+        //
+        // 4. The sampling ratio is at most 1024.
+        //
+        // 5. After 4 consecutive intervals without overload, the sampling
+        //    ratios are halved.
+        //
+        // 6. The protected severity can be changed.
+        //
+        // Plan:
+        // 1. Publish records of three categories, evaluate without overload,
+        //    and verify that no category is sampled.  (C-1)
+        //
+        // 2. Publish 60, 30, and 10 records of three categories, evaluate
+        //    with an overload, and verify the sampling ratios.  (C-2)
+        //
+        // 3. Publish records of various severities, and verify the records
+        //    forwarded to the inner observer, and `numSuppressed`.  (C-3)
+        //
+        // 4. Evaluate repeatedly with an overload, and verify the maximal
+        //    sampling ratio.  Evaluate repeatedly without overload, and
+        //    verify that the ratios are halved every 4 evaluations.  (C-4..5)
+        //
+        // 5. Set the protected severity to `e_INFO`, and verify that records
+        //    of `e_INFO` severity are no longer suppressed.  (C-6)
+        //
+        // Testing:
+        //   void evaluate();
+        //   void setLoadProbe(const LoadProbe& loadProbe);
+        //   void setProtectedSeverity(int severity);
+        //   bsls::Types::Int64 numSuppressed() const;
+        //   int samplingRatio(const bsl::string_view& category) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `evaluate`" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::ostringstream output(&oa);
+
+            bsl::shared_ptr<ball::TestObserver> inner =
+                 bsl::allocate_shared<ball::TestObserver>(&oa, &output);
+
+            Obj  mX(inner, &oa);  const Obj& X = mX;
+            bool overloaded = false;
+
+            mX.setLoadProbe(u::FlagProbe(&overloaded));
+            mX.setEvaluationInterval(bsls::TimeInterval(3600, 0));
+            mX.setSummaryInterval(bsls::TimeInterval(3600, 0));
+
+            if (veryVerbose) cout << "\tNo overload." << endl;
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 60, &oa);
+            u::publish(&mX, "B", ball::Severity::e_INFO, 30, &oa);
+            u::publish(&mX, "C", ball::Severity::e_INFO, 10, &oa);
+            mX.evaluate();
+
+            ASSERTV(X.samplingRatio("A"), 1 == X.samplingRatio("A"));
+            ASSERTV(X.samplingRatio("B"), 1 == X.samplingRatio("B"));
+            ASSERTV(X.samplingRatio("C"), 1 == X.samplingRatio("C"));
+            ASSERT(100 == inner->numPublishedRecords());
+
+            if (veryVerbose) cout << "\tOverload." << endl;
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 30, &oa);
+            u::publish(&mX, "B", ball::Severity::e_INFO, 60, &oa);
+            u::publish(&mX, "C", ball::Severity::e_INFO, 10, &oa);
+
+            overloaded = true;
+            mX.evaluate();
+
+            ASSERTV(X.samplingRatio("A"), 1 == X.samplingRatio("A"));
+            ASSERTV(X.samplingRatio("B"), 2 == X.samplingRatio("B"));
+            ASSERTV(X.samplingRatio("C"), 1 == X.samplingRatio("C"));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 45, &oa);
+            u::publish(&mX, "B", ball::Severity::e_INFO, 45, &oa);
+            u::publish(&mX, "C", ball::Severity::e_INFO, 10, &oa);
+            mX.evaluate();
+
+            ASSERTV(X.samplingRatio("A"), 2 == X.samplingRatio("A"));
+            ASSERTV(X.samplingRatio("B"), 4 == X.samplingRatio("B"));
+            ASSERTV(X.samplingRatio("C"), 1 == X.samplingRatio("C"));
+            ASSERTV(X.samplingRatio("D"), 1 == X.samplingRatio("D"));
+
+            if (veryVerbose) cout << "\tSampling." << endl;
+
+            Int64 numPublished = inner->numPublishedRecords();
+            const Int64 SUPPRESSED = X.numSuppressed();
+
+            u::publish(&mX, "B", ball::Severity::e_INFO,  40, &oa);
+            u::publish(&mX, "B", ball::Severity::e_TRACE, 40, &oa);
+            ASSERTV(inner->numPublishedRecords() - numPublished,
+                    20 == inner->numPublishedRecords() - numPublished);
+            ASSERTV(X.numSuppressed() - SUPPRESSED,
+                    60 == X.numSuppressed() - SUPPRESSED);
+
+            numPublished = inner->numPublishedRecords();
+            u::publish(&mX, "B", ball::Severity::e_WARN,  10, &oa);
+            u::publish(&mX, "B", ball::Severity::e_ERROR, 10, &oa);
+            u::publish(&mX, "C", ball::Severity::e_INFO,  10, &oa);
+            ASSERTV(inner->numPublishedRecords() - numPublished,
+                    30 == inner->numPublishedRecords() - numPublished);
+
+            if (veryVerbose) cout << "\tMaximal ratio and recovery." << endl;
+
+            for (int i = 0; i < 20; ++i) {
+                u::publish(&mX, "B", ball::Severity::e_INFO, 10, &oa);
+                mX.evaluate();
+            }
+            ASSERTV(X.samplingRatio("B"), 1024 == X.samplingRatio("B"));
+
+            overloaded = false;
+            for (int i = 1; i <= 12; ++i) {
+                mX.evaluate();
+
+                const int EXP = 1024 >> (i / 4);
+                ASSERTV(i, X.samplingRatio("B"), EXP == X.samplingRatio("B"));
+            }
+
+            if (veryVerbose) cout << "\tProtected severity." << endl;
+
+            numPublished = inner->numPublishedRecords();
+            mX.setProtectedSeverity(ball::Severity::e_INFO);
+            u::publish(&mX, "B", ball::Severity::e_INFO,  10, &oa);
+            u::publish(&mX, "B", ball::Severity::e_DEBUG, 128, &oa);
+            ASSERTV(inner->numPublishedRecords() - numPublished,
+                    11 == inner->numPublishedRecords() - numPublished);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, `publish`, AND `releaseRecords`
+        //
+        // Concerns:
+        // 1. A newly created observer forwards every record, and its context,
+        //    to the inner observer.
+        //
+        // 2. `releaseRecords` is forwarded to the inner observer.
+        //
+        // 3. All memory is supplied by the object allocator, and released on
+        //    destruction.
+        //
+        // Plan:
+        // 1. Publish records of several categories and severities, and verify
+        //    the records received by a `ball::TestObserver`.  (C-1)
+        //
+        // 2. Call `releaseRecords`, and verify the number of releases of the
+        //    inner observer.  (C-2)
+        //
+        // 3. Use test allocators, and verify that the default allocator is
+        //    not used, and that no memory is leaked.  (C-3)
+        //
+        // Testing:
+        //   AdaptiveSamplingObserver(const shared_ptr<Observer>&, Alloc *);
+        //   ~AdaptiveSamplingObserver();
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, `publish`, AND `releaseRecords`" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::ostringstream output(&oa);
+
+            bsl::shared_ptr<ball::TestObserver> inner =
+                 bsl::allocate_shared<ball::TestObserver>(&oa, &output);
+
+            Obj mX(inner, &oa);  const Obj& X = mX;
+
+            static const char *const CATEGORIES[] = { "A", "B.C", "" };
+            static const int         SEVERITIES[] = {
+                ball::Severity::e_TRACE,
+                ball::Severity::e_INFO,
+                ball::Severity::e_FATAL
+            };
+
+            int numPublished = 0;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    Handle record = u::makeRecord(CATEGORIES[i],
+                                                  SEVERITIES[j],
+                                                  &oa);
+                    const ball::Context context(
+                                          ball::Transmission::e_TRIGGER, j, 3);
+
+                    mX.publish(record, context);
+                    ++numPublished;
+
+                    ASSERTV(i, j,
+                            numPublished == inner->numPublishedRecords());
+                    ASSERTV(i, j, record->fixedFields() ==
+                                   inner->lastPublishedRecord().fixedFields());
+                    ASSERTV(i, j, context == inner->lastPublishedContext());
+                    ASSERTV(i, j, 1 == X.samplingRatio(CATEGORIES[i]));
+                }
+            }
+            ASSERT(0 == X.numSuppressed());
+
+            ASSERT(0 == inner->numReleases());
+            mX.releaseRecords();
+            ASSERT(1 == inner->numReleases());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Publish records, evaluate with and without an overload, and
+        //    publish the summaries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            bsl::ostringstream output(&oa);
+
+            bsl::shared_ptr<ball::TestObserver> inner =
+                 bsl::allocate_shared<ball::TestObserver>(&oa, &output);
+
+            Obj  mX(inner, &oa);
+            bool overloaded = false;
+
+            mX.setLoadProbe(u::FlagProbe(&overloaded));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 10, &oa);
+            ASSERT(10 == inner->numPublishedRecords());
+
+            overloaded = true;
+            mX.evaluate();
+            ASSERT(2 == mX.samplingRatio("A"));
+
+            u::publish(&mX, "A", ball::Severity::e_INFO, 10, &oa);
+            ASSERT(15 == inner->numPublishedRecords());
+            ASSERT(5  == mX.numSuppressed());
+
+            mX.publishSummaries();
+            ASSERT(16 == inner->numPublishedRecords());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
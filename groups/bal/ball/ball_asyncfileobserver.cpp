@@ -11,10 +11,14 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
+#include <bdlf_placeholder.h>
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
 #include <bdls_processutil.h>
 #include <bdlt_currenttime.h>
 
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutexassert.h>
 #include <bslmt_threadattributes.h>
@@ -24,12 +28,21 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
 
 ///IMPLEMENTATION NOTES
 ///--------------------
 // To communicate the last record to be published when 'stopThread' (or
 // 'stopPublicationThread') is called, a special record is enqueued (created using
 // 'createStopRecord') for which 'isStopRecord' is 'false'.
+//
+// When per-thread record queues are in effect, the publication thread is
+// instead stopped through 'd_stopRequest', since no single queue can carry a
+// stop-record ordered after the records of all the threads.  Each per-thread
+// queue keeps the record it removed from its underlying single-producer,
+// single-consumer queue until that record is the oldest of the records at the
+// front of all the queues, which makes the publication order a merge of the
+// (already ordered) records of each thread.
 
 namespace BloombergLP {
 namespace ball {
@@ -38,9 +51,15 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_MERGE_BATCH_SIZE         = 1024   // maximum number of records published
+                                        // between checks of the stop request
 };
 
+static const char *const k_METRICS_TYPE_NAME = "ball.asyncfileobserver";
+
+static const char *const k_METRICS_TYPE_ABBREVIATION = "afo";
+
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
 
 static const char *const k_THREAD_NAME = "asyncobserver";
@@ -127,6 +146,79 @@ void setPublicationThreadAttributes(bslmt::ThreadAttributes *attributes)
     attributes->setThreadName(k_THREAD_NAME);
 }
 
+/// Register with the specified `registry`, into the specified `handle`, the
+/// specified `callback` collecting the metric having the specified
+/// `metricName`, the specified `instanceNumber`, and the specified
+/// `objectIdentifier`.
+void registerMetric(bdlm::MetricsRegistryRegistrationHandle *handle,
+                    bdlm::MetricsRegistry                   *registry,
+                    const char                              *metricName,
+                    bdlm::InstanceCount::Value               instanceNumber,
+                    const bsl::string_view&                  objectIdentifier,
+                    const bdlm::MetricsRegistry::Callback&   callback)
+{
+    bdlm::MetricDescriptor descriptor(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             metricName,
+             instanceNumber,
+             k_METRICS_TYPE_NAME,
+             k_METRICS_TYPE_ABBREVIATION,
+             objectIdentifier);
+
+    registry->registerCollectionCallback(handle, descriptor, callback);
+}
+
+/// Load into the specified `value` the number of records on the record
+/// queue of the specified `observer`.
+void observerBacklogMetric(bdlm::Metric            *value,
+                           const AsyncFileObserver *observer)
+{
+    *value = bdlm::Metric::Gauge(
+                           static_cast<double>(observer->recordQueueLength()));
+}
+
+/// Load into the specified `value` the number of records dropped by the
+/// specified `observer`.
+void observerDroppedMetric(bdlm::Metric            *value,
+                           const AsyncFileObserver *observer)
+{
+    *value = bdlm::Metric::Gauge(
+                           static_cast<double>(observer->numDroppedRecords()));
+}
+
+/// Load into the specified `value` the number of records whose publication
+/// to the specified `observer` blocked.
+void observerBlockedMetric(bdlm::Metric            *value,
+                           const AsyncFileObserver *observer)
+{
+    *value = bdlm::Metric::Gauge(
+                           static_cast<double>(observer->numBlockedRecords()));
+}
+
+/// Load into the specified `value` the number of records on the specified
+/// `queue`.
+void queueBacklogMetric(bdlm::Metric                        *value,
+                        const AsyncFileObserver_ThreadQueue *queue)
+{
+    *value = bdlm::Metric::Gauge(static_cast<double>(queue->numElements()));
+}
+
+/// Load into the specified `value` the number of records dropped by the
+/// specified `queue`.
+void queueDroppedMetric(bdlm::Metric                        *value,
+                        const AsyncFileObserver_ThreadQueue *queue)
+{
+    *value = bdlm::Metric::Gauge(static_cast<double>(queue->numDropped()));
+}
+
+/// Load into the specified `value` the number of records whose publication
+/// to the specified `queue` blocked.
+void queueBlockedMetric(bdlm::Metric                        *value,
+                        const AsyncFileObserver_ThreadQueue *queue)
+{
+    *value = bdlm::Metric::Gauge(static_cast<double>(queue->numBlocked()));
+}
+
         // stop-record functions
 
 /// Return a `AsyncFileObserver_Record` object for which `isStopRecord` will
@@ -151,14 +243,162 @@ bool isStopRecord(const AsyncFileObserver_Record& record)
 
 }  // close unnamed namespace
 
+                    // -----------------------------------
+                    // class AsyncFileObserver_ThreadQueue
+                    // -----------------------------------
+
+// CREATORS
+AsyncFileObserver_ThreadQueue::AsyncFileObserver_ThreadQueue(
+                                          bsl::size_t          capacity,
+                                          bsls::Types::Uint64  threadId,
+                                          bslma::Allocator    *basicAllocator)
+: d_queue(capacity, basicAllocator)
+, d_front()
+, d_hasFront(false)
+, d_limit(0)
+, d_isLimited(false)
+, d_numDropped(0)
+, d_numBlocked(0)
+, d_isReleased(false)
+, d_threadId(threadId)
+{
+}
+
+AsyncFileObserver_ThreadQueue::~AsyncFileObserver_ThreadQueue()
+{
+}
+
+// MANIPULATORS
+void AsyncFileObserver_ThreadQueue::registerMetrics(
+                               bdlm::MetricsRegistry      *metricsRegistry,
+                               bdlm::InstanceCount::Value  instanceNumber,
+                               const bsl::string_view&     observerName)
+{
+    BSLS_ASSERT(metricsRegistry);
+
+    bsl::ostringstream identifier(d_queue.allocator());
+    identifier << observerName << '.' << d_threadId;
+
+    registerMetric(&d_backlogHandle,
+                   metricsRegistry,
+                   "bde.backlog",
+                   instanceNumber,
+                   identifier.str(),
+                   bdlf::BindUtil::bind(&queueBacklogMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+
+    registerMetric(&d_droppedHandle,
+                   metricsRegistry,
+                   "bde.droppedrecords",
+                   instanceNumber,
+                   identifier.str(),
+                   bdlf::BindUtil::bind(&queueDroppedMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+
+    registerMetric(&d_blockedHandle,
+                   metricsRegistry,
+                   "bde.blockedrecords",
+                   instanceNumber,
+                   identifier.str(),
+                   bdlf::BindUtil::bind(&queueBlockedMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+}
+
+void AsyncFileObserver_ThreadQueue::removeAll()
+{
+    d_queue.removeAll();
+    d_front.d_record.reset();
+    d_hasFront  = false;
+    d_isLimited = false;
+}
+
+void AsyncFileObserver_ThreadQueue::setPublicationLimit(bool limit)
+{
+    d_isLimited = limit;
+    d_limit     = limit ? d_queue.numElements() : 0;
+}
+
                        // -----------------------
                        // class AsyncFileObserver
                        // -----------------------
 
+// PRIVATE CLASS METHODS
+void AsyncFileObserver::releaseThreadQueue(void *queue)
+{
+    static_cast<ThreadQueue *>(queue)->release();
+}
+
+// PRIVATE MANIPULATORS
+AsyncFileObserver::ThreadQueue *AsyncFileObserver::createThreadQueue()
+{
+    ThreadQueue *queue = new (*d_allocator_p) ThreadQueue(
+                                         d_maxRecordQueueSize,
+                                         bslmt::ThreadUtil::selfIdAsUint64(),
+                                         d_allocator_p);
+
+    bslma::RawDeleterProctor<ThreadQueue, bslma::Allocator> proctor(
+                                                                queue,
+                                                                d_allocator_p);
+    if (d_metricsRegistry_p) {
+        queue->registerMetrics(d_metricsRegistry_p,
+                               d_instanceNumber,
+                               d_observerName);
+    }
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+
+        d_threadQueues.push_back(queue);
+    }
+    proctor.release();
+
+    bslmt::ThreadUtil::setSpecific(d_threadQueueKey, queue);
+    return queue;
+}
+
+bsl::size_t AsyncFileObserver::publishMergedRecords(
+                                      const bsl::vector<ThreadQueue *>& queues)
+{
+    bsl::size_t numPublished = 0;
+
+    while (numPublished < k_MERGE_BATCH_SIZE) {
+        ThreadQueue *oldest = 0;
+
+        for (bsl::size_t i = 0; i < queues.size(); ++i) {
+            ThreadQueue *queue = queues[i];
+
+            if (queue->loadFront()
+             && (0 == oldest
+              || queue->front().d_record->fixedFields().timestamp() <
+                       oldest->front().d_record->fixedFields().timestamp())) {
+                oldest = queue;
+            }
+        }
+
+        if (0 == oldest) {
+            break;
+        }
+
+        d_fileObserver.publish(oldest->front().d_record,
+                               oldest->front().d_context);
+        oldest->popFront();
+        ++numPublished;
+    }
+    return numPublished;
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
 
+    if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        publishThreadQueues();
+        d_threadState = e_NOT_RUNNING;
+        return;                                                       // RETURN
+    }
+
     // The publication thread may either be 'e_RUNNING' (normal), or
     // 'e_SHUTTING_DOWN' (if a client called a method that stopped the
     // publication thread immediately after starting it, before this thread
@@ -218,6 +458,129 @@ void AsyncFileObserver::publishThreadEntryPoint()
     d_threadState = e_NOT_RUNNING;
 }
 
+void AsyncFileObserver::publishThreadQueues()
+{
+    bsl::vector<ThreadQueue *> queues(d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+
+    while (e_ABANDON != d_stopRequest) {
+        const bool  isDraining   = e_DRAIN == d_stopRequest;
+        bsl::size_t numPublished = 0;
+
+        queues = d_threadQueues;
+        {
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(
+                                                         &d_threadQueuesMutex);
+
+            if (isDraining) {
+                // Publish the records that are on the queues now, so that a
+                // thread that keeps logging cannot delay the stop forever.
+
+                for (bsl::size_t i = 0; i < queues.size(); ++i) {
+                    queues[i]->setPublicationLimit(true);
+                }
+                while (0 < publishMergedRecords(queues)) {
+                }
+                for (bsl::size_t i = 0; i < queues.size(); ++i) {
+                    queues[i]->setPublicationLimit(false);
+                }
+            }
+            else {
+                numPublished = publishMergedRecords(queues);
+            }
+
+            // As for the shared queue, publish the count of dropped records
+            // when the queues have been emptied, when a sufficient number of
+            // records have been dropped, or when stopping.
+
+            if (0 < d_dropCount.loadRelaxed()) {
+                if (0 == numPublished
+                ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
+                ||  isDraining) {
+                    int numDropped = d_dropCount.swap(0);
+                    if (0 < numDropped) {
+                        logDroppedMessageWarning(&d_fileObserver, numDropped);
+                    }
+                }
+            }
+        }
+
+        // Destroy the queues of the threads that have exited, once emptied.
+
+        for (bsl::size_t i = 0; i < d_threadQueues.size(); ) {
+            ThreadQueue *queue = d_threadQueues[i];
+            if (queue->isReleased() && queue->isEmpty()) {
+                d_threadQueues.erase(d_threadQueues.begin() + i);
+                d_allocator_p->deleteObject(queue);
+            }
+            else {
+                ++i;
+            }
+        }
+
+        if (isDraining) {
+            break;
+        }
+
+        if (0 == numPublished && e_CONTINUE == d_stopRequest) {
+            // Announce the wait before checking the queues a last time: a
+            // thread pushing a record after that check sees the flag and
+            // signals the condition, and one pushing it before has its
+            // record seen by the check (see `publish`).
+
+            d_isPublisherWaiting.store(true);
+
+            bool isEmpty = true;
+            for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+                if (!d_threadQueues[i]->isEmpty()) {
+                    isEmpty = false;
+                    break;
+                }
+            }
+            if (isEmpty) {
+                d_threadQueuesCondition.wait(&d_threadQueuesMutex);
+            }
+
+            d_isPublisherWaiting.store(false);
+        }
+    }
+}
+
+void AsyncFileObserver::registerMetrics()
+{
+    if (e_SHARED_QUEUE != d_recordQueueMode) {
+        return;                                                       // RETURN
+    }
+
+    registerMetric(&d_backlogHandle,
+                   d_metricsRegistry_p,
+                   "bde.backlog",
+                   d_instanceNumber,
+                   d_observerName,
+                   bdlf::BindUtil::bind(&observerBacklogMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+
+    registerMetric(&d_droppedHandle,
+                   d_metricsRegistry_p,
+                   "bde.droppedrecords",
+                   d_instanceNumber,
+                   d_observerName,
+                   bdlf::BindUtil::bind(&observerDroppedMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+
+    registerMetric(&d_blockedHandle,
+                   d_metricsRegistry_p,
+                   "bde.blockedrecords",
+                   d_instanceNumber,
+                   d_observerName,
+                   bdlf::BindUtil::bind(&observerBlockedMetric,
+                                        bdlf::PlaceHolders::_1,
+                                        this));
+}
+
 void AsyncFileObserver::construct()
 {
     d_threadHandle = bslmt::ThreadUtil::invalidHandle();
@@ -237,6 +600,14 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_recordQueueMode(e_SHARED_QUEUE)
+, d_maxRecordQueueSize(k_DEFAULT_FIXED_QUEUE_SIZE)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(0)
+, d_observerName(basicAllocator)
+, d_instanceNumber(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -248,6 +619,14 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_recordQueueMode(e_SHARED_QUEUE)
+, d_maxRecordQueueSize(k_DEFAULT_FIXED_QUEUE_SIZE)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(0)
+, d_observerName(basicAllocator)
+, d_instanceNumber(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -260,6 +639,14 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_recordQueueMode(e_SHARED_QUEUE)
+, d_maxRecordQueueSize(k_DEFAULT_FIXED_QUEUE_SIZE)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(0)
+, d_observerName(basicAllocator)
+, d_instanceNumber(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -273,6 +660,14 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_recordQueueMode(e_SHARED_QUEUE)
+, d_maxRecordQueueSize(maxRecordQueueSize)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(0)
+, d_observerName(basicAllocator)
+, d_instanceNumber(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -288,14 +683,70 @@ AsyncFileObserver::AsyncFileObserver(
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_recordQueueMode(e_SHARED_QUEUE)
+, d_maxRecordQueueSize(maxRecordQueueSize)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(0)
+, d_observerName(basicAllocator)
+, d_instanceNumber(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
 }
 
+AsyncFileObserver::AsyncFileObserver(
+                     Severity::Level          stdoutThreshold,
+                     bool                     publishInLocalTime,
+                     int                      maxRecordQueueSize,
+                     Severity::Level          dropRecordsOnFullQueueThreshold,
+                     RecordQueueMode          recordQueueMode,
+                     const bsl::string_view&  observerName,
+                     bdlm::MetricsRegistry   *metricsRegistry,
+                     bslma::Allocator        *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueue(e_SHARED_QUEUE == recordQueueMode ? maxRecordQueueSize : 1,
+                basicAllocator)
+, d_threadState(e_NOT_RUNNING)
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_recordQueueMode(recordQueueMode)
+, d_maxRecordQueueSize(maxRecordQueueSize)
+, d_threadQueues(basicAllocator)
+, d_stopRequest(e_CONTINUE)
+, d_isPublisherWaiting(false)
+, d_metricsRegistry_p(metricsRegistry
+                      ? metricsRegistry
+                      : &bdlm::MetricsRegistry::defaultInstance())
+, d_observerName(observerName, basicAllocator)
+, d_instanceNumber(
+                 bdlm::InstanceCount::nextInstanceNumber<AsyncFileObserver>())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+
+    construct();
+
+    if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        int rc = bslmt::ThreadUtil::createKey(&d_threadQueueKey,
+                                              &releaseThreadQueue);
+        BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+    }
+
+    registerMetrics();
+}
+
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
+
+    if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        bslmt::ThreadUtil::deleteKey(d_threadQueueKey);
+
+        for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+            d_allocator_p->deleteObject(d_threadQueues[i]);
+        }
+    }
 }
 
 // MANIPULATORS
@@ -304,24 +755,113 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
 {
     BSLS_ASSERT(record);
 
+    typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
+
     AsyncFileObserver_Record asyncRecord;
 
     asyncRecord.d_record  = record;
     asyncRecord.d_context = context;
 
-    int rc = (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold)
-      ? d_recordQueue.tryPushBack(asyncRecord)
-      : d_recordQueue.pushBack(asyncRecord);
+    // Records at least as severe as the threshold are not dropped: the
+    // calling thread blocks until there is room for them.
 
-    if (0 != rc) {
-      d_dropCount.addRelaxed(1);
+    const bool block = record->fixedFields().severity() <=
+                                             d_dropRecordsOnFullQueueThreshold;
+    int        rc;
+
+    if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        ThreadQueue *queue = static_cast<ThreadQueue *>(
+                         bslmt::ThreadUtil::getSpecific(d_threadQueueKey));
+        if (0 == queue) {
+            queue = createThreadQueue();
+        }
+
+        rc = queue->tryPushBack(asyncRecord);
+        if (0 != rc && block) {
+            d_numBlocked.addRelaxed(1);
+            rc = queue->pushBack(asyncRecord);
+        }
+        if (0 != rc) {
+            queue->incrementNumDropped();
+        }
+        else if (d_isPublisherWaiting.load()) {
+            // The publication thread is, or is about to be, waiting for a
+            // record.  Acquiring the mutex ensures that it is waiting, or
+            // has not yet checked the queues, when the condition is
+            // signaled.  This load being sequentially consistent, as is the
+            // store of the flag by the publication thread, one of the two
+            // threads sees the other's update.
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+            d_threadQueuesCondition.signal();
+        }
+    }
+    else {
+        rc = d_recordQueue.tryPushBack(asyncRecord);
+        if (Status::e_FULL == rc && block) {
+            d_numBlocked.addRelaxed(1);
+            rc = d_recordQueue.pushBack(asyncRecord);
+        }
     }
 
+    if (0 != rc) {
+        d_dropCount.addRelaxed(1);
+        d_numDropped.addRelaxed(1);
+    }
 }
 
 void AsyncFileObserver::releaseRecords()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        // Stop the publication thread (if any), so that this thread can
+        // empty the queues as their single consumer, then restart it.
+
+        const bool isRunning = isPublicationThreadRunning();
+        if (isRunning) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> queuesGuard(
+                                                         &d_threadQueuesMutex);
+                d_stopRequest = e_ABANDON;
+            }
+            d_threadQueuesCondition.broadcast();
+
+            int rc = bslmt::ThreadUtil::join(d_threadHandle);
+            d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+
+            if (0 != rc) {
+                logReleaseRecordsError(&d_fileObserver);
+                return;                                               // RETURN
+            }
+        }
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> queuesGuard(&d_threadQueuesMutex);
+
+            for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+                d_threadQueues[i]->removeAll();
+            }
+            d_stopRequest = e_CONTINUE;
+        }
+
+        if (isRunning) {
+            d_threadState = e_RUNNING;
+
+            bslmt::ThreadAttributes attr;
+            setPublicationThreadAttributes(&attr);
+            int rc = bslmt::ThreadUtil::create(&d_threadHandle,
+                                               attr,
+                                               d_publishThreadEntryPoint);
+            if (0 != rc) {
+                d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+                d_threadState  = e_NOT_RUNNING;
+                logReleaseRecordsError(&d_fileObserver);
+            }
+        }
+        return;                                                       // RETURN
+    }
+
     if (isPublicationThreadRunning()) {
         d_recordQueue.disablePopFront();
 
@@ -370,7 +910,17 @@ int AsyncFileObserver::shutdownPublicationThread()
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
         BSLS_ASSERT(e_RUNNING == d_threadState);
 
-        d_recordQueue.disablePopFront();
+        if (e_PER_THREAD_QUEUES == d_recordQueueMode) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> queuesGuard(
+                                                         &d_threadQueuesMutex);
+                d_stopRequest = e_ABANDON;
+            }
+            d_threadQueuesCondition.broadcast();
+        }
+        else {
+            d_recordQueue.disablePopFront();
+        }
 
         result = bslmt::ThreadUtil::join(d_threadHandle);
         d_threadHandle = bslmt::ThreadUtil::invalidHandle();
@@ -403,6 +953,10 @@ int AsyncFileObserver::startPublicationThread()
 
         d_threadState = e_RUNNING;
         d_recordQueue.enablePopFront();
+        {
+            bslmt::LockGuard<bslmt::Mutex> queuesGuard(&d_threadQueuesMutex);
+            d_stopRequest = e_CONTINUE;
+        }
 
         bslmt::ThreadAttributes attr;
         setPublicationThreadAttributes(&attr);
@@ -429,7 +983,20 @@ int AsyncFileObserver::stopPublicationThread()
 
 
     int result = 0;
-    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle
+     && e_PER_THREAD_QUEUES == d_recordQueueMode) {
+        BSLS_ASSERT(e_RUNNING == d_threadState);
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> queuesGuard(&d_threadQueuesMutex);
+            d_stopRequest = e_DRAIN;
+        }
+        d_threadQueuesCondition.broadcast();
+
+        result = bslmt::ThreadUtil::join(d_threadHandle);
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    }
+    else if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
         BSLS_ASSERT(e_RUNNING == d_threadState);
 
         AsyncFileObserver_Record asyncRecord = createStopRecord();
@@ -456,6 +1023,22 @@ int AsyncFileObserver::stopPublicationThread()
     return result;
 }
 
+// ACCESSORS
+bsl::size_t AsyncFileObserver::recordQueueLength() const
+{
+    if (e_SHARED_QUEUE == d_recordQueueMode) {
+        return d_recordQueue.numElements();                           // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+
+    bsl::size_t length = 0;
+    for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+        length += d_threadQueues[i]->numElements();
+    }
+    return length;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
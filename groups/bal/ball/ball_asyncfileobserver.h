@@ -10,6 +10,26 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  ball::AsyncFileObserver: observer that outputs logs to a file and `stdout`
 //
+//@METRICS:
+//
+// * `bde.backlog`
+//   > number of records on the record queue (of one thread, if per-thread
+//   > record queues are in effect)
+//
+// * `bde.droppedrecords`
+//   > number of records dropped because the record queue was full
+//
+// * `bde.blockedrecords`
+//   > number of records whose publication blocked because the record queue
+//   > was full
+//
+// Associated Metric Attributes:
+//  * object type name: "ball.asyncfileobserver"
+//  * object type abbreviation: "afo"
+//  * object identifier: the name supplied at construction, followed by "."
+//    and the thread ID of the publishing thread if per-thread record queues
+//    are in effect
+//
 //@SEE_ALSO: ball_record, ball_context, ball_observer, ball_fileobserver
 //
 //@DESCRIPTION: This component provides a concrete implementation of the
@@ -28,12 +48,16 @@ BSLS_IDENT("$Id: $")
 //           ( ball::AsyncFileObserver )
 //            `-----------------------'
 //                        |              ctor
+//                        |              disableCompression
 //                        |              disableFileLogging
+//                        |              disableGroupCommit
 //                        |              disablePublishInLocalTime
 //                        |              disableSizeRotation
 //                        |              disableStdoutLoggingPrefix
 //                        |              disableTimeIntervalRotation
+//                        |              enableCompression
 //                        |              enableFileLogging
+//                        |              enableGroupCommit
 //                        |              enableStdoutLoggingPrefix
 //                        |              enablePublishInLocalTime
 //                        |              forceRotation
@@ -47,12 +71,17 @@ BSLS_IDENT("$Id: $")
 //                        |              stopPublicationThread
 //                        |              suppressUniqueFileNameOnRotation
 //                        |              getLogFormat
+//                        |              isCompressionEnabled
 //                        |              isFileLoggingEnabled
+//                        |              isGroupCommitEnabled
 //                        |              isPublicationThreadRunning
 //                        |              isPublishInLocalTimeEnabled
 //                        |              isStdoutLoggingPrefixEnabled
 //                        |              isSuppressUniqueFileNameOnRotation
+//                        |              numBlockedRecords
+//                        |              numDroppedRecords
 //                        |              recordQueueLength
+//                        |              recordQueueMode
 //                        |              rotationLifetime
 //                        |              rotationSize
 //                        |              stdoutThreshold
@@ -90,6 +119,10 @@ BSLS_IDENT("$Id: $")
 // +-----------------------+---------------------------------+
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
+// |                       | recordQueueMode                 |
+// +-----------------------+---------------------------------+
+// | Metrics               | observerName                    |
+// |                       | metricsRegistry                 |
 // +-----------------------+---------------------------------+
 //
 // +-------------+------------------------------------+
@@ -125,6 +158,14 @@ BSLS_IDENT("$Id: $")
 // |             | rotationLifetime                   |
 // |             | isSuppressUniqueFileNameOnRotation |
 // +-------------+------------------------------------+
+// | Group       | enableGroupCommit                  |
+// | Commit      | disableGroupCommit                 |
+// |             | isGroupCommitEnabled               |
+// +-------------+------------------------------------+
+// | Log File    | enableCompression                  |
+// | Compression | disableCompression                 |
+// |             | isCompressionEnabled               |
+// +-------------+------------------------------------+
 // | Publication | startPublicationThread             |
 // | Thread      | stopPublicationThread              |
 // | Management  | shutdownPublicationThread          |
@@ -167,7 +208,49 @@ BSLS_IDENT("$Id: $")
 // periodically publishing a warning (i.e., an internally generated log record
 // with severity `e_WARN`) that reports the number of dropped records.  The
 // record count is reset to 0 after each such warning is published, so each
-// dropped record is counted only once.
+// dropped record is counted only once.  The total numbers of dropped records,
+// and of records whose publication blocked on a full queue, are returned by
+// `numDroppedRecords` and `numBlockedRecords`, respectively.
+//
+///Per-Thread Record Queues
+/// - - - - - - - - - - - -
+// By default, all the threads publishing to an async file observer push their
+// records onto a single record queue (`e_SHARED_QUEUE`).  When many threads
+// log at a high rate, the contention on that queue can become significant.
+// Supplying `e_PER_THREAD_QUEUES` for the `recordQueueMode` constructor
+// argument gives each publishing thread its own single-producer,
+// single-consumer record queue, created on the first call to `publish` from
+// that thread, so that threads never contend with each other when publishing.
+// Each of these queues has the `maxRecordQueueSize` supplied at construction,
+// and `dropRecordsOnFullQueueThreshold` applies to each of them as it does to
+// the shared queue.  The queue of a thread is destroyed once the thread has
+// exited and its records have been published.
+//
+// The publication thread merges the records of the per-thread queues in
+// timestamp order: each record it publishes is the oldest of the records at
+// the front of the queues.  Records are therefore published in timestamp
+// order unless a thread publishes a record older than one already published
+// (e.g., a record whose timestamp was set well before `publish` was called).
+// When all the queues are empty, the publication thread waits until a record
+// is published or the thread is stopped.  The thread publishing a record then
+// pays for signaling the publication thread, as it does with a shared queue.
+//
+// Note that each async file observer using per-thread queues allocates one
+// thread-specific storage key (see `bslmt::ThreadUtil::createKey`), of which
+// a process has a limited number.
+//
+///Metrics
+///-------
+// An async file observer created with the constructor taking an
+// `observerName` and a `metricsRegistry` registers the `bde.backlog`,
+// `bde.droppedrecords`, and `bde.blockedrecords` metrics (see {`@METRICS`})
+// with that registry (or with the default registry if `metricsRegistry` is
+// 0).  With a shared record queue, the metrics describe the observer, and are
+// identified by `observerName`.  With per-thread record queues, the metrics
+// describe the queue of each publishing thread, and are identified by
+// `observerName` followed by "." and the thread ID; they are registered when
+// the queue is created, and unregistered when it is destroyed.  Async file
+// observers created with the other constructors register no metrics.
 //
 ///Log Record Formatting
 ///---------------------
@@ -371,6 +454,20 @@ BSLS_IDENT("$Id: $")
 // the period is one day), then a unique name on each rotation is produced with
 // the (local) time at which file rotation occurred embedded in the filename.
 //
+///Log File Compression and Group Commit
+///-------------------------------------
+// An async file observer may be configured, by calling `enableGroupCommit`, to
+// write records to its log file in groups rather than one at a time, and, by
+// calling `enableCompression`, to compress the log files that it subsequently
+// opens.  These features are provided by the underlying `ball::FileObserver2`
+// (see {`ball_fileobserver2`|Group Commit} and {`ball_fileobserver2`|Log File
+// Compression}).  Records are formatted, and compressed, by the publication
+// thread (or, for records pending for the `maxLatency` supplied to
+// `enableGroupCommit`, by a thread owned by the underlying file observer), so
+// that neither feature adds to the cost of `publish` for the threads that log
+// records.  Compression should be combined with group commit, so that groups
+// of records, rather than single records, are compressed.
+//
 ///Thread Safety
 ///-------------
 // All public methods of `ball::AsyncFileObserver` are thread-safe, and can be
@@ -513,6 +610,10 @@ BSLS_IDENT("$Id: $")
 #include <ball_severity.h>
 
 #include <bdlcc_boundedqueue.h>
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metricsregistry.h>
 
 #include <bdlt_datetimeinterval.h>
 
@@ -520,15 +621,23 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
 
 #include <string>                  // 'std::string', 'std::pmr::string'
 
@@ -548,6 +657,166 @@ struct AsyncFileObserver_Record {
     Context                       d_context;  // context of log record
 };
 
+                    // ===================================
+                    // class AsyncFileObserver_ThreadQueue
+                    // ===================================
+
+/// PRIVATE CLASS.  For use by the `ball::AsyncFileObserver` implementation
+/// only.  This class holds the record queue of one publishing thread when
+/// per-thread record queues are in effect, the record at the front of that
+/// queue being merged by the publication thread, and the drop and
+/// backpressure statistics of the publishing thread.  The
+/// `incrementNumDropped`, `pushBack`, and `tryPushBack` manipulators may be
+/// called only by the publishing thread, and the
+/// `loadFront`, `popFront`, `removeAll`, and `setPublicationLimit`
+/// manipulators, and the `front` and `isEmpty` accessors, only by the single
+/// thread consuming the records.
+class AsyncFileObserver_ThreadQueue {
+
+    // PRIVATE TYPES
+    typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<
+                                             AsyncFileObserver_Record> Queue;
+
+    // DATA
+    Queue                    d_queue;           // records of the thread
+
+    AsyncFileObserver_Record d_front;           // record removed from
+                                                // `d_queue`, not yet
+                                                // published
+
+    bool                     d_hasFront;        // `true` if `d_front` holds
+                                                // a record
+
+    bsl::size_t              d_limit;           // maximum number of records
+                                                // `loadFront` may remove
+                                                // from `d_queue`, if
+                                                // `d_isLimited`
+
+    bool                     d_isLimited;       // `true` if `d_limit` is in
+                                                // effect
+
+    bsls::AtomicUint64       d_numDropped;      // number of dropped records
+
+    bsls::AtomicUint64       d_numBlocked;      // number of records whose
+                                                // publication blocked
+
+    bsls::AtomicBool         d_isReleased;      // `true` if the thread has
+                                                // exited
+
+    bsls::Types::Uint64      d_threadId;        // ID of the thread
+
+    bdlm::MetricsRegistryRegistrationHandle
+                             d_backlogHandle;   // `bde.backlog` metric
+
+    bdlm::MetricsRegistryRegistrationHandle
+                             d_droppedHandle;   // `bde.droppedrecords`
+                                                // metric
+
+    bdlm::MetricsRegistryRegistrationHandle
+                             d_blockedHandle;   // `bde.blockedrecords`
+                                                // metric
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileObserver_ThreadQueue(const AsyncFileObserver_ThreadQueue&);
+    AsyncFileObserver_ThreadQueue& operator=(
+                                         const AsyncFileObserver_ThreadQueue&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileObserver_ThreadQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a queue of records of the thread having the specified
+    /// `threadId`, holding at least the specified `capacity` records.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    AsyncFileObserver_ThreadQueue(bsl::size_t          capacity,
+                                  bsls::Types::Uint64  threadId,
+                                  bslma::Allocator    *basicAllocator = 0);
+
+    /// Destroy this object, unregistering its metrics (if any).
+    ~AsyncFileObserver_ThreadQueue();
+
+    // MANIPULATORS
+
+    /// Increment the number of records dropped because this queue was full.
+    void incrementNumDropped();
+
+    /// Return `true` if a record is at the front of this queue, after
+    /// removing the next record from the underlying queue if there was none
+    /// and the publication limit (if any) allows it, and `false`
+    /// otherwise.
+    bool loadFront();
+
+    /// Discard the record at the front of this queue.  The behavior is
+    /// undefined unless `loadFront` returned `true` since the last call to
+    /// this method.
+    void popFront();
+
+    /// Append the specified `record` to this queue, blocking until the
+    /// queue is not full, and increment the number of records whose
+    /// publication blocked.  Return 0 on success, and a non-zero value
+    /// otherwise.  Note that this method is intended to be called after
+    /// `tryPushBack` failed.
+    int pushBack(const AsyncFileObserver_Record& record);
+
+    /// Register the `bde.backlog`, `bde.droppedrecords`, and
+    /// `bde.blockedrecords` metrics of this queue with the specified
+    /// `metricsRegistry`, having the specified `instanceNumber`, and
+    /// identified by the specified `observerName` followed by "." and the
+    /// ID of the thread.
+    void registerMetrics(bdlm::MetricsRegistry      *metricsRegistry,
+                         bdlm::InstanceCount::Value  instanceNumber,
+                         const bsl::string_view&     observerName);
+
+    /// Indicate that the thread of this queue has exited.
+    void release();
+
+    /// Discard all the records of this queue, including the one at its
+    /// front, and remove the publication limit (if any).
+    void removeAll();
+
+    /// Append the specified `record` to this queue if it is not full.
+    /// Return 0 on success, and a non-zero value if the queue is full.
+    int tryPushBack(const AsyncFileObserver_Record& record);
+
+    /// Limit the records that `loadFront` may remove from the underlying
+    /// queue to those on it at the time of this call if the specified
+    /// `limit` is `true`, and remove that limit otherwise.
+    void setPublicationLimit(bool limit);
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the record at
+    /// the front of this queue.  The behavior is undefined unless
+    /// `loadFront` returned `true` since the last call to `popFront`.
+    const AsyncFileObserver_Record& front() const;
+
+    /// Return `true` if this queue holds no record, and `false` otherwise.
+    bool isEmpty() const;
+
+    /// Return `true` if `release` was called, and `false` otherwise.
+    bool isReleased() const;
+
+    /// Return the number of records whose publication blocked because this
+    /// queue was full.
+    bsls::Types::Uint64 numBlocked() const;
+
+    /// Return the number of records dropped because this queue was full.
+    bsls::Types::Uint64 numDropped() const;
+
+    /// Return the number of records on the underlying queue.  Note that the
+    /// record at the front of this queue, if any, is not counted.
+    bsl::size_t numElements() const;
+
+    /// Return the ID of the thread of this queue.
+    bsls::Types::Uint64 threadId() const;
+};
+
                           // =======================
                           // class AsyncFileObserver
                           // =======================
@@ -569,6 +838,19 @@ class AsyncFileObserver : public Observer {
         e_NOT_RUNNING     // the publication thread is not running
     };
 
+    /// Request to the publication thread, as captured by `d_stopRequest`,
+    /// when per-thread record queues are in effect.
+    enum StopRequest {
+
+        e_CONTINUE,       // keep publishing records
+
+        e_DRAIN,          // publish the queued records, then stop
+
+        e_ABANDON         // stop without publishing the queued records
+    };
+
+    typedef AsyncFileObserver_ThreadQueue ThreadQueue;
+
     // DATA
     FileObserver                   d_fileObserver;   // forward most public
                                                      // method calls to this
@@ -605,6 +887,76 @@ class AsyncFileObserver : public Observer {
 
     mutable bslmt::Mutex           d_mutex;          // serialize operations
 
+    int                            d_recordQueueMode;
+                                                     // one of the values of
+                                                     // `RecordQueueMode`
+
+    int                            d_maxRecordQueueSize;
+                                                     // capacity of each
+                                                     // per-thread queue
+
+    bslmt::ThreadUtil::Key         d_threadQueueKey; // key of the per-thread
+                                                     // queue of the calling
+                                                     // thread (if per-thread
+                                                     // queues are in effect)
+
+    bsl::vector<ThreadQueue *>     d_threadQueues;   // per-thread queues
+                                                     // (owned)
+
+    int                            d_stopRequest;    // one of the values of
+                                                     // `StopRequest`
+
+    mutable bslmt::Mutex           d_threadQueuesMutex;
+                                                     // guard
+                                                     // `d_threadQueues` and
+                                                     // `d_stopRequest`
+
+    bslmt::Condition               d_threadQueuesCondition;
+                                                     // signaled on change of
+                                                     // `d_stopRequest`, and
+                                                     // on a push to a
+                                                     // per-thread queue while
+                                                     // `d_isPublisherWaiting`
+
+    bsls::AtomicBool               d_isPublisherWaiting;
+                                                     // `true` if the
+                                                     // publication thread is
+                                                     // waiting, or about to
+                                                     // wait, for a record on
+                                                     // the per-thread queues
+
+    bsls::AtomicUint64             d_numDropped;     // total number of dropped
+                                                     // records
+
+    bsls::AtomicUint64             d_numBlocked;     // total number of records
+                                                     // whose publication
+                                                     // blocked
+
+    bdlm::MetricsRegistry         *d_metricsRegistry_p;
+                                                     // registry of the
+                                                     // metrics, or 0 if none
+                                                     // (held, not owned)
+
+    bsl::string                    d_observerName;   // identifier of the
+                                                     // metrics
+
+    bdlm::InstanceCount::Value     d_instanceNumber; // instance number of the
+                                                     // metrics
+
+    bdlm::MetricsRegistryRegistrationHandle
+                                   d_backlogHandle;  // `bde.backlog` metric
+                                                     // (shared queue only)
+
+    bdlm::MetricsRegistryRegistrationHandle
+                                   d_droppedHandle;  // `bde.droppedrecords`
+                                                     // metric (shared queue
+                                                     // only)
+
+    bdlm::MetricsRegistryRegistrationHandle
+                                   d_blockedHandle;  // `bde.blockedrecords`
+                                                     // metric (shared queue
+                                                     // only)
+
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
                                                      // not owned)
 
@@ -613,6 +965,13 @@ class AsyncFileObserver : public Observer {
     AsyncFileObserver(const AsyncFileObserver&);
     AsyncFileObserver& operator=(const AsyncFileObserver&);
 
+    // PRIVATE CLASS METHODS
+
+    /// Indicate that the thread owning the specified `queue` has exited.
+    /// Note that this function is the destructor of the thread-specific
+    /// storage key of the per-thread queues.
+    static void releaseThreadQueue(void *queue);
+
     // PRIVATE MANIPULATORS
 
     /// Initialize members of this object that do not vary between
@@ -620,6 +979,18 @@ class AsyncFileObserver : public Observer {
     /// C++11 constructor chaining is available on all supported platforms.
     void construct();
 
+    /// Create the per-thread queue of the calling thread, register its
+    /// metrics (if any), and return its address.
+    ThreadQueue *createThreadQueue();
+
+    /// Publish, in timestamp order, the records of the specified `queues`,
+    /// until they are empty (or have reached their publication limit), or
+    /// a number of records, fixed for this implementation, has been
+    /// published.  Return the number of published records.  The behavior
+    /// is undefined unless this method is invoked by the publication
+    /// thread.
+    bsl::size_t publishMergedRecords(const bsl::vector<ThreadQueue *>& queues);
+
     /// Publish records from the record queue, to the log file and `stdout`,
     /// until signaled to stop.  The behavior is undefined if this method is
     /// invoked concurrently from multiple threads, i.e., it is *not*
@@ -627,6 +998,17 @@ class AsyncFileObserver : public Observer {
     /// publication thread.
     void publishThreadEntryPoint();
 
+    /// Publish records from the per-thread queues, to the log file and
+    /// `stdout`, until signaled to stop, destroying the queues of the
+    /// threads that have exited once they are empty.  The behavior is
+    /// undefined unless this method is invoked by the publication thread.
+    void publishThreadQueues();
+
+    /// Register the `bde.backlog`, `bde.droppedrecords`, and
+    /// `bde.blockedrecords` metrics of this observer with
+    /// `d_metricsRegistry_p` if a shared record queue is in effect.
+    void registerMetrics();
+
   public:
     // TYPES
 
@@ -643,6 +1025,15 @@ class AsyncFileObserver : public Observer {
     /// ```
     typedef FileObserver::OnFileRotationCallback OnFileRotationCallback;
 
+    /// Enumeration of the ways the records received by `publish` are queued
+    /// for the publication thread (see {Per-Thread Record Queues}).
+    enum RecordQueueMode {
+
+        e_SHARED_QUEUE,       // one queue shared by all publishing threads
+
+        e_PER_THREAD_QUEUES   // one queue for each publishing thread
+    };
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileObserver,
                                    bslma::UsesBslmaAllocator);
@@ -718,6 +1109,39 @@ class AsyncFileObserver : public Observer {
                       Severity::Level   dropRecordsOnFullQueueThreshold,
                       bslma::Allocator *basicAllocator = 0);
 
+    /// Create an async file observer that asynchronously publishes log
+    /// records to `stdout` if their severity is at least as severe as the
+    /// specified `stdoutThreshold` level, and has file logging initially
+    /// disabled.  The timestamp attribute of published records is written
+    /// in local time if the specified `publishInLocalTime` flag is `true`,
+    /// and in UTC time otherwise.  Records received by the `publish` method
+    /// are appended to a queue having the specified (fixed)
+    /// `maxRecordQueueSize`, shared by all publishing threads if the
+    /// specified `recordQueueMode` is `e_SHARED_QUEUE`, and owned by the
+    /// publishing thread if it is `e_PER_THREAD_QUEUES`, and published
+    /// later by an independent publication thread.  Records received whose
+    /// severity is less severe than the specified
+    /// `dropRecordsOnFullQueueThreshold` are discarded if the queue is
+    /// full; the others block the calling thread until space is available.
+    /// (See {Log Record Queue} for further information.)  Register the
+    /// metrics of this observer, identified by the specified
+    /// `observerName`, with the specified `metricsRegistry` (see
+    /// {Metrics}).  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::defaultInstance()` is used.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < maxRecordQueueSize`.
+    /// Note that independent default record formats are in effect for
+    /// `stdout` and file logging (see `setLogFormat`).
+    AsyncFileObserver(Severity::Level          stdoutThreshold,
+                      bool                     publishInLocalTime,
+                      int                      maxRecordQueueSize,
+                      Severity::Level          dropRecordsOnFullQueueThreshold,
+                      RecordQueueMode          recordQueueMode,
+                      const bsl::string_view&  observerName,
+                      bdlm::MetricsRegistry   *metricsRegistry,
+                      bslma::Allocator        *basicAllocator = 0);
+
     /// Publish all records that were on the record queue upon entry if a
     /// publication thread is running, stop the publication thread (if any),
     /// close the log file if file logging is enabled, and destroy this
@@ -726,6 +1150,12 @@ class AsyncFileObserver : public Observer {
 
     // MANIPULATORS
 
+    /// Disable compression of the log files subsequently opened by this async
+    /// file observer.  Note that the current log file, if any, remains
+    /// compressed until it is closed or rotated.  See {Log File
+    /// Compression and Group Commit}.
+    void disableCompression();
+
     /// Disable file logging for this async file observer.  This method has
     /// no effect if file logging is not enabled.  Calling this method will
     /// prevent the logging to a file of any unpublished records held by
@@ -734,6 +1164,13 @@ class AsyncFileObserver : public Observer {
     /// may still be logged to `stdout` after calling this method.
     void disableFileLogging();
 
+    /// Disable group commit for this async file observer, first writing any
+    /// pending records to the log file.  This method has no effect if group
+    /// commit is not enabled.  The behavior is undefined if this method is
+    /// called concurrently with `enableGroupCommit`.  See {Log File
+    /// Compression and Group Commit}.
+    void disableGroupCommit();
+
     /// Disable publishing of the timestamp attribute of records in local
     /// time by this async file observer; henceforth, timestamps will be in
     /// UTC time.  This method has no effect if publishing in local time is
@@ -764,6 +1201,13 @@ class AsyncFileObserver : public Observer {
     /// rotation-on-time-interval is not enabled.
     void disableTimeIntervalRotation();
 
+    /// Enable compression of the log files subsequently opened by this async
+    /// file observer, i.e., the log file opened by the next successful call to
+    /// `enableFileLogging` or by the next rotation.  Note that the current log
+    /// file, if any, remains uncompressed until it is closed or rotated.  See
+    /// {Log File Compression and Group Commit}.
+    void enableCompression();
+
     /// Enable logging of all records published to this async file observer
     /// to a file whose name is derived from the specified
     /// `logFilenamePattern`.  Return 0 on success, a positive value if file
@@ -792,6 +1236,21 @@ class AsyncFileObserver : public Observer {
     /// to `stdout`.
     int enableFileLogging(const char *logFilenamePattern);
 
+    /// Enable group commit for this async file observer: records are formatted
+    /// into memory and written to the log file in groups, once the pending
+    /// records amount to the specified `maxPendingBytes`, or once the oldest
+    /// of them has been pending for the specified `maxLatency` if `maxLatency`
+    /// is not 0.  Optionally specify a `syncInterval` indicating the number of
+    /// group writes after which the log file data is flushed to the storage
+    /// device (never, if 0 or not specified). Return 0 on success, a positive
+    /// value if group commit is already enabled (with no effect), and a
+    /// negative value otherwise.  The behavior is undefined unless `0 <
+    /// maxPendingBytes`, `bsls::TimeInterval() <= maxLatency`, and `0 <=
+    /// syncInterval`.  See {Log File Compression and Group Commit}.
+    int enableGroupCommit(int                       maxPendingBytes,
+                          const bsls::TimeInterval& maxLatency,
+                          int                       syncInterval = 0);
+
     /// Enable this async file observer to use the long output format when
     /// logging to `stdout`.  Henceforth, this async file observer will use
     /// the output format for `stdout` logging that was set by the most
@@ -942,6 +1401,10 @@ class AsyncFileObserver : public Observer {
     void getLogFormat(const char **logFileFormat,
                       const char **stdoutFormat) const;
 
+    /// Return `true` if compression is enabled for the log files subsequently
+    /// opened by this async file observer, and `false` otherwise.
+    bool isCompressionEnabled() const;
+
     /// Return `true` if file logging is enabled for this async file
     /// observer, and `false` otherwise.  Load the optionally specified
     /// `result` with the name of the current log file if file logging is
@@ -952,6 +1415,10 @@ class AsyncFileObserver : public Observer {
     bool isFileLoggingEnabled(bsl::string *result) const;
     bool isFileLoggingEnabled(std::string *result) const;
 
+    /// Return `true` if group commit is enabled for this async file observer,
+    /// and `false` otherwise.
+    bool isGroupCommitEnabled() const;
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
     /// Return `true` if file logging is enabled for this async file
     /// observer, and `false` otherwise.  Load the specified `result` with
@@ -1003,10 +1470,27 @@ class AsyncFileObserver : public Observer {
     bdlt::DatetimeInterval localTimeOffset() const;
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    /// Return the number of records whose publication blocked because the
+    /// record queue was full, since the construction of this async file
+    /// observer.
+    bsls::Types::Uint64 numBlockedRecords() const;
+
+    /// Return the number of records dropped because the record queue was
+    /// full, since the construction of this async file observer.  Note
+    /// that, unlike the count reported by the dropped-records warning, this
+    /// number is not reset when the warning is published.
+    bsls::Types::Uint64 numDroppedRecords() const;
+
     /// Return the number of log records currently on the record queue of
-    /// this async file observer.
+    /// this async file observer.  If per-thread record queues are in
+    /// effect, return the total number of records on the queues, excluding
+    /// the records being merged by the publication thread.
     bsl::size_t recordQueueLength() const;
 
+    /// Return the way the records received by `publish` are queued by this
+    /// async file observer.
+    RecordQueueMode recordQueueMode() const;
+
     /// Return the log file lifetime that will trigger a file rotation by
     /// this async file observer if rotation-on-lifetime is in effect, and a
     /// 0 time interval otherwise.
@@ -1028,17 +1512,139 @@ class AsyncFileObserver : public Observer {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                    // -----------------------------------
+                    // class AsyncFileObserver_ThreadQueue
+                    // -----------------------------------
+
+// MANIPULATORS
+inline
+void AsyncFileObserver_ThreadQueue::incrementNumDropped()
+{
+    d_numDropped.addRelaxed(1);
+}
+
+inline
+bool AsyncFileObserver_ThreadQueue::loadFront()
+{
+    if (d_hasFront) {
+        return true;                                                  // RETURN
+    }
+
+    if (d_isLimited) {
+        if (0 == d_limit) {
+            return false;                                             // RETURN
+        }
+        if (0 != d_queue.tryPopFront(&d_front)) {
+            return false;                                             // RETURN
+        }
+        --d_limit;
+    }
+    else if (0 != d_queue.tryPopFront(&d_front)) {
+        return false;                                                 // RETURN
+    }
+
+    d_hasFront = true;
+    return true;
+}
+
+inline
+void AsyncFileObserver_ThreadQueue::popFront()
+{
+    BSLS_ASSERT(d_hasFront);
+
+    d_front.d_record.reset();
+    d_hasFront = false;
+}
+
+inline
+int AsyncFileObserver_ThreadQueue::pushBack(
+                                        const AsyncFileObserver_Record& record)
+{
+    d_numBlocked.addRelaxed(1);
+    return d_queue.pushBack(record);
+}
+
+inline
+void AsyncFileObserver_ThreadQueue::release()
+{
+    d_isReleased.store(true);
+}
+
+inline
+int AsyncFileObserver_ThreadQueue::tryPushBack(
+                                        const AsyncFileObserver_Record& record)
+{
+    return d_queue.tryPushBack(record);
+}
+
+// ACCESSORS
+inline
+const AsyncFileObserver_Record& AsyncFileObserver_ThreadQueue::front() const
+{
+    BSLS_ASSERT(d_hasFront);
+
+    return d_front;
+}
+
+inline
+bool AsyncFileObserver_ThreadQueue::isEmpty() const
+{
+    return !d_hasFront && d_queue.isEmpty();
+}
+
+inline
+bool AsyncFileObserver_ThreadQueue::isReleased() const
+{
+    return d_isReleased.load();
+}
+
+inline
+bsls::Types::Uint64 AsyncFileObserver_ThreadQueue::numBlocked() const
+{
+    return d_numBlocked.loadRelaxed();
+}
+
+inline
+bsls::Types::Uint64 AsyncFileObserver_ThreadQueue::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline
+bsl::size_t AsyncFileObserver_ThreadQueue::numElements() const
+{
+    return d_queue.numElements();
+}
+
+inline
+bsls::Types::Uint64 AsyncFileObserver_ThreadQueue::threadId() const
+{
+    return d_threadId;
+}
+
                           // -----------------------
                           // class AsyncFileObserver
                           // -----------------------
 
 // MANIPULATORS
+inline
+void AsyncFileObserver::disableCompression()
+{
+    d_fileObserver.disableCompression();
+}
+
 inline
 void AsyncFileObserver::disableFileLogging()
 {
     d_fileObserver.disableFileLogging();
 }
 
+inline
+void AsyncFileObserver::disableGroupCommit()
+{
+    d_fileObserver.disableGroupCommit();
+}
+
 inline
 void AsyncFileObserver::disablePublishInLocalTime()
 {
@@ -1063,12 +1669,29 @@ void AsyncFileObserver::disableTimeIntervalRotation()
     d_fileObserver.disableTimeIntervalRotation();
 }
 
+inline
+void AsyncFileObserver::enableCompression()
+{
+    d_fileObserver.enableCompression();
+}
+
 inline
 int AsyncFileObserver::enableFileLogging(const char *logFilenamePattern)
 {
     return d_fileObserver.enableFileLogging(logFilenamePattern);
 }
 
+inline
+int AsyncFileObserver::enableGroupCommit(
+                                   int                       maxPendingBytes,
+                                   const bsls::TimeInterval& maxLatency,
+                                   int                       syncInterval)
+{
+    return d_fileObserver.enableGroupCommit(maxPendingBytes,
+                                            maxLatency,
+                                            syncInterval);
+}
+
 inline
 void AsyncFileObserver::enablePublishInLocalTime()
 {
@@ -1142,6 +1765,12 @@ void AsyncFileObserver::getLogFormat(const char **logFileFormat,
     d_fileObserver.getLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+bool AsyncFileObserver::isCompressionEnabled() const
+{
+    return d_fileObserver.isCompressionEnabled();
+}
+
 inline
 bool AsyncFileObserver::isFileLoggingEnabled() const
 {
@@ -1168,6 +1797,12 @@ bool AsyncFileObserver::isFileLoggingEnabled(std::pmr::string *result) const
 }
 #endif  // BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+inline
+bool AsyncFileObserver::isGroupCommitEnabled() const
+{
+    return d_fileObserver.isGroupCommitEnabled();
+}
+
 inline
 bool AsyncFileObserver::isPublicationThreadRunning() const
 {
@@ -1207,9 +1842,21 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
 inline
-bsl::size_t AsyncFileObserver::recordQueueLength() const
+bsls::Types::Uint64 AsyncFileObserver::numBlockedRecords() const
+{
+    return d_numBlocked.loadRelaxed();
+}
+
+inline
+bsls::Types::Uint64 AsyncFileObserver::numDroppedRecords() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline
+AsyncFileObserver::RecordQueueMode AsyncFileObserver::recordQueueMode() const
 {
-    return d_recordQueue.numElements();
+    return static_cast<RecordQueueMode>(d_recordQueueMode);
 }
 
 inline
@@ -2,11 +2,16 @@
 #include <ball_asyncfileobserver.h>
 
 #include <ball_log.h>
+#include <ball_logfilecompressionutil.h>
 #include <ball_loggermanager.h>
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_streamobserver.h>
 
 #include <bdlf_bind.h>
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
+#include <bdlm_metricsadapter.h>
+#include <bdlm_metricsregistry.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
 #include <bdls_processutil.h>
@@ -32,9 +37,12 @@
 
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
+#include <bsls_keyword.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
@@ -46,10 +54,13 @@
 #include <bsl_cstdio.h>      // `remove`
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_fstream.h>
 #include <bsl_ctime.h>       // `time_t`
 #include <bsl_iomanip.h>     // `setfill`
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // `unsetenv`
 
@@ -95,15 +106,20 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [15] AsyncFileObserver(Sev, bool, int, Sev, Mode, sv, Registry *, Alloc *);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
+// [16] void disableCompression();
 // [ 1] void disableFileLogging();
+// [16] void disableGroupCommit();
 // [ X] void disablePublishInLocalTime();
 // [ 6] void disableSizeRotation();
 // [ 1] void disableStdoutLoggingPrefix();
 // [ 6] void disableTimeIntervalRotation();
+// [16] void enableCompression();
 // [ 1] int enableFileLogging(const char *logFilenamePattern);
+// [16] int enableGroupCommit(int, const TimeInterval&, int);
 // [ 1] void enableStdoutLoggingPrefix();
 // [ 1] void enablePublishInLocalTime();
 // [ 6] void forceRotation();
@@ -123,13 +139,18 @@ using bsl::flush;
 //
 // ACCESSORS
 // [ 1] void getLogFormat(const char** logF, const char** stdoutF) const;
+// [16] bool isCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
+// [16] bool isGroupCommitEnabled() const;
 // [ 3] bool isPublicationThreadRunning() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [15] Uint64 numBlockedRecords() const;
+// [15] Uint64 numDroppedRecords() const;
 // [11] int recordQueueLength() const;
+// [15] RecordQueueMode recordQueueMode() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
@@ -141,7 +162,9 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [14] USAGE EXAMPLE
+// [15] CONCERN: PER-THREAD RECORD QUEUES
+// [16] CONCERN: COMPRESSION AND GROUP COMMIT
+// [17] USAGE EXAMPLE
 
 // Note assert and debug macros all output to `cerr` instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -372,6 +395,20 @@ bsl::string readPartialFile(bsl::string& fileName, Offset startOffset)
     return result;
 }
 
+/// Load, into the specified `text`, the text decompressed from the
+/// compressed log file with the specified `fileName`, and return the status
+/// returned by `ball::LogFileCompressionUtil::decompress`.
+int decompressFile(bsl::string *text, const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    bsl::ostringstream output;
+    const int rc = ball::LogFileCompressionUtil::decompress(output, fs);
+    *text = output.str();
+    return rc;
+}
+
 /// Return the number of log records in a file with the specified
 /// `fileName`.
 int countLoggedRecords(const bsl::string& fileName)
@@ -659,6 +696,165 @@ void releaser(ball::AsyncFileObserver *observer,
 
 }  // close namespace BALL_ASYNCFILEOBSERVER_RELEASERECORDS_TEST
 
+namespace BALL_ASYNCFILEOBSERVER_PER_THREAD_QUEUES_TEST {
+
+                          // ========================
+                          // class TestMetricsAdapter
+                          // ========================
+
+/// This class implements a metrics adapter that records the registered
+/// descriptors and callbacks, so that the tests can invoke the callbacks.
+class TestMetricsAdapter : public bdlm::MetricsAdapter {
+
+    // DATA
+    bsl::vector<bdlm::MetricDescriptor> d_descriptors;
+    bsl::vector<Callback>               d_callbacks;
+    bsl::vector<int>                    d_handles;
+    mutable bslmt::Mutex                d_mutex;
+
+  public:
+    // CREATORS
+
+    /// Create a `TestMetricsAdapter` using the specified `basicAllocator`
+    /// to supply memory.
+    explicit TestMetricsAdapter(bslma::Allocator *basicAllocator)
+    : d_descriptors(basicAllocator)
+    , d_callbacks(basicAllocator)
+    , d_handles(basicAllocator)
+    {
+    }
+
+    /// Destroy this object.
+    ~TestMetricsAdapter() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the specified `metricDescriptor` and `callback`, and return
+    /// a callback handle identifying them.
+    CallbackHandle registerCollectionCallback(
+                  const bdlm::MetricDescriptor& metricDescriptor,
+                  const Callback&               callback) BSLS_KEYWORD_OVERRIDE
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_descriptors.push_back(metricDescriptor);
+        d_callbacks.push_back(callback);
+        d_handles.push_back(static_cast<int>(d_handles.size()));
+
+        return d_handles.back();
+    }
+
+    /// Mark the callback identified by the specified `handle` as removed.
+    /// Return 0.
+    int removeCollectionCallback(const CallbackHandle& handle)
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_handles[handle] = -1;
+        return 0;
+    }
+
+    // ACCESSORS
+
+    /// Return the value of the metric collected by the callback having the
+    /// specified `index`, or -1 if that callback was removed.  The behavior
+    /// is undefined unless `index < numDescriptors()`.
+    double collect(bsl::size_t index) const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (0 > d_handles[index]) {
+            return -1.0;                                              // RETURN
+        }
+
+        bdlm::Metric value;
+        d_callbacks[index](&value);
+        return value.theGauge();
+    }
+
+    /// Return the descriptor of the callback having the specified `index`.
+    /// The behavior is undefined unless `index < numDescriptors()`.
+    bdlm::MetricDescriptor descriptor(bsl::size_t index) const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_descriptors[index];
+    }
+
+    /// Return the number of registered callbacks, including the removed
+    /// ones.
+    bsl::size_t numDescriptors() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_descriptors.size();
+    }
+
+    /// Return the number of registered callbacks that were not removed.
+    int numRegistered() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        int count = 0;
+        for (bsl::size_t i = 0; i < d_handles.size(); ++i) {
+            count += 0 <= d_handles[i];
+        }
+        return count;
+    }
+};
+
+/// Publish to the specified `observer` the specified `numRecords` records,
+/// the `i`th of which has the message `i * numThreads + threadIndex` and a
+/// timestamp of that many milliseconds after the specified `base`, where
+/// `numThreads` and `threadIndex` are specified.  Records are published in
+/// decreasing order of severity, from `e_FATAL` to `e_TRACE`, repeatedly.
+void publishInterleaved(ball::AsyncFileObserver *observer,
+                        int                      threadIndex,
+                        int                      numThreads,
+                        int                      numRecords,
+                        bdlt::Datetime           base)
+{
+    ball::Context context;
+
+    for (int i = 0; i < numRecords; ++i) {
+        const int sequence = i * numThreads + threadIndex;
+
+        bsl::ostringstream message;
+        message << sequence;
+
+        bsl::shared_ptr<ball::Record> record = createRecord(
+                                                 message.str(),
+                                                 ball::Severity::e_ERROR,
+                                                 bslma::Default::allocator());
+
+        bdlt::Datetime timestamp(base);
+        timestamp.addMilliseconds(sequence);
+        record->fixedFields().setTimestamp(timestamp);
+
+        observer->publish(record, context);
+    }
+}
+
+/// Return the lines of the file having the specified `fileName`.
+bsl::vector<bsl::string> readLines(const bsl::string& fileName)
+{
+    bsl::vector<bsl::string> lines;
+    bsl::string              line;
+    bsl::ifstream            fs(fileName.c_str());
+
+    ASSERT(fs.is_open());
+
+    while (getline(fs, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+}  // close namespace BALL_ASYNCFILEOBSERVER_PER_THREAD_QUEUES_TEST
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -677,7 +873,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -828,6 +1024,512 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING COMPRESSION AND GROUP COMMIT
+        //
+        // Concerns:
+        // 1. The compression and group commit methods forward to the
+        //    underlying file observer.
+        //
+        // 2. Records published with compression and group commit enabled are
+        //    written, by the publication thread, to a compressed log file
+        //    that decompresses to the published records, in order.
+        //
+        // 3. Records pending a group commit are written once they have been
+        //    pending for the maximum latency, without further publication.
+        //
+        // 4. No memory is leaked.
+        //
+        // Plan:
+        // 1. Enable and disable compression and group commit, and verify the
+        //    values of the accessors.  (C-1)
+        //
+        // 2. Enable compression and group commit with a pending limit
+        //    exceeding the published records and a maximum latency of 10
+        //    milliseconds, publish records, and wait until the compressed log
+        //    file holds all of them.  Verify that it decompresses to the
+        //    published messages.  (C-1..3)
+        //
+        // 3. Use a test allocator for the observers, and verify that no
+        //    memory is outstanding at the end of each scope.  (C-4)
+        //
+        // Testing:
+        //   void disableCompression();
+        //   void disableGroupCommit();
+        //   void enableCompression();
+        //   int enableGroupCommit(int, const TimeInterval&, int);
+        //   bool isCompressionEnabled() const;
+        //   bool isGroupCommitEnabled() const;
+        // --------------------------------------------------------------------
+        if (verbose) cout << "\nTESTING COMPRESSION AND GROUP COMMIT."
+                          << "\n=====================================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the accessors." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isCompressionEnabled());
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            mX.enableCompression();
+            ASSERT(true  == X.isCompressionEnabled());
+
+            ASSERT(0     == mX.enableGroupCommit(1024,
+                                                 bsls::TimeInterval(1.0)));
+            ASSERT(true  == X.isGroupCommitEnabled());
+
+            mX.disableGroupCommit();
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            mX.disableCompression();
+            ASSERT(false == X.isCompressionEnabled());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting publication." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog.lz");
+
+            const int k_NUM_RECORDS = 1000;
+
+            Obj mX(ball::Severity::e_OFF, &ta);
+
+            mX.setLogFormat("%m\n", "%m\n");
+            mX.enableCompression();
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(1024 * 1024,
+                                             bsls::TimeInterval(0.01)));
+            ASSERT(0 == mX.startPublicationThread());
+
+            ball::Context context;
+            bsl::string   expected;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                bsl::ostringstream message;
+                message << "order " << i << " routed to venue " << i % 5;
+                expected += message.str() + "\n";
+
+                mX.publish(createRecord(message.str(),
+                                        ball::Severity::e_INFO,
+                                        &ta),
+                           context);
+            }
+
+            // Wait for the records to be committed, for up to 10 seconds.
+
+            bsl::string text;
+            for (int i = 0; i < 1000 && text.size() < expected.size(); ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+                ASSERT(0 == decompressFile(&text, fileName));
+            }
+
+            ASSERT(expected == text);
+
+            const Offset fileSize = FsUtil::getFileSize(fileName);
+            ASSERTV(fileSize, expected.size(),
+                    fileSize < static_cast<Offset>(expected.size() / 3));
+
+            mX.stopPublicationThread();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING PER-THREAD RECORD QUEUES
+        //
+        // Concerns:
+        //  1. With `e_PER_THREAD_QUEUES`, the records published by several
+        //     threads are all published, in timestamp order.
+        //
+        //  2. A per-thread queue is created on the first `publish` from a
+        //     thread, registers its metrics identified by the observer name
+        //     and thread ID, and is destroyed (unregistering its metrics)
+        //     once its thread has exited and its records are published.
+        //
+        //  3. Records are dropped when a per-thread queue is full and their
+        //     severity is below `dropRecordsOnFullQueueThreshold`, and block
+        //     otherwise; both are counted, per thread and in total, and the
+        //     dropped records are reported by a warning.
+        //
+        //  4. `releaseRecords` and `shutdownPublicationThread` discard the
+        //     queued records, which `stopPublicationThread` publishes.
+        //
+        //  5. With `e_SHARED_QUEUE`, the constructor taking a metrics
+        //     registry registers the metrics of the observer.
+        //
+        //  6. No memory is leaked.
+        //
+        //  7. The publication thread, once it has emptied the per-thread
+        //     queues, is woken by the next record published.
+        //
+        // Plan:
+        //  1. Create an observer with per-thread queues and a test metrics
+        //     adapter.  Publish from several threads, with the publication
+        //     thread stopped, records with interleaved timestamps.  Start and
+        //     stop the publication thread, and verify that the log file has
+        //     the records in timestamp order, and that the metrics of the
+        //     exited threads were registered then removed.  (C-1..2)
+        //
+        //  2. Overfill the queue of a thread with dropped records, and verify
+        //     the counts and the warning.  Block a thread on a full queue,
+        //     start the publication thread, and verify that the thread
+        //     completes and the blocked record is counted.  (C-3)
+        //
+        //  3. Queue records, and verify that `releaseRecords` and
+        //     `shutdownPublicationThread` leave them unpublished and release
+        //     their shared references.  (C-4)
+        //
+        //  4. Create an observer with a shared queue and verify its metrics.
+        //     (C-5)
+        //
+        //  5. Use a test allocator and verify that no memory is in use after
+        //     destroying the observers.  (C-6)
+        //
+        //  6. Repeatedly let the running publication thread empty the queues,
+        //     publish a record, and verify that the record is published
+        //     without stopping the publication thread.  (C-7)
+        //
+        // Testing:
+        //   AsyncFileObserver(Sev, bool, int, Sev, Mode, sv, Registry *, A*);
+        //   Uint64 numBlockedRecords() const;
+        //   Uint64 numDroppedRecords() const;
+        //   RecordQueueMode recordQueueMode() const;
+        //   CONCERN: PER-THREAD RECORD QUEUES
+        // --------------------------------------------------------------------
+        if (verbose) cout << "\nTESTING PER-THREAD RECORD QUEUES."
+                          << "\n================================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_PER_THREAD_QUEUES_TEST;
+
+        bslma::TestAllocator  ta(veryVeryVeryVerbose);
+        bslma::TestAllocator  metricsAllocator(veryVeryVeryVerbose);
+        TestMetricsAdapter    adapter(&metricsAllocator);
+        bdlm::MetricsRegistry registry(&metricsAllocator);
+
+        registry.setMetricsAdapter(&adapter);
+
+        const bdlt::Datetime BASE(2026, 1, 1);
+
+        if (verbose) cout << "\nTesting merged publication." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            const int k_NUM_THREADS = 4;
+            const int k_NUM_RECORDS = 500;
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   k_NUM_RECORDS,
+                   ball::Severity::e_OFF,
+                   Obj::e_PER_THREAD_QUEUES,
+                   "merge",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(Obj::e_PER_THREAD_QUEUES == X.recordQueueMode());
+            ASSERT(0 == adapter.numDescriptors());
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                     &handles[i],
+                                     bdlf::BindUtil::bind(&publishInterleaved,
+                                                          &mX,
+                                                          i,
+                                                          k_NUM_THREADS,
+                                                          k_NUM_RECORDS,
+                                                          BASE)));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERTV(X.recordQueueLength(),
+                    k_NUM_THREADS * k_NUM_RECORDS == X.recordQueueLength());
+            ASSERT(0 == X.numDroppedRecords());
+            ASSERT(0 == X.numBlockedRecords());
+
+            ASSERTV(adapter.numDescriptors(),
+                    3 * k_NUM_THREADS == adapter.numDescriptors());
+            ASSERT(3 * k_NUM_THREADS == adapter.numRegistered());
+
+            for (bsl::size_t i = 0; i < adapter.numDescriptors(); ++i) {
+                const bdlm::MetricDescriptor D = adapter.descriptor(i);
+
+                ASSERTV(i, "ball.asyncfileobserver" == D.objectTypeName());
+                ASSERTV(i, "afo" == D.objectTypeAbbreviation());
+                ASSERTV(i, D.objectIdentifier(),
+                        0 == D.objectIdentifier().find("merge."));
+            }
+            ASSERT("bde.backlog"        == adapter.descriptor(0).metricName());
+            ASSERT("bde.droppedrecords" == adapter.descriptor(1).metricName());
+            ASSERT("bde.blockedrecords" == adapter.descriptor(2).metricName());
+            ASSERTV(adapter.collect(0), k_NUM_RECORDS == adapter.collect(0));
+            ASSERTV(adapter.collect(1), 0 == adapter.collect(1));
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERT(0 == X.recordQueueLength());
+            ASSERTV(adapter.numRegistered(), 0 == adapter.numRegistered());
+
+            mX.disableFileLogging();
+
+            const bsl::vector<bsl::string> LINES = readLines(fileName);
+
+            ASSERTV(LINES.size(),
+                    k_NUM_THREADS * k_NUM_RECORDS == LINES.size());
+
+            for (bsl::size_t i = 0; i < LINES.size(); ++i) {
+                bsl::ostringstream expected;
+                expected << i;
+                ASSERTV(i, LINES[i], expected.str() == LINES[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting dropped records." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            const int k_CAPACITY = 100;
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   k_CAPACITY,
+                   ball::Severity::e_OFF,
+                   Obj::e_PER_THREAD_QUEUES,
+                   "drop",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            const bsl::size_t FIRST = adapter.numDescriptors();
+
+            publishInterleaved(&mX, 0, 1, k_CAPACITY + 10, BASE);
+
+            const int CAPACITY = static_cast<int>(X.recordQueueLength());
+
+            ASSERTV(CAPACITY, k_CAPACITY <= CAPACITY);
+            ASSERTV(X.numDroppedRecords(),
+                    k_CAPACITY + 10 - CAPACITY ==
+                                      static_cast<int>(X.numDroppedRecords()));
+            ASSERTV(adapter.collect(FIRST + 1),
+                    X.numDroppedRecords() == adapter.collect(FIRST + 1));
+
+            const bsl::string IDENTIFIER =
+                                 adapter.descriptor(FIRST).objectIdentifier();
+            bsl::ostringstream expected;
+            expected << "drop." << bslmt::ThreadUtil::selfIdAsUint64();
+            ASSERTV(IDENTIFIER, expected.str() == IDENTIFIER);
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            mX.disableFileLogging();
+
+            const bsl::vector<bsl::string> LINES = readLines(fileName);
+
+            const int NUM_LINES = static_cast<int>(LINES.size());
+
+            ASSERTV(NUM_LINES, CAPACITY + 1 == NUM_LINES);
+            if (CAPACITY + 1 == NUM_LINES) {
+                bsl::ostringstream warning;
+                warning << "Dropped " << X.numDroppedRecords()
+                        << " log records.";
+                ASSERTV(LINES.back(),
+                        0 == LINES.back().find(warning.str()));
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting blocked records." << endl;
+        {
+            const int k_CAPACITY = 100;
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   k_CAPACITY,
+                   ball::Severity::e_TRACE,
+                   Obj::e_PER_THREAD_QUEUES,
+                   "block",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            // Fill the queue of the publishing thread beyond its capacity,
+            // which blocks that thread until the publication thread runs.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                     &handle,
+                                     bdlf::BindUtil::bind(&publishInterleaved,
+                                                          &mX,
+                                                          0,
+                                                          1,
+                                                          4 * k_CAPACITY,
+                                                          BASE)));
+
+            bsls::Stopwatch timer;
+            timer.start();
+            while (0 == X.numBlockedRecords() && timer.elapsedTime() < 5) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERTV(X.numBlockedRecords(), 1 == X.numBlockedRecords());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERT(0 <  X.numBlockedRecords());
+            ASSERT(0 == X.numDroppedRecords());
+            ASSERT(0 == X.recordQueueLength());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting wakeup after idling." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   100,
+                   ball::Severity::e_OFF,
+                   Obj::e_PER_THREAD_QUEUES,
+                   "wakeup",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            bsl::shared_ptr<ball::Record> record = createRecord(
+                                                       "wakeup",
+                                                       ball::Severity::e_ERROR,
+                                                       &ta);
+            ball::Context context;
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            for (int i = 0; i < 100; ++i) {
+                bslmt::ThreadUtil::microSleep(i % 10 * 100);
+
+                mX.publish(record, context);
+
+                // The record is released once published.  Allow ample time,
+                // so that only a lost wakeup fails this test.
+
+                for (int j = 0; 1 < record.use_count() && j < 10000; ++j) {
+                    bslmt::ThreadUtil::microSleep(1000);
+                }
+                ASSERTV(i, record.use_count(), 1 == record.use_count());
+            }
+            ASSERT(X.isPublicationThreadRunning());
+            ASSERT(0 == mX.stopPublicationThread());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting discarded records." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   100,
+                   ball::Severity::e_OFF,
+                   Obj::e_PER_THREAD_QUEUES,
+                   "release",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            bsl::shared_ptr<ball::Record> record = createRecord(
+                                                       "release",
+                                                       ball::Severity::e_ERROR,
+                                                       &ta);
+            ball::Context context;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(10 == X.recordQueueLength());
+            ASSERT(11 == record.use_count());
+
+            mX.releaseRecords();
+
+            ASSERT(0 == X.recordQueueLength());
+            ASSERT(1 == record.use_count());
+
+            ASSERT(0 == mX.startPublicationThread());
+            mX.releaseRecords();
+            ASSERT(X.isPublicationThreadRunning());
+
+            mX.publish(record, context);
+            ASSERT(0 == mX.shutdownPublicationThread());
+            ASSERT(!X.isPublicationThreadRunning());
+
+            mX.releaseRecords();
+            ASSERT(0 == X.recordQueueLength());
+            ASSERT(1 == record.use_count());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting shared queue metrics." << endl;
+        {
+            const bsl::size_t FIRST = adapter.numDescriptors();
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   100,
+                   ball::Severity::e_OFF,
+                   Obj::e_SHARED_QUEUE,
+                   "shared",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(Obj::e_SHARED_QUEUE == X.recordQueueMode());
+            ASSERTV(adapter.numDescriptors(),
+                    FIRST + 3 == adapter.numDescriptors());
+
+            for (bsl::size_t i = FIRST; i < adapter.numDescriptors(); ++i) {
+                const bdlm::MetricDescriptor D = adapter.descriptor(i);
+
+                ASSERTV(i, "shared" == D.objectIdentifier());
+            }
+
+            bsl::shared_ptr<ball::Record> record = createRecord(
+                                                       "shared",
+                                                       ball::Severity::e_ERROR,
+                                                       &ta);
+            ball::Context context;
+
+            for (int i = 0; i < 110; ++i) {
+                mX.publish(record, context);
+            }
+
+            const double LENGTH = static_cast<double>(X.recordQueueLength());
+
+            ASSERTV(adapter.collect(FIRST), LENGTH == adapter.collect(FIRST));
+            ASSERTV(X.numDroppedRecords(),
+                    110 - LENGTH == adapter.collect(FIRST + 1));
+            ASSERT(0 == adapter.collect(FIRST + 2));
+
+            mX.releaseRecords();
+        }
+        ASSERTV(adapter.numRegistered(), 0 == adapter.numRegistered());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING SUPPRESS UNIQUE FILE NAME ON ROTATION
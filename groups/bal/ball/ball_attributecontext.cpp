@@ -5,12 +5,13 @@
 BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 
 #include <ball_attributecontainer.h>
+#include <ball_category.h>
 #include <ball_categorymanager.h>
+#include <ball_patternutil.h>
 #include <ball_predicate.h>            // for testing only
 #include <ball_rule.h>
 #include <ball_thresholdaggregate.h>
 
-#include <bdlb_bitutil.h>
 #include <bdlb_print.h>
 
 #include <bdlma_concurrentpool.h>
@@ -26,6 +27,7 @@ BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 #include <bsls_log.h>
 
 #include <bsl_cstdio.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
 //=============================================================================
@@ -50,6 +52,19 @@ BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 // lock would need to be held (until the message was actually written to the
 // log).
 //
+// The cache is refreshed, with the rule mutex locked, whenever the sequence
+// number changes (or the attributes of the thread change).  A refresh
+// evaluates only the rules found through the attribute index of the rule set
+// ('RuleSet::findActiveRules'), and copies the pattern and threshold levels
+// of each active rule into the cache, so that applying the cached rules to a
+// category never accesses the (possibly concurrently modified) rule set.  The
+// result of applying the cached rules to a category (whether any of them
+// matches, and the maximum of their threshold levels) is cached in turn, keyed
+// by the address of the category, and discarded with the rest of the cache.
+// Matching the patterns of the active rules against a category name therefore
+// happens once per category after each refresh, and logging to a category
+// having relevant rules otherwise costs a single hash-table lookup.
+//
 ///'initialize' and 'reset'
 ///------------------------
 // Although there is no lock in the implementation of this component, the
@@ -59,50 +74,115 @@ BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace ball {
+namespace {
+
+/// Set each threshold level of the specified `levels` to the maximum of its
+/// value and the corresponding level of the specified `other`.
+void raiseLevels(ThresholdAggregate *levels, const ThresholdAggregate& other)
+{
+    if (other.recordLevel() > levels->recordLevel()) {
+        levels->setRecordLevel(other.recordLevel());
+    }
+    if (other.passLevel() > levels->passLevel()) {
+        levels->setPassLevel(other.passLevel());
+    }
+    if (other.triggerLevel() > levels->triggerLevel()) {
+        levels->setTriggerLevel(other.triggerLevel());
+    }
+    if (other.triggerAllLevel() > levels->triggerAllLevel()) {
+        levels->setTriggerAllLevel(other.triggerAllLevel());
+    }
+}
+
+}  // close unnamed namespace
 
                // ------------------------------------------
                // class AttributeContext_RuleEvaluationCache
                // ------------------------------------------
 
-// MANIPULATORS
-RuleSet::MaskType
-AttributeContext_RuleEvaluationCache::update(
-                               bsls::Types::Int64            sequenceNumber,
-                               RuleSet::MaskType             relevantRulesMask,
-                               const RuleSet&                rules,
-                               const AttributeContainerList& attributes)
+// PRIVATE MANIPULATORS
+const AttributeContext_RuleEvaluationCache::CategoryResult&
+AttributeContext_RuleEvaluationCache::lookupCategoryResult(
+                                                      const Category *category)
 {
-    // If the sequence number has changed, the cache is considered entirely out
-    // of date.
-
-    if (d_sequenceNumber != sequenceNumber) {
-        d_resultMask     = 0;
-        d_evalMask       = 0;
-        d_sequenceNumber = sequenceNumber;
+    CategoryResultMap::iterator it = d_categoryResults.find(category);
+    if (d_categoryResults.end() != it) {
+        return it->second;                                            // RETURN
     }
 
-    RuleSet::MaskType needEvaluations = ~d_evalMask & relevantRulesMask;
-
-    int i;
+    const char *categoryName = category->categoryName();
 
-    // Get the index, 'i', of each relevant rule to evaluate.
-    while ((i = bdlb::BitUtil::numTrailingUnsetBits(needEvaluations))
-                                                 != RuleSet::e_MAX_NUM_RULES) {
-        const Rule *rule;
+    CategoryResult result;
+    result.d_hasActiveRules = false;
 
-        // 'rules.getRuleById(i)' will return null if rule 'i' has been removed
-        // from the category manager's rule set.
+    for (bsl::size_t i = 0; i < d_activeRules.size(); ++i) {
+        const ActiveRule& rule = d_activeRules[i];
 
-        if ((rule = rules.getRuleById(i))) {
-            RuleSet::MaskType result = rule->evaluate(attributes) ? 1 : 0;
-            d_resultMask |= result << i;  // OR in result of evaluation.
-            d_evalMask   |=      1 << i;  // Mark rule as evaluated.
+        if (!PatternUtil::isMatch(categoryName,
+                                  d_patterns.data() + rule.d_patternOffset)) {
+            continue;
         }
 
-        needEvaluations &= ~(1 << i);     // We are done with rule 'i'.
+        result.d_hasActiveRules = true;
+        raiseLevels(&result.d_levels, rule.d_levels);
     }
 
-    return d_resultMask;
+    CategoryResultMap::value_type entry(category, result);
+    return d_categoryResults.insert(entry).first->second;
+}
+
+// MANIPULATORS
+void AttributeContext_RuleEvaluationCache::update(
+                                  bsls::Types::Int64            sequenceNumber,
+                                  const RuleSet&                rules,
+                                  const AttributeContainerList& attributes)
+{
+    d_activeRules.clear();
+    d_patterns.clear();
+    d_categoryResults.clear();
+
+    rules.findActiveRules(&d_ruleIds, attributes);
+
+    for (bsl::size_t i = 0; i < d_ruleIds.size(); ++i) {
+        const Rule *rule = rules.getRuleById(d_ruleIds[i]);
+        BSLS_ASSERT(rule);
+
+        ActiveRule activeRule;
+        activeRule.d_patternOffset = d_patterns.size();
+        activeRule.d_levels.setLevels(rule->recordLevel(),
+                                      rule->passLevel(),
+                                      rule->triggerLevel(),
+                                      rule->triggerAllLevel());
+        d_activeRules.push_back(activeRule);
+
+        const char *pattern = rule->pattern();
+        d_patterns.insert(d_patterns.end(),
+                          pattern,
+                          pattern + bsl::strlen(pattern) + 1);
+    }
+
+    d_sequenceNumber = sequenceNumber;
+}
+
+bool AttributeContext_RuleEvaluationCache::hasActiveRules(
+                                                      const Category *category)
+{
+    BSLS_ASSERT(category);
+
+    return lookupCategoryResult(category).d_hasActiveRules;
+}
+
+void AttributeContext_RuleEvaluationCache::mergeThresholdLevels(
+                                          ThresholdAggregate *levels,
+                                          const Category     *category)
+{
+    BSLS_ASSERT(levels);
+    BSLS_ASSERT(category);
+
+    const CategoryResult& result = lookupCategoryResult(category);
+    if (result.d_hasActiveRules) {
+        raiseLevels(levels, result.d_levels);
+    }
 }
 
 // ACCESSORS
@@ -119,9 +199,11 @@ AttributeContext_RuleEvaluationCache::print(bsl::ostream& stream,
     bdlb::Print::indent(stream, level + 1, spacesPerLevel);
     stream << d_sequenceNumber << EL;
 
-    RuleSet::printMask(stream, d_resultMask, level + 1, spacesPerLevel);
-
-    RuleSet::printMask(stream, d_evalMask, level + 1, spacesPerLevel);
+    for (bsl::size_t i = 0; i < d_activeRules.size(); ++i) {
+        bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+        stream << d_patterns.data() + d_activeRules[i].d_patternOffset << ' '
+               << d_activeRules[i].d_levels << EL;
+    }
 
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << "]" << EL;
@@ -174,6 +256,7 @@ bslma::Allocator *AttributeContext::s_globalAllocator_p = 0;
 // PRIVATE CREATORS
 AttributeContext::AttributeContext(bslma::Allocator *globalAllocator)
 : d_containerList(bslma::Default::globalAllocator(globalAllocator))
+, d_ruleCache_p(bslma::Default::globalAllocator(globalAllocator))
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
 {
 }
@@ -312,32 +395,27 @@ bool AttributeContext::hasRelevantActiveRules(const Category *category) const
 {
     BSLS_ASSERT(category);
 
-    RuleSet::MaskType relevantRulesMask = category->relevantRuleMask();
-
-    if (!relevantRulesMask) {
+    if (0 == category->numRelevantRules()) {
         return false;                                                 // RETURN
     }
 
     // The 'rulesetMutex' is intentionally *not* locked before checking the
     // cache (see implementation note at the top).
 
-    if (d_ruleCache_p.isDataAvailable(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask)) {
-        return relevantRulesMask & d_ruleCache_p.knownActiveRules();  // RETURN
-    }
-
-    // We lock the mutex to ensure the rules are not modified as we evaluate
-    // them.
+    if (!d_ruleCache_p.isDataAvailable(
+                               s_categoryManager_p->ruleSetSequenceNumber())) {
+        // We lock the mutex to ensure the rules are not modified as we
+        // evaluate them.
 
-    bslmt::LockGuard<bslmt::Mutex> ruleGuard(
+        bslmt::LockGuard<bslmt::Mutex> ruleGuard(
                                          &s_categoryManager_p->rulesetMutex());
 
-    return relevantRulesMask
-           & d_ruleCache_p.update(s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask,
-                                  s_categoryManager_p->ruleSet(),
-                                  d_containerList);
+        d_ruleCache_p.update(s_categoryManager_p->ruleSetSequenceNumber(),
+                             s_categoryManager_p->ruleSet(),
+                             d_containerList);
+    }
+
+    return d_ruleCache_p.hasActiveRules(category);
 }
 
 void
@@ -353,72 +431,26 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
                       category->triggerLevel(),
                       category->triggerAllLevel());
 
-    RuleSet::MaskType relevantRulesMask = category->relevantRuleMask();
-
-    if (!relevantRulesMask) {
+    if (0 == category->numRelevantRules()) {
         return;                                                       // RETURN
     }
 
     // The 'rulesetMutex' is intentionally *not* locked before checking the
-    // cache (see implementation note at the top).  Return if there are no
-    // active rules for 'category'.
-
-    RuleSet::MaskType activeAndRelevantRules = 0;
-    if (d_ruleCache_p.isDataAvailable(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask)) {
-        activeAndRelevantRules = d_ruleCache_p.knownActiveRules()
-                                 & relevantRulesMask;
-        if (!activeAndRelevantRules) {
-            return;                                                   // RETURN
-        }
-    }
-
-    // We obtain the lock because we will need to process the rules.  Note that
-    // we must again call 'isDataAvailable' in case the rules were modified
-    // before the lock was obtained.
+    // cache (see implementation note at the top).  Note that the cache holds
+    // the levels of the active rules, so that the rule set need not be
+    // accessed once the cache is up to date.
 
-    bslmt::LockGuard<bslmt::Mutex> ruleGuard(
+    if (!d_ruleCache_p.isDataAvailable(
+                               s_categoryManager_p->ruleSetSequenceNumber())) {
+        bslmt::LockGuard<bslmt::Mutex> ruleGuard(
                                          &s_categoryManager_p->rulesetMutex());
 
-    // If 'isDataAvailable' returns 'true', the rule set has not changed and we
-    // must have assigned 'activeAndRelevantRules' before obtaining the lock.
-
-    if (!d_ruleCache_p.isDataAvailable(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask)) {
-          activeAndRelevantRules =
-                relevantRulesMask
-                & d_ruleCache_p.update(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask,
-                                  s_categoryManager_p->ruleSet(),
-                                  d_containerList);
+        d_ruleCache_p.update(s_categoryManager_p->ruleSetSequenceNumber(),
+                             s_categoryManager_p->ruleSet(),
+                             d_containerList);
     }
 
-    int i;
-
-    // Get the index, 'i', of each active and relevant rule to process.
-    while ((i = bdlb::BitUtil::numTrailingUnsetBits(activeAndRelevantRules))
-                                                 != RuleSet::e_MAX_NUM_RULES) {
-        activeAndRelevantRules &= ~(1 << i);
-
-        const Rule *rule = s_categoryManager_p->ruleSet().getRuleById(i);
-        BSLS_ASSERT(0 != rule);
-
-        if (rule->recordLevel() > levels->recordLevel()) {
-            levels->setRecordLevel(rule->recordLevel());
-        }
-        if (rule->passLevel() > levels->passLevel()) {
-            levels->setPassLevel(rule->passLevel());
-        }
-        if (rule->triggerLevel() > levels->triggerLevel()) {
-            levels->setTriggerLevel(rule->triggerLevel());
-        }
-        if (rule->triggerAllLevel() > levels->triggerAllLevel()) {
-            levels->setTriggerAllLevel(rule->triggerAllLevel());
-        }
-    }
+    d_ruleCache_p.mergeThresholdLevels(levels, category);
 }
 
 // ACCESSORS
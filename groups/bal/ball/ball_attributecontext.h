@@ -59,6 +59,13 @@ BSLS_IDENT("$Id: $")
 // category, factoring in any active rules that apply to the category that
 // might override the category's thresholds.
 //
+// Each attribute context caches the rules that are active for its thread.
+// The cache is refreshed only when the set of rules or the attributes of the
+// thread change, and a refresh evaluates only the rules indexed under the
+// attributes of the thread (see {`ball_ruleset`|Rule Indexes}), so that a
+// process may install thousands of rules (e.g., one per client) without
+// slowing down the threads to which they do not apply.
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of `ball::AttributeContext`.
@@ -290,6 +297,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ball_attributecontainerlist.h>
 #include <ball_ruleset.h>
+#include <ball_thresholdaggregate.h>
 
 #include <bslma_allocator.h>
 
@@ -299,7 +307,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -308,7 +319,6 @@ class Attribute;
 class AttributeContainer;
 class Category;
 class CategoryManager;
-class ThresholdAggregate;
 
              // ==========================================
              // class AttributeContext_RuleEvaluationCache
@@ -316,43 +326,75 @@ class ThresholdAggregate;
 
 /// This is an implementation type of `AttributeContext` and should not be
 /// used by clients of this package.  A rule evaluation cache is a mechanism
-/// for evaluating and caching whether a rule is active.  A rule is
+/// for determining and caching which rules are active.  A rule is
 /// considered active if all of its attributes are satisfied by the
 /// collection of attributes held in a `AttributeContainerList` object
 /// (i.e., `Rule::evaluate` returns `true` for the `AttributeContainerList`
 /// object).  The rules this cache evaluates are contained in a `RuleSet`
-/// object.  `RuleSet::MaskType` is a bit mask for a rule set, where each
-/// bit is a boolean value associated with the rule at the corresponding
-/// index in a rule set.  An `AttributeContext` determines, using the
-/// `isDataAvailable` method, if a particular set of rules (described using
-/// a bit mask) have already been evaluated.  A context accesses the current
-/// cache of rule evaluations using the `knownActiveRules` method.  Finally,
-/// a context updates the cache of rule evaluations using the `update`
-/// method.  Note that the `isDataAvailable` method should be used prior to
-/// using `knownActiveRules` in order to ensure the relevant rules have been
-/// evaluated and that those evaluations are up-to-date.
+/// object.  An `AttributeContext` determines, using the `isDataAvailable`
+/// method, if the cached rule evaluations are up-to-date, and updates them
+/// using the `update` method otherwise.  The cache holds a copy of the
+/// pattern and threshold levels of each active rule, so that a context can
+/// use the `hasActiveRules` and `mergeThresholdLevels` methods to apply
+/// the active rules to a category without accessing the rule set (and,
+/// hence, without locking the mutex guarding it).  The result of applying
+/// the active rules to a category is itself cached, so that the patterns of
+/// the active rules are matched against the name of a category at most once
+/// per call to `update`.
 class AttributeContext_RuleEvaluationCache {
 
+    // PRIVATE TYPES
+
+    /// This `struct` describes a rule that is known to be active.
+    struct ActiveRule {
+
+        // DATA
+        bsl::size_t        d_patternOffset;  // offset of the rule's pattern
+                                             // in `d_patterns`
+
+        ThresholdAggregate d_levels;         // threshold levels of the rule
+    };
+
+    /// This `struct` describes the result of applying the active rules to a
+    /// category.
+    struct CategoryResult {
+
+        // DATA
+        bool               d_hasActiveRules;  // `true` if the pattern of an
+                                              // active rule matches the
+                                              // category
+
+        ThresholdAggregate d_levels;          // maximum threshold levels of
+                                              // the matching active rules
+    };
+
+    typedef bsl::unordered_map<const Category *, CategoryResult>
+                                                           CategoryResultMap;
+
     // DATA
-    RuleSet::MaskType  d_evalMask;        // set of bits, each of which
-                                          // indicates whether the
-                                          // corresponding rule has been
-                                          // evaluated and cached in
-                                          // `d_resultMask` (1 if evaluated and
-                                          // 0 otherwise)
-
-    RuleSet::MaskType  d_resultMask;      // set of bits, each of which caches
-                                          // the result of the most recent
-                                          // evaluation of the corresponding
-                                          // rule (1 if the rule is active and
-                                          // 0 otherwise)
-
-    bsls::Types::Int64 d_sequenceNumber;  // sequence number used to determine
-                                          // if this cache is in sync with the
-                                          // rule set maintained by the
-                                          // category manager (see `update`);
-                                          // if the sequence number changes it
-                                          // indicates the cache is out of date
+    bsl::vector<ActiveRule> d_activeRules;     // rules found active by the
+                                               // last call to `update`
+
+    bsl::vector<char>       d_patterns;        // null-terminated patterns of
+                                               // the rules in `d_activeRules`
+
+    bsl::vector<int>        d_ruleIds;         // ids of the active rules
+                                               // (scratch buffer for
+                                               // `update`)
+
+    CategoryResultMap       d_categoryResults; // result of applying the
+                                               // rules in `d_activeRules` to
+                                               // each category queried since
+                                               // the last call to `update`
+
+    bsls::Types::Int64      d_sequenceNumber;  // sequence number used to
+                                               // determine if this cache is
+                                               // in sync with the rule set
+                                               // maintained by the category
+                                               // manager (see `update`); if
+                                               // the sequence number changes
+                                               // it indicates the cache is
+                                               // out of date
 
     // NOT IMPLEMENTED
     AttributeContext_RuleEvaluationCache(
@@ -360,11 +402,24 @@ class AttributeContext_RuleEvaluationCache {
     AttributeContext_RuleEvaluationCache& operator=(
                                   const AttributeContext_RuleEvaluationCache&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Return a reference providing non-modifiable access to the result of
+    /// applying the rules known to be active (as of the last call to
+    /// `update`) to the specified `category`, matching their patterns
+    /// against the name of `category` only if that result is not already
+    /// cached.
+    const CategoryResult& lookupCategoryResult(const Category *category);
+
   public:
     // CREATORS
 
-    /// Create an empty rule evaluation cache having a sequence number of -1.
-    AttributeContext_RuleEvaluationCache();
+    /// Create an empty rule evaluation cache having a sequence number of
+    /// -1.  Optionally specify a `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.
+    explicit AttributeContext_RuleEvaluationCache(
+                                         bslma::Allocator *basicAllocator = 0);
 
     /// Destroy this object.
     //! ~AttributeContext_RuleEvaluationCache() = default;
@@ -375,45 +430,42 @@ class AttributeContext_RuleEvaluationCache {
     /// object to its default constructed state (empty).
     void clear();
 
-    /// Update, for the specified `sequenceNumber`, the cache for those
-    /// rules indicated by the specified `relevantRulesMask` bit mask in the
-    /// specified set of `rules`, by evaluating those rules for the
-    /// specified `attributes`; return the bit mask indicating those rules
-    /// that are known to be active.  If a bit in the returned bit mask
-    /// value is set to 1, the rule at the corresponding index in `rules` is
-    /// "active"; however, if a bit is set to 0, the corresponding rule is
-    /// either not active *or* has not been evaluated.  This operation does,
-    /// however, guarantee that all the rules indicated by the
-    /// `relevantRulesMask` *will* be evaluated.  A particular rule is
-    /// considered "active" if all of its attributes are satisfied by
-    /// `attributes` (i.e., if `Rule::evaluate` returns `true` for
-    /// `attributes`).  The behavior is undefined unless `rules` is not
-    /// modified during this operation (i.e., any lock associated with
-    /// `rules` must be locked during this operation).
-    RuleSet::MaskType update(bsls::Types::Int64            sequenceNumber,
-                             RuleSet::MaskType             relevantRulesMask,
-                             const RuleSet&                rules,
-                             const AttributeContainerList& attributes);
+    /// Update, for the specified `sequenceNumber`, this cache by
+    /// determining which rules in the specified set of `rules` are active
+    /// for the specified `attributes`.  A particular rule is considered
+    /// "active" if all of its attributes are satisfied by `attributes`
+    /// (i.e., if `Rule::evaluate` returns `true` for `attributes`).  The
+    /// behavior is undefined unless `rules` is not modified during this
+    /// operation (i.e., any lock associated with `rules` must be locked
+    /// during this operation).  Note that only the rules indexed under the
+    /// attributes in `attributes` are evaluated (see
+    /// `RuleSet::findActiveRules`).
+    void update(bsls::Types::Int64            sequenceNumber,
+                const RuleSet&                rules,
+                const AttributeContainerList& attributes);
+
+    /// Return `true` if at least one of the rules known to be active (as of
+    /// the last call to `update`) has a pattern matching the name of the
+    /// specified `category`, and `false` otherwise.
+    bool hasActiveRules(const Category *category);
+
+    /// Set each threshold level of the specified `levels` to the maximum
+    /// of its value and the corresponding level of each rule known to be
+    /// active (as of the last call to `update`) whose pattern matches the
+    /// name of the specified `category`.
+    void mergeThresholdLevels(ThresholdAggregate *levels,
+                              const Category     *category);
 
     // ACCESSORS
 
     /// Return `true` if this cache contains up-to-date cached rule
-    /// evaluations having the specified `sequenceNumber` for the set of
-    /// rules indicated by the specified `relevantRulesMask` bit mask, and
-    /// `false` otherwise.
-    bool isDataAvailable(bsls::Types::Int64 sequenceNumber,
-                         RuleSet::MaskType  relevantRulesMask) const;
-
-    /// Return a bit mask indicating those rules, from the set of rules
-    /// provided in the last call to `update`, that are known to be active
-    /// (as of that last call to `update`).  If a bit in the returned value
-    /// is set to 1, the rule at the corresponding index is active; however,
-    /// if a bit is set to 0, the corresponding rule is either not active
-    /// *or* has not been evaluated.  Note that `isDataAvailable` should be
-    /// called to test if this cache contains up-to-date evaluated rule
-    /// information for the rules in which they are interested before using
-    /// the result of this method.
-    RuleSet::MaskType knownActiveRules() const;
+    /// evaluations having the specified `sequenceNumber`, and `false`
+    /// otherwise.
+    bool isDataAvailable(bsls::Types::Int64 sequenceNumber) const;
+
+    /// Return the number of rules known to be active as of the last call
+    /// to `update`.
+    int numActiveRules() const;
 
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
@@ -703,9 +755,12 @@ class AttributeContextProctor {
 
 // CREATORS
 inline
-AttributeContext_RuleEvaluationCache::AttributeContext_RuleEvaluationCache()
-: d_evalMask(0)
-, d_resultMask(0)
+AttributeContext_RuleEvaluationCache::AttributeContext_RuleEvaluationCache(
+                                              bslma::Allocator *basicAllocator)
+: d_activeRules(basicAllocator)
+, d_patterns(basicAllocator)
+, d_ruleIds(basicAllocator)
+, d_categoryResults(basicAllocator)
 , d_sequenceNumber(-1)
 {
 }
@@ -714,26 +769,24 @@ AttributeContext_RuleEvaluationCache::AttributeContext_RuleEvaluationCache()
 inline
 void AttributeContext_RuleEvaluationCache::clear()
 {
-    d_evalMask       =  0;
-    d_resultMask     =  0;
+    d_activeRules.clear();
+    d_patterns.clear();
+    d_categoryResults.clear();
     d_sequenceNumber = -1;
 }
 
 // ACCESSORS
 inline
 bool AttributeContext_RuleEvaluationCache::isDataAvailable(
-                                    bsls::Types::Int64 sequenceNumber,
-                                    RuleSet::MaskType  relevantRulesMask) const
+                                     bsls::Types::Int64 sequenceNumber) const
 {
-    return sequenceNumber    == d_sequenceNumber
-        && relevantRulesMask == (relevantRulesMask & d_evalMask);
+    return sequenceNumber == d_sequenceNumber;
 }
 
 inline
-RuleSet::MaskType
-AttributeContext_RuleEvaluationCache::knownActiveRules() const
+int AttributeContext_RuleEvaluationCache::numActiveRules() const
 {
-    return d_resultMask;
+    return static_cast<int>(d_activeRules.size());
 }
 
                         // ----------------------
@@ -26,6 +26,7 @@
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -76,9 +77,10 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] AttributeSet
 // [ 7] CONCERN: No false positives from `hasRelevantActiveRules`.
-// [ 8] (OLD) USAGE EXAMPLE
-// [ 9] USAGE EXAMPLE 1
-// [10] USAGE EXAMPLE 2
+// [ 8] CONCERN: Many per-client rules are evaluated efficiently.
+// [ 9] (OLD) USAGE EXAMPLE
+// [10] USAGE EXAMPLE 1
+// [11] USAGE EXAMPLE 2
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -728,6 +730,7 @@ enum {
     NUM_RULETHREADS    =  2, // number of threads adding/deleting rules
     NUM_CONTEXTTHREADS =  4, // number of threads verifying attribute contexts
     NUM_TESTS          = 10, // number of repetitions
+    NUM_RULES          = 32, // number of rules in a full rule set
     NUM_THREADS        = NUM_RULETHREADS + NUM_CONTEXTTHREADS
 };
 
@@ -776,31 +779,30 @@ extern "C" void *case4RuleThread(void *args)
 
     ball::RuleSet ruleSet;
 
-    for (int i = 0; i < ball::RuleSet::e_MAX_NUM_RULES; ++i) {
+    for (int i = 0; i < NUM_RULES; ++i) {
         bsl::string pattern(i + 1, 'a');
         pattern += '*';
         ball::Rule rule(pattern.c_str(), 0, i + 1, i + 1, i + 1);
 
-        for (int j = 0; j < ball::RuleSet::e_MAX_NUM_RULES - i; ++j) {
+        for (int j = 0; j < NUM_RULES - i; ++j) {
             ball::Predicate predicate("uuid", j);
             rule.addPredicate(predicate);
         }
         ruleSet.addRule(rule);
     }
-    ASSERT(ball::RuleSet::e_MAX_NUM_RULES == ruleSet.numRules());
+    ASSERT(NUM_RULES == ruleSet.numRules());
 
     // Add rules to the category manager.
 
-    while (numRulesLocked(manager) < ball::RuleSet::e_MAX_NUM_RULES) {
-        int r = randomValue(&seed) % ball::RuleSet::e_MAX_NUM_RULES;
+    while (numRulesLocked(manager) < NUM_RULES) {
+        int r = randomValue(&seed) % NUM_RULES;
 
         // 2/3 chance to add a rule, 1/3 chance to remove a rule
 
         if (0 != (randomValue(&seed) % 3)) {
             while (0 == manager->addRule(*ruleSet.getRuleById(r))
-                   && numRulesLocked(manager) <
-                                              ball::RuleSet::e_MAX_NUM_RULES) {
-                r = randomValue(&seed) % ball::RuleSet::e_MAX_NUM_RULES;
+                   && numRulesLocked(manager) < NUM_RULES) {
+                r = randomValue(&seed) % NUM_RULES;
             }
         }
         else {
@@ -808,7 +810,7 @@ extern "C" void *case4RuleThread(void *args)
         }
     }
 
-    ASSERT(ball::RuleSet::e_MAX_NUM_RULES == numRulesLocked(manager));
+    ASSERT(NUM_RULES == numRulesLocked(manager));
 
     barrier.wait();
 
@@ -825,14 +827,14 @@ extern "C" void *case4RuleThread(void *args)
     }
 
     while (numRulesLocked(manager) > 0) {
-        int r = randomValue(&seed) % ball::RuleSet::e_MAX_NUM_RULES;
+        int r = randomValue(&seed) % NUM_RULES;
 
         // 2/3 chance to remove a rule, 1/3 chance to add a rule
 
         if (0 != (randomValue(&seed) % 3)) {
             while (0 == manager->removeRule(*ruleSet.getRuleById(r))
                    && numRulesLocked(manager) > 0) {
-                r = randomValue(&seed) % ball::RuleSet::e_MAX_NUM_RULES;
+                r = randomValue(&seed) % NUM_RULES;
             }
         }
         else {
@@ -873,7 +875,7 @@ extern "C" void *case4ContextThread(void *args)
 
     // Add categories C0, C1, C2, ... C32 whose names are "", "a", "aa", etc.
 
-    const int NUM_CATEGORIES = ball::RuleSet::e_MAX_NUM_RULES + 1;
+    const int NUM_CATEGORIES = NUM_RULES + 1;
     bsl::vector<const ball::Category *> CATEGORIES(NUM_CATEGORIES);
     for (int i = 0; i < NUM_CATEGORIES; ++i) {
         bsl::string name(i, 'a');
@@ -1372,7 +1374,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -1423,7 +1425,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -1455,7 +1457,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(threads[0]);
         bslmt::ThreadUtil::join(threads[1]);
       } break;
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING ORIGINAL USAGE EXAMPLE
         //   This test runs the original usage example for this component.  It
@@ -1487,6 +1489,179 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // MANY PER-CLIENT RULES
+        //
+        // Concerns:
+        // 1. That a rule set holding far more than 32 rules, each keyed on a
+        //    distinct value of the same attribute, is supported.
+        //
+        // 2. That only the rules whose predicates match the attributes of the
+        //    calling thread are active, and only those whose patterns match
+        //    a category influence that category.
+        //
+        // 3. That the per-thread cache of active rules is refreshed when
+        //    either the attributes of the thread or the rule set changes.
+        //
+        // 4. That, once the cache is current, neither
+        //    `hasRelevantActiveRules` nor `determineThresholdLevels`
+        //    allocates memory.
+        //
+        // Plan:
+        // 1. Create a category manager having categories "EQ.Trades",
+        //    "FX.Quotes", and "MISC", and add `NUM_CLIENTS` rules, each
+        //    having a single ("clientId", `i`) predicate, the pattern "EQ.*"
+        //    or "FX.*" (by the parity of `i`), and threshold levels derived
+        //    from `i`.  Verify the number of relevant rules of each category.
+        //    (C-1)
+        //
+        // 2. Install attribute containers holding different "clientId"
+        //    values in turn, and verify that `hasRelevantActiveRules` and
+        //    `determineThresholdLevels` reflect exactly the rule for that
+        //    client.  (C-2..3)
+        //
+        // 3. Remove the rule for the current client, then add a rule without
+        //    predicates, and verify the results after each change.  (C-3)
+        //
+        // 4. Repeat the queries with a current cache and verify that no
+        //    memory is allocated from the global allocator.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Many per-client rules are evaluated efficiently.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "MANY PER-CLIENT RULES" << endl
+                                  << "=====================" << endl;
+
+        {
+            enum { NUM_CLIENTS = 5000 };
+
+            const ball::ThresholdAggregate CAT_LEVELS(16, 16, 16, 16);
+
+            CatMngr manager(&globalAllocator);
+
+            Obj::initialize(&manager, &globalAllocator);
+
+            Obj *mX = Obj::getContext();  const Obj& X = *mX;
+
+            const ball::Category *EQ   =
+                              manager.addCategory("EQ.Trades", 16, 16, 16, 16);
+            const ball::Category *FX   =
+                              manager.addCategory("FX.Quotes", 16, 16, 16, 16);
+            const ball::Category *MISC =
+                                   manager.addCategory("MISC", 16, 16, 16, 16);
+            ASSERT(EQ);  ASSERT(FX);  ASSERT(MISC);
+
+            if (veryVerbose) cout << "\tAdding rules." << endl;
+
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                const int level = 20 + i % 200;
+
+                ball::Rule rule(i % 2 ? "FX.*" : "EQ.*",
+                                level,
+                                level,
+                                level,
+                                level);
+                rule.addPredicate(ball::Predicate("clientId", i));
+                ASSERTV(i, 1 == manager.addRule(rule));
+            }
+
+            ASSERT(NUM_CLIENTS     == manager.ruleSet().numRules());
+            ASSERT(NUM_CLIENTS / 2 == EQ->numRelevantRules());
+            ASSERT(NUM_CLIENTS / 2 == FX->numRelevantRules());
+            ASSERT(0               == MISC->numRelevantRules());
+
+            ball::ThresholdAggregate levels(0, 0, 0, 0);
+
+            ASSERT(!X.hasRelevantActiveRules(EQ));
+            ASSERT(!X.hasRelevantActiveRules(FX));
+            ASSERT(!X.hasRelevantActiveRules(MISC));
+
+            if (veryVerbose) cout << "\tChanging attributes." << endl;
+
+            const int CLIENTS[] = { 0, 1, 1234, 4999, NUM_CLIENTS + 7 };
+            const int NUM_DATA  = sizeof CLIENTS / sizeof *CLIENTS;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  CLIENT = CLIENTS[ti];
+                const bool KNOWN  = CLIENT < NUM_CLIENTS;
+                const bool IS_EQ  = KNOWN && 0 == CLIENT % 2;
+                const bool IS_FX  = KNOWN && 1 == CLIENT % 2;
+                const int  LEVEL  = 20 + CLIENT % 200;
+
+                const ball::ThresholdAggregate RULE_LEVELS(LEVEL,
+                                                           LEVEL,
+                                                           LEVEL,
+                                                           LEVEL);
+
+                AttributeSet attributes;
+                attributes.insert(ball::Attribute("clientId", CLIENT));
+                Obj::iterator it = mX->addAttributes(&attributes);
+
+                ASSERTV(CLIENT, IS_EQ == X.hasRelevantActiveRules(EQ));
+                ASSERTV(CLIENT, IS_FX == X.hasRelevantActiveRules(FX));
+                ASSERTV(CLIENT, !X.hasRelevantActiveRules(MISC));
+
+                X.determineThresholdLevels(&levels, EQ);
+                ASSERTV(CLIENT, levels == (IS_EQ ? RULE_LEVELS : CAT_LEVELS));
+
+                X.determineThresholdLevels(&levels, FX);
+                ASSERTV(CLIENT, levels == (IS_FX ? RULE_LEVELS : CAT_LEVELS));
+
+                X.determineThresholdLevels(&levels, MISC);
+                ASSERTV(CLIENT, levels == CAT_LEVELS);
+
+                const bsls::Types::Int64 NUM_ALLOCS =
+                                              globalAllocator.numAllocations();
+
+                for (int j = 0; j < 100; ++j) {
+                    X.hasRelevantActiveRules(EQ);
+                    X.hasRelevantActiveRules(FX);
+                    X.determineThresholdLevels(&levels, EQ);
+                    X.determineThresholdLevels(&levels, FX);
+                }
+
+                ASSERTV(CLIENT,
+                        NUM_ALLOCS == globalAllocator.numAllocations());
+
+                mX->removeAttributes(it);
+            }
+
+            if (veryVerbose) cout << "\tChanging rules." << endl;
+
+            AttributeSet attributes;
+            attributes.insert(ball::Attribute("clientId", 1235));
+            Obj::iterator it = mX->addAttributes(&attributes);
+
+            ASSERT( X.hasRelevantActiveRules(FX));
+
+            {
+                ball::Rule rule("FX.*", 55, 55, 55, 55);
+                rule.addPredicate(ball::Predicate("clientId", 1235));
+                ASSERT(1 == manager.removeRule(rule));
+            }
+
+            ASSERT(NUM_CLIENTS / 2 - 1 == FX->numRelevantRules());
+            ASSERT(!X.hasRelevantActiveRules(FX));
+
+            X.determineThresholdLevels(&levels, FX);
+            ASSERT(levels == CAT_LEVELS);
+
+            ASSERT(1 == manager.addRule(ball::Rule("FX.*", 17, 18, 19, 20)));
+
+            ASSERT(NUM_CLIENTS / 2 == FX->numRelevantRules());
+            ASSERT( X.hasRelevantActiveRules(FX));
+            ASSERT(!X.hasRelevantActiveRules(EQ));
+
+            X.determineThresholdLevels(&levels, FX);
+            ASSERT(levels == ball::ThresholdAggregate(17, 18, 19, 20));
+
+            mX->removeAttributes(it);
+
+            ball::AttributeContextProctor proctor;  // destroys context
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // NO FALSE POSITIVES FROM `hasRelevantActiveRules`
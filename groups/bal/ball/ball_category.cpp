@@ -49,6 +49,7 @@ Category::Category(const bsl::string_view&  categoryName,
                                            triggerAllLevel))
 , d_categoryName(categoryName, basicAllocator)
 , d_categoryHolder_p(0)
+, d_numRelevantRules(0)
 , d_relevantRuleMask(0)
 , d_ruleThreshold(0)
 , d_mutex()
@@ -114,6 +114,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_string.h>
 #include <bsl_string_view.h>
 
 namespace BloombergLP {
@@ -130,8 +131,8 @@ class CategoryHolder;
 /// `CategoryManager`.  All threshold levels are integral values in the
 /// range `[0 .. 255]`.
 ///
-/// Implementation Note: The `d_ruleThreshold` and `d_relevantRuleMask`
-/// serve as a cache for logging rule evaluation (see
+/// Implementation Note: The `d_ruleThreshold`, `d_numRelevantRules`, and
+/// `d_relevantRuleMask` serve as a cache for logging rule evaluation (see
 /// `ball_attributecontext`).  They are not meant to be modified by users
 /// of the logging system, and may be modified by `const` operations of the
 /// logging system.
@@ -149,11 +150,18 @@ class Category {
     CategoryHolder       *d_categoryHolder_p;  // linked list of holders of
                                                // this category
 
+    mutable bsls::AtomicInt
+                          d_numRelevantRules;  // the number of rules that
+                                               // are relevant (i.e., whose
+                                               // pattern matches the name of
+                                               // this category)
+
     mutable bsls::AtomicUint
                           d_relevantRuleMask;  // the mask indicating which
-                                               // rules are relevant (i.e.,
-                                               // have been attached to this
-                                               // category)
+                                               // of the rules whose ids are
+                                               // less than
+                                               // `8 * sizeof(MaskType)` are
+                                               // relevant (deprecated)
 
     mutable bsls::AtomicInt d_ruleThreshold;   // numerical maximum of all four
                                                // levels for all relevant rules
@@ -281,14 +289,23 @@ class Category {
     /// evaluation).
     int ruleThreshold() const;
 
-    /// Return a reference to the non-modifiable relevant rule mask for this
-    /// category.  The returned `RuleSet::MaskType` value is a bit-mask,
-    /// where each bit is a boolean value indicating whether the rule at the
-    /// corresponding index (in the rule set of the category manager that
-    /// owns this category) applies at this category.  Note that a rule
-    /// applies to this category if the rule's pattern matches the name
+    /// Return the number of rules (in the rule set of the category manager
+    /// that owns this category) that apply to this category.  Note that a
+    /// rule applies to this category if the rule's pattern matches the name
     /// returned by `categoryName`.
+    int numRelevantRules() const;
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
+    /// Return the relevant rule mask for this category.  The returned
+    /// `RuleSet::MaskType` value is a bit-mask, where each bit is a boolean
+    /// value indicating whether the rule at the corresponding index (in the
+    /// rule set of the category manager that owns this category) applies at
+    /// this category.  Note that the mask describes only the rules whose
+    /// ids are less than `8 * sizeof(RuleSet::MaskType)`.
+    ///
+    /// @DEPRECATED: Use `numRelevantRules` instead.
     RuleSet::MaskType relevantRuleMask() const;
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
     // BDE_VERIFY pragma: pop
 };
 
@@ -418,18 +435,32 @@ class CategoryManagerImpUtil {
     /// specified `ruleThreshold`.
     static void setRuleThreshold(Category *category, int ruleThreshold);
 
+    /// Set the number of rules relevant to the specified `category` to the
+    /// specified `numRules`.
+    static void setNumRelevantRules(Category *category, int numRules);
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
     /// Set the bit in the relevant rule-mask at the specified `ruleIndex`
-    /// in the specified `category` to `true`.
+    /// in the specified `category` to `true`.  The behavior is undefined
+    /// unless `0 <= ruleIndex < 8 * sizeof(RuleSet::MaskType)`.
+    ///
+    /// @DEPRECATED: Use `setNumRelevantRules` instead.
     static void enableRule(Category *category, int ruleIndex);
 
     /// Set the bit in the rule-mask at the specified `ruleIndex` in the
-    /// specified `category` to `false`.
+    /// specified `category` to `false`.  The behavior is undefined unless
+    /// `0 <= ruleIndex < 8 * sizeof(RuleSet::MaskType)`.
+    ///
+    /// @DEPRECATED: Use `setNumRelevantRules` instead.
     static void disableRule(Category *category, int ruleIndex);
 
     /// Set the rule-mask for the specified `category` to the specified
     /// `mask`.
+    ///
+    /// @DEPRECATED: Use `setNumRelevantRules` instead.
     static void setRelevantRuleMask(Category          *category,
                                     RuleSet::MaskType  mask);
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
     // BDE_VERIFY pragma: pop
 };
 
@@ -522,11 +553,19 @@ int Category::ruleThreshold() const
     return d_ruleThreshold.loadAcquire();
 }
 
+inline
+int Category::numRelevantRules() const
+{
+    return d_numRelevantRules.loadAcquire();
+}
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
 inline
 RuleSet::MaskType Category::relevantRuleMask() const
 {
     return d_relevantRuleMask.loadAcquire();
 }
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
 
                         // --------------------
                         // class CategoryHolder
@@ -612,6 +651,14 @@ void CategoryManagerImpUtil::setRuleThreshold(Category *category,
     category->d_ruleThreshold.storeRelease(ruleThreshold);
 }
 
+inline
+void CategoryManagerImpUtil::setNumRelevantRules(Category *category,
+                                                 int       numRules)
+{
+    category->d_numRelevantRules.storeRelease(numRules);
+}
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
 inline
 void CategoryManagerImpUtil::enableRule(Category *category, int ruleIndex)
 {
@@ -648,6 +695,7 @@ void CategoryManagerImpUtil::setRelevantRuleMask(Category          *category,
 {
     category->d_relevantRuleMask.storeRelease(mask);
 }
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
 
 // BDE_VERIFY pragma: pop
 
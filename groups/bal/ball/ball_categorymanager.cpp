@@ -176,21 +176,26 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
 
 void CategoryManager::privateApplyRulesToCategory(Category* category)
 {
-    RuleSet::MaskType mask      = 0;
-    int               threshold = 0;
-    for (int i = 0; i < RuleSet::maxNumRules(); ++i) {
+    int threshold;
+    int numRules = d_ruleSet.numMatchingRules(&threshold,
+                                              category->categoryName());
+
+    CategoryManagerImpUtil::setNumRelevantRules(category, numRules);
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
+    // Maintain the deprecated rule mask, which describes only the rules whose
+    // ids are less than the number of bits in a `RuleSet::MaskType`.
+
+    const int         maskSize = 8 * sizeof(RuleSet::MaskType);
+    RuleSet::MaskType mask     = 0;
+    for (int i = 0; 0 < numRules && i < maskSize; ++i) {
         const Rule *rule = d_ruleSet.getRuleById(i);
         if (rule && rule->isMatch(category->categoryName())) {
             mask = bdlb::BitUtil::withBitSet(mask, i);
-            threshold = bsl::max(threshold,
-                                 ThresholdAggregate::maxLevel(
-                                         rule->recordLevel(),
-                                         rule->passLevel(),
-                                         rule->triggerLevel(),
-                                         rule->triggerAllLevel()));
         }
     }
     CategoryManagerImpUtil::setRelevantRuleMask(category, mask);
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
     if (threshold != category->ruleThreshold()) {
         CategoryManagerImpUtil::setRuleThreshold(category, threshold);
         CategoryManagerImpUtil::updateThresholdForHolders(category);
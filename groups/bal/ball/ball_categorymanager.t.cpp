@@ -494,14 +494,32 @@ extern "C" void *ruleThreadTest(void *args)
         ASSERT(0 <= ruleId3);
         ASSERT(0 <= ruleId4);
         for (int j = 0; j < NUM_NAMES; ++j) {
+            // `NAMES[i]` is matched by `rule1`, `rule3`, and possibly `rule2`
+            // and the `rule3` of other threads; `NAMES[j]` is matched by the
+            // permanent `rule1` of earlier iterations if `j < i`, and by no
+            // rule if `i < j`.
+
+            const Entry *entry    = mX.lookupCategory(NAMES[j]);
+            const int    numRules = entry->numRelevantRules();
+            if (j < i) {
+                ASSERTV(i, j, numRules, 1 == numRules);
+            }
+            else if (j == i) {
+                ASSERTV(i, j, numRules, 2 <= numRules);
+            }
+            else {
+                ASSERTV(i, j, numRules, 0 == numRules);
+            }
+
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
             bool exp = i == j;
-            const Entry *entry = mX.lookupCategory(NAMES[j]);
             ASSERT(exp == bdlb::BitUtil::isBitSet(entry->relevantRuleMask(),
                                                   ruleId1));
             ASSERT(exp == bdlb::BitUtil::isBitSet(entry->relevantRuleMask(),
                                                   ruleId3));
             ASSERT(!bdlb::BitUtil::isBitSet(entry->relevantRuleMask(),
                                             ruleId4));
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
         }
 
         mX.removeRule(rule2);
@@ -520,7 +538,10 @@ extern "C" void *ruleThreadTest(void *args)
         barrier.wait();
 
         const Entry *entry = mX.lookupCategory(US);
+        ASSERT(0 < entry->numRelevantRules());
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
         ASSERT(bdlb::BitUtil::isBitSet(entry->relevantRuleMask(), ruleId4));
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
         {
             bslmt::LockGuard<bslmt::Mutex> guard(&mX.rulesetMutex());
             Int64 seqNo = X.ruleSetSequenceNumber();
@@ -653,7 +674,8 @@ void testDrqs171004031(unsigned int addCategoryThreads,
     handles.reserve(addCategoryThreads + lookupCategoryThreads);
 
     // There must be rules in the system to trigger the collision.
-    for (int rule = 0; rule < ball::RuleSet::maxNumRules(); ++rule) {
+    const int k_NUM_RULES = 32;
+    for (int rule = 0; rule < k_NUM_RULES; ++rule) {
         testData.d_mx.addRule(ball::Rule("TSAN*",
                                          rule+2,
                                          rule+2,
@@ -1603,8 +1625,8 @@ int main(int argc, char *argv[])
         // TESTING: `addRules`, `removeRules`
         //
         // Concerns:  That `addRules` and `removeRules` correctly update the
-        //   category manager's rule set and the relevant rule masks for the
-        //   managed categories, and return the correct value.
+        //   category manager's rule set and the number of relevant rules for
+        //   the managed categories, and return the correct value.
         //
         // Plan:
         //   For each possible subset of a set of categories, create a rule
@@ -1612,7 +1634,7 @@ int main(int argc, char *argv[])
         //   set of rules to the category manager and verify: (1) the return
         //   value for `addRules` is the number of rules (2) the sequence
         //   number is updated (3) the category manager's rule set contains
-        //   the newly added rules, and (4) that the relevant rule bit mask
+        //   the newly added rules, and (4) that the number of relevant rules
         //   for each category is correct.  Then, create a rule set for all
         //   categories and invoke `addRules`, verify the return value for
         //   the `addRules` method is the number of rules that were *not*
@@ -1665,13 +1687,15 @@ int main(int argc, char *argv[])
             ASSERT(0     == mX.addRules(rules));
             ASSERT(seqNo == X.ruleSetSequenceNumber());
 
-            // Verify the relevant rule masks for each category.
+            // Verify the number of relevant rules for each category.
             for (int i = 0; i < NUM_NAMES; ++i) {
-                if (bdlb::BitUtil::isBitSet(mask, i)) {
+                const bool isSet = bdlb::BitUtil::isBitSet(mask, i);
+                if (isSet) {
                     ball::Rule rule(NAMES[i], LEVELS[i][0], LEVELS[i][1],
                                               LEVELS[i][2], LEVELS[i][3]);
                     int ruleId = X.ruleSet().ruleId(rule);
                     ASSERT(0 <= ruleId);
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
                     for (int j = 0; j < NUM_NAMES; ++j) {
                         bool  isSet = i == j;
                         const Entry *cat = X.lookupCategory(NAMES[j]);
@@ -1679,7 +1703,10 @@ int main(int argc, char *argv[])
                                                    cat->relevantRuleMask(),
                                                    ruleId));
                     }
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
                 }
+                const Entry *cat = X.lookupCategory(NAMES[i]);
+                ASSERTV(mask, i, (isSet ? 1 : 0) == cat->numRelevantRules());
             }
 
             ball::RuleSet allRules(&ta);
@@ -1711,14 +1738,16 @@ int main(int argc, char *argv[])
             }
             ASSERT(0 == mX.removeRules(rules));
 
-            // Verify the relevant rule bit mask for each category after we
+            // Verify the number of relevant rules for each category after we
             // have removed the rules.
             for (int i = 0; i < NUM_NAMES; ++i) {
-                if (!bdlb::BitUtil::isBitSet(mask, i)) {
+                const bool isSet = !bdlb::BitUtil::isBitSet(mask, i);
+                if (isSet) {
                     ball::Rule rule(NAMES[i], LEVELS[i][0], LEVELS[i][1],
                                               LEVELS[i][2], LEVELS[i][3]);
                     int ruleId = X.ruleSet().ruleId(rule);
                     ASSERT(0 <= ruleId);
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
                     for (int j = 0; j < NUM_NAMES; ++j) {
                         bool  isSet = i == j;
                         const Entry *cat = X.lookupCategory(NAMES[j]);
@@ -1726,7 +1755,10 @@ int main(int argc, char *argv[])
                                                    cat->relevantRuleMask(),
                                                    ruleId));
                     }
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
                 }
+                const Entry *cat = X.lookupCategory(NAMES[i]);
+                ASSERTV(mask, i, (isSet ? 1 : 0) == cat->numRelevantRules());
             }
 
             // Remove all the rules.  Note that this removes the remaining
@@ -1742,7 +1774,7 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //   `addRule`, `removeRule`, `removeAllRules` update the set of rules
-        //   and the relevant rule masks for the affected ball::Category
+        //   and the number of relevant rules for the affected ball::Category
         //   objects.
         //
         // Plan:
@@ -1750,8 +1782,8 @@ int main(int argc, char *argv[])
         //    and verify: (1) the return value for the `addRule` method, (2)
         //    that the rule has been added to the category manager's set of
         //    rules (3) that the sequence number has been updated, and (4) that
-        //    relevant rule masks for the categories is correct.  Create a
-        //    second rule, for the same category (with an additional
+        //    the number of relevant rules for the categories is correct.
+        //    Create a second rule, for the same category (with an additional
         //    predicate), and add it to the category manager.  Verify the same
         //    4 points.  Finally remove the second rule, and verify the same 4
         //    points.
@@ -1793,12 +1825,17 @@ int main(int argc, char *argv[])
             int ruleId1 = X.ruleSet().ruleId(rule1);
             ASSERT(0 <= ruleId1);
 
+            // The rules added for the categories preceding `NAMES[i]` remain.
+
             for (int j = 0; j < NUM_NAMES; ++j) {
-                bool  isSet = i == j;
                 const Entry *cat = X.lookupCategory(NAMES[j]);
+                ASSERTV(i, j, (j <= i ? 1 : 0) == cat->numRelevantRules());
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
+                bool  isSet = i == j;
                 ASSERT(isSet == bdlb::BitUtil::isBitSet(
                                                        cat->relevantRuleMask(),
                                                        ruleId1));
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
             }
 
             ball::Rule rule2(NAMES[i], LEVELS[i][0], LEVELS[i][1],
@@ -1815,14 +1852,18 @@ int main(int argc, char *argv[])
             int ruleId2 = X.ruleSet().ruleId(rule2);
             ASSERT(0 <= ruleId2)
             for (int j = 0; j < NUM_NAMES; ++j) {
-                bool isSet = i == j;
                 const Entry *cat = X.lookupCategory(NAMES[j]);
+                const int    exp = j < i ? 1 : j == i ? 2 : 0;
+                ASSERTV(i, j, exp == cat->numRelevantRules());
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
+                bool isSet = i == j;
                 ASSERT(isSet == bdlb::BitUtil::isBitSet(
                                                        cat->relevantRuleMask(),
                                                        ruleId1));
                 ASSERT(isSet == bdlb::BitUtil::isBitSet(
                                                        cat->relevantRuleMask(),
                                                        ruleId2));
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
             }
 
             // Remove the second rule for this category.
@@ -1832,14 +1873,17 @@ int main(int argc, char *argv[])
             seqNo = X.ruleSetSequenceNumber();
 
             for (int j = 0; j < NUM_NAMES; ++j) {
-                bool isSet = i == j;
                 const Entry *cat = X.lookupCategory(NAMES[j]);
+                ASSERTV(i, j, (j <= i ? 1 : 0) == cat->numRelevantRules());
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
+                bool isSet = i == j;
                 ASSERT(isSet == bdlb::BitUtil::isBitSet(
                                                        cat->relevantRuleMask(),
                                                        ruleId1));
                 ASSERT(false == bdlb::BitUtil::isBitSet(
                                                        cat->relevantRuleMask(),
                                                        ruleId2));
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
             }
         }
 
@@ -1848,7 +1892,10 @@ int main(int argc, char *argv[])
         ASSERT(seqNo < X.ruleSetSequenceNumber());
         for (int i = 0; i < NUM_NAMES; ++i) {
             const Entry *cat = X.lookupCategory(NAMES[i]);
+            ASSERT(0 == cat->numRelevantRules());
+#ifndef BDE_OMIT_INTERNAL_DEPRECATED
             ASSERT(0 == cat->relevantRuleMask());
+#endif // BDE_OMIT_INTERNAL_DEPRECATED
         }
       } break;
       case 7: {
@@ -0,0 +1,570 @@
+// ball_deferredlogcodec.cpp                                          -*-C++-*-
+#include <ball_deferredlogcodec.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogcodec_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// `printf`-style conversions are formatted one at a time by `snprintf`: the
+// conversion specification is copied (with its length modifier replaced by
+// the one matching the decoded value) and applied to the decoded value.
+//
+// `bsl::format`-style format strings are formatted by `bsl::vformat`, with
+// each decoded argument wrapped in a `u::FormatArgument`, for which a
+// `bsl::formatter` is defined below.  That formatter saves the format
+// specification of the replacement field, and formats the underlying value
+// with a replacement field having that specification.  Note that the
+// formatter is defined for a type local to this component, so that it cannot
+// conflict with any other formatter.
+
+#include <bslfmt_format.h>
+
+#include <bsls_exceptionutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_c_stdio.h>   // for 'snprintf'
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+                            // ====================
+                            // class FormatArgument
+                            // ====================
+
+/// This class wraps a `ball::DeferredLogArgument` to be formatted by
+/// `bsl::vformat`.
+class FormatArgument {
+
+    // DATA
+    const ball::DeferredLogArgument *d_argument_p;  // wrapped argument
+
+  public:
+    // CREATORS
+
+    /// Create a wrapper around the specified `argument`.
+    explicit FormatArgument(const ball::DeferredLogArgument& argument)
+    : d_argument_p(&argument)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return the wrapped argument.
+    const ball::DeferredLogArgument& argument() const
+    {
+        return *d_argument_p;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+/// This specialization of `bsl::formatter` formats a decoded argument of a
+/// deferred log message as if it were the underlying value.
+template <>
+struct formatter<BloombergLP::u::FormatArgument, char> {
+
+    // DATA
+    bsl::string d_format;  // replacement field with the saved specification
+
+    // MANIPULATORS
+
+    /// Save the format specification at the beginning of the specified
+    /// `context`, and return an iterator to the `}` ending it.  Throw
+    /// `bsl::format_error` if the specification is not terminated, or has a
+    /// nested replacement field.
+    template <class t_PARSE_CONTEXT>
+    typename t_PARSE_CONTEXT::iterator parse(t_PARSE_CONTEXT& context)
+    {
+        typename t_PARSE_CONTEXT::iterator current = context.begin();
+        typename t_PARSE_CONTEXT::iterator end     = context.end();
+
+        d_format = "{:";
+        for (; current != end && '}' != *current; ++current) {
+            if ('{' == *current) {
+                BSLS_THROW(bsl::format_error("nested replacement field"));
+            }
+            d_format.push_back(*current);
+        }
+        if (current == end) {
+            BSLS_THROW(bsl::format_error("missing '}'"));
+        }
+        d_format.push_back('}');
+        return current;
+    }
+
+    // ACCESSORS
+
+    /// Format the value of the specified `value` to the output of the
+    /// specified `context` using the saved specification, and return the
+    /// iterator to the end of the output.  Throw `bsl::format_error` if
+    /// `value` has no underlying value, or if the saved specification is
+    /// invalid for the type of that value.
+    template <class t_FORMAT_CONTEXT>
+    typename t_FORMAT_CONTEXT::iterator format(
+                                   const BloombergLP::u::FormatArgument& value,
+                                   t_FORMAT_CONTEXT&                  context)
+                                                                          const
+    {
+        typedef BloombergLP::ball::DeferredLogArgument Argument;
+
+        const Argument& argument = value.argument();
+        bsl::string     result;
+
+        switch (argument.type()) {
+          case Argument::e_BOOL: {
+            bool v = argument.theBool();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_CHAR: {
+            char v = argument.theChar();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_INT: {
+            long long v = argument.theInt();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_UINT: {
+            unsigned long long v = argument.theUint();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_DOUBLE: {
+            double v = argument.theDouble();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_POINTER: {
+            const void *v = argument.thePointer();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          case Argument::e_STRING: {
+            bsl::string_view v = argument.theString();
+            result = bsl::vformat(d_format, bsl::make_format_args(v));
+          } break;
+          default: {
+            BSLS_THROW(bsl::format_error("missing argument"));
+          } break;
+        }
+        return bsl::copy(result.begin(), result.end(), context.out());
+    }
+};
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef ball::DeferredLogArgument Argument;
+
+/// Load into the specified `result` the value of the specified `argument`
+/// converted to a signed integer.  Return 0 on success, and a non-zero value
+/// if `argument` is not an integer or a character.
+int toInt(bsls::Types::Int64 *result, const Argument& argument)
+{
+    switch (argument.type()) {
+      case Argument::e_BOOL: {
+        *result = argument.theBool();
+      } break;
+      case Argument::e_CHAR: {
+        *result = argument.theChar();
+      } break;
+      case Argument::e_INT: {
+        *result = argument.theInt();
+      } break;
+      case Argument::e_UINT: {
+        *result = static_cast<bsls::Types::Int64>(argument.theUint());
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+/// Load into the specified `result` the value of the specified `argument`
+/// converted to a `double`.  Return 0 on success, and a non-zero value if
+/// `argument` is not a number.
+int toDouble(double *result, const Argument& argument)
+{
+    switch (argument.type()) {
+      case Argument::e_DOUBLE: {
+        *result = argument.theDouble();
+      } break;
+      case Argument::e_INT: {
+        *result = static_cast<double>(argument.theInt());
+      } break;
+      case Argument::e_UINT: {
+        *result = static_cast<double>(argument.theUint());
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+/// Load into the specified `result` the value of the specified `argument`
+/// formatted as by `{}` in a `bsl::format` format string.
+void toString(bsl::string *result, const Argument& argument)
+{
+    if (Argument::e_STRING == argument.type()) {
+        result->assign(argument.theString().data(),
+                       argument.theString().length());
+        return;                                                       // RETURN
+    }
+    FormatArgument wrapper(argument);
+    *result = bsl::vformat("{}", bsl::make_format_args(wrapper));
+}
+
+/// Append to the specified `result` the output of `snprintf` called with
+/// the specified `specification` and `value`.
+template <class TYPE>
+void appendPrintf(bsl::string *result,
+                  const char  *specification,
+                  TYPE         value)
+{
+    char buffer[128];
+    int  length = snprintf(buffer, sizeof buffer, specification, value);
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+    if (static_cast<bsl::size_t>(length) < sizeof buffer) {
+        result->append(buffer, length);
+        return;                                                       // RETURN
+    }
+    const bsl::size_t offset = result->length();
+    result->resize(offset + length + 1);
+    snprintf(&(*result)[offset], length + 1, specification, value);
+    result->resize(offset + length);
+}
+
+/// Load into the specified `result` the message formatted from the
+/// specified `printf`-style `format` and the specified `arguments`.
+void formatPrintf(bsl::string                   *result,
+                  const bsl::string_view&        format,
+                  const bsl::vector<Argument>&   arguments)
+{
+    const char        *current = format.data();
+    const char *const  end     = current + format.length();
+    bsl::size_t        index   = 0;
+    bsl::string        specification;
+    bsl::string        string;
+
+    while (current != end) {
+        const char *percent = bsl::find(current, end, '%');
+        result->append(current, percent);
+        if (percent == end) {
+            return;                                                   // RETURN
+        }
+        current = percent + 1;
+        if (current != end && '%' == *current) {
+            result->push_back('%');
+            ++current;
+            continue;
+        }
+
+        // Copy the flags, width, and precision, consuming the arguments of
+        // `*` widths and precisions.
+
+        specification = "%";
+        while (current != end && bsl::strchr("-+ #0'", *current)) {
+            specification.push_back(*current++);
+        }
+        for (int field = 0; field < 2 && current != end; ++field) {
+            if (1 == field) {
+                if ('.' != *current) {
+                    break;
+                }
+                specification.push_back(*current++);
+            }
+            if (current != end && '*' == *current) {
+                bsls::Types::Int64 value;
+                if (index == arguments.size()
+                 || 0 != toInt(&value, arguments[index])) {
+                    result->append("<invalid '*' argument>");
+                    return;                                           // RETURN
+                }
+                ++index;
+                char buffer[32];
+                snprintf(buffer, sizeof buffer, "%lld",
+                         static_cast<long long>(value));
+                specification.append(buffer);
+                ++current;
+            }
+            else {
+                while (current != end && '0' <= *current && *current <= '9') {
+                    specification.push_back(*current++);
+                }
+            }
+        }
+
+        // Skip the length modifier, which is replaced by the one matching the
+        // decoded value.
+
+        while (current != end && bsl::strchr("hlLqjzt", *current)) {
+            ++current;
+        }
+        if (current == end) {
+            result->append("<incomplete conversion>");
+            return;                                                   // RETURN
+        }
+        const char conversion = *current++;
+        if (index == arguments.size()) {
+            result->append("<missing argument>");
+            return;                                                   // RETURN
+        }
+        const Argument& argument = arguments[index++];
+
+        switch (conversion) {
+          case 'd':
+          case 'i': {
+            bsls::Types::Int64 value;
+            if (0 != toInt(&value, argument)) {
+                result->append("<invalid argument for %d>");
+                return;                                               // RETURN
+            }
+            specification += "ll";
+            specification.push_back(conversion);
+            appendPrintf(result,
+                         specification.c_str(),
+                         static_cast<long long>(value));
+          } break;
+          case 'o':
+          case 'u':
+          case 'x':
+          case 'X': {
+            bsls::Types::Int64 value;
+            if (0 != toInt(&value, argument)) {
+                result->append("<invalid argument for %u>");
+                return;                                               // RETURN
+            }
+            specification += "ll";
+            specification.push_back(conversion);
+            appendPrintf(result,
+                         specification.c_str(),
+                         static_cast<unsigned long long>(value));
+          } break;
+          case 'c': {
+            bsls::Types::Int64 value;
+            if (0 != toInt(&value, argument)) {
+                result->append("<invalid argument for %c>");
+                return;                                               // RETURN
+            }
+            specification.push_back(conversion);
+            appendPrintf(result,
+                         specification.c_str(),
+                         static_cast<int>(value));
+          } break;
+          case 'e':
+          case 'E':
+          case 'f':
+          case 'F':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A': {
+            double value;
+            if (0 != toDouble(&value, argument)) {
+                result->append("<invalid argument for %f>");
+                return;                                               // RETURN
+            }
+            specification.push_back(conversion);
+            appendPrintf(result, specification.c_str(), value);
+          } break;
+          case 's': {
+            toString(&string, argument);
+            specification.push_back(conversion);
+            appendPrintf(result, specification.c_str(), string.c_str());
+          } break;
+          case 'p': {
+            if (Argument::e_POINTER != argument.type()) {
+                result->append("<invalid argument for %p>");
+                return;                                               // RETURN
+            }
+            specification.push_back(conversion);
+            appendPrintf(result,
+                         specification.c_str(),
+                         argument.thePointer());
+          } break;
+          default: {
+            result->append("<unsupported conversion>");
+            return;                                                   // RETURN
+          }
+        }
+    }
+}
+
+/// Load into the specified `result` the message formatted from the
+/// specified `bsl::format`-style `format` and the specified `arguments`.
+void formatFormat(bsl::string                  *result,
+                  const bsl::string_view&       format,
+                  const bsl::vector<Argument>&  arguments)
+{
+    enum { k_MAX = ball::DeferredLogCodec::k_MAX_FORMAT_ARGUMENTS };
+
+    const Argument none;
+    FormatArgument a[k_MAX] = {
+        FormatArgument(none), FormatArgument(none), FormatArgument(none),
+        FormatArgument(none), FormatArgument(none), FormatArgument(none),
+        FormatArgument(none), FormatArgument(none), FormatArgument(none),
+        FormatArgument(none), FormatArgument(none), FormatArgument(none),
+        FormatArgument(none), FormatArgument(none), FormatArgument(none),
+        FormatArgument(none)
+    };
+
+    const bsl::size_t count = bsl::min<bsl::size_t>(arguments.size(), k_MAX);
+    for (bsl::size_t i = 0; i < count; ++i) {
+        a[i] = FormatArgument(arguments[i]);
+    }
+
+    BSLS_TRY {
+        *result = bsl::vformat(format,
+                               bsl::make_format_args(a[0],  a[1],  a[2],
+                                                     a[3],  a[4],  a[5],
+                                                     a[6],  a[7],  a[8],
+                                                     a[9],  a[10], a[11],
+                                                     a[12], a[13], a[14],
+                                                     a[15]));
+    }
+    BSLS_CATCH(const bsl::format_error& error) {
+        result->clear();
+        result->append(format.data(), format.length());
+        result->append(" <");
+        result->append(error.what());
+        result->push_back('>');
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace ball {
+
+                          // -----------------------
+                          // struct DeferredLogCodec
+                          // -----------------------
+
+// CLASS METHODS
+int DeferredLogCodec::decode(bsl::vector<DeferredLogArgument> *arguments,
+                             const char                       *buffer,
+                             bsl::size_t                       size)
+{
+    BSLS_ASSERT(arguments);
+    BSLS_ASSERT(buffer || 0 == size);
+
+    arguments->clear();
+
+    const char *const end = buffer + size;
+    while (buffer != end) {
+        DeferredLogArgument argument;
+        const char          tag       = *buffer;
+        const bsl::size_t   remaining = end - buffer;
+
+        switch (tag) {
+          case e_TAG_BOOL:
+          case e_TAG_CHAR: {
+            if (remaining < k_SMALL_SIZE) {
+                return -1;                                            // RETURN
+            }
+            if (e_TAG_BOOL == tag) {
+                argument.setBool(0 != buffer[1]);
+            }
+            else {
+                argument.setChar(buffer[1]);
+            }
+            buffer += k_SMALL_SIZE;
+          } break;
+          case e_TAG_INT:
+          case e_TAG_UINT:
+          case e_TAG_DOUBLE:
+          case e_TAG_POINTER: {
+            if (remaining < k_SCALAR_SIZE) {
+                return -1;                                            // RETURN
+            }
+            switch (tag) {
+              case e_TAG_INT: {
+                bsls::Types::Int64 value;
+                bsl::memcpy(&value, buffer + 1, 8);
+                argument.setInt(value);
+              } break;
+              case e_TAG_UINT: {
+                bsls::Types::Uint64 value;
+                bsl::memcpy(&value, buffer + 1, 8);
+                argument.setUint(value);
+              } break;
+              case e_TAG_DOUBLE: {
+                double value;
+                bsl::memcpy(&value, buffer + 1, 8);
+                argument.setDouble(value);
+              } break;
+              default: {
+                const void *value;
+                bsl::memcpy(&value, buffer + 1, sizeof value);
+                argument.setPointer(value);
+              } break;
+            }
+            buffer += k_SCALAR_SIZE;
+          } break;
+          case e_TAG_STRING: {
+            unsigned int length;
+            if (remaining < k_STRING_SIZE) {
+                return -1;                                            // RETURN
+            }
+            bsl::memcpy(&length, buffer + 1, 4);
+            if (remaining - k_STRING_SIZE < length) {
+                return -1;                                            // RETURN
+            }
+            argument.setString(bsl::string_view(buffer + k_STRING_SIZE,
+                                                length));
+            buffer += k_STRING_SIZE + length;
+          } break;
+          default: {
+            return -1;                                                // RETURN
+          }
+        }
+        arguments->push_back(argument);
+    }
+    return 0;
+}
+
+void DeferredLogCodec::format(
+                         bsl::string                             *result,
+                         Style                                    style,
+                         const bsl::string_view&                  format,
+                         const bsl::vector<DeferredLogArgument>&  arguments)
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+    if (e_PRINTF == style) {
+        u::formatPrintf(result, format, arguments);
+    }
+    else {
+        u::formatFormat(result, format, arguments);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
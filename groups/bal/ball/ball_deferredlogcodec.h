@@ -0,0 +1,850 @@
+// ball_deferredlogcodec.h                                            -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGCODEC
+#define INCLUDED_BALL_DEFERREDLOGCODEC
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a binary encoding of deferred log message arguments.
+//
+//@CLASSES:
+//  ball::DeferredLogArgument: decoded argument of a deferred log message
+//  ball::DeferredLogCodec: namespace for encoding and formatting arguments
+//
+//@SEE_ALSO: ball_deferredlogger, ball_deferredlogfileutil
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `ball::DeferredLogCodec`, that encodes the arguments of a log statement into
+// a compact binary representation, decodes that representation into a
+// sequence of `ball::DeferredLogArgument` objects, and formats a message from
+// a format string and decoded arguments.  Encoding is meant to be done on the
+// thread executing the log statement, and is cheap (it copies the bytes of
+// each argument, and the characters of each string argument); decoding and
+// formatting are meant to be done later, on another thread or in another
+// process (see `ball_deferredlogger`).
+//
+///Supported Argument Types
+///------------------------
+// The following argument types can be encoded:
+//
+// * `bool` and `char`.
+// * Signed and unsigned integral types (including unscoped enumerations),
+//   encoded as 64-bit integers.
+// * `float`, `double`, and `long double`, encoded as `double`.
+// * `const char *` (and character arrays), `bsl::string`, `std::string`, and
+//   `bsl::string_view`, encoded as the characters of the string.  A null
+//   `const char *` is encoded as the string "(null)".
+// * Pointers to objects, encoded as their address.
+//
+// Encoding an argument of any other type fails to compile.  Note in
+// particular that a deferred log message cannot capture a value of a
+// user-defined type: such a value must be converted to a string before it is
+// logged.
+//
+///Encoding
+///--------
+// The encoding of each argument is a one-byte type tag followed by the value:
+// one byte for `bool` and `char`, eight bytes (in native byte order) for
+// integral, floating-point, and pointer values, and, for strings, a four-byte
+// length followed by the characters.  Values are not aligned, so the
+// encoding of a sequence of arguments is the concatenation of the encodings
+// of the arguments.  Note that the encoding is not portable between
+// platforms of different byte order.
+//
+///Format Styles
+///-------------
+// Two styles of format string are supported:
+//
+// * `e_PRINTF`: a `printf`-style format string, as used by `BALL_LOGVA`.
+//   Each conversion specification consumes the next argument (or, for a `*`
+//   width or precision, the next two or three), which is converted to the
+//   type implied by the conversion specifier (the length modifier is
+//   ignored): `d` and `i` to a signed integer, `o`, `u`, `x`, `X`, and `c`
+//   to an unsigned integer or character, `e`, `f`, `g`, `a` (and their
+//   uppercase variants) to `double`, `s` to a string (an argument that is
+//   not a string is printed as with `{}` in the `e_FORMAT` style), and `p`
+//   to a pointer.  `%n` is not supported.
+// * `e_FORMAT`: a `bsl::format` format string, as used by `BALL_FMT`.
+//   Replacement fields may refer to at most `k_MAX_FORMAT_ARGUMENTS`
+//   arguments, and may have any format specification valid for the type of
+//   the argument, except that nested replacement fields (e.g., `{:{}}`) are
+//   not supported.
+//
+// If the format string and the arguments do not match (e.g., there are
+// fewer arguments than conversion specifications), the formatted message
+// ends with a description of the error, enclosed in `<` and `>`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Formatting a Message
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a log statement must capture its arguments now, and format
+// them later.
+//
+// First, we compute the size of the encoding of the arguments, and encode
+// them into a buffer:
+// ```
+// const char       *format = "order %d: %s at %.2f";
+// bsl::string       symbol("IBM");
+//
+// const bsl::size_t size = ball::DeferredLogCodec::encodedSize(17,
+//                                                              symbol,
+//                                                              134.5);
+//
+// char buffer[64];
+// assert(size <= sizeof buffer);
+//
+// char *end = ball::DeferredLogCodec::encode(buffer, 17, symbol, 134.5);
+// assert(buffer + size == end);
+// ```
+// Then, later, we decode the arguments:
+// ```
+// bsl::vector<ball::DeferredLogArgument> arguments;
+// int rc = ball::DeferredLogCodec::decode(&arguments, buffer, size);
+// assert(0 == rc);
+// assert(3 == arguments.size());
+// assert(ball::DeferredLogArgument::e_STRING == arguments[1].type());
+// ```
+// Finally, we format the message:
+// ```
+// bsl::string message;
+// ball::DeferredLogCodec::format(&message,
+//                                ball::DeferredLogCodec::e_PRINTF,
+//                                format,
+//                                arguments);
+// assert("order 17: IBM at 134.50" == message);
+// ```
+
+#include <balscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+#include <string>
+
+namespace BloombergLP {
+namespace ball {
+
+                         // =========================
+                         // class DeferredLogArgument
+                         // =========================
+
+/// This simply constrained attribute class holds one decoded argument of a
+/// deferred log message: a type, and a value of that type.  The characters
+/// of a string value are not owned: they are those of the encoded arguments
+/// from which the argument was decoded.
+class DeferredLogArgument {
+
+  public:
+    // TYPES
+    enum Type {
+        e_NONE,      // no argument
+        e_BOOL,      // `bool`
+        e_CHAR,      // `char`
+        e_INT,       // signed integer
+        e_UINT,      // unsigned integer
+        e_DOUBLE,    // floating-point number
+        e_POINTER,   // object address
+        e_STRING     // string
+    };
+
+  private:
+    // DATA
+    Type                 d_type;     // type of the value
+    union {
+        bool                d_bool;
+        char                d_char;
+        bsls::Types::Int64  d_int;
+        bsls::Types::Uint64 d_uint;
+        double              d_double;
+        const void         *d_pointer_p;
+    };
+    bsl::string_view     d_string;   // value, if `e_STRING == d_type`
+
+  public:
+    // CREATORS
+
+    /// Create an argument of type `e_NONE`.
+    DeferredLogArgument();
+
+    // MANIPULATORS
+
+    /// Set this argument to the specified `value` of type `e_BOOL`.
+    void setBool(bool value);
+
+    /// Set this argument to the specified `value` of type `e_CHAR`.
+    void setChar(char value);
+
+    /// Set this argument to the specified `value` of type `e_DOUBLE`.
+    void setDouble(double value);
+
+    /// Set this argument to the specified `value` of type `e_INT`.
+    void setInt(bsls::Types::Int64 value);
+
+    /// Set this argument to the specified `value` of type `e_POINTER`.
+    void setPointer(const void *value);
+
+    /// Set this argument to the specified `value` of type `e_STRING`.  The
+    /// characters of `value` are not copied.
+    void setString(const bsl::string_view& value);
+
+    /// Set this argument to the specified `value` of type `e_UINT`.
+    void setUint(bsls::Types::Uint64 value);
+
+    // ACCESSORS
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_BOOL == type()`.
+    bool theBool() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_CHAR == type()`.
+    char theChar() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_DOUBLE == type()`.
+    double theDouble() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_INT == type()`.
+    bsls::Types::Int64 theInt() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_POINTER == type()`.
+    const void *thePointer() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_STRING == type()`.
+    const bsl::string_view& theString() const;
+
+    /// Return the value of this argument.  The behavior is undefined unless
+    /// `e_UINT == type()`.
+    bsls::Types::Uint64 theUint() const;
+
+    /// Return the type of this argument.
+    Type type() const;
+};
+
+                          // =======================
+                          // struct DeferredLogCodec
+                          // =======================
+
+/// This utility `struct` provides a namespace for functions encoding the
+/// arguments of a log statement, decoding them, and formatting a message
+/// from decoded arguments.
+struct DeferredLogCodec {
+
+    // TYPES
+    enum Style {
+        e_PRINTF,   // `printf`-style format string
+        e_FORMAT    // `bsl::format`-style format string
+    };
+
+    enum {
+        k_MAX_FORMAT_ARGUMENTS = 16  // arguments usable by an `e_FORMAT`
+                                     // format string
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum Tag {
+        // Type tags of the encoding (values of `DeferredLogArgument::Type`).
+
+        e_TAG_BOOL    = DeferredLogArgument::e_BOOL,
+        e_TAG_CHAR    = DeferredLogArgument::e_CHAR,
+        e_TAG_INT     = DeferredLogArgument::e_INT,
+        e_TAG_UINT    = DeferredLogArgument::e_UINT,
+        e_TAG_DOUBLE  = DeferredLogArgument::e_DOUBLE,
+        e_TAG_POINTER = DeferredLogArgument::e_POINTER,
+        e_TAG_STRING  = DeferredLogArgument::e_STRING
+    };
+
+    enum {
+        k_SCALAR_SIZE = 1 + 8,  // encoded size of an 8-byte value
+        k_SMALL_SIZE  = 1 + 1,  // encoded size of a 1-byte value
+        k_STRING_SIZE = 1 + 4   // encoded size of a string, excluding its
+                                // characters
+    };
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the size of the encoding of the specified `value`.
+    static bsl::size_t argumentSize(bool                      value);
+    static bsl::size_t argumentSize(char                      value);
+    static bsl::size_t argumentSize(signed char               value);
+    static bsl::size_t argumentSize(unsigned char             value);
+    static bsl::size_t argumentSize(short                     value);
+    static bsl::size_t argumentSize(unsigned short            value);
+    static bsl::size_t argumentSize(int                       value);
+    static bsl::size_t argumentSize(unsigned int              value);
+    static bsl::size_t argumentSize(long                      value);
+    static bsl::size_t argumentSize(unsigned long             value);
+    static bsl::size_t argumentSize(long long                 value);
+    static bsl::size_t argumentSize(unsigned long long        value);
+    static bsl::size_t argumentSize(float                     value);
+    static bsl::size_t argumentSize(double                    value);
+    static bsl::size_t argumentSize(long double               value);
+    static bsl::size_t argumentSize(const void               *value);
+    static bsl::size_t argumentSize(const char               *value);
+    static bsl::size_t argumentSize(const bsl::string&        value);
+    static bsl::size_t argumentSize(const std::string&        value);
+    static bsl::size_t argumentSize(const bsl::string_view&   value);
+
+    /// Encode the specified `value` into the specified `buffer`, and return
+    /// the address following the encoding.
+    static char *encodeArgument(char *buffer, bool                    value);
+    static char *encodeArgument(char *buffer, char                    value);
+    static char *encodeArgument(char *buffer, signed char             value);
+    static char *encodeArgument(char *buffer, unsigned char           value);
+    static char *encodeArgument(char *buffer, short                   value);
+    static char *encodeArgument(char *buffer, unsigned short          value);
+    static char *encodeArgument(char *buffer, int                     value);
+    static char *encodeArgument(char *buffer, unsigned int            value);
+    static char *encodeArgument(char *buffer, long                    value);
+    static char *encodeArgument(char *buffer, unsigned long           value);
+    static char *encodeArgument(char *buffer, long long               value);
+    static char *encodeArgument(char *buffer, unsigned long long      value);
+    static char *encodeArgument(char *buffer, float                   value);
+    static char *encodeArgument(char *buffer, double                  value);
+    static char *encodeArgument(char *buffer, long double             value);
+    static char *encodeArgument(char *buffer, const void             *value);
+    static char *encodeArgument(char *buffer, const char             *value);
+    static char *encodeArgument(char *buffer, const bsl::string&      value);
+    static char *encodeArgument(char *buffer, const std::string&      value);
+    static char *encodeArgument(char *buffer, const bsl::string_view& value);
+
+    /// Encode the specified `value` with the specified `tag` into the
+    /// specified `buffer`, and return the address following the encoding.
+    static char *encodeScalar(char *buffer, Tag tag, const void *value);
+
+    /// Encode the specified string `value` of the specified `length` into
+    /// the specified `buffer`, and return the address following the
+    /// encoding.
+    static char *encodeString(char        *buffer,
+                              const char  *value,
+                              bsl::size_t  length);
+
+  public:
+    // CLASS METHODS
+
+    /// Load into the specified `arguments` the arguments encoded in the
+    /// specified `size` bytes at the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value (with `arguments` in a valid but
+    /// unspecified state) if the bytes are not a valid encoding.  String
+    /// arguments refer to the characters in `buffer`.
+    static int decode(bsl::vector<DeferredLogArgument> *arguments,
+                      const char                       *buffer,
+                      bsl::size_t                       size);
+
+    /// Return the size of the encoding of no arguments, i.e., 0.
+    static bsl::size_t encodedSize();
+
+    /// Return the size of the encoding of no arguments into the specified
+    /// `buffer`, i.e., return `buffer`.
+    static char *encode(char *buffer);
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+    /// Return the size of the encoding of the specified `first` and `rest`
+    /// arguments.
+    template <class FIRST, class... REST>
+    static bsl::size_t encodedSize(const FIRST& first, const REST&... rest);
+
+    /// Encode the specified `first` and `rest` arguments into the specified
+    /// `buffer`, and return the address following the encoding.  The
+    /// behavior is undefined unless `buffer` has at least
+    /// `encodedSize(first, rest...)` bytes.
+    template <class FIRST, class... REST>
+    static char *encode(char         *buffer,
+                        const FIRST&  first,
+                        const REST&...rest);
+#endif
+
+    /// Load into the specified `result` the message formatted from the
+    /// specified `format` string, of the specified `style`, and the
+    /// specified `arguments`.  If `format` and `arguments` do not match,
+    /// append a description of the error, enclosed in `<` and `>`, to the
+    /// part of the message that could be formatted.
+    static void format(bsl::string                             *result,
+                       Style                                    style,
+                       const bsl::string_view&                  format,
+                       const bsl::vector<DeferredLogArgument>&  arguments);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class DeferredLogArgument
+                         // -------------------------
+
+// CREATORS
+inline
+DeferredLogArgument::DeferredLogArgument()
+: d_type(e_NONE)
+, d_uint(0)
+{
+}
+
+// MANIPULATORS
+inline
+void DeferredLogArgument::setBool(bool value)
+{
+    d_type = e_BOOL;
+    d_bool = value;
+}
+
+inline
+void DeferredLogArgument::setChar(char value)
+{
+    d_type = e_CHAR;
+    d_char = value;
+}
+
+inline
+void DeferredLogArgument::setDouble(double value)
+{
+    d_type   = e_DOUBLE;
+    d_double = value;
+}
+
+inline
+void DeferredLogArgument::setInt(bsls::Types::Int64 value)
+{
+    d_type = e_INT;
+    d_int  = value;
+}
+
+inline
+void DeferredLogArgument::setPointer(const void *value)
+{
+    d_type      = e_POINTER;
+    d_pointer_p = value;
+}
+
+inline
+void DeferredLogArgument::setString(const bsl::string_view& value)
+{
+    d_type   = e_STRING;
+    d_string = value;
+}
+
+inline
+void DeferredLogArgument::setUint(bsls::Types::Uint64 value)
+{
+    d_type = e_UINT;
+    d_uint = value;
+}
+
+// ACCESSORS
+inline
+bool DeferredLogArgument::theBool() const
+{
+    BSLS_ASSERT(e_BOOL == d_type);
+
+    return d_bool;
+}
+
+inline
+char DeferredLogArgument::theChar() const
+{
+    BSLS_ASSERT(e_CHAR == d_type);
+
+    return d_char;
+}
+
+inline
+double DeferredLogArgument::theDouble() const
+{
+    BSLS_ASSERT(e_DOUBLE == d_type);
+
+    return d_double;
+}
+
+inline
+bsls::Types::Int64 DeferredLogArgument::theInt() const
+{
+    BSLS_ASSERT(e_INT == d_type);
+
+    return d_int;
+}
+
+inline
+const void *DeferredLogArgument::thePointer() const
+{
+    BSLS_ASSERT(e_POINTER == d_type);
+
+    return d_pointer_p;
+}
+
+inline
+const bsl::string_view& DeferredLogArgument::theString() const
+{
+    BSLS_ASSERT(e_STRING == d_type);
+
+    return d_string;
+}
+
+inline
+bsls::Types::Uint64 DeferredLogArgument::theUint() const
+{
+    BSLS_ASSERT(e_UINT == d_type);
+
+    return d_uint;
+}
+
+inline
+DeferredLogArgument::Type DeferredLogArgument::type() const
+{
+    return d_type;
+}
+
+                          // -----------------------
+                          // struct DeferredLogCodec
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsl::size_t DeferredLogCodec::argumentSize(bool)
+{
+    return k_SMALL_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(char)
+{
+    return k_SMALL_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(signed char)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(unsigned char)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(short)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(unsigned short)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(int)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(unsigned int)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(long)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(unsigned long)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(long long)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(unsigned long long)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(float)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(double)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(long double)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(const void *)
+{
+    return k_SCALAR_SIZE;
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(const char *value)
+{
+    return k_STRING_SIZE + (value ? bsl::strlen(value) : sizeof "(null)" - 1);
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(const bsl::string& value)
+{
+    return k_STRING_SIZE + value.length();
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(const std::string& value)
+{
+    return k_STRING_SIZE + value.length();
+}
+
+inline
+bsl::size_t DeferredLogCodec::argumentSize(const bsl::string_view& value)
+{
+    return k_STRING_SIZE + value.length();
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, bool value)
+{
+    buffer[0] = static_cast<char>(e_TAG_BOOL);
+    buffer[1] = static_cast<char>(value);
+    return buffer + k_SMALL_SIZE;
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, char value)
+{
+    buffer[0] = static_cast<char>(e_TAG_CHAR);
+    buffer[1] = value;
+    return buffer + k_SMALL_SIZE;
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, signed char value)
+{
+    const bsls::Types::Int64 v = value;
+    return encodeScalar(buffer, e_TAG_INT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, unsigned char value)
+{
+    const bsls::Types::Uint64 v = value;
+    return encodeScalar(buffer, e_TAG_UINT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, short value)
+{
+    const bsls::Types::Int64 v = value;
+    return encodeScalar(buffer, e_TAG_INT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, unsigned short value)
+{
+    const bsls::Types::Uint64 v = value;
+    return encodeScalar(buffer, e_TAG_UINT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, int value)
+{
+    const bsls::Types::Int64 v = value;
+    return encodeScalar(buffer, e_TAG_INT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, unsigned int value)
+{
+    const bsls::Types::Uint64 v = value;
+    return encodeScalar(buffer, e_TAG_UINT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, long value)
+{
+    const bsls::Types::Int64 v = value;
+    return encodeScalar(buffer, e_TAG_INT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, unsigned long value)
+{
+    const bsls::Types::Uint64 v = value;
+    return encodeScalar(buffer, e_TAG_UINT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, long long value)
+{
+    const bsls::Types::Int64 v = value;
+    return encodeScalar(buffer, e_TAG_INT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, unsigned long long value)
+{
+    const bsls::Types::Uint64 v = value;
+    return encodeScalar(buffer, e_TAG_UINT, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, float value)
+{
+    const double v = value;
+    return encodeScalar(buffer, e_TAG_DOUBLE, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, double value)
+{
+    return encodeScalar(buffer, e_TAG_DOUBLE, &value);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, long double value)
+{
+    const double v = static_cast<double>(value);
+    return encodeScalar(buffer, e_TAG_DOUBLE, &v);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, const void *value)
+{
+    return encodeScalar(buffer, e_TAG_POINTER, &value);
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char *buffer, const char *value)
+{
+    if (!value) {
+        return encodeString(buffer, "(null)", sizeof "(null)" - 1);   // RETURN
+    }
+    return encodeString(buffer, value, bsl::strlen(value));
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char               *buffer,
+                                       const bsl::string&  value)
+{
+    return encodeString(buffer, value.data(), value.length());
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char               *buffer,
+                                       const std::string&  value)
+{
+    return encodeString(buffer, value.data(), value.length());
+}
+
+inline
+char *DeferredLogCodec::encodeArgument(char                    *buffer,
+                                       const bsl::string_view&  value)
+{
+    return encodeString(buffer, value.data(), value.length());
+}
+
+inline
+char *DeferredLogCodec::encodeScalar(char *buffer, Tag tag, const void *value)
+{
+    buffer[0] = static_cast<char>(tag);
+    bsl::memcpy(buffer + 1, value, 8);
+    return buffer + k_SCALAR_SIZE;
+}
+
+inline
+char *DeferredLogCodec::encodeString(char        *buffer,
+                                     const char  *value,
+                                     bsl::size_t  length)
+{
+    const unsigned int length32 = static_cast<unsigned int>(length);
+
+    buffer[0] = static_cast<char>(e_TAG_STRING);
+    bsl::memcpy(buffer + 1, &length32, 4);
+    bsl::memcpy(buffer + k_STRING_SIZE, value, length);
+    return buffer + k_STRING_SIZE + length;
+}
+
+// CLASS METHODS
+inline
+bsl::size_t DeferredLogCodec::encodedSize()
+{
+    return 0;
+}
+
+inline
+char *DeferredLogCodec::encode(char *buffer)
+{
+    return buffer;
+}
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+template <class FIRST, class... REST>
+inline
+bsl::size_t DeferredLogCodec::encodedSize(const FIRST& first,
+                                          const REST&... rest)
+{
+    return argumentSize(first) + encodedSize(rest...);
+}
+
+template <class FIRST, class... REST>
+inline
+char *DeferredLogCodec::encode(char         *buffer,
+                               const FIRST&  first,
+                               const REST&...rest)
+{
+    return encode(encodeArgument(buffer, first), rest...);
+}
+#endif
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,620 @@
+// ball_deferredlogcodec.t.cpp                                        -*-C++-*-
+#include <ball_deferredlogcodec.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <string>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a value-semantic-like argument class,
+// and a utility that encodes, decodes, and formats arguments.  We first test
+// the manipulators and accessors of the argument class, then check that each
+// supported type round-trips through `encode` and `decode`, that `decode`
+// rejects truncated and corrupt encodings, and that `format` produces the same
+// output as `snprintf` and `bsl::format` for both styles of format string,
+// including the reporting of mismatched arguments.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int decode(vector<DeferredLogArgument> *, const char *, size_t);
+// [ 3] size_t encodedSize(const FIRST&, const REST&...);
+// [ 3] char *encode(char *, const FIRST&, const REST&...);
+// [ 4] void format(string *, e_PRINTF, const string_view&, const vector&)
+// [ 5] void format(string *, e_FORMAT, const string_view&, const vector&)
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] DeferredLogArgument
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogArgument Arg;
+typedef ball::DeferredLogCodec    Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+/// Return the message formatted from the specified `format` of the specified
+/// `style` and the specified `args`, after encoding and decoding `args`.
+template <class... ARGS>
+bsl::string roundTrip(Obj::Style style, const char *format, ARGS... args)
+{
+    const bsl::size_t size = Obj::encodedSize(args...);
+    bsl::vector<char> buffer(size + 1);
+
+    char *end = Obj::encode(buffer.data(), args...);
+    ASSERTV(size, end - buffer.data(), buffer.data() + size == end);
+
+    bsl::vector<Arg> arguments;
+    int              rc = Obj::decode(&arguments, buffer.data(), size);
+    ASSERTV(rc, 0 == rc);
+    ASSERTV(sizeof...(args), arguments.size(),
+            sizeof...(args) == arguments.size());
+
+    bsl::string result;
+    Obj::format(&result, style, format, arguments);
+    return result;
+}
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Formatting a Message
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a log statement must capture its arguments now, and format
+// them later.
+//
+// First, we compute the size of the encoding of the arguments, and encode
+// them into a buffer:
+// ```
+    const char       *format = "order %d: %s at %.2f";
+    bsl::string       symbol("IBM");
+
+    const bsl::size_t size = ball::DeferredLogCodec::encodedSize(17,
+                                                                 symbol,
+                                                                 134.5);
+
+    char buffer[64];
+    ASSERT(size <= sizeof buffer);
+
+    char *end = ball::DeferredLogCodec::encode(buffer, 17, symbol, 134.5);
+    ASSERT(buffer + size == end);
+// ```
+// Then, later, we decode the arguments:
+// ```
+    bsl::vector<ball::DeferredLogArgument> arguments;
+    int rc = ball::DeferredLogCodec::decode(&arguments, buffer, size);
+    ASSERT(0 == rc);
+    ASSERT(3 == arguments.size());
+    ASSERT(ball::DeferredLogArgument::e_STRING == arguments[1].type());
+// ```
+// Finally, we format the message:
+// ```
+    bsl::string message;
+    ball::DeferredLogCodec::format(&message,
+                                   ball::DeferredLogCodec::e_PRINTF,
+                                   format,
+                                   arguments);
+    ASSERT("order 17: IBM at 134.50" == message);
+// ```
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FORMAT: `bsl::format` STYLE
+        //
+        // Concerns:
+        // 1. Each argument type is formatted as by `bsl::format`, honoring
+        //    the format specification of its replacement field.
+        //
+        // 2. Automatic and manual argument indexing are supported.
+        //
+        // 3. A missing argument, an invalid specification, or a nested
+        //    replacement field produces the format string followed by an
+        //    error description enclosed in `<` and `>`.
+        //
+        // Plan:
+        // 1. Round-trip arguments of each type through `encode`, `decode`,
+        //    and `format`, and compare with expected strings.  (C-1..2)
+        //
+        // 2. Format mismatched format strings and arguments, and verify the
+        //    error marker.  (C-3)
+        //
+        // Testing:
+        //   void format(string *, e_FORMAT, const string_view&, const vector&)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMAT: `bsl::format` STYLE" << endl
+                          << "===========================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        const Obj::Style S = Obj::e_FORMAT;
+
+        ASSERTV(u::roundTrip(S, "{} {} {}", 1, -2, 3u),
+                "1 -2 3" == u::roundTrip(S, "{} {} {}", 1, -2, 3u));
+        {
+            const bsl::string r = u::roundTrip(S, "{:>5}|{:<4}|{:x}", 42, 'c',
+                                               255);
+            ASSERTV(r, "   42|c   |ff" == r);
+        }
+        ASSERTV(u::roundTrip(S, "{:.3f} {}", 2.5, true),
+                "2.500 true" == u::roundTrip(S, "{:.3f} {}", 2.5, true));
+        ASSERTV(u::roundTrip(S, "{1}-{0}", "a", bsl::string("b")),
+                "b-a" == u::roundTrip(S, "{1}-{0}", "a", bsl::string("b")));
+        ASSERTV(u::roundTrip(S, "[{:^7}]", bsl::string_view("mid")),
+                "[  mid  ]" == u::roundTrip(S,
+                                            "[{:^7}]",
+                                            bsl::string_view("mid")));
+        ASSERTV(u::roundTrip(S, "{}", std::string("std")),
+                "std" == u::roundTrip(S, "{}", std::string("std")));
+        ASSERTV(u::roundTrip(S, "{{{}}}", 7),
+                "{7}" == u::roundTrip(S, "{{{}}}", 7));
+
+        const void *p = reinterpret_cast<const void *>(0x10);
+        ASSERTV(u::roundTrip(S, "{}", p), "0x10" == u::roundTrip(S, "{}", p));
+
+        ASSERTV(u::roundTrip(S, "{} {}", 1),
+                "{} {} <missing argument>" == u::roundTrip(S, "{} {}", 1));
+        {
+            const bsl::string r = u::roundTrip(S, "{:q}", 1);
+            ASSERTV(r, 0 == r.find("{:q} <"));
+            ASSERTV(r, '>' == r[r.length() - 1]);
+        }
+        {
+            const bsl::string r = u::roundTrip(S, "{:{}}", 1, 2);
+            ASSERTV(r, 0 == r.find("{:{}} <"));
+        }
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORMAT: `printf` STYLE
+        //
+        // Concerns:
+        // 1. Each conversion is formatted as by `snprintf`, irrespective of
+        //    the length modifier and of the width of the encoded integer.
+        //
+        // 2. Flags, widths, precisions, and `*` widths and precisions are
+        //    honored, and `%%` produces a `%`.
+        //
+        // 3. `%s` formats string arguments, and other arguments as `{}`.
+        //
+        // 4. A missing argument, an argument of the wrong type, or an
+        //    incomplete or unsupported conversion produces the message
+        //    formatted so far, followed by an error enclosed in `<` and `>`.
+        //
+        // Plan:
+        // 1. Round-trip arguments through `encode`, `decode`, and `format`,
+        //    and compare with expected strings.  (C-1..3)
+        //
+        // 2. Format mismatched format strings and arguments, and verify the
+        //    error marker.  (C-4)
+        //
+        // Testing:
+        //   void format(string *, e_PRINTF, const string_view&, const vector&)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMAT: `printf` STYLE" << endl
+                          << "======================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        const Obj::Style S = Obj::e_PRINTF;
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+            const char *d_expected;
+        } DATA[] = {
+            //LN  FORMAT                  EXPECTED
+            //--  ----------------------  -------------------------------
+            { L_, "plain",                "plain"                         },
+            { L_, "%d|%i|%u|%x",          "-5|7|8|ff"                     },
+            { L_, "%5d|%-5d|%05d",        "   -5|7    |00008"             },
+            { L_, "%ld|%lld|%hd|%zu",     "-5|7|8|255"                    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *FMT  = DATA[ti].d_format;
+            const char *EXP  = DATA[ti].d_expected;
+
+            const bsl::string r = u::roundTrip(S, FMT, -5, 7L, 8u, 255ULL);
+            ASSERTV(LINE, r, EXP, EXP == r);
+        }
+
+        ASSERTV(u::roundTrip(S, "100%%"), "100%" == u::roundTrip(S, "100%%"));
+        ASSERTV(u::roundTrip(S, "%c%c", 'o', 107),
+                "ok" == u::roundTrip(S, "%c%c", 'o', 107));
+        {
+            const bsl::string r = u::roundTrip(S, "%.2f|%e|%g", 1.005f, 1e10,
+                                               0.5);
+            ASSERTV(r, "1.00|1.000000e+10|0.5" == r);
+        }
+        ASSERTV(u::roundTrip(S, "%*d|%.*f", 4, 1, 1, 2.25),
+                "   1|2.2" == u::roundTrip(S, "%*d|%.*f", 4, 1, 1, 2.25));
+        {
+            const bsl::string r = u::roundTrip(S, "%s-%s-%.2s", "a",
+                                               bsl::string("b"), "cde");
+            ASSERTV(r, "a-b-cd" == r);
+        }
+        ASSERTV(u::roundTrip(S, "%s %s", 12, true),
+                "12 true" == u::roundTrip(S, "%s %s", 12, true));
+
+        const char *nullString = 0;
+        ASSERTV(u::roundTrip(S, "%s", nullString),
+                "(null)" == u::roundTrip(S, "%s", nullString));
+
+        int  x = 0;
+        char expected[64];
+        snprintf(expected, sizeof expected, "%p", static_cast<void *>(&x));
+        ASSERTV(u::roundTrip(S, "%p", &x), expected,
+                expected == u::roundTrip(S, "%p", &x));
+
+        ASSERTV(u::roundTrip(S, "a %d b %d", 1),
+                "a 1 b <missing argument>" == u::roundTrip(S, "a %d b %d", 1));
+        ASSERTV(u::roundTrip(S, "n=%d", "x"),
+                "n=<invalid argument for %d>" == u::roundTrip(S, "n=%d", "x"));
+        ASSERTV(u::roundTrip(S, "%f", "x"),
+                "<invalid argument for %f>" == u::roundTrip(S, "%f", "x"));
+        ASSERTV(u::roundTrip(S, "%p", 1),
+                "<invalid argument for %p>" == u::roundTrip(S, "%p", 1));
+        ASSERTV(u::roundTrip(S, "%*d", "w", 1),
+                "<invalid '*' argument>" == u::roundTrip(S, "%*d", "w", 1));
+        ASSERTV(u::roundTrip(S, "end %", 1),
+                "end <incomplete conversion>" == u::roundTrip(S, "end %", 1));
+        ASSERTV(u::roundTrip(S, "%n", 1),
+                "<unsupported conversion>" == u::roundTrip(S, "%n", 1));
+
+        if (verbose) cout << "\tLong output." << endl;
+        {
+            const bsl::string LONG(300, 'z');
+            ASSERT(LONG + "!" == u::roundTrip(S, "%s!", LONG));
+            const bsl::string PADDED = bsl::string(290, ' ') + "42";
+            ASSERT(PADDED == u::roundTrip(S, "%292d", 42));
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ENCODE AND DECODE
+        //
+        // Concerns:
+        // 1. `encodedSize` returns the number of bytes written by `encode`.
+        //
+        // 2. Each supported type decodes to an argument of the expected type
+        //    and value.
+        //
+        // 3. `decode` returns a non-zero value for a truncated encoding or an
+        //    unknown type tag, and 0 for an empty encoding.
+        //
+        // Plan:
+        // 1. Encode one argument of each supported type, decode them, and
+        //    verify the decoded types and values.  (C-1..2)
+        //
+        // 2. Decode every proper prefix of the encoding that does not end on
+        //    an argument boundary, and an encoding with a corrupt tag.  (C-3)
+        //
+        // Testing:
+        //   int decode(vector<DeferredLogArgument> *, const char *, size_t);
+        //   size_t encodedSize(const FIRST&, const REST&...);
+        //   char *encode(char *, const FIRST&, const REST&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODE AND DECODE" << endl
+                          << "=================" << endl;
+
+        bsl::vector<Arg> arguments;
+
+        ASSERT(0 == Obj::encodedSize());
+        ASSERT(0 == Obj::decode(&arguments, 0, 0));
+        ASSERT(arguments.empty());
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        enum Color { e_RED = 3 };
+
+        const int          i = -17;
+        const void        *p = &i;
+        const bsl::string  bs("bsl");
+        const std::string  ss("std");
+
+        const bsl::size_t size = Obj::encodedSize(
+                 true, 'c', static_cast<signed char>(-1),
+                 static_cast<unsigned char>(200), static_cast<short>(-300),
+                 i, 4000000000u, -5L, 6UL, -7LL, 8ULL, 1.5f, 2.5, 3.5L, p,
+                 "lit", bs, ss, bsl::string_view("view"), e_RED);
+
+        ASSERTV(size, 2 + 2 + 14 * 9 + 4 * 5 + 3 + 3 + 3 + 4 == size);
+
+        bsl::vector<char> buffer(size);
+        char *end = Obj::encode(buffer.data(),
+                 true, 'c', static_cast<signed char>(-1),
+                 static_cast<unsigned char>(200), static_cast<short>(-300),
+                 i, 4000000000u, -5L, 6UL, -7LL, 8ULL, 1.5f, 2.5, 3.5L, p,
+                 "lit", bs, ss, bsl::string_view("view"), e_RED);
+        ASSERT(buffer.data() + size == end);
+
+        int rc = Obj::decode(&arguments, buffer.data(), size);
+        ASSERTV(rc, 0 == rc);
+        ASSERTV(arguments.size(), 20 == arguments.size());
+
+        ASSERT(Arg::e_BOOL    == arguments[0].type());
+        ASSERT(true           == arguments[0].theBool());
+        ASSERT(Arg::e_CHAR    == arguments[1].type());
+        ASSERT('c'            == arguments[1].theChar());
+        ASSERT(Arg::e_INT     == arguments[2].type());
+        ASSERT(-1             == arguments[2].theInt());
+        ASSERT(Arg::e_UINT    == arguments[3].type());
+        ASSERT(200            == arguments[3].theUint());
+        ASSERT(-300           == arguments[4].theInt());
+        ASSERT(-17            == arguments[5].theInt());
+        ASSERT(4000000000u    == arguments[6].theUint());
+        ASSERT(-5             == arguments[7].theInt());
+        ASSERT(6              == arguments[8].theUint());
+        ASSERT(-7             == arguments[9].theInt());
+        ASSERT(8              == arguments[10].theUint());
+        ASSERT(Arg::e_DOUBLE  == arguments[11].type());
+        ASSERT(1.5            == arguments[11].theDouble());
+        ASSERT(2.5            == arguments[12].theDouble());
+        ASSERT(3.5            == arguments[13].theDouble());
+        ASSERT(Arg::e_POINTER == arguments[14].type());
+        ASSERT(p              == arguments[14].thePointer());
+        ASSERT(Arg::e_STRING  == arguments[15].type());
+        ASSERT("lit"          == arguments[15].theString());
+        ASSERT("bsl"          == arguments[16].theString());
+        ASSERT("std"          == arguments[17].theString());
+        ASSERT("view"         == arguments[18].theString());
+        ASSERT(Arg::e_INT     == arguments[19].type());
+        ASSERT(3              == arguments[19].theInt());
+
+        if (verbose) cout << "\tTruncated and corrupt encodings." << endl;
+
+        bsl::vector<bsl::size_t> boundaries;
+        {
+            bsl::size_t offset = 0;
+            boundaries.push_back(offset);
+            for (bsl::size_t k = 0; k < arguments.size(); ++k) {
+                const Arg& a = arguments[k];
+                offset += Arg::e_BOOL == a.type() || Arg::e_CHAR == a.type()
+                        ? 2
+                        : Arg::e_STRING == a.type()
+                        ? 5 + a.theString().length()
+                        : 9;
+                boundaries.push_back(offset);
+            }
+            ASSERT(size == offset);
+        }
+        for (bsl::size_t n = 0; n < size; ++n) {
+            const bool isBoundary = boundaries.end() != bsl::find(
+                                                            boundaries.begin(),
+                                                            boundaries.end(),
+                                                            n);
+            rc = Obj::decode(&arguments, buffer.data(), n);
+            ASSERTV(n, rc, isBoundary == (0 == rc));
+        }
+
+        buffer[0] = 42;
+        ASSERT(0 != Obj::decode(&arguments, buffer.data(), size));
+        buffer[0] = 0;
+        ASSERT(0 != Obj::decode(&arguments, buffer.data(), size));
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEFERREDLOGARGUMENT
+        //
+        // Concerns:
+        // 1. A default-constructed argument has type `e_NONE`.
+        //
+        // 2. Each manipulator sets the type and value reported by the
+        //    accessors.
+        //
+        // 3. Accessing a value of another type is caught in appropriate build
+        //    modes.
+        //
+        // Plan:
+        // 1. Set an argument to a value of each type and check the accessors,
+        //    and use `BSLS_ASSERTTEST_*` to verify the precondition checks.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   DeferredLogArgument
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEFERREDLOGARGUMENT" << endl
+                          << "===================" << endl;
+
+        Arg mX;  const Arg& X = mX;
+        ASSERT(Arg::e_NONE == X.type());
+
+        mX.setBool(true);
+        ASSERT(Arg::e_BOOL == X.type());  ASSERT(true == X.theBool());
+        mX.setChar('z');
+        ASSERT(Arg::e_CHAR == X.type());  ASSERT('z' == X.theChar());
+        mX.setInt(-9);
+        ASSERT(Arg::e_INT == X.type());  ASSERT(-9 == X.theInt());
+        mX.setUint(9);
+        ASSERT(Arg::e_UINT == X.type());  ASSERT(9 == X.theUint());
+        mX.setDouble(0.25);
+        ASSERT(Arg::e_DOUBLE == X.type());  ASSERT(0.25 == X.theDouble());
+        mX.setPointer(&mX);
+        ASSERT(Arg::e_POINTER == X.type());  ASSERT(&mX == X.thePointer());
+        mX.setString("abc");
+        ASSERT(Arg::e_STRING == X.type());  ASSERT("abc" == X.theString());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(X.theString());
+            ASSERT_FAIL(X.theInt());
+            ASSERT_FAIL(X.theBool());
+            ASSERT_FAIL(X.thePointer());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Encode, decode, and format a few arguments in both styles.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        ASSERT("x=1 y=a" == u::roundTrip(Obj::e_PRINTF, "x=%d y=%s", 1, "a"));
+        ASSERT("x=1 y=a" == u::roundTrip(Obj::e_FORMAT, "x={} y={}", 1, "a"));
+#endif
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
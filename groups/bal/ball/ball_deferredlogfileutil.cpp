@@ -0,0 +1,303 @@
+// ball_deferredlogfileutil.cpp                                       -*-C++-*-
+#include <ball_deferredlogfileutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogfileutil_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+#include <bsl_istream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+const char         k_MAGIC[]     = { 'B', 'A', 'L', 'L', 'D', 'L', 'G', '1' };
+const char         k_SITE        = 'S';
+const char         k_CATEGORY    = 'C';
+const char         k_ENTRY       = 'E';
+const unsigned int k_MAX_LENGTH  = 64 * 1024 * 1024;
+    // largest string or encoded arguments accepted when reading
+
+const bsls::Types::Int64 k_NANOSECONDS_PER_SECOND = 1000 * 1000 * 1000;
+
+/// This `struct` describes a log statement defined in a binary log.
+struct Site {
+    int                           d_severity;
+    ball::DeferredLogCodec::Style d_style;
+    int                           d_line;
+    bsl::string                   d_file;
+    bsl::string                   d_format;
+};
+
+/// Write the bytes of the specified `value` to the specified `output`.
+template <class TYPE>
+void put(bsl::ostream& output, const TYPE& value)
+{
+    output.write(reinterpret_cast<const char *>(&value), sizeof value);
+}
+
+/// Write the length and characters of the specified `data` of the specified
+/// `length` to the specified `output`.
+void putString(bsl::ostream& output, const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(length <= 0xFFFFFFFFu);
+
+    put(output, static_cast<unsigned int>(length));
+    output.write(data, length);
+}
+
+/// Read into the specified `value` its bytes from the specified `input`.
+/// Return `true` on success, and `false` otherwise.
+template <class TYPE>
+bool get(TYPE *value, bsl::istream& input)
+{
+    return input.read(reinterpret_cast<char *>(value), sizeof *value)
+                                                                     ? true
+                                                                     : false;
+}
+
+/// Read into the specified `value` a string written by `putString` from the
+/// specified `input`.  Return `true` on success, and `false` otherwise.
+bool getString(bsl::string *value, bsl::istream& input)
+{
+    unsigned int length;
+    if (!get(&length, input) || k_MAX_LENGTH < length) {
+        return false;                                                 // RETURN
+    }
+    value->resize(length);
+    return 0 == length || input.read(&(*value)[0], length) ? true : false;
+}
+
+/// Write the specified `record` formatted by the specified `formatter` to
+/// the specified `output`.
+void formatRecord(bsl::ostream                      *output,
+                  const ball::RecordStringFormatter *formatter,
+                  const ball::Record&                record)
+{
+    (*formatter)(*output, record);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace ball {
+
+                        // --------------------------
+                        // struct DeferredLogFileUtil
+                        // --------------------------
+
+// CLASS METHODS
+int DeferredLogFileUtil::decode(bsl::ostream&                output,
+                                bsl::istream&                input,
+                                const RecordStringFormatter& formatter)
+{
+    using namespace bdlf::PlaceHolders;
+
+    const int rc = readRecords(input,
+                               bdlf::BindUtil::bind(&u::formatRecord,
+                                                    &output,
+                                                    &formatter,
+                                                    _1));
+    output.flush();
+    return 0 != rc ? rc : output.good() ? 0 : -1;
+}
+
+int DeferredLogFileUtil::readRecords(bsl::istream&        input,
+                                     const RecordVisitor& visitor)
+{
+    char magic[sizeof u::k_MAGIC];
+    int  processId;
+    if (!input.read(magic, sizeof magic)
+     || 0 != bsl::memcmp(magic, u::k_MAGIC, sizeof magic)
+     || !u::get(&processId, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::unordered_map<unsigned int, u::Site>     sites;
+    bsl::unordered_map<unsigned int, bsl::string> categories;
+
+    Record                           record;
+    RecordAttributes&                fixedFields = record.fixedFields();
+    bsl::string                      arguments;
+    bsl::vector<DeferredLogArgument> decoded;
+    bsl::string                      message;
+
+    fixedFields.setProcessID(processId);
+
+    char kind;
+    while (input.get(kind)) {
+        switch (kind) {
+          case u::k_SITE: {
+            unsigned int  id;
+            u::Site       site;
+            unsigned char style;
+            if (!u::get(&id, input)
+             || !u::get(&site.d_severity, input)
+             || !u::get(&style, input)
+             || !u::get(&site.d_line, input)
+             || !u::getString(&site.d_file, input)
+             || !u::getString(&site.d_format, input)
+             || DeferredLogCodec::e_FORMAT < style) {
+                return -2;                                            // RETURN
+            }
+            site.d_style = static_cast<DeferredLogCodec::Style>(style);
+            if (!sites.insert(bsl::make_pair(id, site)).second) {
+                return -2;                                            // RETURN
+            }
+          } break;
+          case u::k_CATEGORY: {
+            unsigned int id;
+            bsl::string  name;
+            if (!u::get(&id, input)
+             || !u::getString(&name, input)
+             || !categories.insert(bsl::make_pair(id, name)).second) {
+                return -3;                                            // RETURN
+            }
+          } break;
+          case u::k_ENTRY: {
+            unsigned int        siteId;
+            unsigned int        categoryId;
+            bsls::Types::Int64  timestamp;
+            bsls::Types::Uint64 threadId;
+            if (!u::get(&siteId, input)
+             || !u::get(&categoryId, input)
+             || !u::get(&timestamp, input)
+             || !u::get(&threadId, input)
+             || !u::getString(&arguments, input)) {
+                return -4;                                            // RETURN
+            }
+
+            bsl::unordered_map<unsigned int, u::Site>::const_iterator
+                                                    site = sites.find(siteId);
+            bsl::unordered_map<unsigned int, bsl::string>::const_iterator
+                                        category = categories.find(categoryId);
+            if (sites.end() == site || categories.end() == category) {
+                return -5;                                            // RETURN
+            }
+
+            if (0 != DeferredLogCodec::decode(&decoded,
+                                              arguments.data(),
+                                              arguments.length())) {
+                return -6;                                            // RETURN
+            }
+            DeferredLogCodec::format(&message,
+                                     site->second.d_style,
+                                     site->second.d_format,
+                                     decoded);
+
+            bsls::TimeInterval interval;
+            interval.setIntervalRaw(
+                    timestamp / u::k_NANOSECONDS_PER_SECOND,
+                    static_cast<int>(timestamp % u::k_NANOSECONDS_PER_SECOND));
+
+            fixedFields.setTimestamp(
+                          bdlt::EpochUtil::convertFromTimeInterval(interval));
+            fixedFields.setThreadID(threadId);
+            fixedFields.setFileName(site->second.d_file);
+            fixedFields.setLineNumber(site->second.d_line);
+            fixedFields.setCategory(category->second);
+            fixedFields.setSeverity(site->second.d_severity);
+            fixedFields.setMessage(message);
+
+            visitor(record);
+          } break;
+          default: {
+            return -7;                                                // RETURN
+          }
+        }
+    }
+    return input.eof() ? 0 : -8;
+}
+
+int DeferredLogFileUtil::writeCategory(bsl::ostream&           output,
+                                       unsigned int            categoryId,
+                                       const bsl::string_view& name)
+{
+    output.put(u::k_CATEGORY);
+    u::put(output, categoryId);
+    u::putString(output, name.data(), name.length());
+    return output.good() ? 0 : -1;
+}
+
+int DeferredLogFileUtil::writeEntry(bsl::ostream&              output,
+                                    unsigned int               siteId,
+                                    unsigned int               categoryId,
+                                    const bsls::TimeInterval&  timestamp,
+                                    bsls::Types::Uint64        threadId,
+                                    const char                *arguments,
+                                    bsl::size_t                argumentsSize)
+{
+    BSLS_ASSERT(arguments || 0 == argumentsSize);
+
+    const bsls::Types::Int64 nanoseconds =
+                          timestamp.seconds() * u::k_NANOSECONDS_PER_SECOND
+                        + timestamp.nanoseconds();
+
+    output.put(u::k_ENTRY);
+    u::put(output, siteId);
+    u::put(output, categoryId);
+    u::put(output, nanoseconds);
+    u::put(output, threadId);
+    u::putString(output, arguments, argumentsSize);
+    return output.good() ? 0 : -1;
+}
+
+int DeferredLogFileUtil::writeHeader(bsl::ostream& output, int processId)
+{
+    output.write(u::k_MAGIC, sizeof u::k_MAGIC);
+    u::put(output, processId);
+    return output.good() ? 0 : -1;
+}
+
+int DeferredLogFileUtil::writeSite(bsl::ostream&           output,
+                                   unsigned int            siteId,
+                                   int                     severity,
+                                   DeferredLogCodec::Style style,
+                                   int                     line,
+                                   const bsl::string_view& file,
+                                   const bsl::string_view& format)
+{
+    output.put(u::k_SITE);
+    u::put(output, siteId);
+    u::put(output, severity);
+    u::put(output, static_cast<unsigned char>(style));
+    u::put(output, line);
+    u::putString(output, file.data(), file.length());
+    u::putString(output, format.data(), format.length());
+    return output.good() ? 0 : -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
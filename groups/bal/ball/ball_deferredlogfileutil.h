@@ -0,0 +1,217 @@
+// ball_deferredlogfileutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGFILEUTIL
+#define INCLUDED_BALL_DEFERREDLOGFILEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to write and read binary deferred log files.
+//
+//@CLASSES:
+//  ball::DeferredLogFileUtil: namespace for binary deferred log file I/O
+//
+//@SEE_ALSO: ball_deferredlogger, ball_deferredlogcodec
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `ball::DeferredLogFileUtil`, that writes and reads the binary log files
+// produced by `ball::DeferredLogger` (see `ball_deferredlogger`).  A binary
+// log file holds, for each logged message, the identity of the log statement,
+// the identity of its category, its timestamp, the identifier of the logging
+// thread, and the encoded arguments of the message (see
+// `ball_deferredlogcodec`).  The format strings, source file names, and
+// category names are each written once, in definitions that precede the
+// first entry that refers to them.  Writing an entry therefore costs a copy
+// of the encoded arguments, and formatting is deferred until the file is
+// read, typically offline, with the `ball_deferredlogdecoder` tool, or with
+// `decode` or `readRecords`.
+//
+///File Format
+///-----------
+// A binary deferred log file is a header, followed by a sequence of records.
+// The header is the eight characters "BALLDLG1" followed by the (4-byte)
+// process ID of the process that wrote the file.  Each record is a one-byte
+// record kind followed by its fields:
+//
+// * `'S'` (site definition): a 4-byte site ID, a 4-byte severity, a 1-byte
+//   format style (`ball::DeferredLogCodec::Style`), a 4-byte line number, and
+//   the source file name and format string.
+// * `'C'` (category definition): a 4-byte category ID and the category name.
+// * `'E'` (entry): a 4-byte site ID, a 4-byte category ID, an 8-byte
+//   timestamp (nanoseconds since the Unix epoch), an 8-byte thread ID, and
+//   the encoded arguments.
+//
+// Strings and encoded arguments are written as a 4-byte length followed by
+// their bytes.  Integers are written in native byte order, so a file must be
+// read on a platform of the same byte order as the one that wrote it.  A
+// site or category ID can be defined only once per file.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Decoding a Binary Log
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a message to a binary log, and later print
+// it as text.
+//
+// First, we write the header, the definitions of a site and a category, and
+// one entry referring to both:
+// ```
+// bsl::stringstream stream;
+//
+// int rc = ball::DeferredLogFileUtil::writeHeader(stream, 1234);
+// assert(0 == rc);
+//
+// rc = ball::DeferredLogFileUtil::writeSite(stream,
+//                                           1,
+//                                           ball::Severity::e_INFO,
+//                                           ball::DeferredLogCodec::e_PRINTF,
+//                                           __LINE__,
+//                                           "myfile.cpp",
+//                                           "price = %d");
+// assert(0 == rc);
+//
+// rc = ball::DeferredLogFileUtil::writeCategory(stream, 7, "EXAMPLE");
+// assert(0 == rc);
+//
+// char         arguments[32];
+// char        *end  = ball::DeferredLogCodec::encode(arguments, 150);
+// bsl::size_t  size = end - arguments;
+//
+// rc = ball::DeferredLogFileUtil::writeEntry(stream,
+//                                            1,
+//                                            7,
+//                                            bsls::TimeInterval(0, 0),
+//                                            42,
+//                                            arguments,
+//                                            size);
+// assert(0 == rc);
+// ```
+// Then, we decode the log, formatting each message with a record formatter
+// that prints the thread ID, category, and message:
+// ```
+// bsl::ostringstream output;
+//
+// rc = ball::DeferredLogFileUtil::decode(output,
+//                                        stream,
+//                                        ball::RecordStringFormatter(
+//                                                             "%t %c %m\n"));
+// assert(0 == rc);
+// assert("42 EXAMPLE price = 150\n" == output.str());
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_deferredlogcodec.h>
+
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+class RecordStringFormatter;
+
+                        // ==========================
+                        // struct DeferredLogFileUtil
+                        // ==========================
+
+/// This utility `struct` provides a namespace for functions that write and
+/// read binary deferred log files.
+struct DeferredLogFileUtil {
+
+    // TYPES
+
+    /// `RecordVisitor` is an alias for a function invoked with each record
+    /// read from a binary deferred log file.
+    typedef bsl::function<void(const Record&)> RecordVisitor;
+
+    // CLASS METHODS
+
+    /// Write to the specified `output` the records of the binary deferred
+    /// log read from the specified `input`, each formatted by the specified
+    /// `formatter`.  Return 0 on success, and a non-zero value if `input`
+    /// is not a valid binary deferred log (in which case the records
+    /// preceding the first invalid one are written), or if writing to
+    /// `output` fails.
+    static int decode(bsl::ostream&                output,
+                      bsl::istream&                input,
+                      const RecordStringFormatter& formatter);
+
+    /// Invoke the specified `visitor` with each record of the binary
+    /// deferred log read from the specified `input`, in the order in which
+    /// they were written.  Each record has the timestamp, process ID,
+    /// thread ID, source file name, line number, category, severity, and
+    /// formatted message of the logged entry.  Return 0 on success, and a
+    /// non-zero value if `input` is not a valid binary deferred log (in
+    /// which case `visitor` is invoked for the records preceding the first
+    /// invalid one).
+    static int readRecords(bsl::istream& input, const RecordVisitor& visitor);
+
+    /// Write to the specified `output` a category definition associating
+    /// the specified `categoryId` with the specified `name`.  Return 0 on
+    /// success, and a non-zero value otherwise.
+    static int writeCategory(bsl::ostream&           output,
+                             unsigned int            categoryId,
+                             const bsl::string_view& name);
+
+    /// Write to the specified `output` an entry for a message logged at the
+    /// specified `timestamp` (since the Unix epoch) by the thread having
+    /// the specified `threadId`, from the site having the specified
+    /// `siteId`, in the category having the specified `categoryId`, with the
+    /// arguments encoded in the specified `argumentsSize` bytes at the
+    /// specified `arguments`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    static int writeEntry(bsl::ostream&              output,
+                          unsigned int               siteId,
+                          unsigned int               categoryId,
+                          const bsls::TimeInterval&  timestamp,
+                          bsls::Types::Uint64        threadId,
+                          const char                *arguments,
+                          bsl::size_t                argumentsSize);
+
+    /// Write to the specified `output` the header of a binary deferred log
+    /// written by the process having the specified `processId`.  Return 0
+    /// on success, and a non-zero value otherwise.
+    static int writeHeader(bsl::ostream& output, int processId);
+
+    /// Write to the specified `output` a site definition associating the
+    /// specified `siteId` with a log statement of the specified `severity`,
+    /// at the specified `line` of the specified `file`, having the
+    /// specified `format` string of the specified `style`.  Return 0 on
+    /// success, and a non-zero value otherwise.
+    static int writeSite(bsl::ostream&           output,
+                         unsigned int            siteId,
+                         int                     severity,
+                         DeferredLogCodec::Style style,
+                         int                     line,
+                         const bsl::string_view& file,
+                         const bsl::string_view& format);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
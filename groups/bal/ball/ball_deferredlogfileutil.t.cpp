@@ -0,0 +1,566 @@
+// ball_deferredlogfileutil.t.cpp                                     -*-C++-*-
+#include <ball_deferredlogfileutil.h>
+
+#include <ball_deferredlogcodec.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility writing and reading a binary file
+// format.  We write files with the `write*` functions to a string stream, and
+// verify that `readRecords` produces records having the written fields and
+// the formatted messages, that `decode` formats them with the supplied
+// formatter, and that every truncation or corruption of a valid file is
+// reported by a non-zero status.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int writeHeader(ostream&, int);
+// [ 2] int writeSite(ostream&, uint, int, Style, int, string_view, ...);
+// [ 2] int writeCategory(ostream&, uint, const string_view&);
+// [ 2] int writeEntry(ostream&, uint, uint, TimeInterval, Uint64, ...);
+// [ 2] int readRecords(istream&, const RecordVisitor&);
+// [ 3] int readRecords(istream&, const RecordVisitor&);
+// [ 4] int decode(ostream&, istream&, const RecordStringFormatter&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogFileUtil Util;
+typedef ball::DeferredLogCodec    Codec;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// This class is a record visitor that saves a copy of each visited record.
+class RecordSaver {
+
+    // DATA
+    bsl::vector<ball::Record> *d_records_p;  // saved records (held)
+
+  public:
+    // CREATORS
+
+    /// Create a visitor saving records into the specified `records`.
+    explicit RecordSaver(bsl::vector<ball::Record> *records)
+    : d_records_p(records)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Save a copy of the specified `record`.
+    void operator()(const ball::Record& record) const
+    {
+        d_records_p->push_back(record);
+    }
+};
+
+/// Write to the specified `output` a binary log having two sites, two
+/// categories, and three entries.
+void writeLog(bsl::ostream& output)
+{
+    char        arguments[64];
+    bsl::size_t size;
+
+    ASSERT(0 == Util::writeHeader(output, 77));
+    ASSERT(0 == Util::writeSite(output,
+                                1,
+                                ball::Severity::e_WARN,
+                                Codec::e_PRINTF,
+                                10,
+                                "a.cpp",
+                                "x=%d s=%s"));
+    ASSERT(0 == Util::writeCategory(output, 5, "CAT.A"));
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+    size = Codec::encode(arguments, 1, "one") - arguments;
+#else
+    size = 0;
+#endif
+    ASSERT(0 == Util::writeEntry(output,
+                                 1,
+                                 5,
+                                 bsls::TimeInterval(86400, 123456000),
+                                 11,
+                                 arguments,
+                                 size));
+
+    ASSERT(0 == Util::writeSite(output,
+                                2,
+                                ball::Severity::e_ERROR,
+                                Codec::e_FORMAT,
+                                20,
+                                "b.cpp",
+                                "y={:>3}"));
+    ASSERT(0 == Util::writeCategory(output, 6, "CAT.B"));
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+    size = Codec::encode(arguments, 2) - arguments;
+#endif
+    ASSERT(0 == Util::writeEntry(output,
+                                 2,
+                                 6,
+                                 bsls::TimeInterval(86401, 0),
+                                 12,
+                                 arguments,
+                                 size));
+    ASSERT(0 == Util::writeEntry(output,
+                                 2,
+                                 5,
+                                 bsls::TimeInterval(86402, 0),
+                                 13,
+                                 arguments,
+                                 size));
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Decoding a Binary Log
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to write a message to a binary log, and later print
+// it as text.
+//
+// First, we write the header, the definitions of a site and a category, and
+// one entry referring to both:
+// ```
+    bsl::stringstream stream;
+
+    int rc = ball::DeferredLogFileUtil::writeHeader(stream, 1234);
+    ASSERT(0 == rc);
+
+    rc = ball::DeferredLogFileUtil::writeSite(stream,
+                                              1,
+                                              ball::Severity::e_INFO,
+                                              ball::DeferredLogCodec::e_PRINTF,
+                                              __LINE__,
+                                              "myfile.cpp",
+                                              "price = %d");
+    ASSERT(0 == rc);
+
+    rc = ball::DeferredLogFileUtil::writeCategory(stream, 7, "EXAMPLE");
+    ASSERT(0 == rc);
+
+    char         arguments[32];
+    char        *end  = ball::DeferredLogCodec::encode(arguments, 150);
+    bsl::size_t  size = end - arguments;
+
+    rc = ball::DeferredLogFileUtil::writeEntry(stream,
+                                               1,
+                                               7,
+                                               bsls::TimeInterval(0, 0),
+                                               42,
+                                               arguments,
+                                               size);
+    ASSERT(0 == rc);
+// ```
+// Then, we decode the log, formatting each message with a record formatter
+// that prints the thread ID, category, and message:
+// ```
+    bsl::ostringstream output;
+
+    rc = ball::DeferredLogFileUtil::decode(output,
+                                           stream,
+                                           ball::RecordStringFormatter(
+                                                                "%t %c %m\n"));
+    ASSERT(0 == rc);
+    ASSERT("42 EXAMPLE price = 150\n" == output.str());
+// ```
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DECODE
+        //
+        // Concerns:
+        // 1. `decode` writes each record formatted by the supplied formatter,
+        //    and returns 0 for a valid log.
+        //
+        // 2. `decode` returns a non-zero value for an invalid log, having
+        //    written the records preceding the first invalid one.
+        //
+        // Plan:
+        // 1. Decode a valid log, and a valid log followed by an unknown record
+        //    kind, and verify the output and status.  (C-1..2)
+        //
+        // Testing:
+        //   int decode(ostream&, istream&, const RecordStringFormatter&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODE" << endl
+                          << "======" << endl;
+
+        const char *EXPECTED = "11 CAT.A WARN a.cpp:10 x=1 s=one\n"
+                               "12 CAT.B ERROR b.cpp:20 y=  2\n"
+                               "13 CAT.A ERROR b.cpp:20 y=  2\n";
+
+        const ball::RecordStringFormatter formatter("%t %c %s %F:%l %m\n");
+
+        bsl::stringstream log;
+        u::writeLog(log);
+        {
+            bsl::istringstream input(log.str());
+            bsl::ostringstream output;
+
+            ASSERT(0 == Util::decode(output, input, formatter));
+            ASSERTV(output.str(), EXPECTED == output.str());
+        }
+        {
+            bsl::istringstream input(log.str() + "Z");
+            bsl::ostringstream output;
+
+            ASSERT(0 != Util::decode(output, input, formatter));
+            ASSERTV(output.str(), EXPECTED == output.str());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INVALID LOGS
+        //
+        // Concerns:
+        // 1. A log truncated anywhere but between records, a log with a bad
+        //    header, an unknown record kind, an entry referring to an
+        //    undefined site or category, a duplicate definition, or an entry
+        //    with corrupt arguments is reported by a non-zero status.
+        //
+        // 2. The records preceding the first invalid one are visited.
+        //
+        // Plan:
+        // 1. Read every prefix of a valid log, and verify the status and the
+        //    number of visited records.  (C-1..2)
+        //
+        // 2. Read logs having each kind of invalid record.  (C-1)
+        //
+        // Testing:
+        //   int readRecords(istream&, const RecordVisitor&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INVALID LOGS" << endl
+                          << "============" << endl;
+
+        bsl::stringstream log;
+        u::writeLog(log);
+        const bsl::string LOG = log.str();
+
+        if (verbose) cout << "\tTruncated logs." << endl;
+
+        bsl::size_t headerLength;
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 77));
+            headerLength = s.str().length();
+        }
+        int numValidPrefixes = 0;
+        for (bsl::size_t n = 0; n <= LOG.length(); ++n) {
+            bsl::vector<ball::Record> records;
+            bsl::istringstream        input(LOG.substr(0, n));
+
+            const int rc = Util::readRecords(input, u::RecordSaver(&records));
+            if (0 == rc) {
+                ++numValidPrefixes;
+            }
+            if (veryVerbose) { P_(n) P_(rc) P(records.size()) }
+            ASSERTV(n, rc, n >= headerLength || 0 != rc);
+        }
+        // Valid prefixes end after the header, or after one of 7 records.
+        ASSERTV(numValidPrefixes, 8 == numValidPrefixes);
+
+        if (verbose) cout << "\tInvalid records." << endl;
+        {
+            bsl::string bad(LOG);
+            bad[0] = 'X';
+            bsl::istringstream        input(bad);
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(input, u::RecordSaver(&records)));
+            ASSERT(records.empty());
+        }
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 1));
+            ASSERT(0 == Util::writeCategory(s, 1, "C"));
+            ASSERT(0 == Util::writeEntry(s, 1, 1, bsls::TimeInterval(), 1, 0,
+                                         0));
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(s, u::RecordSaver(&records)));
+        }
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 1));
+            ASSERT(0 == Util::writeSite(s, 1, 32, Codec::e_FORMAT, 1, "f",
+                                        "{}"));
+            ASSERT(0 == Util::writeEntry(s, 1, 1, bsls::TimeInterval(), 1, 0,
+                                         0));
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(s, u::RecordSaver(&records)));
+        }
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 1));
+            ASSERT(0 == Util::writeCategory(s, 1, "C"));
+            ASSERT(0 == Util::writeCategory(s, 1, "D"));
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(s, u::RecordSaver(&records)));
+        }
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 1));
+            ASSERT(0 == Util::writeSite(s, 1, 32, Codec::e_FORMAT, 1, "f",
+                                        "{}"));
+            ASSERT(0 == Util::writeSite(s, 1, 32, Codec::e_FORMAT, 1, "f",
+                                        "{}"));
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(s, u::RecordSaver(&records)));
+        }
+        {
+            bsl::stringstream s;
+            ASSERT(0 == Util::writeHeader(s, 1));
+            ASSERT(0 == Util::writeSite(s, 1, 32, Codec::e_FORMAT, 1, "f",
+                                        "{}"));
+            ASSERT(0 == Util::writeCategory(s, 1, "C"));
+            ASSERT(0 == Util::writeEntry(s, 1, 1, bsls::TimeInterval(), 1,
+                                         "\x7f", 1));
+            bsl::vector<ball::Record> records;
+            ASSERT(0 != Util::readRecords(s, u::RecordSaver(&records)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WRITE AND READ RECORDS
+        //
+        // Concerns:
+        // 1. Each written entry is read as a record having the written
+        //    timestamp, process ID, thread ID, and category, and the file
+        //    name, line number, and severity of its site.
+        //
+        // 2. The message of each record is formatted from the format string
+        //    of its site, in the style of its site.
+        //
+        // 3. The records are visited in the order they were written.
+        //
+        // Plan:
+        // 1. Write a log with two sites, two categories, and three entries,
+        //    read it, and verify each field of each record.  (C-1..3)
+        //
+        // Testing:
+        //   int writeHeader(ostream&, int);
+        //   int writeSite(ostream&, uint, int, Style, int, string_view, ...);
+        //   int writeCategory(ostream&, uint, const string_view&);
+        //   int writeEntry(ostream&, uint, uint, TimeInterval, Uint64, ...);
+        //   int readRecords(istream&, const RecordVisitor&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WRITE AND READ RECORDS" << endl
+                          << "======================" << endl;
+
+        bsl::stringstream log;
+        u::writeLog(log);
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readRecords(log, u::RecordSaver(&records)));
+        ASSERTV(records.size(), 3 == records.size());
+
+        const ball::RecordAttributes& R0 = records[0].fixedFields();
+        ASSERT(bdlt::Datetime(1970, 1, 2, 0, 0, 0, 123, 456) ==
+                                                              R0.timestamp());
+        ASSERT(77                     == R0.processID());
+        ASSERT(11                     == R0.threadID());
+        ASSERT("a.cpp"                == bsl::string_view(R0.fileName()));
+        ASSERT(10                     == R0.lineNumber());
+        ASSERT("CAT.A"                == bsl::string_view(R0.category()));
+        ASSERT(ball::Severity::e_WARN == R0.severity());
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        ASSERTV(R0.message(), "x=1 s=one" == bsl::string_view(R0.message()));
+#endif
+
+        const ball::RecordAttributes& R1 = records[1].fixedFields();
+        ASSERT(bdlt::Datetime(1970, 1, 2, 0, 0, 1) == R1.timestamp());
+        ASSERT(12                      == R1.threadID());
+        ASSERT("b.cpp"                 == bsl::string_view(R1.fileName()));
+        ASSERT("CAT.B"                 == bsl::string_view(R1.category()));
+        ASSERT(ball::Severity::e_ERROR == R1.severity());
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+        ASSERTV(R1.message(), "y=  2" == bsl::string_view(R1.message()));
+#endif
+
+        const ball::RecordAttributes& R2 = records[2].fixedFields();
+        ASSERT(13      == R2.threadID());
+        ASSERT("CAT.A" == bsl::string_view(R2.category()));
+        ASSERT(20      == R2.lineNumber());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Write a log with one entry, and read it back.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::stringstream s;
+        ASSERT(0 == Util::writeHeader(s, 1));
+        ASSERT(0 == Util::writeSite(s, 3, 64, Codec::e_PRINTF, 9, "f.cpp",
+                                    "hello"));
+        ASSERT(0 == Util::writeCategory(s, 4, "CAT"));
+        ASSERT(0 == Util::writeEntry(s, 3, 4, bsls::TimeInterval(), 2, 0, 0));
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readRecords(s, u::RecordSaver(&records)));
+        ASSERT(1 == records.size());
+        ASSERT("hello" ==
+                      bsl::string_view(records[0].fixedFields().message()));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
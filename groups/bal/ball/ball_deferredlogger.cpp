@@ -0,0 +1,534 @@
+// ball_deferredlogger.cpp                                            -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogger_cpp,"$Id$ $CSID$")
+
+#include <ball_deferredlogfileutil.h>
+#include <ball_loggermanager.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdlf_memfn.h>
+
+#include <bdls_processutil.h>
+
+#include <bdlt_epochutil.h>
+
+#include <bslma_rawdeleterproctor.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+const char *const k_THREAD_NAME = "ball.deferred";
+
+/// Return the specified `size` rounded up to a power of two no less than
+/// `ball::DeferredLogger::k_MIN_BUFFER_SIZE`.
+bsl::size_t roundBufferSize(bsl::size_t size)
+{
+    bsl::size_t result = ball::DeferredLogger::k_MIN_BUFFER_SIZE;
+    while (result < size) {
+        result *= 2;
+    }
+    return result;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace ball {
+
+                     // ---------------------------------
+                     // class DeferredLogger_ThreadBuffer
+                     // ---------------------------------
+
+// CREATORS
+DeferredLogger_ThreadBuffer::DeferredLogger_ThreadBuffer(
+                                          bsl::size_t          capacity,
+                                          bsls::Types::Uint64  threadId,
+                                          bslma::Allocator    *allocator)
+: d_tail(0)
+, d_cachedHead(0)
+, d_pendingTail(0)
+, d_numDropped(0)
+, d_producerPad()
+, d_head(0)
+, d_isReleased(false)
+, d_consumerPad()
+, d_data_p(static_cast<char *>(allocator->allocate(capacity)))
+, d_mask(capacity - 1)
+, d_threadId(threadId)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT(64 <= capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    // Touch the ring now, so that the producer does not incur page faults.
+
+    bsl::memset(d_data_p, 0, capacity);
+}
+
+DeferredLogger_ThreadBuffer::~DeferredLogger_ThreadBuffer()
+{
+    d_allocator_p->deallocate(d_data_p);
+}
+
+                      // --------------------------------
+                      // struct DeferredLogger::EntryLess
+                      // --------------------------------
+
+bool DeferredLogger::EntryLess::operator()(const Entry& lhs,
+                                           const Entry& rhs) const
+{
+    return lhs.d_timer < rhs.d_timer;
+}
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Pointer DeferredLogger::s_installed =
+                                                                         { 0 };
+
+// PRIVATE CLASS METHODS
+void DeferredLogger::logNow(const DeferredLogSite&  site,
+                            const Category         *category,
+                            const char             *arguments,
+                            bsl::size_t             argumentsSize)
+{
+    bsl::vector<DeferredLogArgument> decoded;
+    bsl::string                      message;
+
+    if (0 != DeferredLogCodec::decode(&decoded, arguments, argumentsSize)) {
+        decoded.clear();
+    }
+    DeferredLogCodec::format(&message, site.d_style, site.d_format_p, decoded);
+
+    Record *record = Log::getRecord(category, site.d_file_p, site.d_line);
+    record->fixedFields().setMessage(message);
+    Log::logMessage(category, site.d_severity, record);
+}
+
+void DeferredLogger::releaseThreadBuffer(void *buffer)
+{
+    static_cast<ThreadBuffer *>(buffer)->release();
+}
+
+// PRIVATE MANIPULATORS
+DeferredLogger::ThreadBuffer *DeferredLogger::createThreadBuffer()
+{
+    ThreadBuffer *buffer = new (*d_allocator_p) ThreadBuffer(
+                                        d_bufferSize,
+                                        bslmt::ThreadUtil::selfIdAsUint64(),
+                                        d_allocator_p);
+
+    bslma::RawDeleterProctor<ThreadBuffer, bslma::Allocator> proctor(
+                                                                buffer,
+                                                                d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_buffers.push_back(buffer);
+    }
+    proctor.release();
+
+    bslmt::ThreadUtil::setSpecific(d_key, buffer);
+    return buffer;
+}
+
+void DeferredLogger::processBatches()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (true) {
+        const bool                isStopping       = d_isStopping;
+        const bsls::Types::Uint64 numFlushRequests = d_numFlushRequests;
+
+        d_batchBuffers = d_buffers;
+        {
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlockGuard(&d_mutex);
+
+            processBatch();
+        }
+
+        // Free the buffers of the threads that have exited, once drained.
+
+        for (bsl::size_t i = 0; i < d_buffers.size(); ) {
+            ThreadBuffer *buffer = d_buffers[i];
+            if (buffer->isReleased()
+             && buffer->head() == buffer->acquireTail()) {
+                d_numDroppedReleased += buffer->numDropped();
+                d_buffers.erase(d_buffers.begin() + i);
+                d_allocator_p->deleteObject(buffer);
+            }
+            else {
+                ++i;
+            }
+        }
+
+        d_numFlushesDone = numFlushRequests;
+        d_condition.broadcast();
+
+        if (isStopping) {
+            break;
+        }
+
+        if (!d_isStopping && d_numFlushRequests == numFlushRequests) {
+            bsls::TimeInterval timeout =
+                                     bsls::SystemTime::nowMonotonicClock();
+            timeout.addMilliseconds(k_POLL_INTERVAL_MS);
+            d_condition.timedWait(&d_mutex, timeout);
+        }
+    }
+}
+
+void DeferredLogger::processBatch()
+{
+    d_batchTails.clear();
+    d_batchEntries.clear();
+
+    for (bsl::size_t i = 0; i < d_batchBuffers.size(); ++i) {
+        const ThreadBuffer        *buffer   = d_batchBuffers[i];
+        const bsls::Types::Uint64  tail     = buffer->acquireTail();
+        bsls::Types::Uint64        position = buffer->head();
+
+        d_batchTails.push_back(tail);
+        while (position != tail) {
+            const EntryHeader *header = buffer->entry(&position);
+            const Entry        entry  = { header->d_timer,
+                                          header,
+                                          buffer->threadId() };
+            d_batchEntries.push_back(entry);
+        }
+    }
+
+    bsl::stable_sort(d_batchEntries.begin(),
+                     d_batchEntries.end(),
+                     EntryLess());
+
+    for (bsl::size_t i = 0; i < d_batchEntries.size(); ++i) {
+        processEntry(d_batchEntries[i]);
+    }
+
+    for (bsl::size_t i = 0; i < d_batchBuffers.size(); ++i) {
+        d_batchBuffers[i]->releaseTo(d_batchTails[i]);
+    }
+
+    if (d_file.is_open() && !d_batchEntries.empty()) {
+        d_file.flush();
+    }
+    d_numLogged.addRelaxed(d_batchEntries.size());
+}
+
+void DeferredLogger::processEntry(const Entry& entry)
+{
+    const EntryHeader&      header    = *entry.d_header_p;
+    const DeferredLogSite&  site      = *header.d_site_p;
+    const Category         *category  = header.d_category_p;
+    const char             *arguments = reinterpret_cast<const char *>(
+                                                                  &header + 1);
+
+    bsls::TimeInterval timestamp(d_timeBase);
+    timestamp.addNanoseconds(header.d_timer - d_timerBase);
+
+    if (d_file.is_open()) {
+        const unsigned int numSites = static_cast<unsigned int>(
+                                                            d_siteIds.size());
+        const bsl::pair<bsl::unordered_map<const DeferredLogSite *,
+                                           unsigned int>::iterator,
+                        bool> siteId =
+                  d_siteIds.insert(bsl::make_pair(&site, numSites + 1));
+        if (siteId.second) {
+            DeferredLogFileUtil::writeSite(d_file,
+                                           siteId.first->second,
+                                           site.d_severity,
+                                           site.d_style,
+                                           site.d_line,
+                                           site.d_file_p,
+                                           site.d_format_p);
+        }
+
+        const unsigned int numCategories = static_cast<unsigned int>(
+                                                        d_categoryIds.size());
+        const bsl::pair<bsl::unordered_map<const Category *,
+                                           unsigned int>::iterator,
+                        bool> categoryId =
+                      d_categoryIds.insert(bsl::make_pair(category,
+                                                          numCategories + 1));
+        if (categoryId.second) {
+            DeferredLogFileUtil::writeCategory(d_file,
+                                               categoryId.first->second,
+                                               category->categoryName());
+        }
+
+        DeferredLogFileUtil::writeEntry(d_file,
+                                        siteId.first->second,
+                                        categoryId.first->second,
+                                        timestamp,
+                                        entry.d_threadId,
+                                        arguments,
+                                        header.d_argumentsSize);
+        return;                                                       // RETURN
+    }
+
+    if (0 != DeferredLogCodec::decode(&d_arguments,
+                                      arguments,
+                                      header.d_argumentsSize)) {
+        d_arguments.clear();
+    }
+    DeferredLogCodec::format(&d_message,
+                             site.d_style,
+                             site.d_format_p,
+                             d_arguments);
+
+    if (!LoggerManager::isInitialized()) {
+        Record *record = LoggerManager::getRecord(site.d_file_p, site.d_line);
+        record->fixedFields().setMessage(d_message);
+        LoggerManager::logMessage(site.d_severity, record);
+        return;                                                       // RETURN
+    }
+
+    Logger&           logger     = LoggerManager::singleton().getLogger();
+    Record           *record     = logger.getRecord(site.d_file_p,
+                                                    site.d_line);
+    RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setMessage(d_message);
+    attributes.setTimestamp(
+                         bdlt::EpochUtil::convertFromTimeInterval(timestamp));
+    attributes.setThreadID(entry.d_threadId);
+
+    logger.logDeferredMessage(*category, site.d_severity, record);
+}
+
+// CREATORS
+DeferredLogger::DeferredLogger(bslma::Allocator *basicAllocator)
+: d_bufferSize(k_DEFAULT_BUFFER_SIZE)
+, d_timerBase(bsls::TimeUtil::getTimer())
+, d_timeBase(bsls::SystemTime::nowRealtimeClock())
+, d_condition(bsls::SystemClockType::e_MONOTONIC)
+, d_buffers(basicAllocator)
+, d_thread()
+, d_isStarted(false)
+, d_isStopping(false)
+, d_numFlushRequests(0)
+, d_numFlushesDone(0)
+, d_numDroppedReleased(0)
+, d_numLogged(0)
+, d_siteIds(basicAllocator)
+, d_categoryIds(basicAllocator)
+, d_batchBuffers(basicAllocator)
+, d_batchTails(basicAllocator)
+, d_batchEntries(basicAllocator)
+, d_arguments(basicAllocator)
+, d_message(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    int rc = bslmt::ThreadUtil::createKey(&d_key, &releaseThreadBuffer);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+}
+
+DeferredLogger::DeferredLogger(bsl::size_t       bufferSize,
+                               bslma::Allocator *basicAllocator)
+: d_bufferSize(u::roundBufferSize(bufferSize))
+, d_timerBase(bsls::TimeUtil::getTimer())
+, d_timeBase(bsls::SystemTime::nowRealtimeClock())
+, d_condition(bsls::SystemClockType::e_MONOTONIC)
+, d_buffers(basicAllocator)
+, d_thread()
+, d_isStarted(false)
+, d_isStopping(false)
+, d_numFlushRequests(0)
+, d_numFlushesDone(0)
+, d_numDroppedReleased(0)
+, d_numLogged(0)
+, d_siteIds(basicAllocator)
+, d_categoryIds(basicAllocator)
+, d_batchBuffers(basicAllocator)
+, d_batchTails(basicAllocator)
+, d_batchEntries(basicAllocator)
+, d_arguments(basicAllocator)
+, d_message(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    int rc = bslmt::ThreadUtil::createKey(&d_key, &releaseThreadBuffer);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+}
+
+DeferredLogger::~DeferredLogger()
+{
+    stop();
+
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    for (bsl::size_t i = 0; i < d_buffers.size(); ++i) {
+        d_allocator_p->deleteObject(d_buffers[i]);
+    }
+    closeBinaryFile();
+}
+
+// MANIPULATORS
+void DeferredLogger::closeBinaryFile()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(!d_isStarted);
+
+    if (d_file.is_open()) {
+        d_file.close();
+    }
+    d_siteIds.clear();
+    d_categoryIds.clear();
+}
+
+void DeferredLogger::flush()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_isStarted) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Uint64 ticket = ++d_numFlushRequests;
+    d_condition.broadcast();
+    while (d_numFlushesDone < ticket) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+int DeferredLogger::openBinaryFile(const char *path)
+{
+    BSLS_ASSERT(path);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_isStarted || d_file.is_open()) {
+        return -1;                                                    // RETURN
+    }
+
+    d_file.open(path,
+                bsl::ios_base::out | bsl::ios_base::trunc
+                                   | bsl::ios_base::binary);
+    if (!d_file.is_open()) {
+        return -2;                                                    // RETURN
+    }
+
+    if (0 != DeferredLogFileUtil::writeHeader(
+                                       d_file,
+                                       bdls::ProcessUtil::getProcessId())) {
+        d_file.close();
+        return -3;                                                    // RETURN
+    }
+    d_siteIds.clear();
+    d_categoryIds.clear();
+    return 0;
+}
+
+int DeferredLogger::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_isStarted) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != bsls::AtomicOperations::testAndSwapPtr(&s_installed, 0, this)) {
+        return -2;                                                    // RETURN
+    }
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName(u::k_THREAD_NAME);
+
+    d_isStopping = false;
+    if (0 != bslmt::ThreadUtil::createWithAllocator(
+                       &d_thread,
+                       attributes,
+                       bdlf::MemFnUtil::memFn(&DeferredLogger::processBatches,
+                                              this),
+                       d_allocator_p)) {
+        bsls::AtomicOperations::setPtrRelease(&s_installed, 0);
+        return -3;                                                    // RETURN
+    }
+    d_isStarted = true;
+    return 0;
+}
+
+void DeferredLogger::stop()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isStarted) {
+            return;                                                   // RETURN
+        }
+        bsls::AtomicOperations::testAndSwapPtr(&s_installed, this, 0);
+
+        d_isStopping = true;
+        d_condition.broadcast();
+    }
+
+    bslmt::ThreadUtil::join(d_thread);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_isStarted  = false;
+    d_isStopping = false;
+}
+
+// ACCESSORS
+bool DeferredLogger::isBinaryFileOpen() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_file.is_open();
+}
+
+bool DeferredLogger::isStarted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isStarted;
+}
+
+bsls::Types::Uint64 DeferredLogger::numDropped() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bsls::Types::Uint64 result = d_numDroppedReleased;
+    for (bsl::size_t i = 0; i < d_buffers.size(); ++i) {
+        result += d_buffers[i]->numDropped();
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
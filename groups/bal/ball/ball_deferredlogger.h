@@ -0,0 +1,900 @@
+// ball_deferredlogger.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGGER
+#define INCLUDED_BALL_DEFERREDLOGGER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide macros and a logger that defer formatting of log messages.
+//
+//@CLASSES:
+//  ball::DeferredLogger: background formatter of deferred log messages
+//  ball::DeferredLogSite: static description of a deferred log statement
+//
+//@MACROS:
+//  BALL_DEFERRED_LOGVA_TRACE: defer a `printf`-style message at `e_TRACE`
+//  BALL_DEFERRED_LOGVA_DEBUG: defer a `printf`-style message at `e_DEBUG`
+//  BALL_DEFERRED_LOGVA_INFO:  defer a `printf`-style message at `e_INFO`
+//  BALL_DEFERRED_LOGVA_WARN:  defer a `printf`-style message at `e_WARN`
+//  BALL_DEFERRED_LOGVA_ERROR: defer a `printf`-style message at `e_ERROR`
+//  BALL_DEFERRED_LOGVA_FATAL: defer a `printf`-style message at `e_FATAL`
+//  BALL_DEFERRED_FMT_TRACE: defer a `bsl::format`-style message at `e_TRACE`
+//  BALL_DEFERRED_FMT_DEBUG: defer a `bsl::format`-style message at `e_DEBUG`
+//  BALL_DEFERRED_FMT_INFO:  defer a `bsl::format`-style message at `e_INFO`
+//  BALL_DEFERRED_FMT_WARN:  defer a `bsl::format`-style message at `e_WARN`
+//  BALL_DEFERRED_FMT_ERROR: defer a `bsl::format`-style message at `e_ERROR`
+//  BALL_DEFERRED_FMT_FATAL: defer a `bsl::format`-style message at `e_FATAL`
+//
+//@SEE_ALSO: ball_log, ball_fmt, ball_deferredlogcodec,
+//           ball_deferredlogfileutil
+//
+//@DESCRIPTION: This component provides a set of macros that log messages
+// whose formatting is deferred, and a mechanism, `ball::DeferredLogger`,
+// that formats those messages on a background thread.
+//
+// A message logged by `BALL_LOGVA_*` or `BALL_FMT_*` is formatted by the
+// thread executing the log statement, which also obtains a record from the
+// logger and passes it to the observer.  For threads with tight latency
+// budgets, that cost (typically 1 to 3 microseconds) may be prohibitive.  The
+// `BALL_DEFERRED_LOGVA_*` and `BALL_DEFERRED_FMT_*` macros, which take the
+// same arguments as `BALL_LOGVA_*` and `BALL_FMT_*` respectively, instead
+// copy the raw bytes of the arguments (see `ball_deferredlogcodec`) along
+// with the address of a static description of the log statement (a
+// `ball::DeferredLogSite`, holding the format string, file name, line number,
+// and severity) and a timestamp into a buffer local to the logging thread.
+// The `ball::DeferredLogger` installed for the process reads those buffers on
+// a background thread, and either formats each message into a `ball::Record`
+// that it passes to the logger manager, or writes it, unformatted, to a
+// binary log file to be formatted offline (see `ball_deferredlogfileutil`
+// and the `ball_deferredlogdecoder` tool).
+//
+// If no `ball::DeferredLogger` is installed (or if the logger manager
+// singleton is not initialized), the deferred macros log their message
+// immediately, as `BALL_LOGVA_*` and `BALL_FMT_*` do.
+//
+///Restrictions
+///------------
+// Because formatting is deferred, the deferred macros are more restrictive
+// than the macros they replace:
+//
+// * The format string must be a string literal.
+// * The arguments must be of one of the types supported by
+//   `ball_deferredlogcodec`: fundamental types, pointers, and strings.  A
+//   value of any other type must be converted to a string by the caller.
+// * A `bsl::format` format string can refer to at most
+//   `ball::DeferredLogCodec::k_MAX_FORMAT_ARGUMENTS` arguments, and its
+//   replacement fields cannot have nested replacement fields.
+// * The attributes of the logging thread (see `ball_scopedattribute`) are
+//   not captured: attribute collectors and the user fields populator are
+//   invoked on the background thread.
+// * Records are published in timestamp order within each batch read by the
+//   background thread, but a record committed while a batch is being
+//   processed may be published after records having a later timestamp.
+//
+///Thread Buffers
+///--------------
+// Each thread that logs a deferred message while a `ball::DeferredLogger` is
+// installed is given a buffer of `bufferSize()` bytes, which the thread fills
+// and the background thread drains.  Neither a lock nor an allocation is
+// needed to log a message, except when the thread logs its first message.
+// If the buffer of a thread has no room for a message, the message is
+// dropped and counted (see `numDropped`).  The buffer of a thread is freed
+// once the thread has exited and its messages have been processed.
+//
+///Performance
+///-----------
+// The cost of a deferred log statement is that of reading the timer (see
+// `bsls::TimeUtil::getTimer`), of looking up the buffer of the thread, and of
+// copying the arguments (one byte of type tag plus eight bytes per scalar,
+// and the characters of each string) into memory that was touched when the
+// buffer was created.  Reading the timer dominates: test case -1 of the test
+// driver of this component measures 15 to 20 nanoseconds per statement on
+// top of the cost of `getTimer`, for a message with three scalar arguments,
+// compared to about a microsecond for the equivalent `BALL_LOGVA_*`
+// statement.
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Deferring the Formatting of Log Messages
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a function on a latency-sensitive path logs the orders it
+// processes.  We use the deferred macros in place of `BALL_LOGVA_INFO` and
+// `BALL_FMT_INFO`:
+// ```
+// void processOrder(int id, const bsl::string& symbol, double price)
+// {
+//     BALL_LOG_SET_CATEGORY("EXAMPLE.ORDERS");
+//
+//     BALL_DEFERRED_LOGVA_INFO("order %d: %s at %.2f", id, symbol, price);
+//     BALL_DEFERRED_FMT_INFO("order {}: {} at {:.2f}", id, symbol, price);
+// }
+// ```
+// Then, in `main`, after initializing the logger manager, we create a
+// deferred logger and start it, which installs it for the process:
+// ```
+// ball::DeferredLogger logger;
+//
+// int rc = logger.start();
+// assert(0 == rc);
+//
+// processOrder(1, "IBM", 134.5);
+// processOrder(2, "MSFT", 411.25);
+// ```
+// Finally, we stop the logger, which formats and publishes any pending
+// messages before returning:
+// ```
+// logger.stop();
+// assert(4 == logger.numLogged());
+// assert(0 == logger.numDropped());
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_category.h>
+#include <ball_deferredlogcodec.h>
+#include <ball_fmt.h>
+#include <ball_log.h>
+#include <ball_severity.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_fstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+                        // ============================
+                        // Deferred Logging Macro Utils
+                        // ============================
+
+// Implementation note: `BALL_DEFERRED_LOG_FORMAT` evaluates to its first
+// argument, concatenated with an empty string literal so that a format
+// string that is not a string literal fails to compile.
+
+#define BALL_DEFERRED_LOG_FORMAT(...)                                         \
+    BALL_DEFERRED_LOG_FORMAT_IMP("" __VA_ARGS__, 0)
+
+#define BALL_DEFERRED_LOG_FORMAT_IMP(FORMAT, ...) FORMAT
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+#define BALL_DEFERRED_LOG_IMP(SEVERITY, STYLE, ...)                           \
+do {                                                                          \
+    static const BloombergLP::ball::DeferredLogSite ball_log_dEfErReDsItE = { \
+        BALL_DEFERRED_LOG_FORMAT(__VA_ARGS__),                                \
+        __FILE__,                                                             \
+        __LINE__,                                                             \
+        (SEVERITY),                                                           \
+        (STYLE)                                                               \
+    };                                                                        \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::DeferredLogger::log(                               \
+                                         ball_log_dEfErReDsItE,               \
+                                         ball_log_cAtEgOrYhOlDeR->category(), \
+                                         __VA_ARGS__);                        \
+    }                                                                         \
+} while(0)
+
+#define BALL_DEFERRED_LOGVA_IMP(SEVERITY, ...)                                \
+    BALL_DEFERRED_LOG_IMP((SEVERITY),                                         \
+                          BloombergLP::ball::DeferredLogCodec::e_PRINTF,      \
+                          __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_IMP(SEVERITY, ...)                                  \
+    BALL_DEFERRED_LOG_IMP((SEVERITY),                                         \
+                          BloombergLP::ball::DeferredLogCodec::e_FORMAT,      \
+                          __VA_ARGS__)
+
+#else  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+// Without variadic templates the arguments cannot be captured, so the
+// deferred macros log their message immediately.
+
+#define BALL_DEFERRED_LOGVA_IMP(SEVERITY, ...)                                \
+    BALL_LOGVA_CONST_IMP((SEVERITY), __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_IMP(SEVERITY, ...)                                  \
+    BALL_LOG_STREAM_CONST_IMP((SEVERITY)) BALL_FMT(__VA_ARGS__)
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+                       // ==============================
+                       // `printf`-style deferred macros
+                       // ==============================
+
+#define BALL_DEFERRED_LOGVA_TRACE(...)                                        \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_DEFERRED_LOGVA_DEBUG(...)                                        \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_DEFERRED_LOGVA_INFO(...)                                         \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_INFO, __VA_ARGS__)
+
+#define BALL_DEFERRED_LOGVA_WARN(...)                                         \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_WARN, __VA_ARGS__)
+
+#define BALL_DEFERRED_LOGVA_ERROR(...)                                        \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_DEFERRED_LOGVA_FATAL(...)                                        \
+    BALL_DEFERRED_LOGVA_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
+                    // ===================================
+                    // `bsl::format`-style deferred macros
+                    // ===================================
+
+#define BALL_DEFERRED_FMT_TRACE(...)                                          \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_DEBUG(...)                                          \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_INFO(...)                                           \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_INFO, __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_WARN(...)                                           \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_WARN, __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_ERROR(...)                                          \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_FATAL(...)                                          \
+    BALL_DEFERRED_FMT_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
+namespace BloombergLP {
+namespace ball {
+
+                           // ======================
+                           // struct DeferredLogSite
+                           // ======================
+
+/// This `struct` describes a deferred log statement.  An object of this
+/// type is a constant-initialized static variable defined by each deferred
+/// log statement, whose address identifies the statement.
+struct DeferredLogSite {
+
+    // PUBLIC DATA
+    const char              *d_format_p;  // format string
+    const char              *d_file_p;    // source file name
+    int                      d_line;      // source line number
+    int                      d_severity;  // severity of the message
+    DeferredLogCodec::Style  d_style;     // style of `d_format_p`
+};
+
+                     // =================================
+                     // struct DeferredLogger_EntryHeader
+                     // =================================
+
+/// This component-private `struct` is the header of an entry in a thread
+/// buffer.  The encoded arguments of the entry follow the header.
+struct DeferredLogger_EntryHeader {
+
+    // PUBLIC DATA
+    unsigned int            d_size;           // size of the entry, including
+                                              // this header and padding; 0
+                                              // marks the end of the buffer
+
+    unsigned int            d_argumentsSize;  // size of the encoded arguments
+
+    const DeferredLogSite  *d_site_p;         // log statement
+
+    const Category         *d_category_p;     // category of the message
+
+    bsls::Types::Int64      d_timer;          // timestamp, as returned by
+                                              // `bsls::TimeUtil::getTimer`
+};
+
+                     // =================================
+                     // class DeferredLogger_ThreadBuffer
+                     // =================================
+
+/// This component-private class implements a single-producer,
+/// single-consumer ring buffer of variable-size entries.  The producer is
+/// the thread owning the buffer, and the consumer is the background thread
+/// of a `DeferredLogger`.
+class DeferredLogger_ThreadBuffer {
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    bsls::AtomicUint64   d_tail;           // position following the last
+                                           // committed entry (written by the
+                                           // producer)
+
+    Uint64               d_cachedHead;     // last value of `d_head` read by
+                                           // the producer
+
+    Uint64               d_pendingTail;    // position following the entry
+                                           // being written by the producer
+
+    bsls::AtomicUint64   d_numDropped;     // number of entries dropped for
+                                           // lack of room
+
+    const char           d_producerPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - 4 * sizeof(Uint64)];
+                                           // padding to prevent the
+                                           // consumer data from being in the
+                                           // same cache line as the producer
+                                           // data
+
+    bsls::AtomicUint64   d_head;           // position of the first
+                                           // unconsumed entry (written by the
+                                           // consumer)
+
+    bsls::AtomicBool     d_isReleased;     // `true` once the producer thread
+                                           // has exited
+
+    const char           d_consumerPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - sizeof(Uint64)
+                                       - sizeof(bsls::AtomicBool)];
+                                           // padding to prevent subsequent
+                                           // data from being in the same
+                                           // cache line as the consumer data
+
+    char                *d_data_p;         // ring of `d_mask + 1` bytes
+
+    const Uint64         d_mask;           // capacity of the ring, minus 1
+
+    const Uint64         d_threadId;       // ID of the producer thread
+
+    bslma::Allocator    *d_allocator_p;    // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    DeferredLogger_ThreadBuffer(const DeferredLogger_ThreadBuffer&);
+    DeferredLogger_ThreadBuffer& operator=(const DeferredLogger_ThreadBuffer&);
+
+  public:
+    // CREATORS
+
+    /// Create a buffer of the specified `capacity` bytes owned by the
+    /// thread having the specified `threadId`, using the specified
+    /// `allocator` to supply memory.  The behavior is undefined unless
+    /// `capacity` is a power of two, at least 64.
+    DeferredLogger_ThreadBuffer(bsl::size_t          capacity,
+                                bsls::Types::Uint64  threadId,
+                                bslma::Allocator    *allocator);
+
+    /// Destroy this buffer.
+    ~DeferredLogger_ThreadBuffer();
+
+    // PRODUCER MANIPULATORS
+
+    /// Publish to the consumer the entry returned by the last call to
+    /// `reserve`.  The behavior is undefined unless the last call to
+    /// `reserve` returned a non-null address, and `commit` was not called
+    /// since.
+    void commit();
+
+    /// Return the address at which to encode the specified `argumentsSize`
+    /// bytes of arguments of an entry for the specified `site` and
+    /// `category`, timestamped now, or 0 (and count the entry as dropped) if
+    /// this buffer has no room for the entry.
+    char *reserve(const DeferredLogSite&  site,
+                  const Category         *category,
+                  bsl::size_t             argumentsSize);
+
+    /// Indicate that the producer thread has exited.
+    void release();
+
+    // CONSUMER MANIPULATORS
+
+    /// Return the position following the last committed entry.
+    Uint64 acquireTail() const;
+
+    /// Return the header of the entry at the specified `*position`, skipping
+    /// any end-of-buffer marker, and load into `*position` the position
+    /// following the entry.  The behavior is undefined unless `*position`
+    /// is the position of an entry, or of an end-of-buffer marker, that
+    /// precedes the position returned by `acquireTail`.
+    const DeferredLogger_EntryHeader *entry(Uint64 *position) const;
+
+    /// Free the room of the entries preceding the specified `position`.
+    void releaseTo(Uint64 position);
+
+    // ACCESSORS
+
+    /// Return the position of the first unconsumed entry.
+    Uint64 head() const;
+
+    /// Return `true` if the producer thread has exited, and `false`
+    /// otherwise.
+    bool isReleased() const;
+
+    /// Return the number of entries dropped for lack of room.
+    Uint64 numDropped() const;
+
+    /// Return the ID of the producer thread.
+    Uint64 threadId() const;
+};
+
+                            // ====================
+                            // class DeferredLogger
+                            // ====================
+
+/// This class implements a mechanism that formats, on a background thread,
+/// the messages of deferred log statements.  At most one `DeferredLogger`
+/// is installed for the process at any time, by `start`.  Note that
+/// `DeferredLogger` is thread-safe: `log` may be called concurrently by any
+/// number of threads.
+class DeferredLogger {
+
+    // PRIVATE TYPES
+    typedef DeferredLogger_ThreadBuffer ThreadBuffer;
+    typedef DeferredLogger_EntryHeader  EntryHeader;
+
+    /// This `struct` refers to an entry read from a thread buffer.
+    struct Entry {
+        bsls::Types::Int64  d_timer;      // timestamp of the entry
+        const EntryHeader  *d_header_p;   // entry
+        bsls::Types::Uint64 d_threadId;   // ID of the logging thread
+    };
+
+    /// This `struct` provides an ordering of entries by timestamp.
+    struct EntryLess {
+        bool operator()(const Entry& lhs, const Entry& rhs) const;
+    };
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Pointer s_installed;
+                                              // installed logger
+
+    // DATA
+    const bsl::size_t          d_bufferSize;  // size of each thread buffer
+
+    bslmt::ThreadUtil::Key     d_key;         // key of the thread buffers
+
+    bsls::Types::Int64         d_timerBase;   // timer value at `d_timeBase`
+
+    bsls::TimeInterval         d_timeBase;    // time since the epoch when
+                                              // `d_timerBase` was read
+
+    mutable bslmt::Mutex       d_mutex;       // guards the following data
+
+    bslmt::Condition           d_condition;   // signaled on stop and flush
+                                              // requests and completions
+
+    bsl::vector<ThreadBuffer *>
+                               d_buffers;     // thread buffers (owned)
+
+    bslmt::ThreadUtil::Handle  d_thread;      // background thread
+
+    bool                       d_isStarted;   // `true` if started
+
+    bool                       d_isStopping;  // `true` if `stop` was called
+
+    bsls::Types::Uint64        d_numFlushRequests;
+                                              // number of `flush` calls
+
+    bsls::Types::Uint64        d_numFlushesDone;
+                                              // number of `flush` calls
+                                              // satisfied
+
+    bsls::Types::Uint64        d_numDroppedReleased;
+                                              // entries dropped by freed
+                                              // thread buffers
+
+    bsls::AtomicUint64         d_numLogged;   // number of processed entries
+
+    bsl::ofstream              d_file;        // binary log file, if open
+
+    bsl::unordered_map<const DeferredLogSite *, unsigned int>
+                               d_siteIds;     // IDs of the sites defined in
+                                              // `d_file`
+
+    bsl::unordered_map<const Category *, unsigned int>
+                               d_categoryIds; // IDs of the categories
+                                              // defined in `d_file`
+
+    bsl::vector<ThreadBuffer *>
+                               d_batchBuffers;
+                                              // buffers read by the current
+                                              // batch (background thread)
+
+    bsl::vector<bsls::Types::Uint64>
+                               d_batchTails;  // tails read by the current
+                                              // batch (background thread)
+
+    bsl::vector<Entry>         d_batchEntries;
+                                              // entries of the current batch
+                                              // (background thread)
+
+    bsl::vector<DeferredLogArgument>
+                               d_arguments;   // decoded arguments
+                                              // (background thread)
+
+    bsl::string                d_message;     // formatted message
+                                              // (background thread)
+
+    bslma::Allocator          *d_allocator_p; // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    DeferredLogger(const DeferredLogger&);
+    DeferredLogger& operator=(const DeferredLogger&);
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Format the message of the specified `site`, with the arguments
+    /// encoded in the specified `argumentsSize` bytes at the specified
+    /// `arguments`, and log it now in the specified `category`.
+    static void logNow(const DeferredLogSite&  site,
+                       const Category         *category,
+                       const char             *arguments,
+                       bsl::size_t             argumentsSize);
+
+    /// Mark the specified `buffer` as released.  This function is the
+    /// destructor of the thread-specific buffers.
+    static void releaseThreadBuffer(void *buffer);
+
+    // PRIVATE MANIPULATORS
+
+    /// Create, register, and return the buffer of the calling thread.
+    ThreadBuffer *createThreadBuffer();
+
+    /// Process the entries of the thread buffers of this logger in batches
+    /// until `stop` is called.
+    void processBatches();
+
+    /// Process the entries committed to the thread buffers of this logger
+    /// before this call, in timestamp order, then free the room of those
+    /// entries.
+    void processBatch();
+
+    /// Publish, or write to the binary log file, the specified `entry`.
+    void processEntry(const Entry& entry);
+
+    /// Return the buffer of the calling thread, creating it if needed.
+    ThreadBuffer *threadBuffer();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeferredLogger, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_BUFFER_SIZE = 64 * 1024,  // default size of the buffer of
+                                            // each thread
+
+        k_MIN_BUFFER_SIZE     = 1024,       // minimum size of the buffer of
+                                            // each thread
+
+        k_POLL_INTERVAL_MS    = 1,          // interval at which the
+                                            // background thread reads the
+                                            // thread buffers
+
+        k_STACK_BUFFER_SIZE   = 512         // size of the stack buffer used
+                                            // to encode the arguments of a
+                                            // message logged immediately
+    };
+
+    // CLASS METHODS
+
+    /// Return the address of the installed deferred logger, or 0 if no
+    /// deferred logger is installed.
+    static DeferredLogger *installed();
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+    /// Log a message of the specified `site` in the specified `category`,
+    /// with the specified `args`.  If a deferred logger is installed and
+    /// `category` is not 0, copy `args` into the buffer of the calling
+    /// thread, to be formatted later by the installed logger; otherwise,
+    /// format and log the message now.  The specified format string is
+    /// ignored (`site.d_format_p` is used instead).  Note that this method
+    /// is intended to be called only by the deferred logging macros.
+    template <class... ARGS>
+    static void log(const DeferredLogSite&  site,
+                    const Category         *category,
+                    const char             *,
+                    const ARGS&...          args);
+#endif
+
+    // CREATORS
+
+    /// Create a deferred logger that is not started, giving each logging
+    /// thread a buffer of `k_DEFAULT_BUFFER_SIZE` bytes, or of the
+    /// optionally specified `bufferSize` bytes rounded up to a power of two
+    /// no less than `k_MIN_BUFFER_SIZE`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit DeferredLogger(bslma::Allocator *basicAllocator = 0);
+    explicit DeferredLogger(bsl::size_t       bufferSize,
+                            bslma::Allocator *basicAllocator = 0);
+
+    /// Stop this logger, if started, and destroy it.  The behavior is
+    /// undefined if a deferred log statement is being executed.
+    ~DeferredLogger();
+
+    // MANIPULATORS
+
+    /// Close the binary log file of this logger, if open.  The behavior is
+    /// undefined unless this logger is stopped.
+    void closeBinaryFile();
+
+    /// Block until the messages logged to this logger before this call have
+    /// been processed.  This method has no effect if this logger is not
+    /// started.
+    void flush();
+
+    /// Open the binary log file at the specified `path`, overwriting any
+    /// existing file, so that messages processed by this logger are written
+    /// to that file, unformatted, instead of being published.  Return 0 on
+    /// success, and a non-zero value (with no effect) if this logger is
+    /// started, if a binary log file is already open, or if the file cannot
+    /// be opened.
+    int openBinaryFile(const char *path);
+
+    /// Install this logger for the process, and start its background
+    /// thread.  Return 0 on success, and a non-zero value (with no effect)
+    /// if this logger is already started, if another deferred logger is
+    /// installed, or if the background thread cannot be created.
+    int start();
+
+    /// Uninstall this logger, process all messages logged before this call,
+    /// and stop the background thread.  This method has no effect if this
+    /// logger is not started.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return the size of the buffer of each logging thread.
+    bsl::size_t bufferSize() const;
+
+    /// Return `true` if the binary log file of this logger is open, and
+    /// `false` otherwise.
+    bool isBinaryFileOpen() const;
+
+    /// Return `true` if this logger is started, and `false` otherwise.
+    bool isStarted() const;
+
+    /// Return the number of messages dropped because the buffer of the
+    /// logging thread had no room for them.
+    bsls::Types::Uint64 numDropped() const;
+
+    /// Return the number of messages processed (published, or written to
+    /// the binary log file) by this logger.
+    bsls::Types::Uint64 numLogged() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // class DeferredLogger_ThreadBuffer
+                     // ---------------------------------
+
+// PRODUCER MANIPULATORS
+inline
+void DeferredLogger_ThreadBuffer::commit()
+{
+    d_tail.storeRelease(d_pendingTail);
+}
+
+inline
+char *DeferredLogger_ThreadBuffer::reserve(
+                                        const DeferredLogSite&  site,
+                                        const Category         *category,
+                                        bsl::size_t             argumentsSize)
+{
+    const Uint64 size       = (sizeof(DeferredLogger_EntryHeader)
+                             + argumentsSize + 7) & ~static_cast<Uint64>(7);
+    const Uint64 capacity   = d_mask + 1;
+    const Uint64 tail       = d_tail.loadRelaxed();
+    const Uint64 offset     = tail & d_mask;
+    const Uint64 contiguous = capacity - offset;
+    const Uint64 required   = size <= contiguous ? size : contiguous + size;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                capacity - (tail - d_cachedHead) < required)) {
+        d_cachedHead = d_head.loadAcquire();
+        if (capacity - (tail - d_cachedHead) < required) {
+            d_numDropped.storeRelaxed(d_numDropped.loadRelaxed() + 1);
+            return 0;                                                 // RETURN
+        }
+    }
+
+    char *entry = d_data_p + offset;
+    if (size > contiguous) {
+        reinterpret_cast<DeferredLogger_EntryHeader *>(entry)->d_size = 0;
+        entry = d_data_p;
+    }
+    d_pendingTail = tail + required;
+
+    DeferredLogger_EntryHeader *header =
+                         reinterpret_cast<DeferredLogger_EntryHeader *>(entry);
+    header->d_size          = static_cast<unsigned int>(size);
+    header->d_argumentsSize = static_cast<unsigned int>(argumentsSize);
+    header->d_site_p        = &site;
+    header->d_category_p    = category;
+    header->d_timer         = bsls::TimeUtil::getTimer();
+
+    return entry + sizeof(DeferredLogger_EntryHeader);
+}
+
+inline
+void DeferredLogger_ThreadBuffer::release()
+{
+    d_isReleased.storeRelease(true);
+}
+
+// CONSUMER MANIPULATORS
+inline
+bsls::Types::Uint64 DeferredLogger_ThreadBuffer::acquireTail() const
+{
+    return d_tail.loadAcquire();
+}
+
+inline
+const DeferredLogger_EntryHeader *
+DeferredLogger_ThreadBuffer::entry(Uint64 *position) const
+{
+    Uint64                            offset = *position & d_mask;
+    const DeferredLogger_EntryHeader *header =
+             reinterpret_cast<const DeferredLogger_EntryHeader *>(d_data_p
+                                                                  + offset);
+    if (0 == header->d_size) {
+        *position += d_mask + 1 - offset;
+        header = reinterpret_cast<const DeferredLogger_EntryHeader *>(
+                                                                    d_data_p);
+    }
+    *position += header->d_size;
+    return header;
+}
+
+inline
+void DeferredLogger_ThreadBuffer::releaseTo(Uint64 position)
+{
+    d_head.storeRelease(position);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 DeferredLogger_ThreadBuffer::head() const
+{
+    return d_head.loadRelaxed();
+}
+
+inline
+bool DeferredLogger_ThreadBuffer::isReleased() const
+{
+    return d_isReleased.loadAcquire();
+}
+
+inline
+bsls::Types::Uint64 DeferredLogger_ThreadBuffer::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline
+bsls::Types::Uint64 DeferredLogger_ThreadBuffer::threadId() const
+{
+    return d_threadId;
+}
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+inline
+DeferredLogger::ThreadBuffer *DeferredLogger::threadBuffer()
+{
+    void *buffer = bslmt::ThreadUtil::getSpecific(d_key);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!buffer)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return createThreadBuffer();                                  // RETURN
+    }
+    return static_cast<ThreadBuffer *>(buffer);
+}
+
+// CLASS METHODS
+inline
+DeferredLogger *DeferredLogger::installed()
+{
+    return static_cast<DeferredLogger *>(
+                      bsls::AtomicOperations::getPtrAcquire(&s_installed));
+}
+
+#if BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+template <class... ARGS>
+inline
+void DeferredLogger::log(const DeferredLogSite&  site,
+                         const Category         *category,
+                         const char             *,
+                         const ARGS&...          args)
+{
+    const bsl::size_t size = DeferredLogCodec::encodedSize(args...);
+
+    DeferredLogger *logger = installed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(logger && category)) {
+        ThreadBuffer *buffer    = logger->threadBuffer();
+        char         *arguments = buffer->reserve(site, category, size);
+        if (arguments) {
+            DeferredLogCodec::encode(arguments, args...);
+            buffer->commit();
+        }
+        return;                                                       // RETURN
+    }
+
+    char              stackBuffer[k_STACK_BUFFER_SIZE];
+    bsl::vector<char> heapBuffer;
+    char             *arguments = stackBuffer;
+    if (size > sizeof stackBuffer) {
+        heapBuffer.resize(size);
+        arguments = heapBuffer.data();
+    }
+    DeferredLogCodec::encode(arguments, args...);
+    logNow(site, category, arguments, size);
+}
+#endif
+
+// ACCESSORS
+inline
+bsl::size_t DeferredLogger::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+bsls::Types::Uint64 DeferredLogger::numLogged() const
+{
+    return d_numLogged.loadAcquire();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DeferredLogger::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1384 @@
+// ball_deferredlogger.t.cpp                                          -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <ball_category.h>
+#include <ball_context.h>
+#include <ball_deferredlogfileutil.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdlf_bind.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides macros capturing the arguments of log
+// statements into per-thread buffers, and a mechanism formatting them on a
+// background thread.  We first test the component-private thread buffer,
+// including its wrap-around and its behavior when full, then the life cycle
+// of the logger, and finally the records it publishes (through an observer
+// registered with the logger manager) or writes to a binary log file (read
+// back with `ball::DeferredLogFileUtil`), from one and from several threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] DeferredLogger *installed();
+// [ 4] void log(const DeferredLogSite&, const Category *, ...);
+// [ 5] void log(const DeferredLogSite&, const Category *, ...);
+//
+// CREATORS
+// [ 3] DeferredLogger(bslma::Allocator *basicAllocator = 0);
+// [ 3] DeferredLogger(size_t bufferSize, bslma::Allocator *ba = 0);
+// [ 3] ~DeferredLogger();
+//
+// MANIPULATORS
+// [ 7] void closeBinaryFile();
+// [ 4] void flush();
+// [ 7] int openBinaryFile(const char *path);
+// [ 3] int start();
+// [ 3] void stop();
+//
+// ACCESSORS
+// [ 3] size_t bufferSize() const;
+// [ 7] bool isBinaryFileOpen() const;
+// [ 3] bool isStarted() const;
+// [ 6] Uint64 numDropped() const;
+// [ 4] Uint64 numLogged() const;
+// [ 3] bslma::Allocator *allocator() const;
+//
+// MACROS
+// [ 4] BALL_DEFERRED_LOGVA_{TRACE,DEBUG,INFO,WARN,ERROR,FATAL}
+// [ 4] BALL_DEFERRED_FMT_{TRACE,DEBUG,INFO,WARN,ERROR,FATAL}
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CLASS `DeferredLogger_ThreadBuffer`
+// [ 8] CONCURRENT LOGGING
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogger              Obj;
+typedef ball::DeferredLogger_ThreadBuffer ThreadBuffer;
+typedef ball::DeferredLogger_EntryHeader  EntryHeader;
+typedef ball::DeferredLogCodec            Codec;
+typedef bsls::Types::Uint64               Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// This class implements an observer that saves a copy of each published
+/// record, and that can be made to block in `publish` until released.
+class SavingObserver : public ball::Observer {
+
+    // DATA
+    mutable bslmt::Mutex       d_mutex;      // guards `d_records`
+    bsl::vector<ball::Record>  d_records;    // published records
+    bslmt::Latch              *d_latch_p;    // latch to wait for (held)
+
+  public:
+    // CREATORS
+
+    /// Create an observer that does not block.
+    SavingObserver()
+    : d_latch_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    /// Save a copy of the specified `record`, after waiting for the latch
+    /// set by `setLatch`, if any.
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        if (d_latch_p) {
+            d_latch_p->wait();
+        }
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.push_back(*record);
+    }
+
+    /// Make `publish` wait for the specified `latch`, or, if `latch` is 0,
+    /// not wait.
+    void setLatch(bslmt::Latch *latch)
+    {
+        d_latch_p = latch;
+    }
+
+    // ACCESSORS
+
+    /// Return the number of saved records.
+    bsl::size_t numRecords() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records.size();
+    }
+
+    /// Return a copy of the saved records.
+    bsl::vector<ball::Record> records() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records;
+    }
+};
+
+/// This class implements an observer that ignores the published records,
+/// and that can be made to block in `publish` until released.
+class NullObserver : public ball::Observer {
+
+    // DATA
+    bslmt::Latch *d_latch_p;  // latch to wait for (held)
+
+  public:
+    // CREATORS
+
+    /// Create an observer that does not block.
+    NullObserver()
+    : d_latch_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    /// Ignore the specified record, after waiting for the latch set by
+    /// `setLatch`, if any.
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        if (d_latch_p) {
+            d_latch_p->wait();
+        }
+    }
+
+    /// Make `publish` wait for the specified `latch`, or, if `latch` is 0,
+    /// not wait.
+    void setLatch(bslmt::Latch *latch)
+    {
+        d_latch_p = latch;
+    }
+};
+
+/// This class is a record visitor that saves a copy of each visited record.
+class RecordSaver {
+
+    // DATA
+    bsl::vector<ball::Record> *d_records_p;  // saved records (held)
+
+  public:
+    // CREATORS
+
+    /// Create a visitor saving records into the specified `records`.
+    explicit RecordSaver(bsl::vector<ball::Record> *records)
+    : d_records_p(records)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Save a copy of the specified `record`.
+    void operator()(const ball::Record& record) const
+    {
+        d_records_p->push_back(record);
+    }
+};
+
+/// Return the message of the specified `record`.
+bsl::string_view message(const ball::Record& record)
+{
+    return record.fixedFields().message();
+}
+
+/// Log, from the category "THREAD", the specified `numMessages` messages
+/// numbered from 0, each identifying the specified `threadIndex`.
+void logMessages(int threadIndex, int numMessages)
+{
+    BALL_LOG_SET_CATEGORY("THREAD");
+
+    for (int i = 0; i < numMessages; ++i) {
+        BALL_DEFERRED_FMT_INFO("{} {}", threadIndex, i);
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Deferring the Formatting of Log Messages
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a function on a latency-sensitive path logs the orders it
+// processes.  We use the deferred macros in place of `BALL_LOGVA_INFO` and
+// `BALL_FMT_INFO`:
+// ```
+void processOrder(int id, const bsl::string& symbol, double price)
+{
+    BALL_LOG_SET_CATEGORY("EXAMPLE.ORDERS");
+
+    BALL_DEFERRED_LOGVA_INFO("order %d: %s at %.2f", id, symbol, price);
+    BALL_DEFERRED_FMT_INFO("order {}: {} at {:.2f}", id, symbol, price);
+}
+// ```
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test", veryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+// Then, in `main`, after initializing the logger manager, we create a
+// deferred logger and start it, which installs it for the process:
+// ```
+    ball::DeferredLogger logger;
+
+    int rc = logger.start();
+    ASSERT(0 == rc);
+
+    processOrder(1, "IBM", 134.5);
+    processOrder(2, "MSFT", 411.25);
+// ```
+// Finally, we stop the logger, which formats and publishes any pending
+// messages before returning:
+// ```
+    logger.stop();
+    ASSERT(4 == logger.numLogged());
+    ASSERT(0 == logger.numDropped());
+// ```
+
+        const bsl::vector<ball::Record> records = observer->records();
+        ASSERT(4 == records.size());
+        if (4 == records.size()) {
+            ASSERT("order 1: IBM at 134.50"    == u::message(records[0]));
+            ASSERT("order 1: IBM at 134.50"    == u::message(records[1]));
+            ASSERT("order 2: MSFT at 411.25"   == u::message(records[2]));
+            ASSERT("order 2: MSFT at 411.25"   == u::message(records[3]));
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOGGING
+        //
+        // Concerns:
+        // 1. Messages logged concurrently by several threads are all
+        //    published, with the ID of their logging thread.
+        //
+        // 2. The messages of each thread are published in the order in which
+        //    they were logged.
+        //
+        // 3. The buffers of threads that have exited are freed.
+        //
+        // Plan:
+        // 1. Start a logger having buffers large enough for all messages, log
+        //    a sequence of numbered messages from each of several threads,
+        //    in two rounds, stop the logger, and verify the published
+        //    records.  (C-1..2)
+        //
+        // 2. Verify, using a test allocator, that the memory in use after the
+        //    second round is the same as after the first.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT LOGGING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOGGING" << endl
+                          << "==================" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+        const int k_NUM_THREADS  = 4;
+        const int k_NUM_MESSAGES = 1000;
+
+        Obj mX(1024 * 1024, &ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        // The threads of the second round reuse the memory of those of the
+        // first round.
+
+        bsls::Types::Int64 blocksInUse = 0;
+        for (int round = 0; round < 2; ++round) {
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == threads.addThread(bdlf::BindUtil::bind(
+                                                  &u::logMessages,
+                                                  round * k_NUM_THREADS + i,
+                                                  k_NUM_MESSAGES)));
+            }
+            threads.joinAll();
+
+            mX.flush();
+            mX.flush();  // frees the buffers released since the first flush
+
+            if (0 == round) {
+                blocksInUse = ta.numBlocksInUse();
+            }
+            else {
+                ASSERTV(blocksInUse, ta.numBlocksInUse(),
+                        blocksInUse == ta.numBlocksInUse());
+            }
+        }
+
+        mX.stop();
+
+        ASSERT(0                              == X.numDropped());
+        ASSERT(2 * k_NUM_THREADS * k_NUM_MESSAGES == X.numLogged());
+
+        const bsl::vector<ball::Record> records = observer->records();
+        ASSERT(2 * k_NUM_THREADS * k_NUM_MESSAGES == records.size());
+
+        bsl::vector<int>    next(2 * k_NUM_THREADS, 0);
+        bsl::vector<Uint64> threadIds(2 * k_NUM_THREADS, 0);
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            int                thread;
+            int                sequence;
+            const bsl::string  text(u::message(records[i]));
+            ASSERTV(text, 2 == sscanf(text.c_str(),
+                                      "%d %d",
+                                      &thread,
+                                      &sequence));
+            if (thread < 0 || 2 * k_NUM_THREADS <= thread) {
+                ASSERTV(thread, false);
+                continue;
+            }
+            ASSERTV(thread, sequence, next[thread], next[thread] == sequence);
+            next[thread] = sequence + 1;
+
+            const Uint64 threadId = records[i].fixedFields().threadID();
+            if (0 == threadIds[thread]) {
+                threadIds[thread] = threadId;
+            }
+            ASSERTV(thread, threadIds[thread] == threadId);
+            ASSERT(bslmt::ThreadUtil::selfIdAsUint64() != threadId);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BINARY LOG FILE
+        //
+        // Concerns:
+        // 1. `openBinaryFile` fails if the logger is started, if a file is
+        //    already open, or if the file cannot be created.
+        //
+        // 2. Messages processed while a binary file is open are written to
+        //    the file, and not published.
+        //
+        // 3. The file can be read by `ball::DeferredLogFileUtil`, giving
+        //    records having the fields of the logged messages, and a site or
+        //    category is defined only once per file.
+        //
+        // 4. `closeBinaryFile` closes the file, after which messages are
+        //    published again.
+        //
+        // Plan:
+        // 1. Open a file, log messages of two sites and two categories, stop
+        //    the logger, and read the file back.  Verify the error cases of
+        //    `openBinaryFile`.  (C-1..4)
+        //
+        // Testing:
+        //   int openBinaryFile(const char *path);
+        //   void closeBinaryFile();
+        //   bool isBinaryFileOpen() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BINARY LOG FILE" << endl
+                          << "===============" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+        bsl::string path;
+        {
+            bsl::ostringstream name;
+            name << "ball_deferredlogger.t."
+                 << bdls::ProcessUtil::getProcessId() << ".dlg";
+            path = name.str();
+        }
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(false == X.isBinaryFileOpen());
+        ASSERT(0     != mX.openBinaryFile("no/such/directory/file.dlg"));
+        ASSERT(false == X.isBinaryFileOpen());
+
+        ASSERT(0     == mX.start());
+        ASSERT(0     != mX.openBinaryFile(path.c_str()));
+        ASSERT(false == X.isBinaryFileOpen());
+        mX.stop();
+
+        ASSERT(0     == mX.openBinaryFile(path.c_str()));
+        ASSERT(true  == X.isBinaryFileOpen());
+        ASSERT(0     != mX.openBinaryFile(path.c_str()));
+
+        const bdlt::Datetime start = bdlt::CurrentTime::utc();
+        int                  line1, line2;
+
+        ASSERT(0 == mX.start());
+        {
+            BALL_LOG_SET_CATEGORY("FIRST");
+
+            for (int i = 0; i < 3; ++i) {
+                BALL_DEFERRED_LOGVA_WARN("a%d", i);  line1 = __LINE__;
+            }
+        }
+        {
+            BALL_LOG_SET_CATEGORY("SECOND");
+
+            BALL_DEFERRED_FMT_ERROR("b{}", "x");  line2 = __LINE__;
+        }
+        mX.stop();
+
+        ASSERT(4 == X.numLogged());
+        ASSERT(0 == observer->numRecords());
+
+        mX.closeBinaryFile();
+        ASSERT(false == X.isBinaryFileOpen());
+
+        bsl::vector<ball::Record> records;
+        {
+            bsl::ifstream input(path.c_str(), bsl::ios_base::binary);
+            ASSERT(input.is_open());
+            ASSERT(0 == ball::DeferredLogFileUtil::readRecords(
+                                                  input,
+                                                  u::RecordSaver(&records)));
+        }
+        ASSERT(4 == records.size());
+        if (4 == records.size()) {
+            const char *MESSAGES[]   = { "a0", "a1", "a2", "bx" };
+            const char *CATEGORIES[] = { "FIRST", "FIRST", "FIRST", "SECOND" };
+            const int   LINES[]      = { line1, line1, line1, line2 };
+            const int   SEVERITIES[] = { ball::Severity::e_WARN,
+                                         ball::Severity::e_WARN,
+                                         ball::Severity::e_WARN,
+                                         ball::Severity::e_ERROR };
+            for (int i = 0; i < 4; ++i) {
+                const ball::RecordAttributes& fields =
+                                                     records[i].fixedFields();
+                ASSERTV(i, MESSAGES[i] == u::message(records[i]));
+                ASSERTV(i, CATEGORIES[i] ==
+                                          bsl::string_view(fields.category()));
+                ASSERTV(i, LINES[i]      == fields.lineNumber());
+                ASSERTV(i, SEVERITIES[i] == fields.severity());
+                ASSERTV(i, bsl::string_view(__FILE__) ==
+                                          bsl::string_view(fields.fileName()));
+                ASSERTV(i, bdls::ProcessUtil::getProcessId() ==
+                                                         fields.processID());
+                ASSERTV(i, bslmt::ThreadUtil::selfIdAsUint64() ==
+                                                          fields.threadID());
+                ASSERTV(i, start <= fields.timestamp());
+                ASSERTV(i, fields.timestamp() <= bdlt::CurrentTime::utc());
+            }
+        }
+
+        // The definitions of the sites and categories were written once.
+
+        {
+            bsl::ifstream input(path.c_str(), bsl::ios_base::binary);
+            const bsl::string contents(
+                                  (bsl::istreambuf_iterator<char>(input)),
+                                  bsl::istreambuf_iterator<char>());
+            ASSERT(bsl::string::npos != contents.find("FIRST"));
+            ASSERT(contents.find("FIRST") == contents.rfind("FIRST"));
+            ASSERT(contents.find("a%d")   == contents.rfind("a%d"));
+        }
+
+        ASSERT(0 == mX.start());
+        {
+            BALL_LOG_SET_CATEGORY("THIRD");
+
+            BALL_DEFERRED_LOGVA_WARN("published");
+        }
+        mX.stop();
+        ASSERT(1 == observer->numRecords());
+
+        bdls::FilesystemUtil::remove(path);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DROPPED MESSAGES
+        //
+        // Concerns:
+        // 1. A message for which the buffer of the logging thread has no room
+        //    is dropped and counted, and does not affect the messages already
+        //    in the buffer.
+        //
+        // 2. Messages are captured again once the buffer has been drained.
+        //
+        // Plan:
+        // 1. Using an observer that blocks until released, so that the
+        //    background thread stops draining the buffers, log more messages
+        //    than the buffer can hold, then release the observer, and verify
+        //    the counts of logged and dropped messages, and the published
+        //    records.  (C-1..2)
+        //
+        // Testing:
+        //   Uint64 numDropped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DROPPED MESSAGES" << endl
+                          << "================" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+        BALL_LOG_SET_CATEGORY("DROP");
+
+        bslmt::Latch latch(1);
+        observer->setLatch(&latch);
+
+        Obj mX(Obj::k_MIN_BUFFER_SIZE, &ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        // The first message blocks the background thread in `publish`.
+
+        BALL_DEFERRED_LOGVA_INFO("first");
+        bslmt::ThreadUtil::microSleep(50 * 1000);
+
+        const int k_NUM_MESSAGES = 200;
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            BALL_DEFERRED_LOGVA_INFO("message %d", i);
+        }
+
+        const Uint64 numDropped = X.numDropped();
+        ASSERTV(numDropped, 0 < numDropped);
+
+        latch.arrive();
+        mX.flush();
+
+        BALL_DEFERRED_LOGVA_INFO("last");
+        mX.stop();
+        observer->setLatch(0);
+
+        ASSERTV(numDropped, X.numDropped(), numDropped == X.numDropped());
+        ASSERTV(X.numLogged(),
+                k_NUM_MESSAGES + 2 == X.numLogged() + X.numDropped());
+        ASSERT(X.numLogged() == observer->numRecords());
+
+        const bsl::vector<ball::Record> records = observer->records();
+        ASSERT(!records.empty());
+        if (!records.empty()) {
+            ASSERT("first" == u::message(records.front()));
+            ASSERT("last"  == u::message(records.back()));
+        }
+
+        // The messages that were not dropped are consecutive.
+
+        int previous = -1;
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            int sequence;
+            if (1 == sscanf(bsl::string(u::message(records[i])).c_str(),
+                            "message %d",
+                            &sequence)) {
+                ASSERTV(previous, sequence, previous + 1 == sequence);
+                previous = sequence;
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOGGING WITHOUT AN INSTALLED LOGGER
+        //
+        // Concerns:
+        // 1. If no deferred logger is installed, the deferred macros log
+        //    their message immediately, through the logger manager.
+        //
+        // 2. If the logger manager is not initialized, the deferred macros
+        //    log their message immediately, even if a deferred logger is
+        //    installed.
+        //
+        // 3. Arguments of any supported type, and any size, are formatted.
+        //
+        // Plan:
+        // 1. Log messages without a started logger, and verify that they are
+        //    published before the log statements complete.  (C-1, 3)
+        //
+        // 2. Start a logger while the logger manager is not initialized, log
+        //    a message, and verify that no message was processed by the
+        //    logger.  (C-2)
+        //
+        // Testing:
+        //   void log(const DeferredLogSite&, const Category *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOGGING WITHOUT AN INSTALLED LOGGER" << endl
+                          << "===================================" << endl;
+
+        ASSERT(0 == Obj::installed());
+
+        {
+            ball::LoggerManagerConfiguration configuration;
+            configuration.setDefaultThresholdLevelsIfValid(
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_TRACE,
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_OFF);
+            ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+            bsl::shared_ptr<u::SavingObserver> observer(
+                                                      new u::SavingObserver());
+            ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+            BALL_LOG_SET_CATEGORY("IMMEDIATE");
+
+            const bsl::string longString(2000, 'x');
+
+            BALL_DEFERRED_LOGVA_TRACE("%s|%c|%u|%p",
+                                      "s",
+                                      'c',
+                                      7u,
+                                      static_cast<const void *>(0));
+            ASSERT(1 == observer->numRecords());
+
+            BALL_DEFERRED_FMT_DEBUG("{}|{}|{:.1f}|{}",
+                                    true,
+                                    -3LL,
+                                    2.25f,
+                                    bsl::string_view("view"));
+            ASSERT(2 == observer->numRecords());
+
+            BALL_DEFERRED_FMT_INFO("{}", longString);
+            ASSERT(3 == observer->numRecords());
+
+            const bsl::vector<ball::Record> records = observer->records();
+            ASSERT(3 == records.size());
+            if (3 == records.size()) {
+                ASSERTV(u::message(records[0]),
+                        "s|c|7|(nil)" == u::message(records[0])
+                     || "s|c|7|0"     == u::message(records[0])
+                     || "s|c|7|0x0"   == u::message(records[0]));
+                ASSERTV(u::message(records[1]),
+                        "true|-3|2.2|view" == u::message(records[1])
+                     || "true|-3|2.3|view" == u::message(records[1]));
+                ASSERT(longString == u::message(records[2]));
+                ASSERT(ball::Severity::e_TRACE ==
+                                          records[0].fixedFields().severity());
+                ASSERT(ball::Severity::e_DEBUG ==
+                                          records[1].fixedFields().severity());
+            }
+        }
+
+        if (verbose) cout << "\tWithout a logger manager." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            BALL_LOG_SET_CATEGORY("NO MANAGER");
+
+            BALL_DEFERRED_LOGVA_TRACE("not %s", "captured");
+
+            mX.stop();
+            ASSERT(0 == X.numLogged());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PUBLISHING DEFERRED MESSAGES
+        //
+        // Concerns:
+        // 1. Each deferred macro, of both styles, captures a message that is
+        //    published by the background thread with the severity, file
+        //    name, line number, and category of the log statement, and with
+        //    the thread ID and timestamp of its execution.
+        //
+        // 2. A message whose severity is below the threshold levels of its
+        //    category is not captured.
+        //
+        // 3. `flush` returns after the messages logged before the call have
+        //    been published.
+        //
+        // 4. A message whose format does not match its arguments is published
+        //    with a description of the error.
+        //
+        // Plan:
+        // 1. Log a message with each macro, flush, and verify the published
+        //    records.  (C-1, 3)
+        //
+        // 2. Set the threshold to `e_WARN`, log a message at `e_INFO`, and
+        //    verify that it is not published.  (C-2)
+        //
+        // 3. Log messages with missing arguments.  (C-4)
+        //
+        // Testing:
+        //   void log(const DeferredLogSite&, const Category *, ...);
+        //   void flush();
+        //   Uint64 numLogged() const;
+        //   BALL_DEFERRED_LOGVA_{TRACE,DEBUG,INFO,WARN,ERROR,FATAL}
+        //   BALL_DEFERRED_FMT_{TRACE,DEBUG,INFO,WARN,ERROR,FATAL}
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUBLISHING DEFERRED MESSAGES" << endl
+                          << "============================" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_TRACE,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        BALL_LOG_SET_CATEGORY("DEFERRED");
+
+        const bdlt::Datetime start = bdlt::CurrentTime::utc();
+        const int            LINE  = __LINE__ + 1;
+        BALL_DEFERRED_LOGVA_TRACE("va %d", 1);
+        BALL_DEFERRED_LOGVA_DEBUG("va %d", 2);
+        BALL_DEFERRED_LOGVA_INFO("va %d", 3);
+        BALL_DEFERRED_LOGVA_WARN("va %d", 4);
+        BALL_DEFERRED_LOGVA_ERROR("va %d", 5);
+        BALL_DEFERRED_LOGVA_FATAL("va %d", 6);
+        BALL_DEFERRED_FMT_TRACE("fmt {}", 1);
+        BALL_DEFERRED_FMT_DEBUG("fmt {}", 2);
+        BALL_DEFERRED_FMT_INFO("fmt {}", 3);
+        BALL_DEFERRED_FMT_WARN("fmt {}", 4);
+        BALL_DEFERRED_FMT_ERROR("fmt {}", 5);
+        BALL_DEFERRED_FMT_FATAL("fmt {}", 6);
+
+        mX.flush();
+        const bdlt::Datetime end = bdlt::CurrentTime::utc();
+
+        ASSERTV(X.numLogged(), 12 == X.numLogged());
+
+        bsl::vector<ball::Record> records = observer->records();
+        ASSERT(12 == records.size());
+
+        const int SEVERITIES[] = { ball::Severity::e_TRACE,
+                                   ball::Severity::e_DEBUG,
+                                   ball::Severity::e_INFO,
+                                   ball::Severity::e_WARN,
+                                   ball::Severity::e_ERROR,
+                                   ball::Severity::e_FATAL };
+
+        for (bsl::size_t i = 0; i < records.size() && i < 12; ++i) {
+            const ball::RecordAttributes& fields = records[i].fixedFields();
+
+            bsl::ostringstream expected;
+            expected << (i < 6 ? "va " : "fmt ") << i % 6 + 1;
+
+            ASSERTV(i, expected.str() == u::message(records[i]));
+            ASSERTV(i, SEVERITIES[i % 6] == fields.severity());
+            ASSERTV(i, LINE + static_cast<int>(i) == fields.lineNumber());
+            ASSERTV(i, bsl::string_view(__FILE__) ==
+                                          bsl::string_view(fields.fileName()));
+            ASSERTV(i, "DEFERRED" == bsl::string_view(fields.category()));
+            ASSERTV(i, bslmt::ThreadUtil::selfIdAsUint64() ==
+                                                           fields.threadID());
+            ASSERTV(i, start <= fields.timestamp());
+            ASSERTV(i, fields.timestamp() <= end);
+            if (0 < i) {
+                ASSERTV(i, records[i - 1].fixedFields().timestamp() <=
+                                                          fields.timestamp());
+            }
+        }
+
+        if (verbose) cout << "\tMessages below the threshold." << endl;
+
+        ASSERT(0 != ball::LoggerManager::singleton().setCategory(
+                                                     "DEFERRED",
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_WARN,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+
+        BALL_DEFERRED_LOGVA_INFO("not logged");
+        BALL_DEFERRED_FMT_INFO("not logged");
+        BALL_DEFERRED_FMT_WARN("logged");
+
+        mX.flush();
+        ASSERTV(X.numLogged(), 13 == X.numLogged());
+        records = observer->records();
+        ASSERT(13 == records.size());
+        if (13 == records.size()) {
+            ASSERT("logged" == u::message(records.back()));
+        }
+
+        if (verbose) cout << "\tMismatched arguments." << endl;
+
+        BALL_DEFERRED_LOGVA_WARN("%d and %d", 1);
+        BALL_DEFERRED_FMT_WARN("{} and {}", 1);
+
+        mX.flush();
+        records = observer->records();
+        ASSERT(15 == records.size());
+        if (15 == records.size()) {
+            ASSERTV(u::message(records[13]),
+                    "1 and <missing argument>" == u::message(records[13]));
+            ASSERTV(u::message(records[14]),
+                    0 == u::message(records[14]).find("{} and {} <"));
+        }
+
+        mX.stop();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LIFE CYCLE
+        //
+        // Concerns:
+        // 1. The buffer size is the default, or the specified size rounded
+        //    up to a power of two no less than `k_MIN_BUFFER_SIZE`.
+        //
+        // 2. `start` installs the logger, and fails if the logger is started
+        //    or if another logger is installed.
+        //
+        // 3. `stop` uninstalls the logger, has no effect if the logger is not
+        //    started, and the logger can be restarted.
+        //
+        // 4. The destructor stops the logger, and all memory is supplied by
+        //    the specified allocator.
+        //
+        // Plan:
+        // 1. Create loggers with various buffer sizes, and start and stop
+        //    them in various orders, checking the accessors.  (C-1..4)
+        //
+        // Testing:
+        //   DeferredLogger(bslma::Allocator *basicAllocator = 0);
+        //   DeferredLogger(size_t bufferSize, bslma::Allocator *ba = 0);
+        //   ~DeferredLogger();
+        //   int start();
+        //   void stop();
+        //   DeferredLogger *installed();
+        //   size_t bufferSize() const;
+        //   bool isStarted() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LIFE CYCLE" << endl
+                          << "==========" << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_size;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            { L_,       0,     Obj::k_MIN_BUFFER_SIZE },
+            { L_,       1,     Obj::k_MIN_BUFFER_SIZE },
+            { L_,    1024,     1024                   },
+            { L_,    1025,     2048                   },
+            { L_,    4000,     4096                   },
+            { L_,   65536,    65536                   },
+            { L_, 1000000,  1048576                   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t SIZE     = DATA[ti].d_size;
+            const bsl::size_t EXPECTED = DATA[ti].d_expected;
+
+            const Obj X(SIZE, &ta);
+            ASSERTV(LINE, EXPECTED == X.bufferSize());
+            ASSERTV(LINE, &ta      == X.allocator());
+        }
+
+        {
+            const Obj X;
+            ASSERT(Obj::k_DEFAULT_BUFFER_SIZE == X.bufferSize());
+            ASSERT(bslma::Default::defaultAllocator() == X.allocator());
+        }
+
+        ASSERT(0 == Obj::installed());
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(false == X.isStarted());
+            mX.stop();
+            ASSERT(false == X.isStarted());
+
+            ASSERT(0     == mX.start());
+            ASSERT(true  == X.isStarted());
+            ASSERT(&mX   == Obj::installed());
+            ASSERT(0     != mX.start());
+
+            ASSERT(0     != mY.start());
+            ASSERT(false == Y.isStarted());
+            ASSERT(&mX   == Obj::installed());
+
+            mX.stop();
+            ASSERT(false == X.isStarted());
+            ASSERT(0     == Obj::installed());
+
+            ASSERT(0     == mY.start());
+            ASSERT(&mY   == Obj::installed());
+            mY.stop();
+
+            ASSERT(0     == mX.start());
+            ASSERT(&mX   == Obj::installed());
+            ASSERT(0     == X.numLogged());
+            ASSERT(0     == X.numDropped());
+        }
+        ASSERT(0 == Obj::installed());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS `DeferredLogger_ThreadBuffer`
+        //
+        // Concerns:
+        // 1. An entry committed by the producer is read by the consumer with
+        //    the reserved header fields and the written arguments.
+        //
+        // 2. An entry is not visible to the consumer until committed.
+        //
+        // 3. Entries that do not fit before the end of the ring are written
+        //    at its beginning, after an end-of-buffer marker that the
+        //    consumer skips.
+        //
+        // 4. `reserve` returns 0, and counts a dropped entry, if the ring has
+        //    no room for the entry, and room is recovered by `releaseTo`.
+        //
+        // Plan:
+        // 1. Using a 256-byte buffer, reserve and commit entries of various
+        //    sizes, and consume them, many times around the ring, checking
+        //    the entries read and the drop count.  (C-1..4)
+        //
+        // Testing:
+        //   CLASS `DeferredLogger_ThreadBuffer`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS `DeferredLogger_ThreadBuffer`" << endl
+                          << "===================================" << endl;
+
+        static const ball::DeferredLogSite SITE = {
+            "format", "file", 1, ball::Severity::e_INFO, Codec::e_PRINTF
+        };
+        ball::Category *const CATEGORY =
+                                    reinterpret_cast<ball::Category *>(0x100);
+
+        {
+            ThreadBuffer mX(256, 42, &ta);  const ThreadBuffer& X = mX;
+
+            ASSERT(42    == X.threadId());
+            ASSERT(0     == X.head());
+            ASSERT(0     == mX.acquireTail());
+            ASSERT(false == X.isReleased());
+            ASSERT(0     == X.numDropped());
+
+            Uint64 expectedDropped = 0;
+            for (int i = 0; i < 200; ++i) {
+                const bsl::size_t SIZE = (i * 7) % 60;
+
+                char *arguments = mX.reserve(SITE, CATEGORY, SIZE);
+                ASSERTV(i, arguments);
+                if (!arguments) {
+                    continue;
+                }
+                for (bsl::size_t j = 0; j < SIZE; ++j) {
+                    arguments[j] = static_cast<char>(i + j);
+                }
+                ASSERTV(i, X.head() == mX.acquireTail());
+                mX.commit();
+
+                Uint64 position = X.head();
+                ASSERTV(i, position != mX.acquireTail());
+
+                const EntryHeader *header = mX.entry(&position);
+                ASSERTV(i, position == mX.acquireTail());
+                ASSERTV(i, SIZE     == header->d_argumentsSize);
+                ASSERTV(i, &SITE    == header->d_site_p);
+                ASSERTV(i, CATEGORY == header->d_category_p);
+                ASSERTV(i, 0 == header->d_size % 8);
+
+                const char *read = reinterpret_cast<const char *>(header + 1);
+                for (bsl::size_t j = 0; j < SIZE; ++j) {
+                    ASSERTV(i, j, static_cast<char>(i + j) == read[j]);
+                }
+                mX.releaseTo(position);
+
+                // Fill the ring until an entry is dropped.
+
+                if (0 == i % 50) {
+                    int numReserved = 0;
+                    while (mX.reserve(SITE, CATEGORY, 20)) {
+                        mX.commit();
+                        ++numReserved;
+                    }
+                    ++expectedDropped;
+                    ASSERTV(i, numReserved, 0 < numReserved);
+                    ASSERTV(i, expectedDropped == X.numDropped());
+
+                    position = X.head();
+                    const Uint64 tail = mX.acquireTail();
+                    int          numRead = 0;
+                    while (position != tail) {
+                        header = mX.entry(&position);
+                        ASSERTV(i, 20 == header->d_argumentsSize);
+                        ++numRead;
+                    }
+                    ASSERTV(i, numReserved == numRead);
+                    mX.releaseTo(position);
+                }
+            }
+            ASSERT(expectedDropped == X.numDropped());
+            ASSERT(0 == mX.reserve(SITE, CATEGORY, 256));
+            ASSERT(expectedDropped + 1 == X.numDropped());
+
+            mX.release();
+            ASSERT(true == X.isReleased());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Start a logger, log a message, stop the logger, and verify that
+        //    the message was published.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::SavingObserver> observer(new u::SavingObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "saving"));
+
+        Obj mX(&ta);
+        ASSERT(0 == mX.start());
+        {
+            BALL_LOG_SET_CATEGORY("BREATHING");
+
+            BALL_DEFERRED_LOGVA_INFO("hello %s %d", "world", 42);
+        }
+        mX.stop();
+
+        ASSERT(1 == mX.numLogged());
+        ASSERT(1 == observer->numRecords());
+        if (1 == observer->numRecords()) {
+            ASSERT("hello world 42" == u::message(observer->records()[0]));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. The cost of a deferred log statement on the logging thread is
+        //    small compared to that of the equivalent immediate statement.
+        //
+        // Plan:
+        // 1. With an observer discarding the records, time a number of
+        //    `BALL_DEFERRED_LOGVA_INFO` and `BALL_DEFERRED_FMT_INFO`
+        //    statements (with a buffer large enough to hold all messages) and
+        //    of the equivalent `BALL_LOGVA_INFO` statements, and report the
+        //    average cost of each.  Optionally specify the number of
+        //    statements as the second argument.  To measure only the cost
+        //    incurred by the logging thread (even on a single CPU), block the
+        //    background thread in the observer while timing the deferred
+        //    statements.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int k_NUM_STATEMENTS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+        ball::LoggerManagerScopedGuard managerGuard(configuration);
+
+        bsl::shared_ptr<u::NullObserver> observer(new u::NullObserver());
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  observer,
+                                                                  "null"));
+
+        BALL_LOG_SET_CATEGORY("PERFORMANCE");
+
+        const double k_PRICE = 134.5;
+        const char   k_SIDE  = 'B';
+
+        bsls::Stopwatch timer;
+        {
+            Obj mX(128 * 1024 * 1024);
+
+            for (int style = 0; style < 2; ++style) {
+                bslmt::Latch latch(1);
+                observer->setLatch(&latch);
+
+                ASSERT(0 == mX.start());
+
+                BALL_DEFERRED_LOGVA_INFO("blocking the background thread");
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+
+                timer.reset();
+                timer.start();
+                if (0 == style) {
+                    for (int i = 0; i < k_NUM_STATEMENTS; ++i) {
+                        BALL_DEFERRED_LOGVA_INFO("order %d: %c at %f",
+                                                 i,
+                                                 k_SIDE,
+                                                 k_PRICE);
+                    }
+                }
+                else {
+                    for (int i = 0; i < k_NUM_STATEMENTS; ++i) {
+                        BALL_DEFERRED_FMT_INFO("order {}: {} at {}",
+                                               i,
+                                               k_SIDE,
+                                               k_PRICE);
+                    }
+                }
+                timer.stop();
+
+                latch.arrive();
+                mX.stop();
+                observer->setLatch(0);
+
+                cout << (0 == style ? "BALL_DEFERRED_LOGVA_INFO: "
+                                    : "BALL_DEFERRED_FMT_INFO:   ")
+                     << timer.accumulatedWallTime() * 1e9 / k_NUM_STATEMENTS
+                     << " ns/statement (" << mX.numDropped() << " dropped)"
+                     << endl;
+            }
+        }
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < k_NUM_STATEMENTS; ++i) {
+            BALL_LOGVA_INFO("order %d: %c at %f", i, k_SIDE, k_PRICE);
+        }
+        timer.stop();
+
+        cout << "BALL_LOGVA_INFO:          "
+             << timer.accumulatedWallTime() * 1e9 / k_NUM_STATEMENTS
+             << " ns/statement" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -21,12 +21,16 @@ BSLS_IDENT("$Id: $")
 //              ( ball::FileObserver )
 //               `------------------'
 //                        |              ctor
+//                        |              disableCompression
 //                        |              disableFileLogging
+//                        |              disableGroupCommit
 //                        |              disableTimeIntervalRotation
 //                        |              disableSizeRotation
 //                        |              disableStdoutLoggingPrefix
 //                        |              disablePublishInLocalTime
+//                        |              enableCompression
 //                        |              enableFileLogging
+//                        |              enableGroupCommit
 //                        |              enableStdoutLoggingPrefix
 //                        |              enablePublishInLocalTime
 //                        |              forceRotation
@@ -37,7 +41,9 @@ BSLS_IDENT("$Id: $")
 //                        |              setLogFormat
 //                        |              suppressUniqueFileNameOnRotation
 //                        |              getLogFormat
+//                        |              isCompressionEnabled
 //                        |              isFileLoggingEnabled
+//                        |              isGroupCommitEnabled
 //                        |              isStdoutLoggingPrefixEnabled
 //                        |              isPublishInLocalTimeEnabled
 //                        |              isSuppressUniqueFileNameOnRotation
@@ -114,6 +120,14 @@ BSLS_IDENT("$Id: $")
 // |             | rotationLifetime                   |
 // |             | isSuppressUniqueFileNameOnRotation |
 // +-------------+------------------------------------+
+// | Group       | enableGroupCommit                  |
+// | Commit      | disableGroupCommit                 |
+// |             | isGroupCommitEnabled               |
+// +-------------+------------------------------------+
+// | Log File    | enableCompression                  |
+// | Compression | disableCompression                 |
+// |             | isCompressionEnabled               |
+// +-------------+------------------------------------+
 // ```
 // In general, a `ball::FileObserver` object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -318,6 +332,17 @@ BSLS_IDENT("$Id: $")
 // the period is one day), then a unique name on each rotation is produced with
 // the (local) time at which file rotation occurred embedded in the filename.
 //
+///Log File Compression and Group Commit
+///-------------------------------------
+// A file observer may be configured, by calling `enableGroupCommit`, to write
+// records to its log file in groups rather than one at a time, and, by calling
+// `enableCompression`, to compress the log files that it subsequently opens.
+// These features are provided by the underlying `ball::FileObserver2` (see
+// {`ball_fileobserver2`|Group Commit} and {`ball_fileobserver2`|Log File
+// Compression}), and do not affect logging to `stdout`.  Compression should
+// be combined with group commit, so that groups of records, rather than
+// single records, are compressed.
+//
 ///Thread Safety
 ///-------------
 // All methods of `ball::FileObserver` are thread-safe, and can be called
@@ -430,6 +455,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -556,12 +582,25 @@ class FileObserver : public Observer {
 
     // MANIPULATORS
 
+    /// Disable compression of the log files subsequently opened by this
+    /// file observer.  Note that the current log file, if any, remains
+    /// compressed until it is closed or rotated.  See {Log File Compression
+    /// and Group Commit}.
+    void disableCompression();
+
     /// Disable file logging for this file observer.  This method has no
     /// effect if file logging is not enabled.  Note that records
     /// subsequently received through the `publish` method of this file
     /// observer may still be logged to `stdout` after calling this method.
     void disableFileLogging();
 
+    /// Disable group commit for this file observer, first writing any pending
+    /// records to the log file.  This method has no effect if group commit
+    /// is not enabled.  The behavior is undefined if this method is called
+    /// concurrently with `enableGroupCommit`.  See {Log File Compression
+    /// and Group Commit}.
+    void disableGroupCommit();
+
     /// Disable log file rotation based on a periodic time interval for this
     /// file observer.  This method has no effect if
     /// rotation-on-time-interval is not enabled.
@@ -602,6 +641,13 @@ class FileObserver : public Observer {
     /// Filename Patterns}).
     void disablePublishInLocalTime();
 
+    /// Enable compression of the log files subsequently opened by this
+    /// file observer, i.e., the log file opened by the next successful call
+    /// to `enableFileLogging` or by the next rotation.  Note that the
+    /// current log file, if any, remains uncompressed until it is closed or
+    /// rotated.  See {Log File Compression and Group Commit}.
+    void enableCompression();
+
     /// Enable logging of all records published to this file observer to a
     /// file whose name is derived from the specified `logFilenamePattern`.
     /// Return 0 on success, a positive value if file logging is already
@@ -643,6 +689,22 @@ class FileObserver : public Observer {
     int enableFileLogging(const char *logFilenamePattern,
                           bool        appendTimestampFlag);
 
+    /// Enable group commit for this file observer: records are formatted
+    /// into memory and written to the log file in groups, once the pending
+    /// records amount to the specified `maxPendingBytes`, or once the
+    /// oldest of them has been pending for the specified `maxLatency` if
+    /// `maxLatency` is not 0.  Optionally specify a `syncInterval`
+    /// indicating the number of group writes after which the log file data
+    /// is flushed to the storage device (never, if 0 or not specified).
+    /// Return 0 on success, a positive value if group commit is already
+    /// enabled (with no effect), and a negative value otherwise.  The
+    /// behavior is undefined unless `0 < maxPendingBytes`,
+    /// `bsls::TimeInterval() <= maxLatency`, and `0 <= syncInterval`.  See
+    /// {Log File Compression and Group Commit}.
+    int enableGroupCommit(int                       maxPendingBytes,
+                          const bsls::TimeInterval& maxLatency,
+                          int                       syncInterval = 0);
+
     /// Enable this file observer to use the long output format when logging
     /// to `stdout`.  Henceforth, this file observer will use the output
     /// format for `stdout` logging that was set by the most recent call to
@@ -777,6 +839,10 @@ class FileObserver : public Observer {
     void getLogFormat(const char **logFileFormat,
                       const char **stdoutFormat) const;
 
+    /// Return `true` if compression is enabled for the log files
+    /// subsequently opened by this file observer, and `false` otherwise.
+    bool isCompressionEnabled() const;
+
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the optionally specified `result` with the
     /// name of the current log file if file logging is enabled, and leave
@@ -787,6 +853,10 @@ class FileObserver : public Observer {
     bool isFileLoggingEnabled(bsl::string *result) const;
     bool isFileLoggingEnabled(std::string *result) const;
 
+    /// Return `true` if group commit is enabled for this file observer,
+    /// and `false` otherwise.
+    bool isGroupCommitEnabled() const;
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the specified `result` with the name of the
@@ -856,12 +926,24 @@ class FileObserver : public Observer {
                           // ------------------
 
 // MANIPULATORS
+inline
+void FileObserver::disableCompression()
+{
+    d_fileObserver2.disableCompression();
+}
+
 inline
 void FileObserver::disableFileLogging()
 {
     d_fileObserver2.disableFileLogging();
 }
 
+inline
+void FileObserver::disableGroupCommit()
+{
+    d_fileObserver2.disableGroupCommit();
+}
+
 inline
 void FileObserver::disableLifetimeRotation()
 {
@@ -880,6 +962,12 @@ void FileObserver::disableTimeIntervalRotation()
     d_fileObserver2.disableTimeIntervalRotation();
 }
 
+inline
+void FileObserver::enableCompression()
+{
+    d_fileObserver2.enableCompression();
+}
+
 inline
 int FileObserver::enableFileLogging(const char *logFilenamePattern)
 {
@@ -894,6 +982,16 @@ int FileObserver::enableFileLogging(const char *logFilenamePattern,
                                              appendTimestampFlag);
 }
 
+inline
+int FileObserver::enableGroupCommit(int                       maxPendingBytes,
+                                    const bsls::TimeInterval& maxLatency,
+                                    int                       syncInterval)
+{
+    return d_fileObserver2.enableGroupCommit(maxPendingBytes,
+                                             maxLatency,
+                                             syncInterval);
+}
+
 inline
 void FileObserver::forceRotation()
 {
@@ -952,6 +1050,12 @@ void FileObserver::suppressUniqueFileNameOnRotation(bool suppress)
 }
 
 // ACCESSORS
+inline
+bool FileObserver::isCompressionEnabled() const
+{
+    return d_fileObserver2.isCompressionEnabled();
+}
+
 inline
 bool FileObserver::isFileLoggingEnabled() const
 {
@@ -978,6 +1082,12 @@ bool FileObserver::isFileLoggingEnabled(std::pmr::string *result) const
 }
 #endif  //BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+inline
+bool FileObserver::isGroupCommitEnabled() const
+{
+    return d_fileObserver2.isGroupCommitEnabled();
+}
+
 inline
 bool FileObserver::isSuppressUniqueFileNameOnRotation() const
 {
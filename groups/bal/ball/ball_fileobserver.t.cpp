@@ -4,10 +4,14 @@
 #include <ball_context.h>
 #include <ball_log.h>
 #include <ball_loggermanager.h>
+#include <ball_logfilecompressionutil.h>
 #include <ball_loggermanagerconfiguration.h>
+#include <ball_record.h>
 #include <ball_recordattributes.h>
 #include <ball_severity.h>
 #include <ball_streamobserver.h>
+#include <ball_transmission.h>
+#include <ball_userfields.h>
 
 #include <bdlb_tokenizer.h>
 
@@ -48,6 +52,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
+#include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
@@ -100,15 +105,19 @@ using bsl::flush;
 // [ 6] FileObserver(Allocator *);
 //
 // MANIPULATORS
+// [ 7] void disableCompression();
 // [ 1] void disableFileLogging();
+// [ 7] void disableGroupCommit();
 // [ 2] void disableLifetimeRotation();
 // [  ] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 1] void disableStdoutLoggingPrefix();
 // [  ] void disableTimeIntervalRotation();
 // [ 1] void disableUserFieldsLogging();
+// [ 7] void enableCompression();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
+// [ 7] int  enableGroupCommit(int, const TimeInterval&, int);
 // [  ] void enablePublishInLocalTime();
 // [ 1] void enableStdoutLoggingPrefix();
 // [ 1] void enableUserFieldsLogging();
@@ -125,8 +134,10 @@ using bsl::flush;
 //
 // ACCESSORS
 // [ 1] void getLogFormat(const char**, const char**) const;
+// [ 7] bool isCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(string& logFilename) const;
+// [ 7] bool isGroupCommitEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [  ] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
@@ -139,7 +150,7 @@ using bsl::flush;
 // [ 6] CONCERN: `FileObserver` can be created using `allocate_shared`.
 // [ 5] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [ 4] CONCERN: ROTATION CALLBACK INVOCATION
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // Note assert and debug macros all output to cerr instead of cout, unlike
 // most other test drivers.  This is necessary because test case 1 plays
@@ -606,6 +617,31 @@ void getDatetimeField(bsl::string        *result,
     *result = s.substr(0, s.find_first_of(' '));
 }
 
+/// Return the contents of the file with the specified `fileName`.
+bsl::string readFile(const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    bsl::ostringstream content;
+    content << fs.rdbuf();
+    return content.str();
+}
+
+/// Load, into the specified `text`, the text decompressed from the
+/// compressed log file with the specified `fileName`, and return the status
+/// returned by `ball::LogFileCompressionUtil::decompress`.
+int decompressFile(bsl::string *text, const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    bsl::ostringstream output;
+    const int rc = ball::LogFileCompressionUtil::decompress(output, fs);
+    *text = output.str();
+    return rc;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -634,7 +670,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -746,6 +782,137 @@ int main(int argc, char *argv[])
         observer->disableSizeRotation();
 // ```
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING COMPRESSION AND GROUP COMMIT
+        //
+        // Concerns:
+        // 1. The compression and group commit methods forward to the
+        //    underlying file observer.
+        //
+        // 2. Records published with compression and group commit enabled are
+        //    written to a compressed log file that decompresses to the text
+        //    written in the default mode.
+        //
+        // 3. Disabling group commit writes the pending records.
+        //
+        // 4. No memory is leaked.
+        //
+        // Plan:
+        // 1. Enable and disable compression and group commit, and verify the
+        //    values of the accessors.  (C-1)
+        //
+        // 2. Publish the same records to an observer with compression and
+        //    group commit enabled, and to an observer in the default mode.
+        //    Verify that nothing is written to the compressed log file until
+        //    group commit is disabled, then compare the decompressed and
+        //    uncompressed log files.  (C-1..3)
+        //
+        // 3. Use a test allocator for the observers, and verify that no
+        //    memory is outstanding at the end of each scope.  (C-4)
+        //
+        // Testing:
+        //   void disableCompression();
+        //   void disableGroupCommit();
+        //   void enableCompression();
+        //   int enableGroupCommit(int, const TimeInterval&, int);
+        //   bool isCompressionEnabled() const;
+        //   bool isGroupCommitEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING COMPRESSION AND GROUP COMMIT"
+                             "\n====================================" << endl;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        const bsl::string        dirName(tempDirGuard.getTempDirName());
+
+        const bsls::TimeInterval k_NO_LATENCY;
+
+        if (verbose) cout << "\tTesting the accessors." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isCompressionEnabled());
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            mX.enableCompression();
+            ASSERT(true  == X.isCompressionEnabled());
+
+            ASSERT(0     == mX.enableGroupCommit(1024, k_NO_LATENCY));
+            ASSERT(true  == X.isGroupCommitEnabled());
+            ASSERT(0     <  mX.enableGroupCommit(1024, k_NO_LATENCY));
+
+            mX.disableGroupCommit();
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            mX.disableCompression();
+            ASSERT(false == X.isCompressionEnabled());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tComparing with the default mode." << endl;
+        {
+            bsl::string compressedName(dirName);
+            bsl::string defaultName(dirName);
+            bdls::PathUtil::appendRaw(&compressedName, "compressed.lz");
+            bdls::PathUtil::appendRaw(&defaultName,    "default");
+
+            Obj mX(ball::Severity::e_OFF, &ta);
+            Obj mY(ball::Severity::e_OFF, &ta);
+
+            mX.enableCompression();
+
+            ASSERT(0 == mX.enableFileLogging(compressedName.c_str()));
+            ASSERT(0 == mY.enableFileLogging(defaultName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(1024 * 1024, k_NO_LATENCY));
+
+            const bdlt::Datetime timestamp = bdlt::CurrentTime::utc();
+            ball::Context        context(ball::Transmission::e_PASSTHROUGH,
+                                         0,
+                                         1);
+
+            const int k_NUM_RECORDS = 500;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                bsl::ostringstream message;
+                message << "order " << i * 7919 % 10007
+                        << " routed to venue " << i % 5;
+
+                ball::RecordAttributes attr(timestamp,
+                                            1,
+                                            2,
+                                            "FILENAME",
+                                            i,
+                                            "CATEGORY",
+                                            32,
+                                            message.str().c_str());
+                ball::Record           record(attr, ball::UserFields());
+
+                mX.publish(record, context);
+                mY.publish(record, context);
+            }
+
+            ASSERT(0 == FsUtil::getFileSize(compressedName));
+
+            mX.disableGroupCommit();
+
+            bsl::string text;
+            ASSERT(0 == decompressFile(&text, compressedName));
+            ASSERT(readFile(defaultName) == text);
+
+            const Int64 compressedSize = FsUtil::getFileSize(compressedName);
+            const Int64 defaultSize    = FsUtil::getFileSize(defaultName);
+
+            if (veryVerbose) { P_(defaultSize) P(compressedSize) }
+
+            ASSERTV(compressedSize,
+                    defaultSize,
+                    compressedSize < defaultSize / 3);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CONSTRUCTOR, MAKE_SHARED, AND ALLOCATE_SHARED TEST
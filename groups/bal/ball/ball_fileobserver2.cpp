@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 
 #include <ball_context.h>
+#include <ball_logfilecompressionutil.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
 #include <ball_userfields.h>
@@ -16,6 +17,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <ball_recordstringformatter.h>       // for testing only
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 
 #include <bdls_filesystemutil.h>
@@ -29,9 +31,13 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
+#include <bslma_default.h>
+
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_platform.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
@@ -52,6 +58,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>       // for 'writev'
+#include <unistd.h>        // for 'fdatasync', 'fsync'
 #endif
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -304,6 +312,119 @@ static int openLogFile(bsl::ostream *stream, const char *filename)
     return 0;
 }
 
+/// Write the output held by the specified `buffer` to the file having the
+/// specified `fd`, using as few vectored writes as the platform allows.
+/// Return 0 on success, and a non-zero value otherwise.
+int writeRecordBuffer(bdls::FilesystemUtil::FileDescriptor fd,
+                      const FileObserver2_RecordBuffer&    buffer)
+{
+    const int numChunks = buffer.numChunks();
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    enum { k_MAX_IOVECS = 64 };  // well below any platform's 'IOV_MAX'
+
+    int         index  = 0;  // first chunk not completely written
+    bsl::size_t offset = 0;  // bytes of chunk 'index' already written
+
+    while (index < numChunks) {
+        struct iovec vectors[k_MAX_IOVECS];
+        int          numVectors = 0;
+
+        for (int i = index; i < numChunks && numVectors < k_MAX_IOVECS; ++i) {
+            const bsl::size_t skip = i == index ? offset : 0;
+
+            vectors[numVectors].iov_base =
+                                   const_cast<char *>(buffer.chunk(i)) + skip;
+            vectors[numVectors].iov_len  = buffer.chunkLength(i) - skip;
+            ++numVectors;
+        }
+
+        const ssize_t rc = ::writev(fd, vectors, numVectors);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return -1;                                                // RETURN
+        }
+
+        // Advance past the written bytes; a partial write may end within a
+        // chunk.
+
+        bsl::size_t numWritten = static_cast<bsl::size_t>(rc);
+        while (0 < numWritten) {
+            const bsl::size_t remaining = buffer.chunkLength(index) - offset;
+
+            if (numWritten < remaining) {
+                offset     += numWritten;
+                numWritten  = 0;
+            }
+            else {
+                numWritten -= remaining;
+                offset      = 0;
+                ++index;
+            }
+        }
+    }
+#else
+    for (int i = 0; i < numChunks; ++i) {
+        const int length = static_cast<int>(buffer.chunkLength(i));
+
+        if (length != bdls::FilesystemUtil::write(fd,
+                                                  buffer.chunk(i),
+                                                  length)) {
+            return -1;                                                // RETURN
+        }
+    }
+#endif
+
+    return 0;
+}
+
+/// Write the specified `length` bytes at the specified `data` to the file
+/// having the specified `fd`.  Return 0 on success, and a non-zero value
+/// otherwise.
+int writeData(bdls::FilesystemUtil::FileDescriptor  fd,
+              const char                           *data,
+              bsl::size_t                           length)
+{
+    while (0 < length) {
+#ifdef BSLS_PLATFORM_OS_UNIX
+        const ssize_t rc = ::write(fd, data, length);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return -1;                                                // RETURN
+        }
+#else
+        const int rc = bdls::FilesystemUtil::write(fd,
+                                                   data,
+                                                   static_cast<int>(length));
+        if (rc <= 0) {
+            return -1;                                                // RETURN
+        }
+#endif
+
+        data   += rc;
+        length -= static_cast<bsl::size_t>(rc);
+    }
+
+    return 0;
+}
+
+/// Flush the data written to the file having the specified `fd` to the
+/// storage device.  Return 0 on success, and a non-zero value otherwise.
+int syncFileData(bdls::FilesystemUtil::FileDescriptor fd)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return ::fdatasync(fd);
+#elif defined(BSLS_PLATFORM_OS_UNIX)
+    return ::fsync(fd);
+#else
+    return FlushFileBuffers(fd) ? 0 : -1;
+#endif
+}
+
 /// Return `true` if the specified `a` and `b` times are within 10% of the
 /// specified `interval` from each other, and `false` otherwise.  The
 /// behavior is undefined unless `0 <= interval.totalMilliseconds()`.
@@ -381,11 +502,122 @@ static bdlt::Datetime computeNextRotationTime(
 
 }  // close unnamed namespace
 
+                      // --------------------------------
+                      // class FileObserver2_RecordBuffer
+                      // --------------------------------
+
+// PRIVATE MANIPULATORS
+void FileObserver2_RecordBuffer::appendChunk()
+{
+    d_chunks.reserve(d_chunks.size() + 1);
+
+    char *chunk;
+    if (d_freeChunks.empty()) {
+        chunk = static_cast<char *>(d_allocator_p->allocate(k_CHUNK_SIZE));
+    }
+    else {
+        chunk = d_freeChunks.back();
+        d_freeChunks.pop_back();
+    }
+
+    d_chunks.push_back(chunk);
+    setp(chunk, chunk + k_CHUNK_SIZE);
+}
+
+// PROTECTED MANIPULATORS
+FileObserver2_RecordBuffer::int_type
+FileObserver2_RecordBuffer::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    appendChunk();
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+
+    return c;
+}
+
+bsl::streamsize FileObserver2_RecordBuffer::xsputn(
+                                              const char      *source,
+                                              bsl::streamsize  numChars)
+{
+    bsl::streamsize numLeft = numChars;
+
+    while (0 < numLeft) {
+        if (pptr() == epptr()) {
+            appendChunk();
+        }
+
+        const bsl::streamsize available = epptr() - pptr();
+        const int             length    = static_cast<int>(
+                                 numLeft < available ? numLeft : available);
+
+        bsl::memcpy(pptr(), source, length);
+        pbump(length);
+
+        source  += length;
+        numLeft -= length;
+    }
+
+    return numChars;
+}
+
+// CREATORS
+FileObserver2_RecordBuffer::FileObserver2_RecordBuffer(
+                                              bslma::Allocator *basicAllocator)
+: d_chunks(basicAllocator)
+, d_freeChunks(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+FileObserver2_RecordBuffer::~FileObserver2_RecordBuffer()
+{
+    for (bsl::size_t i = 0; i < d_chunks.size(); ++i) {
+        d_allocator_p->deallocate(d_chunks[i]);
+    }
+    for (bsl::size_t i = 0; i < d_freeChunks.size(); ++i) {
+        d_allocator_p->deallocate(d_freeChunks[i]);
+    }
+}
+
+// MANIPULATORS
+void FileObserver2_RecordBuffer::reset()
+{
+    d_freeChunks.insert(d_freeChunks.end(), d_chunks.begin(), d_chunks.end());
+    d_chunks.clear();
+    setp(0, 0);
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::commitOnLatency(unsigned int generation)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (generation == d_groupCommitGeneration) {
+        if (0 == d_recordBuffer.length()) {
+            d_groupCommitCondition.wait(&d_mutex);
+            continue;
+        }
+
+        const bsls::TimeInterval deadline = d_pendingSince + d_maxLatency;
+
+        if (deadline <= bsls::SystemTime::nowMonotonicClock()) {
+            writePendingRecords();
+        }
+        else {
+            d_groupCommitCondition.timedWait(&d_mutex, deadline);
+        }
+    }
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -453,6 +685,11 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
     int returnStatus = k_ROTATE_SUCCESS;
 
+    // Records pending a group commit were published before the rotation, and
+    // belong to the current log file.
+
+    writePendingRecords();
+
     // Close current log file.
     if (0 != d_logStreamBuf.clear()) {
         LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_WARN,
@@ -536,6 +773,9 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
         returnStatus |= k_ROTATE_NEW_LOG_ERROR;
     }
+    else {
+        setUpOpenedLogFile();
+    }
 
     return -returnStatus;
 }
@@ -553,9 +793,17 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
 
     if (d_rotationSize) {
         // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+        // 'tellp' fails, or the rotation size is exceeded.  In group-commit
+        // mode, and for compressed log files, the file size is tracked to
+        // avoid seeking on each record, and includes the (uncompressed) size
+        // of the pending records.
+
+        const bsls::Types::Uint64 fileSize =
+                  d_isGroupCommitEnabled || d_isLogFileCompressed
+                  ? d_committedSize + d_recordBuffer.length()
+                  : static_cast<bsls::Types::Uint64>(d_logOutStream.tellp());
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
+        if (fileSize >
             static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
 
             return rotateFile(rotatedLogFileName);                    // RETURN
@@ -570,6 +818,91 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     return 1;
 }
 
+void FileObserver2::setUpOpenedLogFile()
+{
+    d_isLogFileCompressed = d_isCompressionEnabled;
+    d_committedSize       = d_logOutStream.tellp();
+}
+
+int FileObserver2::writePendingRecords()
+{
+    if (0 == d_recordBuffer.length()) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_logStreamBuf.isOpened()) {
+        d_recordBuffer.reset();
+        return -1;                                                    // RETURN
+    }
+
+    const bdls::FilesystemUtil::FileDescriptor fd =
+                                               d_logStreamBuf.fileDescriptor();
+
+    int         rc;
+    bsl::size_t writtenSize;
+
+    if (d_isLogFileCompressed) {
+        // Compress the pending records as one sequence of text, gathering
+        // them from the chunks of the record buffer unless they fit in one.
+
+        const int   numChunks = d_recordBuffer.numChunks();
+        const char *text      = d_recordBuffer.chunk(0);
+
+        if (1 < numChunks) {
+            d_compressionInput.resize(d_recordBuffer.length());
+
+            char *position = d_compressionInput.data();
+            for (int i = 0; i < numChunks; ++i) {
+                bsl::memcpy(position,
+                            d_recordBuffer.chunk(i),
+                            d_recordBuffer.chunkLength(i));
+                position += d_recordBuffer.chunkLength(i);
+            }
+            text = d_compressionInput.data();
+        }
+
+        d_compressedFrames.clear();
+        LogFileCompressionUtil::appendFrames(&d_compressedFrames,
+                                             text,
+                                             d_recordBuffer.length());
+
+        rc          = writeData(fd,
+                                d_compressedFrames.data(),
+                                d_compressedFrames.size());
+        writtenSize = d_compressedFrames.size();
+    }
+    else {
+        rc          = writeRecordBuffer(fd, d_recordBuffer);
+        writtenSize = d_recordBuffer.length();
+    }
+
+    if (0 != rc) {
+        LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_ERROR,
+                             "Error on file stream for %s: %s.",
+                             d_logFileName.c_str(),
+                             bsl::strerror(getErrorCode()));
+
+        d_recordBuffer.reset();
+        d_logStreamBuf.clear();
+        return rc;                                                    // RETURN
+    }
+
+    d_committedSize += writtenSize;
+    d_recordBuffer.reset();
+    ++d_numCommits;
+
+    if (d_syncInterval && 0 == d_numCommits % d_syncInterval) {
+        if (0 != syncFileData(fd)) {
+            LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_WARN,
+                                 "Cannot sync log file %s: %s.",
+                                 d_logFileName.c_str(),
+                                 bsl::strerror(getErrorCode()));
+        }
+    }
+
+    return 0;
+}
+
 // PRIVATE ACCESSORS
 template <class STRING>
 bool FileObserver2::isFileLoggingEnabledImpl(STRING *result) const
@@ -608,26 +941,91 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_recordBuffer(basicAllocator)
+, d_recordStream(&d_recordBuffer)
+, d_isGroupCommitEnabled(false)
+, d_maxPendingBytes(0)
+, d_maxLatency()
+, d_syncInterval(0)
+, d_numCommits(0)
+, d_pendingSince()
+, d_committedSize(0)
+, d_isCompressionEnabled(false)
+, d_isLogFileCompressed(false)
+, d_compressionInput(basicAllocator)
+, d_compressedFrames(basicAllocator)
+, d_groupCommitCondition(bsls::SystemClockType::e_MONOTONIC)
+, d_groupCommitThread(bslmt::ThreadUtil::invalidHandle())
+, d_groupCommitGeneration(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 FileObserver2::~FileObserver2()
 {
+    disableGroupCommit();
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
 }
 
 // MANIPULATORS
+int FileObserver2::commitPendingRecords()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return writePendingRecords();
+}
+
+void FileObserver2::disableCompression()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_isCompressionEnabled = false;
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
     if (d_logStreamBuf.isOpened()) {
+        writePendingRecords();
         d_logStreamBuf.clear();
     }
 }
 
+void FileObserver2::disableGroupCommit()
+{
+    bslmt::ThreadUtil::Handle thread;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isGroupCommitEnabled) {
+            return;                                                   // RETURN
+        }
+
+        writePendingRecords();
+
+        d_isGroupCommitEnabled = false;
+        d_syncInterval         = 0;
+        ++d_groupCommitGeneration;
+
+        thread              = d_groupCommitThread;
+        d_groupCommitThread = bslmt::ThreadUtil::invalidHandle();
+
+        d_groupCommitCondition.signal();
+    }
+
+    // The thread must be joined without a lock on 'd_mutex', which it
+    // acquires to observe the change of 'd_groupCommitGeneration'.
+
+    if (!bslmt::ThreadUtil::areEqual(thread,
+                                     bslmt::ThreadUtil::invalidHandle())) {
+        bslmt::ThreadUtil::join(thread);
+    }
+}
+
 void FileObserver2::disableLifetimeRotation()
 {
     disableTimeIntervalRotation();
@@ -654,6 +1052,13 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+void FileObserver2::enableCompression()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_isCompressionEnabled = true;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -687,7 +1092,12 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern)
                                     d_logFileTimestampUtc);
     }
 
-    return openLogFile(&d_logOutStream, d_logFileName.c_str());
+    const int rc = openLogFile(&d_logOutStream, d_logFileName.c_str());
+    if (0 == rc) {
+        setUpOpenedLogFile();
+    }
+
+    return rc;
 }
 
 int FileObserver2::enableFileLogging(const char *logFilenamePattern,
@@ -704,6 +1114,48 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern,
     return enableFileLogging(logFilenamePattern);
 }
 
+int FileObserver2::enableGroupCommit(int                       maxPendingBytes,
+                                     const bsls::TimeInterval& maxLatency,
+                                     int                       syncInterval)
+{
+    BSLS_ASSERT(0 < maxPendingBytes);
+    BSLS_ASSERT(bsls::TimeInterval() <= maxLatency);
+    BSLS_ASSERT(0 <= syncInterval);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_isGroupCommitEnabled) {
+        return 1;                                                     // RETURN
+    }
+
+    if (bsls::TimeInterval() < maxLatency) {
+        const int rc = bslmt::ThreadUtil::createWithAllocator(
+                               &d_groupCommitThread,
+                               bdlf::BindUtil::bind(
+                                              &FileObserver2::commitOnLatency,
+                                              this,
+                                              d_groupCommitGeneration),
+                               d_allocator_p);
+        if (0 != rc) {
+            d_groupCommitThread = bslmt::ThreadUtil::invalidHandle();
+            return -1;                                                // RETURN
+        }
+    }
+
+    d_maxPendingBytes = maxPendingBytes;
+    d_maxLatency      = maxLatency;
+    d_syncInterval    = syncInterval;
+    d_numCommits      = 0;
+
+    if (d_logStreamBuf.isOpened() && !d_isLogFileCompressed) {
+        d_logOutStream.flush();
+        d_committedSize = d_logOutStream.tellp();
+    }
+
+    d_isGroupCommitEnabled = true;
+    return 0;
+}
+
 void FileObserver2::forceRotation()
 {
     bsl::string rotatedLogFileName;
@@ -740,7 +1192,26 @@ void FileObserver2::publish(const Record& record, const Context&)
         rotationStatus = rotateIfNecessary(&rotatedFileName,
                                            record.fixedFields().timestamp());
 
-        if (d_logStreamBuf.isOpened()) {
+        if (d_logStreamBuf.isOpened()
+         && (d_isGroupCommitEnabled || d_isLogFileCompressed)) {
+            if (d_isGroupCommitEnabled
+             && 0 == d_recordBuffer.length()
+             && bsls::TimeInterval() < d_maxLatency) {
+                d_pendingSince = bsls::SystemTime::nowMonotonicClock();
+                d_groupCommitCondition.signal();
+            }
+
+            d_logFileFunctor(d_recordStream, record);
+
+            // Absent group commit, a record written to a compressed log file
+            // is compressed on its own.
+
+            if (!d_isGroupCommitEnabled
+             || d_recordBuffer.length() >= d_maxPendingBytes) {
+                writePendingRecords();
+            }
+        }
+        else if (d_logStreamBuf.isOpened()) {
             d_logFileFunctor(d_logOutStream, record);
 
             if (!d_logOutStream) {
@@ -832,6 +1303,13 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bool FileObserver2::isCompressionEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isCompressionEnabled;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -856,6 +1334,13 @@ bool FileObserver2::isFileLoggingEnabled(std::pmr::string *result) const
 }
 #endif  //BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+bool FileObserver2::isGroupCommitEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isGroupCommitEnabled;
+}
+
 bool FileObserver2::isPublishInLocalTimeEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -12,6 +12,7 @@ BSLS_IDENT("$Id: $")
 //  ball::FileObserver2: observer that outputs log records to a file
 //
 //@SEE_ALSO: ball_record, ball_context, ball_observer,
+//           ball_logfilecompressionutil,
 //           ball_recordstringformatter
 //
 //@DESCRIPTION: This component provides a concrete implementation of the
@@ -23,11 +24,16 @@ BSLS_IDENT("$Id: $")
 //              ( ball::FileObserver2 )
 //               `-------------------'
 //                        |              ctor
+//                        |              commitPendingRecords
+//                        |              disableCompression
 //                        |              disableFileLogging
+//                        |              disableGroupCommit
 //                        |              disableTimeIntervalRotation
 //                        |              disableSizeRotation
 //                        |              disablePublishInLocalTime
+//                        |              enableCompression
 //                        |              enableFileLogging
+//                        |              enableGroupCommit
 //                        |              enablePublishInLocalTime
 //                        |              forceRotation
 //                        |              rotateOnSize
@@ -35,7 +41,9 @@ BSLS_IDENT("$Id: $")
 //                        |              setLogFileFunctor
 //                        |              setOnFileRotationCallback
 //                        |              suppressUniqueFileNameOnRotation
+//                        |              isCompressionEnabled
 //                        |              isFileLoggingEnabled
+//                        |              isGroupCommitEnabled
 //                        |              isPublishInLocalTimeEnabled
 //                        |              isSuppressUniqueFileNameOnRotation
 //                        |              rotationLifetime
@@ -88,6 +96,15 @@ BSLS_IDENT("$Id: $")
 // |             | rotationLifetime                   |
 // |             | isSuppressUniqueFileNameOnRotation |
 // +-------------+------------------------------------+
+// | Group       | enableGroupCommit                  |
+// | Commit      | disableGroupCommit                 |
+// |             | commitPendingRecords               |
+// |             | isGroupCommitEnabled               |
+// +-------------+------------------------------------+
+// | Log File    | enableCompression                  |
+// | Compression | disableCompression                 |
+// |             | isCompressionEnabled               |
+// +-------------+------------------------------------+
 // ```
 // In general, a `ball::FileObserver2` object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -281,6 +298,75 @@ BSLS_IDENT("$Id: $")
 // the period is one day), then a unique name on each rotation is produced with
 // the (local) time at which file rotation occurred embedded in the filename.
 //
+///Group Commit
+///------------
+// By default, each record received by `publish` is formatted and written to
+// the log file before `publish` returns, so that every record costs at least
+// one `write` system call made while the observer's lock is held.  A file
+// observer may instead be configured, by calling `enableGroupCommit`, to
+// accumulate formatted records in memory and write them to the log file in
+// groups.  In group-commit mode, `publish` formats a record into a sequence of
+// fixed-size chunks that are pooled for reuse, and the pending chunks are
+// written to the log file with a single vectored write (`writev`, on platforms
+// that provide it) when either of the following flush conditions is met:
+//
+// * The size of the pending records reaches the `maxPendingBytes` supplied
+//   to `enableGroupCommit`.
+// * The oldest pending record has been pending for the `maxLatency` supplied
+//   to `enableGroupCommit` (if `maxLatency` is not 0).  A thread owned by the
+//   file observer writes such records, so that they are written even if no
+//   further records are published.
+//
+// Pending records are also written when `commitPendingRecords` is called,
+// before the log file is rotated or closed, when `disableGroupCommit` is
+// called, and when the file observer is destroyed.  The `syncInterval`
+// supplied to `enableGroupCommit`, if not 0, additionally causes the log file
+// data to be flushed to the storage device (with `fdatasync`, or its nearest
+// platform equivalent) after every `syncInterval` group writes.
+//
+// Group commit does not affect log file rotation: the size of the pending
+// records is included in the log file size compared against the
+// rotation-on-size limit, and records pending when a rotation occurs are
+// written to the rotated log file.  Note that records pending when the task
+// terminates abnormally are lost, so group commit trades the durability of the
+// most recently published records for throughput.
+//
+///Log File Compression
+///--------------------
+// A file observer may be configured, by calling `enableCompression`, to
+// compress the log files that it subsequently opens, i.e., the next log file
+// opened by `enableFileLogging` or by a rotation.  A compressed log file is a
+// sequence of frames, each holding up to 64 KiB of formatted records
+// compressed by a fast LZ77-class codec, along with their length and checksum
+// (see `ball_logfilecompressionutil`).  Log text typically compresses to
+// between a quarter and a third of its size, at a CPU cost of a few
+// milliseconds per megabyte of text.  Compressed log files are decompressed by
+// `ball::LogFileCompressionUtil::decompress`, or by the
+// `m_balllogdecompressor` application.
+//
+// Records published to a compressed log file are formatted into memory, as in
+// group-commit mode, and are compressed when they are written to the file.
+// Absent group commit, each record is written, and therefore compressed, on
+// its own, which saves little space; compression should be combined with group
+// commit (see {Group Commit}), so that each group of records is compressed
+// into one or more frames.  A `maxPendingBytes` of 64 KiB matches the size of
+// a frame.  Records are then compressed by the thread that triggers their
+// write: the thread publishing the record that reaches `maxPendingBytes`, or
+// the thread owned by the file observer enforcing `maxLatency`.  Note that
+// the publishing thread of a `ball::AsyncFileObserver` is its own publication
+// thread, so that compression never delays the threads that log records.
+//
+// Because frames are self-delimiting and self-checking, a compressed log file
+// remains readable if the process writing it terminates abnormally while
+// writing a frame, and can be appended to by subsequent processes; the
+// incomplete frame is skipped when the file is read.  The size of a compressed
+// log file, as compared against the rotation-on-size limit, is its size on
+// disk, to which the uncompressed size of the pending records is added.  Note
+// that a compressed log file should not be given the name of an uncompressed
+// one (e.g., the log filename pattern should end with a suffix such as
+// ".lz"), since uncompressed text in a compressed log file is skipped when the
+// file is read.
+//
 ///Thread Safety
 ///-------------
 // All methods of `ball::FileObserver2` are thread-safe, and can be called
@@ -358,16 +444,24 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <string>           // `std::string`, `std::pmr::string`
 
@@ -377,6 +471,94 @@ namespace ball {
 class Context;
 class Record;
 
+                      // ================================
+                      // class FileObserver2_RecordBuffer
+                      // ================================
+
+/// PRIVATE CLASS.  For use by the `ball::FileObserver2` implementation
+/// only.  This class implements a stream buffer that accumulates the
+/// formatted records pending a group commit in a sequence of fixed-size
+/// chunks, so that they can be written to a file with a single vectored
+/// write.  Chunks released by `reset` are retained for reuse by subsequent
+/// output.  This class is not thread-safe.
+class FileObserver2_RecordBuffer : public bsl::streambuf {
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_CHUNK_SIZE = 16 * 1024 };  // size of each chunk (in bytes)
+
+  private:
+    // DATA
+    bsl::vector<char *>  d_chunks;       // chunks holding output, the last
+                                         // being the one written to
+
+    bsl::vector<char *>  d_freeChunks;   // pooled chunks available for reuse
+
+    bslma::Allocator    *d_allocator_p;  // memory allocator (held, not
+                                         // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    FileObserver2_RecordBuffer(const FileObserver2_RecordBuffer&);
+    FileObserver2_RecordBuffer& operator=(const FileObserver2_RecordBuffer&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append a chunk, taken from the pool of free chunks if one is
+    /// available, to the chunks of this buffer, and make it the chunk to
+    /// which output is written.
+    void appendChunk();
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Write the specified character `c` to this buffer, appending a chunk
+    /// if the current one is full.  Return `c`, or `traits_type::not_eof(c)`
+    /// if `c` is `traits_type::eof()` (in which case nothing is written).
+    int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE;
+
+    /// Write the specified `numChars` characters starting at the specified
+    /// `source` to this buffer, appending chunks as needed.  Return
+    /// `numChars`.
+    bsl::streamsize xsputn(const char      *source,
+                           bsl::streamsize  numChars) BSLS_KEYWORD_OVERRIDE;
+
+  public:
+    // CREATORS
+
+    /// Create an empty record buffer.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit FileObserver2_RecordBuffer(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this record buffer.
+    ~FileObserver2_RecordBuffer() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Discard the output held by this buffer, returning its chunks to the
+    /// pool of free chunks.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the address of the chunk at the specified `index` of this
+    /// buffer.  The behavior is undefined unless
+    /// `0 <= index < numChunks()`.
+    const char *chunk(int index) const;
+
+    /// Return the number of bytes of output held by the chunk at the
+    /// specified `index` of this buffer.  The behavior is undefined unless
+    /// `0 <= index < numChunks()`.
+    bsl::size_t chunkLength(int index) const;
+
+    /// Return the number of bytes of output held by this buffer.
+    bsl::size_t length() const;
+
+    /// Return the number of chunks holding the output of this buffer.
+    int numChunks() const;
+};
+
                           // ===================
                           // class FileObserver2
                           // ===================
@@ -474,6 +656,78 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    FileObserver2_RecordBuffer d_recordBuffer;         // formatted records
+                                                       // pending a group
+                                                       // commit
+
+    bsl::ostream           d_recordStream;             // output stream for
+                                                       // group commit (refers
+                                                       // to `d_recordBuffer`)
+
+    bool                   d_isGroupCommitEnabled;     // `true` if records are
+                                                       // written in groups
+
+    bsl::size_t            d_maxPendingBytes;          // size of the pending
+                                                       // records that triggers
+                                                       // a group commit
+
+    bsls::TimeInterval     d_maxLatency;               // age of the oldest
+                                                       // pending record that
+                                                       // triggers a group
+                                                       // commit (0 if none)
+
+    int                    d_syncInterval;             // number of group
+                                                       // commits between data
+                                                       // syncs (0 if none)
+
+    bsls::Types::Uint64    d_numCommits;               // number of group
+                                                       // commits since group
+                                                       // commit was enabled
+
+    bsls::TimeInterval     d_pendingSince;             // monotonic time at
+                                                       // which the oldest
+                                                       // pending record was
+                                                       // published
+
+    bsls::Types::Uint64    d_committedSize;            // size of the log file
+                                                       // (in bytes) following
+                                                       // the last group commit
+                                                       // or compressed write
+
+    bool                   d_isCompressionEnabled;     // `true` if log files
+                                                       // subsequently opened
+                                                       // are compressed
+
+    bool                   d_isLogFileCompressed;      // `true` if the current
+                                                       // log file is
+                                                       // compressed
+
+    bsl::vector<char>      d_compressionInput;         // pending records
+                                                       // gathered for
+                                                       // compression
+
+    bsl::vector<char>      d_compressedFrames;         // frames holding the
+                                                       // compressed pending
+                                                       // records
+
+    bslmt::Condition       d_groupCommitCondition;     // signaled when records
+                                                       // become pending, or
+                                                       // group commit is
+                                                       // disabled
+
+    bslmt::ThreadUtil::Handle
+                           d_groupCommitThread;        // thread writing the
+                                                       // records pending for
+                                                       // `d_maxLatency`
+
+    unsigned int           d_groupCommitGeneration;    // incremented when
+                                                       // group commit is
+                                                       // disabled, to stop
+                                                       // `d_groupCommitThread`
+
+    bslma::Allocator      *d_allocator_p;              // memory allocator
+                                                       // (held, not owned)
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -482,6 +736,13 @@ class FileObserver2 : public Observer {
   private:
     // PRIVATE MANIPULATORS
 
+    /// Write the records pending a group commit when the oldest of them
+    /// has been pending for `d_maxLatency`, until group commit is disabled
+    /// or re-enabled, as indicated by `d_groupCommitGeneration` differing
+    /// from the specified `generation`.  This method is the entry point of
+    /// `d_groupCommitThread`.
+    void commitOnLatency(unsigned int generation);
+
     /// Write the specified log `record` to the specified output `stream`
     /// using the default record format of this file observer.
     void logRecordDefault(bsl::ostream& stream, const Record& record);
@@ -509,6 +770,20 @@ class FileObserver2 : public Observer {
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
 
+    /// Record whether the log file just opened is compressed, and the size
+    /// of the file.  The behavior is undefined unless the caller acquired
+    /// the lock for this object.
+    void setUpOpenedLogFile();
+
+    /// Write the records pending a group commit to the log file,
+    /// compressing them if the log file is compressed, and sync the log
+    /// file data if `d_syncInterval` group commits have been made since the
+    /// last sync.  Return 0 on success, and a non-zero value otherwise, in
+    /// which case file logging is disabled.  The pending records are
+    /// discarded in either case.  The behavior is undefined unless the
+    /// caller acquired the lock for this object.
+    int writePendingRecords();
+
     // PRIVATE ACCESSORS
 
     /// Return `true` if file logging is enabled for this file observer, and
@@ -534,18 +809,39 @@ class FileObserver2 : public Observer {
     /// is in effect for file logging (see `setLogFileFunctor`).
     explicit FileObserver2(bslma::Allocator *basicAllocator = 0);
 
-    /// Close the log file of this file observer if file logging is enabled,
-    /// and destroy this file observer.
+    /// Write any records pending a group commit, close the log file of this
+    /// file observer if file logging is enabled, and destroy this file
+    /// observer.
     ~FileObserver2() BSLS_KEYWORD_OVERRIDE;
 
     // MANIPULATORS
 
+    /// Write the records pending a group commit to the log file of this
+    /// file observer.  Return 0 on success, and a non-zero value otherwise,
+    /// in which case file logging is disabled.  This method has no effect,
+    /// and returns 0, if no records are pending.  See {Group Commit}.
+    int commitPendingRecords();
+
+    /// Disable compression of the log files subsequently opened by this
+    /// file observer.  Note that the current log file, if any, remains
+    /// compressed until it is closed or rotated.  See {Log File
+    /// Compression}.
+    void disableCompression();
+
     /// Disable file logging for this file observer.  This method has no
     /// effect if file logging is not enabled.  Note that records
     /// subsequently received through the `publish` method will be dropped
     /// until file logging is re-enabled.
     void disableFileLogging();
 
+    /// Disable group commit for this file observer, first writing any
+    /// pending records to the log file.  Records subsequently received
+    /// through the `publish` method are written to the log file before
+    /// `publish` returns.  This method has no effect if group commit is not
+    /// enabled.  The behavior is undefined if this method is called
+    /// concurrently with `enableGroupCommit`.  See {Group Commit}.
+    void disableGroupCommit();
+
     /// Disable log file rotation based on a periodic time interval for this
     /// file observer.  This method has no effect if
     /// rotation-on-time-interval is not enabled.
@@ -570,6 +866,14 @@ class FileObserver2 : public Observer {
     /// rotation-on-time-interval is not enabled.
     void disableTimeIntervalRotation();
 
+    /// Enable compression of the log files subsequently opened by this file
+    /// observer, i.e., the log file opened by the next successful call to
+    /// `enableFileLogging` or by the next rotation.  Note that the current
+    /// log file, if any, remains uncompressed until it is closed or
+    /// rotated; `forceRotation` may be called to open a compressed log file
+    /// immediately.  See {Log File Compression}.
+    void enableCompression();
+
     /// Enable logging of all records published to this file observer to a
     /// file whose name is derived from the specified `logFilenamePattern`.
     /// Return 0 on success, a positive value if file logging is already
@@ -611,6 +915,25 @@ class FileObserver2 : public Observer {
     int enableFileLogging(const char *logFilenamePattern,
                           bool        appendTimestampFlag);
 
+    /// Enable group commit for this file observer: records subsequently
+    /// received through the `publish` method are formatted into memory and
+    /// written to the log file in groups, once the pending records amount
+    /// to the specified `maxPendingBytes`, or once the oldest of them has
+    /// been pending for the specified `maxLatency` if `maxLatency` is not
+    /// 0.  Optionally specify a `syncInterval` indicating the number of
+    /// group writes after which the log file data is flushed to the storage
+    /// device.  If `syncInterval` is 0 or not specified, the log file data
+    /// is never explicitly flushed.  Return 0 on success, a positive value
+    /// if group commit is already enabled (with no effect), and a negative
+    /// value if the thread enforcing `maxLatency` could not be created.
+    /// The behavior is undefined unless `0 < maxPendingBytes`,
+    /// `bsls::TimeInterval() <= maxLatency`, and `0 <= syncInterval`, or if
+    /// this method is called concurrently with `disableGroupCommit`.  See
+    /// {Group Commit}.
+    int enableGroupCommit(int                       maxPendingBytes,
+                          const bsls::TimeInterval& maxLatency,
+                          int                       syncInterval = 0);
+
     /// Enable publishing of the timestamp attribute of records in local
     /// time by this file observer.  This method has no effect if publishing
     /// in local time is already enabled.  Note that this method also
@@ -706,6 +1029,11 @@ class FileObserver2 : public Observer {
 
     // ACCESSORS
 
+    /// Return `true` if compression is enabled for the log files
+    /// subsequently opened by this file observer, and `false` otherwise.
+    /// See {Log File Compression}.
+    bool isCompressionEnabled() const;
+
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the optionally specified `result` with the
     /// name of the current log file if file logging is enabled, and leave
@@ -724,6 +1052,10 @@ class FileObserver2 : public Observer {
     bool isFileLoggingEnabled(std::pmr::string *result) const;
 #endif  // BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+    /// Return `true` if group commit is enabled for this file observer, and
+    /// `false` otherwise.  See {Group Commit}.
+    bool isGroupCommitEnabled() const;
+
     /// Return `true` if this file observer writes the timestamp attribute
     /// of records that it publishes in local time, and `false` otherwise
     /// (in which case timestamps are written in UTC time).  Note that the
@@ -760,6 +1092,49 @@ class FileObserver2 : public Observer {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                      // --------------------------------
+                      // class FileObserver2_RecordBuffer
+                      // --------------------------------
+
+// ACCESSORS
+inline
+const char *FileObserver2_RecordBuffer::chunk(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numChunks());
+
+    return d_chunks[index];
+}
+
+inline
+bsl::size_t FileObserver2_RecordBuffer::chunkLength(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numChunks());
+
+    if (index + 1 < numChunks()) {
+        return k_CHUNK_SIZE;                                          // RETURN
+    }
+
+    return pptr() - pbase();
+}
+
+inline
+bsl::size_t FileObserver2_RecordBuffer::length() const
+{
+    if (d_chunks.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    return (d_chunks.size() - 1) * k_CHUNK_SIZE + (pptr() - pbase());
+}
+
+inline
+int FileObserver2_RecordBuffer::numChunks() const
+{
+    return static_cast<int>(d_chunks.size());
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
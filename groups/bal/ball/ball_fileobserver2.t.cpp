@@ -3,6 +3,7 @@
 
 #include <ball_context.h>
 #include <ball_log.h>
+#include <ball_logfilecompressionutil.h>
 #include <ball_loggermanager.h>
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_recordattributes.h>
@@ -42,8 +43,11 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -53,6 +57,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -92,13 +97,18 @@ using bsl::flush;
 // [ 1] ~FileObserver2();
 //
 // MANIPULATORS
+// [14] int  commitPendingRecords();
+// [15] void disableCompression();
 // [ 1] void disableFileLogging();
+// [14] void disableGroupCommit();
 // [ 2] void disableLifetimeRotation();
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [15] void enableCompression();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
+// [14] int  enableGroupCommit(int, const bsls::TimeInterval&, int);
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
@@ -111,15 +121,18 @@ using bsl::flush;
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [15] bool isCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isFileLoggingEnabled(std::string *result) const;
 // [ 1] bool isFileLoggingEnabled(std::pmr::string *result) const;
+// [14] bool isGroupCommitEnabled() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
+// [13] REPRODUCE BUG FROM DRQS 123123158
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -485,6 +498,61 @@ void publishRecord(Obj *observer, const char *message)
 }
 
 
+/// This class provides a thread entry point publishing records to a file
+/// observer and recording the time taken by each call to `publish`.
+class PublishBenchmarkThread {
+
+    // DATA
+    Obj                *d_observer_p;   // observer to publish to
+    bsl::vector<Int64> *d_latencies_p;  // latency of each call (in ns)
+    int                 d_numRecords;   // number of records to publish
+
+  public:
+    // CREATORS
+
+    /// Create a thread entry point that publishes the specified
+    /// `numRecords` records to the specified `observer`, and loads the
+    /// latency of each publication (in nanoseconds) into the specified
+    /// `latencies`.
+    PublishBenchmarkThread(Obj                *observer,
+                           bsl::vector<Int64> *latencies,
+                           int                 numRecords)
+    : d_observer_p(observer)
+    , d_latencies_p(latencies)
+    , d_numRecords(numRecords)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Publish the records.
+    void operator()() const
+    {
+        ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                    1,
+                                    2,
+                                    "FILENAME",
+                                    3,
+                                    "CATEGORY",
+                                    32,
+                                    "A benchmark record of a typical length, "
+                                    "carrying a few formatted values: 42.");
+
+        ball::Record  record(attr, ball::UserFields());
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        d_latencies_p->reserve(d_numRecords);
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            const Int64 start = bsls::TimeUtil::getTimer();
+
+            d_observer_p->publish(record, context);
+
+            d_latencies_p->push_back(bsls::TimeUtil::getTimer() - start);
+        }
+    }
+};
+
 /// Return the number of lines in the file with the specified `fileName`.
 int getNumLines(const char *fileName)
 {
@@ -503,6 +571,31 @@ int getNumLines(const char *fileName)
     return numLines;
 }
 
+/// Return the contents of the file with the specified `fileName`.
+bsl::string readFile(const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    bsl::ostringstream content;
+    content << fs.rdbuf();
+    return content.str();
+}
+
+/// Load, into the specified `text`, the text decompressed from the
+/// compressed log file with the specified `fileName`, and return the status
+/// returned by `ball::LogFileCompressionUtil::decompress`.
+int decompressFile(bsl::string *text, const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ios::in | bsl::ios::binary);
+    ASSERT(fs.is_open());
+
+    bsl::ostringstream output;
+    const int rc = ball::LogFileCompressionUtil::decompress(output, fs);
+    *text = output.str();
+    return rc;
+}
+
 struct TestCurrentTimeCallback {
   private:
     // DATA
@@ -642,7 +735,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -717,6 +810,691 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING COMPRESSION
+        //
+        // Concerns:
+        // 1. Compression is initially disabled, and `enableCompression` and
+        //    `disableCompression` set the value of `isCompressionEnabled`.
+        //
+        // 2. Compression applies to the log files opened after it is
+        //    enabled, by `enableFileLogging` or by a rotation, and not to the
+        //    current log file.
+        //
+        // 3. A compressed log file decompresses to the text of the records
+        //    as written in the default mode, whether or not group commit is
+        //    enabled.
+        //
+        // 4. With group commit, a compressed log file is much smaller than
+        //    the uncompressed one.
+        //
+        // 5. A compressed log file whose last frame is incomplete can be
+        //    appended to, and the records of its complete frames and of the
+        //    appended frames are recovered.
+        //
+        // 6. The rotation-on-size limit applies to the size of the
+        //    compressed log file, and rotation opens a compressed log file.
+        //
+        // 7. No memory is leaked.
+        //
+        // Plan:
+        // 1. Enable and disable compression, and verify the value of
+        //    `isCompressionEnabled`.  (C-1)
+        //
+        // 2. Enable compression after enabling file logging, publish a
+        //    record, force a rotation, publish another record, and verify
+        //    that only the second file is compressed.  (C-2)
+        //
+        // 3. Publish the same records to observers writing compressed log
+        //    files, with and without group commit, and to an observer in the
+        //    default mode, and compare the decompressed and uncompressed log
+        //    files, and their sizes.  (C-3..4)
+        //
+        // 4. Write a compressed log file, remove its last 3 bytes, append to
+        //    it from another observer, and decompress it.  (C-5)
+        //
+        // 5. Configure rotation on size, publish records until a rotation
+        //    occurs, and verify the size of the rotated log file and that
+        //    both files decompress.  (C-6)
+        //
+        // 6. Use a test allocator for the observers, and verify that no
+        //    memory is outstanding at the end of each scope.  (C-7)
+        //
+        // Testing:
+        //   void disableCompression();
+        //   void enableCompression();
+        //   bool isCompressionEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING COMPRESSION"
+                          << "\n===================" << endl;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        const bsl::string        dirName(tempDirGuard.getTempDirName());
+
+        const bsls::TimeInterval k_NO_LATENCY;
+        const int                k_FRAME_SIZE =
+                    ball::LogFileCompressionUtil::k_MAX_FRAME_TEXT_LENGTH;
+
+        if (verbose) cout << "\tEnabling and disabling compression." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isCompressionEnabled());
+
+            mX.enableCompression();
+            ASSERT(true  == X.isCompressionEnabled());
+
+            mX.enableCompression();
+            ASSERT(true  == X.isCompressionEnabled());
+
+            mX.disableCompression();
+            ASSERT(false == X.isCompressionEnabled());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tApplying compression to new log files."
+                          << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "newFiles.%T");
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.enableCompression();
+
+            publishRecord(&mX, "uncompressed record");
+
+            bslmt::ThreadUtil::microSleep(0, 1);  // unique file names
+            mX.forceRotation();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+
+            publishRecord(&mX, "compressed record");
+
+            bsl::string currentName;
+            ASSERT(mX.isFileLoggingEnabled(&currentName));
+
+            const bsl::string rotated = readFile(cb.rotatedFileName());
+            ASSERT(bsl::string::npos != rotated.find("uncompressed record"));
+
+            bsl::string text;
+            ASSERT(0 == decompressFile(&text, currentName));
+            ASSERT(2 == bsl::count(text.begin(), text.end(), '\n'));
+            ASSERT(bsl::string::npos != text.find("compressed record"));
+
+            // The file starts with the magic number of a frame, rather than
+            // with the newline preceding the record.
+
+            const bsl::string raw = readFile(currentName);
+            ASSERT(0 < raw.size() && '\x89' == raw[0]);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tComparing with the default mode." << endl;
+        {
+            bsl::string groupName(dirName);
+            bsl::string singleName(dirName);
+            bsl::string defaultName(dirName);
+            bdls::PathUtil::appendRaw(&groupName,   "compareGroup.lz");
+            bdls::PathUtil::appendRaw(&singleName,  "compareSingle.lz");
+            bdls::PathUtil::appendRaw(&defaultName, "compareDefault");
+
+            Obj mX(&ta);
+            Obj mY(&ta);
+            Obj mZ(&ta);
+
+            mX.enableCompression();
+            mY.enableCompression();
+
+            ASSERT(0 == mX.enableFileLogging(groupName.c_str()));
+            ASSERT(0 == mY.enableFileLogging(singleName.c_str()));
+            ASSERT(0 == mZ.enableFileLogging(defaultName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_FRAME_SIZE, k_NO_LATENCY));
+
+            const bdlt::Datetime timestamp = bdlt::CurrentTime::utc();
+            ball::Context        context(ball::Transmission::e_PASSTHROUGH,
+                                         0,
+                                         1);
+
+            const int k_NUM_RECORDS = 2000;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                bsl::ostringstream message;
+                message << "order " << i * 7919 % 10007
+                        << " routed to venue " << i % 5;
+
+                ball::RecordAttributes attr(timestamp,
+                                            1,
+                                            2,
+                                            "FILENAME",
+                                            i,
+                                            "CATEGORY",
+                                            32,
+                                            message.str().c_str());
+                ball::Record           record(attr, ball::UserFields());
+
+                mX.publish(record, context);
+                mY.publish(record, context);
+                mZ.publish(record, context);
+            }
+
+            ASSERT(0 == mX.commitPendingRecords());
+
+            const bsl::string defaultContent = readFile(defaultName);
+
+            bsl::string groupContent;
+            bsl::string singleContent;
+
+            ASSERT(0 == decompressFile(&groupContent,  groupName));
+            ASSERT(0 == decompressFile(&singleContent, singleName));
+
+            ASSERT(defaultContent == groupContent);
+            ASSERT(defaultContent == singleContent);
+
+            const Int64 groupSize   = FsUtil::getFileSize(groupName);
+            const Int64 defaultSize = FsUtil::getFileSize(defaultName);
+
+            if (veryVerbose) { P_(defaultSize) P(groupSize) }
+
+            ASSERTV(groupSize, defaultSize, groupSize < defaultSize / 3);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tAppending after an incomplete frame."
+                          << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "append.lz");
+
+            {
+                Obj mX(&ta);
+
+                mX.enableCompression();
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                publishRecord(&mX, "first");
+                publishRecord(&mX, "lost");
+            }
+
+            // Simulate a crash while the last frame was being written.
+
+            const bsl::string content = readFile(fileName);
+            {
+                bsl::ofstream fs(fileName.c_str(),
+                                 bsl::ios::out
+                               | bsl::ios::binary
+                               | bsl::ios::trunc);
+                fs.write(content.data(), content.size() - 3);
+            }
+
+            {
+                Obj mX(&ta);
+
+                mX.enableCompression();
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+                ASSERT(0 == mX.enableGroupCommit(k_FRAME_SIZE,
+                                                 k_NO_LATENCY));
+
+                publishRecord(&mX, "second");
+                publishRecord(&mX, "third");
+            }
+
+            bsl::string text;
+            ASSERT(1 == decompressFile(&text, fileName));
+            ASSERT(6 == bsl::count(text.begin(), text.end(), '\n'));
+            ASSERT(bsl::string::npos != text.find("first"));
+            ASSERT(bsl::string::npos == text.find("lost"));
+            ASSERT(text.find("second") < text.find("third"));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRotating on size." << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "rotation.lz");
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+            mX.enableCompression();
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // Without group commit, each record is written, compressed, when
+            // it is published.
+
+            int numRecords = 0;
+            while (0 == cb.numInvocations() && numRecords < 1000) {
+                publishRecord(&mX, "a record that rotates the log file");
+                ++numRecords;
+            }
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            const Int64 rotatedSize = FsUtil::getFileSize(
+                                                        cb.rotatedFileName());
+            const Int64 recordSize  = rotatedSize / (numRecords - 1);
+
+            ASSERTV(rotatedSize, 1024 < rotatedSize);
+            ASSERTV(rotatedSize, recordSize,
+                    rotatedSize - recordSize <= 1024);
+
+            bsl::string text;
+            ASSERT(0 == decompressFile(&text, cb.rotatedFileName()));
+            ASSERTV(numRecords,
+                    2 * (numRecords - 1) ==
+                                   bsl::count(text.begin(), text.end(), '\n'));
+
+            ASSERT(0 == decompressFile(&text, fileName));
+            ASSERT(2 == bsl::count(text.begin(), text.end(), '\n'));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING GROUP COMMIT
+        //
+        // Concerns:
+        // 1. `enableGroupCommit` enables group commit and returns 0, and
+        //    returns a positive value with no effect if group commit is
+        //    already enabled.  `disableGroupCommit` disables group commit,
+        //    and has no effect if it is not enabled.
+        //
+        // 2. Records published in group-commit mode are written only once a
+        //    flush condition is met, in the order in which they were
+        //    published, and formatted as in the default mode.
+        //
+        // 3. Pending records are written once their size reaches
+        //    `maxPendingBytes`.
+        //
+        // 4. Pending records are written once the oldest of them has been
+        //    pending for `maxLatency`, without further records being
+        //    published.
+        //
+        // 5. Pending records are written by `commitPendingRecords`,
+        //    `disableGroupCommit`, `disableFileLogging`, and the destructor.
+        //
+        // 6. Records larger than a chunk of the record buffer are written
+        //    intact.
+        //
+        // 7. The size of the pending records counts toward the
+        //    rotation-on-size limit, and records pending when the log file is
+        //    rotated are written to the rotated log file.
+        //
+        // 8. Syncing the log file data does not affect the records written.
+        //
+        // 9. No memory is leaked.
+        //
+        // Plan:
+        // 1. Enable and disable group commit, verifying the status returned
+        //    and the value of `isGroupCommitEnabled`.  (C-1)
+        //
+        // 2. Publish the same records to an observer in group-commit mode and
+        //    to an observer in the default mode, verify that the group-commit
+        //    log file is empty until `commitPendingRecords` is called, and
+        //    that the two log files are then identical.  (C-2, 5)
+        //
+        // 3. Publish records of equal size until the log file is not empty,
+        //    and verify that it then holds the fewest records whose size
+        //    reaches `maxPendingBytes`.  (C-3)
+        //
+        // 4. Publish a record with a short `maxLatency`, and poll the size of
+        //    the log file until it is not empty.  (C-4)
+        //
+        // 5. Publish records, then call each of `disableGroupCommit`,
+        //    `disableFileLogging`, and the destructor, and verify the number
+        //    of lines in the log file.  (C-5)
+        //
+        // 6. Publish a record several chunks long, and search the log file
+        //    for its message.  (C-6)
+        //
+        // 7. Configure rotation on size, publish records, and verify the
+        //    size and contents of the rotated log file.  (C-7)
+        //
+        // 8. Enable group commit with a `syncInterval` of 1, and verify the
+        //    records written.  (C-8)
+        //
+        // 9. Use a test allocator for the observers, and verify that no
+        //    memory is outstanding at the end of each scope.  (C-9)
+        //
+        // Testing:
+        //   int commitPendingRecords();
+        //   void disableGroupCommit();
+        //   int enableGroupCommit(int, const bsls::TimeInterval&, int);
+        //   bool isGroupCommitEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING GROUP COMMIT"
+                          << "\n====================" << endl;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+        const bsl::string        dirName(tempDirGuard.getTempDirName());
+
+        const bsls::TimeInterval k_NO_LATENCY;
+        const int                k_LARGE = 1024 * 1024;
+
+        if (verbose) cout << "\tEnabling and disabling group commit." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            mX.disableGroupCommit();
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+            ASSERT(true  == X.isGroupCommitEnabled());
+
+            ASSERT(0 <  mX.enableGroupCommit(1, k_NO_LATENCY));
+            ASSERT(true  == X.isGroupCommitEnabled());
+
+            mX.disableGroupCommit();
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE,
+                                             bsls::TimeInterval(1.0),
+                                             4));
+            ASSERT(true  == X.isGroupCommitEnabled());
+
+            mX.disableGroupCommit();
+            ASSERT(false == X.isGroupCommitEnabled());
+
+            ASSERT(0 == mX.commitPendingRecords());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tComparing with the default mode." << endl;
+        {
+            bsl::string groupName(dirName);
+            bsl::string defaultName(dirName);
+            bdls::PathUtil::appendRaw(&groupName,   "compareGroup");
+            bdls::PathUtil::appendRaw(&defaultName, "compareDefault");
+
+            Obj mX(&ta);
+            Obj mY(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(groupName.c_str()));
+            ASSERT(0 == mY.enableFileLogging(defaultName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+
+            const bdlt::Datetime timestamp = bdlt::CurrentTime::utc();
+            ball::Context        context(ball::Transmission::e_PASSTHROUGH,
+                                         0,
+                                         1);
+
+            const int k_NUM_RECORDS = 50;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                bsl::ostringstream message;
+                message << "record " << i;
+
+                ball::RecordAttributes attr(timestamp,
+                                            1,
+                                            2,
+                                            "FILENAME",
+                                            i,
+                                            "CATEGORY",
+                                            32,
+                                            message.str().c_str());
+                ball::Record           record(attr, ball::UserFields());
+
+                mX.publish(record, context);
+                mY.publish(record, context);
+            }
+
+            ASSERT(0 == FsUtil::getFileSize(groupName.c_str()));
+
+            ASSERT(0 == mX.commitPendingRecords());
+
+            bsl::string groupContent;
+            bsl::string defaultContent;
+
+            ASSERT(2 * k_NUM_RECORDS ==
+                      readFileIntoString(__LINE__, groupName, groupContent));
+            ASSERT(2 * k_NUM_RECORDS ==
+                  readFileIntoString(__LINE__, defaultName, defaultContent));
+
+            ASSERT(defaultContent == groupContent);
+
+            // Nothing is pending after a commit.
+
+            ASSERT(0 == mX.commitPendingRecords());
+            ASSERT(2 * k_NUM_RECORDS == getNumLines(groupName.c_str()));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tWriting once `maxPendingBytes` is reached."
+                          << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "maxPendingBytes");
+
+            const int k_MAX_PENDING_BYTES = 1000;
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_MAX_PENDING_BYTES,
+                                             k_NO_LATENCY));
+
+            int numRecords = 0;
+            while (0 == FsUtil::getFileSize(fileName.c_str())
+                && numRecords < k_MAX_PENDING_BYTES) {
+                publishRecord(&mX, "group commit record");
+                ++numRecords;
+            }
+
+            const Int64 fileSize   = FsUtil::getFileSize(fileName.c_str());
+            const Int64 recordSize = fileSize / numRecords;
+
+            ASSERTV(numRecords, 1 < numRecords);
+            ASSERTV(fileSize, numRecords, 0 == fileSize % numRecords);
+            ASSERTV(fileSize, k_MAX_PENDING_BYTES <= fileSize);
+            ASSERTV(fileSize, recordSize,
+                    fileSize - recordSize < k_MAX_PENDING_BYTES);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tWriting once `maxLatency` is reached."
+                          << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "maxLatency");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE,
+                                             bsls::TimeInterval(0.01)));
+
+            publishRecord(&mX, "latency record");
+
+            for (int i = 0; i < 500; ++i) {
+                if (0 < FsUtil::getFileSize(fileName.c_str())) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+
+            ASSERT(2 == getNumLines(fileName.c_str()));
+
+            // The latency thread keeps serving subsequent records.
+
+            publishRecord(&mX, "latency record");
+
+            for (int i = 0; i < 500; ++i) {
+                if (4 == getNumLines(fileName.c_str())) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+
+            ASSERT(4 == getNumLines(fileName.c_str()));
+
+            mX.disableGroupCommit();
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE,
+                                             bsls::TimeInterval(0.01)));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tWriting pending records on configuration "
+                             "changes and destruction." << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "pending");
+
+            {
+                Obj mX(&ta);
+
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+                ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+
+                publishRecord(&mX, "pending 1");
+                ASSERT(0 == getNumLines(fileName.c_str()));
+
+                mX.disableGroupCommit();
+                ASSERT(2 == getNumLines(fileName.c_str()));
+
+                // Records are written immediately once group commit is
+                // disabled.
+
+                publishRecord(&mX, "pending 2");
+                ASSERT(4 == getNumLines(fileName.c_str()));
+
+                ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+
+                publishRecord(&mX, "pending 3");
+                ASSERT(4 == getNumLines(fileName.c_str()));
+
+                mX.disableFileLogging();
+                ASSERT(6 == getNumLines(fileName.c_str()));
+
+                // Records published while file logging is disabled are
+                // dropped.
+
+                publishRecord(&mX, "dropped");
+
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                publishRecord(&mX, "pending 4");
+                ASSERT(6 == getNumLines(fileName.c_str()));
+            }
+            ASSERT(8 == getNumLines(fileName.c_str()));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tWriting records spanning several chunks."
+                          << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "largeRecord");
+
+            const bsl::size_t k_MESSAGE_SIZE =
+                          3 * ball::FileObserver2_RecordBuffer::k_CHUNK_SIZE;
+
+            bsl::string message(k_MESSAGE_SIZE, 'x', &ta);
+            message[0]                  = '<';
+            message[k_MESSAGE_SIZE - 1] = '>';
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+
+            publishRecord(&mX, "small");
+            publishRecord(&mX, message.c_str());
+            publishRecord(&mX, "small");
+
+            ASSERT(0 == mX.commitPendingRecords());
+
+            bsl::string content;
+            ASSERT(6 == readFileIntoString(__LINE__, fileName, content));
+            ASSERT(bsl::string::npos != content.find(message));
+            ASSERT(content.find("small") < content.find(message));
+            ASSERT(content.rfind("small") > content.find(message));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRotating on size." << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "rotation");
+
+            const int k_NUM_RECORDS = 12;
+
+            bsl::string message(100, 'r', &ta);
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(k_LARGE, k_NO_LATENCY));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                publishRecord(&mX, message.c_str());
+            }
+
+            ASSERT(0 == mX.commitPendingRecords());
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            const bsl::string rotatedName = cb.rotatedFileName();
+            ASSERT(rotatedName != fileName);
+
+            const Int64 rotatedSize = FsUtil::getFileSize(rotatedName);
+            const int   rotatedLines = getNumLines(rotatedName.c_str());
+            const int   lines        = getNumLines(fileName.c_str());
+
+            ASSERTV(rotatedLines, 0 < rotatedLines);
+            ASSERTV(rotatedLines, lines,
+                    2 * k_NUM_RECORDS == rotatedLines + lines);
+
+            const Int64 recordSize = rotatedSize / (rotatedLines / 2);
+
+            ASSERTV(rotatedSize, 1024 < rotatedSize);
+            ASSERTV(rotatedSize, recordSize,
+                    rotatedSize - recordSize <= 1024);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tSyncing the log file data." << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "sync");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableGroupCommit(200, k_NO_LATENCY, 1));
+
+            const int k_NUM_RECORDS = 20;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                publishRecord(&mX, "synced record");
+            }
+            ASSERT(0 == mX.commitPendingRecords());
+
+            ASSERT(2 * k_NUM_RECORDS == getNumLines(fileName.c_str()));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -3739,6 +4517,107 @@ int main(int argc, char *argv[])
         // Deregister here as we used local allocator for the observer.
         ASSERT(0 == manager.deregisterObserver("testObserver"));
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // GROUP COMMIT BENCHMARK
+        //
+        // Concern:
+        // 1. Report the throughput and the tail latency of `publish` in the
+        //    default mode and in group-commit mode.
+        //
+        // Plan:
+        // 1. For each configuration, have several threads publish records to
+        //    a file observer, timing each call to `publish`, and report the
+        //    number of records published per second and the 99th percentile
+        //    of the publication latency.  The number of threads and of records
+        //    per thread may be specified as the second and third arguments.
+        //
+        // Testing:
+        //   GROUP COMMIT BENCHMARK
+        // --------------------------------------------------------------------
+
+        cout << "\nGROUP COMMIT BENCHMARK"
+             << "\n======================" << endl;
+
+        const int numThreads = argc > 2 ? bsl::atoi(argv[2]) : 4;
+        const int numRecords = argc > 3 ? bsl::atoi(argv[3]) : 100000;
+
+        struct Configuration {
+            const char *d_name;
+            bool        d_isGroupCommit;
+            int         d_maxPendingBytes;
+            double      d_maxLatency;       // in seconds
+            int         d_syncInterval;
+        } CONFIGURATIONS[] = {
+            { "default",                 false,          0, 0.0,    0 },
+            { "group 64K",               true,   64 * 1024, 0.0,    0 },
+            { "group 64K/10ms",          true,   64 * 1024, 0.01,   0 },
+            { "group 1M/10ms",           true, 1024 * 1024, 0.01,   0 },
+            { "group 64K/10ms sync/16",  true,   64 * 1024, 0.01,  16 },
+        };
+        const int NUM_CONFIGURATIONS = sizeof CONFIGURATIONS
+                                     / sizeof *CONFIGURATIONS;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_");
+
+        for (int ci = 0; ci < NUM_CONFIGURATIONS; ++ci) {
+            const Configuration& CONFIG = CONFIGURATIONS[ci];
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "benchmark");
+
+            Obj mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            if (CONFIG.d_isGroupCommit) {
+                ASSERT(0 == mX.enableGroupCommit(
+                                     CONFIG.d_maxPendingBytes,
+                                     bsls::TimeInterval(CONFIG.d_maxLatency),
+                                     CONFIG.d_syncInterval));
+            }
+
+            bsl::vector<bsl::vector<Int64> >       latencies(numThreads);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+            const Int64 start = bsls::TimeUtil::getTimer();
+
+            for (int t = 0; t < numThreads; ++t) {
+                PublishBenchmarkThread thread(&mX, &latencies[t], numRecords);
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[t], thread));
+            }
+            for (int t = 0; t < numThreads; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+            }
+
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            mX.disableFileLogging();
+
+            bsl::vector<Int64> allLatencies;
+            for (int t = 0; t < numThreads; ++t) {
+                allLatencies.insert(allLatencies.end(),
+                                    latencies[t].begin(),
+                                    latencies[t].end());
+            }
+            bsl::sort(allLatencies.begin(), allLatencies.end());
+
+            const double totalRecords = static_cast<double>(
+                                                         allLatencies.size());
+            const bsl::size_t p99Index = allLatencies.size() * 99 / 100;
+
+            cout << bsl::setw(24) << bsl::left << CONFIG.d_name
+                 << bsl::right
+                 << " records/s: " << bsl::setw(10)
+                 << static_cast<Int64>(totalRecords * 1e9
+                                              / static_cast<double>(elapsed))
+                 << "  p99 publish (ns): " << bsl::setw(8)
+                 << allLatencies[p99Index]
+                 << endl;
+
+            ASSERT(0 == FsUtil::remove(fileName));
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
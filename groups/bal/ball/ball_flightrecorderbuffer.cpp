@@ -0,0 +1,339 @@
+// ball_flightrecorderbuffer.cpp                                      -*-C++-*-
+#include <ball_flightrecorderbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_flightrecorderbuffer_cpp,"$Id$ $CSID$")
+
+#include <ball_recordattributes.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef FlightRecorderBuffer_Ring::Entry Entry;
+
+/// Return `true` if the specified `lhs` entry was pushed before the
+/// specified `rhs` entry of the same ring, and `false` otherwise.
+bool isPushedBefore(const Entry& lhs, const Entry& rhs)
+{
+    return lhs.first < rhs.first;
+}
+
+/// Return `true` if the timestamp of the specified `lhs` record precedes the
+/// timestamp of the specified `rhs` record, and `false` otherwise.
+bool isOlder(const bsl::shared_ptr<Record>& lhs,
+             const bsl::shared_ptr<Record>& rhs)
+{
+    return lhs->fixedFields().timestamp() < rhs->fixedFields().timestamp();
+}
+
+}  // close unnamed namespace
+
+                      // -------------------------------
+                      // class FlightRecorderBuffer_Ring
+                      // -------------------------------
+
+// CREATORS
+FlightRecorderBuffer_Ring::FlightRecorderBuffer_Ring(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_slots(basicAllocator)
+, d_next(0)
+, d_nextSequenceNumber(0)
+, d_numRecords(0)
+, d_isReleased(false)
+{
+    BSLS_ASSERT(0 < capacity);
+
+    Slot slot;
+    bsls::AtomicOperations::initInt(&slot.d_isBusy, 0);
+    slot.d_sequenceNumber = 0;
+
+    d_slots.resize(capacity, slot);
+}
+
+// MANIPULATORS
+void FlightRecorderBuffer_Ring::removeRecords(bsl::vector<Entry> *entries)
+{
+    BSLS_ASSERT(entries);
+
+    typedef bsls::AtomicOperations AtomicOps;
+
+    // Reserve the worst case, so that no memory is allocated while a slot is
+    // claimed.
+
+    entries->reserve(entries->size() + d_slots.size());
+
+    for (bsl::size_t i = 0; i < d_slots.size(); ++i) {
+        Slot& slot = d_slots[i];
+
+        while (0 != AtomicOps::testAndSwapIntAcqRel(&slot.d_isBusy, 0, 1)) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        if (slot.d_record) {
+            entries->push_back(Entry(slot.d_sequenceNumber,
+                                     bsl::shared_ptr<Record>()));
+            entries->back().second.swap(slot.d_record);
+            d_numRecords.addRelaxed(-1);
+        }
+
+        AtomicOps::setIntRelease(&slot.d_isBusy, 0);
+    }
+}
+
+                         // --------------------------
+                         // class FlightRecorderBuffer
+                         // --------------------------
+
+// PRIVATE CLASS METHODS
+void FlightRecorderBuffer::releaseRing(void *ring)
+{
+    static_cast<Ring *>(ring)->release();
+}
+
+// PRIVATE MANIPULATORS
+FlightRecorderBuffer::Ring *FlightRecorderBuffer::acquireRing()
+{
+    Ring *ring = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+
+        for (bsl::size_t i = 0; i < d_rings.size(); ++i) {
+            if (d_rings[i]->isReleased()) {
+                ring = d_rings[i];
+                ring->acquire();
+                break;
+            }
+        }
+
+        if (0 == ring) {
+            d_rings.reserve(d_rings.size() + 1);
+
+            ring = new (*d_allocator_p) Ring(d_recordsPerThread,
+                                             d_allocator_p);
+            d_rings.push_back(ring);
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_ringKey, ring);
+    return ring;
+}
+
+void FlightRecorderBuffer::takeSnapshot()
+{
+    bsl::vector<Ring *> rings(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+
+        rings = d_rings;
+    }
+
+    // Remove the records of each ring in turn, restore the order in which
+    // they were pushed, and merge them by timestamp with the records of the
+    // rings already processed.  Note that `bsl::merge` preserves the order
+    // of the records of each ring even if their timestamps are not
+    // monotonic.
+
+    bsl::vector<Entry>                   entries(d_allocator_p);
+    bsl::vector<bsl::shared_ptr<Record> > ringRecords(d_allocator_p);
+    bsl::vector<bsl::shared_ptr<Record> > merged(d_allocator_p);
+    bsl::vector<bsl::shared_ptr<Record> > result(d_allocator_p);
+
+    for (bsl::size_t i = 0; i < rings.size(); ++i) {
+        entries.clear();
+        rings[i]->removeRecords(&entries);
+        if (entries.empty()) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::sort(entries.begin(), entries.end(), &isPushedBefore);
+
+        ringRecords.clear();
+        ringRecords.reserve(entries.size());
+        for (bsl::size_t j = 0; j < entries.size(); ++j) {
+            ringRecords.push_back(bsl::shared_ptr<Record>());
+            ringRecords.back().swap(entries[j].second);
+        }
+
+        result.clear();
+        result.reserve(merged.size() + ringRecords.size());
+        bsl::merge(merged.begin(),
+                   merged.end(),
+                   ringRecords.begin(),
+                   ringRecords.end(),
+                   bsl::back_inserter(result),
+                   &isOlder);
+        merged.swap(result);
+    }
+
+    d_snapshot.insert(d_snapshot.end(), merged.begin(), merged.end());
+}
+
+// CREATORS
+FlightRecorderBuffer::FlightRecorderBuffer(int               recordsPerThread,
+                                           bslma::Allocator *basicAllocator)
+: d_recordsPerThread(recordsPerThread)
+, d_rings(basicAllocator)
+, d_snapshot(basicAllocator)
+, d_sequenceDepth(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < recordsPerThread);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_ringKey, &releaseRing);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+}
+
+FlightRecorderBuffer::~FlightRecorderBuffer()
+{
+    bslmt::ThreadUtil::deleteKey(d_ringKey);
+
+    removeAll();
+
+    for (bsl::size_t i = 0; i < d_rings.size(); ++i) {
+        d_allocator_p->deleteObject(d_rings[i]);
+    }
+}
+
+// MANIPULATORS
+void FlightRecorderBuffer::beginSequence()
+{
+    d_mutex.lock();
+
+    if (0 == d_sequenceDepth++) {
+        takeSnapshot();
+    }
+}
+
+void FlightRecorderBuffer::endSequence()
+{
+    BSLS_ASSERT(0 < d_sequenceDepth);
+
+    --d_sequenceDepth;
+    d_mutex.unlock();
+}
+
+void FlightRecorderBuffer::popBack()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    BSLS_ASSERT(!d_snapshot.empty());
+
+    d_snapshot.pop_back();
+}
+
+void FlightRecorderBuffer::popFront()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    BSLS_ASSERT(!d_snapshot.empty());
+
+    d_snapshot.pop_front();
+}
+
+int FlightRecorderBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    d_snapshot.push_front(handle);
+    return 0;
+}
+
+void FlightRecorderBuffer::removeAll()
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    d_snapshot.clear();
+
+    bsl::vector<Ring *> rings(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> ringsGuard(&d_ringsMutex);
+
+        rings = d_rings;
+    }
+
+    bsl::vector<Entry> entries(d_allocator_p);
+    for (bsl::size_t i = 0; i < rings.size(); ++i) {
+        rings[i]->removeRecords(&entries);
+        entries.clear();
+    }
+}
+
+// ACCESSORS
+const bsl::shared_ptr<Record>& FlightRecorderBuffer::back() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    BSLS_ASSERT(!d_snapshot.empty());
+
+    return d_snapshot.back();
+}
+
+const bsl::shared_ptr<Record>& FlightRecorderBuffer::front() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    BSLS_ASSERT(!d_snapshot.empty());
+
+    return d_snapshot.front();
+}
+
+int FlightRecorderBuffer::length() const
+{
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
+    int numRecords = static_cast<int>(d_snapshot.size());
+
+    if (0 < d_sequenceDepth) {
+        // The buffer is locked by the calling thread, which owns `d_mutex`.
+
+        return numRecords;                                            // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> ringsGuard(&d_ringsMutex);
+
+    for (bsl::size_t i = 0; i < d_rings.size(); ++i) {
+        numRecords += d_rings[i]->numRecords();
+    }
+    return numRecords;
+}
+
+int FlightRecorderBuffer::numThreadBuffers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+
+    return static_cast<int>(d_rings.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
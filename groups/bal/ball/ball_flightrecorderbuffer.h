@@ -0,0 +1,607 @@
+// ball_flightrecorderbuffer.h                                        -*-C++-*-
+#ifndef INCLUDED_BALL_FLIGHTRECORDERBUFFER
+#define INCLUDED_BALL_FLIGHTRECORDERBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record buffer of per-thread rings with lock-free pushes.
+//
+//@CLASSES:
+//  ball::FlightRecorderBuffer: record buffer of per-thread overwriting rings
+//
+//@SEE_ALSO: ball_recordbuffer, ball_fixedsizerecordbuffer
+//
+//@DESCRIPTION: This component provides a concrete thread-safe implementation
+// of the `ball::RecordBuffer` protocol, `ball::FlightRecorderBuffer`,
+// intended to hold the records of a logger configured for trigger-based
+// publication (i.e., a "flight recorder"):
+// ```
+//              ( ball::FlightRecorderBuffer )
+//                           |              ctor
+//                           V
+//                 ( ball::RecordBuffer )
+//                                          dtor
+//                                          beginSequence
+//                                          endSequence
+//                                          popBack
+//                                          popFront
+//                                          pushBack
+//                                          pushFront
+//                                          removeAll
+//                                          length
+//                                          back
+//                                          front
+// ```
+// A logger adds every record whose severity is at least as severe as the
+// *Record* threshold level of its category to its record buffer, but
+// publishes (and removes) the records in the buffer only when a record at the
+// *Trigger* (or *Trigger-All*) threshold level is logged, which is typically
+// rare.  With `ball::FixedSizeRecordBuffer`, each `pushBack` locks a mutex
+// shared by all the threads using the buffer, which becomes heavily contended
+// when records are logged at a high rate.  `ball::FlightRecorderBuffer`
+// avoids this contention: each thread pushing records has a ring of record
+// handles of its own, of a capacity specified at construction, and
+// `pushBack` stores the handle in the ring of the calling thread without
+// locking, overwriting (and so releasing) the oldest record in the ring if it
+// is full.
+//
+// The record handles in the rings are not accessible through the
+// `ball::RecordBuffer` interface.  Instead, `beginSequence` (which locks the
+// buffer, as for other record buffers) moves the records from every ring to a
+// *snapshot*: a sequence, ordered by timestamp, of the records that were in
+// the buffer when `beginSequence` was called.  `length`, `back`, `front`,
+// `popBack`, and `popFront` then operate on the snapshot, while other threads
+// continue to push records into their rings.  Therefore, during a sequence
+// (i.e., between the calls to `beginSequence` and `endSequence`), records
+// pushed by `pushBack` are not visible, even to the thread that locked the
+// buffer; this ensures that publishing the records of a trigger cannot be
+// prolonged indefinitely by records logged during their publication.
+// Outside a sequence, `length` returns the number of records in the rings
+// and in the snapshot.
+//
+///Ordering of Records
+///- - - - - - - - - -
+// The records pushed by each thread are ordered in the snapshot in the order
+// in which they were pushed.  The records of different threads are ordered by
+// their timestamps (see `ball::RecordAttributes::timestamp`), records having
+// equal timestamps being ordered arbitrarily.  Records inserted by
+// `pushFront` precede all the records in the snapshot.
+//
+///Thread Safety and Lock-Freedom
+/// - - - - - - - - - - - - - - -
+// `ball::FlightRecorderBuffer` is thread-safe, except that, as for other
+// record buffers, `back`, `front`, `popBack`, and `popFront` must be called
+// by a thread that has locked the buffer by calling `beginSequence`.
+//
+// `pushBack` does not lock a mutex (other than the first time it is called
+// by a thread, when the ring of that thread is created), and does not wait
+// for any other thread: if the slot of the ring into which the record would
+// be stored is being emptied by `beginSequence` or `removeAll` at the time of
+// the call, the record is discarded and a non-zero value is returned.
+// `beginSequence` and `removeAll` empty each slot of each ring in turn,
+// waiting (briefly) for any `pushBack` on that slot to complete.
+//
+// The ring of a thread is retained when the thread exits, and is reused by
+// the next thread to push a record, so that the memory used by the buffer is
+// proportional to the maximum number of threads concurrently pushing
+// records, rather than to the number of threads ever doing so.  The records
+// of the exited thread remaining in a reused ring are retained until they are
+// overwritten by the records of the thread reusing it.  Note that each
+// `ball::FlightRecorderBuffer` allocates one thread-specific storage key (see
+// `bslmt::ThreadUtil::createKey`), of which a process has a limited number.
+//
+///Memory Use
+/// - - - - -
+// Unlike `ball::FixedSizeRecordBuffer`, whose capacity is a number of bytes,
+// the capacity of a `ball::FlightRecorderBuffer` is a number of records per
+// thread.  The rings are allocated when created, and the buffer allocates no
+// memory when pushing a record.  However, each record in a ring is an object
+// obtained from the record pool of the logger using the buffer, and so the
+// number of records retained by that pool grows to the total capacity of the
+// rings.  `beginSequence` allocates the snapshot.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// In the following example we demonstrate the use of a flight-recorder
+// buffer by several threads, and the retrieval of the records it holds.
+//
+// First, we create a buffer retaining the last 4 records of each thread:
+// ```
+// ball::FlightRecorderBuffer buffer(4);
+// ```
+// Then, we define a function that pushes a number of records into the
+// buffer, and run it in two threads, each pushing 10 records.  The threads
+// wait on a barrier before exiting, so that each pushes its records into a
+// ring of its own (see {Thread Safety and Lock-Freedom}):
+// ```
+// struct Pusher {
+//     ball::FlightRecorderBuffer *d_buffer_p;
+//     bslmt::Barrier             *d_barrier_p;
+//     int                         d_id;
+//
+//     void operator()() const
+//     {
+//         for (int i = 0; i < 10; ++i) {
+//             bsl::shared_ptr<ball::Record> record =
+//                                        bsl::make_shared<ball::Record>();
+//             bsl::ostringstream message;
+//             message << "thread " << d_id << " record " << i;
+//             record->fixedFields().setMessage(message.str().c_str());
+//             record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+//
+//             d_buffer_p->pushBack(record);
+//         }
+//         d_barrier_p->wait();
+//     }
+// };
+//
+// bslmt::Barrier            barrier(2);
+// bslmt::ThreadUtil::Handle handles[2];
+// for (int id = 0; id < 2; ++id) {
+//     Pusher pusher = { &buffer, &barrier, id };
+//     bslmt::ThreadUtil::create(&handles[id], pusher);
+// }
+// for (int id = 0; id < 2; ++id) {
+//     bslmt::ThreadUtil::join(handles[id]);
+// }
+// ```
+// Now, since each ring retains only the last 4 records of its thread, the
+// buffer holds 8 records:
+// ```
+// assert(8 == buffer.length());
+// assert(2 == buffer.numThreadBuffers());
+// ```
+// Finally, we lock the buffer, and print and remove the records, oldest
+// first:
+// ```
+// buffer.beginSequence();
+// while (buffer.length()) {
+//     bsl::cout << buffer.front()->fixedFields().messageRef() << bsl::endl;
+//     buffer.popFront();
+// }
+// buffer.endSequence();
+// assert(0 == buffer.length());
+// ```
+// The output includes "thread 0 record 6" to "thread 0 record 9" and "thread
+// 1 record 6" to "thread 1 record 9", the records of each thread in that
+// order.
+//
+///Example 2: Using a Flight Recorder with the Logger Manager
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The default logger of the logger manager singleton uses a
+// `ball::FlightRecorderBuffer` if the logger manager is configured with a
+// non-zero flight-recorder capacity (see
+// `ball::LoggerManagerConfiguration::setFlightRecorderCapacityIfValid`):
+// ```
+// ball::LoggerManagerConfiguration configuration;
+// configuration.setFlightRecorderCapacityIfValid(1000);
+// configuration.setDefaultThresholdLevelsIfValid(
+//                                     ball::Severity::e_TRACE,   // record
+//                                     ball::Severity::e_WARN,    // pass
+//                                     ball::Severity::e_ERROR,   // trigger
+//                                     ball::Severity::e_FATAL);  // all
+//
+// ball::LoggerManagerScopedGuard guard(configuration);
+// ```
+// Each thread logging through the default logger then retains its last 1000
+// records at `e_TRACE` severity or above, which are published when a record
+// of `e_ERROR` severity is logged by that thread.
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_recordbuffer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_recursivemutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_memory.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                      // ===============================
+                      // class FlightRecorderBuffer_Ring
+                      // ===============================
+
+/// PRIVATE CLASS.  For use by the `ball::FlightRecorderBuffer`
+/// implementation only.  This class holds the ring of record handles of one
+/// pushing thread.  `pushBack` may be called only by the thread owning the
+/// ring, and `removeRecords` by any thread, concurrently with `pushBack`,
+/// provided that calls to `removeRecords` are serialized.
+class FlightRecorderBuffer_Ring {
+
+  public:
+    // PUBLIC TYPES
+
+    /// A record handle removed from the ring, and its sequence number in the
+    /// ring.
+    typedef bsl::pair<bsls::Types::Uint64, bsl::shared_ptr<Record> > Entry;
+
+  private:
+    // PRIVATE TYPES
+
+    /// A slot of the ring, guarded by a flag that is set while the slot is
+    /// accessed.
+    struct Slot {
+        bsls::AtomicOperations::AtomicTypes::Int d_isBusy;
+                                                     // 1 while the slot is
+                                                     // accessed, 0 otherwise
+
+        bsls::Types::Uint64                      d_sequenceNumber;
+                                                     // sequence number of
+                                                     // `d_record`
+
+        bsl::shared_ptr<Record>                  d_record;
+                                                     // held record handle, or
+                                                     // empty
+    };
+
+    // DATA
+    bsl::vector<Slot>     d_slots;               // the ring
+
+    int                   d_next;                // index of the slot that
+                                                 // the next record is stored
+                                                 // into (owner only)
+
+    bsls::Types::Uint64   d_nextSequenceNumber;  // sequence number of the
+                                                 // next record (owner only)
+
+    bsls::AtomicInt       d_numRecords;          // number of non-empty slots
+
+    bsls::AtomicBool      d_isReleased;          // `true` if the owning
+                                                 // thread has exited
+
+    // NOT IMPLEMENTED
+    FlightRecorderBuffer_Ring(const FlightRecorderBuffer_Ring&);
+    FlightRecorderBuffer_Ring& operator=(const FlightRecorderBuffer_Ring&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlightRecorderBuffer_Ring,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty ring holding at most the specified `capacity` record
+    /// handles, owned by the calling thread.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < capacity`.
+    explicit FlightRecorderBuffer_Ring(int               capacity,
+                                       bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Mark this ring as owned by the calling thread.  The behavior is
+    /// undefined unless this ring has been released.
+    void acquire();
+
+    /// Store the specified `handle` in this ring, replacing the oldest
+    /// record handle if the ring is full.  Return 0 on success, and a
+    /// non-zero value, with no effect, if the slot into which `handle`
+    /// would be stored is being emptied by `removeRecords`.  The behavior
+    /// is undefined unless this method is called by the owner of this ring.
+    int pushBack(const bsl::shared_ptr<Record>& handle);
+
+    /// Mark this ring as not being owned by any thread.
+    void release();
+
+    /// Move each record handle held by this ring, with its sequence number,
+    /// to the back of the specified `entries`, in no particular order.
+    void removeRecords(bsl::vector<Entry> *entries);
+
+    // ACCESSORS
+
+    /// Return the maximum number of record handles held by this ring.
+    int capacity() const;
+
+    /// Return `true` if this ring is not owned by any thread, and `false`
+    /// otherwise.
+    bool isReleased() const;
+
+    /// Return the number of record handles held by this ring.
+    int numRecords() const;
+};
+
+                         // ==========================
+                         // class FlightRecorderBuffer
+                         // ==========================
+
+/// This class provides a concrete, thread-safe implementation of the
+/// `RecordBuffer` protocol holding, for each thread pushing records, the
+/// most recent records pushed by that thread, up to a capacity specified at
+/// construction.  `pushBack` does not lock, and `beginSequence` takes a
+/// snapshot of the records in the buffer, on which `length`, `back`,
+/// `front`, `popBack`, and `popFront` operate until `endSequence` is
+/// called.  The class is thread-safe, except that `back`, `front`,
+/// `popBack`, and `popFront` must be called after locking the buffer by
+/// invoking `beginSequence`.
+class FlightRecorderBuffer : public RecordBuffer {
+
+    // PRIVATE TYPES
+    typedef FlightRecorderBuffer_Ring Ring;
+
+    // DATA
+    int                                  d_recordsPerThread;
+                                                     // capacity of each ring
+
+    bslmt::ThreadUtil::Key               d_ringKey;  // key of the ring of the
+                                                     // calling thread
+
+    bsl::vector<Ring *>                  d_rings;    // rings of the threads
+                                                     // (owned)
+
+    mutable bslmt::Mutex                 d_ringsMutex;
+                                                     // guards `d_rings`
+
+    bsl::deque<bsl::shared_ptr<Record> > d_snapshot; // records removed from
+                                                     // the rings, oldest first
+
+    int                                  d_sequenceDepth;
+                                                     // number of calls to
+                                                     // `beginSequence` not yet
+                                                     // matched by
+                                                     // `endSequence`
+
+    mutable bslmt::RecursiveMutex        d_mutex;    // guards `d_snapshot` and
+                                                     // `d_sequenceDepth`
+
+    bslma::Allocator                    *d_allocator_p;
+                                                     // memory allocator (held,
+                                                     // not owned)
+
+    // NOT IMPLEMENTED
+    FlightRecorderBuffer(const FlightRecorderBuffer&);
+    FlightRecorderBuffer& operator=(const FlightRecorderBuffer&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Release the specified `ring`.  This function is called on exit of
+    /// the thread owning `ring`.
+    static void releaseRing(void *ring);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the ring of the calling thread, after reusing a released ring,
+    /// or creating a new ring, if the calling thread has none.
+    Ring *acquireRing();
+
+    /// Move the record handles held by the rings to the back of the
+    /// snapshot.  The behavior is undefined unless `d_mutex` is locked.
+    void takeSnapshot();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlightRecorderBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a flight-recorder buffer retaining, for each thread pushing
+    /// records, at most the specified `recordsPerThread` most recent record
+    /// handles pushed by that thread.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < recordsPerThread`.
+    explicit FlightRecorderBuffer(int               recordsPerThread,
+                                  bslma::Allocator *basicAllocator = 0);
+
+    /// Remove all record handles from this record buffer and destroy this
+    /// record buffer.  The behavior is undefined unless no other thread is
+    /// accessing this buffer.
+    ~FlightRecorderBuffer() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// *Lock* this record buffer so that a sequence of method invocations
+    /// on this record buffer can occur uninterrupted by other threads, and,
+    /// unless the calling thread has already locked this buffer, move the
+    /// record handles pushed by all threads to the snapshot on which the
+    /// other methods operate while the buffer is locked.  The buffer will
+    /// remain *locked* until `endSequence` is called (as many times as
+    /// `beginSequence` was called).  Note that `pushBack` is not blocked by
+    /// the lock, and that the record handles it pushes while the buffer is
+    /// locked are not part of the snapshot.
+    void beginSequence() BSLS_KEYWORD_OVERRIDE;
+
+    /// *Unlock* this record buffer, thus allowing other threads to access
+    /// it.  The behavior is undefined unless the buffer is already *locked*
+    /// by `beginSequence`.
+    void endSequence() BSLS_KEYWORD_OVERRIDE;
+
+    /// Remove from this record buffer the record handle positioned at the
+    /// back end of the snapshot.  The behavior is undefined unless this
+    /// record buffer has been locked by the `beginSequence` method and
+    /// `0 < length()`.
+    void popBack() BSLS_KEYWORD_OVERRIDE;
+
+    /// Remove from this record buffer the record handle positioned at the
+    /// front end of the snapshot.  The behavior is undefined unless this
+    /// record buffer has been locked by the `beginSequence` method and
+    /// `0 < length()`.
+    void popFront() BSLS_KEYWORD_OVERRIDE;
+
+    /// Store the specified `handle` in the ring of the calling thread,
+    /// replacing the oldest record handle in the ring if it is full.  Return
+    /// 0 on success, and a non-zero value if the record is discarded because
+    /// its slot in the ring is being emptied by another thread.
+    int pushBack(const bsl::shared_ptr<Record>& handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Insert the specified `handle` at the front end of the snapshot of
+    /// this record buffer.  Return 0.  Note that, unlike `pushBack`, this
+    /// method locks this buffer, and that the number of records inserted by
+    /// this method is not limited.
+    int pushFront(const bsl::shared_ptr<Record>& handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Remove all record handles stored in this record buffer.
+    void removeAll() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return a reference of the shared pointer referring to the record
+    /// positioned at the back end of the snapshot of this record buffer.
+    /// The behavior is undefined unless this record buffer has been locked
+    /// by the `beginSequence` method and `0 < length()`.
+    const bsl::shared_ptr<Record>& back() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a reference of the shared pointer referring to the record
+    /// positioned at the front end of the snapshot of this record buffer.
+    /// The behavior is undefined unless this record buffer has been locked
+    /// by the `beginSequence` method and `0 < length()`.
+    const bsl::shared_ptr<Record>& front() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of record handles in the snapshot of this record
+    /// buffer if it is locked by the calling thread, and the number of
+    /// record handles in this record buffer otherwise.  Note that, in the
+    /// latter case, the value returned may be out of date by the time it is
+    /// returned, if other threads are pushing records.
+    int length() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of per-thread rings allocated by this buffer.  Note
+    /// that this is the maximum number of threads that have concurrently
+    /// pushed records into this buffer.
+    int numThreadBuffers() const;
+
+    /// Return the maximum number of record handles retained for each thread
+    /// pushing records into this buffer.
+    int recordsPerThread() const;
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class FlightRecorderBuffer_Ring
+                      // -------------------------------
+
+// MANIPULATORS
+inline
+void FlightRecorderBuffer_Ring::acquire()
+{
+    BSLS_ASSERT(d_isReleased.loadAcquire());
+
+    d_isReleased.storeRelease(false);
+}
+
+inline
+int FlightRecorderBuffer_Ring::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    Slot& slot = d_slots[d_next];
+
+    if (0 != AtomicOps::testAndSwapIntAcqRel(&slot.d_isBusy, 0, 1)) {
+        return -1;                                                    // RETURN
+    }
+
+    // Release the overwritten record only after releasing the slot.
+
+    bsl::shared_ptr<Record> overwritten(handle);
+
+    overwritten.swap(slot.d_record);
+    slot.d_sequenceNumber = d_nextSequenceNumber;
+    if (!overwritten) {
+        d_numRecords.addRelaxed(1);
+    }
+
+    AtomicOps::setIntRelease(&slot.d_isBusy, 0);
+
+    ++d_nextSequenceNumber;
+    if (static_cast<int>(d_slots.size()) == ++d_next) {
+        d_next = 0;
+    }
+    return 0;
+}
+
+inline
+void FlightRecorderBuffer_Ring::release()
+{
+    d_isReleased.storeRelease(true);
+}
+
+// ACCESSORS
+inline
+int FlightRecorderBuffer_Ring::capacity() const
+{
+    return static_cast<int>(d_slots.size());
+}
+
+inline
+bool FlightRecorderBuffer_Ring::isReleased() const
+{
+    return d_isReleased.loadAcquire();
+}
+
+inline
+int FlightRecorderBuffer_Ring::numRecords() const
+{
+    return d_numRecords.loadRelaxed();
+}
+
+                         // --------------------------
+                         // class FlightRecorderBuffer
+                         // --------------------------
+
+// MANIPULATORS
+inline
+int FlightRecorderBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    Ring *ring = static_cast<Ring *>(
+                                    bslmt::ThreadUtil::getSpecific(d_ringKey));
+
+    if (0 == ring) {
+        ring = acquireRing();
+    }
+
+    return ring->pushBack(handle);
+}
+
+// ACCESSORS
+inline
+int FlightRecorderBuffer::recordsPerThread() const
+{
+    return d_recordsPerThread;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
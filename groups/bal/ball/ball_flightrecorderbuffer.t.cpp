@@ -0,0 +1,1106 @@
+// ball_flightrecorderbuffer.t.cpp                                    -*-C++-*-
+#include <ball_flightrecorderbuffer.h>
+
+#include <ball_fixedsizerecordbuffer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements the `ball::RecordBuffer` protocol with
+// a ring of record handles per pushing thread, and a snapshot of the records
+// of all the rings taken by `beginSequence`.  We first test the private ring
+// class, then the buffer used by a single thread (ordering, overwriting, and
+// the protocol methods operating on the snapshot), then by several threads
+// pushing records while another thread takes snapshots, and finally the reuse
+// of the ring of a thread that has exited.
+// ----------------------------------------------------------------------------
+// FlightRecorderBuffer_Ring
+// [ 2] FlightRecorderBuffer_Ring(int capacity, Allocator *);
+// [ 2] void acquire();
+// [ 2] int pushBack(const shared_ptr<Record>& handle);
+// [ 2] void release();
+// [ 2] void removeRecords(vector<Entry> *entries);
+// [ 2] int capacity() const;
+// [ 2] bool isReleased() const;
+// [ 2] int numRecords() const;
+//
+// FlightRecorderBuffer
+// CREATORS
+// [ 1] FlightRecorderBuffer(int recordsPerThread, Allocator *);
+// [ 1] ~FlightRecorderBuffer();
+//
+// MANIPULATORS
+// [ 3] void beginSequence();
+// [ 3] void endSequence();
+// [ 3] void popBack();
+// [ 3] void popFront();
+// [ 3] int pushBack(const shared_ptr<Record>& handle);
+// [ 3] int pushFront(const shared_ptr<Record>& handle);
+// [ 3] void removeAll();
+//
+// ACCESSORS
+// [ 3] const shared_ptr<Record>& back() const;
+// [ 3] const shared_ptr<Record>& front() const;
+// [ 3] int length() const;
+// [ 5] int numThreadBuffers() const;
+// [ 1] int recordsPerThread() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CONCURRENT PUSHES AND SNAPSHOTS
+// [ 5] CONCERN: RING REUSE AFTER THREAD EXIT
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONCURRENT `pushBack`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::FlightRecorderBuffer      Obj;
+typedef ball::FlightRecorderBuffer_Ring Ring;
+typedef bsl::shared_ptr<ball::Record>   Handle;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return a new record, allocated by the specified `allocator`, having the
+/// specified `threadId` and `lineNumber`, and a timestamp of the specified
+/// `microseconds` past an arbitrary epoch.
+Handle makeRecord(int               threadId,
+                  int               lineNumber,
+                  int               microseconds,
+                  bslma::Allocator *allocator)
+{
+    Handle record = bsl::allocate_shared<ball::Record>(allocator);
+
+    bdlt::Datetime timestamp(2026, 1, 1);
+    timestamp.addMicroseconds(microseconds);
+
+    record->fixedFields().setThreadID(threadId);
+    record->fixedFields().setLineNumber(lineNumber);
+    record->fixedFields().setTimestamp(timestamp);
+    return record;
+}
+
+/// Return the line number of the specified `record`.
+int lineOf(const Handle& record)
+{
+    return record->fixedFields().lineNumber();
+}
+
+/// Return the thread id of the specified `record`.
+int threadOf(const Handle& record)
+{
+    return static_cast<int>(record->fixedFields().threadID());
+}
+
+                               // =============
+                               // struct Pusher
+                               // =============
+
+/// This functor pushes records, numbered from 0, into a buffer, recording
+/// the number of records that were discarded.
+struct Pusher {
+
+    // DATA
+    ball::RecordBuffer *d_buffer_p;
+    int                 d_threadId;
+    int                 d_numRecords;
+    bslmt::Barrier     *d_barrier_p;      // waited on after pushing, if not 0
+    bsls::AtomicInt    *d_numDiscarded_p;
+
+    // ACCESSORS
+
+    /// Push `d_numRecords` records into `d_buffer_p`, then wait on
+    /// `d_barrier_p` if it is not 0.
+    void operator()() const
+    {
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            Handle record = makeRecord(d_threadId,
+                                       i,
+                                       d_threadId + i * 16,
+                                       allocator);
+            if (0 != d_buffer_p->pushBack(record)) {
+                ++*d_numDiscarded_p;
+            }
+        }
+        if (d_barrier_p) {
+            d_barrier_p->wait();
+        }
+    }
+};
+
+                             // =================
+                             // struct PerfPusher
+                             // =================
+
+/// This functor repeatedly pushes a record into a buffer, as a logger does
+/// when logging at the *Record* threshold level.
+struct PerfPusher {
+
+    // DATA
+    ball::RecordBuffer *d_buffer_p;
+    Handle              d_record;
+    int                 d_numPushes;
+    bslmt::Barrier     *d_barrier_p;
+
+    // ACCESSORS
+
+    /// Wait on `d_barrier_p`, then push `d_record` into `d_buffer_p`
+    /// `d_numPushes` times.
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numPushes; ++i) {
+            d_buffer_p->pushBack(d_record);
+        }
+    }
+};
+
+/// Return the wall time, in nanoseconds per push, taken by the specified
+/// `numThreads` threads each pushing a record the specified `numPushes`
+/// times into the specified `buffer`.
+double timePushes(ball::RecordBuffer *buffer, int numThreads, int numPushes)
+{
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    bslmt::Barrier                    barrier(numThreads + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        PerfPusher pusher = { buffer,
+                              makeRecord(i, 0, 0, allocator),
+                              numPushes,
+                              &barrier };
+        bslmt::ThreadUtil::create(&handles[i], pusher);
+    }
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    stopwatch.stop();
+
+    return stopwatch.elapsedTime() * 1e9 / (numThreads * numPushes);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// In the following example we demonstrate the use of a flight-recorder
+// buffer by several threads, and the retrieval of the records it holds.
+//
+// First, we create a buffer retaining the last 4 records of each thread:
+// ```
+    ball::FlightRecorderBuffer buffer(4);
+// ```
+// Then, we define a function that pushes a number of records into the
+// buffer, and run it in two threads, each pushing 10 records.  The threads
+// wait on a barrier before exiting, so that each pushes its records into a
+// ring of its own (see {Thread Safety and Lock-Freedom}):
+// ```
+    struct Pusher {
+        ball::FlightRecorderBuffer *d_buffer_p;
+        bslmt::Barrier             *d_barrier_p;
+        int                         d_id;
+
+        void operator()() const
+        {
+            for (int i = 0; i < 10; ++i) {
+                bsl::shared_ptr<ball::Record> record =
+                                           bsl::make_shared<ball::Record>();
+                bsl::ostringstream message;
+                message << "thread " << d_id << " record " << i;
+                record->fixedFields().setMessage(message.str().c_str());
+                record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+
+                d_buffer_p->pushBack(record);
+            }
+            d_barrier_p->wait();
+        }
+    };
+
+    bslmt::Barrier            barrier(2);
+    bslmt::ThreadUtil::Handle handles[2];
+    for (int id = 0; id < 2; ++id) {
+        Pusher pusher = { &buffer, &barrier, id };
+        bslmt::ThreadUtil::create(&handles[id], pusher);
+    }
+    for (int id = 0; id < 2; ++id) {
+        bslmt::ThreadUtil::join(handles[id]);
+    }
+// ```
+// Now, since each ring retains only the last 4 records of its thread, the
+// buffer holds 8 records:
+// ```
+    ASSERT(8 == buffer.length());
+    ASSERT(2 == buffer.numThreadBuffers());
+// ```
+// Finally, we lock the buffer, and print and remove the records, oldest
+// first:
+// ```
+    buffer.beginSequence();
+    while (buffer.length()) {
+        if (verbose) {
+        bsl::cout << buffer.front()->fixedFields().messageRef() << bsl::endl;
+        }
+        buffer.popFront();
+    }
+    buffer.endSequence();
+    ASSERT(0 == buffer.length());
+// ```
+// The output includes "thread 0 record 6" to "thread 0 record 9" and "thread
+// 1 record 6" to "thread 1 record 9", the records of each thread in that
+// order.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: RING REUSE AFTER THREAD EXIT
+        //
+        // Concerns:
+        // 1. Threads concurrently pushing records push them into distinct
+        //    rings.
+        //
+        // 2. The ring of a thread that has exited is reused by the next
+        //    thread to push a record, rather than a new ring being created.
+        //
+        // 3. The records of the exited thread remaining in a reused ring are
+        //    retained, and are overwritten, oldest first, by the records of
+        //    the thread reusing the ring.
+        //
+        // 4. Records are retained, and no memory is leaked, when a thread
+        //    that pushed records exits.
+        //
+        // Plan:
+        // 1. Run two threads pushing records and waiting on a common barrier
+        //    before exiting, and verify that two rings are created and that
+        //    all the records are retained.  (C-1, 4)
+        //
+        // 2. Run a thread pushing 3 records, join it, then run another
+        //    thread pushing 2 records into a buffer of capacity 4.  Verify
+        //    that a single ring is created, and that the buffer retains the
+        //    last 2 records of the first thread followed by the 2 records of
+        //    the second thread.  (C-2..4)
+        //
+        // Testing:
+        //   int numThreadBuffers() const;
+        //   CONCERN: RING REUSE AFTER THREAD EXIT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: RING REUSE AFTER THREAD EXIT" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        bsls::AtomicInt numDiscarded(0);
+
+        if (verbose) cout << "\tConcurrent threads use distinct rings.\n";
+        {
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            bslmt::Barrier            barrier(2);
+            bslmt::ThreadUtil::Handle handles[2];
+            for (int i = 0; i < 2; ++i) {
+                u::Pusher pusher = { &mX, i, 5, &barrier, &numDiscarded };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], pusher));
+            }
+            for (int i = 0; i < 2; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(X.numThreadBuffers(), 2  == X.numThreadBuffers());
+            ASSERTV(X.length(),           10 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tA released ring is reused.\n";
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 2; ++i) {
+                u::Pusher pusher = { &mX, i, 3 - i, 0, &numDiscarded };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, pusher));
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(i, X.numThreadBuffers(), 1 == X.numThreadBuffers());
+            }
+
+            ASSERTV(X.length(), 4 == X.length());
+
+            const int EXP_THREAD[] = { 0, 0, 1, 1 };
+            const int EXP_LINE[]   = { 1, 2, 0, 1 };
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 4 == X.length());
+            for (int i = 0; i < 4 && 0 < X.length(); ++i) {
+                ASSERTV(i, u::threadOf(X.front()),
+                        EXP_THREAD[i] == u::threadOf(X.front()));
+                ASSERTV(i, u::lineOf(X.front()),
+                        EXP_LINE[i] == u::lineOf(X.front()));
+                mX.popFront();
+            }
+            mX.endSequence();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        ASSERTV(numDiscarded, 0 == numDiscarded);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUSHES AND SNAPSHOTS
+        //
+        // Concerns:
+        // 1. Records pushed concurrently by several threads are neither lost
+        //    nor duplicated, except that `pushBack` may discard a record,
+        //    returning a non-zero value, while its slot is being emptied.
+        //
+        // 2. The records of each thread appear in the snapshots in the order
+        //    in which they were pushed, within and across snapshots.
+        //
+        // 3. Snapshots taken while other threads are pushing records contain
+        //    only records pushed before the snapshot was taken.
+        //
+        // Plan:
+        // 1. Run several threads, each pushing records numbered in sequence
+        //    into a buffer large enough not to overwrite any record, while
+        //    the main thread repeatedly takes snapshots, removing their
+        //    records.  The pushing threads wait on a common barrier before
+        //    exiting, so that their rings are not reused.  Verify that the records of each thread are retrieved
+        //    in increasing order, and that the number of records retrieved
+        //    and discarded is the number pushed.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUSHES AND SNAPSHOTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                      << endl
+                      << "CONCERN: CONCURRENT PUSHES AND SNAPSHOTS" << endl
+                      << "========================================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 5000 };
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            Obj mX(k_NUM_RECORDS, &oa);  const Obj& X = mX;
+
+            bsls::AtomicInt numDiscarded(0);
+
+            // The pushing threads wait on a barrier before exiting, so that
+            // no ring is reused, which would overwrite records.
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                u::Pusher pusher = { &mX,
+                                     i,
+                                     k_NUM_RECORDS,
+                                     &barrier,
+                                     &numDiscarded };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], pusher));
+            }
+
+            int nextLine[k_NUM_THREADS] = { 0 };
+            int numRetrieved            = 0;
+            int numSnapshots            = 0;
+
+            while (numRetrieved + numDiscarded <
+                                             k_NUM_THREADS * k_NUM_RECORDS) {
+                mX.beginSequence();
+                ++numSnapshots;
+
+                while (0 < X.length()) {
+                    const int THREAD = u::threadOf(X.front());
+                    const int LINE   = u::lineOf(X.front());
+
+                    ASSERTV(THREAD, 0 <= THREAD && THREAD < k_NUM_THREADS);
+                    if (0 <= THREAD && THREAD < k_NUM_THREADS) {
+                        ASSERTV(THREAD, LINE, nextLine[THREAD],
+                                nextLine[THREAD] <= LINE);
+                        nextLine[THREAD] = LINE + 1;
+                    }
+                    ++numRetrieved;
+                    mX.popFront();
+                }
+
+                mX.endSequence();
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            if (veryVerbose) {
+                P_(numSnapshots) P_(numRetrieved) P(numDiscarded)
+            }
+
+            ASSERTV(numRetrieved, numDiscarded,
+                    k_NUM_THREADS * k_NUM_RECORDS ==
+                                                 numRetrieved + numDiscarded);
+            ASSERTV(X.length(), 0 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SINGLE-THREADED PROTOCOL METHODS
+        //
+        // Concerns:
+        // 1. `pushBack` retains at most `recordsPerThread` records for a
+        //    thread, overwriting the oldest.
+        //
+        // 2. Outside a sequence, `length` returns the number of records in
+        //    the buffer.
+        //
+        // 3. `beginSequence` takes a snapshot of the records, ordered as they
+        //    were pushed, on which `length`, `back`, `front`, `popBack`, and
+        //    `popFront` operate.
+        //
+        // 4. Records pushed by `pushBack` during a sequence are not part of
+        //    the snapshot, and records inserted by `pushFront` precede the
+        //    records in the snapshot.
+        //
+        // 5. Nested calls to `beginSequence` do not take another snapshot.
+        //
+        // 6. Records remaining in the snapshot at the end of a sequence are
+        //    retained, and precede the records pushed later.
+        //
+        // 7. `removeAll` removes the records of the snapshot and rings.
+        //
+        // 8. All memory is supplied by the object allocator, and is released
+        //    on destruction.
+        //
+        // 9. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Push records numbered in sequence into buffers of various
+        //    capacities and verify the length, content, and order of the
+        //    snapshot, removing records from both ends.  (C-1..3)
+        //
+        // 2. Push records during a sequence, and insert records with
+        //    `pushFront`, and verify the content of the snapshot, within and
+        //    after the sequence.  (C-4..6)
+        //
+        // 3. Call `removeAll` with records in both the snapshot and the ring,
+        //    and verify that the buffer is empty.  (C-7)
+        //
+        // 4. Use a test allocator, and verify that the default allocator is
+        //    not used and that no memory is in use after destruction.  (C-8)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments and for accessing an empty
+        //    snapshot.  (C-9)
+        //
+        // Testing:
+        //   void beginSequence();
+        //   void endSequence();
+        //   void popBack();
+        //   void popFront();
+        //   int pushBack(const shared_ptr<Record>& handle);
+        //   int pushFront(const shared_ptr<Record>& handle);
+        //   void removeAll();
+        //   const shared_ptr<Record>& back() const;
+        //   const shared_ptr<Record>& front() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SINGLE-THREADED PROTOCOL METHODS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        if (verbose) cout << "\tOverwriting and ordering.\n";
+        {
+            static const struct {
+                int d_line;
+                int d_capacity;
+                int d_numPushed;
+            } DATA[] = {
+                // LINE  CAP  PUSHED
+                // ----  ---  ------
+                {  L_,    1,      0 },
+                {  L_,    1,      1 },
+                {  L_,    1,      5 },
+                {  L_,    3,      2 },
+                {  L_,    3,      3 },
+                {  L_,    3,      4 },
+                {  L_,    3,     10 },
+                {  L_,   16,     15 },
+                {  L_,   16,     16 },
+                {  L_,   16,     33 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int CAP    = DATA[ti].d_capacity;
+                const int PUSHED = DATA[ti].d_numPushed;
+                const int EXP    = PUSHED < CAP ? PUSHED : CAP;
+                const int FIRST  = PUSHED - EXP;
+
+                Obj mX(CAP, &oa);  const Obj& X = mX;
+
+                for (int i = 0; i < PUSHED; ++i) {
+                    ASSERTV(LINE, i,
+                            0 == mX.pushBack(u::makeRecord(0, i, i, &ra)));
+                }
+                ASSERTV(LINE, X.length(), EXP == X.length());
+
+                // Remove the records from both ends of the snapshot.
+
+                mX.beginSequence();
+                ASSERTV(LINE, X.length(), EXP == X.length());
+
+                int front = FIRST;
+                int back  = PUSHED - 1;
+                for (int i = 0; 0 < X.length(); ++i) {
+                    if (i % 2) {
+                        ASSERTV(LINE, front, u::lineOf(X.front()),
+                                front == u::lineOf(X.front()));
+                        mX.popFront();
+                        ++front;
+                    }
+                    else {
+                        ASSERTV(LINE, back, u::lineOf(X.back()),
+                                back == u::lineOf(X.back()));
+                        mX.popBack();
+                        --back;
+                    }
+                    ASSERTV(LINE, X.length(),
+                            back - front + 1 == X.length());
+                }
+                mX.endSequence();
+
+                ASSERTV(LINE, X.length(), 0 == X.length());
+                ASSERTV(LINE, ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tPushing during a sequence.\n";
+        {
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.pushBack(u::makeRecord(0, 0, 0, &ra)));
+            ASSERT(0 == mX.pushBack(u::makeRecord(0, 1, 1, &ra)));
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 2 == X.length());
+
+            // Records pushed during the sequence are not in the snapshot.
+
+            ASSERT(0 == mX.pushBack(u::makeRecord(0, 2, 2, &ra)));
+            ASSERTV(X.length(), 2 == X.length());
+            ASSERTV(u::lineOf(X.back()), 1 == u::lineOf(X.back()));
+
+            // Nested sequences use the same snapshot.
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 2 == X.length());
+
+            ASSERT(0 == mX.pushFront(u::makeRecord(0, 100, 100, &ra)));
+            ASSERTV(X.length(), 3 == X.length());
+            ASSERTV(u::lineOf(X.front()), 100 == u::lineOf(X.front()));
+            mX.endSequence();
+
+            ASSERTV(X.length(), 3 == X.length());
+            mX.popFront();
+            ASSERTV(u::lineOf(X.front()), 0 == u::lineOf(X.front()));
+            mX.endSequence();
+
+            // The remaining records are retained, and counted with the
+            // records pushed during the sequence.
+
+            ASSERTV(X.length(), 3 == X.length());
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 3 == X.length());
+            for (int i = 0; i < 3 && 0 < X.length(); ++i) {
+                ASSERTV(i, u::lineOf(X.front()), i == u::lineOf(X.front()));
+                mX.popFront();
+            }
+            mX.endSequence();
+            ASSERTV(X.length(), 0 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+        if (verbose) cout << "\t`removeAll`.\n";
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(0 == mX.pushBack(u::makeRecord(0, i, i, &ra)));
+            }
+            mX.beginSequence();
+            mX.endSequence();
+            ASSERT(0 == mX.pushBack(u::makeRecord(0, 3, 3, &ra)));
+            ASSERT(0 == mX.pushFront(u::makeRecord(0, 4, 4, &ra)));
+            ASSERTV(X.length(), 5 == X.length());
+
+            mX.removeAll();
+            ASSERTV(X.length(), 0 == X.length());
+            ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 0 == X.length());
+            mX.endSequence();
+
+            // Records pushed before destruction are released.
+
+            ASSERT(0 == mX.pushBack(u::makeRecord(0, 5, 5, &ra)));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, &oa));
+            ASSERT_PASS(Obj(1, &oa));
+
+            Obj mX(1, &oa);
+
+            mX.beginSequence();
+            ASSERT_FAIL(mX.back());
+            ASSERT_FAIL(mX.front());
+            ASSERT_FAIL(mX.popBack());
+            ASSERT_FAIL(mX.popFront());
+
+            ASSERT(0 == mX.pushFront(u::makeRecord(0, 0, 0, &ra)));
+            ASSERT_PASS(mX.back());
+            ASSERT_PASS(mX.front());
+            ASSERT_PASS(mX.popBack());
+            mX.endSequence();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // RING
+        //
+        // Concerns:
+        // 1. A ring retains the last `capacity` record handles pushed, and
+        //    `numRecords` returns their number.
+        //
+        // 2. `removeRecords` appends the handles held, with their sequence
+        //    numbers, numbered from 0 in the order pushed, to the vector, and
+        //    empties the ring.
+        //
+        // 3. Sequence numbers continue to increase after `removeRecords`.
+        //
+        // 4. `pushBack` fails, with no effect, if the slot into which the
+        //    handle would be stored is claimed.
+        //
+        // 5. `release` and `acquire` change the value returned by
+        //    `isReleased`.
+        //
+        // 6. Overwritten and removed record handles are released.
+        //
+        // Plan:
+        // 1. Push handles into rings of various capacities, and verify the
+        //    value returned by `numRecords` and the entries appended by
+        //    `removeRecords`.  (C-1..3, 6)
+        //
+        // 2. Claim the slot of the next push in a white-box manner, by
+        //    calling `removeRecords` from another thread while the main
+        //    thread is pushing, and verify that every handle pushed is
+        //    either retained or discarded.  (C-4)
+        //
+        // 3. Call `release` and `acquire` and verify `isReleased`.  (C-5)
+        //
+        // Testing:
+        //   FlightRecorderBuffer_Ring(int capacity, Allocator *);
+        //   void acquire();
+        //   int pushBack(const shared_ptr<Record>& handle);
+        //   void release();
+        //   void removeRecords(vector<Entry> *entries);
+        //   int capacity() const;
+        //   bool isReleased() const;
+        //   int numRecords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RING" << endl
+                          << "====" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("records", veryVerbose);
+
+        if (verbose) cout << "\tPushing and removing.\n";
+        for (int capacity = 1; capacity <= 5; ++capacity) {
+            Ring mX(capacity, &oa);  const Ring& X = mX;
+
+            ASSERTV(capacity, X.capacity(), capacity == X.capacity());
+            ASSERTV(capacity, 0 == X.numRecords());
+            ASSERTV(capacity, !X.isReleased());
+
+            bsls::Types::Uint64 sequenceNumber = 0;
+
+            for (int numPushed = 0; numPushed <= 2 * capacity; ++numPushed) {
+                for (int i = 0; i < numPushed; ++i) {
+                    ASSERTV(capacity, numPushed, i,
+                            0 == mX.pushBack(u::makeRecord(0, i, i, &ra)));
+                }
+
+                const int EXP = numPushed < capacity ? numPushed : capacity;
+                ASSERTV(capacity, numPushed, X.numRecords(),
+                        EXP == X.numRecords());
+                ASSERTV(capacity, numPushed, ra.numBlocksInUse(),
+                        EXP == ra.numBlocksInUse());
+
+                bsl::vector<Ring::Entry> entries(&oa);
+                mX.removeRecords(&entries);
+
+                ASSERTV(capacity, numPushed, entries.size(),
+                        EXP == static_cast<int>(entries.size()));
+                ASSERTV(capacity, numPushed, 0 == X.numRecords());
+
+                bsl::sort(entries.begin(), entries.end());
+                for (int i = 0; i < static_cast<int>(entries.size()); ++i) {
+                    const bsls::Types::Uint64 EXP_SEQ =
+                                        sequenceNumber + numPushed - EXP + i;
+
+                    ASSERTV(capacity, numPushed, i, entries[i].first,
+                            EXP_SEQ == entries[i].first);
+                    ASSERTV(capacity, numPushed, i,
+                            numPushed - EXP + i ==
+                                              u::lineOf(entries[i].second));
+                }
+                sequenceNumber += numPushed;
+            }
+            ASSERTV(capacity, ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tPushing while removing.\n";
+        {
+            enum { k_NUM_RECORDS = 20000 };
+
+            Ring mX(2, &oa);  const Ring& X = mX;
+
+            bsls::AtomicBool done(false);
+            int              numRemoved = 0;
+
+            struct Remover {
+                Ring             *d_ring_p;
+                bsls::AtomicBool *d_done_p;
+                int              *d_numRemoved_p;
+
+                void operator()() const
+                {
+                    bsl::vector<Ring::Entry> entries;
+                    while (!d_done_p->loadAcquire()) {
+                        d_ring_p->removeRecords(&entries);
+                        *d_numRemoved_p += static_cast<int>(entries.size());
+                        entries.clear();
+                    }
+                }
+            };
+
+            Remover                   remover = { &mX, &done, &numRemoved };
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, remover));
+
+            Handle record = u::makeRecord(0, 0, 0, &ra);
+            int    numDiscarded = 0;
+            int    numRetained  = 0;
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                if (0 != mX.pushBack(record)) {
+                    ++numDiscarded;
+                }
+            }
+            done.storeRelease(true);
+            bslmt::ThreadUtil::join(handle);
+
+            // Count the records left in the ring.
+
+            numRetained = X.numRecords();
+            bsl::vector<Ring::Entry> entries(&oa);
+            mX.removeRecords(&entries);
+            ASSERTV(numRetained, entries.size(),
+                    numRetained == static_cast<int>(entries.size()));
+            entries.clear();
+
+            if (veryVerbose) {
+                P_(numRemoved) P_(numRetained) P(numDiscarded)
+            }
+
+            // A record overwritten without being removed is neither counted
+            // as removed nor as retained, so only an upper bound holds.
+
+            ASSERTV(numRemoved, numRetained, numDiscarded,
+                    numRemoved + numRetained + numDiscarded <= k_NUM_RECORDS);
+            ASSERTV(record.use_count(), 1 == record.use_count());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tReleasing and acquiring.\n";
+        {
+            Ring mX(1, &oa);  const Ring& X = mX;
+
+            ASSERT(!X.isReleased());
+            mX.release();
+            ASSERT( X.isReleased());
+            mX.acquire();
+            ASSERT(!X.isReleased());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a buffer, push records, and retrieve them through the
+        //    `ball::RecordBuffer` protocol.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   FlightRecorderBuffer(int recordsPerThread, Allocator *);
+        //   ~FlightRecorderBuffer();
+        //   int recordsPerThread() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            Obj mX(2, &oa);  const Obj& X = mX;
+
+            ASSERT(2 == X.recordsPerThread());
+            ASSERT(0 == X.numThreadBuffers());
+            ASSERT(0 == X.length());
+
+            ball::RecordBuffer& buffer = mX;
+
+            ASSERT(0 == buffer.pushBack(u::makeRecord(0, 1, 1, &oa)));
+            ASSERT(1 == X.numThreadBuffers());
+            ASSERT(1 == buffer.length());
+
+            ASSERT(0 == buffer.pushBack(u::makeRecord(0, 2, 2, &oa)));
+            ASSERT(0 == buffer.pushBack(u::makeRecord(0, 3, 3, &oa)));
+            ASSERT(2 == buffer.length());
+
+            buffer.beginSequence();
+            ASSERT(2 == buffer.length());
+            ASSERT(2 == u::lineOf(buffer.front()));
+            ASSERT(3 == u::lineOf(buffer.back()));
+            buffer.popFront();
+            ASSERT(3 == u::lineOf(buffer.front()));
+            buffer.endSequence();
+
+            buffer.removeAll();
+            ASSERT(0 == buffer.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONCURRENT `pushBack`
+        //
+        // Concerns:
+        // 1. `pushBack` does not contend between threads, unlike
+        //    `ball::FixedSizeRecordBuffer::pushBack`.
+        //
+        // Plan:
+        // 1. For 1, 2, 4, and 8 threads, each pushing a record a number of
+        //    times, measure the wall time per push into a
+        //    `ball::FixedSizeRecordBuffer` and a `ball::FlightRecorderBuffer`
+        //    of similar capacity, and report them.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CONCURRENT `pushBack`
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: CONCURRENT `pushBack`" << endl
+             << "==================================" << endl;
+
+        const int NUM_PUSHES = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        cout << "threads  fixed-size (ns/push)  flight-recorder (ns/push)\n";
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            ball::FixedSizeRecordBuffer fixedSize(1024 * 1024, allocator);
+            Obj                         flightRecorder(1024, allocator);
+
+            const double FIXED  = u::timePushes(&fixedSize,
+                                                numThreads,
+                                                NUM_PUSHES);
+            const double FLIGHT = u::timePushes(&flightRecorder,
+                                                numThreads,
+                                                NUM_PUSHES);
+
+            cout << "      " << numThreads
+                 << "  " << FIXED
+                 << "  " << FLIGHT << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
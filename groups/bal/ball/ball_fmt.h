@@ -90,6 +90,24 @@ BSLS_IDENT("$Id: $")
 // BALL_FMT(format-string-literal, X, Y, ...)
 //```
 //
+///Prepared Format Strings
+///------------------------
+// In C++14 and later, each use of `BALL_FMT` (and so of the `BALL_FMT_*`
+// macros) parses its format string once, at compile time, into a
+// `bslfmt::PreparedFormat` held in a `static` variable local to the logging
+// statement.  A malformed format string is therefore a compile-time error,
+// and a logging statement that is executed renders its message without
+// parsing the format string again: the message is rendered into a buffer on
+// the stack by `bslfmt::PreparedFormatUtil` and appended to the log record
+// in a single write (or, for a message longer than that buffer, a
+// buffer-full at a time).  For this reason the format string *must* be a
+// string literal (or another constant expression).  The format string is
+// also used to initialize a `bsl::format_string`, so that, where the
+// standard library checks format strings at compile time (C++20), arguments
+// that do not match the format string are a compile-time error, as they are
+// for `bsl::format`.  Prior to C++14 the macros are implemented using
+// `bsl::format_to`, with the same output.
+//
 ///Usage
 ///-----
 // The following code fragments illustrate the standard pattern of macro usage.
@@ -187,20 +205,55 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <ball_log.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bslfmt_preparedformat.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
 
 #include <bsl_format.h>
 #include <bsl_iterator.h>
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES) &&              \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14)
+#define BALL_FMT_IMP_PREPARED 1
+#endif
+
                          // =========================
                          // Logging Macro Definitions
                          // =========================
 
+#ifdef BALL_FMT_IMP_PREPARED
+
+#define BALL_FMT(...)                                                         \
+    do {                                                                      \
+        static constexpr BloombergLP::bslfmt::PreparedFormat<char>            \
+                     ball_fmt_pRePaReD(BALL_FMT_IMP_FIRST(__VA_ARGS__));      \
+        BloombergLP::ball::Fmt_Util::formatTo(BALL_LOG_RECORD,                \
+                                              ball_fmt_pRePaReD,              \
+                                              __VA_ARGS__);                   \
+    } while (false)
+
+// `BALL_FMT_IMP_FIRST` expands to the first of its (one or more) arguments.
+// The indirection through `BALL_FMT_IMP_FIRST_A` is needed by the traditional
+// MSVC preprocessor, which otherwise passes `__VA_ARGS__` as one argument.
+
+#define BALL_FMT_IMP_FIRST(...) BALL_FMT_IMP_FIRST_A((__VA_ARGS__, unused))
+#define BALL_FMT_IMP_FIRST_A(ARGS) BALL_FMT_IMP_FIRST_B ARGS
+#define BALL_FMT_IMP_FIRST_B(FIRST, ...) FIRST
+
+#else  // BALL_FMT_IMP_PREPARED
+
 #define BALL_FMT(...)                                                         \
     bsl::format_to(                                                           \
         bsl::ostreambuf_iterator<char>(                                       \
             &BALL_LOG_RECORD->fixedFields().messageStreamBuf()),              \
         __VA_ARGS__)
 
+#endif  // BALL_FMT_IMP_PREPARED
+
 #define BALL_FMT_TRACE(...)                                                   \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_TRACE)           \
     BALL_FMT(__VA_ARGS__)
@@ -225,6 +278,61 @@ BSLS_IDENT("$Id: $")
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_FATAL)           \
     BALL_FMT(__VA_ARGS__)
 
+#ifdef BALL_FMT_IMP_PREPARED
+
+namespace BloombergLP {
+namespace ball {
+
+                              // ===============
+                              // struct Fmt_Util
+                              // ===============
+
+/// This component-private `struct` provides a namespace for the function
+/// used by the `BALL_FMT` macro to render a prepared format string into the
+/// message of a log record.
+struct Fmt_Util {
+    // CLASS METHODS
+
+    /// Append the message described by the specified `format` and `args` to
+    /// the message of the specified `record`.  The specified format string
+    /// literal (the third argument), from which `format` was prepared, is
+    /// used only to check, at compile time where supported, that `args` are
+    /// valid for it.  Throw `bsl::format_error` if `args` are not valid for
+    /// `format`.
+    template <class... t_ARGS>
+    static void formatTo(Record                               *record,
+                         const bslfmt::PreparedFormat<char>&   format,
+                         bsl::format_string<const t_ARGS&...>  /* literal */,
+                         const t_ARGS&...                      args);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // struct Fmt_Util
+                              // ---------------
+
+// CLASS METHODS
+template <class... t_ARGS>
+inline
+void Fmt_Util::formatTo(Record                               *record,
+                        const bslfmt::PreparedFormat<char>&   format,
+                        bsl::format_string<const t_ARGS&...>  /* literal */,
+                        const t_ARGS&...                      args)
+{
+    bslfmt::PreparedFormatUtil::formatToStreamBuf(
+                                     &record->fixedFields().messageStreamBuf(),
+                                     format,
+                                     args...);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BALL_FMT_IMP_PREPARED
+
 #endif  // INCLUDED_BALL_FMT
 
 // ----------------------------------------------------------------------------
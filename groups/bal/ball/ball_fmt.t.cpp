@@ -14,8 +14,10 @@
 
 #include <bsls_compilerfeatures.h>
 #include <bsls_keyword.h>
+#include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 
+#include <bsl_string.h>  // for testing only
 #include <bsl_vector.h>  // for testing only
 
 #include <bsl_cstddef.h>
@@ -54,7 +56,8 @@ using bsl::flush;
 // match the expected behavior.
 // ----------------------------------------------------------------------------
 // [ 1] BALL_FMT
-// [ 2] USAGE EXAMPLES
+// [ 2] CONCERN: PREPARED FORMAT STRINGS
+// [ 3] USAGE EXAMPLES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -242,7 +245,7 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLES
         //
@@ -366,6 +369,151 @@ int main(int argc, char *argv[])
 // uses the syntax of string formatting for the format specification.
         }
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCERN: PREPARED FORMAT STRINGS
+        //
+        // Concerns:
+        // 1. A logging statement renders its message correctly each time it
+        //    is executed, with the argument values of that execution.
+        //
+        // 2. Messages longer than the internal rendering buffer are logged
+        //    completely.
+        //
+        // 3. Format strings that cannot be prepared (having nested
+        //    replacement fields, or many replacement fields) are rendered
+        //    correctly.
+        //
+        // 4. Several uses of `BALL_FMT` in one block append to the message.
+        //
+        // 5. Arguments that do not match the format string are a
+        //    compile-time error where the standard library checks format
+        //    strings at compile time, and otherwise cause
+        //    `bsl::format_error` to be thrown.
+        //
+        // Plan:
+        // 1. Log messages in a loop, and verify each published message.
+        //    (C-1)
+        //
+        // 2. Log messages exercising C-2..4 and verify the published
+        //    messages.  (C-2..4)
+        //
+        // 3. Log a message with too few arguments in a block compiled only
+        //    if `BALL_FMT_COMPILE_FAIL_TOO_FEW_ARGUMENTS` is defined, which
+        //    must then fail to compile if the standard library checks format
+        //    strings at compile time.  Otherwise, log such a message and
+        //    verify that `bsl::format_error` is thrown.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: PREPARED FORMAT STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nCONCERN: PREPARED FORMAT STRINGS"
+                               << "\n================================\n";
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        BloombergLP::ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        bsl::shared_ptr<BloombergLP::ball::TestObserver> observer(
+               new (ta) BloombergLP::ball::TestObserver(&bsl::cout, &ta), &ta);
+
+        BloombergLP::ball::LoggerManager& manager =
+                                 BloombergLP::ball::LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        BloombergLP::ball::Administration::addCategory(
+                                "prepared",
+                                BloombergLP::ball::Severity::e_TRACE,
+                                BloombergLP::ball::Severity::e_TRACE,
+                                0,
+                                0);
+        BALL_LOG_SET_CATEGORY("prepared")
+
+#define LAST_MESSAGE()                                                        \
+    bsl::string(observer->lastPublishedRecord().fixedFields().message())
+
+        if (veryVerbose) bsl::cout << "\tRepeated execution." << bsl::endl;
+        {
+            for (int i = 0; i < 20; ++i) {
+                BALL_FMT_INFO("order {} for {:>5}: {} @ {:.2f} ({}{{%}})",
+                              1000 + i,
+                              i % 2 ? "IBM" : "MSFT",
+                              i * 10,
+                              0.5 * i,
+                              i % 3 ? 1.5 : 2.0);
+
+                char expected[64];
+                bsl::snprintf(expected,
+                              sizeof expected,
+                              "order %d for %5s: %d @ %.2f (%s{%%})",
+                              1000 + i,
+                              i % 2 ? "IBM" : "MSFT",
+                              i * 10,
+                              0.5 * i,
+                              i % 3 ? "1.5" : "2");
+
+                ASSERTV(i, LAST_MESSAGE(), expected == LAST_MESSAGE());
+            }
+        }
+
+        if (veryVerbose) bsl::cout << "\tLong messages." << bsl::endl;
+        {
+            BALL_FMT_INFO("[{:*^2000}]", "centered");
+
+            const bsl::string MESSAGE = LAST_MESSAGE();
+
+            ASSERTV(MESSAGE.length(), 2002 == MESSAGE.length());
+            ASSERT(bsl::string(996, '*') == MESSAGE.substr(1, 996));
+            ASSERT("centered" == MESSAGE.substr(997, 8));
+            ASSERT(bsl::string(996, '*') + "]" == MESSAGE.substr(1005));
+        }
+
+        if (veryVerbose) bsl::cout << "\tUnprepared formats." << bsl::endl;
+        {
+            const int WIDTH = 6;
+            BALL_FMT_INFO("<{:>{}}>", 42, WIDTH);
+            ASSERTV(LAST_MESSAGE(), "<    42>" == LAST_MESSAGE());
+
+            BALL_FMT_INFO("{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}{}",
+                          0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+                          0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+            ASSERTV(LAST_MESSAGE(),
+                    "01234567890123456789" == LAST_MESSAGE());
+        }
+
+        if (veryVerbose) bsl::cout << "\tSeveral uses in a block."
+                                   << bsl::endl;
+        {
+            BALL_LOG_INFO_BLOCK {
+                BALL_FMT("a={}", 1);
+                BALL_FMT(", ");
+                BALL_FMT("b={:.1f}", 2.25);
+            }
+            ASSERTV(LAST_MESSAGE(), "a=1, b=2.2" == LAST_MESSAGE());
+        }
+
+#if defined(BALL_FMT_COMPILE_FAIL_TOO_FEW_ARGUMENTS)
+        BALL_FMT_INFO("{} and {}", 1);
+#endif
+
+#if defined(BDE_BUILD_TARGET_EXC) &&                                          \
+   !defined(BSLS_LIBRARYFEATURES_HAS_CPP20_FORMAT)
+        if (veryVerbose) bsl::cout << "\tFormat errors." << bsl::endl;
+        {
+            bool caught = false;
+            try {
+                BALL_FMT_INFO("{} and {}", 1);
+            }
+            catch (const bsl::format_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+
+#undef LAST_MESSAGE
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // TESTING OSTREAM AND FMT MACROS
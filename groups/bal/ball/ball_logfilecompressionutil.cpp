@@ -0,0 +1,357 @@
+// ball_logfilecompressionutil.cpp                                    -*-C++-*-
+#include <ball_logfilecompressionutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_logfilecompressionutil_cpp,"$Id$ $CSID$")
+
+#include <bdlde_crc32c.h>
+#include <bdlde_lzblockcodec.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_istream.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef ball::LogFileCompressionUtil Util;
+
+const unsigned char k_MAGIC[]      = { 0x89, 'B', 'L', 'Z' };
+const bsl::size_t   k_MAGIC_LENGTH = sizeof k_MAGIC;
+
+enum Format {
+    e_STORED     = 0,  // the payload is the text
+    e_COMPRESSED = 1   // the payload is the compressed text
+};
+
+const bsl::size_t k_BUFFER_SIZE = 256 * 1024;
+    // size of the buffer holding data read from the input; it must exceed
+    // the length of the longest frame
+
+/// Write the specified `value` in big-endian byte order at the specified
+/// `destination`.
+void put32(char *destination, bsl::size_t value)
+{
+    destination[0] = static_cast<char>((value >> 24) & 0xff);
+    destination[1] = static_cast<char>((value >> 16) & 0xff);
+    destination[2] = static_cast<char>((value >>  8) & 0xff);
+    destination[3] = static_cast<char>( value        & 0xff);
+}
+
+/// Return the value written in big-endian byte order at the specified
+/// `source`.
+unsigned int get32(const char *source)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(
+                                                                      source);
+    return static_cast<unsigned int>(bytes[0]) << 24
+         | static_cast<unsigned int>(bytes[1]) << 16
+         | static_cast<unsigned int>(bytes[2]) <<  8
+         | static_cast<unsigned int>(bytes[3]);
+}
+
+                             // =================
+                             // class InputBuffer
+                             // =================
+
+/// This class buffers the data read from a stream, so that a frame can be
+/// examined before it is consumed.
+class InputBuffer {
+
+    // DATA
+    bsl::istream&     d_input;   // stream being read
+    bsl::vector<char> d_buffer;  // data read and not yet consumed
+    bsl::size_t       d_begin;   // offset of the first unconsumed byte
+    bsl::size_t       d_end;     // offset following the last byte read
+
+  private:
+    // NOT IMPLEMENTED
+    InputBuffer(const InputBuffer&);
+    InputBuffer& operator=(const InputBuffer&);
+
+  public:
+    // CREATORS
+
+    /// Create a buffer of data read from the specified `input`.
+    explicit InputBuffer(bsl::istream& input)
+    : d_input(input)
+    , d_buffer(k_BUFFER_SIZE)
+    , d_begin(0)
+    , d_end(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Discard the specified `length` unconsumed bytes.  The behavior is
+    /// undefined unless `length <= size()`.
+    void consume(bsl::size_t length)
+    {
+        BSLS_ASSERT(length <= size());
+
+        d_begin += length;
+    }
+
+    /// Read from the input until at least the specified `length` bytes are
+    /// unconsumed, or the input is exhausted, and return `true` if at least
+    /// `length` bytes are unconsumed, and `false` otherwise.  Note that
+    /// `data()` may change.  The behavior is undefined unless
+    /// `length <= k_BUFFER_SIZE`.
+    bool fill(bsl::size_t length)
+    {
+        BSLS_ASSERT(length <= k_BUFFER_SIZE);
+
+        if (length <= size()) {
+            return true;                                              // RETURN
+        }
+
+        if (0 < d_begin) {
+            bsl::memmove(d_buffer.data(), d_buffer.data() + d_begin, size());
+            d_end   -= d_begin;
+            d_begin  = 0;
+        }
+
+        while (d_end < length && d_input) {
+            d_input.read(d_buffer.data() + d_end,
+                         static_cast<bsl::streamsize>(k_BUFFER_SIZE - d_end));
+            d_end += static_cast<bsl::size_t>(d_input.gcount());
+        }
+
+        return length <= size();
+    }
+
+    // ACCESSORS
+
+    /// Return the address of the first unconsumed byte.
+    const char *data() const
+    {
+        return d_buffer.data() + d_begin;
+    }
+
+    /// Return the number of unconsumed bytes.
+    bsl::size_t size() const
+    {
+        return d_end - d_begin;
+    }
+};
+
+/// Load, into the specified `text`, the text held by the frame starting at
+/// the first unconsumed byte of the specified `buffer`, load its length
+/// into the specified `textLength`, and load the length of the frame into
+/// the specified `frameLength`.  Return 0 on success, and a non-zero value
+/// if `buffer` does not start with a valid frame.  The behavior is
+/// undefined unless `text` refers to at least `k_MAX_FRAME_TEXT_LENGTH`
+/// bytes.
+int readFrame(bsl::size_t *frameLength,
+              bsl::size_t *textLength,
+              char        *text,
+              InputBuffer *buffer)
+{
+    if (!buffer->fill(Util::k_FRAME_HEADER_LENGTH)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *header = buffer->data();
+
+    if (0 != bsl::memcmp(header, k_MAGIC, k_MAGIC_LENGTH)) {
+        return -2;                                                    // RETURN
+    }
+
+    const unsigned char format = static_cast<unsigned char>(header[4]);
+    if (e_COMPRESSED < format || header[5] || header[6] || header[7]) {
+        return -3;                                                    // RETURN
+    }
+
+    const bsl::size_t  length        = get32(header +  8);
+    const bsl::size_t  payloadLength = get32(header + 12);
+    const unsigned int checksum      = get32(header + 16);
+
+    if (Util::k_MAX_FRAME_TEXT_LENGTH < length
+     || bdlde::LzBlockCodec::maxCompressedLength(length) < payloadLength
+     || (e_STORED == format && payloadLength != length)) {
+        return -4;                                                    // RETURN
+    }
+
+    if (!buffer->fill(Util::k_FRAME_HEADER_LENGTH + payloadLength)) {
+        return -5;                                                    // RETURN
+    }
+
+    const char *payload = buffer->data() + Util::k_FRAME_HEADER_LENGTH;
+
+    if (e_STORED == format) {
+        bsl::memcpy(text, payload, length);
+    }
+    else {
+        bsl::size_t decompressedLength;
+        if (0 != bdlde::LzBlockCodec::decompress(&decompressedLength,
+                                                 text,
+                                                 length,
+                                                 payload,
+                                                 payloadLength)
+         || decompressedLength != length) {
+            return -6;                                                // RETURN
+        }
+    }
+
+    if (bdlde::Crc32c::calculate(text, length) != checksum) {
+        return -7;                                                    // RETURN
+    }
+
+    *frameLength = Util::k_FRAME_HEADER_LENGTH + payloadLength;
+    *textLength  = length;
+    return 0;
+}
+
+/// Discard the unconsumed bytes of the specified `buffer` that precede the
+/// next occurrence of the frame magic number, or all of them if there is
+/// none.
+void skipToMagic(InputBuffer *buffer)
+{
+    while (buffer->fill(k_MAGIC_LENGTH)) {
+        const char *begin = buffer->data();
+        const char *last  = begin + buffer->size() - k_MAGIC_LENGTH + 1;
+            // positions before `last` leave room for a full magic number
+
+        const char *position = begin;
+        while (position < last) {
+            position = static_cast<const char *>(
+                                       bsl::memchr(position,
+                                                   k_MAGIC[0],
+                                                   last - position));
+            if (!position) {
+                break;
+            }
+            if (0 == bsl::memcmp(position, k_MAGIC, k_MAGIC_LENGTH)) {
+                buffer->consume(position - begin);
+                return;                                               // RETURN
+            }
+            ++position;
+        }
+        buffer->consume(last - begin);
+    }
+    buffer->consume(buffer->size());
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace ball {
+
+                       // -----------------------------
+                       // struct LogFileCompressionUtil
+                       // -----------------------------
+
+// CLASS METHODS
+void LogFileCompressionUtil::appendFrames(bsl::vector<char> *frames,
+                                          const char        *text,
+                                          bsl::size_t        length)
+{
+    BSLS_ASSERT(frames);
+    BSLS_ASSERT(text || 0 == length);
+
+    while (0 < length) {
+        const bsl::size_t blockLength =
+                      bsl::min(length,
+                               static_cast<bsl::size_t>(
+                                                   k_MAX_FRAME_TEXT_LENGTH));
+
+        const bsl::size_t offset = frames->size();
+        frames->resize(offset
+                     + k_FRAME_HEADER_LENGTH
+                     + bdlde::LzBlockCodec::maxCompressedLength(blockLength));
+
+        char *header  = frames->data() + offset;
+        char *payload = header + k_FRAME_HEADER_LENGTH;
+
+        bsl::size_t payloadLength = bdlde::LzBlockCodec::compress(
+                                                                 payload,
+                                                                 text,
+                                                                 blockLength);
+        u::Format   format        = u::e_COMPRESSED;
+
+        if (blockLength <= payloadLength) {
+            bsl::memcpy(payload, text, blockLength);
+            payloadLength = blockLength;
+            format        = u::e_STORED;
+        }
+
+        bsl::memcpy(header, u::k_MAGIC, u::k_MAGIC_LENGTH);
+        header[4] = static_cast<char>(format);
+        header[5] = 0;
+        header[6] = 0;
+        header[7] = 0;
+        u::put32(header +  8, blockLength);
+        u::put32(header + 12, payloadLength);
+        u::put32(header + 16, bdlde::Crc32c::calculate(text, blockLength));
+
+        frames->resize(offset + k_FRAME_HEADER_LENGTH + payloadLength);
+
+        text   += blockLength;
+        length -= blockLength;
+    }
+}
+
+int LogFileCompressionUtil::decompress(bsl::ostream& output,
+                                       bsl::istream& input)
+{
+    u::InputBuffer    buffer(input);
+    bsl::vector<char> text(k_MAX_FRAME_TEXT_LENGTH);
+
+    int  numInvalidRegions = 0;
+    bool isInvalid         = false;  // `true` while skipping invalid data
+
+    while (buffer.fill(1)) {
+        bsl::size_t frameLength;
+        bsl::size_t textLength;
+
+        if (0 == u::readFrame(&frameLength,
+                              &textLength,
+                              text.data(),
+                              &buffer)) {
+            output.write(text.data(), static_cast<bsl::streamsize>(
+                                                                textLength));
+            if (!output) {
+                return -1;                                            // RETURN
+            }
+            buffer.consume(frameLength);
+            isInvalid = false;
+            continue;
+        }
+
+        if (!isInvalid) {
+            ++numInvalidRegions;
+            isInvalid = true;
+        }
+
+        // Resynchronize on the next magic number, which may start a frame
+        // appended after a truncated one.
+
+        buffer.consume(1);
+        u::skipToMagic(&buffer);
+    }
+
+    return numInvalidRegions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,164 @@
+// ball_logfilecompressionutil.h                                      -*-C++-*-
+#ifndef INCLUDED_BALL_LOGFILECOMPRESSIONUTIL
+#define INCLUDED_BALL_LOGFILECOMPRESSIONUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to write and read compressed log files.
+//
+//@CLASSES:
+//  ball::LogFileCompressionUtil: namespace for compressed log file framing
+//
+//@SEE_ALSO: ball_fileobserver2, bdlde_lzblockcodec
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `ball::LogFileCompressionUtil`, that writes and reads the compressed log
+// files produced by `ball::FileObserver2` when compression is enabled (see
+// {`ball_fileobserver2`|Log File Compression}).  A compressed log file is a
+// sequence of independent frames, each holding a block of at most 64 KiB of
+// log text compressed by `bdlde::LzBlockCodec`, together with the length and
+// the CRC32-C checksum of the text.  Because each frame is self-delimiting
+// and self-checking, a compressed log file can be appended to by any number
+// of processes in turn, and a file whose last frame is incomplete (e.g.,
+// because the writing process crashed) remains readable: `decompress` skips
+// any region of data that is not a valid frame, and resumes with the next
+// valid frame.
+//
+///File Format
+///-----------
+// A frame is a 20-byte header, followed by a payload.  The header holds, in
+// order:
+//
+// * the 4 bytes `0x89`, `'B'`, `'L'`, `'Z'`;
+// * a 1-byte format: 0 if the payload holds the text itself (as is the case
+//   for text that does not compress), and 1 if the payload holds the
+//   compressed representation of the text;
+// * 3 bytes that are 0;
+// * the 4-byte length of the text;
+// * the 4-byte length of the payload;
+// * the 4-byte CRC32-C checksum of the text (see `bdlde_crc32c`).
+//
+// Integers are written in big-endian (network) byte order, so that a file can
+// be read on any platform.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing and Decompressing Log Text
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to save log text compactly, in a file that remains
+// readable even if its end is lost.
+//
+// First, we create some log text:
+// ```
+// bsl::string text;
+// for (int i = 0; i < 1000; ++i) {
+//     text += "18OCT2026_09:30:00.000 1234:1 INFO main.cpp:42 MAIN "
+//             "request served\n";
+// }
+// ```
+// Then, we compress it into frames, which we write to a stream standing in
+// for a file:
+// ```
+// bsl::vector<char> frames;
+// ball::LogFileCompressionUtil::appendFrames(&frames,
+//                                            text.data(),
+//                                            text.size());
+// assert(frames.size() < text.size() / 10);
+//
+// bsl::stringstream file;
+// file.write(frames.data(), frames.size());
+// ```
+// Next, we decompress the file, and verify that we recover the text:
+// ```
+// bsl::ostringstream output;
+//
+// int rc = ball::LogFileCompressionUtil::decompress(output, file);
+// assert(0    == rc);
+// assert(text == output.str());
+// ```
+// Finally, we append a frame that is cut short, as if the process writing it
+// had crashed, followed by a complete frame, and verify that the text of both
+// complete frames is recovered, and that one invalid region is reported:
+// ```
+// bsl::vector<char> more;
+// ball::LogFileCompressionUtil::appendFrames(&more, "lost\n", 5);
+// ball::LogFileCompressionUtil::appendFrames(&more, "kept\n", 5);
+//
+// bsl::stringstream damaged;
+// damaged.write(frames.data(), frames.size());
+// damaged.write(more.data(), more.size() / 2 - 3);  // first half, less 3
+// damaged.write(more.data() + more.size() / 2, more.size() / 2);
+//
+// output.str("");
+// rc = ball::LogFileCompressionUtil::decompress(output, damaged);
+// assert(1                == rc);
+// assert(text + "kept\n"  == output.str());
+// ```
+
+#include <balscm_version.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                       // =============================
+                       // struct LogFileCompressionUtil
+                       // =============================
+
+/// This utility `struct` provides a namespace for functions that write and
+/// read compressed log files.
+struct LogFileCompressionUtil {
+
+    // CONSTANTS
+    enum {
+        k_FRAME_HEADER_LENGTH   = 20,         // length of a frame header
+
+        k_MAX_FRAME_TEXT_LENGTH = 64 * 1024   // maximum length of the text
+                                              // held by a frame
+    };
+
+    // CLASS METHODS
+
+    /// Append to the specified `frames` the frames holding the specified
+    /// `length` bytes of text at the specified `text`, split into blocks of
+    /// at most `k_MAX_FRAME_TEXT_LENGTH` bytes.  Note that appending no
+    /// text appends no frame.
+    static void appendFrames(bsl::vector<char> *frames,
+                             const char        *text,
+                             bsl::size_t        length);
+
+    /// Write to the specified `output` the text held by the frames of the
+    /// compressed log file read from the specified `input`, skipping any
+    /// region of `input` that does not hold a valid frame.  Return 0 if
+    /// `input` consists only of valid frames, a positive value indicating
+    /// the number of invalid regions skipped otherwise, and a negative
+    /// value if writing to `output` fails.
+    static int decompress(bsl::ostream& output, bsl::istream& input);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
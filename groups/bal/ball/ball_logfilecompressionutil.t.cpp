@@ -0,0 +1,819 @@
+// ball_logfilecompressionutil.t.cpp                                  -*-C++-*-
+#include <ball_logfilecompressionutil.h>
+
+#include <bdlde_crc32c.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility writing and reading a framed file
+// format.  We verify that `appendFrames` writes frames having the documented
+// layout, that `decompress` recovers the text of any sequence of frames, and
+// that it skips, and counts, regions of truncated, corrupt, or foreign data,
+// recovering the text of every valid frame that follows them.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void appendFrames(vector<char> *, const char *, size_t);
+// [ 3] int decompress(ostream&, istream&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: CPU COST PER MB AND BYTES SAVED
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::LogFileCompressionUtil Util;
+
+const int k_HEADER = Util::k_FRAME_HEADER_LENGTH;
+const int k_MAX    = Util::k_MAX_FRAME_TEXT_LENGTH;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the value written in big-endian byte order at the specified
+/// `source`.
+unsigned int get32(const char *source)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(
+                                                                      source);
+    return static_cast<unsigned int>(bytes[0]) << 24
+         | static_cast<unsigned int>(bytes[1]) << 16
+         | static_cast<unsigned int>(bytes[2]) <<  8
+         | static_cast<unsigned int>(bytes[3]);
+}
+
+/// Return the next value of the pseudo-random sequence having the specified
+/// `state`.
+unsigned int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+/// Return a string of the specified `length` pseudo-random bytes generated
+/// from the specified `seed`.
+bsl::string randomText(bsl::size_t length, unsigned int seed)
+{
+    bsl::string result(length, ' ');
+    for (bsl::size_t i = 0; i < length; ++i) {
+        result[i] = static_cast<char>(nextRandom(&seed));
+    }
+    return result;
+}
+
+/// Append to the specified `text` log records formatted as by the default
+/// format of `ball::FileObserver2`, until `text` has at least the specified
+/// `length` bytes.  Use the specified `seed` to vary the records.
+void appendLogText(bsl::string *text, bsl::size_t length, unsigned int seed)
+{
+    static const char *const SEVERITIES[] = { "INFO", "DEBUG", "WARN" };
+    static const char *const CATEGORIES[] = { "ORDER.ROUTER",
+                                              "MARKET.DATA",
+                                              "SESSION" };
+
+    char         line[256];
+    unsigned int micros = 0;  // microseconds within the hour
+
+    while (text->size() < length) {
+        micros = (micros + nextRandom(&seed) % 5000) % 3600000000u;
+
+        const unsigned int kind   = nextRandom(&seed) % 4;
+        const unsigned int thread = nextRandom(&seed) % 8 + 1;
+        const unsigned int id     = nextRandom(&seed) % 1000000;
+        const unsigned int value  = nextRandom(&seed) % 100000;
+        const char        *sev    = SEVERITIES[kind % 3];
+        const char        *cat    = CATEGORIES[thread % 3];
+
+        int n = bsl::snprintf(line,
+                              sizeof line,
+                              "\n18OCT2026_09:%02u:%02u.%06u 31337:%u %s "
+                              "router.cpp:%u %s ",
+                              micros / 60000000,
+                              micros / 1000000 % 60,
+                              micros % 1000000,
+                              thread,
+                              sev,
+                              400 + kind * 17,
+                              cat);
+        text->append(line, n);
+
+        switch (kind) {
+          case 0: {
+            n = bsl::snprintf(line,
+                              sizeof line,
+                              "Order %u routed to venue XNYS qty=%u "
+                              "px=%u.%02u\n",
+                              id,
+                              value % 1000,
+                              value / 100,
+                              value % 100);
+          } break;
+          case 1: {
+            n = bsl::snprintf(line,
+                              sizeof line,
+                              "Received quote update for symbol IBM "
+                              "bid=%u ask=%u seq=%u\n",
+                              value,
+                              value + 3,
+                              id);
+          } break;
+          case 2: {
+            n = bsl::snprintf(line,
+                              sizeof line,
+                              "Session %u heartbeat late by %u ms\n",
+                              id % 64,
+                              value % 500);
+          } break;
+          default: {
+            n = bsl::snprintf(line,
+                              sizeof line,
+                              "Order %u acknowledged by venue, "
+                              "latency %u us\n",
+                              id,
+                              value % 2000);
+          } break;
+        }
+        text->append(line, n);
+    }
+}
+
+/// Return the text decompressed from the specified `frames`, and load the
+/// status returned by `Util::decompress` into the specified `status`.
+bsl::string decompress(int *status, const bsl::string& frames)
+{
+    bsl::istringstream input(frames);
+    bsl::ostringstream output;
+
+    *status = Util::decompress(output, input);
+    return output.str();
+}
+
+/// Return the frames holding the specified `text`.
+bsl::string compress(const bsl::string& text)
+{
+    bsl::vector<char> frames;
+    Util::appendFrames(&frames, text.data(), text.size());
+    return bsl::string(frames.data(), frames.size());
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing and Decompressing Log Text
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to save log text compactly, in a file that remains
+// readable even if its end is lost.
+//
+// First, we create some log text:
+// ```
+    bsl::string text;
+    for (int i = 0; i < 1000; ++i) {
+        text += "18OCT2026_09:30:00.000 1234:1 INFO main.cpp:42 MAIN "
+                "request served\n";
+    }
+// ```
+// Then, we compress it into frames, which we write to a stream standing in
+// for a file:
+// ```
+    bsl::vector<char> frames;
+    ball::LogFileCompressionUtil::appendFrames(&frames,
+                                               text.data(),
+                                               text.size());
+    ASSERT(frames.size() < text.size() / 10);
+
+    bsl::stringstream file;
+    file.write(frames.data(), frames.size());
+// ```
+// Next, we decompress the file, and verify that we recover the text:
+// ```
+    bsl::ostringstream output;
+
+    int rc = ball::LogFileCompressionUtil::decompress(output, file);
+    ASSERT(0    == rc);
+    ASSERT(text == output.str());
+// ```
+// Finally, we append a frame that is cut short, as if the process writing it
+// had crashed, followed by a complete frame, and verify that the text of both
+// complete frames is recovered, and that one invalid region is reported:
+// ```
+    bsl::vector<char> more;
+    ball::LogFileCompressionUtil::appendFrames(&more, "lost\n", 5);
+    ball::LogFileCompressionUtil::appendFrames(&more, "kept\n", 5);
+
+    bsl::stringstream damaged;
+    damaged.write(frames.data(), frames.size());
+    damaged.write(more.data(), more.size() / 2 - 3);  // first half, less 3
+    damaged.write(more.data() + more.size() / 2, more.size() / 2);
+
+    output.str("");
+    rc = ball::LogFileCompressionUtil::decompress(output, damaged);
+    ASSERT(1                == rc);
+    ASSERT(text + "kept\n"  == output.str());
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `decompress`
+        //
+        // Concerns:
+        // 1. The text of a sequence of frames, including frames appended
+        //    separately, is recovered, and 0 is returned.
+        //
+        // 2. A file truncated at any point yields the text of the complete
+        //    frames preceding the truncation, and the status reports one
+        //    invalid region unless the truncation is at a frame boundary.
+        //
+        // 3. Frames following a truncated frame, foreign data, or a corrupt
+        //    frame are recovered, and each contiguous invalid region is
+        //    counted once.
+        //
+        // 4. Any single corrupt byte in a frame causes the frame to be
+        //    rejected, without affecting the neighbouring frames.
+        //
+        // 5. A file that holds no frame (e.g., an uncompressed log file) is
+        //    reported as one invalid region, and yields no text.
+        //
+        // 6. A failure to write the output is reported by a negative status.
+        //
+        // Plan:
+        // 1. Decompress files made of frames of various lengths, appended in
+        //    one or several calls.  (C-1)
+        //
+        // 2. Decompress every truncation of a file of three frames.  (C-2)
+        //
+        // 3. Decompress files in which frames are separated by truncated
+        //    frames and foreign data.  (C-3)
+        //
+        // 4. Flip each bit of the middle one of three frames, and decompress
+        //    the result.  (C-4)
+        //
+        // 5. Decompress uncompressed text and empty input.  (C-5)
+        //
+        // 6. Decompress to a stream in a failed state.  (C-6)
+        //
+        // Testing:
+        //   int decompress(ostream&, istream&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `decompress`" << endl
+                          << "====================" << endl;
+
+        int status;
+
+        if (verbose) cout << "\nRound trips." << endl;
+        {
+            static const bsl::size_t LENGTHS[] = {
+                1, 5, 12, 13, 100, 4096, 65535, 65536, 65537, 200000, 300001
+            };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const bsl::size_t LENGTH = LENGTHS[i];
+
+                bsl::string log;
+                u::appendLogText(&log, LENGTH, i);
+                log.resize(LENGTH);
+
+                ASSERTV(LENGTH, log == u::decompress(&status,
+                                                     u::compress(log)));
+                ASSERTV(LENGTH, 0 == status);
+
+                const bsl::string RANDOM = u::randomText(LENGTH, i);
+                ASSERTV(LENGTH, RANDOM == u::decompress(&status,
+                                                        u::compress(RANDOM)));
+                ASSERTV(LENGTH, 0 == status);
+            }
+
+            // Frames appended by several calls, as by successive writers.
+
+            bsl::string text;
+            bsl::string frames;
+            for (int i = 0; i < 50; ++i) {
+                bsl::string record;
+                u::appendLogText(&record, i * 97, i);
+                text   += record;
+                frames += u::compress(record);
+            }
+            ASSERT(text == u::decompress(&status, frames));
+            ASSERT(0    == status);
+
+            ASSERT(""   == u::decompress(&status, ""));
+            ASSERT(0    == status);
+        }
+
+        const bsl::string TEXT1("first frame of log text\n");
+        const bsl::string TEXT2("second frame of log text, "
+                                "second frame of log text\n");
+        const bsl::string TEXT3(u::randomText(300, 3));
+
+        const bsl::string FRAME1 = u::compress(TEXT1);
+        const bsl::string FRAME2 = u::compress(TEXT2);
+        const bsl::string FRAME3 = u::compress(TEXT3);
+
+        if (verbose) cout << "\nTruncation." << endl;
+        {
+            const bsl::string FILE = FRAME1 + FRAME2 + FRAME3;
+
+            for (bsl::size_t length = 0; length <= FILE.size(); ++length) {
+                bsl::string expected;
+                bsl::size_t boundary = 0;
+
+                if (FRAME1.size() <= length) {
+                    expected += TEXT1;
+                    boundary  = FRAME1.size();
+                }
+                if (FRAME1.size() + FRAME2.size() <= length) {
+                    expected += TEXT2;
+                    boundary += FRAME2.size();
+                }
+                if (FILE.size() <= length) {
+                    expected += TEXT3;
+                    boundary  = FILE.size();
+                }
+
+                const bsl::string RESULT = u::decompress(
+                                                  &status,
+                                                  FILE.substr(0, length));
+
+                ASSERTV(length, expected == RESULT);
+                ASSERTV(length, status, (boundary == length ? 0 : 1)
+                                                                  == status);
+            }
+        }
+
+        if (verbose) cout << "\nResynchronization." << endl;
+        {
+            // A truncated frame followed by a complete frame.
+
+            for (bsl::size_t length = 1; length < FRAME2.size(); ++length) {
+                const bsl::string FILE = FRAME1
+                                       + FRAME2.substr(0, length)
+                                       + FRAME3;
+                ASSERTV(length, TEXT1 + TEXT3 == u::decompress(&status,
+                                                               FILE));
+                ASSERTV(length, 1             == status);
+            }
+
+            // Foreign data around and between frames.
+
+            const bsl::string GARBAGE = "not a frame \x89" "BL";
+
+            ASSERT(TEXT1 + TEXT2 == u::decompress(&status,
+                                                  GARBAGE + FRAME1 + GARBAGE
+                                                + GARBAGE + FRAME2 + GARBAGE));
+            ASSERT(3             == status);
+
+            ASSERT(TEXT1 + TEXT2 == u::decompress(&status,
+                                                  FRAME1 + FRAME2.substr(5)
+                                                + GARBAGE + FRAME2));
+            ASSERT(1             == status);
+
+            // Foreign data longer than the input buffer.
+
+            const bsl::string LONG = u::randomText(1000000, 7);
+            ASSERT(TEXT1 + TEXT2 == u::decompress(&status,
+                                                  FRAME1 + LONG + FRAME2));
+            ASSERT(1             == status);
+        }
+
+        if (verbose) cout << "\nCorruption." << endl;
+        {
+            for (bsl::size_t i = 0; i < FRAME2.size(); ++i) {
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::string corrupt = FRAME2;
+                    corrupt[i] = static_cast<char>(corrupt[i] ^ (1 << bit));
+
+                    const bsl::string RESULT = u::decompress(
+                                                   &status,
+                                                   FRAME1 + corrupt + FRAME3);
+
+                    ASSERTV(i, bit, TEXT1 + TEXT3 == RESULT);
+                    ASSERTV(i, bit, 1             == status);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nUncompressed input." << endl;
+        {
+            bsl::string log;
+            u::appendLogText(&log, 10000, 1);
+
+            ASSERT("" == u::decompress(&status, log));
+            ASSERT(1  == status);
+        }
+
+        if (verbose) cout << "\nOutput failure." << endl;
+        {
+            bsl::istringstream input(FRAME1);
+            bsl::ostringstream output;
+            output.setstate(bsl::ios_base::badbit);
+
+            ASSERT(0 > Util::decompress(output, input));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `appendFrames`
+        //
+        // Concerns:
+        // 1. Each frame has the documented header: the magic number, the
+        //    format, zero reserved bytes, and the big-endian lengths and
+        //    checksum of the text.
+        //
+        // 2. Text is split into frames of at most `k_MAX_FRAME_TEXT_LENGTH`
+        //    bytes, and no frame is appended for empty text.
+        //
+        // 3. Compressible text is compressed, and incompressible text is
+        //    stored.
+        //
+        // 4. The existing contents of the vector are preserved.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Append log text and random text of various lengths to a vector
+        //    holding a prefix, and walk the frames, checking each header
+        //    against the text it holds.  (C-1..4)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void appendFrames(vector<char> *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `appendFrames`" << endl
+                          << "======================" << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_length;
+            bool        d_isRandom;
+            int         d_numFrames;
+        } DATA[] = {
+            //LINE  LENGTH           RANDOM  FRAMES
+            //----  ---------------  ------  ------
+            { L_,   0,               false,  0      },
+            { L_,   1,               false,  1      },
+            { L_,   1000,            false,  1      },
+            { L_,   1000,            true,   1      },
+            { L_,   k_MAX - 1,       false,  1      },
+            { L_,   k_MAX,           false,  1      },
+            { L_,   k_MAX + 1,       false,  2      },
+            { L_,   k_MAX + 1,       true,   2      },
+            { L_,   3 * k_MAX + 7,   false,  4      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE       = DATA[ti].d_line;
+            const bsl::size_t LENGTH     = DATA[ti].d_length;
+            const bool        IS_RANDOM  = DATA[ti].d_isRandom;
+            const int         NUM_FRAMES = DATA[ti].d_numFrames;
+
+            bsl::string text;
+            if (IS_RANDOM) {
+                text = u::randomText(LENGTH, ti);
+            }
+            else {
+                u::appendLogText(&text, LENGTH, ti);
+                text.resize(LENGTH);
+            }
+
+            bsl::vector<char> frames(3, 'x');
+            Util::appendFrames(&frames, text.data(), text.size());
+
+            ASSERTV(LINE, 'x' == frames[0] && 'x' == frames[2]);
+
+            bsl::size_t position   = 3;
+            bsl::size_t textOffset = 0;
+            int         numFrames  = 0;
+
+            while (position < frames.size()) {
+                ASSERTV(LINE, position + k_HEADER <= frames.size());
+                if (frames.size() < position + k_HEADER) {
+                    break;
+                }
+
+                const char *header = frames.data() + position;
+
+                ASSERTV(LINE, '\x89' == header[0]);
+                ASSERTV(LINE, 'B'    == header[1]);
+                ASSERTV(LINE, 'L'    == header[2]);
+                ASSERTV(LINE, 'Z'    == header[3]);
+                ASSERTV(LINE, 0 == header[5]);
+                ASSERTV(LINE, 0 == header[6]);
+                ASSERTV(LINE, 0 == header[7]);
+
+                const bsl::size_t length        = u::get32(header +  8);
+                const bsl::size_t payloadLength = u::get32(header + 12);
+                const bsl::size_t expected      =
+                           bsl::min<bsl::size_t>(k_MAX, LENGTH - textOffset);
+
+                ASSERTV(LINE, expected == length);
+                ASSERTV(LINE, bdlde::Crc32c::calculate(
+                                                  text.data() + textOffset,
+                                                  length)
+                                                    == u::get32(header + 16));
+                if (payloadLength < length) {
+                    ASSERTV(LINE, 1 == header[4]);
+                    ASSERTV(LINE, !IS_RANDOM);
+                }
+                else {
+                    ASSERTV(LINE, 0 == header[4]);
+                    ASSERTV(LINE, payloadLength == length);
+                    ASSERTV(LINE, 0 == bsl::memcmp(header + k_HEADER,
+                                                   text.data() + textOffset,
+                                                   length));
+                    ASSERTV(LINE, IS_RANDOM || length < 1000);
+                }
+
+                position   += k_HEADER + payloadLength;
+                textOffset += length;
+                ++numFrames;
+            }
+
+            ASSERTV(LINE, frames.size() == position);
+            ASSERTV(LINE, LENGTH        == textOffset);
+            ASSERTV(LINE, NUM_FRAMES    == numFrames);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char> frames;
+            const char        TEXT[] = "text";
+
+            ASSERT_PASS(Util::appendFrames(&frames, TEXT, 4));
+            ASSERT_PASS(Util::appendFrames(&frames, 0, 0));
+            ASSERT_FAIL(Util::appendFrames(0, TEXT, 4));
+            ASSERT_FAIL(Util::appendFrames(&frames, 0, 4));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Compress a short text, decompress it, and verify the result.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string TEXT = "hello, hello, hello, hello, world\n";
+
+        bsl::vector<char> frames;
+        Util::appendFrames(&frames, TEXT.data(), TEXT.size());
+        ASSERT(k_HEADER < frames.size());
+
+        bsl::istringstream input(bsl::string(frames.data(), frames.size()));
+        bsl::ostringstream output;
+
+        ASSERT(0    == Util::decompress(output, input));
+        ASSERT(TEXT == output.str());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CPU COST PER MB AND BYTES SAVED
+        //
+        // Concerns:
+        // 1. Compression is cheap enough, in CPU time per megabyte of log
+        //    text, to run on the thread publishing log records, and saves a
+        //    substantial fraction of the bytes written.
+        //
+        // Plan:
+        // 1. Generate log text formatted as by `ball::FileObserver2`, and
+        //    report the process CPU time taken to compress and decompress
+        //    it, per megabyte of text, together with the compressed size.
+        //    Also report the cost of compressing random text, which does not
+        //    compress.  The size of the text, in megabytes, can be given as
+        //    the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CPU COST PER MB AND BYTES SAVED
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: CPU COST PER MB AND BYTES SAVED" << endl
+             << "============================================" << endl;
+
+        const int NUM_MB = argc > 2 ? atoi(argv[2]) : 64;
+        if (NUM_MB <= 0) {
+            cerr << "usage: " << argv[0] << " -1 [megabytes]" << endl;
+            testStatus = -1;
+            break;
+        }
+
+        const bsl::size_t LENGTH = static_cast<bsl::size_t>(NUM_MB) << 20;
+
+        for (int pass = 0; pass < 2; ++pass) {
+            bsl::string text;
+            if (0 == pass) {
+                u::appendLogText(&text, LENGTH, 1);
+                text.resize(LENGTH);
+            }
+            else {
+                text = u::randomText(LENGTH, 1);
+            }
+
+            bsl::vector<char> frames;
+            frames.reserve(LENGTH + LENGTH / 64);
+
+            bsls::Types::Int64 system, user, start;
+
+            bsls::TimeUtil::getProcessTimers(&system, &user);
+            start = system + user;
+
+            Util::appendFrames(&frames, text.data(), text.size());
+
+            bsls::TimeUtil::getProcessTimers(&system, &user);
+            const bsls::Types::Int64 compressNs = system + user - start;
+
+            bsl::istringstream input(bsl::string(frames.data(),
+                                                 frames.size()));
+            bsl::ostringstream output;
+
+            bsls::TimeUtil::getProcessTimers(&system, &user);
+            start = system + user;
+
+            const int rc = Util::decompress(output, input);
+
+            bsls::TimeUtil::getProcessTimers(&system, &user);
+            const bsls::Types::Int64 decompressNs = system + user - start;
+
+            ASSERT(0    == rc);
+            ASSERT(text == output.str());
+
+            const double MB    = static_cast<double>(LENGTH) / (1 << 20);
+            const double ratio = static_cast<double>(frames.size())
+                               / static_cast<double>(LENGTH);
+
+            cout << (0 == pass ? "log text" : "random text") << ": "
+                 << NUM_MB << " MB\n"
+                 << "  compressed size:      "
+                 << static_cast<double>(frames.size()) / (1 << 20) << " MB ("
+                 << 100.0 * ratio << "%, saving "
+                 << 100.0 * (1.0 - ratio) << "%)\n"
+                 << "  compress CPU cost:    "
+                 << static_cast<double>(compressNs) / 1e6 / MB
+                 << " ms/MB ("
+                 << MB / (static_cast<double>(compressNs) / 1e9)
+                 << " MB/s)\n"
+                 << "  decompress CPU cost:  "
+                 << static_cast<double>(decompressNs) / 1e6 / MB
+                 << " ms/MB ("
+                 << MB / (static_cast<double>(decompressNs) / 1e9)
+                 << " MB/s)\n"
+                 << "  bytes saved per CPU ms of compression: "
+                 << (static_cast<double>(LENGTH)
+                   - static_cast<double>(frames.size()))
+                                     / (static_cast<double>(compressNs) / 1e6)
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
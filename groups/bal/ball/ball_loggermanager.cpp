@@ -7,6 +7,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <ball_attributecontext.h>
 #include <ball_context.h>
 #include <ball_fixedsizerecordbuffer.h>
+#include <ball_flightrecorderbuffer.h>
 #include <ball_loggermanagerdefaults.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
@@ -264,7 +265,7 @@ bool isCategoryEnabled(ball::ThresholdAggregate *levels,
                        int                       severity)
 
 {
-    if (category.relevantRuleMask()) {
+    if (0 < category.numRelevantRules()) {
         ball::AttributeContext *context = ball::AttributeContext::getContext();
         context->determineThresholdLevels(levels, &category);
         int threshold = ball::ThresholdAggregate::maxLevel(*levels);
@@ -456,15 +457,22 @@ void Logger::logMessage(const Category&                category,
                         const ThresholdAggregate&      levels)
 {
     record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+
+    logRecord(category, severity, record, levels);
+}
 
+void Logger::logRecord(const Category&                category,
+                       int                            severity,
+                       const bsl::shared_ptr<Record>& record,
+                       const ThresholdAggregate&      levels)
+{
     record->fixedFields().setCategory(category.categoryName());
     record->fixedFields().setSeverity(severity);
 
     static int pid = bdls::ProcessUtil::getProcessId();
     record->fixedFields().setProcessID(pid);
 
-    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
-
     // Invoke legacy user fields populator callback.
     if (d_userFieldsPopulator) {
         d_userFieldsPopulator(&record->customFields());
@@ -612,6 +620,20 @@ Record *Logger::getRecord(const bsl::string_view& fileName, int lineNumber)
     return RecordSharedPtrUtil::disassembleSharedPtr(&record);
 }
 
+void Logger::logDeferredMessage(const Category&  category,
+                                int              severity,
+                                Record          *record)
+{
+    bsl::shared_ptr<Record> handle(
+                             RecordSharedPtrUtil::reassembleSharedPtr(record));
+
+    ThresholdAggregate thresholds;
+    if (!isCategoryEnabled(&thresholds, category, severity)) {
+        return;                                                       // RETURN
+    }
+    logRecord(category, severity, handle, thresholds);
+}
+
 void Logger::logMessage(const Category&         category,
                         int                     severity,
                         const bsl::string_view& fileName,
@@ -789,10 +811,18 @@ void LoggerManager::constructObject(
       bsl::allocator<bsl::function<void(Transmission::Cause)> >(d_allocator_p),
       bdlf::MemFnUtil::memFn(&LoggerManager::publishAllImp, this));
 
-    int recordBufferSize = configuration.defaults().defaultRecordBufferSize();
-    d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
+    if (0 < configuration.flightRecorderCapacity()) {
+        d_recordBuffer_p = new(*d_allocator_p) FlightRecorderBuffer(
+                                       configuration.flightRecorderCapacity(),
+                                       d_allocator_p);
+    }
+    else {
+        int recordBufferSize =
+                           configuration.defaults().defaultRecordBufferSize();
+        d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
                                                               recordBufferSize,
                                                               d_allocator_p);
+    }
 
     d_logger_p = new(*d_allocator_p) Logger(d_observer,
                                             d_recordBuffer_p,
@@ -1607,7 +1637,7 @@ void LoggerManager::setDefaultThresholdLevelsCallback(
 bool LoggerManager::isCategoryEnabled(const Category *category,
                                       int             severity) const
 {
-    if (category->relevantRuleMask()) {
+    if (0 < category->numRelevantRules()) {
         AttributeContext *context = AttributeContext::getContext();
         ThresholdAggregate levels;
         context->determineThresholdLevels(&levels, category);
@@ -67,6 +67,15 @@ BSLS_IDENT("$Id: $")
 // levels (see below) or can install a logger that uses a different kind of
 // record buffer.
 //
+// If the logger manager is configured with a non-zero flight-recorder capacity
+// (see `ball::LoggerManagerConfiguration::setFlightRecorderCapacityIfValid`),
+// the default logger instead uses a `ball::FlightRecorderBuffer`, which
+// retains the most recent records of each logging thread, up to that
+// capacity, without serializing the threads on a mutex when storing a record
+// (see the `ball_flightrecorderbuffer` component for details).  This avoids
+// contention on the record buffer in programs logging many records at the
+// *Record* threshold level from many threads.
+//
 ///Logger Manager Singleton Initialization
 ///---------------------------------------
 // The recommended way to initialize the logger manager singleton is to create
@@ -1063,6 +1072,14 @@ class Logger {
                     const bsl::shared_ptr<Record>& record,
                     const ThresholdAggregate&      levels);
 
+    /// Log the specified `record` as the 4-argument `logMessage` does,
+    /// except that the timestamp and thread ID fields, which are assumed to
+    /// be already set in `record`, are not modified.
+    void logRecord(const Category&                category,
+                   int                            severity,
+                   const bsl::shared_ptr<Record>& record,
+                   const ThresholdAggregate&      levels);
+
     /// Publish to the observer held by this logger all records stored in
     /// the record buffer of this logger and indicate to the observer the
     /// specified publication `cause`.
@@ -1080,9 +1097,25 @@ class Logger {
     /// `fileName` and `lineNumber` attributes, and retrieved from the
     /// object pool managed by this logger.  Note that the returned `Record`
     /// must subsequently be supplied to a call to the 3-argument
-    /// `logMessage` method on this logger.
+    /// `logMessage` method, or to the `logDeferredMessage` method, on this
+    /// logger.
     Record *getRecord(const bsl::string_view& fileName, int lineNumber);
 
+    /// Log the specified `*record`, whose message was captured earlier and
+    /// formatted later (see `ball_deferredlogger`), as the 3-argument
+    /// `logMessage` does, except that the timestamp and thread ID fields of
+    /// `record`, which are assumed to be already set to those of the
+    /// original log statement, are not modified.  Note that the attribute
+    /// collectors and the user fields populator are invoked by the thread
+    /// calling this method, which need not be the thread that executed the
+    /// log statement.  The behavior is undefined unless `severity` is in the
+    /// range `[1 .. 255]`, and `record` was previously obtained by a call to
+    /// `getRecord` on this logger.  Note that `record` will be invalid after
+    /// this method returns.
+    void logDeferredMessage(const Category&  category,
+                            int              severity,
+                            Record          *record);
+
     /// Log a record containing the specified `message` text, `fileName`,
     /// `lineNumber`, `severity`, and the name of the specified `category`.
     /// (See the component-level documentation of `ball_record` for more
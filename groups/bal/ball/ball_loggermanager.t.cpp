@@ -211,6 +211,7 @@ using namespace bdlf::PlaceHolders;
 // [40] USAGE EXAMPLE #3
 // [41] USAGE EXAMPLE #4
 // [44] CONCERN: `obtainMessageBuffer` USES GLOBAL ALLOCATOR
+// [45] CONCERN: FLIGHT-RECORDER RECORD BUFFER
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
 // [12] CONCERN: LOG RECORD POPULATOR CALLBACKS
@@ -1739,6 +1740,90 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 45: {
+        // --------------------------------------------------------------------
+        // CONCERN: FLIGHT-RECORDER RECORD BUFFER
+        //
+        // Concerns:
+        // 1. If the configuration has a non-zero flight-recorder capacity,
+        //    the default logger retains at most that number of records for
+        //    each thread, and publishes them when a record of trigger
+        //    severity is logged.
+        //
+        // 2. The records are published in the configured log order.
+        //
+        // Plan:
+        // 1. Configure the logger manager with a flight-recorder capacity of
+        //    3, log 5 records at the record threshold level and verify that
+        //    none is published, then log a record at the trigger threshold
+        //    level and verify that the last 3 records logged, including the
+        //    trigger record, are published, newest first.  (C-1..2)
+        //
+        // 2. Repeat P-1 with the FIFO log order, and verify that the records
+        //    are published oldest first.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: FLIGHT-RECORDER RECORD BUFFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: FLIGHT-RECORDER RECORD BUFFER"
+                          << "\n======================================"
+                          << endl;
+
+        typedef ball::LoggerManagerConfiguration Config;
+
+        const Config::LogOrder ORDERS[] = { Config::e_LIFO, Config::e_FIFO };
+
+        for (int oi = 0; oi < 2; ++oi) {
+            const Config::LogOrder ORDER = ORDERS[oi];
+
+            bsl::shared_ptr<ball::TestObserver> observerSP =
+                                   bsl::make_shared<ball::TestObserver>(&cout);
+            const ball::TestObserver& TO = *observerSP;
+
+            Config mXC;
+            ASSERT(0 == mXC.setFlightRecorderCapacityIfValid(3));
+            ASSERT(0 == mXC.setDefaultThresholdLevelsIfValid(
+                                                       ball::Severity::e_TRACE,
+                                                       0,
+                                                       ball::Severity::e_ERROR,
+                                                       0));
+            mXC.setLogOrder(ORDER);
+            mXC.setTriggerMarkers(Config::e_NO_MARKERS);
+
+            ball::LoggerManagerScopedGuard lmg(mXC);
+
+            Obj& mLM = Obj::singleton();
+            mLM.registerObserver(observerSP, "TO");
+
+            ball::Logger&         logger   = mLM.getLogger();
+            const ball::Category& category = mLM.defaultCategory();
+
+            for (int i = 1; i <= 5; ++i) {
+                ball::Record *record = logger.getRecord(__FILE__, i);
+                logger.logMessage(category, ball::Severity::e_TRACE, record);
+            }
+            ASSERTV(ORDER, TO.numPublishedRecords(),
+                    0 == TO.numPublishedRecords());
+
+            ball::Record *record = logger.getRecord(__FILE__, 100);
+            logger.logMessage(category, ball::Severity::e_ERROR, record);
+
+            ASSERTV(ORDER, TO.numPublishedRecords(),
+                    3 == TO.numPublishedRecords());
+
+            const int EXP_LAST = Config::e_LIFO == ORDER ? 4 : 100;
+            const int LAST     =
+                           TO.lastPublishedRecord().fixedFields().lineNumber();
+            ASSERTV(ORDER, LAST, EXP_LAST == LAST);
+
+            // The buffer was emptied by the trigger.
+
+            mLM.publishAll();
+            ASSERTV(ORDER, TO.numPublishedRecords(),
+                    3 == TO.numPublishedRecords());
+        }
+      } break;
       case 44: {
         // --------------------------------------------------------------------
         // TESTING `obtainMessageBuffer` USES GLOBAL ALLOCATOR
@@ -58,6 +58,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 bsl::allocator<DefaultThresholdLevelsCallback>(basicAllocator))
 , d_logOrder(e_LIFO)
 , d_triggerMarkers(e_BEGIN_END_MARKERS)
+, d_flightRecorderCapacity(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -79,6 +80,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 original.d_defaultThresholdsCb)
 , d_logOrder(original.d_logOrder)
 , d_triggerMarkers(original.d_triggerMarkers)
+, d_flightRecorderCapacity(original.d_flightRecorderCapacity)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -87,12 +89,13 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
 LoggerManagerConfiguration&
 LoggerManagerConfiguration::operator=(const LoggerManagerConfiguration& rhs)
 {
-    d_defaults            = rhs.d_defaults;
-    d_userPopulator       = rhs.d_userPopulator;
-    d_categoryNameFilter  = rhs.d_categoryNameFilter;
-    d_defaultThresholdsCb = rhs.d_defaultThresholdsCb;
-    d_logOrder            = rhs.d_logOrder;
-    d_triggerMarkers      = rhs.d_triggerMarkers;
+    d_defaults               = rhs.d_defaults;
+    d_userPopulator          = rhs.d_userPopulator;
+    d_categoryNameFilter     = rhs.d_categoryNameFilter;
+    d_defaultThresholdsCb    = rhs.d_defaultThresholdsCb;
+    d_logOrder               = rhs.d_logOrder;
+    d_triggerMarkers         = rhs.d_triggerMarkers;
+    d_flightRecorderCapacity = rhs.d_flightRecorderCapacity;
 
     return *this;
 }
@@ -159,6 +162,17 @@ void LoggerManagerConfiguration::setTriggerMarkers(TriggerMarkers value)
     d_triggerMarkers = value;
 }
 
+int LoggerManagerConfiguration::setFlightRecorderCapacityIfValid(
+                                                         int recordsPerThread)
+{
+    if (recordsPerThread < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    d_flightRecorderCapacity = recordsPerThread;
+    return 0;
+}
+
 // ACCESSORS
 const LoggerManagerDefaults& LoggerManagerConfiguration::defaults() const
 {
@@ -225,6 +239,11 @@ LoggerManagerConfiguration::triggerMarkers() const
     return d_triggerMarkers;
 }
 
+int LoggerManagerConfiguration::flightRecorderCapacity() const
+{
+    return d_flightRecorderCapacity;
+}
+
 bsl::ostream&
 LoggerManagerConfiguration::print(bsl::ostream& stream,
                                   int           level,
@@ -272,6 +291,10 @@ LoggerManagerConfiguration::print(bsl::ostream& stream,
                                                  : "BEGIN_END_MARKERS";
     stream << "Trigger markers are " << triggerMarker << NL;
 
+    bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+    stream << "Flight recorder capacity is " << d_flightRecorderCapacity
+           << NL;
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << ']' << NL;
 
@@ -295,7 +318,8 @@ bool ball::operator==(const ball::LoggerManagerConfiguration& lhs,
         && (bool)lhs.d_categoryNameFilter  == (bool)rhs.d_categoryNameFilter
         && (bool)lhs.d_defaultThresholdsCb == (bool)rhs.d_defaultThresholdsCb
         && lhs.d_logOrder                  == rhs.d_logOrder
-        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers;
+        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers
+        && lhs.d_flightRecorderCapacity    == rhs.d_flightRecorderCapacity;
 }
 
 bool ball::operator!=(const ball::LoggerManagerConfiguration& lhs,
@@ -54,6 +54,8 @@ BSLS_IDENT("$Id: $")
 //
 // TriggerMarkers                               triggerMarkers
 //
+// int                                          flightRecorderCapacity
+//
 // NAME                            DESCRIPTION
 // -------------------             -------------------------------------------
 // defaults                        constrained defaults for buffer size and
@@ -82,6 +84,14 @@ BSLS_IDENT("$Id: $")
 //                                 sequence of records logged due to a Trigger
 //                                 or Trigger-All event; default is
 //                                 'e_BEGIN_END_MARKERS'.
+//
+// flightRecorderCapacity          if positive, the number of records retained
+//                                 for each thread by a
+//                                 `ball::FlightRecorderBuffer` used as the
+//                                 record buffer of the default logger instead
+//                                 of a `ball::FixedSizeRecordBuffer` of
+//                                 `defaultRecordBufferSize` bytes; default is
+//                                 0 (i.e., a `ball::FixedSizeRecordBuffer`).
 // ```
 // The constraints are as follows:
 // ```
@@ -99,6 +109,8 @@ BSLS_IDENT("$Id: $")
 // +--------------------------------+--------------------------------+
 // | triggerMarkers                 | (none)                         |
 // +--------------------------------+--------------------------------+
+// | flightRecorderCapacity         | 0 <= flightRecorderCapacity    |
+// +--------------------------------+--------------------------------+
 // ```
 // For convenience, the `ball::LoggerManagerConfiguration` interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -194,6 +206,7 @@ BSLS_IDENT("$Id: $")
 //     Default Threshold Callback functor is null
 //     Logging order is FIFO
 //     Trigger markers are NO_MARKERS
+//     Flight recorder capacity is 0
 // ]
 // ```
 
@@ -321,6 +334,11 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    int                   d_flightRecorderCapacity;
+                                                  // records per thread of the
+                                                  // default logger's flight
+                                                  // recorder, or 0 if none
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -446,6 +464,13 @@ class LoggerManagerConfiguration {
     /// `value`.
     void setTriggerMarkers(TriggerMarkers value);
 
+    /// Set the flight-recorder capacity attribute of this object to the
+    /// specified `recordsPerThread` if `0 <= recordsPerThread`.  Return 0 on
+    /// success, and a non-zero value otherwise with no effect on this
+    /// object.  See attributes description for effects of the
+    /// flight-recorder capacity.
+    int setFlightRecorderCapacityIfValid(int recordsPerThread);
+
     // ACCESSORS
 
     /// Return a reference to the non-modifiable defaults object attribute
@@ -497,6 +522,10 @@ class LoggerManagerConfiguration {
     /// description for effects of the trigger markers.
     TriggerMarkers triggerMarkers() const;
 
+    /// Return the flight-recorder capacity attribute of this object.  See
+    /// attributes description for effects of the flight-recorder capacity.
+    int flightRecorderCapacity() const;
+
     /// Format a reasonable representation of this object to the specified
     /// output `stream` at the (absolute value of) the optionally specified
     /// indentation `level` and return a reference to `stream`.  If `level`
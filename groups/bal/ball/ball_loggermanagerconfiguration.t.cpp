@@ -7,6 +7,7 @@
 
 #include <bsls_assert.h>
 
+#include <bsl_climits.h>     // INT_MAX, INT_MIN
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_cstring.h>     // strlen()
 #include <bsl_functional.h>
@@ -44,6 +45,7 @@ using namespace bsl;
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] int setFlightRecorderCapacityIfValid(int recordsPerThread);
 // [ 1] void setUserFieldsPopulatorCallback(const Populator&);
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -51,6 +53,7 @@ using namespace bsl;
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] int flightRecorderCapacity() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -60,7 +63,7 @@ using namespace bsl;
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -213,6 +216,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Flight recorder capacity is 0
 //  ]
 // ```
 
@@ -299,7 +303,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -318,6 +322,83 @@ int main(int argc, char *argv[])
 
         initializeConfiguration(verbose);
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `setFlightRecorderCapacityIfValid`:
+        //   Verify `setFlightRecorderCapacityIfValid` and
+        //   `flightRecorderCapacity`.
+        //
+        // Concern:
+        //   That `setFlightRecorderCapacityIfValid` sets the attribute to
+        //   any non-negative value and rejects negative values with no
+        //   effect, and that the attribute participates in copying,
+        //   assignment, equality, and printing.
+        //
+        // Plan:
+        //   1. Create a configuration and verify that the capacity is 0.
+        //   2. Set valid and invalid values and verify the return value and
+        //      `flightRecorderCapacity`.
+        //   3. Verify copying, assignment, equality, and the printed value.
+        //
+        // Testing:
+        //   int setFlightRecorderCapacityIfValid(int recordsPerThread);
+        //   int flightRecorderCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING `setFlightRecorderCapacityIfValid`"
+                 << "\n==========================================\n";
+
+        Obj lmc;  const Obj& LMC = lmc;
+        ASSERT(0 == LMC.flightRecorderCapacity());
+
+        static const struct {
+            int d_line;
+            int d_value;
+            int d_isValid;
+        } DATA[] = {
+            // LINE   VALUE      VALID
+            // ----   --------   -----
+            {  L_,           0,      1 },
+            {  L_,           1,      1 },
+            {  L_,        1000,      1 },
+            {  L_,     INT_MAX,      1 },
+            {  L_,          -1,      0 },
+            {  L_,     INT_MIN,      0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int VALUE = DATA[ti].d_value;
+            const int VALID = DATA[ti].d_isValid;
+
+            lmc.setFlightRecorderCapacityIfValid(7);
+
+            const int rc = lmc.setFlightRecorderCapacityIfValid(VALUE);
+            ASSERTV(LINE, rc, VALID == (0 == rc));
+            ASSERTV(LINE, LMC.flightRecorderCapacity(),
+                    (VALID ? VALUE : 7) == LMC.flightRecorderCapacity());
+        }
+
+        lmc.setFlightRecorderCapacityIfValid(100);
+
+        const Obj X(LMC);
+        ASSERT(100 == X.flightRecorderCapacity());
+        ASSERT(X == LMC);
+
+        Obj y;  const Obj& Y = y;
+        ASSERT(Y != LMC);
+        y = LMC;
+        ASSERT(100 == Y.flightRecorderCapacity());
+        ASSERT(Y == LMC);
+
+        bsl::ostringstream oss;
+        oss << LMC;
+        ASSERTV(oss.str(), bsl::string::npos !=
+                          oss.str().find("Flight recorder capacity is 100"));
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
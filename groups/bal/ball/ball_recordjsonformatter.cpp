@@ -15,6 +15,25 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 // corresponding field in the log record.  When a log record is published,
 // these formatters are supplied with to the log record to render it as JSON.
 //
+// Everything that can be computed from the format specification alone is
+// computed once, when the specification is parsed, rather than for every
+// record: each field formatter holds the name of its JSON member already
+// quoted, escaped, and followed by the ':' separator (see 'MemberName').
+// Field formatters render a record through a 'JsonWriter', which produces
+// the same (compact) text as 'baljsn::SimpleFormatter' but accumulates it in
+// a fixed-size buffer on the stack, and writes it to the output stream in as
+// few calls as possible (typically one).  Integers are rendered with
+// 'bslalg::NumericFormatterUtil', and strings are escaped by 'JsonWriter'
+// itself, following the rules of 'bdljsn::StringUtil::writeString', so no
+// 'bsl::ostream' operation and no memory allocation is needed to render a
+// record that fits in the buffer.
+//
+// The time of day of a timestamp, to whole seconds, is cached by each
+// 'TimestampFormatter': records published within the same second only
+// render their fractional seconds and time zone offset.  The cache is
+// guarded by a spin lock that is only ever tried, so that a thread finding
+// the cache in use renders its timestamp without waiting.
+//
 ///Record JSON Formatter Schema
 /// - - - - - - - - - - - - - -
 // The following is a JSON schema of the Message Format Specification:
@@ -210,38 +229,46 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 #include <ball_severity.h>
 
 #include <baljsn_datumutil.h>
-#include <baljsn_simpleformatter.h>
+#include <baljsn_printutil.h>
 
 #include <bdld_manageddatum.h>
 
+#include <bdlde_utf8util.h>
+
 #include <bdldfp_decimal.h>
 
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 
+#include <bdlma_bufferedsequentialallocator.h>
+
 #include <bdls_pathutil.h>
 
 #include <bdlsb_fixedmemoutstreambuf.h>
 
+#include <bdlt_date.h>
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bslim_printer.h>
 
 #include <bslma_allocatorutil.h>
 #include <bslma_managedptr.h>
 
 #include <bsls_annotation.h>
-#include <bsls_platform.h>
+#include <bsls_keyword.h>
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 #include <bsl_c_stdlib.h>
 #include <bsl_c_stdio.h>   // for 'snprintf'
 
@@ -309,6 +336,8 @@ bsl::string_view getDefaultFormat()
     return buffer;
 }
 
+class JsonWriter;
+
 }  // close unnamed namespace within BloombergLP::ball
 
                    // ========================================
@@ -336,10 +365,9 @@ class RecordJsonFormatter_FieldFormatter {
     virtual void deleteSelf(const bsl::allocator<> allocator) = 0;
 
     /// Format a field of the specified `record` and render it to the
-    /// specified `formatter`.  Return 0 on success, and a non-zero value
+    /// specified `writer`.  Return 0 on success, and a non-zero value
     /// otherwise.
-    virtual
-    int format(baljsn::SimpleFormatter *formatter, const Record& record) = 0;
+    virtual int format(JsonWriter *writer, const Record& record) = 0;
 
     virtual int parse(bdld::DatumMapRef v) = 0;
        // Parse the specified 'v' datum map and initialize this object with the
@@ -349,6 +377,135 @@ class RecordJsonFormatter_FieldFormatter {
 
 namespace {
 
+                              // ================
+                              // class MemberName
+                              // ================
+
+/// This class holds the name of a member of the JSON object rendered for a
+/// record, encoded as it appears in the output: quoted, escaped, and
+/// followed by the ':' separator.  If the name is not valid UTF-8, the
+/// encoded name is empty (as `baljsn::SimpleFormatter` omits such a name).
+class MemberName {
+
+    // DATA
+    bsl::string d_encodedName;  // encoded name, including the separator
+
+  public:
+    // TYPES
+    typedef bsl::allocator<> allocator_type;
+
+    // CREATORS
+
+    /// Create a member name having the specified `name`.  Use the specified
+    /// `allocator` (e.g., the address of a `bslma::Allocator` object) to
+    /// supply memory.
+    MemberName(const bsl::string_view& name, const allocator_type& allocator);
+
+    // MANIPULATORS
+
+    /// Set the name of this object to the specified `name`, and return a
+    /// reference providing modifiable access to this object.
+    MemberName& operator=(const bsl::string_view& name);
+
+    // ACCESSORS
+
+    /// Return the encoded name held by this object.
+    const bsl::string& encodedName() const;
+};
+
+                              // ================
+                              // class JsonWriter
+                              // ================
+
+/// This class provides a mechanism for rendering the JSON object describing
+/// a single record in the compact style of `baljsn::SimpleFormatter`.  The
+/// output is accumulated in a fixed-size buffer, which is written to the
+/// destination stream when it is full and when `flush` is called.
+class JsonWriter {
+
+    // PRIVATE TYPES
+    enum { k_CAPACITY = 1024 };  // capacity of the buffer
+
+    // DATA
+    bsl::ostream *d_stream_p;             // destination stream (held, not
+                                          // owned)
+
+    bool          d_useComma;             // `true` if the next member must
+                                          // be preceded by a comma
+
+    bsl::size_t   d_length;               // length of buffered output
+
+    char          d_buffer[k_CAPACITY];   // buffered output
+
+    // PRIVATE MANIPULATORS
+
+    /// Append the specified `character` to the buffered output.
+    void append(char character);
+
+    /// Append the specified `length` characters starting at the specified
+    /// `data` address to the buffered output.
+    void append(const char *data, bsl::size_t length);
+
+    /// Append the specified already encoded `name` to the buffered output,
+    /// preceded by a comma if required.
+    void appendName(const MemberName& name);
+
+    /// Append the specified `name`, encoded as a JSON string and followed by
+    /// ':', to the buffered output, preceded by a comma if required.  If
+    /// `name` is not valid UTF-8, only the comma (if any) is appended.
+    void appendName(const bsl::string_view& name);
+
+    /// Append the specified `value` to the buffered output, and return 0.
+    int appendValue(int value);
+    int appendValue(long long value);
+    int appendValue(unsigned int value);
+    int appendValue(unsigned long long value);
+
+    /// Append the specified `value`, encoded as a JSON string, to the
+    /// buffered output.  Return 0 on success, and a non-zero value, with no
+    /// effect, if `value` is not valid UTF-8.  Note that the characters
+    /// escaped are those escaped by `bdljsn::StringUtil::writeString` (with
+    /// forward slashes escaped).
+    int appendValue(const bsl::string_view& value);
+
+  private:
+    // NOT IMPLEMENTED
+    JsonWriter(const JsonWriter&) BSLS_KEYWORD_DELETED;
+    JsonWriter& operator=(const JsonWriter&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a writer that renders to the specified `stream`.
+    explicit JsonWriter(bsl::ostream *stream);
+
+    /// Destroy this object.  The behavior is undefined unless `flush` was
+    /// called after the last output.
+    //! ~JsonWriter() = default;
+
+    // MANIPULATORS
+
+    /// Add a member having the specified `name` and the specified `value` to
+    /// the JSON object being rendered.  `name` is either a `MemberName` or a
+    /// string, and `value` is either an integer or a string.  Return 0 on
+    /// success, and a non-zero value if `value` is a string that is not
+    /// valid UTF-8 (in which case only `name` is rendered).
+    template <class NAME, class TYPE>
+    int addValue(const NAME& name, const TYPE& value);
+
+    /// Append the specified `text` verbatim to the buffered output.
+    void addText(const bsl::string_view& text);
+
+    /// Close the JSON object being rendered.
+    void closeObject();
+
+    /// Write the buffered output to the destination stream.
+    void flush();
+
+    /// Open the JSON object to be rendered.
+    void openObject();
+};
+
                    // ========================
                    // class TimestampFormatter
                    // ========================
@@ -377,12 +534,50 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
         e_FORMAT_ISO_8601  = 1
     };
 
+    enum {
+        k_MAX_SECONDS_LENGTH = 32  // capacity of the buffer holding the
+                                   // timestamp truncated to whole seconds
+    };
+
     // DATA
-    bsl::string               d_name;
+    MemberName                d_name;
     Format                    d_format;
     TimeZone                  d_timeZone;
     FractionalSecondPrecision d_precision;
 
+    bsls::SpinLock            d_cacheLock;      // guards the cached values
+
+    bdlt::Date                d_cachedDate;     // date of cached timestamp
+
+    int                       d_cachedSecondOfDay;
+                                                // second of the day of the
+                                                // cached timestamp, or -1 if
+                                                // there is none
+
+    int                       d_cachedLength;   // length of `d_cachedText`
+
+    char                      d_cachedText[k_MAX_SECONDS_LENGTH];
+                                                // cached timestamp, truncated
+                                                // to whole seconds
+
+    // PRIVATE ACCESSORS
+
+    /// Write to the specified `buffer` the specified `datetime`, truncated
+    /// to whole seconds, in the format of this object, and return the
+    /// number of characters written.  `buffer` is not null-terminated.  The
+    /// behavior is undefined unless `buffer` has room for at least
+    /// `k_MAX_SECONDS_LENGTH` characters.
+    int generateSeconds(char *buffer, const bdlt::Datetime& datetime) const;
+
+    // PRIVATE MANIPULATORS
+
+    /// Write to the specified `buffer` the specified `datetime`, truncated
+    /// to whole seconds, in the format of this object, and return the
+    /// number of characters written.  Use the rendering cached by this
+    /// object if it has the same date and second of the day as `datetime`
+    /// and the cache is not in use by another thread.
+    int renderSeconds(char *buffer, const bdlt::Datetime& datetime);
+
   public:
     // TYPES
     typedef bsl::allocator<>  allocator_type;
@@ -397,6 +592,8 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     , d_format(e_FORMAT_ISO_8601)
     , d_timeZone(e_TZ_UTC)
     , d_precision(e_FSP_MILLISECONDS)
+    , d_cachedSecondOfDay(-1)
+    , d_cachedLength(0)
     {}
 
     // MANIPULATORS
@@ -405,10 +602,10 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'timestamp' field of the specified 'record' and render it
-        // to the specified 'formatter'.  Return 0 on success, and a non-zero
+        // to the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 
     int parse(bdld::DatumMapRef v) BSLS_KEYWORD_OVERRIDE;
@@ -432,7 +629,7 @@ class ThreadIdFormatter : public RecordJsonFormatter_FieldFormatter {
     };
 
     // DATA
-    bsl::string d_name;
+    MemberName  d_name;
     Format      d_format;
 
   public:
@@ -456,10 +653,10 @@ class ThreadIdFormatter : public RecordJsonFormatter_FieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'tid' field of the specified 'record' and render it to
-        // the specified 'formatter'.  Return 0 on success, and a non-zero
+        // the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 
     int parse(bdld::DatumMapRef v) BSLS_KEYWORD_OVERRIDE;
@@ -478,7 +675,7 @@ class ThreadIdFormatter : public RecordJsonFormatter_FieldFormatter {
 class FixedFieldFormatter : public RecordJsonFormatter_FieldFormatter {
 
     // DATA
-    bsl::string d_name;
+    MemberName d_name;
 
   public:
     // TYPES
@@ -489,8 +686,8 @@ class FixedFieldFormatter : public RecordJsonFormatter_FieldFormatter {
     /// Create fixed field formatter object.  Use the specified
     /// `allocator` (e.g., the address of a `bslma::Allocator` object) to
     /// supply memory.
-    FixedFieldFormatter(const bsl::string&    name,
-                        const allocator_type& allocator)
+    FixedFieldFormatter(const bsl::string_view& name,
+                        const allocator_type&   allocator)
     : d_name(name, allocator)
     {}
 
@@ -501,7 +698,7 @@ class FixedFieldFormatter : public RecordJsonFormatter_FieldFormatter {
        // value otherwise.
 
     // ACCESSORS
-    const bsl::string& name() const;
+    const MemberName& name() const;
       // Return the name of the log record field or attribute.
 };
 
@@ -531,10 +728,10 @@ class ProcessIdFormatter : public FixedFieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'pid' field of the specified 'record' and render it to
-        // the specified 'formatter'.  Return 0 on success, and a non-zero
+        // the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 };
 
@@ -564,10 +761,10 @@ class LineFormatter : public FixedFieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'line' field of the specified 'record' and render it to
-        // the specified 'formatter'.  Return 0 on success, and a non-zero
+        // the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 };
 
@@ -597,10 +794,10 @@ class CategoryFormatter : public FixedFieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'category' field of the specified 'record' and render it
-        // to the specified 'formatter'.  Return 0 on success, and a non-zero
+        // to the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 };
 
@@ -630,10 +827,10 @@ class SeverityFormatter : public FixedFieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'severity' field of the specified 'record' and render it
-        // to the specified 'formatter'.  Return 0 on success, and a non-zero
+        // to the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 };
 
@@ -663,10 +860,10 @@ class MessageFormatter : public FixedFieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'messaged' field of the specified 'record' and render it
-        // to the specified 'formatter'.  Return 0 on success, and a non-zero
+        // to the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 };
 
@@ -685,7 +882,7 @@ class FileFormatter : public RecordJsonFormatter_FieldFormatter {
     };
 
     // DATA
-    bsl::string d_name;
+    MemberName  d_name;
     Path        d_path;
 
   public:
@@ -707,10 +904,10 @@ class FileFormatter : public RecordJsonFormatter_FieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Format the 'file' field of the specified 'record' and render it to
-        // the specified 'formatter'.  Return 0 on success, and a non-zero
+        // the specified 'writer'.  Return 0 on success, and a non-zero
         // value otherwise.
 
     int parse(bdld::DatumMapRef v) BSLS_KEYWORD_OVERRIDE;
@@ -731,6 +928,7 @@ class AttributeFormatter : public RecordJsonFormatter_FieldFormatter {
 
     // DATA
     bsl::string d_key;    // attribute's key
+    MemberName  d_name;   // attribute's key, encoded as a member name
     int         d_index;  // cached attribute's index
 
   public:
@@ -744,6 +942,7 @@ class AttributeFormatter : public RecordJsonFormatter_FieldFormatter {
        // attribute to be rendered.  Use the specified 'allocator' (e.g., the
         // address of a 'bslma::Allocator' object) to supply memory.
     : d_key(key, allocator)
+    , d_name(key, allocator)
     , d_index(k_UNSET)
     {}
 
@@ -753,11 +952,11 @@ class AttributeFormatter : public RecordJsonFormatter_FieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Render an attribute having the key supplied at construction of this
         // object and provided by the specified 'record' to the specified
-        // 'formatter'.  Return 0 on success, and a non-zero value otherwise.
+        // 'writer'.  Return 0 on success, and a non-zero value otherwise.
 
     int parse(bdld::DatumMapRef v) BSLS_KEYWORD_OVERRIDE;
        // Parse the specified 'v' datum map and initialize this object with the
@@ -824,11 +1023,11 @@ class AttributesFormatter : public RecordJsonFormatter_FieldFormatter {
     /// specified `allocator`.
     void deleteSelf(const bsl::allocator<> allocator) BSLS_KEYWORD_OVERRIDE;
 
-    int format(baljsn::SimpleFormatter *formatter, const Record& record)
+    int format(JsonWriter *writer, const Record& record)
                                                          BSLS_KEYWORD_OVERRIDE;
         // Render all user attributes in the specified 'record' except
         // attributes whose keys are listed in the collection supplied at
-        // construction of this object to the specified 'formatter'.  Return 0
+        // construction of this object to the specified 'writer'.  Return 0
         // on success, and a non-zero value otherwise.
 
     int parse(bdld::DatumMapRef v) BSLS_KEYWORD_OVERRIDE;
@@ -905,11 +1104,12 @@ struct FormatUtil {
 
     // CLASS METHODS
 
-    /// Add the specified `attribute` having the specified `name` to
-    /// `formatter`.
-    static int formatAttribute(baljsn::SimpleFormatter *formatter,
+    /// Add the specified `attribute` having the specified `name` to the
+    /// specified `writer`.  `name` is either a `MemberName` or a string.
+    template <class NAME>
+    static int formatAttribute(JsonWriter              *writer,
                                const ManagedAttribute&  attribute,
-                               const bsl::string_view&  name);
+                               const NAME&              name);
 };
 
                         // ===============================
@@ -951,18 +1151,316 @@ class FieldFormattersDestructor {
     }
 };
 
+                              // ----------------
+                              // class MemberName
+                              // ----------------
+
+// CREATORS
+MemberName::MemberName(const bsl::string_view& name,
+                       const allocator_type&   allocator)
+: d_encodedName(allocator)
+{
+    *this = name;
+}
+
+// MANIPULATORS
+MemberName& MemberName::operator=(const bsl::string_view& name)
+{
+    bsl::ostringstream stream(d_encodedName.get_allocator());
+
+    baljsn::EncoderOptions options;
+    if (0 == baljsn::PrintUtil::printValue(stream, name, &options)) {
+        stream << ':';
+    }
+    else {
+        stream.str(bsl::string());
+    }
+
+    d_encodedName.assign(stream.view().data(), stream.view().length());
+    return *this;
+}
+
+// ACCESSORS
+inline
+const bsl::string& MemberName::encodedName() const
+{
+    return d_encodedName;
+}
+
+                              // ----------------
+                              // class JsonWriter
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+inline
+void JsonWriter::append(char character)
+{
+    if (k_CAPACITY == d_length) {
+        flush();
+    }
+    d_buffer[d_length++] = character;
+}
+
+inline
+void JsonWriter::append(const char *data, bsl::size_t length)
+{
+    if (k_CAPACITY - d_length < length) {
+        flush();
+
+        if (k_CAPACITY <= length) {
+            d_stream_p->write(data, static_cast<bsl::streamsize>(length));
+            return;                                                   // RETURN
+        }
+    }
+    bsl::memcpy(d_buffer + d_length, data, length);
+    d_length += length;
+}
+
+inline
+void JsonWriter::appendName(const MemberName& name)
+{
+    if (d_useComma) {
+        append(',');
+    }
+    d_useComma = true;
+
+    append(name.encodedName().data(), name.encodedName().length());
+}
+
+void JsonWriter::appendName(const bsl::string_view& name)
+{
+    if (d_useComma) {
+        append(',');
+    }
+    d_useComma = true;
+
+    if (0 == appendValue(name)) {
+        append(':');
+    }
+}
+
+int JsonWriter::appendValue(int value)
+{
+    char  buffer[16];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value);
+    append(buffer, end - buffer);
+    return 0;
+}
+
+int JsonWriter::appendValue(long long value)
+{
+    char  buffer[32];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value);
+    append(buffer, end - buffer);
+    return 0;
+}
+
+int JsonWriter::appendValue(unsigned int value)
+{
+    char  buffer[16];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value);
+    append(buffer, end - buffer);
+    return 0;
+}
+
+int JsonWriter::appendValue(unsigned long long value)
+{
+    char  buffer[32];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value);
+    append(buffer, end - buffer);
+    return 0;
+}
+
+int JsonWriter::appendValue(const bsl::string_view& value)
+{
+    // `k_ESCAPES[c]` is the character following the backslash in the escape
+    // sequence of the character `c`, or 0 if `c` is not escaped.
+
+    static const char k_ESCAPES[256] = {
+        'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',  // 0x00 - 0x07
+        'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',  // 0x08 - 0x0F
+        'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',  // 0x10 - 0x17
+        'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',  // 0x18 - 0x1F
+         0,   0,  '"',  0,   0,   0,   0,   0,   // 0x20 - 0x27
+         0,   0,   0,   0,   0,   0,   0,  '/',  // 0x28 - 0x2F
+         0,   0,   0,   0,   0,   0,   0,   0,   // 0x30 - 0x37
+         0,   0,   0,   0,   0,   0,   0,   0,   // 0x38 - 0x3F
+         0,   0,   0,   0,   0,   0,   0,   0,   // 0x40 - 0x47
+         0,   0,   0,   0,   0,   0,   0,   0,   // 0x48 - 0x4F
+         0,   0,   0,   0,   0,   0,   0,   0,   // 0x50 - 0x57
+         0,   0,   0,   0,  '\\', 0,   0,   0,   // 0x58 - 0x5F
+    };
+
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    const char *const begin = value.data();
+    const char *const end   = begin + value.length();
+
+    // Only strings having non-ASCII characters need to be validated.
+
+    unsigned char bits = 0;
+    for (const char *iter = begin; iter < end; ++iter) {
+        bits |= static_cast<unsigned char>(*iter);
+    }
+    if (0 != (bits & 0x80)
+     && !bdlde::Utf8Util::isValid(begin, static_cast<int>(value.length()))) {
+        return -2;                                                    // RETURN
+    }
+
+    append('"');
+
+    const char *currentStart = begin;
+    for (const char *iter = begin; iter < end; ++iter) {
+        const unsigned char character = static_cast<unsigned char>(*iter);
+        const char          escape    = k_ESCAPES[character];
+
+        if (0 == escape) {
+            continue;                                               // CONTINUE
+        }
+
+        append(currentStart, iter - currentStart);
+        currentStart = iter + 1;
+
+        if ('u' == escape) {
+            const char sequence[] = { '\\',
+                                      'u',
+                                      '0',
+                                      '0',
+                                      k_HEX_DIGITS[character >> 4],
+                                      k_HEX_DIGITS[character & 0x0F] };
+            append(sequence, sizeof sequence);
+        }
+        else {
+            const char sequence[] = { '\\', escape };
+            append(sequence, sizeof sequence);
+        }
+    }
+    append(currentStart, end - currentStart);
+
+    append('"');
+    return 0;
+}
+
+// CREATORS
+inline
+JsonWriter::JsonWriter(bsl::ostream *stream)
+: d_stream_p(stream)
+, d_useComma(false)
+, d_length(0)
+{
+    BSLS_ASSERT(stream);
+}
+
+// MANIPULATORS
+template <class NAME, class TYPE>
+inline
+int JsonWriter::addValue(const NAME& name, const TYPE& value)
+{
+    appendName(name);
+    return appendValue(value);
+}
+
+inline
+void JsonWriter::addText(const bsl::string_view& text)
+{
+    append(text.data(), text.length());
+}
+
+inline
+void JsonWriter::closeObject()
+{
+    append('}');
+    d_useComma = true;
+}
+
+inline
+void JsonWriter::flush()
+{
+    if (d_length) {
+        d_stream_p->write(d_buffer, static_cast<bsl::streamsize>(d_length));
+        d_length = 0;
+    }
+}
+
+inline
+void JsonWriter::openObject()
+{
+    if (d_useComma) {
+        append(',');
+    }
+    append('{');
+    d_useComma = false;
+}
+
                    // ------------------------
                    // class TimestampFormatter
                    // ------------------------
 
+// PRIVATE ACCESSORS
+int TimestampFormatter::generateSeconds(char                  *buffer,
+                                        const bdlt::Datetime&  datetime) const
+{
+    if (e_FORMAT_ISO_8601 == d_format) {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(0);
+
+        return bdlt::Iso8601Util::generateRaw(buffer,
+                                              datetime,
+                                              config);                // RETURN
+    }
+
+    return datetime.printToBuffer(buffer, k_MAX_SECONDS_LENGTH, 0);
+}
+
+// PRIVATE MANIPULATORS
+int TimestampFormatter::renderSeconds(char                  *buffer,
+                                      const bdlt::Datetime&  datetime)
+{
+    if (0 != d_cacheLock.tryLock()) {
+        // Another thread is using the cache; do not wait for it.
+
+        return generateSeconds(buffer, datetime);                     // RETURN
+    }
+
+    int hour;
+    int minute;
+    int second;
+
+    datetime.getTime(&hour, &minute, &second);
+
+    const bdlt::Date date        = datetime.date();
+    const int        secondOfDay = (hour * 60 + minute) * 60 + second;
+
+    if (secondOfDay != d_cachedSecondOfDay || date != d_cachedDate) {
+        d_cachedLength      = generateSeconds(d_cachedText, datetime);
+        d_cachedDate        = date;
+        d_cachedSecondOfDay = secondOfDay;
+    }
+
+    const int length = d_cachedLength;
+    bsl::memcpy(buffer, d_cachedText, length);
+
+    d_cacheLock.unlock();
+
+    return length;
+}
+
 // MANIPULATORS
 void TimestampFormatter::deleteSelf(const bsl::allocator<> allocator)
 {
     AllocUtil::deleteObject(allocator, this);
 }
 
-int TimestampFormatter::format(baljsn::SimpleFormatter *formatter,
-                               const Record&            record)
+int TimestampFormatter::format(JsonWriter    *writer,
+                               const Record&  record)
 {
     bdlt::DatetimeInterval  offset;
 
@@ -973,46 +1471,54 @@ int TimestampFormatter::format(baljsn::SimpleFormatter *formatter,
 
         offset.setTotalSeconds(localTimeOffsetInSeconds);
     }
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
 
-    switch (d_format) {
-      case e_FORMAT_ISO_8601: {
-        bdlt::Iso8601UtilConfiguration config;
+    const bdlt::Datetime localDatetime = record.fixedFields().timestamp()
+                                       + offset;
 
-        config.setFractionalSecondPrecision(d_precision);
-        config.setUseZAbbreviationForUtc(true);
+    char  buffer[k_MAX_SECONDS_LENGTH + 16];
+    char *p = buffer + renderSeconds(buffer, localDatetime);
 
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+    if (e_FSP_NONE != d_precision) {
+        int millisecond;
+        int microsecond;
 
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-        int rc = formatter->addValue(d_name,
-                                     bsl::string_view(buffer, outputLength));
-        if (rc) {
-            return rc;                                                // RETURN
+        localDatetime.getTime(0, 0, 0, &millisecond, &microsecond);
+
+        int value = e_FSP_MILLISECONDS == d_precision
+                    ? millisecond
+                    : millisecond * 1000 + microsecond;
+
+        *p++ = '.';
+        p += d_precision;
+        for (char *digit = p; digit != p - d_precision; value /= 10) {
+            *--digit = static_cast<char>('0' + value % 10);
         }
-      } break;
-      case e_FORMAT_BDE_PRINT: {
-        char buffer[32];
+    }
 
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                d_precision);
+    if (e_FORMAT_ISO_8601 == d_format) {
+        int offsetInMinutes = static_cast<int>(offset.totalMinutes());
 
-        int rc = formatter->addValue(d_name, buffer);
-        if (rc) {
-            return rc;                                                // RETURN
+        if (0 == offsetInMinutes) {
+            *p++ = 'Z';
+        }
+        else {
+            *p++ = offsetInMinutes < 0 ? '-' : '+';
+
+            offsetInMinutes = offsetInMinutes < 0 ? -offsetInMinutes
+                                                  :  offsetInMinutes;
+
+            const int hours   = offsetInMinutes / 60;
+            const int minutes = offsetInMinutes % 60;
+
+            *p++ = static_cast<char>('0' + hours / 10);
+            *p++ = static_cast<char>('0' + hours % 10);
+            *p++ = ':';
+            *p++ = static_cast<char>('0' + minutes / 10);
+            *p++ = static_cast<char>('0' + minutes % 10);
         }
-      } break;
-      default: {
-          BSLS_ASSERT(0 == "Unexpected timestamp format");
-          return -1;                                                  // RETURN
-      }
     }
 
-    return 0;
+    return writer->addValue(d_name, bsl::string_view(buffer, p - buffer));
 }
 
 int TimestampFormatter::parse(bdld::DatumMapRef v)
@@ -1061,6 +1567,11 @@ int TimestampFormatter::parse(bdld::DatumMapRef v)
             }
         }
     }
+
+    // Discard the cached rendering, as the format may have changed.
+
+    d_cachedSecondOfDay = -1;
+
     return 0;
 }
 
@@ -1074,30 +1585,28 @@ void ThreadIdFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int ThreadIdFormatter::format(baljsn::SimpleFormatter *formatter,
-                              const Record&            record)
+int ThreadIdFormatter::format(JsonWriter    *writer,
+                              const Record&  record)
 {
     int rc = 0;
     switch (d_format) {
       case e_DECIMAL: {
-        rc = formatter->addValue(d_name, record.fixedFields().threadID());
+        rc = writer->addValue(d_name, record.fixedFields().threadID());
       } break;
       case e_HEXADECIMAL: {
-        char buffer[32];
+        static const char k_HEX_DIGITS[] = "0123456789ABCDEF";
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+        char                buffer[32];
+        char               *p     = buffer + sizeof buffer;
+        bsls::Types::Uint64 value = record.fixedFields().threadID();
 
-        snprintf(buffer,
-                 sizeof(buffer),
-                 "%llX",
-                 record.fixedFields().threadID());
+        do {
+            *--p = k_HEX_DIGITS[value & 0xF];
+            value >>= 4;
+        } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        rc = formatter->addValue(d_name, &buffer[0]);
+        rc = writer->addValue(d_name,
+                              bsl::string_view(p, buffer + sizeof buffer - p));
       } break;
       default: {
           BSLS_ASSERT(0 == "Unexpected thread format");
@@ -1152,7 +1661,7 @@ int FixedFieldFormatter::parse(bdld::DatumMapRef v)
 
 // ACCESSORS
 inline
-const bsl::string& FixedFieldFormatter::name() const
+const MemberName& FixedFieldFormatter::name() const
 {
     return d_name;
 }
@@ -1167,10 +1676,10 @@ void ProcessIdFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int ProcessIdFormatter::format(baljsn::SimpleFormatter *formatter,
-                               const Record&            record)
+int ProcessIdFormatter::format(JsonWriter    *writer,
+                               const Record&  record)
 {
-    return formatter->addValue(name(), record.fixedFields().processID());
+    return writer->addValue(name(), record.fixedFields().processID());
 }
 
                    // -------------------
@@ -1183,10 +1692,10 @@ void LineFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int LineFormatter::format(baljsn::SimpleFormatter *formatter,
-                          const Record&            record)
+int LineFormatter::format(JsonWriter    *writer,
+                          const Record&  record)
 {
-    return formatter->addValue(name(), record.fixedFields().lineNumber());
+    return writer->addValue(name(), record.fixedFields().lineNumber());
 }
 
                    // -----------------------
@@ -1199,10 +1708,10 @@ void CategoryFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int CategoryFormatter::format(baljsn::SimpleFormatter *formatter,
-                              const Record&            record)
+int CategoryFormatter::format(JsonWriter    *writer,
+                              const Record&  record)
 {
-    return formatter->addValue(name(), record.fixedFields().category());
+    return writer->addValue(name(), record.fixedFields().category());
 }
 
                    // -----------------------
@@ -1214,10 +1723,10 @@ void SeverityFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int SeverityFormatter::format(baljsn::SimpleFormatter *formatter,
-                              const Record&            record)
+int SeverityFormatter::format(JsonWriter    *writer,
+                              const Record&  record)
 {
-    return formatter->addValue(name(),
+    return writer->addValue(name(),
                       Severity::toAscii(
                           static_cast<Severity::Level>(
                                             record.fixedFields().severity())));
@@ -1233,10 +1742,14 @@ void MessageFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int MessageFormatter::format(baljsn::SimpleFormatter *formatter,
-                             const Record&            record)
+int MessageFormatter::format(JsonWriter    *writer,
+                             const Record&  record)
 {
-    return formatter->addValue(name(), record.fixedFields().messageRef());
+    const bslstl::StringRef message = record.fixedFields().messageRef();
+
+    return writer->addValue(name(),
+                            bsl::string_view(message.data(),
+                                             message.length()));
 }
 
                    // -------------------
@@ -1249,22 +1762,27 @@ void FileFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int FileFormatter::format(baljsn::SimpleFormatter *formatter,
-                          const Record&            record)
+int FileFormatter::format(JsonWriter    *writer,
+                          const Record&  record)
 {
     switch (d_path) {
       case e_FULL: {
-        if (0 != formatter->addValue(d_name, record.fixedFields().fileName()))
+        if (0 != writer->addValue(d_name, record.fixedFields().fileName()))
         {
             return -1;                                                // RETURN
         }
       } break;
       case e_FILE: {
+        enum { k_BUFFER_SIZE = 256 };
+
+        char                               buffer[k_BUFFER_SIZE];
+        bdlma::BufferedSequentialAllocator allocator(buffer, k_BUFFER_SIZE);
+
         const bsl::string_view filename(record.fixedFields().fileName());
-        bsl::string basename;
+        bsl::string            basename(&allocator);
         int rc = bdls::PathUtil::getBasename(&basename, filename);
 
-        if (formatter->addValue(d_name, 0 == rc ? basename : filename))
+        if (writer->addValue(d_name, 0 == rc ? basename : filename))
         {
             return -1;                                                // RETURN
         }
@@ -1309,8 +1827,8 @@ void AttributeFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int AttributeFormatter::format(baljsn::SimpleFormatter *formatter,
-                               const Record&            record)
+int AttributeFormatter::format(JsonWriter    *writer,
+                               const Record&  record)
 {
     typedef bsl::vector<ball::ManagedAttribute> Attributes;
 
@@ -1331,13 +1849,13 @@ int AttributeFormatter::format(baljsn::SimpleFormatter *formatter,
             }
         }
         if (k_UNSET == d_index) {
-            return formatter->addValue(d_key, "N/A");                 // RETURN
+            return writer->addValue(d_name, "N/A");                   // RETURN
         }
     }
 
-    return FormatUtil::formatAttribute(formatter,
+    return FormatUtil::formatAttribute(writer,
                                        attributes.at(d_index),
-                                       d_key);
+                                       d_name);
 }
 
 int AttributeFormatter::parse(bdld::DatumMapRef v)
@@ -1347,7 +1865,8 @@ int AttributeFormatter::parse(bdld::DatumMapRef v)
             return -1;                                                // RETURN
         }
         if (k_KEY_NAME == v[i].key()) {
-            d_key = v[i].value().theString();
+            d_key  = v[i].value().theString();
+            d_name = d_key;
         }
     }
     return 0;
@@ -1381,8 +1900,8 @@ void AttributesFormatter::deleteSelf(const bsl::allocator<> allocator)
     AllocUtil::deleteObject(allocator, this);
 }
 
-int AttributesFormatter::format(baljsn::SimpleFormatter *formatter,
-                                const Record&            record)
+int AttributesFormatter::format(JsonWriter    *writer,
+                                const Record&  record)
 {
     const Attributes& attributes = record.attributes();
 
@@ -1403,7 +1922,7 @@ int AttributesFormatter::format(baljsn::SimpleFormatter *formatter,
                                d_skipAttributes_sp->find(a.key())));
         }
         if (d_cache[i].second) {
-            FormatUtil::formatAttribute(formatter, a, a.key());
+            FormatUtil::formatAttribute(writer, a, a.key());
         }
     }
     return 0;
@@ -1527,44 +2046,43 @@ int DatumParser::parse(FieldFormatters *formatters, const bdld::Datum&  v)
                        // class FormatUtil
                        // ----------------
 
-int FormatUtil::formatAttribute(baljsn::SimpleFormatter *formatter,
+template <class NAME>
+int FormatUtil::formatAttribute(JsonWriter              *writer,
                                 const ManagedAttribute&  attribute,
-                                const bsl::string_view&  name)
+                                const NAME&              name)
 {
     if (attribute.value().is<bsl::string>()) {
-        return formatter->addValue(name, attribute.value().the<bsl::string>());
+        return writer->addValue(name,
+                                attribute.value().the<bsl::string>());
                                                                       // RETURN
     }
     else if (attribute.value().is<int>()) {
-        return formatter->addValue(name, attribute.value().the<int>());
+        return writer->addValue(name, attribute.value().the<int>());
                                                                       // RETURN
     }
     else if (attribute.value().is<long>()) {
-        return formatter->addValue(name,
-                                   static_cast<long long>(
-                                       attribute.value().the<long>()));
-                                                                      // RETURN
+        return writer->addValue(name,
+                                static_cast<long long>(
+                                    attribute.value().the<long>()));  // RETURN
     }
     else if (attribute.value().is<long long>()) {
-        return formatter->addValue(name,
-                                   attribute.value().the<long long>());
+        return writer->addValue(name, attribute.value().the<long long>());
                                                                       // RETURN
     }
     else if (attribute.value().is<unsigned int>()) {
-        return formatter->addValue(name,
-                                   attribute.value().the<unsigned int>());
+        return writer->addValue(name,
+                                attribute.value().the<unsigned int>());
                                                                       // RETURN
     }
     else if (attribute.value().is<unsigned long>()) {
-        return formatter->addValue(name,
-                                   static_cast<unsigned long long>(
+        return writer->addValue(name,
+                                static_cast<unsigned long long>(
                                       attribute.value().the<unsigned long>()));
                                                                       // RETURN
     }
     else if (attribute.value().is<unsigned long long>()) {
-        return formatter->addValue(
-                                  name,
-                                  attribute.value().the<unsigned long long>());
+        return writer->addValue(name,
+                                attribute.value().the<unsigned long long>());
                                                                       // RETURN
     }
     else if (attribute.value().is<const void *>()) {
@@ -1577,7 +2095,7 @@ int FormatUtil::formatAttribute(baljsn::SimpleFormatter *formatter,
 
         printer.printHexAddr(attribute.value().the<const void *>(), 0);
 
-        return formatter->addValue(name, &storage[1]);                // RETURN
+        return writer->addValue(name, &storage[1]);                   // RETURN
     }
     return -1;
 }
@@ -1656,23 +2174,24 @@ RecordJsonFormatter& RecordJsonFormatter::operator=(
 void RecordJsonFormatter::operator()(bsl::ostream& stream,
                                      const Record& record) const
 {
-    baljsn::SimpleFormatter formatter(stream);
-    int rc;
-    formatter.openObject();
+    JsonWriter writer(&stream);
+    int        rc;
+    writer.openObject();
 
     for (FieldFormatters::const_iterator it = d_fieldFormatters.cbegin();
          it != d_fieldFormatters.cend();
          ++it)
     {
-        rc = (*it)->format(&formatter, record);
+        rc = (*it)->format(&writer, record);
         if (rc) {
-            stream << "Error: JSON encoding failure.";
+            writer.addText("Error: JSON encoding failure.");
             break;                                                     // BREAK
         }
     }
 
-    formatter.closeObject();
-    stream << d_recordSeparator;
+    writer.closeObject();
+    writer.addText(d_recordSeparator);
+    writer.flush();
     stream.flush();
 
     return;
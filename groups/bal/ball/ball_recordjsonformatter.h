@@ -400,7 +400,6 @@ BSLS_IDENT("$Id: $")
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
-namespace baljsn { class SimpleFormatter; }
 namespace ball {
 
 class Record;
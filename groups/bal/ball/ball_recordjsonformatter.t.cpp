@@ -7,8 +7,12 @@
 #include <ball_severity.h>
 #include <ball_userfields.h>
 
+#include <baljsn_printutil.h>
+
 #include <bdlf_bind.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_iso8601util.h>
@@ -24,6 +28,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
@@ -78,6 +83,8 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATING TEST
 // [ 9] USAGE EXAMPLE
+// [10] CONCERN: JSON STRING ENCODING
+// [-1] PERFORMANCE: FORMATTING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -228,6 +235,21 @@ bsls::TimeInterval LocalTimeOffsetUtil::localTimeOffset(const bdlt::Datetime&)
     return bsls::TimeInterval(d_offset, 0);
 }
 
+namespace u {
+
+/// Return the specified `value` encoded as a JSON string by
+/// `baljsn::PrintUtil`, or an empty string if `value` cannot be encoded
+/// (i.e., it is not valid UTF-8).
+bsl::string encode(const bsl::string_view& value)
+{
+    bsl::ostringstream stream;
+
+    return 0 == baljsn::PrintUtil::printValue(stream, value)
+           ? stream.str()
+           : bsl::string();
+}
+
+}  // close namespace u
 }  // close unnamed namespace
 
 //=============================================================================
@@ -252,6 +274,195 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // CONCERN: JSON STRING ENCODING
+        //
+        // Concerns:
+        // 1. Member names and string values are encoded exactly as they are
+        //    encoded by `baljsn::PrintUtil`.
+        // 2. A message that is not valid UTF-8 is reported as an encoding
+        //    failure, following the name of the member.
+        // 3. A member name that is not valid UTF-8 is omitted.
+        // 4. Records of any length are rendered in full.
+        //
+        // Plan:
+        // 1. For each string in a table of strings having characters that
+        //    are escaped, non-ASCII characters and malformed UTF-8 sequences,
+        //    and each of the strings "x<c>y", where `<c>` is any non-null
+        //    character, use `operator()` to render a record having the string
+        //    as its message, as the key of an attribute, and as the value of
+        //    an attribute, and compare the output with the expected output,
+        //    computed with `baljsn::PrintUtil`.  (C-1..3)
+        //
+        // 2. Render records having messages of increasing length, containing
+        //    characters that are escaped, and compare the output with the
+        //    expected output.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: JSON STRING ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: JSON STRING ENCODING" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> strings(&ta);
+        {
+            static const struct {
+                const char  *d_string;
+                bsl::size_t  d_length;
+            } DATA[] = {
+                { "",                  0 },
+                { "plain",             5 },
+                { "a\"b",              3 },
+                { "a\\b",              3 },
+                { "a/b",               3 },
+                { "\b\f\n\r\t",        5 },
+                { "\x01\x1f\x7f",      3 },
+                { "a\0b",              3 },
+                { "caf\xc3\xa9",       5 },
+                { "\xe2\x82\xac/\"",   5 },
+                { "\xf0\x9f\x98\x80",  4 },
+                { "\xc3",              1 },
+                { "\xff",              1 },
+                { "abc\x80",           4 },
+                { "\xed\xa0\x80",      3 },
+            };
+            enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                strings.push_back(bsl::string(DATA[ti].d_string,
+                                              DATA[ti].d_length));
+            }
+            for (int c = 1; c < 256; ++c) {
+                bsl::string string("x", &ta);
+                string.push_back(static_cast<char>(c));
+                string.push_back('y');
+                strings.push_back(string);
+            }
+        }
+
+        if (verbose) cout << "\tTesting names and values." << endl;
+
+        for (bsl::size_t ti = 0; ti < strings.size(); ++ti) {
+            const bsl::string& STRING  = strings[ti];
+            const bsl::string  ENCODED = u::encode(STRING);
+
+            if (veryVerbose) { T_ P_(ti) P(ENCODED) }
+
+            bsl::ostringstream os(&ta);
+
+            // Message
+
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(ti, 0 == mX.setFormat("[\"message\"]"));
+
+                ball::Record record(&ta);
+                record.fixedFields().setMessage(STRING);
+
+                const bsl::string EXPECTED =
+                    "{\"message\":"
+                    + (ENCODED.empty() ? bsl::string(
+                                             "Error: JSON encoding failure.")
+                                       : ENCODED)
+                    + "}\n";
+
+                os.str("");
+                X(os, record);
+                ASSERTV(ti, EXPECTED, os.str(), EXPECTED == os.str());
+            }
+
+            // Attribute key and attribute value
+
+            if (bsl::string::npos == STRING.find('\0')) {
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(ti, 0 == mX.setFormat("[\"attributes\"]"));
+
+                ball::Record record(&ta);
+                record.addAttribute(ball::Attribute(STRING.c_str(), 7, &ta));
+                record.addAttribute(ball::Attribute("key",
+                                                    STRING.c_str(),
+                                                    &ta));
+
+                const bsl::string EXPECTED =
+                    "{"
+                    + (ENCODED.empty() ? bsl::string() : ENCODED + ":")
+                    + "7,\"key\":" + ENCODED + "}\n";
+
+                os.str("");
+                X(os, record);
+                ASSERTV(ti, EXPECTED, os.str(), EXPECTED == os.str());
+            }
+
+            // Member name specified in the format
+
+            if (!ENCODED.empty()) {
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERTV(ti, 0 == mX.setFormat("[{\"message\":{\"name\":"
+                                              + ENCODED
+                                              + "}}]"));
+
+                ball::Record record(&ta);
+                record.fixedFields().setMessage("text");
+
+                const bsl::string EXPECTED = "{" + ENCODED + ":\"text\"}\n";
+
+                os.str("");
+                X(os, record);
+                ASSERTV(ti, EXPECTED, os.str(), EXPECTED == os.str());
+            }
+        }
+
+        if (verbose) cout << "\tTesting long records." << endl;
+
+        {
+            static const char PATTERN[] = "abcdefg\"hijk/lmno\npqrst\x01";
+            const bsl::size_t PATTERN_LENGTH = sizeof PATTERN - 1;
+
+            static const bsl::size_t LENGTHS[] = {
+                100, 500, 1000, 1010, 1020, 1021, 1022, 1023, 1024, 1025,
+                2047, 2048, 2049, 5000, 100000
+            };
+            enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const bsl::size_t LENGTH = LENGTHS[ti];
+
+                bsl::string message(&ta);
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    message.push_back(PATTERN[i % PATTERN_LENGTH]);
+                }
+
+                ball::Record record(&ta);
+                record.fixedFields().setMessage(message);
+
+                for (int si = 0; si < 2; ++si) {
+                    const bsl::string SPEC = si
+                                           ? "[\"message\",\"message\"]"
+                                           : "[\"message\"]";
+                    ASSERTV(ti, 0 == mX.setFormat(SPEC));
+
+                    bsl::string expected("{\"message\":", &ta);
+                    expected += u::encode(message);
+                    if (si) {
+                        expected += ",\"message\":";
+                        expected += u::encode(message);
+                    }
+                    expected += "}\n";
+
+                    bsl::ostringstream os(&ta);
+                    X(os, record);
+                    ASSERTV(LENGTH, si, expected == os.str());
+                }
+            }
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -2519,6 +2730,99 @@ int main(int argc, char *argv[])
         P(oss.str().c_str());
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORMATTING THROUGHPUT
+        //
+        // Concerns:
+        // 1. Formatting a typical record, using any of the commonly used
+        //    format specifications, is cheap relative to the cost of
+        //    publishing it.
+        //
+        // Plan:
+        // 1. For each of a set of commonly used format specifications,
+        //    format a large number of records, whose timestamps advance by
+        //    one millisecond per record, to a fixed-size stream buffer that
+        //    is rewound after each record, and report the average time taken
+        //    to format a record.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FORMATTING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FORMATTING THROUGHPUT" << endl
+                          << "==================================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        static const char *const FORMATS[] = {
+            "[\"timestamp\",\"pid\",\"tid\",\"severity\",\"file\","
+            "\"line\",\"category\",\"message\"]",
+
+            "[\"timestamp\",\"pid\",\"tid\",\"severity\",\"file\","
+            "\"line\",\"category\",\"message\",\"attributes\"]",
+
+            "[{\"timestamp\":{\"format\":\"bdePrint\"}},\"severity\","
+            "{\"file\":{\"path\":\"file\"}},\"line\",\"message\","
+            "\"name\"]"
+        };
+        enum { NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        ball::Record mR(&ta);  const ball::Record& R = mR;
+
+        ball::RecordAttributes& fixedFields = mR.fixedFields();
+
+        fixedFields.setProcessID(4242);
+        fixedFields.setThreadID(1234567);
+        fixedFields.setFileName("groups/bal/ball/ball_record.cpp");
+        fixedFields.setLineNumber(__LINE__);
+        fixedFields.setCategory("BALL.RECORDJSONFORMATTER.BENCHMARK");
+        fixedFields.setSeverity(ball::Severity::e_INFO);
+        fixedFields.setMessage("Processed request 42 of 100 in 17 ms");
+
+        mR.addAttribute(ball::Attribute("name",   "Name", &ta));
+        mR.addAttribute(ball::Attribute("number", 1234,   &ta));
+
+        const bdlt::Datetime START(2026, 10, 18, 12, 34, 56, 789);
+
+        char                        storage[1024];
+        bdlsb::FixedMemOutStreamBuf streamBuf(storage, sizeof storage);
+        bsl::ostream                stream(&streamBuf);
+
+        for (int ti = 0; ti < NUM_FORMATS; ++ti) {
+            const char *const FORMAT = FORMATS[ti];
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERTV(ti, 0 == mX.setFormat(FORMAT));
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bdlt::Datetime timestamp(START);
+                timestamp.addMilliseconds(i);
+                fixedFields.setTimestamp(timestamp);
+
+                streamBuf.pubseekpos(0);
+                X(stream, R);
+            }
+
+            timer.stop();
+
+            ASSERTV(ti, stream.good());
+
+            const double elapsed = timer.accumulatedWallTime();
+
+            cout << "Format: " << FORMAT << "\n"
+                 << "\tWall time:   " << elapsed << " s\n"
+                 << "\tUser time:   " << timer.accumulatedUserTime() << " s\n"
+                 << "\tPer record:  " << elapsed * 1e9 / NUM_RECORDS << " ns"
+                 << endl;
+        }
+      } break;
       default: {
           bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND."
                     << bsl::endl;
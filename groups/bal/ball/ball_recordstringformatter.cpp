@@ -8,8 +8,26 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 ///--------------------
 // Using the insertion operator ('operator<<') with an 'ostream' introduces
 // significant performance overhead.  For this reason, the 'operator()' method
-// is implemented by writing the formatted string to a buffer before inserting
-// to a stream.
+// is implemented by writing the formatted record to a fixed-size buffer on
+// the stack, which is written to the stream whenever it fills up and once the
+// record is complete.
+//
+// The format specification is compiled, when it is set, into a flat sequence
+// of operations, each of which either copies a run of literal text (held in
+// 'd_literals', with adjacent runs merged) or renders one field of a record.
+// 'operator()' executes these operations in a single 'switch', so that
+// formatting a record involves neither virtual or indirect calls nor the
+// intermediate strings of the previous implementation.
+//
+// Rendering the date and time of day of a timestamp is the most expensive
+// part of formatting a typical record.  Since consecutive records are very
+// likely to be logged within the same second, the whole-second part of the
+// most recently rendered timestamp is cached in each of the two layouts
+// ("DDMonYYYY_HH:MM:SS" and "YYYY-MM-DDTHH:MM:SS"), and only the fractional
+// second and the time zone offset are rendered for every record.  As
+// 'operator()' is 'const' and may be invoked concurrently, the cache is
+// guarded by a spin lock that is only ever *tried*: a thread that fails to
+// acquire it renders the timestamp without the cache.
 
 #include <ball_managedattribute.h>
 #include <ball_record.h>
@@ -18,37 +36,28 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <ball_userfields.h>
 #include <ball_userfieldvalue.h>
 
-#include <bdlf_bind.h>
-#include <bdlf_placeholder.h>
-
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdls_pathutil.h>
 
 #include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_overflowmemoutstreambuf.h>
 
-#include <bdlt_datetime.h>
-#include <bdlt_currenttime.h>
-#include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_localtimeoffset.h>
 
-#include <bdlsb_overflowmemoutstreambuf.h>
+#include <bslalg_numericformatterutil.h>
 
 #include <bslim_printer.h>
 
-#include <bsls_annotation.h>
-#include <bsls_platform.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstdio.h>    // for 'bsl::sprintf'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
-#include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 
 #include <bsl_algorithm.h>
-#include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
 
@@ -62,6 +71,9 @@ namespace BloombergLP {
 namespace ball {
 namespace {
 
+typedef RecordStringFormatter_Operation      Operation;
+typedef RecordStringFormatter_TimestampCache TimestampCache;
+
                        // ============================
                        // class PublishInLocalTimeUtil
                        // ============================
@@ -91,289 +103,252 @@ struct PublishInLocalTimeUtil {
     };
 };
 
+                             // ==================
+                             // class OutputBuffer
+                             // ==================
+
+/// This class implements a fixed-capacity character buffer that accumulates
+/// formatted output and writes it to a stream whenever it fills up and when
+/// it is flushed.
+class OutputBuffer {
+
+    // PRIVATE TYPES
+    enum { k_CAPACITY = 512 };  // capacity of the buffer
+
+    // DATA
+    bsl::ostream *d_stream_p;              // destination (held, not owned)
+    bsl::size_t   d_length;                // number of buffered characters
+    char          d_buffer[k_CAPACITY];    // buffered characters
+
+  private:
+    // NOT IMPLEMENTED
+    OutputBuffer(const OutputBuffer&);
+    OutputBuffer& operator=(const OutputBuffer&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty buffer that writes its contents to the specified
+    /// `stream`.
+    explicit OutputBuffer(bsl::ostream *stream);
+
+    // MANIPULATORS
+
+    /// Append the specified `character` to this buffer.
+    void append(char character);
+
+    /// Append the specified `length` characters starting at the specified
+    /// `data` to this buffer.
+    void append(const char *data, bsl::size_t length);
+
+    /// Append the specified `string` to this buffer.
+    void append(const bsl::string_view& string);
+
+    /// Write the contents of this buffer to the stream supplied at
+    /// construction, and empty this buffer.
+    void flush();
+};
+
                        // ===============
                        // class PrintUtil
                        // ===============
 
 /// This "struct" provides a namespace for utility functions that render
-/// values of various types to string.
+/// values of various types to an `OutputBuffer`.
 struct PrintUtil {
 
     // TYPES
-    enum FractionalSecondPrecision {
-        // Enumeration used to distinguish among different fractional second
-        // precision.
-        e_FSP_NONE         = 0,
-        e_FSP_MILLISECONDS = 3,
-        e_FSP_MICROSECONDS = 6
-    };
 
-    enum TimestampFormat {
-        // Enumeration used to distinguish among different formats of
-        // timestamp representation.
-        e_TF_DATETIME           = 0,
-        e_TF_DATETIME_TZ_OFFSET = 1,
-        e_TF_ISO8601            = 2
-    };
+    /// `Attributes` is an alias for the vector of `ball::ManagedAttribute`
+    /// objects.
+    typedef bsl::vector<ManagedAttribute> Attributes;
+
+    /// `SkipAttributes` is an alias for a set of keys of attributes that
+    /// should not be printed as part of `%a` format specifier.
+    typedef bsl::set<bsl::string_view>    SkipAttributes;
 
     // CLASS METHODS
 
     /// Append the key of the specified `attribute`, followed by the value
-    /// of `attribute` to the specified `result` string.  Optionally specify
+    /// of `attribute` to the specified `output`.  Optionally specify
     /// `printKey` to indicate whether the key should be appended or
     /// omitted.  If `printKey` is not supplied the key will be appended.
     /// Note that this method is invoked when processing "%a", "%a[key]" or
     /// "%A" specifiers.
-    static void appendAttribute(bsl::string             *result,
+    static void appendAttribute(OutputBuffer            *output,
                                 const ManagedAttribute&  attribute,
                                 bool                     printKey = true);
 
-    /// Append a category provided by the specified `record` to the
-    /// specified `result` string.  Note that this method is invoked when
-    /// processing "%c" specifier.
-    static void appendCategory(bsl::string *result, const Record& record);
-
-    /// Append to the specified `result` the datetime provided by the
-    /// specified `record` in the specified `timestampFormat`, having the
-    /// specified fractional `secondPrecision` numbers, and the specified
-    /// `timestampOffset`.  Note that this method is invoked when processing
-    /// "%d", "%D", "%dtz", "%Dtz", "%i", "%I" or  "%O" specifiers.
-    static void appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision);
+    /// Append the attribute having the specified `key` provided by the
+    /// specified `record` to the specified `output` if `record` has such an
+    /// attribute, and append nothing otherwise.  Render the attribute as
+    /// "key=value" if the specified `printKey` is `true`, and render only
+    /// its value otherwise.  Note that this method is invoked when
+    /// processing "%a[key]" or "%av[key]" specifiers.
+    static void appendAttributeByKey(OutputBuffer            *output,
+                                     const Record&            record,
+                                     const bsl::string_view&  key,
+                                     bool                     printKey);
+
+    /// Append the space-separated attributes provided by the specified
+    /// `record` to the specified `output`, except those whose keys are in
+    /// the specified `skipAttributes` collection.  If `skipAttributes` is
+    /// 0, append all the attributes of `record`.  Note that this method is
+    /// invoked when processing "%a" or "%A" specifiers.
+    static void appendAttributes(OutputBuffer         *output,
+                                 const Record&         record,
+                                 const SkipAttributes *skipAttributes);
 
     /// Append a path to a file-name provided by the specified `record` to
-    /// the specified `result` string if the specified `fullPath` is true,
-    /// and a base-name only otherwise.  Note that this method is invoked
-    /// when processing "%f" or "%F" specifiers.
-    static void appendFilename(bsl::string   *result,
+    /// the specified `output` if the specified `fullPath` is true, and a
+    /// base-name only otherwise.  Note that this method is invoked when
+    /// processing "%f" or "%F" specifiers.
+    static void appendFilename(OutputBuffer  *output,
                                bool           fullPath,
                                const Record&  record);
 
-    /// Append to the specified `result` string the uppercase hex encoding
-    /// of the byte sequence defined by the specified `string`.
-    static void appendHexDump(bsl::string             *result,
+    /// Append to the specified `output` the uppercase hex encoding of the
+    /// byte sequence defined by the specified `string`.
+    static void appendHexDump(OutputBuffer            *output,
                               const bsl::string_view&  string);
 
-    /// Append to the specified `result` a line-number provided by the
-    /// specified `record`.  Note that this method is invoked when
-    /// processing "%l" specifier.
-    static void appendLineNumber(bsl::string *result, const Record& record);
-
-    /// Append a message provided by the specified `record` to the specified
-    /// `result` string.  Note that this method is invoked when processing
-    /// "%m" specifier.
-    static void appendMessage(bsl::string *result, const Record& record);
-
-    /// Append a message with non-printable characters in hex provided by
-    /// the specified `record` to the specified `result` string.  Note that
-    /// this method is invoked when processing "%x" specifier.
-    static void appendMessageNonPrintableChars(bsl::string   *result,
-                                               const Record&  record);
-
-    /// Append a message provided by the specified `record` to the specified
-    /// `result` string in hex format.  Note that this method is invoked
-    /// when processing "%X" specifier.
-    static void appendMessageAsHex(bsl::string *result, const Record& record);
-
-    /// Append a process ID provided by the specified `record` to the
-    /// specified `result` string.  Note that this method is invoked when
-    /// processing "%p" specifier.
-    static void appendProcessId(bsl::string *result, const Record& record);
-
-    /// Append the specified `value` to the specified `result` string.  If
-    /// the optionally specified `notPrintable` flag is `true`, then all
+    /// Append the specified `value` to the specified `output` in decimal.
+    template <class INTEGER>
+    static void appendInteger(OutputBuffer *output, INTEGER value);
+
+    /// Append the specified `value` to the specified `output` in uppercase
+    /// hexadecimal.
+    static void appendIntegerAsHex(OutputBuffer        *output,
+                                   bsls::Types::Uint64  value);
+
+    /// Append the specified `value` to the specified `output`.  If the
+    /// optionally specified `notPrintable` flag is `true`, then all
     /// non-printable characters in `value` will be printed in their
     /// hexadecimal representation ('\xHH').
-    static void appendString(bsl::string             *result,
+    static void appendString(OutputBuffer            *output,
                              const bsl::string_view&  value,
                              bool                     notPrintable = false);
 
-    /// Append a thread ID provided by the specified `record` to the
-    /// specified `result` string.  Note that this method is invoked when
-    /// processing "%t" specifier.
-    static void appendThreadId(bsl::string *result, const Record& record);
-
-    /// Append a thread ID provided by the specified `record` to the
-    /// specified `result` string in hex format.  Note that this method is
-    /// invoked when processing "%T" specifier.
-    static void appendThreadIdAsHex(bsl::string *result, const Record& record);
-
-    /// Append a severity provided by the specified `record` to the
-    /// specified `result` string.  Note that this method is invoked when
-    /// processing "%s" specifier.
-    static void appendSeverity(bsl::string *result, const Record& record);
-
-    /// Append the specified `value` to the specified `result` string
-    /// according to the specified `format`.
-    template <class T>
-    static void appendValue(bsl::string  *result,
-                            const char   *format,
-                            T             value);
-
-    /// Append the specified `value` to the specified `result` string.
-    static void appendValue(bsl::string  *result, int                value);
-    static void appendValue(bsl::string  *result, long               value);
-    static void appendValue(bsl::string  *result, long long          value);
-    static void appendValue(bsl::string  *result, unsigned int       value);
-    static void appendValue(bsl::string  *result, unsigned long      value);
-    static void appendValue(bsl::string  *result, unsigned long long value);
+    /// Append to the specified `output` the timestamp provided by the
+    /// specified `record`, adjusted by the specified `timestampOffset`, in
+    /// the format indicated by the specified `code` and having the
+    /// specified `precision` number of fractional second digits.  Use the
+    /// specified `cache` to render the whole seconds of the timestamp.
+    /// Note that this method is invoked when processing "%d", "%D",
+    /// "%dtz", "%Dtz", "%i", "%I" or "%O" specifiers.
+    static void appendTimestamp(OutputBuffer                  *output,
+                                TimestampCache                *cache,
+                                const Record&                  record,
+                                const bdlt::DatetimeInterval&  timestampOffset,
+                                Operation::Code                code,
+                                int                            precision);
 
     /// Append user fields provided by the specified `record` to the
-    /// specified `result` string.  Note that this method is invoked when
+    /// specified `output`.  Note that this method is invoked when
     /// processing "%u" specifier.
-    static void appendUserFields(bsl::string *result, const Record& record);
+    static void appendUserFields(OutputBuffer *output, const Record& record);
+
+    /// Write to the specified `buffer` the low-order specified `numDigits`
+    /// decimal digits of the specified `value`, padded with leading zeros,
+    /// and return `numDigits`.  The behavior is undefined unless
+    /// `0 <= value`.
+    static int generateDigits(char *buffer, int value, int numDigits);
+
+    /// Write to the specified `buffer` the date and time of day of the
+    /// specified `datetime`, truncated to whole seconds, in the specified
+    /// `layout`, and return the number of characters written.  The
+    /// behavior is undefined unless `buffer` has room for at least
+    /// `TimestampCache::k_MAX_LENGTH` characters.
+    static int generateSeconds(char                   *buffer,
+                               const bdlt::Datetime&   datetime,
+                               TimestampCache::Layout  layout);
 };
 
-                       // ========================
-                       // class AttributeFormatter
-                       // ========================
-
-/// This class implements a functional object that renders an attribute
-/// string.
-class AttributeFormatter {
-
-    // PRIVATE TYPES
-
-    /// `Attributes` is an alias for the vector of `ball::ManagedAttribute`
-    /// objects.
-    typedef bsl::vector<ball::ManagedAttribute> Attributes;
-
-    enum { k_UNSET = -1 };  // Unspecified index
-
-    // DATA
-    const bsl::string_view d_key;        // attribute's key
-    int                    d_index;      // cached attribute's index
-    bool                   d_renderKey;  // print "key=" before value
-
-  public:
-    // CREATORS
-
-    /// Create an attribute formatter object having the specified `key` of
-    /// an attribute to be rendered.  If optionally specified `renderKey` is
-    /// `true`, render attribute as "key=value", and render only the value
-    /// of the attribute otherwize.
-    explicit
-    AttributeFormatter(const bsl::string_view& key, bool renderKey = true);
-
-    // MANIPULATORS
-
-    /// Render an attribute having the key supplied at construction of this
-    /// object and provided by the specified `record` to the specified
-    ///`result` string.
-    void operator()(bsl::string *result, const Record& record);
-};
-
-                       // =========================
-                       // class AttributesFormatter
-                       // =========================
-
-/// This class implements a functional object that renders a collection of
-/// attribute values to string.
-class AttributesFormatter {
-
-    // PRIVATE TYPES
-
-    /// `Attributes` is an alias for the vector of `ball::ManagedAttribute`
-    /// objects.
-    typedef bsl::vector<ball::ManagedAttribute>        Attributes;
-
-    /// `AttributeCache` is an alias for a vector of pairs of an attribute's
-    /// key and a flag indicating whether the attribute should be displayed
-    /// or not.
-    typedef bsl::vector<bsl::pair<bsl::string, bool> > AttributeCache;
-
-    /// `SkipAttributes` is an alias for a set of keys of attributes that
-    /// should not be printed as part of `%a` format specifier.
-    typedef bsl::set<bsl::string_view>                 SkipAttributes;
-
-    // DATA
-    const SkipAttributes *d_skipAttributes_p;  // collection of keys of skipped
-                                               // attributes (held, not owned)
-
-    AttributeCache        d_cache;             // cached attributes
-
-    // PRIVATE MANIPULATORS
-
-    /// Render all attribute provided by the specified `record` to the
-    /// specified `result` string.
-    void renderAllAttributes(bsl::string *result, const Record& record);
-
-    /// Render all attribute provided by the specified `record` except
-    /// attributes whose keys are listed in the collection supplied at
-    /// construction of this object to the specified `result` string.
-    void renderNonSkippedAttributes(bsl::string *result, const Record& record);
+                             // ------------------
+                             // class OutputBuffer
+                             // ------------------
 
-  public:
-    // TRAITS
-    BSLMF_NESTED_TRAIT_DECLARATION(AttributesFormatter,
-                                   bslma::UsesBslmaAllocator);
+// CREATORS
+inline
+OutputBuffer::OutputBuffer(bsl::ostream *stream)
+: d_stream_p(stream)
+, d_length(0)
+{
+}
 
-    // TYPES
-    typedef bsl::allocator<char> allocator_type;
+// MANIPULATORS
+inline
+void OutputBuffer::append(char character)
+{
+    if (k_CAPACITY == d_length) {
+        flush();
+    }
+    d_buffer[d_length++] = character;
+}
 
-    // CREATORS
+inline
+void OutputBuffer::append(const char *data, bsl::size_t length)
+{
+    if (k_CAPACITY - d_length < length) {
+        flush();
 
-    /// Create an attribute formatter object having the specified
-    /// `skipAttributes` collection.  Optionally specify an `allocator`
-    /// (e.g., the address of a `bslma::Allocator` object) to supply memory;
-    /// otherwise, the default allocator is used.
-    explicit AttributesFormatter(
-                          const SkipAttributes  *skipAttributes,
-                          const allocator_type&  allocator = allocator_type());
-
-    /// Create an attribute formatter initialized to the value of the
-    /// specified `original` record formatter.  Optionally specify an
-    /// `allocator` (e.g., the address of a `bslma::Allocator` object) to
-    /// supply memory; otherwise, the default allocator is used.
-    AttributesFormatter(
-                      const AttributesFormatter& original,
-                      const allocator_type&      allocator = allocator_type());
+        if (k_CAPACITY <= length) {
+            d_stream_p->write(data, static_cast<bsl::streamsize>(length));
+            return;                                                   // RETURN
+        }
+    }
+    bsl::memcpy(d_buffer + d_length, data, length);
+    d_length += length;
+}
 
-    // MANIPULATORS
+inline
+void OutputBuffer::append(const bsl::string_view& string)
+{
+    append(string.data(), string.length());
+}
 
-    /// Render all attribute provided by the specified `record` except
-    /// attributes whose keys are listed in the collection supplied at
-    /// construction of this object to the specified `result` string.
-    void operator()(bsl::string *result, const Record& record);
-};
+void OutputBuffer::flush()
+{
+    if (d_length) {
+        d_stream_p->write(d_buffer, static_cast<bsl::streamsize>(d_length));
+        d_length = 0;
+    }
+}
 
                        // ---------------
                        // class PrintUtil
                        // ---------------
 
-void PrintUtil::appendAttribute(bsl::string             *result,
+void PrintUtil::appendAttribute(OutputBuffer            *output,
                                 const ManagedAttribute&  a,
                                 bool                     printKey)
 {
     if (printKey) {
-        *result += a.key();
-        *result += '=';
+        output->append(a.key());
+        output->append('=');
     }
     if (a.value().is<bsl::string>()) {
-        *result += '"';
-        *result += a.value().the<bsl::string>();
-        *result += '"';
+        output->append('"');
+        output->append(a.value().the<bsl::string>());
+        output->append('"');
     }
     else if (a.value().is<int>()) {
-        appendValue(result, a.value().the<int>());
+        appendInteger(output, a.value().the<int>());
     }
     else if (a.value().is<long>()) {
-        appendValue(result, a.value().the<long>());
+        appendInteger(output, a.value().the<long>());
     }
     else if (a.value().is<long long>()) {
-        appendValue(result, a.value().the<long long>());
+        appendInteger(output, a.value().the<long long>());
     }
     else if (a.value().is<unsigned int>()) {
-        appendValue(result, a.value().the<unsigned int>());
+        appendInteger(output, a.value().the<unsigned int>());
     }
     else if (a.value().is<unsigned long>()) {
-        appendValue(result, a.value().the<unsigned long>());
+        appendInteger(output, a.value().the<unsigned long>());
     }
     else if (a.value().is<unsigned long long>()) {
-        appendValue(result, a.value().the<unsigned long long>());
+        appendInteger(output, a.value().the<unsigned long long>());
     }
     else if (a.value().is<const void *>()) {
 
@@ -385,145 +360,87 @@ void PrintUtil::appendAttribute(bsl::string             *result,
 
         printer.printHexAddr(a.value().the<const void *>(), 0);
 
-        appendString(result, &storage[1]);
+        output->append(&storage[1]);
     }
 }
 
-void PrintUtil::appendCategory(bsl::string *result, const Record& record)
+void PrintUtil::appendAttributeByKey(OutputBuffer            *output,
+                                     const Record&            record,
+                                     const bsl::string_view&  key,
+                                     bool                     printKey)
 {
-    *result += record.fixedFields().category();
-}
-
-void PrintUtil::appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision)
-{
-    bdlt::DatetimeInterval  offset;
+    const Attributes& attributes = record.attributes();
 
-    if (PublishInLocalTimeUtil::k_ENABLE ==
-                                          timestampOffset->totalMilliseconds())
+    for (Attributes::const_iterator i = attributes.begin();
+         i != attributes.end();
+         ++i)
     {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                              record.fixedFields().timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (PublishInLocalTimeUtil::k_DISABLE !=
-                                        timestampOffset->totalMilliseconds()) {
-        offset = *timestampOffset;
-    }
-
-    int              offsetInMinutes = static_cast<int>(offset.totalMinutes());
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               offsetInMinutes);
-
-    switch (timestampFormat) {
-      case e_TF_ISO8601: {
-        bdlt::Iso8601UtilConfiguration config;
-
-        if (secondPrecision) {
-            config.setFractionalSecondPrecision(secondPrecision);
-        }
-        config.setUseZAbbreviationForUtc(true);
-
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-
-        if (e_FSP_NONE == secondPrecision) {
-
-            enum { k_DECIMAL_SIGN_OFFSET = 19,
-                   k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-
-            bsl::string_view head(buffer, k_DECIMAL_SIGN_OFFSET);
-            bsl::string_view tail(buffer + k_TZINFO_OFFSET,
-                                  outputLength - k_TZINFO_OFFSET);
-            *result += head;
-            *result += tail;
-        }
-        else {
-            result->append(buffer, outputLength);
+        if (key == i->key()) {
+            appendAttribute(output, *i, printKey);
+            return;                                                   // RETURN
         }
-      } break;
-      case e_TF_DATETIME: {
-        char buffer[32];
-
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                secondPrecision);
-        *result += buffer;
-      } break;
-      case e_TF_DATETIME_TZ_OFFSET: {
-        char buffer[64];
-
-        // Printing local time.
-
-        int numChars = timestamp.localDatetime().printToBuffer(
-                                                              buffer,
-                                                              sizeof buffer,
-                                                              secondPrecision);
+    }
 
-        // Printing offset.
+    // If an attribute with the specified key is not found, print nothing.
+}
 
-        char       *offsetBuffer = buffer + numChars;
-        const char  sign         = offsetInMinutes < 0 ? '-' : '+';
-        offsetInMinutes          = offsetInMinutes < 0 ? -offsetInMinutes
-                                                       :  offsetInMinutes;
-        const int   hours        = offsetInMinutes / 60;
-        const int   minutes      = offsetInMinutes % 60;
+void PrintUtil::appendAttributes(OutputBuffer         *output,
+                                 const Record&         record,
+                                 const SkipAttributes *skipAttributes)
+{
+    if (skipAttributes && skipAttributes->empty()) {
+        skipAttributes = 0;
+    }
 
-        // Although an offset greater than 24 hours is undefined behavior, such
-        // invalid 'DatetimeTz' objects still can be created under certain
-        // circumstances.  We want to enable clients to detect these errors as
-        // quickly as possible (DRQS 12693813).
+    const Attributes& attributes = record.attributes();
+    bool              isFirst    = true;
 
-        if (hours < 100) {
-            bsl::snprintf(offsetBuffer,
-                          sizeof buffer - numChars,
-                          "%c%02d%02d",
-                          sign,
-                          hours,
-                          minutes);
+    for (Attributes::const_iterator i = attributes.begin();
+         i != attributes.end();
+         ++i)
+    {
+        if (skipAttributes &&
+            skipAttributes->end() !=
+                             skipAttributes->find(bsl::string_view(i->key())))
+        {
+            continue;                                               // CONTINUE
         }
-        else {
-            bsl::snprintf(offsetBuffer,
-                          sizeof buffer - numChars,
-                          "%cXX%02d",
-                          sign,
-                          minutes);
+        if (!isFirst) {
+            output->append(' ');
         }
-
-        *result += buffer;
-      } break;
+        appendAttribute(output, *i);
+        isFirst = false;
     }
 }
 
-void PrintUtil::appendFilename(bsl::string   *result,
+void PrintUtil::appendFilename(OutputBuffer  *output,
                                bool           fullPath,
                                const Record&  record)
 {
     const bsl::string_view filename(record.fixedFields().fileName());
 
     if (fullPath) {
-        *result += filename;
+        output->append(filename);
     }
     else {
-        bsl::string basename;
+        enum { k_BUFFER_SIZE = 256 };
+
+        char                               buffer[k_BUFFER_SIZE];
+        bdlma::BufferedSequentialAllocator allocator(buffer, k_BUFFER_SIZE);
+
+        bsl::string basename(&allocator);
         int rc = bdls::PathUtil::getBasename(&basename, filename);
 
         if (0 == rc) {
-            *result += basename;
+            output->append(basename);
         }
         else {
-            *result += filename;
+            output->append(filename);
         }
     }
 }
 
-void PrintUtil::appendHexDump(bsl::string             *result,
+void PrintUtil::appendHexDump(OutputBuffer            *output,
                               const bsl::string_view&  string)
 {
     static const char HEX[] = "0123456789ABCDEF";
@@ -535,89 +452,41 @@ void PrintUtil::appendHexDump(bsl::string             *result,
 
         const unsigned char c = *i;
 
-        result->push_back(HEX[(c >> 4) & 0xF]);
-        result->push_back(HEX[ c       & 0xF]);
+        output->append(HEX[(c >> 4) & 0xF]);
+        output->append(HEX[ c       & 0xF]);
     }
 }
 
-void PrintUtil::appendLineNumber(bsl::string *result, const Record& record)
+template <class INTEGER>
+void PrintUtil::appendInteger(OutputBuffer *output, INTEGER value)
 {
-    appendValue(result, record.fixedFields().lineNumber());
+    char        buffer[24];
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        value);
+    BSLS_ASSERT(end);
+
+    output->append(buffer, end - buffer);
 }
 
-void PrintUtil::appendMessage(bsl::string *result, const Record& record)
+void PrintUtil::appendIntegerAsHex(OutputBuffer        *output,
+                                   bsls::Types::Uint64  value)
 {
-    appendString(result, record.fixedFields().messageRef());
-}
-
-void PrintUtil::appendMessageNonPrintableChars(bsl::string   *result,
-                                               const Record&  record)
-{
-    appendString(result, record.fixedFields().messageRef(), true);
-}
-
-void PrintUtil::appendMessageAsHex(bsl::string *result, const Record& record)
-{
-    appendHexDump(result, record.fixedFields().messageRef());
-}
-
-template <class T>
-void PrintUtil::appendValue(bsl::string *result,
-                            const char  *format,
-                            T            value)
-{
-    char buffer[24];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, format, value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
-}
-
-void PrintUtil::appendValue(bsl::string *result, int value)
-{
-    appendValue(result, "%d", value);
-}
-
-void PrintUtil::appendValue(bsl::string  *result, long value)
-{
-    appendValue(result, "%ld", value);
-}
+    static const char HEX[] = "0123456789ABCDEF";
 
-void PrintUtil::appendValue(bsl::string  *result, long long value)
-{
-    appendValue(result, "%lld", value);
-}
+    char  buffer[16];
+    char *begin = buffer + sizeof buffer;
 
-void PrintUtil::appendValue(bsl::string  *result, unsigned int value)
-{
-    appendValue(result, "%u", value);
-}
+    do {
+        *--begin = HEX[value & 0xF];
+        value >>= 4;
+    } while (value);
 
-void PrintUtil::appendValue(bsl::string  *result, unsigned long value)
-{
-    appendValue(result, "%lu", value);
+    output->append(begin, buffer + sizeof buffer - begin);
 }
 
-void PrintUtil::appendValue(bsl::string  *result, unsigned long long value)
-{
-    appendValue(result, "%llu", value);
-}
-
-void PrintUtil::appendProcessId(bsl::string   *result,
-                                const Record&  record)
-{
-    appendValue(result, record.fixedFields().processID());
-}
-
-void PrintUtil::appendString(bsl::string             *result,
+void PrintUtil::appendString(OutputBuffer            *output,
                              const bsl::string_view&  string,
                              bool                     notPrintable)
 {
@@ -629,15 +498,16 @@ void PrintUtil::appendString(bsl::string             *result,
 
         while (endRange != end) {
             if (*endRange < 0x20 || *endRange > 0x7E) {  // not printable
-                result->append(&*startRange, bsl::distance(startRange,
+                output->append(&*startRange, bsl::distance(startRange,
                                                            endRange));
 
                 static const char HEX[] = "0123456789ABCDEF";
                 const char        value = *endRange;
 
-                *result += "\\x";
-                *result += HEX[(value >> 4) & 0xF];
-                *result += HEX[value        & 0xF];
+                output->append('\\');
+                output->append('x');
+                output->append(HEX[(value >> 4) & 0xF]);
+                output->append(HEX[value        & 0xF]);
 
                 ++endRange;
                 startRange = endRange;
@@ -647,34 +517,103 @@ void PrintUtil::appendString(bsl::string             *result,
             }
         }
         if (startRange != end) {
-            result->append(&*startRange, bsl::distance(startRange, endRange));
+            output->append(&*startRange, bsl::distance(startRange, endRange));
         }
     }
     else {
-        result->append(string.data(), string.length());
+        output->append(string);
     }
 }
 
-void PrintUtil::appendThreadId(bsl::string   *result,
-                               const Record&  record)
+void PrintUtil::appendTimestamp(OutputBuffer                  *output,
+                                TimestampCache                *cache,
+                                const Record&                  record,
+                                const bdlt::DatetimeInterval&  timestampOffset,
+                                Operation::Code                code,
+                                int                            precision)
 {
-    appendValue(result, "%llu", record.fixedFields().threadID());
-}
+    bdlt::DatetimeInterval offset;
 
-void PrintUtil::appendThreadIdAsHex(bsl::string   *result,
-                                    const Record&  record)
-{
-    appendValue(result, "%llX", record.fixedFields().threadID());
-}
+    if (PublishInLocalTimeUtil::k_ENABLE ==
+                                           timestampOffset.totalMilliseconds())
+    {
+        bsls::Types::Int64 localTimeOffsetInSeconds =
+            bdlt::LocalTimeOffset::localTimeOffset(
+                              record.fixedFields().timestamp()).totalSeconds();
+        offset.setTotalSeconds(localTimeOffsetInSeconds);
+    } else if (PublishInLocalTimeUtil::k_DISABLE !=
+                                         timestampOffset.totalMilliseconds()) {
+        offset = timestampOffset;
+    }
 
-void PrintUtil::appendSeverity(bsl::string   *result,
-                               const Record&  record)
-{
-    result->append(Severity::toAscii(static_cast<Severity::Level>(
-                                            record.fixedFields().severity())));
+    int                  offsetInMinutes =
+                                       static_cast<int>(offset.totalMinutes());
+    const bdlt::Datetime localDatetime   = record.fixedFields().timestamp()
+                                         + offset;
+
+    char  buffer[TimestampCache::k_MAX_LENGTH + 16];
+    char *p = buffer + cache->render(buffer,
+                                     localDatetime,
+                                     Operation::e_ISO8601 == code
+                                     ? TimestampCache::e_ISO8601
+                                     : TimestampCache::e_DATETIME);
+
+    if (precision) {
+        int millisecond;
+        int microsecond;
+
+        localDatetime.getTime(0, 0, 0, &millisecond, &microsecond);
+
+        *p++ = '.';
+        p += generateDigits(p,
+                            3 == precision ? millisecond
+                                           : millisecond * 1000 + microsecond,
+                            precision);
+    }
+
+    const char sign = offsetInMinutes < 0 ? '-' : '+';
+    offsetInMinutes = offsetInMinutes < 0 ? -offsetInMinutes
+                                          :  offsetInMinutes;
+    const int  hours   = offsetInMinutes / 60;
+    const int  minutes = offsetInMinutes % 60;
+
+    switch (code) {
+      case Operation::e_DATETIME_TZ: {
+        *p++ = sign;
+
+        // Although an offset greater than 24 hours is undefined behavior,
+        // such invalid 'DatetimeTz' objects still can be created under
+        // certain circumstances.  We want to enable clients to detect these
+        // errors as quickly as possible (DRQS 12693813).
+
+        if (hours < 100) {
+            p += generateDigits(p, hours, 2);
+        }
+        else {
+            *p++ = 'X';
+            *p++ = 'X';
+        }
+        p += generateDigits(p, minutes, 2);
+      } break;
+      case Operation::e_ISO8601: {
+        if (0 == offsetInMinutes) {
+            *p++ = 'Z';
+        }
+        else {
+            *p++ = sign;
+            p += generateDigits(p, hours, 2);
+            *p++ = ':';
+            p += generateDigits(p, minutes, 2);
+        }
+      } break;
+      default: {
+      } break;
+    }
+
+    output->append(buffer, p - buffer);
 }
 
-void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
+void PrintUtil::appendUserFields(OutputBuffer *output, const Record& record)
 {
     typedef UserFields Values;
     const Values& customFields    = record.customFields();
@@ -694,135 +633,106 @@ void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
         for (; it != customFields.end(); ++it) {
             os << ' ' << *it;
         }
-        result->append(streamBuffer.initialBuffer(),
+        output->append(streamBuffer.initialBuffer(),
                        streamBuffer.dataLengthInInitialBuffer());
         if (streamBuffer.overflowBuffer()) {
-            result->append(streamBuffer.overflowBuffer(),
+            output->append(streamBuffer.overflowBuffer(),
                            streamBuffer.dataLengthInOverflowBuffer());
         }
     }
 }
 
-                       // ------------------------
-                       // class AttributeFormatter
-                       // ------------------------
-
-AttributeFormatter::AttributeFormatter(const bsl::string_view& key,
-                                       bool                    renderKey)
-: d_key(key)
-, d_index(k_UNSET)
-, d_renderKey(renderKey)
+inline
+int PrintUtil::generateDigits(char *buffer, int value, int numDigits)
 {
+    BSLS_ASSERT(0 <= value);
+
+    for (char *p = buffer + numDigits; p != buffer; value /= 10) {
+        *--p = static_cast<char>('0' + value % 10);
+    }
+    return numDigits;
 }
 
-void AttributeFormatter::operator()(bsl::string *result, const Record& record)
+int PrintUtil::generateSeconds(char                   *buffer,
+                               const bdlt::Datetime&   datetime,
+                               TimestampCache::Layout  layout)
 {
-    const Attributes& attributes = record.attributes();
-    if (k_UNSET == d_index ||
-        d_index >= static_cast<int>(attributes.size()) ||
-        d_key   != attributes[d_index].key())
-    {
-        // If either d_index has not been cached before, or if it's value no
-        // longer refers to the correct attribute (because the set of collected
-        // attributes has changed) we need to try and set d_index.
-
-        d_index = k_UNSET;
-        for (Attributes::const_iterator i = attributes.begin();
-             i != attributes.end();
-             ++i)
-        {
-            if (d_key == i->key()) {
-                d_index = static_cast<int>(bsl::distance(attributes.begin(),
-                                                         i));
-                break;                                                 // BREAK
-            }
-        }
-        if (k_UNSET == d_index) {
-            // If an attribute with the specified key is not found, print
-            // nothing.
-            return;                                                   // RETURN
-        }
+    if (TimestampCache::e_ISO8601 == layout) {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(0);
+
+        return bdlt::Iso8601Util::generateRaw(buffer,
+                                              datetime,
+                                              config);                // RETURN
     }
-    PrintUtil::appendAttribute(result, attributes.at(d_index), d_renderKey);
+
+    return datetime.printToBuffer(buffer, TimestampCache::k_MAX_LENGTH, 0);
 }
 
-                       // -------------------------
-                       // class AttributesFormatter
-                       // -------------------------
+}  // close unnamed namespace
 
-AttributesFormatter::AttributesFormatter(const SkipAttributes  *skipAttributes,
-                                         const allocator_type&  allocator)
-: d_skipAttributes_p(skipAttributes)
-, d_cache(allocator)
-{
-}
+                 // ------------------------------------------
+                 // class RecordStringFormatter_TimestampCache
+                 // ------------------------------------------
 
-AttributesFormatter::AttributesFormatter(const AttributesFormatter& original,
-                                         const allocator_type&      allocator)
-: d_skipAttributes_p(original.d_skipAttributes_p)
-, d_cache(original.d_cache, allocator)
+// CREATORS
+RecordStringFormatter_TimestampCache::RecordStringFormatter_TimestampCache()
 {
+    reset();
 }
 
-void AttributesFormatter::renderAllAttributes(bsl::string   *result,
-                                              const Record&  record)
+// MANIPULATORS
+int RecordStringFormatter_TimestampCache::render(
+                                              char                  *buffer,
+                                              const bdlt::Datetime&  datetime,
+                                              Layout                 layout)
 {
-    const Attributes&          attributes = record.attributes();
-    Attributes::const_iterator i          = attributes.begin();
-    Attributes::const_iterator end        = attributes.end();
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(e_DATETIME == layout || e_ISO8601 == layout);
+
+    if (0 != d_lock.tryLock()) {
+        // Another thread is using the cache; do not wait for it.
 
-    for (;i < end; ++i) {
-        PrintUtil::appendAttribute(result, *i);
-        result->push_back(' ');
+        return PrintUtil::generateSeconds(buffer, datetime, layout);  // RETURN
     }
-}
 
-void AttributesFormatter::renderNonSkippedAttributes(bsl::string   *result,
-                                                     const Record&  record)
-{
-    const Attributes& attributes = record.attributes();
+    int hour;
+    int minute;
+    int second;
 
-    for (Attributes::size_type i = 0; i < attributes.size(); ++i) {
-        const ManagedAttribute& a = attributes[i];
+    datetime.getTime(&hour, &minute, &second);
 
-        if (i < d_cache.size()) {
-            if (d_cache[i].first != a.key()) {
-                d_cache[i].first  = a.key();
-                d_cache[i].second = d_skipAttributes_p->end() ==
-                          d_skipAttributes_p->find(bsl::string_view(a.key()));
-            }
-        }
-        else {
-            d_cache.emplace_back(
-                bsl::make_pair(
-                         a.key(),
-                         d_skipAttributes_p->end() ==
-                         d_skipAttributes_p->find(bsl::string_view(a.key()))));
-        }
-        if (d_cache[i].second) {
-            PrintUtil::appendAttribute(result, a);
-            result->push_back(' ');
-        }
+    const bdlt::Date date        = datetime.date();
+    const int        secondOfDay = (hour * 60 + minute) * 60 + second;
+
+    Entry& entry = d_entries[layout];
+
+    if (secondOfDay != entry.d_secondOfDay || date != entry.d_date) {
+        entry.d_length      = PrintUtil::generateSeconds(entry.d_text,
+                                                         datetime,
+                                                         layout);
+        entry.d_date        = date;
+        entry.d_secondOfDay = secondOfDay;
     }
+
+    const int length = entry.d_length;
+    bsl::memcpy(buffer, entry.d_text, length);
+
+    d_lock.unlock();
+
+    return length;
 }
 
-void AttributesFormatter::operator()(bsl::string *result, const Record& record)
+void RecordStringFormatter_TimestampCache::reset()
 {
-    const bsl::string::size_type len = result->length();
+    bsls::SpinLockGuard guard(&d_lock);
 
-    if (0 == d_skipAttributes_p) {
-        renderAllAttributes(result, record);
-    }
-    else {
-        renderNonSkippedAttributes(result, record);
-    }
-
-    if (len != result->length()) {
-        result->pop_back();
+    for (int i = 0; i < k_NUM_LAYOUTS; ++i) {
+        d_entries[i].d_date        = bdlt::Date();
+        d_entries[i].d_secondOfDay = -1;
+        d_entries[i].d_length      = 0;
     }
 }
-}  // close unnamed namespace
-
 
                         // ---------------------------
                         // class RecordStringFormatter
@@ -836,17 +746,53 @@ const char *RecordStringFormatter::k_BASIC_ATTRIBUTE_FORMAT =
     "\n%d %p:%t %s %f:%l %c %a %m\n";
 
 // PRIVATE MANIPULATORS
+void RecordStringFormatter::appendOperation(Operation::Code code,
+                                            int             precision,
+                                            bsl::size_t     offset,
+                                            bsl::size_t     length)
+{
+    Operation operation;
+
+    operation.d_code      = code;
+    operation.d_precision = precision;
+    operation.d_offset    = offset;
+    operation.d_length    = length;
+
+    d_operations.push_back(operation);
+}
+
+void RecordStringFormatter::appendText(const bsl::string_view& text)
+{
+    if (text.empty()) {
+        return;                                                       // RETURN
+    }
+
+    // Runs of literal text are stored contiguously in 'd_literals', so a run
+    // following another run can simply extend it.
+
+    if (!d_operations.empty() &&
+        Operation::e_TEXT == d_operations.back().d_code) {
+        d_operations.back().d_length += text.length();
+    }
+    else {
+        appendOperation(Operation::e_TEXT,
+                        0,
+                        d_literals.length(),
+                        text.length());
+    }
+    d_literals.append(text.data(), text.length());
+}
+
 void RecordStringFormatter::parseFormatSpecification()
 {
-    d_fieldFormatters.clear();
+    d_literals.clear();
+    d_operations.clear();
     d_skipAttributes.clear();
 
     bsl::string::iterator i    = d_formatSpec.begin();
     bsl::string::iterator end  = d_formatSpec.end();
     bsl::string::iterator text = end;
 
-    using namespace bdlf::PlaceHolders;
-
     while (i != end) {
         switch (*i) {
           default: {  // --------------------- text ---------------------------
@@ -860,37 +806,19 @@ void RecordStringFormatter::parseFormatSpecification()
             }
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                         _1,
-                                         bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                         false));
+                appendText(bsl::string_view(&*text, bsl::distance(text, i)));
                 text = end;
             }
             ++i;
             switch (*i) {
               case 'n': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\n",
-                                                      false));
+                appendText("\n");
               } break;
               case 't': {
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind( &PrintUtil::appendString,
-                                                      _1,
-                                                      "\t",
-                                                      false));
+                appendText("\t");
               } break;
               case '\\': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\\",
-                                                      false));
+                appendText("\\");
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -906,13 +834,7 @@ void RecordStringFormatter::parseFormatSpecification()
 
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                      bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                           _1,
-                                           bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                           false));
+                appendText(bsl::string_view(&*text, bsl::distance(text, i)));
                 text = end;
             }
 
@@ -928,22 +850,10 @@ void RecordStringFormatter::parseFormatSpecification()
                     end !=  (i + 2) &&
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%dtz')
                     i += 2;
-                    d_fieldFormatters.emplace_back(
-                       bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MILLISECONDS));
+                    appendOperation(Operation::e_DATETIME_TZ, 3);
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                    appendOperation(Operation::e_DATETIME, 3);
                 }
               } break;
               case 'D': {  // ---------------- Datetime -----------------------
@@ -952,119 +862,53 @@ void RecordStringFormatter::parseFormatSpecification()
                     end !=  (i + 2) &&
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%Dtz')
                     i += 2;
-                    d_fieldFormatters.emplace_back(
-                        bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MICROSECONDS));
+                    appendOperation(Operation::e_DATETIME_TZ, 6);
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                    appendOperation(Operation::e_DATETIME, 6);
                 }
               } break;
               case 'i': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_NONE));
+                appendOperation(Operation::e_ISO8601, 0);
               } break;
               case 'I': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                appendOperation(Operation::e_ISO8601, 3);
               } break;
               case 'O': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                appendOperation(Operation::e_ISO8601, 6);
               } break;
               case 'p': {  // ---------------- Process ID ---------------------
-                d_fieldFormatters.emplace_back(
-                              bdlf::BindUtil::bind(&PrintUtil::appendProcessId,
-                                                   _1,
-                                                   _2));
+                appendOperation(Operation::e_PROCESS_ID);
               } break;
               case 't': {  // ---------------- Thread ID ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendThreadId,
-                                                    _1,
-                                                    _2));
+                appendOperation(Operation::e_THREAD_ID);
               } break;
               case 'T': {  // ---------------- Thread ID hex ------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendThreadIdAsHex,
-                                               _1,
-                                               _2));
+                appendOperation(Operation::e_THREAD_ID_HEX);
               } break;
               case 's': {  // ---------------- Severity -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendSeverity,
-                                                    _1,
-                                                    _2));
+                appendOperation(Operation::e_SEVERITY);
               } break;
               case 'f': {  // ---------------- Filename -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    true,
-                                                    _2));
+                appendOperation(Operation::e_FILENAME);
               } break;
               case 'F': {  // ---------------- Filename ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    false,
-                                                    _2));
+                appendOperation(Operation::e_BASENAME);
               } break;
               case 'l': {  // ---------------- Line Number --------------------
-                d_fieldFormatters.emplace_back(
-                             bdlf::BindUtil::bind(&PrintUtil::appendLineNumber,
-                                                  _1,
-                                                  _2));
+                appendOperation(Operation::e_LINE_NUMBER);
               } break;
               case 'c': {  // ---------------- Category -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendCategory,
-                                                    _1,
-                                                    _2));
+                appendOperation(Operation::e_CATEGORY);
               } break;
               case 'm': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind(&PrintUtil::appendMessage,
-                                                     _1,
-                                                     _2));
+                appendOperation(Operation::e_MESSAGE);
               } break;
               case 'x': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(
-                                    &PrintUtil::appendMessageNonPrintableChars,
-                                    _1,
-                                    _2));
+                appendOperation(Operation::e_MESSAGE_PRINTABLE);
               } break;
               case 'X': {  // ---------------- Message as hex -----------------
-                d_fieldFormatters.emplace_back(
-                           bdlf::BindUtil::bind(&PrintUtil::appendMessageAsHex,
-                                                _1,
-                                                _2));
+                appendOperation(Operation::e_MESSAGE_HEX);
               } break;
               case 'a': {  // ---------------- Attributes (%a/%av) ------------
                 bsl::string::iterator j = i + 1;
@@ -1079,8 +923,13 @@ void RecordStringFormatter::parseFormatSpecification()
                     if (keyEnd != end) {
                         const bsl::string_view key(j + 1,
                                                    bsl::distance(j+1, keyEnd));
-                        d_fieldFormatters.emplace_back(
-                                           AttributeFormatter(key, renderKey));
+                        appendOperation(renderKey
+                                        ? Operation::e_ATTRIBUTE
+                                        : Operation::e_ATTRIBUTE_VALUE,
+                                        0,
+                                        bsl::distance(d_formatSpec.begin(),
+                                                      j + 1),
+                                        key.length());
                         if (d_skipAttributes.end() ==
                             d_skipAttributes.find(key))
                         {
@@ -1090,21 +939,14 @@ void RecordStringFormatter::parseFormatSpecification()
                     }
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
-                        AttributesFormatter(&d_skipAttributes,
-                                            d_skipAttributes.get_allocator()));
+                    appendOperation(Operation::e_ATTRIBUTES);
                 }
               } break;
               case 'A': {  // ---------------- Attributes (%A) ----------------
-                d_fieldFormatters.emplace_back(
-                        AttributesFormatter(0,
-                                            d_skipAttributes.get_allocator()));
+                appendOperation(Operation::e_ALL_ATTRIBUTES);
               } break;
               case 'u': {
-                d_fieldFormatters.emplace_back(
-                             bdlf::BindUtil::bind(&PrintUtil::appendUserFields,
-                                                  _1,
-                                                  _2));
+                appendOperation(Operation::e_USER_FIELDS);
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -1118,18 +960,15 @@ void RecordStringFormatter::parseFormatSpecification()
     }
 
     if (text != end) {
-        d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      text,
-                                                      false));
+        appendText(bsl::string_view(&*text, bsl::distance(text, end)));
     }
 }
 
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(const allocator_type& allocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
 {
@@ -1138,7 +977,8 @@ RecordStringFormatter::RecordStringFormatter(const allocator_type& allocator)
 
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
-, d_fieldFormatters(basicAllocator)
+, d_literals(basicAllocator)
+, d_operations(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
 {
@@ -1148,7 +988,8 @@ RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 RecordStringFormatter::RecordStringFormatter(const char            *format,
                                              const allocator_type&  allocator)
 : d_formatSpec(format, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
 {
@@ -1158,7 +999,8 @@ RecordStringFormatter::RecordStringFormatter(const char            *format,
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
-, d_fieldFormatters(basicAllocator)
+, d_literals(basicAllocator)
+, d_operations(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
 {
@@ -1170,7 +1012,8 @@ RecordStringFormatter::RecordStringFormatter(
                                       const bdlt::DatetimeInterval&  offset,
                                       const allocator_type&          allocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
 {
@@ -1181,7 +1024,8 @@ RecordStringFormatter::RecordStringFormatter(
                                       bool                  publishInLocalTime,
                                       const allocator_type& allocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0,
                     0,
@@ -1199,7 +1043,8 @@ RecordStringFormatter::RecordStringFormatter(
                                       const bdlt::DatetimeInterval&  offset,
                                       const allocator_type&          allocator)
 : d_formatSpec(format, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
 {
@@ -1211,7 +1056,8 @@ RecordStringFormatter::RecordStringFormatter(
                                      bool                   publishInLocalTime,
                                      const allocator_type&  allocator)
 : d_formatSpec(format, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0,
                     0,
@@ -1228,7 +1074,8 @@ RecordStringFormatter::RecordStringFormatter(
                                         const RecordStringFormatter& original,
                                         const allocator_type&        allocator)
 : d_formatSpec(original.d_formatSpec, allocator)
-, d_fieldFormatters(allocator)
+, d_literals(allocator)
+, d_operations(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(original.d_timestampOffset)
 {
@@ -1256,10 +1103,12 @@ RecordStringFormatter& RecordStringFormatter::operator=(
                                               const RecordStringFormatter& rhs)
 {
     if (this != &rhs) {
+        // The compiled format specification refers to 'd_formatSpec', so it
+        // is compiled anew rather than copied.
+
         d_formatSpec      = rhs.d_formatSpec;
-        d_fieldFormatters = rhs.d_fieldFormatters;
-        d_skipAttributes  = rhs.d_skipAttributes;
         d_timestampOffset = rhs.d_timestampOffset;
+        parseFormatSpecification();
     }
 
     return *this;
@@ -1270,24 +1119,84 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
-    const int k_BUFFER_SIZE        = 512;
-    const int k_STRING_RESERVATION = k_BUFFER_SIZE -
-                                     bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
-
-    char fixedBuffer[k_BUFFER_SIZE];
-    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
-                                                       k_BUFFER_SIZE);
-    bsl::string output(&stringAllocator);
-    output.reserve(k_STRING_RESERVATION);
-
-    for (FieldStringFormatters::const_iterator i = d_fieldFormatters.cbegin();
-         i != d_fieldFormatters.cend();
+    const RecordAttributes& fixedFields = record.fixedFields();
+
+    OutputBuffer output(&stream);
+
+    for (Operations::const_iterator i = d_operations.cbegin();
+         i != d_operations.cend();
          ++i)
     {
-        (*i)(&output, record);
+        switch (i->d_code) {
+          case Operation::e_TEXT: {
+            output.append(d_literals.data() + i->d_offset, i->d_length);
+          } break;
+          case Operation::e_DATETIME:
+          case Operation::e_DATETIME_TZ:
+          case Operation::e_ISO8601: {
+            PrintUtil::appendTimestamp(&output,
+                                       &d_timestampCache,
+                                       record,
+                                       d_timestampOffset,
+                                       i->d_code,
+                                       i->d_precision);
+          } break;
+          case Operation::e_PROCESS_ID: {
+            PrintUtil::appendInteger(&output, fixedFields.processID());
+          } break;
+          case Operation::e_THREAD_ID: {
+            PrintUtil::appendInteger(&output, fixedFields.threadID());
+          } break;
+          case Operation::e_THREAD_ID_HEX: {
+            PrintUtil::appendIntegerAsHex(&output, fixedFields.threadID());
+          } break;
+          case Operation::e_SEVERITY: {
+            output.append(Severity::toAscii(
+                   static_cast<Severity::Level>(fixedFields.severity())));
+          } break;
+          case Operation::e_FILENAME: {
+            PrintUtil::appendFilename(&output, true, record);
+          } break;
+          case Operation::e_BASENAME: {
+            PrintUtil::appendFilename(&output, false, record);
+          } break;
+          case Operation::e_LINE_NUMBER: {
+            PrintUtil::appendInteger(&output, fixedFields.lineNumber());
+          } break;
+          case Operation::e_CATEGORY: {
+            output.append(fixedFields.category());
+          } break;
+          case Operation::e_MESSAGE: {
+            output.append(fixedFields.messageRef());
+          } break;
+          case Operation::e_MESSAGE_PRINTABLE: {
+            PrintUtil::appendString(&output, fixedFields.messageRef(), true);
+          } break;
+          case Operation::e_MESSAGE_HEX: {
+            PrintUtil::appendHexDump(&output, fixedFields.messageRef());
+          } break;
+          case Operation::e_ATTRIBUTE:
+          case Operation::e_ATTRIBUTE_VALUE: {
+            PrintUtil::appendAttributeByKey(
+                       &output,
+                       record,
+                       bsl::string_view(d_formatSpec.data() + i->d_offset,
+                                        i->d_length),
+                       Operation::e_ATTRIBUTE == i->d_code);
+          } break;
+          case Operation::e_ATTRIBUTES: {
+            PrintUtil::appendAttributes(&output, record, &d_skipAttributes);
+          } break;
+          case Operation::e_ALL_ATTRIBUTES: {
+            PrintUtil::appendAttributes(&output, record, 0);
+          } break;
+          case Operation::e_USER_FIELDS: {
+            PrintUtil::appendUserFields(&output, record);
+          } break;
+        }
     }
 
-    stream.write(output.c_str(), output.size());
+    output.flush();
     stream.flush();
 
     return;
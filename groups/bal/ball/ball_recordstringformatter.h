@@ -139,6 +139,8 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -146,7 +148,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bsl_functional.h>
+#include <bsls_keyword.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 #include <bsl_set.h>
@@ -157,6 +162,128 @@ namespace ball {
 
 class Record;
 
+                   // ======================================
+                   // struct RecordStringFormatter_Operation
+                   // ======================================
+
+/// PRIVATE CLASS.  For use by this component only.
+///
+/// This `struct` describes one instruction of a compiled format
+/// specification: either a run of literal text to be copied to the output,
+/// or a field of a record to be rendered.
+struct RecordStringFormatter_Operation {
+
+    // TYPES
+    enum Code {
+        e_TEXT,               // literal text
+        e_DATETIME,           // `%d`, `%D`
+        e_DATETIME_TZ,        // `%dtz`, `%Dtz`
+        e_ISO8601,            // `%i`, `%I`, `%O`
+        e_PROCESS_ID,         // `%p`
+        e_THREAD_ID,          // `%t`
+        e_THREAD_ID_HEX,      // `%T`
+        e_SEVERITY,           // `%s`
+        e_FILENAME,           // `%f`
+        e_BASENAME,           // `%F`
+        e_LINE_NUMBER,        // `%l`
+        e_CATEGORY,           // `%c`
+        e_MESSAGE,            // `%m`
+        e_MESSAGE_PRINTABLE,  // `%x`
+        e_MESSAGE_HEX,        // `%X`
+        e_ATTRIBUTE,          // `%a[key]`
+        e_ATTRIBUTE_VALUE,    // `%av[key]`
+        e_ATTRIBUTES,         // `%a`
+        e_ALL_ATTRIBUTES,     // `%A`
+        e_USER_FIELDS         // `%u`
+    };
+
+    // PUBLIC DATA
+    Code        d_code;       // operation to perform
+
+    int         d_precision;  // number of fractional second digits of a
+                              // timestamp
+
+    bsl::size_t d_offset;     // offset of the literal text (in the literals
+                              // of the formatter) or of the attribute key (in
+                              // the format specification)
+
+    bsl::size_t d_length;     // length of the literal text or attribute key
+};
+
+                 // ==========================================
+                 // class RecordStringFormatter_TimestampCache
+                 // ==========================================
+
+/// PRIVATE CLASS.  For use by this component only.
+///
+/// This class caches, for each of the timestamp layouts rendered by
+/// `RecordStringFormatter`, the date and time of day (to whole seconds) of
+/// the most recently rendered timestamp, so that records logged within the
+/// same second share the cost of rendering them.  The cache may be used
+/// concurrently from multiple threads: a thread that finds the cache in use
+/// by another thread renders its timestamp without consulting the cache.
+class RecordStringFormatter_TimestampCache {
+
+  public:
+    // TYPES
+    enum Layout {
+        e_DATETIME = 0,  // "DDMonYYYY_HH:MM:SS"
+        e_ISO8601  = 1   // "YYYY-MM-DDTHH:MM:SS"
+    };
+
+    enum {
+        k_MAX_LENGTH = 32  // capacity required of the buffer supplied to
+                           // `render`
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum { k_NUM_LAYOUTS = 2 };
+
+    /// This `struct` holds the rendering of a timestamp in one layout.
+    struct Entry {
+        bdlt::Date d_date;                 // date of the rendered timestamp
+        int        d_secondOfDay;          // second of the day of the
+                                           // rendered timestamp, or -1 if
+                                           // there is none
+        int        d_length;               // length of `d_text`
+        char       d_text[k_MAX_LENGTH];   // rendered timestamp
+    };
+
+    // DATA
+    bsls::SpinLock d_lock;                     // guards `d_entries`
+    Entry          d_entries[k_NUM_LAYOUTS];   // cached renderings
+
+  private:
+    // NOT IMPLEMENTED
+    RecordStringFormatter_TimestampCache(
+                     const RecordStringFormatter_TimestampCache&)
+                                                          BSLS_KEYWORD_DELETED;
+    RecordStringFormatter_TimestampCache& operator=(
+                     const RecordStringFormatter_TimestampCache&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an empty timestamp cache.
+    RecordStringFormatter_TimestampCache();
+
+    //! ~RecordStringFormatter_TimestampCache() = default;
+
+    // MANIPULATORS
+
+    /// Write to the specified `buffer` the date and time of day of the
+    /// specified `datetime`, truncated to whole seconds, in the specified
+    /// `layout`, and return the number of characters written.  `buffer` is
+    /// not null-terminated.  The behavior is undefined unless `buffer` has
+    /// room for at least `k_MAX_LENGTH` characters.
+    int render(char *buffer, const bdlt::Datetime& datetime, Layout layout);
+
+    /// Discard the cached renderings.
+    void reset();
+};
+
                         // ===========================
                         // class RecordStringFormatter
                         // ===========================
@@ -171,18 +298,19 @@ class RecordStringFormatter {
 
     // PRIVATE TYPES
 
-    /// `FieldStringFormatter` is an alias for a functional object that
-    /// render fields provided by a `ball::Record` to a string.
-    typedef bsl::function<void(bsl::string *, const Record&)>
-                                              FieldStringFormatter;
+    /// `Operation` is an alias for an instruction of a compiled format
+    /// specification.
+    typedef RecordStringFormatter_Operation      Operation;
 
-    /// `FieldStringFormatters` is an alias for a vector of the
-    /// `FieldStringFormatter` objects.
-    typedef bsl::vector<FieldStringFormatter> FieldStringFormatters;
+    /// `Operations` is an alias for a vector of the `Operation` objects.
+    typedef bsl::vector<Operation>               Operations;
 
     /// `SkipAttributes` is an alias for a set of keys of attributes that
     /// should not be printed as part of a `%a` format specifier.
-    typedef bsl::set<bsl::string_view>        SkipAttributes;
+    typedef bsl::set<bsl::string_view>           SkipAttributes;
+
+    /// `TimestampCache` is an alias for the cache of rendered timestamps.
+    typedef RecordStringFormatter_TimestampCache TimestampCache;
 
   public:
     // TYPES
@@ -191,13 +319,30 @@ class RecordStringFormatter {
   private:
     // DATA
     bsl::string              d_formatSpec;       // 'printf'-style format spec.
-    FieldStringFormatters    d_fieldFormatters;  // field formatter collection
+    bsl::string              d_literals;         // literal text of the spec.
+    Operations               d_operations;       // compiled format spec.
     SkipAttributes           d_skipAttributes;   // set of skipped attributes
     bdlt::DatetimeInterval   d_timestampOffset;  // offset added to timestamps
+    mutable TimestampCache   d_timestampCache;   // recently rendered
+                                                 // timestamps
 
     // PRIVATE MANIPULATORS
 
-    /// Parse the format specification.
+    /// Append to the compiled format specification an operation copying
+    /// the specified `text` to the output.
+    void appendText(const bsl::string_view& text);
+
+    /// Append to the compiled format specification an operation having the
+    /// specified `code`.  Optionally specify the number of fractional
+    /// second digits, `precision`, of a timestamp, and the `offset` and
+    /// `length` of an attribute key in the format specification.
+    void appendOperation(Operation::Code code,
+                         int             precision = 0,
+                         bsl::size_t     offset    = 0,
+                         bsl::size_t     length    = 0);
+
+    /// Parse the format specification and compile it into a sequence of
+    /// operations.
     void parseFormatSpecification();
 
   public:
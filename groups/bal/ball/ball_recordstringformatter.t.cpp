@@ -7,10 +7,13 @@
 #include <ball_severity.h>
 #include <ball_userfields.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
 #include <bdlt_localtimeoffset.h>
 
 #include <bslim_testutil.h>
@@ -24,6 +27,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -32,6 +36,7 @@
 #include <bsl_string.h>
 #include <bsl_sstream.h>
 
+#include <bsl_cstdio.h>                   // for `snprintf`
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>                  // for `strcmp`
 
@@ -100,6 +105,8 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [16] CONCERN: CACHED TIMESTAMP RENDERING
+// [-1] PERFORMANCE: FORMATTING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -259,7 +266,116 @@ bool compareText(const bsl::string_view& lhs, const bsl::string_view& rhs)
 //-----------------------------------------------------------------------------
 
 namespace {
+namespace u {
+
+/// Load into the specified `buffer` the expected rendering of the specified
+/// `localDatetime`, having the specified `offsetInMinutes` from UTC, for the
+/// specified timestamp `format` (one of "%d", "%D", "%dtz", "%Dtz", "%i",
+/// "%I" and "%O"), and return `buffer`.  The behavior is undefined unless
+/// `buffer` has room for at least 64 characters.
+const char *expectedTimestamp(char                  *buffer,
+                              const bdlt::Datetime&  localDatetime,
+                              int                    offsetInMinutes,
+                              const char            *format)
+{
+    const bsl::size_t k_SIZE = 64;
+
+    if ('%' == format[0] && ('d' == format[1] || 'D' == format[1])) {
+        int length = localDatetime.printToBuffer(buffer,
+                                                 k_SIZE,
+                                                 'd' == format[1] ? 3 : 6);
+        if ('t' == format[2]) {
+            const int offset = offsetInMinutes < 0 ? -offsetInMinutes
+                                                   :  offsetInMinutes;
+            snprintf(buffer + length,
+                     k_SIZE - length,
+                     "%c%02d%02d",
+                     offsetInMinutes < 0 ? '-' : '+',
+                     offset / 60,
+                     offset % 60);
+        }
+        return buffer;                                                // RETURN
+    }
+
+    bdlt::Iso8601UtilConfiguration config;
+    config.setUseZAbbreviationForUtc(true);
+    config.setFractionalSecondPrecision('i' == format[1] ? 0
+                                      : 'I' == format[1] ? 3
+                                      :                    6);
+
+    int length = bdlt::Iso8601Util::generateRaw(
+                                 buffer,
+                                 bdlt::DatetimeTz(localDatetime,
+                                                  offsetInMinutes),
+                                 config);
+    buffer[length] = '\0';
+    return buffer;
+}
+
+/// This class provides a functor that formats records, having a sequence of
+/// timestamps particular to the functor, using a formatter shared with other
+/// threads, and verifies the output.
+class FormatJob {
+
+    // DATA
+    const ball::RecordStringFormatter *d_formatter_p;
+    int                                d_id;
+    int                                d_numRecords;
+    bslma::Allocator                  *d_allocator_p;
+
+  public:
+    // CREATORS
+
+    /// Create a functor that formats, using the specified `formatter`,
+    /// having the format "%d|%i", the specified `numRecords` records whose
+    /// timestamps are determined by the specified `id`.  Use the specified
+    /// `allocator` to supply memory.
+    FormatJob(const ball::RecordStringFormatter *formatter,
+              int                                id,
+              int                                numRecords,
+              bslma::Allocator                  *allocator)
+    : d_formatter_p(formatter)
+    , d_id(id)
+    , d_numRecords(numRecords)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Format the records and verify the output.
+    void operator()() const
+    {
+        ball::Record       record(d_allocator_p);
+        bsl::ostringstream stream(d_allocator_p);
+
+        bdlt::Datetime timestamp(2026, 1, 1);
+        timestamp.addDays(d_id);
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            timestamp.addMilliseconds(333 + d_id);
+            record.fixedFields().setTimestamp(timestamp);
+
+            stream.str("");
+            (*d_formatter_p)(stream, record);
+
+            char expected[128];
+            char iso8601[64];
+
+            expectedTimestamp(expected, timestamp, 0, "%d");
+            bsl::strcat(expected, "|");
+            bsl::strcat(expected, expectedTimestamp(iso8601,
+                                                    timestamp,
+                                                    0,
+                                                    "%i"));
 
+            ASSERTV(d_id, i, expected, stream.view(),
+                    expected == stream.view());
+        }
+    }
+};
+
+}  // close namespace u
 }  // close unnamed namespace
 
 //=============================================================================
@@ -289,6 +405,218 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING: CACHED TIMESTAMP RENDERING
+        //   The whole-second part of the most recently rendered timestamp is
+        //   cached by the formatter for each timestamp layout.
+        //
+        // Concerns:
+        // 1. Each of the timestamp format specifiers renders every timestamp
+        //    correctly, whether or not the whole-second part of the timestamp
+        //    was rendered for the previous record.
+        //
+        // 2. Timestamps that differ only in their date, or only in their time
+        //    of day, are not confused.
+        //
+        // 3. The cache is keyed on the adjusted timestamp, so that changing
+        //    the timestamp offset takes effect immediately.
+        //
+        // 4. Format specifications combining the two timestamp layouts are
+        //    rendered correctly.
+        //
+        // 5. A formatter can be used concurrently from multiple threads.
+        //
+        // 6. Formatting records does not allocate memory.
+        //
+        // Plan:
+        // 1. For a sequence of timestamps that advance within a second,
+        //    cross second, day, and year boundaries, repeat, and go back in
+        //    time, format a record having each timestamp with each timestamp
+        //    format specifier, combined with each of a set of timestamp
+        //    offsets, and compare the result to the rendering produced
+        //    directly by `bdlt`.  (C-1..3)
+        //
+        // 2. Repeat P-1 using a single formatter whose format specification
+        //    has all the timestamp format specifiers.  (C-4)
+        //
+        // 3. Format, from several threads sharing a formatter having both
+        //    timestamp layouts, records having timestamps particular to each
+        //    thread, and verify the output.  (C-5)
+        //
+        // 4. Use a test allocator monitor to verify that no memory is
+        //    allocated by the formatter in P-1.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: CACHED TIMESTAMP RENDERING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: CACHED TIMESTAMP RENDERING" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const char *const FORMATS[] = {
+            "%d", "%D", "%dtz", "%Dtz", "%i", "%I", "%O"
+        };
+        enum { NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS };
+
+        static const struct {
+            int d_line;
+            int d_year;
+            int d_month;
+            int d_day;
+            int d_hour;
+            int d_minute;
+            int d_second;
+            int d_millisecond;
+            int d_microsecond;
+        } TIMESTAMPS[] = {
+            // LINE  YEAR  MO  DAY  HR  MI  SE   MSEC  USEC
+            // ----  ----  --  ---  --  --  --   ----  ----
+            {  L_,   2026, 12,  31, 23, 59, 58,     0,    0 },
+            {  L_,   2026, 12,  31, 23, 59, 58,     1,    2 },
+            {  L_,   2026, 12,  31, 23, 59, 58,   999,  999 },
+            {  L_,   2026, 12,  31, 23, 59, 59,     0,    1 },
+            {  L_,   2026, 12,  31, 23, 59, 59,   500,    0 },
+            {  L_,   2027,  1,   1,  0,  0,  0,     0,    0 },
+            {  L_,   2027,  1,   1,  0,  0,  0,    12,  345 },
+            {  L_,   2027,  1,   1,  0,  0,  1,     0,    0 },
+            {  L_,   2027,  1,   2,  0,  0,  1,     0,    0 },
+            {  L_,   2027,  1,   1,  0,  0,  1,     7,    0 },
+            {  L_,   2026, 12,  31, 23, 59, 59,   501,    0 },
+            {  L_,   2026, 12,  31, 23, 59, 59,   501,    0 },
+            {  L_,   1999,  2,  28, 12, 34, 56,   789,   12 },
+            {  L_,   1999,  2,  28, 12, 34, 57,   789,   12 },
+            {  L_,      1,  1,   1,  0,  0,  0,     0,    0 },
+            {  L_,   9999, 12,  31, 23, 59, 59,   999,  999 },
+        };
+        enum { NUM_TIMESTAMPS = sizeof TIMESTAMPS / sizeof *TIMESTAMPS };
+
+        static const int OFFSETS[] = { 0, 90, -90, -23 * 60 - 59 };
+        enum { NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS };
+
+        bslma::TestAllocator sa("stream", veryVeryVeryVerbose);
+
+        Rec                mR(&oa);
+        bsl::ostringstream stream(&sa);
+
+        if (verbose) cout << "\nTesting each timestamp format." << endl;
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const char *const FORMAT = FORMATS[fi];
+
+            Obj mX(FORMAT, &oa);  const Obj& X = mX;
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int OFFSET = OFFSETS[oi];
+
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                for (int ti = 0; ti < NUM_TIMESTAMPS; ++ti) {
+                    const int            LINE = TIMESTAMPS[ti].d_line;
+                    const bdlt::Datetime LOCAL(TIMESTAMPS[ti].d_year,
+                                               TIMESTAMPS[ti].d_month,
+                                               TIMESTAMPS[ti].d_day,
+                                               TIMESTAMPS[ti].d_hour,
+                                               TIMESTAMPS[ti].d_minute,
+                                               TIMESTAMPS[ti].d_second,
+                                               TIMESTAMPS[ti].d_millisecond,
+                                               TIMESTAMPS[ti].d_microsecond);
+
+                    bdlt::Datetime utc(LOCAL);
+                    if (0 != utc.addMinutesIfValid(-OFFSET)) {
+                        continue;                                   // CONTINUE
+                    }
+                    mR.fixedFields().setTimestamp(utc);
+
+                    char expected[64];
+                    u::expectedTimestamp(expected, LOCAL, OFFSET, FORMAT);
+
+                    stream.str("");
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+
+                    X(stream, mR);
+
+                    ASSERTV(LINE, FORMAT, OFFSET, oam.isTotalSame());
+                    ASSERTV(LINE, FORMAT, OFFSET, expected, stream.view(),
+                            expected == stream.view());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting combined timestamp formats." << endl;
+        {
+            Obj mX("%d %D %dtz %Dtz %i %I %O", &oa);  const Obj& X = mX;
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int OFFSET = OFFSETS[oi];
+
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                for (int ti = 0; ti < NUM_TIMESTAMPS; ++ti) {
+                    const int            LINE = TIMESTAMPS[ti].d_line;
+                    const bdlt::Datetime LOCAL(TIMESTAMPS[ti].d_year,
+                                               TIMESTAMPS[ti].d_month,
+                                               TIMESTAMPS[ti].d_day,
+                                               TIMESTAMPS[ti].d_hour,
+                                               TIMESTAMPS[ti].d_minute,
+                                               TIMESTAMPS[ti].d_second,
+                                               TIMESTAMPS[ti].d_millisecond,
+                                               TIMESTAMPS[ti].d_microsecond);
+
+                    bdlt::Datetime utc(LOCAL);
+                    if (0 != utc.addMinutesIfValid(-OFFSET)) {
+                        continue;                                   // CONTINUE
+                    }
+                    mR.fixedFields().setTimestamp(utc);
+
+                    bsl::string expected(&oa);
+                    for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+                        char buffer[64];
+
+                        if (fi) {
+                            expected += ' ';
+                        }
+                        expected += u::expectedTimestamp(buffer,
+                                                         LOCAL,
+                                                         OFFSET,
+                                                         FORMATS[fi]);
+                    }
+
+                    stream.str("");
+                    X(stream, mR);
+
+                    ASSERTV(LINE, OFFSET, expected, stream.view(),
+                            expected == stream.view());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent formatting." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 2000 };
+
+            const Obj X("%d|%i", &oa);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::createWithAllocator(
+                                          &handles[i],
+                                          u::FormatJob(&X,
+                                                       i,
+                                                       k_NUM_RECORDS,
+                                                       &oa),
+                                          &oa));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING: Overload resolution for `RecordStringFormatter` changed due
@@ -1896,12 +2224,11 @@ int main(int argc, char *argv[])
 
                 X(stream, record);
 
-                const bool expectIncrease = MSG_LEN > 500;
+                // Messages of any length are formatted without allocating.
 
-                ASSERT(oam.isInUseSame());
-                ASSERT(oam.isMaxSame());
-                ASSERT(dam.isInUseSame());
-                ASSERT(expectIncrease == dam.isMaxUp());
+                ASSERTV(MSG_LEN, oam.isInUseSame());
+                ASSERTV(MSG_LEN, oam.isMaxSame());
+                ASSERTV(MSG_LEN, dam.isTotalSame());
 
                 if (veryVeryVerbose) {
                     P_(oam.isInUseSame());
@@ -2649,6 +2976,102 @@ int main(int argc, char *argv[])
         ASSERT( 0 == (X1 == X3));        ASSERT(1 == (X1 != X3));
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORMATTING THROUGHPUT
+        //
+        // Concerns:
+        // 1. Formatting a typical record, using any of the commonly used
+        //    format specifications, is cheap relative to the cost of
+        //    publishing it.
+        //
+        // Plan:
+        // 1. For each of a set of commonly used format specifications,
+        //    format a large number of records, whose timestamps advance by
+        //    one millisecond per record, to a fixed-size stream buffer that
+        //    is rewound after each record, and report the average time taken
+        //    to format a record.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FORMATTING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FORMATTING THROUGHPUT" << endl
+                          << "==================================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        static const char *const FORMATS[] = {
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "\n%d %p:%t %s %f:%l %c %a %m\n",
+            "%I %p:%t %s %F:%l %c %m\n",
+            "\n%Dtz %T %s %c %av[name] %x\n"
+        };
+        enum { NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Rec mR(&ta);  const Rec& R = mR;
+
+        ball::RecordAttributes& fixedFields = mR.fixedFields();
+
+        fixedFields.setProcessID(4242);
+        fixedFields.setThreadID(1234567);
+        fixedFields.setFileName("groups/bal/ball/ball_record.cpp");
+        fixedFields.setLineNumber(__LINE__);
+        fixedFields.setCategory("BALL.RECORDSTRINGFORMATTER.BENCHMARK");
+        fixedFields.setSeverity(ball::Severity::e_INFO);
+        fixedFields.setMessage("Processed request 42 of 100 in 17 ms");
+
+        mR.addAttribute(ball::Attribute("name",   "Name", &ta));
+        mR.addAttribute(ball::Attribute("number", 1234,   &ta));
+
+        const bdlt::Datetime START(2026, 10, 18, 12, 34, 56, 789);
+
+        char                        storage[1024];
+        bdlsb::FixedMemOutStreamBuf streamBuf(storage, sizeof storage);
+        bsl::ostream                stream(&streamBuf);
+
+        for (int ti = 0; ti < NUM_FORMATS; ++ti) {
+            const char *const FORMAT = FORMATS[ti];
+
+            Obj mX(FORMAT, &ta);  const Obj& X = mX;
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bdlt::Datetime timestamp(START);
+                timestamp.addMilliseconds(i);
+                fixedFields.setTimestamp(timestamp);
+
+                streamBuf.pubseekpos(0);
+                X(stream, R);
+            }
+
+            timer.stop();
+
+            ASSERTV(ti, stream.good());
+
+            const double elapsed = timer.accumulatedWallTime();
+
+            cout << "Format: \"";
+            for (const char *p = FORMAT; *p; ++p) {
+                if ('\n' == *p) {
+                    cout << "\\n";
+                }
+                else {
+                    cout << *p;
+                }
+            }
+            cout << "\"\n"
+                 << "\tWall time:   " << elapsed << " s\n"
+                 << "\tUser time:   " << timer.accumulatedUserTime() << " s\n"
+                 << "\tPer record:  " << elapsed * 1e9 / NUM_RECORDS << " ns"
+                 << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -4,6 +4,13 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ball_ruleset_cpp,"$Id$ $CSID$")
 
+#include <ball_attribute.h>
+#include <ball_attributecontainer.h>
+#include <ball_attributecontainerlist.h>
+#include <ball_managedattribute.h>
+#include <ball_patternutil.h>
+#include <ball_thresholdaggregate.h>
+
 #include <bdlb_bitstringutil.h>
 #include <bdlb_bitutil.h>
 
@@ -13,11 +20,84 @@ BSLS_IDENT_RCSID(ball_ruleset_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstdint.h>
 #include <bsl_functional.h>
 
 namespace BloombergLP {
+namespace {
+namespace u {
+
+using namespace ball;
+
+enum { k_INITIAL_NUM_BUCKETS = 32 };  // initial size of the rule hash table
+
+/// Return the key under which a rule having the specified `predicate` is
+/// indexed.
+inline
+int indexKey(const Attribute& predicate)
+{
+    return Attribute::hash(predicate, INT_MAX);
+}
+
+/// Remove the specified `id` from the specified `ids`.  The behavior is
+/// undefined unless `ids` holds `id`.
+void removeId(bsl::vector<int> *ids, int id)
+{
+    bsl::vector<int>::iterator it = bsl::find(ids->begin(), ids->end(), id);
+    BSLS_ASSERT(it != ids->end());
+
+    *it = ids->back();
+    ids->pop_back();
+}
+
+                           // ======================
+                           // class CandidateVisitor
+                           // ======================
+
+/// This class provides an attribute visitor that appends, to a vector, the
+/// ids of the rules indexed under each attribute it visits.
+class CandidateVisitor {
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<int, bsl::vector<int> > AttributeIndex;
+
+    // DATA
+    const AttributeIndex *d_index_p;       // attribute index (held)
+    bsl::vector<int>     *d_candidates_p;  // ids of candidate rules (held)
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that appends, to the specified `candidates`, the
+    /// ids held by the specified `index` for each attribute visited.
+    CandidateVisitor(const AttributeIndex *index,
+                     bsl::vector<int>     *candidates)
+    : d_index_p(index)
+    , d_candidates_p(candidates)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Append the ids of the rules indexed under the specified `attribute`
+    /// to the candidates of this visitor.
+    void operator()(const Attribute& attribute) const
+    {
+        AttributeIndex::const_iterator it = d_index_p->find(
+                                                        indexKey(attribute));
+        if (it != d_index_p->end()) {
+            d_candidates_p->insert(d_candidates_p->end(),
+                                   it->second.begin(),
+                                   it->second.end());
+        }
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
 namespace ball {
 
                           // -------------
@@ -44,38 +124,105 @@ void RuleSet::printMask(bsl::ostream& stream,
                                spacesPerLevel);
 }
 
+// PRIVATE MANIPULATORS
+void RuleSet::indexRule(int id)
+{
+    const Rule *rule = d_ruleAddresses[id];
+
+    // Index the rule under its predicate shared by the fewest rules, so that
+    // the buckets of the index remain small even if many rules share some of
+    // their predicates.
+
+    int         key     = k_NO_INDEX_KEY;
+    bsl::size_t minSize = 0;
+    for (ManagedAttributeSet::const_iterator it  = rule->begin();
+                                             it != rule->end();
+                                           ++it) {
+        const int candidateKey = u::indexKey(it->attribute());
+
+        AttributeIndex::const_iterator bucket =
+                                          d_attributeIndex.find(candidateKey);
+        const bsl::size_t size = bucket == d_attributeIndex.end()
+                                 ? 0
+                                 : bucket->second.size();
+
+        if (k_NO_INDEX_KEY == key || size < minSize) {
+            key     = candidateKey;
+            minSize = size;
+        }
+    }
+
+    d_indexKeys[id] = key;
+    if (k_NO_INDEX_KEY == key) {
+        d_unconditionalRuleIds.push_back(id);
+    }
+    else {
+        d_attributeIndex[key].push_back(id);
+    }
+
+    const bsl::string pattern(rule->pattern(),
+                              d_patternIndex.get_allocator().mechanism());
+    d_patternIndex[pattern].push_back(id);
+}
+
+void RuleSet::unindexRule(int id)
+{
+    const Rule *rule = d_ruleAddresses[id];
+    const int   key  = d_indexKeys[id];
+
+    if (k_NO_INDEX_KEY == key) {
+        u::removeId(&d_unconditionalRuleIds, id);
+    }
+    else {
+        AttributeIndex::iterator bucket = d_attributeIndex.find(key);
+        BSLS_ASSERT(bucket != d_attributeIndex.end());
+
+        u::removeId(&bucket->second, id);
+        if (bucket->second.empty()) {
+            d_attributeIndex.erase(bucket);
+        }
+    }
+
+    const bsl::string      pattern(rule->pattern(),
+                                   d_patternIndex.get_allocator().mechanism());
+    PatternIndex::iterator entry = d_patternIndex.find(pattern);
+    BSLS_ASSERT(entry != d_patternIndex.end());
+
+    u::removeId(&entry->second, id);
+    if (entry->second.empty()) {
+        d_patternIndex.erase(entry);
+    }
+}
+
 // CREATORS
 RuleSet::RuleSet(bslma::Allocator *basicAllocator)
-: d_ruleHashtable(maxNumRules(),          // initial size
-                  RuleHash(),             // hash functor
-                  bsl::equal_to<Rule>(),  // equal functor
+: d_ruleHashtable(u::k_INITIAL_NUM_BUCKETS,  // initial size
+                  RuleHash(),                // hash functor
+                  bsl::equal_to<Rule>(),     // equal functor
                   basicAllocator)
 , d_ruleAddresses(basicAllocator)
+, d_indexKeys(basicAllocator)
 , d_freeRuleIds(basicAllocator)
+, d_attributeIndex(basicAllocator)
+, d_unconditionalRuleIds(basicAllocator)
+, d_patternIndex(basicAllocator)
 , d_numPredicates(0)
 {
-    d_ruleAddresses.reserve(maxNumRules());
-    d_freeRuleIds.reserve(maxNumRules());
-    for (int i = 0; i < maxNumRules(); ++i) {
-        d_ruleAddresses.push_back(0);
-        d_freeRuleIds.push_back(i);
-    }
 }
 
 RuleSet::RuleSet(const RuleSet& original, bslma::Allocator *basicAllocator)
-: d_ruleHashtable(maxNumRules(),          // initial size
-                  RuleHash(),             // hash functor
-                  bsl::equal_to<Rule>(),  // equal functor
+: d_ruleHashtable(u::k_INITIAL_NUM_BUCKETS,  // initial size
+                  RuleHash(),                // hash functor
+                  bsl::equal_to<Rule>(),     // equal functor
                   basicAllocator)
 , d_ruleAddresses(basicAllocator)
+, d_indexKeys(basicAllocator)
 , d_freeRuleIds(basicAllocator)
+, d_attributeIndex(basicAllocator)
+, d_unconditionalRuleIds(basicAllocator)
+, d_patternIndex(basicAllocator)
+, d_numPredicates(0)
 {
-    d_ruleAddresses.reserve(maxNumRules());
-    d_freeRuleIds.reserve(maxNumRules());
-    for (int i = 0; i < maxNumRules(); ++i) {
-        d_ruleAddresses.push_back(0);
-        d_freeRuleIds.push_back(i);
-    }
     addRules(original);
 }
 
@@ -89,20 +236,34 @@ int RuleSet::addRule(const Rule& value)
         return -2;                                                    // RETURN
     }
 
-    HashtableType::const_iterator iter = d_ruleHashtable.insert(value).first;
+    // Reuse the most recently released id, if any, so that the ids remain
+    // dense.
 
-    int ruleId = d_freeRuleIds.back();
-    d_freeRuleIds.pop_back();
-    d_ruleAddresses[ruleId] = &*iter;
+    int ruleId;
+    if (d_freeRuleIds.empty()) {
+        ruleId = static_cast<int>(d_ruleAddresses.size());
+        d_ruleAddresses.push_back(0);
+        d_indexKeys.push_back(k_NO_INDEX_KEY);
+    }
+    else {
+        ruleId = d_freeRuleIds.back();
+        d_freeRuleIds.pop_back();
+    }
+
+    HashtableType::iterator iter = d_ruleHashtable.emplace(value,
+                                                           ruleId).first;
+
+    d_ruleAddresses[ruleId] = &iter->first;
     d_numPredicates += value.numAttributes();
+    indexRule(ruleId);
     return ruleId;
 }
 
 int RuleSet::addRules(const RuleSet& rules)
 {
     int count = 0;
-    for (int i = 0; i < rules.maxNumRules(); ++i) {
-        const Rule *rule = rules.getRuleById(i);
+    for (bsl::size_t i = 0; i < rules.d_ruleAddresses.size(); ++i) {
+        const Rule *rule = rules.d_ruleAddresses[i];
         if (rule) {
             count += addRule(*rule) >= 0;
         }
@@ -125,12 +286,13 @@ int RuleSet::removeRuleById(int id)
     BSLS_ASSERT(0 <= id);
     BSLS_ASSERT(id < maxNumRules());
 
-    const Rule *rule = d_ruleAddresses[id];
+    const Rule *rule = getRuleById(id);
     if (!rule) {
         return 0;                                                     // RETURN
     }
 
     d_numPredicates -= rule->numAttributes();
+    unindexRule(id);
 
     // Note that removing 'iter' from 'd_ruleHashTable' invalidates 'rule'.
     HashtableType::iterator iter = d_ruleHashtable.find(*rule);
@@ -138,6 +300,7 @@ int RuleSet::removeRuleById(int id)
     d_ruleHashtable.erase(iter);
 
     d_ruleAddresses[id] = 0;
+    d_indexKeys[id]     = k_NO_INDEX_KEY;
     d_freeRuleIds.push_back(id);
 
     return 1;
@@ -146,8 +309,8 @@ int RuleSet::removeRuleById(int id)
 int RuleSet::removeRules(const RuleSet& rules)
 {
     int count = 0;
-    for (int i = 0; i < rules.maxNumRules(); ++i) {
-        const Rule *rule = rules.getRuleById(i);
+    for (bsl::size_t i = 0; i < rules.d_ruleAddresses.size(); ++i) {
+        const Rule *rule = rules.d_ruleAddresses[i];
         if (rule) {
             int id = ruleId(*rule);
             if (id >= 0) {
@@ -162,13 +325,13 @@ int RuleSet::removeRules(const RuleSet& rules)
 void RuleSet::removeAllRules()
 {
     d_ruleAddresses.clear();
+    d_indexKeys.clear();
     d_ruleHashtable.clear();
     d_freeRuleIds.clear();
-
-    for (int i = 0; i < maxNumRules(); ++i) {
-        d_ruleAddresses.push_back(0);
-        d_freeRuleIds.push_back(i);
-    }
+    d_attributeIndex.clear();
+    d_unconditionalRuleIds.clear();
+    d_patternIndex.clear();
+    d_numPredicates = 0;
 }
 
 RuleSet& RuleSet::operator=(const RuleSet& rhs)
@@ -182,23 +345,80 @@ RuleSet& RuleSet::operator=(const RuleSet& rhs)
 }
 
 // ACCESSORS
-int RuleSet::ruleId(const Rule& value) const
+void RuleSet::findActiveRules(
+                            bsl::vector<int>              *ruleIds,
+                            const AttributeContainerList&  attributes) const
 {
-    HashtableType::const_iterator iter = d_ruleHashtable.find(value);
+    BSLS_ASSERT(ruleIds);
 
-    if (iter == d_ruleHashtable.end()) {
-        return -1;                                                    // RETURN
+    ruleIds->assign(d_unconditionalRuleIds.begin(),
+                    d_unconditionalRuleIds.end());
+
+    if (!d_attributeIndex.empty()) {
+        const u::CandidateVisitor visitor(&d_attributeIndex, ruleIds);
+
+        for (AttributeContainerList::iterator it  = attributes.begin();
+                                              it != attributes.end();
+                                            ++it) {
+            (*it)->visitAttributes(visitor);
+        }
     }
 
-    const Rule *rule = &*iter;
+    // A rule may be gathered more than once (e.g., if an attribute appears
+    // in several containers), or gathered for an attribute merely having the
+    // same hash value as its key predicate, hence the candidates are made
+    // unique and evaluated.
+
+    bsl::sort(ruleIds->begin(), ruleIds->end());
+    ruleIds->erase(bsl::unique(ruleIds->begin(), ruleIds->end()),
+                   ruleIds->end());
+
+    bsl::vector<int>::iterator end = ruleIds->begin();
+    for (bsl::vector<int>::iterator it = ruleIds->begin();
+                                    it != ruleIds->end();
+                                  ++it) {
+        if (d_ruleAddresses[*it]->evaluate(attributes)) {
+            *end++ = *it;
+        }
+    }
+    ruleIds->erase(end, ruleIds->end());
+}
+
+int RuleSet::numMatchingRules(int *threshold, const char *categoryName) const
+{
+    BSLS_ASSERT(threshold);
+    BSLS_ASSERT(categoryName);
+
+    int count = 0;
+    *threshold = 0;
+    for (PatternIndex::const_iterator it  = d_patternIndex.begin();
+                                      it != d_patternIndex.end();
+                                    ++it) {
+        if (!PatternUtil::isMatch(categoryName, it->first.c_str())) {
+            continue;
+        }
 
-    for (unsigned int i = 0; i < d_ruleAddresses.size(); ++i) {
-        if (d_ruleAddresses[i] == rule) {
-            return i;                                                 // RETURN
+        const bsl::vector<int>& ids = it->second;
+        count += static_cast<int>(ids.size());
+        for (bsl::size_t i = 0; i < ids.size(); ++i) {
+            const Rule *rule = d_ruleAddresses[ids[i]];
+            *threshold = bsl::max(*threshold,
+                                  ThresholdAggregate::maxLevel(
+                                                     rule->recordLevel(),
+                                                     rule->passLevel(),
+                                                     rule->triggerLevel(),
+                                                     rule->triggerAllLevel()));
         }
     }
 
-    return -1;
+    return count;
+}
+
+int RuleSet::ruleId(const Rule& value) const
+{
+    HashtableType::const_iterator iter = d_ruleHashtable.find(value);
+
+    return iter == d_ruleHashtable.end() ? -1 : iter->second;
 }
 
 bsl::ostream& RuleSet::print(bsl::ostream& stream,
@@ -208,8 +428,8 @@ bsl::ostream& RuleSet::print(bsl::ostream& stream,
     bslim::Printer printer(&stream, level, spacesPerLevel);
 
     printer.start();
-    for (int i = 0; i < maxNumRules(); ++i) {
-        const Rule *rule = getRuleById(i);
+    for (bsl::size_t i = 0; i < d_ruleAddresses.size(); ++i) {
+        const Rule *rule = d_ruleAddresses[i];
         if (rule) {
             printer.printValue(*rule);
         }
@@ -228,8 +448,8 @@ bool ball::operator==(const RuleSet& lhs, const RuleSet& rhs)
         return false;                                                 // RETURN
     }
 
-    for (int i = 0; i < lhs.maxNumRules(); ++i) {
-        const Rule *rule = lhs.getRuleById(i);
+    for (bsl::size_t i = 0; i < lhs.d_ruleAddresses.size(); ++i) {
+        const Rule *rule = lhs.d_ruleAddresses[i];
         if (rule && 0 > rhs.ruleId(*rule) ) {
             return false;                                             // RETURN
         }
@@ -20,6 +20,38 @@ BSLS_IDENT("$Id: $")
 // For more information on how to use that feature, please see the package
 // level documentation and usage examples for "Rule-Based Logging".
 //
+///Rule Indexes
+///------------
+// A rule set may hold up to `ball::RuleSet::maxNumRules()` rules (several
+// thousand rules, typically one per client or request identifier, are
+// expected to be common).  Rather than evaluating every rule, the components
+// implementing rule-based logging query two indexes maintained by the rule
+// set:
+//
+// * An attribute index, mapping each rule to one of its predicates (the one,
+//   at the time the rule is added, shared by the fewest other rules).  The
+//   `findActiveRules` method visits the attributes of a thread, gathers the
+//   rules indexed under them (as well as the rules having no predicate), and
+//   evaluates only those candidates, so that its cost depends on the number
+//   of attributes and candidate rules rather than on the total number of
+//   rules.
+// * A pattern index, mapping each distinct pattern to the rules having it.
+//   The `numMatchingRules` method matches a category name against each
+//   distinct pattern once.
+//
+// Rule ids are assigned densely: an id released by a removed rule is reused
+// before any new id is allocated, so that the ids of a rule set holding `N`
+// rules are typically in the range `[0 .. N - 1]`.
+//
+// Note that rule sets were formerly limited to 32 rules, so that a subset of
+// the rules could be described by a `ball::RuleSet::MaskType` bit mask.  Such
+// a mask now describes only the rules whose ids are less than 32, and
+// `ball::RuleSet::e_MAX_NUM_RULES` (formerly 32) is 65536.  The deprecated
+// `ball::Category::relevantRuleMask` accessor is maintained on those terms;
+// code sizing arrays by `e_MAX_NUM_RULES`, or assuming that a mask covers
+// every rule, should use `ball::Category::numRelevantRules` and
+// `ball::RuleSet::findActiveRules` instead.
+//
 ///Thread Safety
 ///-------------
 // `ball::RuleSet` is *not* thread-safe in that multiple threads attempting to
@@ -91,12 +123,17 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bsl_unordered_set.h>
+#include <bsls_assert.h>
+
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
 
+class AttributeContainerList;
+
                           // =============
                           // class RuleSet
                           // =============
@@ -112,12 +149,16 @@ class RuleSet {
     // PUBLIC TYPES
 
     /// `MaskType` is an alias for the fundamental integral type used to
-    /// indicate rule subsets compactly.
+    /// indicate rule subsets compactly.  Note that a mask can describe only
+    /// the rules whose ids are less than `8 * sizeof(MaskType)` (see
+    /// {Rule Indexes}).
     typedef unsigned int MaskType;
 
     enum {
-        e_MAX_NUM_RULES = 8 * sizeof(MaskType)
-           // The maximum number of rules managed by this object.
+        e_MAX_NUM_RULES = 65536
+           // The maximum number of rules managed by this object.  Note that
+           // this value was `8 * sizeof(MaskType)` (i.e., 32) prior to the
+           // introduction of the rule indexes.
 
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , BAEL_MAX_NUM_RULES = e_MAX_NUM_RULES
@@ -145,18 +186,47 @@ class RuleSet {
         }
     };
 
-    typedef bsl::unordered_set<Rule, RuleHash> HashtableType;
+    /// This type maps each rule to its id.
+    typedef bsl::unordered_map<Rule, int, RuleHash> HashtableType;
+
+    /// This type maps the hash value of a predicate to the ids of the rules
+    /// indexed under that predicate.
+    typedef bsl::unordered_map<int, bsl::vector<int> > AttributeIndex;
+
+    /// This type maps a pattern to the ids of the rules having it.
+    typedef bsl::unordered_map<bsl::string, bsl::vector<int> >
+                                                                 PatternIndex;
+
+    enum { k_NO_INDEX_KEY = -1 };  // index key of a rule having no predicate
 
     // DATA
     HashtableType              d_ruleHashtable;  // the hash table that
                                                  // manages all the rules
-                                                 // maintained by this rule set
+                                                 // maintained by this rule
+                                                 // set, and their ids
 
     bsl::vector<const Rule *>  d_ruleAddresses;  // secondary map between ids
                                                  // and the addresses of rules
 
-    bsl::vector<int>           d_freeRuleIds;    // rule Ids that are not being
-                                                 // used
+    bsl::vector<int>           d_indexKeys;      // for each id, the hash
+                                                 // value of the predicate
+                                                 // under which the rule is
+                                                 // indexed, or
+                                                 // `k_NO_INDEX_KEY`
+
+    bsl::vector<int>           d_freeRuleIds;    // ids, less than
+                                                 // `d_ruleAddresses.size()`,
+                                                 // that are not being used
+
+    AttributeIndex             d_attributeIndex; // ids of the rules indexed
+                                                 // under each predicate
+
+    bsl::vector<int>           d_unconditionalRuleIds;
+                                                 // ids of the rules having no
+                                                 // predicate
+
+    PatternIndex               d_patternIndex;   // ids of the rules having
+                                                 // each pattern
 
     int                        d_numPredicates;  // total number of predicates
 
@@ -165,6 +235,16 @@ class RuleSet {
     friend bool          operator!=(const RuleSet&, const RuleSet&);
     friend bsl::ostream& operator<<(bsl::ostream&,  const RuleSet&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Add the rule having the specified `id` to the attribute and pattern
+    /// indexes of this rule set.
+    void indexRule(int id);
+
+    /// Remove the rule having the specified `id` from the attribute and
+    /// pattern indexes of this rule set.
+    void unindexRule(int id);
+
   public:
     // CLASS METHODS
 
@@ -228,7 +308,7 @@ class RuleSet {
     /// Remove from this rule set the rule having the specified `id`.
     /// Return the number of rules removed (i.e., 1 on success and 0 if
     /// there is no rule whose id is `id`).  The behavior is undefined
-    /// unless `0 <= id < e_MAX_NUM_RULES`.
+    /// unless `0 <= id < maxNumRules()`.
     int removeRuleById(int id);
 
     /// Remove the rule having the specified `value` from this rule set.
@@ -263,6 +343,21 @@ class RuleSet {
     /// appear anywhere in the range `0 <= id < maxNumRules()`).
     const Rule *getRuleById(int id) const;
 
+    /// Load, into the specified `ruleIds`, the ids, in increasing order,
+    /// of the rules in this rule set that are active for the specified
+    /// `attributes` (i.e., for which `Rule::evaluate` returns `true`).  Only
+    /// the rules indexed under an attribute held by `attributes`, and the
+    /// rules having no predicate, are evaluated (see {Rule Indexes}).
+    void findActiveRules(bsl::vector<int>              *ruleIds,
+                         const AttributeContainerList&  attributes) const;
+
+    /// Return the number of rules in this rule set whose pattern matches
+    /// the specified `categoryName`, and load, into the specified
+    /// `threshold`, the greatest threshold level (see
+    /// `ThresholdAggregate::maxLevel`) of those rules, or 0 if there are
+    /// none.
+    int numMatchingRules(int *threshold, const char *categoryName) const;
+
     /// Return the number of unique rules maintained in this `RuleSet`
     /// object.  Note that this value is *not* the maximum identifier for
     /// the rules currently in this container.
@@ -323,7 +418,12 @@ int RuleSet::maxNumRules()
 inline
 const Rule *RuleSet::getRuleById(int id) const
 {
-    return d_ruleAddresses[id];
+    BSLS_ASSERT(0 <= id);
+    BSLS_ASSERT(id < maxNumRules());
+
+    return static_cast<bsl::size_t>(id) < d_ruleAddresses.size()
+           ? d_ruleAddresses[id]
+           : 0;
 }
 
 inline
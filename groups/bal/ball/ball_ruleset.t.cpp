@@ -1,6 +1,9 @@
 // ball_ruleset.t.cpp                                                 -*-C++-*-
 #include <ball_ruleset.h>
 
+#include <ball_attributecontainerlist.h>
+#include <ball_defaultattributecontainer.h>
+#include <ball_managedattribute.h>
 #include <ball_predicate.h>
 #include <ball_severity.h>                      // for testing only
 
@@ -44,6 +47,8 @@ using namespace bsl;
 // [ 4] int ruleId(const ball::Rule& value) const;
 // [ 4] const ball::Rule *getRuleById(int id) const;
 // [ 4] int numRules() const;
+// [11] void findActiveRules(vector<int> *, const ACL& attributes) const;
+// [11] int numMatchingRules(int *threshold, const char *name) const;
 // [ 5] bsl::ostream& print(bsl::ostream& stream, int lvl, int spl) const;
 // [ 6] bool operator==(const ball::Rule& lhs, const ball::Rule& rhs)
 // [ 6] bool operator!=(const ball::Rule& lhs, const ball::Rule& rhs)
@@ -52,7 +57,7 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [ 3] PRIMITIVE TEST APPARATUS: `gg`
 // [ 8] UNUSED
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -337,7 +342,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -414,6 +419,196 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING RULE INDEXES
+        //
+        // Concerns:
+        // 1. A rule set can hold many more rules than there are bits in a
+        //    `MaskType`.
+        //
+        // 2. `findActiveRules` returns, in increasing order and without
+        //    duplicates, the ids of exactly the rules that are active for the
+        //    supplied attributes, including the rules having no predicate.
+        //
+        // 3. An attribute whose name and value match a predicate, but whose
+        //    type does not, does not activate a rule.
+        //
+        // 4. `numMatchingRules` returns the number of rules whose pattern
+        //    matches a category name, and their greatest threshold level.
+        //
+        // 5. Both indexes are updated when rules are removed, and the ids of
+        //    removed rules are reused.
+        //
+        // Plan:
+        // 1. Add several thousand rules, each having a distinct `clientId`
+        //    predicate, and one of two patterns.  Add a rule having no
+        //    predicate, and a rule having two predicates.  (C-1)
+        //
+        // 2. Call `findActiveRules` for several attribute container lists,
+        //    and verify the result against the expected rules.  (C-2..3)
+        //
+        // 3. Call `numMatchingRules` for several category names.  (C-4)
+        //
+        // 4. Remove some rules, and repeat P-2 and P-3.  Add a rule, and
+        //    verify that it reuses the id of a removed rule.  (C-5)
+        //
+        // Testing:
+        //   void findActiveRules(vector<int> *, const ACL& attributes) const;
+        //   int numMatchingRules(int *threshold, const char *name) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RULE INDEXES" << endl
+                          << "====================" << endl;
+
+        const int NUM_CLIENTS = 5000;
+
+        Obj mX(&testAllocator); const Obj& X = mX;
+
+        vector<int> clientRuleIds(NUM_CLIENTS);
+        for (int i = 0; i < NUM_CLIENTS; ++i) {
+            ball::Rule rule(i % 2 ? "FX.*" : "EQ.*",
+                            i % 200 + 1,
+                            0,
+                            0,
+                            0,
+                            &testAllocator);
+            rule.addAttribute(ball::ManagedAttribute("clientId", i));
+
+            clientRuleIds[i] = mX.addRule(rule);
+            LOOP_ASSERT(i, 0 <= clientRuleIds[i]);
+            LOOP_ASSERT(i, NUM_CLIENTS > clientRuleIds[i]);
+        }
+        ASSERT(NUM_CLIENTS == X.numRules());
+        ASSERT(NUM_CLIENTS == X.numPredicates());
+
+        ball::Rule unconditional("EQ.MARKET", 0, 0, 0, 250, &testAllocator);
+        const int  unconditionalId = mX.addRule(unconditional);
+        ASSERT(0 <= unconditionalId);
+
+        ball::Rule compound("*", 0, 0, 251, 0, &testAllocator);
+        compound.addAttribute(ball::ManagedAttribute("clientId", 7));
+        compound.addAttribute(ball::ManagedAttribute("desk", "rates"));
+        const int compoundId = mX.addRule(compound);
+        ASSERT(0 <= compoundId);
+
+        ball::DefaultAttributeContainer client42(&testAllocator);
+        client42.addAttribute(ball::Attribute("clientId", 42));
+
+        ball::DefaultAttributeContainer client7(&testAllocator);
+        client7.addAttribute(ball::Attribute("clientId", 7));
+        client7.addAttribute(ball::Attribute("user", "jdoe"));
+
+        ball::DefaultAttributeContainer rates(&testAllocator);
+        rates.addAttribute(ball::Attribute("desk", "rates"));
+
+        ball::DefaultAttributeContainer client42AsInt64(&testAllocator);
+        client42AsInt64.addAttribute(
+                 ball::Attribute("clientId", static_cast<bsls::Types::Int64>(
+                                                                        42)));
+
+        vector<int> ids(&testAllocator);
+
+        if (verbose) cout << "\tTesting `findActiveRules`." << endl;
+        {
+            ball::AttributeContainerList list(&testAllocator);
+            X.findActiveRules(&ids, list);
+            ASSERT(1               == ids.size());
+            ASSERT(unconditionalId == ids[0]);
+
+            list.pushFront(&client42);
+            X.findActiveRules(&ids, list);
+            ASSERT(2 == ids.size());
+            ASSERT(bsl::min(unconditionalId, clientRuleIds[42]) == ids[0]);
+            ASSERT(bsl::max(unconditionalId, clientRuleIds[42]) == ids[1]);
+
+            // The same attribute held by two containers.
+
+            list.pushFront(&client42);
+            X.findActiveRules(&ids, list);
+            ASSERT(2 == ids.size());
+        }
+        {
+            ball::AttributeContainerList list(&testAllocator);
+            list.pushFront(&client7);
+            X.findActiveRules(&ids, list);
+            ASSERT(2 == ids.size());
+
+            list.pushFront(&rates);
+            X.findActiveRules(&ids, list);
+            ASSERT(3 == ids.size());
+            ASSERT(ids.end() != bsl::find(ids.begin(), ids.end(),
+                                          compoundId));
+            ASSERT(ids.end() != bsl::find(ids.begin(), ids.end(),
+                                          clientRuleIds[7]));
+            for (bsl::size_t i = 1; i < ids.size(); ++i) {
+                LOOP_ASSERT(i, ids[i - 1] < ids[i]);
+            }
+        }
+        {
+            ball::AttributeContainerList list(&testAllocator);
+            list.pushFront(&client42AsInt64);
+            X.findActiveRules(&ids, list);
+            ASSERT(1               == ids.size());
+            ASSERT(unconditionalId == ids[0]);
+        }
+
+        if (verbose) cout << "\tTesting `numMatchingRules`." << endl;
+        {
+            int threshold;
+            ASSERT(NUM_CLIENTS / 2 + 2 == X.numMatchingRules(&threshold,
+                                                             "EQ.MARKET"));
+            ASSERT(251 == threshold);
+
+            ASSERT(NUM_CLIENTS / 2 + 1 == X.numMatchingRules(&threshold,
+                                                             "FX.SPOT"));
+            ASSERT(251 == threshold);
+
+            ASSERT(1   == X.numMatchingRules(&threshold, "RATES"));
+            ASSERT(251 == threshold);
+
+            mX.removeRule(compound);
+            ASSERT(0 == X.numMatchingRules(&threshold, "RATES"));
+            ASSERT(0 == threshold);
+
+            ASSERT(NUM_CLIENTS / 2 == X.numMatchingRules(&threshold,
+                                                         "FX.SPOT"));
+            ASSERT(200 == threshold);
+        }
+
+        if (verbose) cout << "\tTesting removal." << endl;
+        {
+            const int removedId = clientRuleIds[42];
+            ASSERT(1 == mX.removeRuleById(removedId));
+            ASSERT(0 == X.getRuleById(removedId));
+
+            ball::AttributeContainerList list(&testAllocator);
+            list.pushFront(&client42);
+            X.findActiveRules(&ids, list);
+            ASSERT(1               == ids.size());
+            ASSERT(unconditionalId == ids[0]);
+
+            int threshold;
+            ASSERT(NUM_CLIENTS / 2 == X.numMatchingRules(&threshold,
+                                                         "EQ.MARKET"));
+
+            ball::Rule rule("EQ.*", 1, 0, 0, 0, &testAllocator);
+            rule.addAttribute(ball::ManagedAttribute("clientId", 42));
+            ASSERT(removedId == mX.addRule(rule));
+
+            X.findActiveRules(&ids, list);
+            ASSERT(2 == ids.size());
+
+            mX.removeAllRules();
+            ASSERT(0 == X.numRules());
+            ASSERT(0 == X.numPredicates());
+
+            X.findActiveRules(&ids, list);
+            ASSERT(ids.empty());
+            ASSERT(0 == X.numMatchingRules(&threshold, "EQ.MARKET"));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING NON-PRIMARY MANIPULATORS
@@ -489,7 +684,7 @@ int main(int argc, char *argv[])
             {  L_, "R2",            "R0R1R2",       "R0R1R2",       2       },
             {  L_, "",              "R0R1R2",       "R0R1R2",       3       },
 
-            // testing maximum capacity
+            // testing larger rule sets
             {  L_, "",              "r0:32",        "r0:32",        32      },
 
             {  L_, "r0:1",          "r1:32",        "r0:32",        31      },
@@ -503,13 +698,13 @@ int main(int argc, char *argv[])
             {  L_, "r0:31",         "r0:31",        "r0:31",        0       },
             {  L_, "r0:31",         "r30:31",       "r0:31",        0       },
             {  L_, "r0:31",         "r30:32",       "r0:32",        1       },
-            {  L_, "r0:31",         "r30:62",       "r0:31r61:62",  1       },
+            {  L_, "r0:31",         "r30:62",       "r0:62",        31      },
 
             {  L_, "r0:32",         "r0:32",        "r0:32",        0       },
-            {  L_, "r0:32",         "r0:33",        "r0:32",        0       },
+            {  L_, "r0:32",         "r0:33",        "r0:33",        1       },
             {  L_, "r0:32",         "r31:32",       "r0:32",        0       },
-            {  L_, "r0:32",         "r32:33",       "r0:32",        0       },
-            {  L_, "r0:32",         "r32:64",       "r0:32",        0       },
+            {  L_, "r0:32",         "r32:33",       "r0:33",        1       },
+            {  L_, "r0:32",         "r32:64",       "r0:64",        32      },
         };
 
         const int NUM_ADATA = sizeof ADATA / sizeof *ADATA;
@@ -649,32 +844,32 @@ int main(int argc, char *argv[])
             {  L_, "",              30,             "",             0       },
             {  L_, "",              31,             "",             0       },
 
-            {  L_, "R0",            0,              "R0",           0       },
+            {  L_, "R0",            0,              "",             1       },
             {  L_, "R0",            1,              "R0",           0       },
             {  L_, "R0",            30,             "R0",           0       },
-            {  L_, "R0",            31,             "",             1       },
-
-            {  L_, "R0R1",          0,              "R0R1",         0       },
-            {  L_, "R0R1",          1,              "R0R1",         0       },
-            {  L_, "R0R1",          30,             "R0",           1       },
-            {  L_, "R0R1",          31,             "R1",           1       },
-
-            {  L_, "R0R1R2",        0,              "R0R1R2",       0       },
-            {  L_, "R0R1R2",        1,              "R0R1R2",       0       },
-            {  L_, "R0R1R2",        2,              "R0R1R2",       0       },
-            {  L_, "R0R1R2",        29,             "R0R1",         1       },
-            {  L_, "R0R1R2",        30,             "R0R2",         1       },
-            {  L_, "R0R1R2",        31,             "R1R2",         1       },
-
-            {  L_, "r0:31",         0,              "r0:31",        0       },
-            {  L_, "r0:31",         1,              "r0:30",        1       },
-            {  L_, "r0:31",         30,             "r0:1r2:31",    1       },
-            {  L_, "r0:31",         31,             "r1:31",        1       },
-
-            {  L_, "r0:32",         0,              "r0:31",        1       },
-            {  L_, "r0:32",         1,              "r0:30r31:32",  1       },
-            {  L_, "r0:32",         30,             "r0:1:r2:32",   1       },
-            {  L_, "r0:32",         31,             "r1:32",        1       },
+            {  L_, "R0",            31,             "R0",           0       },
+
+            {  L_, "R0R1",          0,              "R1",           1       },
+            {  L_, "R0R1",          1,              "R0",           1       },
+            {  L_, "R0R1",          30,             "R0R1",         0       },
+            {  L_, "R0R1",          31,             "R0R1",         0       },
+
+            {  L_, "R0R1R2",        0,              "R1R2",         1       },
+            {  L_, "R0R1R2",        1,              "R0R2",         1       },
+            {  L_, "R0R1R2",        2,              "R0R1",         1       },
+            {  L_, "R0R1R2",        29,             "R0R1R2",       0       },
+            {  L_, "R0R1R2",        30,             "R0R1R2",       0       },
+            {  L_, "R0R1R2",        31,             "R0R1R2",       0       },
+
+            {  L_, "r0:31",         0,              "r1:31",        1       },
+            {  L_, "r0:31",         1,              "r0:1r2:31",    1       },
+            {  L_, "r0:31",         30,             "r0:30",        1       },
+            {  L_, "r0:31",         31,             "r0:31",        0       },
+
+            {  L_, "r0:32",         0,              "r1:32",        1       },
+            {  L_, "r0:32",         1,              "r0:1r2:32",    1       },
+            {  L_, "r0:32",         30,             "r0:30r31:32",  1       },
+            {  L_, "r0:32",         31,             "r0:31",        1       },
         };
 
         const int NUM_IDATA = sizeof IDATA / sizeof *IDATA;
@@ -1186,7 +1381,7 @@ int main(int argc, char *argv[])
  {  L_,  "R1",     "[ [ pattern = \"eq\" "
                    "thresholds = [    16    32    48    64   ] "
                    " attributeSet = [  [ \"A\" = 1 ] ] ] ]" },
- {  L_,  "R1R2R3", "[ [ pattern = \"eq\" "
+ {  L_,  "R3R2R1", "[ [ pattern = \"eq\" "
                    "thresholds = [    16    32    48    64   ] "
                    " attributeSet = [  [ \"A\" = 1 ]  [ \"A\" = 1 ] "
                    " [ \"A\" = 1 ] ] ] "
@@ -1231,7 +1426,7 @@ int main(int argc, char *argv[])
         } PDATA[] = {
     // line spec     level space expected
     // ---- ----     ----- ----- -----------------------
- {  L_,  "R1R2R3",    1,   2,    "  [\n"
+ {  L_,  "R3R2R1",    1,   2,    "  [\n"
                                  "    [\n"
                                  "      pattern = \"eq\"\n"
                                  "      thresholds = [\n"
@@ -1273,7 +1468,7 @@ int main(int argc, char *argv[])
                                  "    ]\n"
                                  "  ]\n"
  },
- {  L_,  "R1R2R3",    -1,   -2,
+ {  L_,  "R3R2R1",    -1,   -2,
     "[ [ pattern = \"eq\" "
     "thresholds = [         16         32         48         64       ] "
     " attributeSet = [  [ \"A\" = 1 ]  [ \"A\" = 1 ]  [ \"A\" = 1 ] ] ] "
@@ -1323,7 +1518,9 @@ int main(int argc, char *argv[])
         //   returns the same rule, and `ruleId` returns the correct id.
         //   Repeat the verification with another `ball::RuleSet` object
         //   copy-constructed from the original and with yet another
-        //   `ball::RuleSet` object assigned from the original.
+        //   `ball::RuleSet` object assigned from the original.  Finally, add
+        //   `maxNumRules` rules to a rule set, and verify that `addRule`
+        //   returns -2 for a further rule.
         //
         // Testing:
         //   static int maxNumRules();
@@ -1338,13 +1535,19 @@ int main(int argc, char *argv[])
         // calculate n = 2 ** NUM_PREDICATES
         int n = 1 << NUM_PREDICATES;
 
+        // Verify the accessors for a set of `MAX_RULES` rules (a small
+        // fraction of `maxNumRules()`, to save time); the behavior of a full
+        // rule set is verified separately below.
+
+        const int MAX_RULES = 32;
+
         Obj mX; const Obj& X = mX;
-        vector<int> indices(Obj::maxNumRules());
+        vector<int> indices(MAX_RULES);
 
-        // use 2 * maxNumRules() + 1 as the number of trials to save time
-        ASSERT(n >= 2 * Obj::maxNumRules() + 1);
+        // use 2 * MAX_RULES + 1 as the number of trials to save time
+        ASSERT(n >= 2 * MAX_RULES + 1);
 
-        for (int i = 0; i < 2 * Obj::maxNumRules() + 1; ++i) {
+        for (int i = 0; i < 2 * MAX_RULES + 1; ++i) {
 
             ball::Rule rule1("", 0, 0, 0, 0);
 
@@ -1356,7 +1559,7 @@ int main(int argc, char *argv[])
                 }
             }
 
-            if (i < Obj::maxNumRules()) {
+            if (i < MAX_RULES) {
                 LOOP_ASSERT(i, X.numRules() == i);
                 indices[i] = mX.addRule(rule1);
                 LOOP_ASSERT(i, indices[i] >= 0);
@@ -1365,13 +1568,12 @@ int main(int argc, char *argv[])
             }
             else
             {
-                LOOP_ASSERT(i, X.numRules() == X.maxNumRules());
-                LOOP_ASSERT(i, -2 == mX.addRule(rule1));
-                LOOP_ASSERT(i, X.numRules() == X.maxNumRules());
+                LOOP_ASSERT(i, X.numRules() == MAX_RULES);
+                LOOP_ASSERT(i, 0 > X.ruleId(rule1));
             }
 
             // check every rule already in the set
-            for (int j = 0; j <= i && j < Obj::maxNumRules(); ++j) {
+            for (int j = 0; j <= i && j < MAX_RULES; ++j) {
 
                 ball::Rule rule2("", 0, 0, 0, 0);
 
@@ -1404,6 +1606,33 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\tTesting a full rule set." << endl;
+        {
+            Obj mY(&testAllocator); const Obj& Y = mY;
+
+            for (int i = 0; i < Obj::maxNumRules(); ++i) {
+                ball::Rule rule("", 0, 0, 0, 0, &testAllocator);
+                rule.addAttribute(ball::ManagedAttribute("id", i));
+
+                const int id = mY.addRule(rule);
+                if (0 > id || Obj::maxNumRules() <= id) {
+                    LOOP2_ASSERT(i, id, false);
+                    break;
+                }
+            }
+            ASSERT(Y.numRules() == Obj::maxNumRules());
+
+            ball::Rule rule("", 0, 0, 0, 0, &testAllocator);
+            ASSERT(-2 == mY.addRule(rule));
+            ASSERT(Y.numRules() == Obj::maxNumRules());
+
+            ASSERT(1 == mY.removeRuleById(Obj::maxNumRules() / 2));
+            ASSERT(Obj::maxNumRules() / 2 == mY.addRule(rule));
+
+            ball::Rule other("other", 0, 0, 0, 0, &testAllocator);
+            ASSERT(-2 == mY.addRule(other));
+        }
+
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -1453,8 +1682,10 @@ int main(int argc, char *argv[])
 
         n = 1 << NUM_PREDICATES;
 
-        for (int i = 0; i < 2 * Obj::maxNumRules(); ++i) {
-            for (int j = i; j < n && j < i + 2 * Obj::maxNumRules(); ++j) {
+        const int MAX_LENGTH = 32;
+
+        for (int i = 0; i < 2 * MAX_LENGTH; ++i) {
+            for (int j = i; j < n && j < i + 2 * MAX_LENGTH; ++j) {
                 ostringstream spec;
                 spec << 'r' << i << ':' << j;
                 Obj mX(&testAllocator); const Obj& X = mX;
@@ -1462,7 +1693,7 @@ int main(int argc, char *argv[])
 
                 if (veryVerbose) { P_(i); P_(spec.str()); P(X) }
 
-                for (int k = i; k < j && k < i + X.maxNumRules(); ++k) {
+                for (int k = i; k < j; ++k) {
 
                     ball::Rule rule("", 0, 0, 0, 0);
 
@@ -1475,8 +1706,7 @@ int main(int argc, char *argv[])
                     LOOP3_ASSERT(i, j, k, X.ruleId(rule) >= 0);
                 }
 
-                int length = j - i > X.maxNumRules() ? X.maxNumRules() : j - i;
-                LOOP2_ASSERT(i, j, length == X.numRules());
+                LOOP2_ASSERT(i, j, j - i == X.numRules());
 
             }
         }
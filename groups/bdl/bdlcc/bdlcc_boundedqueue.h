@@ -30,6 +30,14 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The `tryPopFront` method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Batch variants of these methods are also provided: `pushBack` and
+// `tryPushBack` accepting an iterator range, and `popFront` and `tryPopFront`
+// accepting a maximum number of elements and a `bsl::vector` to which the
+// removed elements are appended.  A batch operation reserves elements in bulk
+// rather than one at a time, and wakes blocked threads once per batch rather
+// than once per element, amortizing the per-element synchronization cost when
+// elements are produced or consumed in bursts.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // `disablePushBack` method.  When disabled, `pushBack` and `tryPushBack` fail
 // immediately and return an error code.  Any threads blocked in `pushBack`
@@ -217,6 +225,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_climits.h>
 #include <bsl_cstdint.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -289,6 +299,138 @@ class BoundedQueue_PushExceptionCompleteProctor {
     void release();
 };
 
+                   // ==================================
+                   // class BoundedQueue_PopTokenProctor
+                   // ==================================
+
+/// This class implements a proctor that posts a number of tokens back to a
+/// `bslmt::FastPostSemaphore` upon destruction unless `release` has been
+/// called.  It returns the "pop" tokens taken by a batch "pop" operation if
+/// that operation fails before any node is consumed.
+class BoundedQueue_PopTokenProctor {
+
+    // DATA
+    bslmt::FastPostSemaphore *d_semaphore_p;  // managed semaphore
+    int                       d_numTokens;    // number of tokens to post
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopTokenProctor();
+    BoundedQueue_PopTokenProctor(const BoundedQueue_PopTokenProctor&);
+    BoundedQueue_PopTokenProctor& operator=(
+                                         const BoundedQueue_PopTokenProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor that posts the specified `numTokens` tokens to the
+    /// specified `semaphore` upon destruction unless released.
+    BoundedQueue_PopTokenProctor(bslmt::FastPostSemaphore *semaphore,
+                                 int                       numTokens);
+
+    /// Destroy this object and, if `release` has not been invoked, post the
+    /// managed tokens to the managed semaphore.
+    ~BoundedQueue_PopTokenProctor();
+
+    // MANIPULATORS
+
+    /// Release from management the tokens currently managed by this proctor.
+    void release();
+};
+
+                // ========================================
+                // class BoundedQueue_PopBatchCompleteGuard
+                // ========================================
+
+/// This class implements a guard that invokes `TYPE::popBatchComplete` upon
+/// destruction with the range of reserved element indices not yet consumed
+/// and the number of "pop" operations started.
+template <class TYPE>
+class BoundedQueue_PopBatchCompleteGuard {
+
+    // DATA
+    TYPE                *d_queue_p;     // managed queue
+    bsls::Types::Uint64  d_index;       // index of next element to consume
+    bsls::Types::Uint64  d_endIndex;    // one past last reserved index
+    int                  d_numStarted;  // number of started operations
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBatchCompleteGuard();
+    BoundedQueue_PopBatchCompleteGuard(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+    BoundedQueue_PopBatchCompleteGuard& operator=(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popBatchComplete` guard managing the specified `queue` and
+    /// an empty range of reserved element indices.
+    explicit
+    BoundedQueue_PopBatchCompleteGuard(TYPE *queue);
+
+    /// Destroy this object and invoke the managed queue's
+    /// `popBatchComplete` method with the managed range and number of
+    /// started operations.
+    ~BoundedQueue_PopBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate the element at the start of the managed range has been
+    /// consumed.  The behavior is undefined if the managed range is empty.
+    void advance();
+
+    /// Set the managed range of reserved element indices to the specified
+    /// `[index .. endIndex)` and increase the number of started operations
+    /// by `endIndex - index`.  The behavior is undefined unless the
+    /// previously managed range is empty.
+    void reset(bsls::Types::Uint64 index, bsls::Types::Uint64 endIndex);
+};
+
+                // =========================================
+                // class BoundedQueue_PushBatchCompleteGuard
+                // =========================================
+
+/// This class implements a guard that invokes `TYPE::pushBatchComplete` upon
+/// destruction with the range of reserved element indices not yet written
+/// and the number of elements written.
+template <class TYPE>
+class BoundedQueue_PushBatchCompleteGuard {
+
+    // DATA
+    TYPE                *d_queue_p;     // managed queue
+    bsls::Types::Uint64  d_index;       // index of next element to write
+    bsls::Types::Uint64  d_endIndex;    // one past last reserved index
+    int                  d_numWritten;  // number of elements written
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBatchCompleteGuard();
+    BoundedQueue_PushBatchCompleteGuard(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+    BoundedQueue_PushBatchCompleteGuard& operator=(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushBatchComplete` guard managing the specified `queue` and
+    /// the specified range `[index .. endIndex)` of reserved element
+    /// indices.
+    BoundedQueue_PushBatchCompleteGuard(TYPE                *queue,
+                                        bsls::Types::Uint64  index,
+                                        bsls::Types::Uint64  endIndex);
+
+    /// Destroy this object and invoke the managed queue's
+    /// `pushBatchComplete` method with the managed range and number of
+    /// elements written.
+    ~BoundedQueue_PushBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate the element at the start of the managed range has been
+    /// written.  The behavior is undefined if the managed range is empty.
+    void advance();
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -455,6 +597,10 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
 
     /// Return `true` if the specified `lhs` is circularly greater than the
@@ -522,11 +668,40 @@ class BoundedQueue {
     /// complete the reclamation of a node in the presence of an exception.
     void popComplete(Node *node);
 
+    /// Destruct the values stored in the nodes having the specified indices
+    /// `[index .. endIndex)` that were not marked for reclamation, mark the
+    /// specified `numStarted` "pop" operations as finished, and `post` to
+    /// `d_pushSemaphore` if appropriate.  This method is used by a guard
+    /// within `popFrontBatchHelper` to complete a batch of "pop" operations,
+    /// including in the presence of an exception.
+    void popBatchComplete(Uint64 index, Uint64 endIndex, int numStarted);
+
+    /// Remove the specified `count` elements from the front of this queue
+    /// and append them to the specified `buffer`.  This method is invoked by
+    /// `popFront` and `tryPopFront` once `count` elements are available.
+    void popFrontBatchHelper(bsl::vector<TYPE> *buffer, int count);
+
     /// Remove the element from the front of this queue and load that element
     /// into the specified `value`.  This method is invoked by `popFront` and
     /// `tryPopFront` once an element is available.
     void popFrontHelper(TYPE *value);
 
+    /// Append copies of the specified `count` elements starting at the
+    /// specified `*begin` to the back of this queue, and advance `*begin`
+    /// past the appended elements.  This method is invoked by `pushBack` and
+    /// `tryPushBack` once `count` empty elements have been acquired from
+    /// `d_pushSemaphore`.
+    template <class FORWARD_ITERATOR>
+    void pushBackBatchHelper(FORWARD_ITERATOR *begin, int count);
+
+    /// Mark the nodes having the specified indices `[index .. endIndex)` for
+    /// reclamation, mark the specified `numWritten` "push" operations as
+    /// finished and the remaining operations in the batch as aborted, and
+    /// `post` to `d_popSemaphore` if appropriate.  This method is used by a
+    /// guard within `pushBackBatchHelper` to complete a batch of "push"
+    /// operations, including in the presence of an exception.
+    void pushBatchComplete(Uint64 index, Uint64 endIndex, int numWritten);
+
     /// Mark a "push" operation as complete, and `post` to the `d_popSemaphore`
     /// if appropriate.
     void pushComplete();
@@ -589,6 +764,23 @@ class BoundedQueue {
     /// is invoked.
     int popFront(TYPE *value);
 
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue and append them, in order, to the specified `buffer`.  If
+    /// the queue is empty, block until it is not empty.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_SUCCESS` on success, `e_DISABLED` if `isPopFrontDisabled()` and
+    /// `e_FAILED` if an error occurs.  On failure, `buffer` is not changed.
+    /// Threads blocked due to the queue being empty will return
+    /// `e_DISABLED` if `disablePopFront` is invoked.  The behavior is
+    /// undefined unless `0 < maxNumItems`.  Note that the elements are
+    /// reserved with a single operation on the internal synchronization
+    /// primitives, and the resulting capacity is made available to pushing
+    /// threads with a single signal, hence this method is considerably more
+    /// efficient than repeated invocations of `popFront`.  Also note that
+    /// `*buffer` is not cleared -- the popped elements are appended after
+    /// any pre-existing contents.
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  If the
     /// queue is full, block until it is not full.  Return 0 on success, and
     /// a non-zero value otherwise.  Specifically, return `e_SUCCESS` on
@@ -607,6 +799,25 @@ class BoundedQueue {
     /// `disablePushBack` is invoked.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order.  If the queue does not have
+    /// space for all of the elements, append as many as there is space for
+    /// and block until the remaining elements can be appended.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_SUCCESS` on success, `e_DISABLED` if `isPushBackDisabled()` and
+    /// `e_FAILED` if an error occurs.  On failure, a (possibly empty) prefix
+    /// of the range has been appended.  Threads blocked due to the queue
+    /// being full will return `e_DISABLED` if `disablePushBack` is invoked.
+    /// The behavior is undefined unless `FORWARD_ITERATOR` meets the
+    /// requirements of a forward iterator and its value type is convertible
+    /// to `TYPE`.  Note that all the space available for the range is
+    /// reserved with a single operation on the internal synchronization
+    /// primitives, and the appended elements are made available to popping
+    /// threads with a single signal, hence this method is considerably more
+    /// efficient than repeated invocations of `pushBack`.
+    template <class FORWARD_ITERATOR>
+    int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -622,6 +833,18 @@ class BoundedQueue {
     /// an error occurs.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumItems` elements from the
+    /// front of this queue without blocking, and, if successful, append the
+    /// removed elements, in order, to the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_SUCCESS` if at least one element was removed, `e_DISABLED` if
+    /// `isPopFrontDisabled()`, `e_EMPTY` if `!isPopFrontDisabled()` and the
+    /// queue was empty, and `e_FAILED` if an error occurs.  On failure,
+    /// `buffer` is not changed.  The behavior is undefined unless
+    /// `0 < maxNumItems`.  Note that `*buffer` is not cleared -- the popped
+    /// elements are appended after any pre-existing contents.
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_SUCCESS` on success, `e_DISABLED` if `isPushBackDisabled()`,
@@ -637,6 +860,16 @@ class BoundedQueue {
     /// `e_FAILED` if an error occurs.  On failure, `value` is not changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of as many of the elements in the specified range
+    /// `[begin .. end)` as there is space available for to the back of this
+    /// queue, in order, without blocking.  Return the number of elements
+    /// appended.  Note that 0 is returned if `isPushBackDisabled()`.  The
+    /// behavior is undefined unless `FORWARD_ITERATOR` meets the
+    /// requirements of a forward iterator and its value type is convertible
+    /// to `TYPE`.
+    template <class FORWARD_ITERATOR>
+    bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -758,6 +991,119 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                   // ----------------------------------
+                   // class BoundedQueue_PopTokenProctor
+                   // ----------------------------------
+
+// CREATORS
+inline
+BoundedQueue_PopTokenProctor::BoundedQueue_PopTokenProctor(
+                                          bslmt::FastPostSemaphore *semaphore,
+                                          int                       numTokens)
+: d_semaphore_p(semaphore)
+, d_numTokens(numTokens)
+{
+}
+
+inline
+BoundedQueue_PopTokenProctor::~BoundedQueue_PopTokenProctor()
+{
+    if (d_semaphore_p) {
+        d_semaphore_p->post(d_numTokens);
+    }
+}
+
+// MANIPULATORS
+inline
+void BoundedQueue_PopTokenProctor::release()
+{
+    d_semaphore_p = 0;
+}
+
+                // ----------------------------------------
+                // class BoundedQueue_PopBatchCompleteGuard
+                // ----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::BoundedQueue_PopBatchCompleteGuard(
+                                                                   TYPE *queue)
+: d_queue_p(queue)
+, d_index(0)
+, d_endIndex(0)
+, d_numStarted(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::~BoundedQueue_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_index, d_endIndex, d_numStarted);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopBatchCompleteGuard<TYPE>::advance()
+{
+    BSLS_ASSERT(d_index < d_endIndex);
+
+    ++d_index;
+}
+
+template <class TYPE>
+inline
+void BoundedQueue_PopBatchCompleteGuard<TYPE>::reset(
+                                                 bsls::Types::Uint64 index,
+                                                 bsls::Types::Uint64 endIndex)
+{
+    BSLS_ASSERT(d_index == d_endIndex);
+    BSLS_ASSERT(index   <= endIndex);
+
+    d_index       = index;
+    d_endIndex    = endIndex;
+    d_numStarted += static_cast<int>(endIndex - index);
+}
+
+                // -----------------------------------------
+                // class BoundedQueue_PushBatchCompleteGuard
+                // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+             BoundedQueue_PushBatchCompleteGuard(TYPE                *queue,
+                                                 bsls::Types::Uint64  index,
+                                                 bsls::Types::Uint64  endIndex)
+: d_queue_p(queue)
+, d_index(index)
+, d_endIndex(endIndex)
+, d_numWritten(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_index, d_endIndex, d_numWritten);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchCompleteGuard<TYPE>::advance()
+{
+    BSLS_ASSERT(d_index < d_endIndex);
+
+    ++d_index;
+    ++d_numWritten;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -893,6 +1239,112 @@ void BoundedQueue<TYPE>::popComplete(Node *node)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchComplete(Uint64 index,
+                                          Uint64 endIndex,
+                                          int    numStarted)
+{
+    // If an exception occurred while consuming the batch, the values that
+    // were not consumed are discarded (see {Exception Safety}).
+
+    for (; index < endIndex; ++index) {
+        Node& node = d_element_p[index % d_capacity];
+
+        if (!node.isUnconstructed()) {
+            node.d_value.object().~TYPE();
+        }
+    }
+
+    if (0 == numStarted) {
+        return;                                                       // RETURN
+    }
+
+    Uint64 count = markFinishedOperation(&d_popCount, numStarted);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.postWithRedundantSignal(
+                                      static_cast<int>(count & k_STARTED_MASK),
+                                      static_cast<int>(d_capacity),
+                                      1);
+
+            Uint emptyCount = AtomicOp::getUintAcquire(&d_emptyWaiterCount);
+
+            if (isEmpty() && updateEmptyCountSeen(emptyCount)) {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+                }
+                d_emptyCondition.broadcast();
+            }
+        }
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontBatchHelper(bsl::vector<TYPE> *buffer,
+                                             int                count)
+{
+    {
+        // The caller has already taken 'count' tokens from 'd_popSemaphore';
+        // return them if reserving the capacity of 'buffer' throws, since no
+        // node has been claimed yet.
+
+        BoundedQueue_PopTokenProctor proctor(&d_popSemaphore, count);
+
+        buffer->reserve(buffer->size() + count);
+
+        proctor.release();
+    }
+
+    BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> > guard(this);
+
+    // Nodes marked for reclamation are not counted in 'd_popSemaphore', so
+    // each one encountered requires an additional node to be reserved (see
+    // 'popFrontHelper').  The reclaimed nodes are counted as started and
+    // finished "pop" operations so that they are eventually posted to
+    // 'd_pushSemaphore' as empty nodes.
+
+    while (count) {
+        markStartedOperation(&d_popCount, count);
+
+        // 'd_popIndex' stores the next location to use (want the original
+        // value)
+
+        Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, count)
+                                                                       - count;
+
+        guard.reset(index, index + count);
+
+        int reclaim = 0;
+
+        for (int i = 0; i < count; ++i, ++index) {
+            Node& node = d_element_p[index % d_capacity];
+
+            if (!node.isUnconstructed()) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                buffer->push_back(bslmf::MovableRefUtil::move(
+                                                      node.d_value.object()));
+#else
+                buffer->push_back(node.d_value.object());
+#endif
+                node.d_value.object().~TYPE();
+            }
+            else {
+                ++reclaim;
+            }
+            guard.advance();
+        }
+
+        count = reclaim;
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -927,6 +1379,76 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+template <class FORWARD_ITERATOR>
+void BoundedQueue<TYPE>::pushBackBatchHelper(FORWARD_ITERATOR *begin,
+                                             int               count)
+{
+    markStartedOperation(&d_pushCount, count);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, count) - count;
+
+    BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> > guard(
+                                                                this,
+                                                                index,
+                                                                index + count);
+
+    for (int i = 0; i < count; ++i, ++index, ++*begin) {
+        Node& node = d_element_p[index % d_capacity];
+
+        node.setIsUnconstructed(true);
+
+        bslalg::ScalarPrimitives::construct(node.d_value.address(),
+                                            **begin,
+                                            d_allocator_p);
+
+        node.setIsUnconstructed(false);
+
+        guard.advance();
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchComplete(Uint64 index,
+                                           Uint64 endIndex,
+                                           int    numWritten)
+{
+    // Nodes that were not written (due to an exception) are marked for
+    // reclamation, and the corresponding "push" operations are removed from
+    // 'd_pushCount' (see 'pushExceptionComplete').
+
+    int numAborted = static_cast<int>(endIndex - index);
+
+    for (; index < endIndex; ++index) {
+        d_element_p[index % d_capacity].setIsUnconstructed(true);
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                       &d_pushCount,
+                                         numWritten * k_FINISHED_INC
+                                       + numAborted * k_STARTED_DEC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.postWithRedundantSignal(
+                                                 numToPost,
+                                                 static_cast<int>(d_capacity),
+                                                 1);
+        }
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::pushComplete()
@@ -1048,6 +1570,33 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFront(bsl::size_t        maxNumItems,
+                                 bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    // Acquire, without blocking, as many of the remaining requested elements
+    // as are available.
+
+    int count = 1 + d_popSemaphore.take(static_cast<int>(
+                         maxNumItems - 1 < d_capacity ? maxNumItems - 1
+                                                      : d_capacity));
+
+    popFrontBatchHelper(buffer, count);
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -1121,6 +1670,37 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+template <class FORWARD_ITERATOR>
+int BoundedQueue<TYPE>::pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end)
+{
+    bsl::size_t remaining = static_cast<bsl::size_t>(
+                                                   bsl::distance(begin, end));
+
+    while (0 < remaining) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        // Acquire, without blocking, as many of the remaining required empty
+        // elements as are available.
+
+        int count = 1 + d_pushSemaphore.take(static_cast<int>(
+                             remaining - 1 < d_capacity ? remaining - 1
+                                                        : d_capacity));
+
+        pushBackBatchHelper(&begin, count);
+
+        remaining -= count;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -1207,6 +1787,33 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFront(bsl::size_t        maxNumItems,
+                                    bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    int count = 1 + d_popSemaphore.take(static_cast<int>(
+                         maxNumItems - 1 < d_capacity ? maxNumItems - 1
+                                                      : d_capacity));
+
+    popFrontBatchHelper(buffer, count);
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1286,6 +1893,27 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+template <class FORWARD_ITERATOR>
+bsl::size_t BoundedQueue<TYPE>::tryPushBack(FORWARD_ITERATOR begin,
+                                            FORWARD_ITERATOR end)
+{
+    bsl::size_t remaining = static_cast<bsl::size_t>(
+                                                   bsl::distance(begin, end));
+
+    if (0 == remaining || 0 != d_pushSemaphore.tryWait()) {
+        return 0;                                                     // RETURN
+    }
+
+    int count = 1 + d_pushSemaphore.take(static_cast<int>(
+                             remaining - 1 < d_capacity ? remaining - 1
+                                                        : d_capacity));
+
+    pushBackBatchHelper(&begin, count);
+
+    return static_cast<bsl::size_t>(count);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -24,6 +24,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -82,12 +83,16 @@ using namespace bsl;
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [16] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [16] int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [16] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [16] bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -102,7 +107,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -114,6 +119,8 @@ using namespace bsl;
 // [13] DRQS 164984269: `removeAll` STARTED/FINISHED ISSUE
 // [14] DRQS 153332608: `pushBack`, `pushBack`, `waitUntilEmpty`
 // [15] DRQS 168011541: `waitUntilEmpty` RACE WITH `disablePopFront`
+// [16] CONCERN: batch operations
+// [-1] PERFORMANCE: per-item cost of batch operations
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -836,6 +843,77 @@ extern "C" void *case13_popFront(void *arg)
     return 0;
 }
 
+struct BatchData {
+    Obj *d_obj_p;      // queue under test
+    int  d_id;         // identifier of the pushing thread
+    int  d_numItems;   // number of items to push or pop
+    int  d_batchSize;  // maximum number of items per operation
+};
+
+/// Push `d_numItems` values to `d_obj_p` of the specified `arg`, which must
+/// be a `BatchData`, using `pushBack` on ranges of at most `d_batchSize`
+/// values.  The values pushed by thread `d_id` are
+/// `d_id * d_numItems + [0 .. d_numItems)`, in increasing order.
+extern "C" void *batchPush(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int value = data.d_id * data.d_numItems;
+    int end   = value + data.d_numItems;
+
+    while (value < end) {
+        values.clear();
+        while (value < end
+            && static_cast<int>(values.size()) < data.d_batchSize) {
+            values.push_back(value++);
+        }
+        ASSERT(e_SUCCESS == data.d_obj_p->pushBack(values.begin(),
+                                                   values.end()));
+    }
+
+    return 0;
+}
+
+/// Pop `d_numItems` values from `d_obj_p` of the specified `arg`, which
+/// must be a `BatchData`, using `popFront(TYPE *)`.
+extern "C" void *singlePop(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    int value;
+
+    for (int i = 0; i < data.d_numItems; ++i) {
+        ASSERT(e_SUCCESS == data.d_obj_p->popFront(&value));
+    }
+
+    return 0;
+}
+
+/// Pop `d_numItems` values from `d_obj_p` of the specified `arg`, which
+/// must be a `BatchData`, using `popFront` with a maximum of `d_batchSize`
+/// values per operation.
+extern "C" void *batchPop(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int numPopped = 0;
+
+    while (numPopped < data.d_numItems) {
+        values.clear();
+        ASSERT(e_SUCCESS == data.d_obj_p->popFront(data.d_batchSize,
+                                                   &values));
+        numPopped += static_cast<int>(values.size());
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1064,7 +1142,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1091,6 +1169,263 @@ int main(int argc, char *argv[])
         myProducer(k_NUM_THREADS);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBack` and `tryPushBack` taking a range append the elements
+        //    of the range, in order.
+        //
+        // 2. `tryPushBack` taking a range appends the longest prefix of the
+        //    range that fits in the queue and returns its length.
+        //
+        // 3. `popFront` and `tryPopFront` taking a maximum number of items
+        //    remove at most that many elements, in order, and append them to
+        //    the supplied buffer without disturbing its existing contents.
+        //
+        // 4. `tryPopFront` returns `e_EMPTY` on an empty queue, and the
+        //    batch methods fail when the queue is disabled, leaving the
+        //    buffer unchanged.
+        //
+        // 5. `pushBack` taking a range larger than the capacity of the queue
+        //    blocks until all the elements are appended.
+        //
+        // 6. Concurrent batch producers and a batch consumer transfer every
+        //    element exactly once, and the elements from one producer are
+        //    consumed in the order produced.
+        //
+        // 7. The batch methods work with allocating types and allocate
+        //    memory only from the object allocator.
+        //
+        // 8. If growing the supplied buffer throws, the batch "pop" methods
+        //    leave the queue unchanged, and all of its elements can still be
+        //    popped.
+        //
+        // Plan:
+        // 1. Directly exercise the batch methods on a queue of `int` and
+        //    verify the results with the single-element methods and the
+        //    accessors.  (C-1..4)
+        //
+        // 2. Create a thread that pops elements one at a time while the main
+        //    thread pushes a range larger than the capacity.  (C-5)
+        //
+        // 3. Create several threads using `pushBack` on ranges and a thread
+        //    using `popFront` with a maximum number of items; verify the
+        //    consumed values.  (C-6)
+        //
+        // 4. Repeat a subset of P-1 with a queue of `bsl::string` using a
+        //    test allocator and verify the default allocator is unused.
+        //    (C-7)
+        //
+        // 5. Using a buffer supplied with a test allocator, pop a batch of
+        //    elements within the `bslma` exception-testing loop, verifying
+        //    at each iteration that the queue still holds all its elements
+        //    and that `tryPopFront` (which does not block) succeeds.  (C-8)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+        //   int tryPopFront(bsl::size_t maxNumItems, vector<TYPE> *buffer);
+        //   bsl::size_t tryPushBack(FORWARD_ITERATOR, FORWARD_ITERATOR);
+        //   CONCERN: batch operations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: BATCH OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        const int DATA[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nDirect test of batch methods." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 3));
+            ASSERT(3 == X.numElements());
+
+            ASSERT(0 == mX.tryPushBack(DATA, DATA));
+            ASSERT(5 == mX.tryPushBack(DATA + 3, DATA + NUM_DATA));
+            ASSERT(8 == X.numElements());
+            ASSERT(X.isFull());
+
+            ASSERT(0 == mX.tryPushBack(DATA + 8, DATA + NUM_DATA));
+
+            bsl::vector<int> buffer(1, -1);
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(3, &buffer));
+            ASSERT(4 == buffer.size());
+            ASSERT(5 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFront(100, &buffer));
+            ASSERT(9 == buffer.size());
+            ASSERT(0 == X.numElements());
+
+            ASSERT(-1 == buffer[0]);
+            for (int i = 1; i < 9; ++i) {
+                ASSERTV(i, buffer[i], DATA[i - 1] == buffer[i]);
+            }
+
+            ASSERT(e_EMPTY == mX.tryPopFront(4, &buffer));
+            ASSERT(9 == buffer.size());
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 2));
+
+            buffer.clear();
+            ASSERT(e_SUCCESS == mX.popFront(1, &buffer));
+            ASSERT(1 == buffer.size() && DATA[0] == buffer[0]);
+
+            int value;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(DATA[1] == value);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBack(DATA, DATA + 2));
+            ASSERT(0 == mX.tryPushBack(DATA, DATA + 2));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            mX.pushBack(DATA, DATA + 2);
+
+            mX.disablePopFront();
+
+            buffer.clear();
+            ASSERT(e_DISABLED == mX.popFront(2, &buffer));
+            ASSERT(e_DISABLED == mX.tryPopFront(2, &buffer));
+            ASSERT(buffer.empty());
+            ASSERT(2 == X.numElements());
+        }
+
+        if (verbose) cout << "\nRange larger than the capacity." << endl;
+        {
+            Obj mX(4);  const Obj& X = mX;
+
+            BatchData data = { &mX, 0, NUM_DATA, 1 };
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, batchPop, &data);
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + NUM_DATA));
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(0 == X.numElements());
+        }
+
+        if (verbose) cout << "\nConcurrent batch producers." << endl;
+        {
+            enum { k_NUM_PUSHERS = 4, k_NUM_ITEMS = 10000 };
+
+            static const int BATCH_SIZES[] = { 1, 7, 64 };
+
+            for (int ti = 0; ti < 3; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                Obj mX(32);  const Obj& X = mX;
+
+                BatchData                 data[k_NUM_PUSHERS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_PUSHERS];
+
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    BatchData d = { &mX, i, k_NUM_ITEMS, BATCH_SIZE };
+
+                    data[i] = d;
+                    bslmt::ThreadUtil::create(&handles[i],
+                                              batchPush,
+                                              &data[i]);
+                }
+
+                bsl::vector<int> next(k_NUM_PUSHERS);
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    next[i] = i * k_NUM_ITEMS;
+                }
+
+                bsl::vector<int> buffer;
+                int              numPopped = 0;
+
+                while (numPopped < k_NUM_PUSHERS * k_NUM_ITEMS) {
+                    buffer.clear();
+                    ASSERT(e_SUCCESS == mX.popFront(BATCH_SIZE, &buffer));
+                    ASSERT(0 < buffer.size());
+                    ASSERT(static_cast<int>(buffer.size()) <= BATCH_SIZE);
+
+                    for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                        const int id = buffer[i] / k_NUM_ITEMS;
+
+                        ASSERTV(BATCH_SIZE, buffer[i], next[id] == buffer[i]);
+                        next[id] = buffer[i] + 1;
+                    }
+
+                    numPopped += static_cast<int>(buffer.size());
+                }
+
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                ASSERT(0 == X.numElements());
+            }
+        }
+
+        if (verbose) cout << "\nAllocating type." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const char *LONG = "this string is long enough to allocate memory";
+
+            bsl::vector<bsl::string> values(&sa);
+            for (int i = 0; i < 5; ++i) {
+                values.push_back(bsl::string(LONG, &sa));
+            }
+
+            {
+                AllocObj mX(4, &sa);  const AllocObj& X = mX;
+
+                ASSERT(4 == mX.tryPushBack(values.begin(), values.end()));
+                ASSERT(4 == X.numElements());
+
+                bsl::vector<bsl::string> buffer(&sa);
+
+                ASSERT(e_SUCCESS == mX.popFront(2, &buffer));
+                ASSERT(2 == buffer.size());
+                ASSERT(LONG == buffer[1]);
+                ASSERT(&sa == buffer[1].get_allocator().mechanism());
+            }
+
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nException while growing the buffer." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator ba("buffer",   veryVeryVeryVerbose);
+
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 6));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ba) {
+                ASSERTV(X.numElements(), 6 == X.numElements());
+
+                bsl::vector<int> buffer(&ba);
+
+                ASSERT(e_SUCCESS == mX.tryPopFront(8, &buffer));
+                ASSERTV(buffer.size(), 6 == buffer.size());
+
+                for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                    ASSERTV(i, buffer[i], DATA[i] == buffer[i]);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == X.numElements());
+            ASSERT(0 == ba.numBlocksInUse());
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // DRQS 168011541: `waitUntilEmpty` RACE WITH `disablePopFront`
@@ -3160,6 +3495,87 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PER-ITEM COST OF BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. Measure the cost per element of transferring elements from a
+        //    producer thread to a consumer thread using the single-element
+        //    methods and using the batch methods with batch sizes of 1, 16,
+        //    and 256.
+        //
+        // Plan:
+        // 1. For each batch size, transfer a fixed number of elements from a
+        //    thread using `pushBack` on ranges to a thread using `popFront`
+        //    with a maximum number of items, and report the elapsed wall time
+        //    per element.  Repeat with `pushBack(const TYPE&)` and
+        //    `popFront(TYPE *)` as a baseline.
+        //
+        // Testing:
+        //   PERFORMANCE: per-item cost of batch operations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PER-ITEM COST OF BATCH OPERATIONS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const int k_CAPACITY  = 1024;
+        const int k_NUM_ITEMS = 1 << 22;
+
+        {
+            Obj mX(k_CAPACITY);
+
+            BatchData data = { &mX, 0, k_NUM_ITEMS, 1 };
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, singlePop, &data);
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                mX.pushBack(i);
+            }
+
+            bslmt::ThreadUtil::join(handle);
+
+            timer.stop();
+
+            cout << "single:\t"
+                 << timer.accumulatedWallTime() * 1.0e9 / k_NUM_ITEMS
+                 << " ns/item" << endl;
+        }
+
+        static const int BATCH_SIZES[] = { 1, 16, 256 };
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int BATCH_SIZE = BATCH_SIZES[ti];
+
+            Obj mX(k_CAPACITY);
+
+            BatchData pushData = { &mX, 0, k_NUM_ITEMS, BATCH_SIZE };
+            BatchData popData  = { &mX, 0, k_NUM_ITEMS, BATCH_SIZE };
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, batchPop, &popData);
+
+            batchPush(&pushData);
+
+            bslmt::ThreadUtil::join(handle);
+
+            timer.stop();
+
+            cout << "batch " << BATCH_SIZE << ":\t"
+                 << timer.accumulatedWallTime() * 1.0e9 / k_NUM_ITEMS
+                 << " ns/item" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
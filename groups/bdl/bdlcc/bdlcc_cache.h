@@ -32,6 +32,9 @@ BSLS_IDENT("$Id: $")
 // the longest period of time will be evicted first.  With FIFO, the eviction
 // order is based on the order of insertion, with the earliest inserted item
 // being evicted first.
+// The `e_SLRU` and `e_TINYLFU` values of `bdlcc::CacheEvictionPolicy` are
+// implemented by `bdlcc::ShardedCache` (see `bdlcc_shardedcache`);
+// `bdlcc::Cache` treats both as LRU.
 //
 ///Thread Safety
 ///-------------
@@ -332,11 +335,15 @@ struct CacheEvictionPolicy {
 
     // TYPES
 
-    /// Enumeration of supported cache eviction policies.
+    /// Enumeration of supported cache eviction policies.  Note that
+    /// `e_SLRU` and `e_TINYLFU` are fully supported only by
+    /// `bdlcc::ShardedCache`; `bdlcc::Cache` treats them as `e_LRU`.
     enum Enum {
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,     // Least Recently Used
+        e_FIFO,    // First In, First Out
+        e_SLRU,    // Segmented LRU (probationary and protected segments)
+        e_TINYLFU  // SLRU guarded by a TinyLFU admission window
     };
 };
 
@@ -1078,7 +1085,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
                                    const KEY&              key,
                                    bool                    modifyEvictionQueue)
 {
-    int writeLock = d_evictionPolicy == CacheEvictionPolicy::e_LRU &&
+    int writeLock = d_evictionPolicy != CacheEvictionPolicy::e_FIFO &&
          modifyEvictionQueue ? 1 : 0;
     if (writeLock) {
         d_rwlock.lockWrite();
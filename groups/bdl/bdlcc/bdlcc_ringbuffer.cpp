@@ -0,0 +1,178 @@
+// bdlcc_ringbuffer.cpp                                               -*-C++-*-
+#include <bdlcc_ringbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_ringbuffer_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <immintrin.h>
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Implementation note: A thread sleeping in `RingBuffer_Waiter::commitWait`
+// must not miss the progress made by another thread.  The sleeping thread
+// increments `d_numWaiters` and then checks whether it can make progress,
+// while the other thread publishes its progress and then loads
+// `d_numWaiters`.  Since all four operations are sequentially consistent, at
+// least one of the threads observes the effect of the other: either the
+// sleeping thread observes the progress and cancels its wait, or the other
+// thread observes the waiter and increments `d_epoch`, in which case the
+// futex wait (or the wait on the condition) returns immediately if it has not
+// yet begun.
+
+namespace {
+
+/// Number of attempts before a blocked thread stops spinning, under the
+/// `e_SPIN_THEN_YIELD` and `e_PARK` strategies.
+const int k_SPIN_ATTEMPTS = 128;
+
+/// Number of attempts before a blocked thread stops yielding and sleeps,
+/// under the `e_PARK` strategy.
+const int k_YIELD_ATTEMPTS = 16;
+
+/// Hint to the CPU that the calling thread is busy-waiting.
+inline
+void spinPause()
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    _mm_pause();
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                          // -----------------------
+                          // class RingBuffer_Waiter
+                          // -----------------------
+
+// CREATORS
+RingBuffer_Waiter::RingBuffer_Waiter(RingBufferWaitStrategy::Enum strategy)
+: d_numWaiters(0)
+, d_strategy(strategy)
+{
+    bsls::AtomicOperations::initInt(&d_epoch, 0);
+}
+
+// MANIPULATORS
+bool RingBuffer_Waiter::backOff(int attempt)
+{
+    switch (d_strategy) {
+      case RingBufferWaitStrategy::e_SPIN: {
+        spinPause();
+      } break;
+      case RingBufferWaitStrategy::e_SPIN_THEN_YIELD: {
+        if (attempt < k_SPIN_ATTEMPTS) {
+            spinPause();
+        }
+        else {
+            bslmt::ThreadUtil::yield();
+        }
+      } break;
+      case RingBufferWaitStrategy::e_PARK: {
+        if (attempt < k_SPIN_ATTEMPTS) {
+            spinPause();
+        }
+        else if (attempt < k_SPIN_ATTEMPTS + k_YIELD_ATTEMPTS) {
+            bslmt::ThreadUtil::yield();
+        }
+        else {
+            return true;                                              // RETURN
+        }
+      } break;
+    }
+
+    return false;
+}
+
+void RingBuffer_Waiter::cancelWait()
+{
+    d_numWaiters.add(-1);
+}
+
+void RingBuffer_Waiter::commitWait(int key)
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    syscall(SYS_futex, &d_epoch.d_value, FUTEX_WAIT_PRIVATE, key, 0, 0, 0);
+#else
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (key == bsls::AtomicOperations::getInt(&d_epoch)) {
+            d_condition.wait(&d_mutex);
+        }
+    }
+#endif
+
+    d_numWaiters.add(-1);
+}
+
+int RingBuffer_Waiter::prepareWait()
+{
+    const int key = bsls::AtomicOperations::getInt(&d_epoch);
+
+    d_numWaiters.add(1);
+
+    return key;
+}
+
+void RingBuffer_Waiter::wake()
+{
+    if (0 < d_numWaiters.load()) {
+        bsls::AtomicOperations::addInt(&d_epoch, 1);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        syscall(SYS_futex, &d_epoch.d_value, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+#else
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_condition.signal();
+#endif
+    }
+}
+
+void RingBuffer_Waiter::wakeAll()
+{
+    bsls::AtomicOperations::addInt(&d_epoch, 1);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    syscall(SYS_futex,
+            &d_epoch.d_value,
+            FUTEX_WAKE_PRIVATE,
+            0x7FFFFFFF,
+            0,
+            0,
+            0);
+#else
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_condition.broadcast();
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1075 @@
+// bdlcc_ringbuffer.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLCC_RINGBUFFER
+#define INCLUDED_BDLCC_RINGBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free bounded MPMC queue with pluggable waiting.
+//
+//@CLASSES:
+//  bdlcc::RingBuffer: lock-free bounded multi-producer/multi-consumer queue
+//  bdlcc::RingBufferWaitStrategy: namespace for the blocking strategies
+//
+//@SEE_ALSO: bdlcc_boundedqueue, bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component defines a class template, `bdlcc::RingBuffer`,
+// implementing a lock-free, fixed-capacity, multi-producer/multi-consumer
+// queue intended for latency-critical pipelines, and an enumeration,
+// `bdlcc::RingBufferWaitStrategy`, selecting how blocked threads wait.
+//
+// The queue is an array of cells, each holding a sequence number and storage
+// for one element.  A producer claims the cell at the back of the queue by
+// advancing the push position with a single compare-and-swap, constructs the
+// element in place, and publishes it by storing the next sequence number in
+// the cell; a consumer proceeds symmetrically from the front.  The sequence
+// number of a cell tells a thread whether the cell is ready for it, so an
+// operation touches only the position it advances and the cell it claims,
+// and the push and pop positions reside on separate cache lines to avoid
+// false sharing between producers and consumers.  The capacity is rounded up
+// to a power of 2, and is at least 2.
+//
+// The `tryPushBack` and `tryPopFront` methods never block.  The `pushBack`
+// and `popFront` methods retry until they succeed or the queue is disabled,
+// waiting between attempts as specified by the wait strategy supplied at
+// construction:
+//
+// * `e_SPIN`: Retry immediately, issuing a CPU pause instruction (where
+//   available) between attempts.  This achieves the lowest hand-off latency
+//   but occupies a CPU for as long as the thread waits, and should be used
+//   only when each waiting thread has a dedicated CPU.
+//
+// * `e_SPIN_THEN_YIELD`: Spin for a short while, then yield the CPU between
+//   attempts.
+//
+// * `e_PARK`: Spin for a short while, then sleep until another thread makes
+//   progress possible.  On Linux the sleep uses a futex; elsewhere it uses a
+//   condition variable.  This is the default.  Note that, with this strategy
+//   only, every push and pop checks for sleeping threads, at the cost of one
+//   full memory barrier.
+//
+// Unlike `bdlcc::BoundedQueue` and `bdlcc::FixedQueue`, which wake blocked
+// threads through semaphores regardless of how long the threads have been
+// waiting, a `bdlcc::RingBuffer` with the `e_SPIN` or `e_SPIN_THEN_YIELD`
+// strategy never makes a system call to hand off an element.
+//
+// The queue may be disabled for pushing or popping, in which case the
+// corresponding operations fail immediately, as for `bdlcc::BoundedQueue`.
+//
+///Template Requirements
+///---------------------
+// `bdlcc::RingBuffer` is a template that is parameterized on the type of
+// element contained within the queue.  The supplied template argument,
+// `TYPE`, must be copy-constructible or move-constructible (to push), and
+// copy-assignable or move-assignable (to pop).  If `TYPE` uses
+// `bslma::Allocator`, the allocator of the queue is propagated to the
+// elements.  Unlike `bdlcc::FixedQueue`, `TYPE` need not be
+// default-constructible, as cells are not constructed until an element is
+// pushed.
+//
+///Exception Safety
+///----------------
+// If the construction of an element throws an exception, the cell claimed by
+// the push is released without an element, the exception is propagated, and
+// the queue is otherwise unaffected.  If the assignment of a popped element
+// to the value supplied by the caller throws an exception, the element is
+// removed from the queue and destroyed, and the exception is propagated.
+// Note that, in the former case, `numElements` may briefly count the
+// released cell.
+//
+///Thread Safety
+///-------------
+// `bdlcc::RingBuffer` is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Latency-Sensitive Pipeline Stage
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market-data handler hands each decoded message from the
+// thread that reads the network to a thread that updates an order book, and
+// that the latency of the hand-off matters more than the CPU consumed by the
+// waiting thread.
+//
+// First, we define the message type:
+// ```
+// struct Message {
+//     int    d_sequenceNumber;
+//     double d_price;
+// };
+// ```
+// Then, we define the function run by the order-book thread, which pops
+// messages until the queue is disabled:
+// ```
+// void updateBook(bdlcc::RingBuffer<Message> *queue, double *total)
+// {
+//     Message message;
+//     while (0 == queue->popFront(&message)) {
+//         *total += message.d_price;
+//     }
+// }
+// ```
+// Next, we create a queue that spins briefly and then yields while it is
+// empty or full, and start the order-book thread:
+// ```
+// bdlcc::RingBuffer<Message> queue(
+//                          1024,
+//                          bdlcc::RingBufferWaitStrategy::e_SPIN_THEN_YIELD);
+//
+// double total = 0.0;
+//
+// bslmt::ThreadUtil::Handle handle;
+// bslmt::ThreadUtil::createWithAllocator(
+//                        &handle,
+//                        bdlf::BindUtil::bind(&updateBook, &queue, &total),
+//                        bslma::Default::globalAllocator());
+// ```
+// Then, the network thread pushes the decoded messages:
+// ```
+// for (int i = 0; i < 10000; ++i) {
+//     Message message = { i, 0.5 };
+//     queue.pushBack(message);
+// }
+// ```
+// Finally, we wait until the order-book thread has consumed every message,
+// disable popping to make it return, and join it:
+// ```
+// while (!queue.isEmpty()) {
+//     bslmt::ThreadUtil::yield();
+// }
+// queue.disablePopFront();
+// bslmt::ThreadUtil::join(handle);
+//
+// assert(5000.0 == total);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                       // =============================
+                       // struct RingBufferWaitStrategy
+                       // =============================
+
+/// This struct provides a namespace for enumerating the ways in which a
+/// thread blocked on a `RingBuffer` waits.
+struct RingBufferWaitStrategy {
+
+    // TYPES
+
+    /// Enumeration of supported wait strategies (see {Description}).
+    enum Enum {
+        e_SPIN,            // busy-wait with CPU pause instructions
+        e_SPIN_THEN_YIELD, // busy-wait, then yield the CPU between attempts
+        e_PARK             // busy-wait, then sleep until woken
+    };
+};
+
+                          // =======================
+                          // class RingBuffer_Waiter
+                          // =======================
+
+/// This component-private class implements the waiting performed, according
+/// to a `RingBufferWaitStrategy`, by the threads blocked on one side (empty
+/// or full) of a `RingBuffer`.  A blocked thread calls `backOff` after each
+/// failed attempt; if `backOff` returns `true`, the thread calls
+/// `prepareWait`, checks again whether it can make progress, and then calls
+/// either `cancelWait` or `commitWait`.  Threads making progress possible
+/// call `wake` after publishing their progress.
+class RingBuffer_Waiter {
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int
+                                  d_epoch;       // incremented by each `wake`
+                                                 // that finds waiters; the
+                                                 // futex word on Linux
+
+    bsls::AtomicInt               d_numWaiters;  // threads between
+                                                 // `prepareWait` and the end
+                                                 // of `commitWait` or
+                                                 // `cancelWait`
+
+    RingBufferWaitStrategy::Enum  d_strategy;    // wait strategy
+
+#ifndef BSLS_PLATFORM_OS_LINUX
+    bslmt::Mutex                  d_mutex;       // protects the condition
+
+    bslmt::Condition              d_condition;   // signaled by `wake`
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    RingBuffer_Waiter(const RingBuffer_Waiter&);
+    RingBuffer_Waiter& operator=(const RingBuffer_Waiter&);
+
+  public:
+    // CREATORS
+
+    /// Create a waiter using the specified `strategy`.
+    explicit RingBuffer_Waiter(RingBufferWaitStrategy::Enum strategy);
+
+    // MANIPULATORS
+
+    /// Wait as appropriate after the specified number of previous failed
+    /// `attempt`s, and return `true` if the calling thread should sleep
+    /// (using `prepareWait` and `commitWait`), and `false` if it should
+    /// simply retry.
+    bool backOff(int attempt);
+
+    /// Cancel the wait prepared by `prepareWait`.
+    void cancelWait();
+
+    /// Sleep until `wake` is called or until the epoch differs from the
+    /// specified `key` obtained from `prepareWait`, and complete the wait.
+    /// Note that this method may return spuriously.
+    void commitWait(int key);
+
+    /// Register the calling thread as a waiter, and return a key to be
+    /// passed to `commitWait`.  The calling thread must check whether it
+    /// can make progress after this call, and then call either `cancelWait`
+    /// or `commitWait`.
+    int prepareWait();
+
+    /// Wake one thread sleeping in `commitWait`, if any.  The behavior is
+    /// undefined unless the progress made by the calling thread was
+    /// published with sequentially consistent memory ordering.
+    void wake();
+
+    /// Wake all threads sleeping in `commitWait`.
+    void wakeAll();
+};
+
+                          // =====================
+                          // struct RingBuffer_Cell
+                          // =====================
+
+/// This component-private struct describes one cell of a `RingBuffer`.
+template <class TYPE>
+struct RingBuffer_Cell {
+
+    // PUBLIC DATA
+    bsls::AtomicUint64       d_sequence;  // position for which the cell is
+                                          // ready: `p` if ready to be pushed
+                                          // at `p`, and `p + 1` if ready to
+                                          // be popped at `p`
+
+    bool                     d_hasValue;  // `false` if the element could not
+                                          // be constructed
+
+    bsls::ObjectBuffer<TYPE> d_value;     // element
+};
+
+                           // ================
+                           // class RingBuffer
+                           // ================
+
+/// This class provides a thread-safe, lock-free, bounded queue of values.
+template <class TYPE>
+class RingBuffer {
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_PAD = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    // PRIVATE TYPES
+    typedef RingBuffer_Cell<TYPE> Cell;
+    typedef bsls::Types::Uint64   Uint64;
+    typedef bsls::Types::Int64    Int64;
+    typedef bslmf::MovableRefUtil MoveUtil;
+
+    /// This guard, on destruction, destroys the element in a cell claimed
+    /// by a pop and releases the cell to producers.
+    class PopGuard {
+
+        // DATA
+        RingBuffer *d_queue_p;
+        Cell       *d_cell_p;
+        Uint64      d_position;
+
+      public:
+        // CREATORS
+        PopGuard(RingBuffer *queue, Cell *cell, Uint64 position)
+        : d_queue_p(queue)
+        , d_cell_p(cell)
+        , d_position(position)
+        {
+        }
+
+        ~PopGuard()
+        {
+            if (d_cell_p->d_hasValue) {
+                bslma::DestructionUtil::destroy(
+                                              d_cell_p->d_value.address());
+            }
+            d_queue_p->publish(&d_queue_p->d_notFull,
+                               d_cell_p,
+                               d_position + d_queue_p->d_capacity);
+        }
+    };
+
+    /// This proctor, on destruction, publishes a cell claimed by a push,
+    /// marking it as holding no element unless `release` was called.
+    class PushProctor {
+
+        // DATA
+        RingBuffer *d_queue_p;
+        Cell       *d_cell_p;
+        Uint64      d_position;
+
+      public:
+        // CREATORS
+        PushProctor(RingBuffer *queue, Cell *cell, Uint64 position)
+        : d_queue_p(queue)
+        , d_cell_p(cell)
+        , d_position(position)
+        {
+            d_cell_p->d_hasValue = false;
+        }
+
+        ~PushProctor()
+        {
+            d_queue_p->publish(&d_queue_p->d_notEmpty,
+                               d_cell_p,
+                               d_position + 1);
+        }
+
+        // MANIPULATORS
+        void release()
+        {
+            d_cell_p->d_hasValue = true;
+        }
+    };
+
+    friend class PopGuard;
+    friend class PushProctor;
+
+    // DATA
+    bsls::AtomicUint64  d_pushPosition;        // next position to push
+
+    char                d_pushPad[k_PAD];      // padding
+
+    bsls::AtomicUint64  d_popPosition;         // next position to pop
+
+    char                d_popPad[k_PAD];       // padding
+
+    RingBuffer_Waiter   d_notEmpty;            // waited on by poppers
+
+    char                d_notEmptyPad[k_PAD];  // padding
+
+    RingBuffer_Waiter   d_notFull;             // waited on by pushers
+
+    char                d_notFullPad[k_PAD];   // padding
+
+    Cell               *d_cells_p;             // array of cells
+
+    Uint64              d_capacity;            // number of cells (power of
+                                               // 2, at least 2, so that the
+                                               // sequence numbers of a cell
+                                               // are unambiguous)
+
+    Uint64              d_mask;                // `d_capacity - 1`
+
+    bool                d_parking;             // `true` if the wait strategy
+                                               // is `e_PARK`
+
+    RingBufferWaitStrategy::Enum
+                        d_waitStrategy;        // wait strategy
+
+    bsls::AtomicBool    d_popFrontDisabled;    // `true` if popping is
+                                               // disabled
+
+    bsls::AtomicBool    d_pushBackDisabled;    // `true` if pushing is
+                                               // disabled
+
+    bslma::Allocator   *d_allocator_p;         // memory allocator (held, not
+                                               // owned)
+
+    // PRIVATE MANIPULATORS
+
+    /// Claim the cell at the front of this queue.  Return the claimed cell
+    /// and load its position into the specified `position` on success, and
+    /// return 0 if this queue is empty.
+    Cell *claimPop(Uint64 *position);
+
+    /// Claim the cell at the back of this queue.  Return the claimed cell
+    /// and load its position into the specified `position` on success, and
+    /// return 0 if this queue is full.
+    Cell *claimPush(Uint64 *position);
+
+    /// Store the specified `sequence` in the specified `cell`, and wake a
+    /// thread waiting on the specified `waiter`, if appropriate.
+    void publish(RingBuffer_Waiter *waiter, Cell *cell, Uint64 sequence);
+
+    /// Pop an element into the specified `value` if one is available.
+    /// Return `e_SUCCESS` on success, and `e_EMPTY` otherwise.  Elements
+    /// that could not be constructed are skipped.
+    int tryPopImp(TYPE *value);
+
+    /// Push the specified `value`, moving it if the specified `move` is
+    /// `true`, if there is room.  Return `e_SUCCESS` on success, and
+    /// `e_FULL` otherwise.
+    int tryPushImp(TYPE *value, bool move);
+
+    /// Block, according to the wait strategy, until an element is pushed
+    /// or popping is disabled, using the specified `attempt` as the number
+    /// of failed attempts so far.
+    void waitNotEmpty(int attempt);
+
+    /// Block, according to the wait strategy, until an element is popped
+    /// or pushing is disabled, using the specified `attempt` as the number
+    /// of failed attempts so far.
+    void waitNotFull(int attempt);
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the cell at the front of this queue holds an
+    /// element, and `false` otherwise.
+    bool isPopReady() const;
+
+    /// Return `true` if the cell at the back of this queue is free, and
+    /// `false` otherwise.
+    bool isPushReady() const;
+
+  private:
+    // NOT IMPLEMENTED
+    RingBuffer(const RingBuffer&);
+    RingBuffer& operator=(const RingBuffer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingBuffer, bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,  // must be 0
+        e_EMPTY    = -1,
+        e_FULL     = -2,
+        e_DISABLED = -3
+    };
+
+    // CREATORS
+
+    /// Create a queue having at least the specified `capacity` that waits
+    /// using the `e_PARK` strategy.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.  The behavior is undefined
+    /// unless `0 < capacity`.
+    explicit
+    RingBuffer(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
+
+    /// Create a queue having at least the specified `capacity` that waits
+    /// using the specified `waitStrategy`.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < capacity`.
+    RingBuffer(bsl::size_t                   capacity,
+               RingBufferWaitStrategy::Enum  waitStrategy,
+               bslma::Allocator             *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~RingBuffer();
+
+    // MANIPULATORS
+
+    /// Remove the element from the front of this queue and load that
+    /// element into the specified `value`.  If the queue is empty, block
+    /// until it is not empty.  Return 0 on success, and a non-zero value
+    /// otherwise.  Specifically, return `e_SUCCESS` on success, and
+    /// `e_DISABLED` if `isPopFrontDisabled()`.  On failure, `value` is not
+    /// changed.  Threads blocked due to the queue being empty will return
+    /// `e_DISABLED` if `disablePopFront` is invoked.
+    int popFront(TYPE *value);
+
+    /// Append the specified `value` to the back of this queue.  If the
+    /// queue is full, block until it is not full.  Return 0 on success, and
+    /// a non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, and `e_DISABLED` if `isPushBackDisabled()`.  Threads
+    /// blocked due to the queue being full will return `e_DISABLED` if
+    /// `disablePushBack` is invoked.
+    int pushBack(const TYPE& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// queue.  If the queue is full, block until it is not full.  `value`
+    /// is left in a valid but unspecified state.  Return 0 on success, and
+    /// a non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, and `e_DISABLED` if `isPushBackDisabled()`.  On failure,
+    /// `value` is not changed.  Threads blocked due to the queue being full
+    /// will return `e_DISABLED` if `disablePushBack` is invoked.
+    int pushBack(bslmf::MovableRef<TYPE> value);
+
+    /// Remove all items currently in this queue.  Note that this operation
+    /// is not atomic; if other threads are concurrently pushing items into
+    /// the queue the result of `numElements()` after this function returns
+    /// is not guaranteed to be 0.
+    void removeAll();
+
+    /// Attempt to remove the element from the front of this queue without
+    /// blocking, and, if successful, load the specified `value` with the
+    /// removed element.  Return 0 on success, and a non-zero value
+    /// otherwise.  Specifically, return `e_SUCCESS` on success,
+    /// `e_DISABLED` if `isPopFrontDisabled()`, and `e_EMPTY` if
+    /// `!isPopFrontDisabled()` and the queue was empty.  On failure,
+    /// `value` is not changed.
+    int tryPopFront(TYPE *value);
+
+    /// Append the specified `value` to the back of this queue without
+    /// blocking.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_SUCCESS` on success, `e_DISABLED` if
+    /// `isPushBackDisabled()`, and `e_FULL` if `!isPushBackDisabled()` and
+    /// the queue was full.
+    int tryPushBack(const TYPE& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// queue without blocking.  `value` is left in a valid but unspecified
+    /// state.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_SUCCESS` on success, `e_DISABLED` if
+    /// `isPushBackDisabled()`, and `e_FULL` if `!isPushBackDisabled()` and
+    /// the queue was full.  On failure, `value` is not changed.
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+
+                       // Enqueue/Dequeue State
+
+    /// Disable dequeueing from this queue.  All subsequent invocations of
+    /// `popFront` or `tryPopFront` will fail immediately.  All blocked
+    /// invocations of `popFront` will fail immediately.  If the queue is
+    /// already dequeue disabled, this method has no effect.
+    void disablePopFront();
+
+    /// Disable enqueueing into this queue.  All subsequent invocations of
+    /// `pushBack` or `tryPushBack` will fail immediately.  All blocked
+    /// invocations of `pushBack` will fail immediately.  If the queue is
+    /// already enqueue disabled, this method has no effect.
+    void disablePushBack();
+
+    /// Enable dequeueing.  If the queue is not dequeue disabled, this call
+    /// has no effect.
+    void enablePopFront();
+
+    /// Enable queuing.  If the queue is not enqueue disabled, this call has
+    /// no effect.
+    void enablePushBack();
+
+    // ACCESSORS
+
+    /// Return the maximum number of elements that may be stored in this
+    /// queue.  Note that the value returned may be greater than that
+    /// supplied at construction.
+    bsl::size_t capacity() const;
+
+    /// Return `true` if this queue is empty (has no elements), or `false`
+    /// otherwise.
+    bool isEmpty() const;
+
+    /// Return `true` if this queue is full (has no available capacity), or
+    /// `false` otherwise.
+    bool isFull() const;
+
+    /// Return `true` if this queue is dequeue disabled, and `false`
+    /// otherwise.  Note that the queue is created in the "dequeue enabled"
+    /// state.
+    bool isPopFrontDisabled() const;
+
+    /// Return `true` if this queue is enqueue disabled, and `false`
+    /// otherwise.  Note that the queue is created in the "enqueue enabled"
+    /// state.
+    bool isPushBackDisabled() const;
+
+    /// Return the number of elements currently in this queue.
+    bsl::size_t numElements() const;
+
+    /// Return the wait strategy of this queue.
+    RingBufferWaitStrategy::Enum waitStrategy() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------
+                           // class RingBuffer
+                           // ----------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename RingBuffer<TYPE>::Cell *RingBuffer<TYPE>::claimPop(Uint64 *position)
+{
+    Uint64 pos = d_popPosition.loadRelaxed();
+
+    while (true) {
+        Cell         *cell = &d_cells_p[pos & d_mask];
+        const Int64   diff = static_cast<Int64>(
+                                cell->d_sequence.loadAcquire() - (pos + 1));
+
+        if (0 == diff) {
+            const Uint64 prev = d_popPosition.testAndSwapAcqRel(pos, pos + 1);
+            if (prev == pos) {
+                *position = pos;
+                return cell;                                          // RETURN
+            }
+            pos = prev;
+        }
+        else if (diff < 0) {
+            return 0;                                                 // RETURN
+        }
+        else {
+            pos = d_popPosition.loadRelaxed();
+        }
+    }
+}
+
+template <class TYPE>
+typename RingBuffer<TYPE>::Cell *RingBuffer<TYPE>::claimPush(
+                                                             Uint64 *position)
+{
+    Uint64 pos = d_pushPosition.loadRelaxed();
+
+    while (true) {
+        Cell         *cell = &d_cells_p[pos & d_mask];
+        const Int64   diff = static_cast<Int64>(
+                                      cell->d_sequence.loadAcquire() - pos);
+
+        if (0 == diff) {
+            const Uint64 prev = d_pushPosition.testAndSwapAcqRel(pos,
+                                                                 pos + 1);
+            if (prev == pos) {
+                *position = pos;
+                return cell;                                          // RETURN
+            }
+            pos = prev;
+        }
+        else if (diff < 0) {
+            return 0;                                                 // RETURN
+        }
+        else {
+            pos = d_pushPosition.loadRelaxed();
+        }
+    }
+}
+
+template <class TYPE>
+inline
+void RingBuffer<TYPE>::publish(RingBuffer_Waiter *waiter,
+                               Cell              *cell,
+                               Uint64             sequence)
+{
+    if (d_parking) {
+        // Sequential consistency orders this store before the load of the
+        // number of waiters in `wake` (see `RingBuffer_Waiter`).
+
+        cell->d_sequence.store(sequence);
+        waiter->wake();
+    }
+    else {
+        cell->d_sequence.storeRelease(sequence);
+    }
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::tryPopImp(TYPE *value)
+{
+    while (true) {
+        Uint64  position;
+        Cell   *cell = claimPop(&position);
+
+        if (!cell) {
+            return e_EMPTY;                                           // RETURN
+        }
+
+        PopGuard guard(this, cell, position);
+
+        if (cell->d_hasValue) {
+            *value = MoveUtil::move(cell->d_value.object());
+            return e_SUCCESS;                                         // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::tryPushImp(TYPE *value, bool move)
+{
+    Uint64  position;
+    Cell   *cell = claimPush(&position);
+
+    if (!cell) {
+        return e_FULL;                                                // RETURN
+    }
+
+    PushProctor proctor(this, cell, position);
+
+    if (move) {
+        bslma::ConstructionUtil::construct(cell->d_value.address(),
+                                           d_allocator_p,
+                                           MoveUtil::move(*value));
+    }
+    else {
+        bslma::ConstructionUtil::construct(
+                                          cell->d_value.address(),
+                                          d_allocator_p,
+                                          static_cast<const TYPE&>(*value));
+    }
+
+    proctor.release();
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void RingBuffer<TYPE>::waitNotEmpty(int attempt)
+{
+    if (d_notEmpty.backOff(attempt)) {
+        const int key = d_notEmpty.prepareWait();
+
+        if (isPopReady() || d_popFrontDisabled.load()) {
+            d_notEmpty.cancelWait();
+        }
+        else {
+            d_notEmpty.commitWait(key);
+        }
+    }
+}
+
+template <class TYPE>
+void RingBuffer<TYPE>::waitNotFull(int attempt)
+{
+    if (d_notFull.backOff(attempt)) {
+        const int key = d_notFull.prepareWait();
+
+        if (isPushReady() || d_pushBackDisabled.load()) {
+            d_notFull.cancelWait();
+        }
+        else {
+            d_notFull.commitWait(key);
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isPopReady() const
+{
+    const Uint64 pos      = d_popPosition.load();
+    const Uint64 sequence = d_cells_p[pos & d_mask].d_sequence.load();
+
+    return 0 <= static_cast<Int64>(sequence - (pos + 1));
+}
+
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isPushReady() const
+{
+    const Uint64 pos      = d_pushPosition.load();
+    const Uint64 sequence = d_cells_p[pos & d_mask].d_sequence.load();
+
+    return 0 <= static_cast<Int64>(sequence - pos);
+}
+
+// CREATORS
+template <class TYPE>
+RingBuffer<TYPE>::RingBuffer(bsl::size_t       capacity,
+                             bslma::Allocator *basicAllocator)
+: d_pushPosition(0)
+, d_popPosition(0)
+, d_notEmpty(RingBufferWaitStrategy::e_PARK)
+, d_notFull(RingBufferWaitStrategy::e_PARK)
+, d_cells_p(0)
+, d_capacity(bdlb::BitUtil::roundUpToBinaryPower(
+                             static_cast<Uint64>(capacity < 2 ? 2 : capacity)))
+, d_mask(d_capacity - 1)
+, d_parking(true)
+, d_waitStrategy(RingBufferWaitStrategy::e_PARK)
+, d_popFrontDisabled(false)
+, d_pushBackDisabled(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    d_cells_p = static_cast<Cell *>(d_allocator_p->allocate(
+                     static_cast<bsl::size_t>(d_capacity) * sizeof(Cell)));
+    for (Uint64 i = 0; i < d_capacity; ++i) {
+        new (&d_cells_p[i].d_sequence) bsls::AtomicUint64(i);
+        d_cells_p[i].d_hasValue = false;
+    }
+}
+
+template <class TYPE>
+RingBuffer<TYPE>::RingBuffer(bsl::size_t                   capacity,
+                             RingBufferWaitStrategy::Enum  waitStrategy,
+                             bslma::Allocator             *basicAllocator)
+: d_pushPosition(0)
+, d_popPosition(0)
+, d_notEmpty(waitStrategy)
+, d_notFull(waitStrategy)
+, d_cells_p(0)
+, d_capacity(bdlb::BitUtil::roundUpToBinaryPower(
+                             static_cast<Uint64>(capacity < 2 ? 2 : capacity)))
+, d_mask(d_capacity - 1)
+, d_parking(RingBufferWaitStrategy::e_PARK == waitStrategy)
+, d_waitStrategy(waitStrategy)
+, d_popFrontDisabled(false)
+, d_pushBackDisabled(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    d_cells_p = static_cast<Cell *>(d_allocator_p->allocate(
+                     static_cast<bsl::size_t>(d_capacity) * sizeof(Cell)));
+    for (Uint64 i = 0; i < d_capacity; ++i) {
+        new (&d_cells_p[i].d_sequence) bsls::AtomicUint64(i);
+        d_cells_p[i].d_hasValue = false;
+    }
+}
+
+template <class TYPE>
+RingBuffer<TYPE>::~RingBuffer()
+{
+    const Uint64 end = d_pushPosition.loadRelaxed();
+
+    for (Uint64 pos = d_popPosition.loadRelaxed(); pos != end; ++pos) {
+        Cell& cell = d_cells_p[pos & d_mask];
+        if (cell.d_hasValue) {
+            bslma::DestructionUtil::destroy(cell.d_value.address());
+        }
+    }
+
+    d_allocator_p->deallocate(d_cells_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int RingBuffer<TYPE>::popFront(TYPE *value)
+{
+    for (int attempt = 0; ; ++attempt) {
+        if (d_popFrontDisabled.loadRelaxed()) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (e_SUCCESS == tryPopImp(value)) {
+            return e_SUCCESS;                                         // RETURN
+        }
+        waitNotEmpty(attempt);
+    }
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::pushBack(const TYPE& value)
+{
+    for (int attempt = 0; ; ++attempt) {
+        if (d_pushBackDisabled.loadRelaxed()) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (e_SUCCESS == tryPushImp(const_cast<TYPE *>(&value), false)) {
+            return e_SUCCESS;                                         // RETURN
+        }
+        waitNotFull(attempt);
+    }
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
+{
+    TYPE& local = value;
+
+    for (int attempt = 0; ; ++attempt) {
+        if (d_pushBackDisabled.loadRelaxed()) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (e_SUCCESS == tryPushImp(&local, true)) {
+            return e_SUCCESS;                                         // RETURN
+        }
+        waitNotFull(attempt);
+    }
+}
+
+template <class TYPE>
+void RingBuffer<TYPE>::removeAll()
+{
+    Uint64 position;
+    Cell  *cell;
+
+    while (0 != (cell = claimPop(&position))) {
+        PopGuard guard(this, cell, position);
+    }
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::tryPopFront(TYPE *value)
+{
+    if (d_popFrontDisabled.loadRelaxed()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    return tryPopImp(value);
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::tryPushBack(const TYPE& value)
+{
+    if (d_pushBackDisabled.loadRelaxed()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    return tryPushImp(const_cast<TYPE *>(&value), false);
+}
+
+template <class TYPE>
+int RingBuffer<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
+{
+    if (d_pushBackDisabled.loadRelaxed()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    TYPE& local = value;
+    return tryPushImp(&local, true);
+}
+
+                       // Enqueue/Dequeue State
+
+template <class TYPE>
+void RingBuffer<TYPE>::disablePopFront()
+{
+    d_popFrontDisabled.store(true);
+    d_notEmpty.wakeAll();
+}
+
+template <class TYPE>
+void RingBuffer<TYPE>::disablePushBack()
+{
+    d_pushBackDisabled.store(true);
+    d_notFull.wakeAll();
+}
+
+template <class TYPE>
+inline
+void RingBuffer<TYPE>::enablePopFront()
+{
+    d_popFrontDisabled.store(false);
+}
+
+template <class TYPE>
+inline
+void RingBuffer<TYPE>::enablePushBack()
+{
+    d_pushBackDisabled.store(false);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t RingBuffer<TYPE>::capacity() const
+{
+    return static_cast<bsl::size_t>(d_capacity);
+}
+
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isFull() const
+{
+    return d_capacity <= numElements();
+}
+
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isPopFrontDisabled() const
+{
+    return d_popFrontDisabled.load();
+}
+
+template <class TYPE>
+inline
+bool RingBuffer<TYPE>::isPushBackDisabled() const
+{
+    return d_pushBackDisabled.load();
+}
+
+template <class TYPE>
+inline
+bsl::size_t RingBuffer<TYPE>::numElements() const
+{
+    // Load the pop position first, so that the difference cannot be
+    // negative.
+
+    const Uint64 popPosition  = d_popPosition.load();
+    const Uint64 pushPosition = d_pushPosition.load();
+
+    return static_cast<bsl::size_t>(pushPosition - popPosition);
+}
+
+template <class TYPE>
+inline
+RingBufferWaitStrategy::Enum RingBuffer<TYPE>::waitStrategy() const
+{
+    return d_waitStrategy;
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *RingBuffer<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1094 @@
+// bdlcc_ringbuffer.t.cpp                                             -*-C++-*-
+
+#include <bdlcc_ringbuffer.h>
+
+#include <bdlcc_boundedqueue.h>
+#include <bdlcc_fixedqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_buildtarget.h>
+#include <bsls_review.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a lock-free bounded queue,
+// `bdlcc::RingBuffer`, whose blocking operations wait according to a
+// `bdlcc::RingBufferWaitStrategy`.  The interface mirrors that of
+// `bdlcc::BoundedQueue`, so the manipulators and accessors are tested in the
+// same fashion.  The non-blocking operations are tested single-threaded,
+// including wrap-around of the positions and rounding of the capacity.  The
+// blocking operations and the disabling of the queue are tested with
+// multiple threads for each wait strategy, and the exception safety of
+// pushing and popping is tested with an element type whose copy constructor
+// and assignment may throw.
+//
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+//
+// CREATORS
+// [ 2] explicit RingBuffer(capacity, basicAllocator);
+// [ 2] RingBuffer(capacity, waitStrategy, basicAllocator);
+// [ 2] ~RingBuffer();
+//
+// MANIPULATORS
+// [ 5] int popFront(TYPE *value);
+// [ 5] int pushBack(const TYPE& value);
+// [ 5] int pushBack(bslmf::MovableRef<TYPE> value);
+// [ 2] void removeAll();
+// [ 2] int tryPopFront(TYPE *value);
+// [ 2] int tryPushBack(const TYPE& value);
+// [ 3] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [ 4] void disablePopFront();
+// [ 4] void disablePushBack();
+// [ 4] void enablePopFront();
+// [ 4] void enablePushBack();
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bool isFull() const;
+// [ 4] bool isPopFrontDisabled() const;
+// [ 4] bool isPushBackDisabled() const;
+// [ 2] bsl::size_t numElements() const;
+// [ 2] RingBufferWaitStrategy::Enum waitStrategy() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] EXCEPTION SAFETY
+// [ 7] CONCURRENT PRODUCERS AND CONSUMERS
+// [ 8] USAGE EXAMPLE
+// [-1] HOP LATENCY
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS AND TEST VARIABLES
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::RingBuffer<int>          Obj;
+typedef bdlcc::RingBufferWaitStrategy   Strategy;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+const Strategy::Enum STRATEGIES[] = { Strategy::e_SPIN,
+                                      Strategy::e_SPIN_THEN_YIELD,
+                                      Strategy::e_PARK };
+const int            NUM_STRATEGIES = 3;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return the name of the specified `strategy`.
+const char *strategyName(Strategy::Enum strategy)
+{
+    return Strategy::e_SPIN            == strategy ? "SPIN"
+         : Strategy::e_SPIN_THEN_YIELD == strategy ? "SPIN_THEN_YIELD"
+         :                                           "PARK";
+}
+
+/// This class provides an element type whose copy constructor throws if the
+/// source holds a negative value, and whose copy assignment throws if the
+/// source holds a value of at least 1000.
+class Thrower {
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit Thrower(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    Thrower(const Thrower& original)
+    : d_value(original.d_value)
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (d_value < 0) {
+            throw d_value;
+        }
+#endif
+    }
+
+    // MANIPULATORS
+    Thrower& operator=(const Thrower& rhs)
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (1000 <= rhs.d_value) {
+            throw rhs.d_value;
+        }
+#endif
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         CASE 7 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace RINGBUFFER_TEST_CASE_7 {
+
+/// Push the values `[first .. first + count)` into the specified `queue`.
+void producer(Obj *queue, int first, int count)
+{
+    for (int i = first; i < first + count; ++i) {
+        ASSERT(0 == queue->pushBack(i));
+    }
+}
+
+/// Pop values from the specified `queue` until popping is disabled, adding
+/// them to the specified `sum` and incrementing the specified `count`.
+void consumer(Obj *queue, bsls::AtomicInt64 *sum, bsls::AtomicInt *count)
+{
+    int value;
+    while (0 == queue->popFront(&value)) {
+        sum->addRelaxed(value);
+        count->addRelaxed(1);
+    }
+}
+
+}  // close namespace RINGBUFFER_TEST_CASE_7
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace RINGBUFFER_TEST_CASE_MINUS_1 {
+
+typedef bsls::Types::Int64 Int64;
+
+/// Pop the specified `count` timestamps from the specified `queue`,
+/// recording the time elapsed since each was pushed into the specified
+/// `samples`, and acknowledge each through the specified `acknowledged`.
+template <class QUEUE>
+void receiver(QUEUE             *queue,
+              int                count,
+              bsl::vector<Int64> *samples,
+              bsls::AtomicInt    *acknowledged)
+{
+    for (int i = 0; i < count; ++i) {
+        Int64 timestamp = 0;
+        queue->popFront(&timestamp);
+        (*samples)[i] = bsls::TimeUtil::getTimer() - timestamp;
+        acknowledged->storeRelease(i + 1);
+    }
+}
+
+/// Send the specified `count` timestamps through the specified `queue`,
+/// waiting for each to be received before sending the next, so that the
+/// latency measured is that of a hand-off to a waiting consumer rather than
+/// of queueing.  Print the median and tail latency, labelled with the
+/// specified `name`.
+template <class QUEUE>
+void measure(const char *name, QUEUE *queue, int count)
+{
+    bsl::vector<Int64> samples(count);
+    bsls::AtomicInt    acknowledged(0);
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::createWithAllocator(
+                       &handle,
+                       bdlf::BindUtil::bind(&receiver<QUEUE>,
+                                            queue,
+                                            count,
+                                            &samples,
+                                            &acknowledged),
+                       bslma::Default::globalAllocator());
+
+    for (int i = 0; i < count; ++i) {
+        queue->pushBack(bsls::TimeUtil::getTimer());
+        while (acknowledged.loadAcquire() <= i) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    bslmt::ThreadUtil::join(handle);
+
+    bsl::sort(samples.begin(), samples.end());
+
+    printf("%-30s p50: %8lld ns  p99: %8lld ns  p999: %8lld ns\n",
+           name,
+           samples[count / 2],
+           samples[count / 100 * 99],
+           samples[count / 1000 * 999]);
+}
+
+}  // close namespace RINGBUFFER_TEST_CASE_MINUS_1
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator  da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: A Latency-Sensitive Pipeline Stage
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market-data handler hands each decoded message from the
+// thread that reads the network to a thread that updates an order book, and
+// that the latency of the hand-off matters more than the CPU consumed by the
+// waiting thread.
+//
+// First, we define the message type:
+// ```
+    struct Message {
+        int    d_sequenceNumber;
+        double d_price;
+    };
+// ```
+// Then, we define the function run by the order-book thread, which pops
+// messages until the queue is disabled:
+// ```
+    struct Local {
+        static void updateBook(bdlcc::RingBuffer<Message> *queue,
+                               double                     *total)
+        {
+            Message message;
+            while (0 == queue->popFront(&message)) {
+                *total += message.d_price;
+            }
+        }
+    };
+// ```
+// Next, we create a queue that spins briefly and then yields while it is
+// empty or full, and start the order-book thread:
+// ```
+    bdlcc::RingBuffer<Message> queue(
+                             1024,
+                             bdlcc::RingBufferWaitStrategy::e_SPIN_THEN_YIELD);
+
+    double total = 0.0;
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::createWithAllocator(
+                          &handle,
+                          bdlf::BindUtil::bind(&Local::updateBook,
+                                               &queue,
+                                               &total),
+                          bslma::Default::globalAllocator());
+// ```
+// Then, the network thread pushes the decoded messages:
+// ```
+    for (int i = 0; i < 10000; ++i) {
+        Message message = { i, 0.5 };
+        queue.pushBack(message);
+    }
+// ```
+// Finally, we wait until the order-book thread has consumed every message,
+// disable popping to make it return, and join it:
+// ```
+    while (!queue.isEmpty()) {
+        bslmt::ThreadUtil::yield();
+    }
+    queue.disablePopFront();
+    bslmt::ThreadUtil::join(handle);
+
+    ASSERT(5000.0 == total);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PRODUCERS AND CONSUMERS
+        //
+        // Concerns:
+        // 1. With multiple producers and consumers, and for each wait
+        //    strategy, every pushed value is popped exactly once.
+        //
+        // 2. Blocked producers and consumers make progress when the queue is
+        //    full and empty, respectively.
+        //
+        // Plan:
+        // 1. For each wait strategy, using a small queue, start 4 producers
+        //    pushing disjoint ranges of values and 4 consumers summing the
+        //    values they pop.  Join the producers, wait until the queue is
+        //    empty, disable popping, and join the consumers.  Verify the
+        //    number and sum of the values popped.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PRODUCERS AND CONSUMERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT PRODUCERS AND CONSUMERS" << endl
+                          << "==================================" << endl;
+
+        using namespace RINGBUFFER_TEST_CASE_7;
+
+        const int k_NUM_THREADS = 4;
+        const int k_PER_THREAD  = 20000;
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const Strategy::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P(strategyName(STRATEGY)); }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(8, STRATEGY, &ta);  const Obj& X = mX;
+
+                bsls::AtomicInt64 sum(0);
+                bsls::AtomicInt   count(0);
+
+                bslmt::ThreadGroup consumers;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    consumers.addThread(bdlf::BindUtil::bind(&consumer,
+                                                             &mX,
+                                                             &sum,
+                                                             &count));
+                }
+
+                bslmt::ThreadGroup producers;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(
+                                                         &producer,
+                                                         &mX,
+                                                         i * k_PER_THREAD,
+                                                         k_PER_THREAD));
+                }
+                producers.joinAll();
+
+                while (!X.isEmpty()) {
+                    bslmt::ThreadUtil::yield();
+                }
+                mX.disablePopFront();
+                consumers.joinAll();
+
+                const bsls::Types::Int64 N = k_NUM_THREADS * k_PER_THREAD;
+
+                ASSERTV(strategyName(STRATEGY), count, N == count);
+                ASSERTV(strategyName(STRATEGY),
+                        sum,
+                        N * (N - 1) / 2 == sum);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        // 1. If the construction of an element throws, the exception
+        //    propagates, the element is not popped, and the queue remains
+        //    usable.
+        //
+        // 2. If the assignment of a popped element throws, the exception
+        //    propagates, the element is removed from the queue, and the
+        //    queue remains usable.
+        //
+        // Plan:
+        // 1. Push values of a type whose copy constructor and copy
+        //    assignment throw for distinguished values, interleaving values
+        //    that throw, and verify the values popped.  (C-1..2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            bdlcc::RingBuffer<Thrower> mX(4, &ta);
+
+            ASSERT(0 == mX.tryPushBack(Thrower(1)));
+
+            bool caught = false;
+            try {
+                mX.tryPushBack(Thrower(-1));
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            ASSERT(0 == mX.pushBack(Thrower(2)));
+
+            Thrower value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value.value());
+            ASSERT(0 == mX.popFront(&value));
+            ASSERT(2 == value.value());
+            ASSERT(mX.isEmpty());
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(&value));
+
+            // Popped elements are removed even if assignment throws.
+
+            ASSERT(0 == mX.tryPushBack(Thrower(1003)));
+            ASSERT(0 == mX.tryPushBack(Thrower(4)));
+
+            caught = false;
+            try {
+                mX.tryPopFront(&value);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == value.value());
+
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(4 == value.value());
+            ASSERT(mX.isEmpty());
+
+            // Wrap around the cells once more.
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.tryPushBack(Thrower(i)));
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(i == value.value());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#else
+        if (verbose) cout << "Exceptions are disabled." << endl;
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BLOCKING OPERATIONS
+        //
+        // Concerns:
+        // 1. For each wait strategy, `popFront` blocks until an element is
+        //    pushed, and `pushBack` blocks until an element is popped.
+        //
+        // 2. Both overloads of `pushBack` push the supplied value.
+        //
+        // Plan:
+        // 1. For each wait strategy, start a thread that pops 100 values
+        //    from an empty queue of capacity 2, while the main thread pushes
+        //    them, alternating the overloads of `pushBack`.  Verify the
+        //    values popped.  (C-1..2)
+        //
+        // Testing:
+        //   int popFront(TYPE *value);
+        //   int pushBack(const TYPE& value);
+        //   int pushBack(bslmf::MovableRef<TYPE> value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCKING OPERATIONS" << endl
+                          << "===================" << endl;
+
+        struct Local {
+            static void pop(Obj *queue, bsl::vector<int> *values)
+            {
+                for (int i = 0; i < 100; ++i) {
+                    int value = -1;
+                    ASSERT(0 == queue->popFront(&value));
+                    values->push_back(value);
+                }
+            }
+        };
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const Strategy::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P(strategyName(STRATEGY)); }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj              mX(2, STRATEGY, &ta);
+                bsl::vector<int> values(&ta);
+
+                values.reserve(100);
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::createWithAllocator(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&Local::pop,
+                                                        &mX,
+                                                        &values),
+                                   bslma::Default::globalAllocator());
+
+                for (int i = 0; i < 100; ++i) {
+                    int value = i;
+                    if (i % 2) {
+                        ASSERT(0 == mX.pushBack(value));
+                    }
+                    else {
+                        ASSERT(0 == mX.pushBack(
+                                       bslmf::MovableRefUtil::move(value)));
+                    }
+                }
+
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERT(100 == values.size());
+                for (int i = 0; i < 100; ++i) {
+                    ASSERTV(strategyName(STRATEGY), i, values[i],
+                            i == values[i]);
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DISABLE AND ENABLE
+        //
+        // Concerns:
+        // 1. Pushing and popping fail with `e_DISABLED` while disabled, and
+        //    succeed again once re-enabled.
+        //
+        // 2. For each wait strategy, threads blocked in `popFront` and
+        //    `pushBack` return `e_DISABLED` when popping and pushing,
+        //    respectively, are disabled.
+        //
+        // Plan:
+        // 1. Disable and enable a queue, verifying the accessors and the
+        //    results of the try operations.  (C-1)
+        //
+        // 2. For each wait strategy, block a thread popping from an empty
+        //    queue and a thread pushing into a full queue, disable the
+        //    queues, and verify the results of the blocked operations.
+        //    (C-2)
+        //
+        // Testing:
+        //   void disablePopFront();
+        //   void disablePushBack();
+        //   void enablePopFront();
+        //   void enablePushBack();
+        //   bool isPopFrontDisabled() const;
+        //   bool isPushBackDisabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DISABLE AND ENABLE" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the try operations." << endl;
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isPopFrontDisabled());
+            ASSERT(false == X.isPushBackDisabled());
+
+            mX.disablePushBack();
+            ASSERT(true  == X.isPushBackDisabled());
+            ASSERT(Obj::e_DISABLED == mX.tryPushBack(1));
+            ASSERT(Obj::e_DISABLED == mX.pushBack(1));
+            ASSERT(X.isEmpty());
+
+            mX.enablePushBack();
+            ASSERT(false == X.isPushBackDisabled());
+            ASSERT(0 == mX.tryPushBack(1));
+
+            int value = 0;
+
+            mX.disablePopFront();
+            ASSERT(true  == X.isPopFrontDisabled());
+            ASSERT(Obj::e_DISABLED == mX.tryPopFront(&value));
+            ASSERT(Obj::e_DISABLED == mX.popFront(&value));
+            ASSERT(0 == value);
+            ASSERT(1 == X.numElements());
+
+            mX.enablePopFront();
+            ASSERT(false == X.isPopFrontDisabled());
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value);
+        }
+
+        if (verbose) cout << "\nTesting blocked operations." << endl;
+
+        struct Local {
+            static void pop(Obj *queue, int *result)
+            {
+                int value;
+                *result = queue->popFront(&value);
+            }
+
+            static void push(Obj *queue, int *result)
+            {
+                *result = queue->pushBack(0);
+            }
+        };
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const Strategy::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P(strategyName(STRATEGY)); }
+
+            Obj mE(2, STRATEGY, &ta);
+            Obj mF(2, STRATEGY, &ta);
+
+            ASSERT(0 == mF.tryPushBack(0));
+            ASSERT(0 == mF.tryPushBack(0));
+
+            int popResult  = 0;
+            int pushResult = 0;
+
+            bslmt::ThreadUtil::Handle popHandle;
+            bslmt::ThreadUtil::Handle pushHandle;
+
+            bslmt::ThreadUtil::createWithAllocator(
+                                   &popHandle,
+                                   bdlf::BindUtil::bind(&Local::pop,
+                                                        &mE,
+                                                        &popResult),
+                                   bslma::Default::globalAllocator());
+            bslmt::ThreadUtil::createWithAllocator(
+                                   &pushHandle,
+                                   bdlf::BindUtil::bind(&Local::push,
+                                                        &mF,
+                                                        &pushResult),
+                                   bslma::Default::globalAllocator());
+
+            // Give the threads time to block, and to park if the strategy
+            // so provides.
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            mE.disablePopFront();
+            mF.disablePushBack();
+
+            bslmt::ThreadUtil::join(popHandle);
+            bslmt::ThreadUtil::join(pushHandle);
+
+            ASSERTV(strategyName(STRATEGY), popResult,
+                    Obj::e_DISABLED == popResult);
+            ASSERTV(strategyName(STRATEGY), pushResult,
+                    Obj::e_DISABLED == pushResult);
+            ASSERT(2 == mF.numElements());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MOVE AND ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        // 1. Pushing by move leaves the source in a valid state and the
+        //    element holds the moved value.
+        //
+        // 2. Elements use the allocator of the queue.
+        //
+        // 3. Elements remaining at destruction, or removed by `removeAll`,
+        //    are destroyed.
+        //
+        // Plan:
+        // 1. Push strings that do not fit in the short-string buffer by copy
+        //    and by move, and verify the values popped and the memory used.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   int tryPushBack(bslmf::MovableRef<TYPE> value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MOVE AND ALLOCATOR PROPAGATION" << endl
+                          << "==============================" << endl;
+
+        typedef bdlcc::RingBuffer<bsl::string> StrObj;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<StrObj>::value);
+
+        const char *LONG = "a string too long for the short-string buffer";
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+        {
+            StrObj mX(4, &ta);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            bsl::string value(LONG, &sa);
+
+            ASSERT(0 == mX.tryPushBack(value));
+            ASSERT(LONG == value);
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+
+            ASSERT(0 == mX.tryPushBack(bslmf::MovableRefUtil::move(value)));
+            ASSERT(NUM_BLOCKS + 2 == ta.numBlocksInUse());
+
+            bsl::string result(&sa);
+            ASSERT(0 == mX.tryPopFront(&result));
+            ASSERT(LONG == result);
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+            ASSERT(result.get_allocator().mechanism() == &sa);
+
+            ASSERT(0 == mX.tryPushBack(result));
+            ASSERT(0 == mX.tryPushBack(result));
+            ASSERT(NUM_BLOCKS + 3 == ta.numBlocksInUse());
+
+            mX.removeAll();
+            ASSERT(mX.isEmpty());
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            ASSERT(0 == mX.tryPushBack(result));
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TRY OPERATIONS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The capacity is the supplied capacity rounded up to a power of
+        //    2, and is at least 2.
+        //
+        // 2. `tryPushBack` fails with `e_FULL` once the queue is full, and
+        //    `tryPopFront` fails with `e_EMPTY` once it is empty, without
+        //    changing the supplied value.
+        //
+        // 3. Values are popped in the order in which they were pushed,
+        //    including after the positions wrap around the cells.
+        //
+        // 4. The accessors reflect the state of the queue.
+        //
+        // 5. The wait strategy defaults to `e_PARK`.
+        //
+        // 6. The supplied allocator, or the default allocator, is used.
+        //
+        // Plan:
+        // 1. For a set of capacities, create a queue, fill it, empty it, and
+        //    repeat several times, verifying the results and the accessors
+        //    at each step.  (C-1..6)
+        //
+        // Testing:
+        //   explicit RingBuffer(capacity, basicAllocator);
+        //   RingBuffer(capacity, waitStrategy, basicAllocator);
+        //   ~RingBuffer();
+        //   void removeAll();
+        //   int tryPopFront(TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   bsl::size_t capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   bsl::size_t numElements() const;
+        //   RingBufferWaitStrategy::Enum waitStrategy() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TRY OPERATIONS AND BASIC ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_capacity;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            //LINE  CAPACITY  EXPECTED
+            //----  --------  --------
+            { L_,          1,        2 },
+            { L_,          2,        2 },
+            { L_,          3,        4 },
+            { L_,          5,        8 },
+            { L_,         16,       16 },
+            { L_,         17,       32 },
+            { L_,       1000,     1024 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+            const bsl::size_t EXPECTED = DATA[ti].d_expected;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, Strategy::e_PARK == X.waitStrategy());
+                ASSERTV(LINE, &ta == X.allocator());
+                ASSERTV(LINE, 1 == ta.numBlocksInUse());
+
+                int next = 0;
+                for (int round = 0; round < 3; ++round) {
+                    ASSERTV(LINE, X.isEmpty());
+
+                    for (bsl::size_t i = 0; i < EXPECTED; ++i) {
+                        ASSERTV(LINE, i == X.numElements());
+                        ASSERTV(LINE, !X.isFull());
+                        ASSERTV(LINE, 0 == mX.tryPushBack(next + i));
+                        ASSERTV(LINE, !X.isEmpty());
+                    }
+                    ASSERTV(LINE, X.isFull());
+                    ASSERTV(LINE, Obj::e_FULL == mX.tryPushBack(-1));
+                    ASSERTV(LINE, EXPECTED == X.numElements());
+
+                    for (int i = 0; i < static_cast<int>(EXPECTED); ++i) {
+                        int value = -1;
+                        ASSERTV(LINE, 0 == mX.tryPopFront(&value));
+                        ASSERTV(LINE, value, next + i == value);
+                    }
+                    int value = -1;
+                    ASSERTV(LINE, Obj::e_EMPTY == mX.tryPopFront(&value));
+                    ASSERTV(LINE, -1 == value);
+
+                    next += static_cast<int>(EXPECTED);
+                }
+
+                ASSERTV(LINE, 0 == mX.tryPushBack(7));
+                mX.removeAll();
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, 0 == mX.tryPushBack(8));
+                int value = -1;
+                ASSERTV(LINE, 0 == mX.tryPopFront(&value));
+                ASSERTV(LINE, 8 == value);
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting the wait strategy." << endl;
+        {
+            for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+                const Strategy::Enum STRATEGY = STRATEGIES[ti];
+
+                bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+                Obj mX(4, STRATEGY, &ta);  const Obj& X = mX;
+
+                ASSERT(STRATEGY == X.waitStrategy());
+                ASSERT(&ta      == X.allocator());
+                ASSERT(4        == X.capacity());
+            }
+        }
+
+        if (verbose) cout << "\nTesting the default allocator." << endl;
+        {
+            Obj mX(4);  const Obj& X = mX;
+
+            ASSERT(&da == X.allocator());
+            ASSERT(1   == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a queue, push and pop a few values, and verify the
+        //    results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isEmpty());
+
+            ASSERT(0 == mX.pushBack(1));
+            ASSERT(0 == mX.tryPushBack(2));
+            ASSERT(2 == X.numElements());
+
+            int value = 0;
+            ASSERT(0 == mX.popFront(&value));
+            ASSERT(1 == value);
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(2 == value);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(&value));
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // HOP LATENCY
+        //
+        // Concerns:
+        // 1. The latency of handing an element to a waiting consumer is
+        //    lower for `bdlcc::RingBuffer` than for `bdlcc::FixedQueue` and
+        //    `bdlcc::BoundedQueue`, for the spinning wait strategies.
+        //
+        // Plan:
+        // 1. For each queue, and each wait strategy of `bdlcc::RingBuffer`,
+        //    send the specified number of timestamps (default 100000), one
+        //    at a time, from one thread to another, and report the median,
+        //    99th, and 99.9th percentiles of the time between push and pop.
+        //    Note that the spinning strategies are meaningful only if the
+        //    two threads run on distinct CPUs.  (C-1)
+        //
+        // Testing:
+        //   HOP LATENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HOP LATENCY" << endl
+                          << "===========" << endl;
+
+        using namespace RINGBUFFER_TEST_CASE_MINUS_1;
+
+        const int k_COUNT = argc > 2 ? atoi(argv[2]) : 100000;
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const Strategy::Enum STRATEGY = STRATEGIES[ti];
+
+            bdlcc::RingBuffer<Int64> queue(1024, STRATEGY);
+
+            bsl::string name("RingBuffer/");
+            name += strategyName(STRATEGY);
+            measure(name.c_str(), &queue, k_COUNT);
+        }
+        {
+            bdlcc::FixedQueue<Int64> queue(1024);
+            measure("FixedQueue", &queue, k_COUNT);
+        }
+        {
+            bdlcc::BoundedQueue<Int64> queue(1024);
+            measure("BoundedQueue", &queue, k_COUNT);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,324 @@
+// bdlcc_shardedcache.cpp                                             -*-C++-*-
+#include <bdlcc_shardedcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedcache_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metricdescriptor.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsl_algorithm.h>
+
+namespace {
+
+void hitRatioMetric(BloombergLP::bdlm::Metric                   *value,
+                    BloombergLP::bdlcc::ShardedCache_Statistics *object)
+{
+    object->collectHitRatio(value);
+}
+
+void lookupLatencyMetric(
+                       BloombergLP::bdlm::Metric                   *value,
+                       BloombergLP::bdlcc::ShardedCache_Statistics *object)
+{
+    object->collectLookupLatency(value);
+}
+
+/// Return a 64-bit hash derived from the specified `hash` and the specified
+/// `seed`, such that the results for different seeds are independent.  Note
+/// that this is the finalizer of the "SplitMix64" generator.
+inline
+BloombergLP::bsls::Types::Uint64 mix(BloombergLP::bsls::Types::Uint64 hash,
+                                     BloombergLP::bsls::Types::Uint64 seed)
+{
+    BloombergLP::bsls::Types::Uint64 z = hash + seed * 0x9E3779B97F4A7C15ULL;
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlcc {
+
+// Implementation note: Each of the `k_NUM_HASHES` counters of an item is
+// selected by a distinct mix of the hash of its key: the low-order bits of
+// the mix select the word, and the four high-order bits select the 4-bit
+// counter within the word.  The estimated frequency is the minimum of the
+// counters, as usual for a count-min sketch.
+
+static const int                 k_NUM_HASHES   = 4;
+static const bsls::Types::Uint64 k_HALVING_MASK = 0x7777777777777777ULL;
+
+                    // ----------------------------------
+                    // class ShardedCache_FrequencySketch
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+void ShardedCache_FrequencySketch::halve()
+{
+    for (bsl::size_t i = 0; i < d_numWords; ++i) {
+        bsls::Types::Uint64 word = d_table_p[i].loadRelaxed();
+        bsls::Types::Uint64 prev;
+
+        while (word != (prev = d_table_p[i].testAndSwap(
+                                        word,
+                                        (word >> 1) & k_HALVING_MASK))) {
+            word = prev;
+        }
+    }
+}
+
+// CREATORS
+ShardedCache_FrequencySketch::ShardedCache_FrequencySketch(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_table_p(0)
+, d_numWords(0)
+, d_sampleSize(0)
+, d_numIncrements(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    const bsl::size_t k_MIN_WORDS = 16;
+    const bsl::size_t k_MAX_WORDS = 1 << 24;
+
+    const bsl::size_t numItems = bsl::min(bsl::max(capacity, k_MIN_WORDS),
+                                          k_MAX_WORDS);
+
+    d_numWords   = static_cast<bsl::size_t>(
+                         bdlb::BitUtil::roundUpToBinaryPower(
+                                 static_cast<bsls::Types::Uint64>(numItems)));
+    d_sampleSize = 10 * static_cast<bsls::Types::Int64>(d_numWords);
+
+    d_table_p = reinterpret_cast<bsls::AtomicUint64 *>(
+                 d_allocator_p->allocate(d_numWords * sizeof *d_table_p));
+    for (bsl::size_t i = 0; i < d_numWords; ++i) {
+        new (&d_table_p[i]) bsls::AtomicUint64(0);
+    }
+}
+
+ShardedCache_FrequencySketch::~ShardedCache_FrequencySketch()
+{
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void ShardedCache_FrequencySketch::increment(bsl::size_t hash)
+{
+    for (int i = 0; i < k_NUM_HASHES; ++i) {
+        const bsls::Types::Uint64 h     = mix(hash, i + 1);
+        bsls::AtomicUint64&       word  = d_table_p[h & (d_numWords - 1)];
+        const int                 shift = static_cast<int>(h >> 60) * 4;
+
+        bsls::Types::Uint64 value = word.loadRelaxed();
+        while (((value >> shift) & 0xF) != 0xF) {
+            const bsls::Types::Uint64 prev = word.testAndSwap(
+                                   value,
+                                   value + (static_cast<bsls::Types::Uint64>(1)
+                                                                    << shift));
+            if (prev == value) {
+                break;
+            }
+            value = prev;
+        }
+    }
+
+    if (d_numIncrements.addRelaxed(1) == d_sampleSize) {
+        halve();
+        d_numIncrements.addRelaxed(-d_sampleSize / 2);
+    }
+}
+
+// ACCESSORS
+int ShardedCache_FrequencySketch::frequency(bsl::size_t hash) const
+{
+    int result = 0xF;
+
+    for (int i = 0; i < k_NUM_HASHES; ++i) {
+        const bsls::Types::Uint64 h     = mix(hash, i + 1);
+        const int                 shift = static_cast<int>(h >> 60) * 4;
+        const bsls::Types::Uint64 word  =
+                                d_table_p[h & (d_numWords - 1)].loadRelaxed();
+
+        result = bsl::min(result, static_cast<int>((word >> shift) & 0xF));
+    }
+
+    return result;
+}
+
+                       // -----------------------------
+                       // class ShardedCache_Statistics
+                       // -----------------------------
+
+// CREATORS
+ShardedCache_Statistics::ShardedCache_Statistics(
+                                      bsl::size_t              numShards,
+                                      const bsl::string_view&  cacheName,
+                                      bdlm::MetricsRegistry   *metricsRegistry,
+                                      bslma::Allocator        *basicAllocator)
+: d_counters_p(0)
+, d_numShards(numShards)
+, d_lastLookups(0)
+, d_lastHits(0)
+, d_lastSamples(0)
+, d_lastNanoseconds(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_counters_p = reinterpret_cast<Counters *>(
+                   d_allocator_p->allocate(d_numShards * sizeof(Counters)));
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (&d_counters_p[i]) Counters();
+    }
+
+    bdlm::MetricsRegistry *registry = metricsRegistry
+                                   ? metricsRegistry
+                                   : &bdlm::MetricsRegistry::defaultInstance();
+
+    bdlm::InstanceCount::Value instanceNumber =
+            bdlm::InstanceCount::nextInstanceNumber<ShardedCache_Statistics>();
+
+    bdlm::MetricDescriptor hitRatio(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.cache.hitratio",
+             instanceNumber,
+             "bdlcc.shardedcache",
+             "sc",
+             cacheName);
+
+    registry->registerCollectionCallback(
+                                   &d_hitRatioHandle,
+                                   hitRatio,
+                                   bdlf::BindUtil::bind(&hitRatioMetric,
+                                                        bdlf::PlaceHolders::_1,
+                                                        this));
+
+    bdlm::MetricDescriptor lookupLatency(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.cache.lookuplatency",
+             instanceNumber,
+             "bdlcc.shardedcache",
+             "sc",
+             cacheName);
+
+    registry->registerCollectionCallback(
+                                   &d_latencyHandle,
+                                   lookupLatency,
+                                   bdlf::BindUtil::bind(&lookupLatencyMetric,
+                                                        bdlf::PlaceHolders::_1,
+                                                        this));
+}
+
+ShardedCache_Statistics::~ShardedCache_Statistics()
+{
+    d_hitRatioHandle.unregister();
+    d_latencyHandle.unregister();
+
+    d_allocator_p->deallocate(d_counters_p);
+}
+
+// MANIPULATORS
+void ShardedCache_Statistics::collectHitRatio(bdlm::Metric *value)
+{
+    bsls::Types::Uint64 lookups = 0;
+    bsls::Types::Uint64 hits    = 0;
+
+    // Load the hits first, so that, despite concurrent lookups, the number
+    // of hits cannot exceed the number of lookups.
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        hits += d_counters_p[i].d_numHits.load();
+    }
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        lookups += d_counters_p[i].d_numLookups.load();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_collectionMutex);
+
+    const bsls::Types::Uint64 numLookups = lookups - d_lastLookups;
+    const bsls::Types::Uint64 numHits    = hits    - d_lastHits;
+
+    d_lastLookups = lookups;
+    d_lastHits    = hits;
+
+    *value = bdlm::Metric::Gauge(
+                    0 == numLookups
+                    ? 0.0
+                    : static_cast<double>(numHits)
+                                            / static_cast<double>(numLookups));
+}
+
+void ShardedCache_Statistics::collectLookupLatency(bdlm::Metric *value)
+{
+    bsls::Types::Uint64 samples     = 0;
+    bsls::Types::Uint64 nanoseconds = 0;
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        nanoseconds += d_counters_p[i].d_sampledNanoseconds.load();
+    }
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        samples += d_counters_p[i].d_numSamples.load();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_collectionMutex);
+
+    const bsls::Types::Uint64 numSamples = samples     - d_lastSamples;
+    const bsls::Types::Uint64 numNanos   = nanoseconds - d_lastNanoseconds;
+
+    d_lastSamples     = samples;
+    d_lastNanoseconds = nanoseconds;
+
+    *value = bdlm::Metric::Gauge(
+                   0 == numSamples
+                   ? 0.0
+                   : static_cast<double>(numNanos)
+                                    / static_cast<double>(numSamples) / 1.0e9);
+}
+
+// ACCESSORS
+bsls::Types::Uint64 ShardedCache_Statistics::numHits() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        result += d_counters_p[i].d_numHits.loadRelaxed();
+    }
+
+    return result;
+}
+
+bsls::Types::Uint64 ShardedCache_Statistics::numLookups() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        result += d_counters_p[i].d_numLookups.loadRelaxed();
+    }
+
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
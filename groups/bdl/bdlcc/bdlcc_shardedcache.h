@@ -0,0 +1,1956 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded in-process cache with scan-resistant eviction.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache with per-shard locking
+//
+//@SEE_ALSO: bdlcc_cache
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlcc::ShardedCache`, implementing a thread-safe in-memory key-value cache
+// intended for workloads in which many threads look up values concurrently.
+// The interface of `bdlcc::ShardedCache` closely follows that of
+// `bdlcc::Cache`, and the two can usually be substituted for one another.
+//
+// `bdlcc::Cache` protects all of its items with a single reader-writer lock,
+// and, under the LRU policy, moves an item to the back of its eviction queue
+// on every successful lookup, so that `tryGetValue` acquires the lock for
+// writing.  `bdlcc::ShardedCache` instead partitions its items, by the hash of
+// their keys, among a number of independent *shards*, each having its own
+// lock, and tracks recency with a per-item "referenced" flag that a lookup
+// merely sets.  The eviction queues are reordered only when an item must be
+// evicted, which is done while a write lock is held anyway, so `tryGetValue`
+// acquires the lock of a single shard for reading under every eviction
+// policy.
+//
+///Eviction Policies
+///-----------------
+// All four values of `bdlcc::CacheEvictionPolicy` are supported:
+//
+// * `e_FIFO`: Items are evicted in the order in which they were inserted.
+//
+// * `e_LRU`: Recency is approximated by the CLOCK ("second chance") algorithm:
+//   the item at the front of the eviction queue is evicted unless it was
+//   looked up since it was last examined, in which case it is moved to the
+//   back of the queue instead.
+//
+// * `e_SLRU`: Segmented LRU: new items enter a *probationary* segment, and an
+//   item looked up while on probation is promoted to a *protected* segment
+//   (holding up to 80% of the capacity of the shard) when it reaches the front
+//   of the probationary segment.  Items demoted from the protected segment
+//   re-enter the probationary segment, and victims are always taken from the
+//   probationary segment, so a scan of many items that are used once cannot
+//   flush the frequently used items out of the cache.
+//
+// * `e_TINYLFU`: W-TinyLFU: new items enter a small *admission window* (1% of
+//   the capacity of the shard).  An item leaving the window is admitted to an
+//   SLRU main area only if its estimated access frequency is higher than that
+//   of the item the main area would evict; otherwise the item leaving the
+//   window is evicted.  Access frequencies are estimated by a compact
+//   count-min sketch of 4-bit counters, which are halved periodically so that
+//   the estimates favor recent history.
+//
+// The low and high watermarks supplied at construction apply to the cache as
+// a whole and are divided evenly among the shards: eviction in a shard
+// starts when the size of the shard reaches
+// `ceil(highWatermark / numShards())` and continues until it is below
+// `ceil(lowWatermark / numShards())`.  Consequently, the total number of
+// items may slightly exceed `highWatermark`, and items may be evicted from a
+// shard that receives more than its share of the keys before the size of the
+// cache reaches `highWatermark`.  Note that, unlike `bdlcc::Cache`, the
+// eviction order is maintained per shard, so `popFront` evicts the item at
+// the front of the eviction order of *some* non-empty shard.
+//
+///Metrics
+///-------
+// At construction, a `bdlcc::ShardedCache` registers two metrics with the
+// supplied `bdlm::MetricsRegistry` (or with the default registry if none is
+// supplied), which are unregistered on destruction:
+//
+// * "bde.cache.hitratio": The fraction of the lookups performed by
+//   `tryGetValue` since the previous collection that found the requested key,
+//   or 0 if there were no lookups.
+//
+// * "bde.cache.lookuplatency": The mean duration, in seconds, of a sample (one
+//   in 64) of the lookups performed by `tryGetValue` since the previous
+//   collection, including the time spent waiting for the lock of the shard, or
+//   0 if no lookup was sampled.
+//
+// The totals from which these metrics are computed are also available
+// through the `numLookups` and `numHits` accessors.
+//
+///Thread Safety
+///-------------
+// The `bdlcc::ShardedCache` class template is fully thread-safe (see
+// `bsldoc_glossary`) provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.  The thread-safety of the container does not extend to
+// thread-safety of the contained objects.
+//
+// Operations on a single key lock only the shard owning the key.  `clear`,
+// `size`, and `visit` lock each shard in turn, so they do not observe a
+// consistent snapshot of the whole cache when it is being modified
+// concurrently.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// As with `bdlcc::Cache`, the post-eviction callback is invoked within the
+// calling thread while the write lock of the shard owning the evicted item is
+// held.  The cache object itself must not be used in a post-eviction
+// callback; otherwise, a deadlock may result.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Scan-Resistant Quote Cache
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches quotes keyed by ticker symbol, and that a
+// small set of popular symbols is looked up far more often than the rest.
+// Occasionally, a batch job loads quotes for many other symbols, each of
+// which is used once; with a plain LRU cache, such a scan would evict the
+// popular symbols.
+//
+// First, we create a cache of up to 4 items using the TinyLFU policy, with a
+// single shard so that the example is deterministic:
+// ```
+// bdlcc::ShardedCache<bsl::string, double> cache(
+//                                      bdlcc::CacheEvictionPolicy::e_TINYLFU,
+//                                      4,
+//                                      4,
+//                                      1,
+//                                      bsl::hash<bsl::string>(),
+//                                      bsl::equal_to<bsl::string>(),
+//                                      "quotes",
+//                                      0,
+//                                      &talloc);
+// ```
+// Then, we insert a popular symbol and look it up repeatedly:
+// ```
+// const bsl::string ibm("IBM", &talloc);
+//
+// cache.insert(ibm, 140.5);
+//
+// bsl::shared_ptr<double> value;
+// for (int i = 0; i < 10; ++i) {
+//     assert(0 == cache.tryGetValue(&value, ibm));
+// }
+// ```
+// Next, the batch job inserts quotes for 100 other symbols:
+// ```
+// for (int i = 0; i < 100; ++i) {
+//     char buffer[16];
+//     snprintf(buffer, sizeof buffer, "SYM%d", i);
+//
+//     cache.insert(bsl::string(buffer, &talloc), i);
+// }
+// assert(4 == cache.size());
+// ```
+// Finally, we observe that the popular symbol survived the scan, and that
+// the cache kept count of the lookups:
+// ```
+// assert(0 == cache.tryGetValue(&value, ibm));
+// assert(140.5 == *value);
+//
+// assert(11 == cache.numLookups());
+// assert(11 == cache.numHits());
+// ```
+
+#include <bdlcc_cache.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
+#include <bdlm_metricsregistry.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_string_view.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                    // ==================================
+                    // class ShardedCache_FrequencySketch
+                    // ==================================
+
+/// This component-private class implements a count-min sketch of 4-bit
+/// counters estimating the access frequency of hash values, used by the
+/// `e_TINYLFU` eviction policy of `ShardedCache`.  All operations are
+/// lock-free and may be invoked concurrently.  The counters are halved each
+/// time the number of increments reaches ten times the number of 64-bit
+/// words in the sketch, so that the estimates favor recent history.
+class ShardedCache_FrequencySketch {
+
+    // DATA
+    bsls::AtomicUint64 *d_table_p;        // words of 16 4-bit counters
+
+    bsl::size_t         d_numWords;       // number of words (power of 2)
+
+    bsls::Types::Int64  d_sampleSize;     // number of increments between
+                                          // halvings
+
+    bsls::AtomicInt64   d_numIncrements;  // increments since the counters
+                                          // were last halved (roughly)
+
+    bslma::Allocator   *d_allocator_p;    // memory allocator (held, not
+                                          // owned)
+
+    // PRIVATE MANIPULATORS
+
+    /// Halve every counter in this sketch.
+    void halve();
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_FrequencySketch(const ShardedCache_FrequencySketch&);
+    ShardedCache_FrequencySketch& operator=(
+                                          const ShardedCache_FrequencySketch&);
+
+  public:
+    // CREATORS
+
+    /// Create a sketch suitable for estimating the access frequency of
+    /// about the specified `capacity` distinct items.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit ShardedCache_FrequencySketch(
+                                         bsl::size_t       capacity,
+                                         bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ShardedCache_FrequencySketch();
+
+    // MANIPULATORS
+
+    /// Record an access to an item having the specified `hash`.
+    void increment(bsl::size_t hash);
+
+    // ACCESSORS
+
+    /// Return the estimated number of recent accesses to an item having the
+    /// specified `hash`, saturated to 15.
+    int frequency(bsl::size_t hash) const;
+};
+
+                       // =============================
+                       // class ShardedCache_Statistics
+                       // =============================
+
+/// This component-private class maintains the lookup statistics of a
+/// `ShardedCache` and publishes them through a `bdlm::MetricsRegistry`.
+/// The counters of each shard occupy their own cache lines, so that lookups
+/// in different shards do not contend.
+class ShardedCache_Statistics {
+
+    // PRIVATE TYPES
+
+    /// Counters of one shard, padded to a multiple of the cache line size.
+    struct Counters {
+
+        // DATA
+        bsls::AtomicUint64 d_numLookups;          // calls to `tryGetValue`
+
+        bsls::AtomicUint64 d_numHits;             // lookups finding the key
+
+        bsls::AtomicUint64 d_numSamples;          // timed lookups
+
+        bsls::AtomicUint64 d_sampledNanoseconds;  // total duration of the
+                                                  // timed lookups
+
+        char               d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                  // padding
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_SAMPLE_MASK = 63  // a lookup is timed if the number of previous
+                            // lookups in its shard, masked by this value, is
+                            // 0
+    };
+
+    // DATA
+    Counters                 *d_counters_p;       // one per shard
+
+    bsl::size_t               d_numShards;        // number of shards
+
+    bslmt::Mutex              d_collectionMutex;  // serializes collection
+
+    bsls::Types::Uint64       d_lastLookups;      // lookups at the previous
+                                                  // collection of the hit
+                                                  // ratio
+
+    bsls::Types::Uint64       d_lastHits;         // hits at the previous
+                                                  // collection of the hit
+                                                  // ratio
+
+    bsls::Types::Uint64       d_lastSamples;      // samples at the previous
+                                                  // collection of the latency
+
+    bsls::Types::Uint64       d_lastNanoseconds;  // sampled duration at the
+                                                  // previous collection of
+                                                  // the latency
+
+    bslma::Allocator         *d_allocator_p;      // memory allocator (held,
+                                                  // not owned)
+
+    bdlm::MetricsRegistryRegistrationHandle
+                              d_hitRatioHandle;   // hit ratio metric handle
+
+    bdlm::MetricsRegistryRegistrationHandle
+                              d_latencyHandle;    // lookup latency metric
+                                                  // handle
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Statistics(const ShardedCache_Statistics&);
+    ShardedCache_Statistics& operator=(const ShardedCache_Statistics&);
+
+  public:
+    // CREATORS
+
+    /// Create statistics for a cache having the specified `numShards`, and
+    /// register the metrics of the cache, identified by the specified
+    /// `cacheName`, with the specified `metricsRegistry`.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::defaultInstance()`
+    /// is used.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    ShardedCache_Statistics(bsl::size_t              numShards,
+                            const bsl::string_view&  cacheName,
+                            bdlm::MetricsRegistry   *metricsRegistry,
+                            bslma::Allocator        *basicAllocator = 0);
+
+    /// Unregister the metrics and destroy this object.
+    ~ShardedCache_Statistics();
+
+    // MANIPULATORS
+
+    /// Load into the specified `value` the fraction of the lookups since the
+    /// previous call to this method that were hits, or 0 if there were no
+    /// lookups.
+    void collectHitRatio(bdlm::Metric *value);
+
+    /// Load into the specified `value` the mean duration, in seconds, of the
+    /// lookups timed since the previous call to this method, or 0 if none
+    /// were timed.
+    void collectLookupLatency(bdlm::Metric *value);
+
+    /// Record a hit in the specified `shard`.
+    void recordHit(bsl::size_t shard);
+
+    /// Record a lookup in the specified `shard` and return `true` if the
+    /// lookup should be timed, and `false` otherwise.
+    bool recordLookup(bsl::size_t shard);
+
+    /// Record that a timed lookup in the specified `shard` took the
+    /// specified `nanoseconds`.
+    void recordLookupTime(bsl::size_t shard, bsls::Types::Int64 nanoseconds);
+
+    // ACCESSORS
+
+    /// Return the total number of hits recorded.
+    bsls::Types::Uint64 numHits() const;
+
+    /// Return the total number of lookups recorded.
+    bsls::Types::Uint64 numLookups() const;
+};
+
+                          // ========================
+                          // struct ShardedCache_Entry
+                          // ========================
+
+/// This component-private struct holds an item of a `ShardedCache` shard:
+/// the value, the position of its key in the eviction queues, and the
+/// recency flag set by lookups.
+template <class KEY, class VALUE>
+struct ShardedCache_Entry {
+
+    // PUBLIC TYPES
+    typedef typename bsl::list<KEY>::iterator QueueIterator;
+
+    // PUBLIC DATA
+    bsl::shared_ptr<VALUE>  d_value;       // cached value
+
+    QueueIterator           d_queueIt;     // position of the key in its queue
+
+    int                     d_queue;       // index of the queue holding the
+                                           // key
+
+    mutable bsls::AtomicInt d_referenced;  // non-zero if looked up since the
+                                           // eviction policy last examined
+                                           // this item
+
+    // CREATORS
+
+    /// Create an entry having the specified `value`, in the queue having
+    /// the specified `queue` index at the specified `queueIt`.
+    ShardedCache_Entry(const bsl::shared_ptr<VALUE>& value,
+                       QueueIterator                 queueIt,
+                       int                           queue);
+
+    /// Create an entry having the same value as the specified `original`.
+    ShardedCache_Entry(const ShardedCache_Entry& original);
+
+    /// Create an entry having the same value as the specified `original`,
+    /// leaving `original` in a valid but unspecified state.
+    ShardedCache_Entry(bslmf::MovableRef<ShardedCache_Entry> original);
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Entry& operator=(const ShardedCache_Entry&);
+};
+
+                     // ================================
+                     // class ShardedCache_QueueProctor
+                     // ================================
+
+/// This class implements a proctor that, on destruction, removes the last
+/// element of a queue unless `release` has been called.
+template <class KEY>
+class ShardedCache_QueueProctor {
+
+    // DATA
+    bsl::list<KEY> *d_queue_p;  // queue (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_QueueProctor(const ShardedCache_QueueProctor&);
+    ShardedCache_QueueProctor& operator=(const ShardedCache_QueueProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor that removes the last element of the specified
+    /// `queue` on destruction.
+    explicit ShardedCache_QueueProctor(bsl::list<KEY> *queue);
+
+    /// Remove the last element of the queue, unless `release` was called,
+    /// and destroy this proctor.
+    ~ShardedCache_QueueProctor();
+
+    // MANIPULATORS
+
+    /// Release the queue, so that it is not modified on destruction.
+    void release();
+};
+
+                          // ========================
+                          // class ShardedCache_Shard
+                          // ========================
+
+/// This component-private class implements one shard of a `ShardedCache`:
+/// a hash map from keys to entries, and up to three eviction queues of keys
+/// (the admission window, the probationary segment, and the protected
+/// segment), protected by a reader-writer lock.  Only the probationary queue
+/// is used by the `e_FIFO` and `e_LRU` policies, and the admission window is
+/// used only by the `e_TINYLFU` policy.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Shared pointer type pointing to value type.
+    typedef bsl::shared_ptr<VALUE>                       ValuePtrType;
+
+    /// Type of function to call after an item has been evicted.
+    typedef bsl::function<void(const ValuePtrType&)>     PostEvictionCallback;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::list<KEY>                               QueueType;
+    typedef ShardedCache_Entry<KEY, VALUE>               Entry;
+    typedef bsl::unordered_map<KEY, Entry, HASH, EQUAL>  MapType;
+    typedef typename MapType::iterator                   MapIterator;
+    typedef bslmt::ReaderWriterMutex                     LockType;
+
+    enum {
+        k_WINDOW,     // index of the admission window
+        k_PROBATION,  // index of the probationary segment
+        k_PROTECTED   // index of the protected segment
+    };
+
+    // DATA
+    mutable LockType               d_rwlock;              // reader-writer
+                                                          // lock
+
+    MapType                        d_map;                 // items
+
+    QueueType                      d_window;              // admission
+                                                          // window
+
+    QueueType                      d_probation;           // probationary
+                                                          // segment, front
+                                                          // is evicted first
+
+    QueueType                      d_protected;           // protected
+                                                          // segment
+
+    CacheEvictionPolicy::Enum      d_evictionPolicy;      // eviction policy
+
+    bsl::size_t                    d_lowWatermark;        // size of this
+                                                          // shard when
+                                                          // eviction stops
+
+    bsl::size_t                    d_highWatermark;       // size of this
+                                                          // shard when
+                                                          // eviction starts
+
+    bsl::size_t                    d_windowCapacity;      // capacity of the
+                                                          // admission window
+
+    bsl::size_t                    d_mainCapacity;        // capacity of the
+                                                          // probationary and
+                                                          // protected
+                                                          // segments
+
+    bsl::size_t                    d_protectedCapacity;   // capacity of the
+                                                          // protected segment
+
+    ShardedCache_FrequencySketch  *d_sketch_p;            // frequency sketch
+                                                          // (owned), or 0
+                                                          // unless TinyLFU
+
+    PostEvictionCallback           d_postEvictionCallback;
+                                                          // function to call
+                                                          // after a value has
+                                                          // been evicted
+
+    bslma::Allocator              *d_allocator_p;         // memory allocator
+                                                          // (held, not owned)
+
+    // PRIVATE MANIPULATORS
+
+    /// Move the item at the specified `mapIt` to the back of the queue
+    /// having the specified `queue` index.
+    void moveToBack(const MapIterator& mapIt, int queue);
+
+    /// Evict one item from this shard, selected according to the eviction
+    /// policy, and invoke the post-eviction callback for it.  The behavior
+    /// is undefined unless this shard is not empty.
+    void evictOne();
+
+    /// Evict the item at the specified `mapIt` and invoke the post-eviction
+    /// callback for that item.
+    void evictItem(const MapIterator& mapIt);
+
+    /// Evict items from this shard if `size >= d_highWatermark` until
+    /// `size < d_lowWatermark`.
+    void enforceHighWatermark();
+
+    /// Return the queue having the specified `queue` index.
+    QueueType& queue(int queue);
+
+    /// Return an iterator to the item that the probationary and protected
+    /// segments would evict next, moving items between and within these
+    /// segments as the eviction policy requires.  The behavior is undefined
+    /// unless at least one of these segments is not empty.
+    MapIterator selectVictim();
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty shard using the specified `evictionPolicy`,
+    /// `lowWatermark`, `highWatermark`, `hashFunction`, and
+    /// `equalFunction`.  Use the specified `basicAllocator` to supply
+    /// memory.
+    ShardedCache_Shard(CacheEvictionPolicy::Enum  evictionPolicy,
+                       bsl::size_t                lowWatermark,
+                       bsl::size_t                highWatermark,
+                       const HASH&                hashFunction,
+                       const EQUAL&               equalFunction,
+                       bslma::Allocator          *basicAllocator);
+
+    /// Destroy this object.
+    ~ShardedCache_Shard();
+
+    // MANIPULATORS
+
+    /// Remove all items from this shard.  Do *not* invoke the post-eviction
+    /// callback.
+    void clear();
+
+    /// Remove the item having the specified `key` from this shard.  Invoke
+    /// the post-eviction callback for the removed item.  Return 0 on
+    /// success and 1 if `key` does not exist.
+    int erase(const KEY& key);
+
+    /// Add an item with the specified `*key_p`, having the specified
+    /// `hash`, and the specified `*valuePtr_p` to this shard.  If an item
+    /// already exists for `*key_p`, override its value with `*valuePtr_p`.
+    /// If the specified `moveKey` is `true`, move `*key_p`, and if the
+    /// specified `moveValuePtr` is `true`, move `*valuePtr_p`.  Return
+    /// `true` if `*key_p` was not previously in this shard and `false`
+    /// otherwise.
+    bool insert(KEY          *key_p,
+                bool          moveKey,
+                ValuePtrType *valuePtr_p,
+                bool          moveValuePtr,
+                bsl::size_t   hash);
+
+    /// Evict the item this shard would evict next.  Invoke the
+    /// post-eviction callback for the removed item.  Return 0 on success,
+    /// and 1 if this shard is empty.
+    int popFront();
+
+    /// Set the post-eviction callback to the specified
+    /// `postEvictionCallback`.
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+
+    /// Load, into the specified `value`, the value associated with the
+    /// specified `key`, having the specified `hash`, in this shard.  If the
+    /// specified `recordAccess` is `true`, record the access for the
+    /// eviction policy.  Return 0 on success, and 1 if `key` does not exist
+    /// in this shard.
+    int tryGetValue(ValuePtrType *value,
+                    const KEY&    key,
+                    bsl::size_t   hash,
+                    bool          recordAccess);
+
+    // ACCESSORS
+
+    /// Return (a copy of) the key-equality functor of this shard.
+    EQUAL equalFunction() const;
+
+    /// Return (a copy of) the hash functor of this shard.
+    HASH hashFunction() const;
+
+    /// Return the number of items in this shard.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` for every item in this shard in the
+    /// order of the eviction queues until `visitor` returns `false`.
+    /// Return `false` if `visitor` returned `false`, and `true` otherwise.
+    template <class VISITOR>
+    bool visit(VISITOR& visitor) const;
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+/// This class represents an in-process key-value store partitioned into
+/// independently locked shards, supporting a variety of eviction policies.
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Shared pointer type pointing to value type.
+    typedef bsl::shared_ptr<VALUE>                            ValuePtrType;
+
+    /// Type of function to call after an item has been evicted from the cache.
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+
+    /// Value type of a bulk insert entry.
+    typedef bsl::pair<KEY, ValuePtrType>                          KVType;
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // number of shards used unless specified
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>           Shard;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;    // memory allocator (held,
+                                                 // not owned)
+
+    HASH                       d_hashFunction;   // hash functor
+
+    bsl::size_t                d_numShards;      // number of shards (power
+                                                 // of 2)
+
+    int                        d_shardShift;     // shift selecting the shard
+                                                 // from a scrambled hash
+
+    Shard                     *d_shards_p;       // array of shards
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy; // eviction policy
+
+    bsl::size_t                d_lowWatermark;   // low watermark of the cache
+
+    bsl::size_t                d_highWatermark;  // high watermark of the
+                                                 // cache
+
+    bsls::AtomicUint           d_nextPopShard;   // shard examined first by
+                                                 // the next `popFront`
+
+    ShardedCache_Statistics    d_statistics;     // lookup statistics and
+                                                 // metrics
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the watermark of each of the specified `numShards` shards
+    /// corresponding to the specified cache-wide `watermark`.
+    static bsl::size_t shardWatermark(bsl::size_t watermark,
+                                      bsl::size_t numShards);
+
+    // PRIVATE MANIPULATORS
+
+    /// Create the shards of this cache using the specified `hashFunction`
+    /// and `equalFunction`.
+    void createShards(const HASH& hashFunction, const EQUAL& equalFunction);
+
+    /// Insert into the shard owning the specified `*key_p` the item having
+    /// `*key_p` and the specified `*valuePtr_p`, moving them as indicated
+    /// by the specified `moveKey` and `moveValuePtr` (see
+    /// `ShardedCache_Shard::insert`).  Return `true` if `*key_p` was not
+    /// previously in this cache and `false` otherwise.
+    bool insertImp(KEY          *key_p,
+                   bool          moveKey,
+                   ValuePtrType *valuePtr_p,
+                   bool          moveValuePtr);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the shard owning keys having the specified
+    /// `hash`.
+    bsl::size_t shardIndex(bsl::size_t hash) const;
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty LRU cache having no size limit and
+    /// `k_DEFAULT_NUM_SHARDS` shards.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty cache having `k_DEFAULT_NUM_SHARDS` shards and using
+    /// the specified `evictionPolicy` and the specified `lowWatermark` and
+    /// `highWatermark`.  Optionally specify the `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`, and
+    /// `1 <= highWatermark`.
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Create an empty cache having the specified `numShards` (rounded up
+    /// to a power of 2) and using the specified `evictionPolicy`,
+    /// `lowWatermark`, and `highWatermark`.  The specified `hashFunction`
+    /// is used to generate the hash values for a given key, and the
+    /// specified `equalFunction` is used to determine whether two keys have
+    /// the same value.  Optionally specify the `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`,
+    /// `1 <= highWatermark`, and `1 <= numShards`.
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Create an empty cache having the specified `numShards` (rounded up
+    /// to a power of 2), using the specified `evictionPolicy`,
+    /// `lowWatermark`, `highWatermark`, `hashFunction`, and
+    /// `equalFunction`, the specified `cacheName` to be used to identify
+    /// this cache in its metrics, and the specified `metricsRegistry` to be
+    /// used for reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::defaultInstance()` is used.  Optionally
+    /// specify the `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`,
+    /// `1 <= highWatermark`, and `1 <= numShards`.
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 const bsl::string_view&    cacheName,
+                 bdlm::MetricsRegistry     *metricsRegistry,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ShardedCache();
+
+    // MANIPULATORS
+
+    /// Remove all items from this cache.  Do *not* invoke the post-eviction
+    /// callback.
+    void clear();
+
+    /// Remove the item having the specified `key` from this cache.  Invoke
+    /// the post-eviction callback for the removed item.  Return 0 on
+    /// success and 1 if `key` does not exist.
+    int erase(const KEY& key);
+
+    /// Remove the items having the keys in the specified range
+    /// `[ begin, end )`, from this cache.  Invoke the post-eviction
+    /// callback for each removed item.  Return the number of items
+    /// successfully removed.
+    template <class INPUT_ITERATOR>
+    int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Remove the items having the specified `keys` from this cache.
+    /// Invoke the post-eviction callback for each removed item.  Return the
+    /// number of items successfully removed.
+    int eraseBulk(const bsl::vector<KEY>& keys);
+
+    /// Move the specified `key` and its associated `value` into this cache.
+    /// If `key` already exists, then its value will be replaced with
+    /// `value`.  Note that all the methods that take moved objects provide
+    /// the `basic` but not the `strong` exception guarantee.  Also note that
+    /// `key` must be copyable, even if it is moved.
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+
+    /// Insert the specified `key` and its associated `valuePtr` into this
+    /// cache.  If `key` already exists, then its value will be replaced
+    /// with `value`.  Note that the method with `key` moved provides the
+    /// `basic` but not the `strong` exception guarantee.  Also note that
+    /// `key` must be copyable, even if it is moved.
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+
+    /// Insert the specified range of Key-Value pairs specified by
+    /// `[ begin, end )` into this cache.  If a key already exists, then its
+    /// value will be replaced with the value.  Return the number of items
+    /// successfully inserted.
+    template <class INPUT_ITERATOR>
+    int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Insert the specified `data` (composed of Key-Value pairs) into this
+    /// cache.  If a key already exists, then its value will be replaced
+    /// with the value.  Return the number of items successfully inserted.
+    int insertBulk(const bsl::vector<KVType>& data);
+
+    /// Remove the item at the front of the eviction order of a non-empty
+    /// shard.  Invoke the post-eviction callback for the removed item.
+    /// Return 0 on success, and 1 if this cache is empty.
+    int popFront();
+
+    /// Set the post-eviction callback to the specified
+    /// `postEvictionCallback`.  The post-eviction callback is invoked for
+    /// each item evicted or removed from this cache.
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+
+    /// Load, into the specified `value`, the value associated with the
+    /// specified `key` in this cache.  If the optionally specified
+    /// `modifyEvictionQueue` is `true`, record the access for the eviction
+    /// policy.  Return 0 on success, and 1 if `key` does not exist in this
+    /// cache.  Note that only a read lock on the shard owning `key` is
+    /// acquired, regardless of the eviction policy.
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+
+    // ACCESSORS
+
+    /// Return (a copy of) the key-equality functor used by this cache.
+    EQUAL equalFunction() const;
+
+    /// Return the eviction policy used by this cache.
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+
+    /// Return (a copy of) the unary hash functor used by this cache.
+    HASH hashFunction() const;
+
+    /// Return the high watermark of this cache.
+    bsl::size_t highWatermark() const;
+
+    /// Return the low watermark of this cache.
+    bsl::size_t lowWatermark() const;
+
+    /// Return the number of lookups performed by `tryGetValue` that found
+    /// the requested key.
+    bsls::Types::Uint64 numHits() const;
+
+    /// Return the number of lookups performed by `tryGetValue`.
+    bsls::Types::Uint64 numLookups() const;
+
+    /// Return the number of shards of this cache.
+    bsl::size_t numShards() const;
+
+    /// Return the current size of this cache.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` for every item stored in this cache,
+    /// shard by shard in the eviction order of each shard, until `visitor`
+    /// returns `false`.  The `VISITOR` type must be a callable object that
+    /// can be invoked in the same way as the function
+    /// `bool (const KEY&, const VALUE&)`.
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // struct ShardedCache_Entry
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry(
+                                         const bsl::shared_ptr<VALUE>& value,
+                                         QueueIterator                 queueIt,
+                                         int                           queue)
+: d_value(value)
+, d_queueIt(queueIt)
+, d_queue(queue)
+, d_referenced(0)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry(
+                                           const ShardedCache_Entry& original)
+: d_value(original.d_value)
+, d_queueIt(original.d_queueIt)
+, d_queue(original.d_queue)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry(
+                               bslmf::MovableRef<ShardedCache_Entry> original)
+: d_value(bslmf::MovableRefUtil::move(
+                         bslmf::MovableRefUtil::access(original).d_value))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_queue(bslmf::MovableRefUtil::access(original).d_queue)
+, d_referenced(
+           bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
+                     // --------------------------------
+                     // class ShardedCache_QueueProctor
+                     // --------------------------------
+
+// CREATORS
+template <class KEY>
+inline
+ShardedCache_QueueProctor<KEY>::ShardedCache_QueueProctor(
+                                                        bsl::list<KEY> *queue)
+: d_queue_p(queue)
+{
+}
+
+template <class KEY>
+inline
+ShardedCache_QueueProctor<KEY>::~ShardedCache_QueueProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pop_back();
+    }
+}
+
+// MANIPULATORS
+template <class KEY>
+inline
+void ShardedCache_QueueProctor<KEY>::release()
+{
+    d_queue_p = 0;
+}
+
+                          // ------------------------
+                          // class ShardedCache_Shard
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::moveToBack(
+                                                   const MapIterator& mapIt,
+                                                   int                queue)
+{
+    Entry&     entry  = mapIt->second;
+    QueueType& target = this->queue(queue);
+
+    target.splice(target.end(), this->queue(entry.d_queue), entry.d_queueIt);
+    entry.d_queue = queue;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::evictOne()
+{
+    BSLS_ASSERT(!d_map.empty());
+
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        // Items leaving an overfull window enter the main area
+        // unconditionally while it has room.
+
+        while (d_window.size() > d_windowCapacity
+            && d_probation.size() + d_protected.size() < d_mainCapacity) {
+            const MapIterator mapIt = d_map.find(d_window.front());
+            BSLS_ASSERT(mapIt != d_map.end());
+
+            moveToBack(mapIt, k_PROBATION);
+        }
+
+        if (!d_window.empty()
+         && (d_window.size() >= d_windowCapacity
+          || (d_probation.empty() && d_protected.empty()))) {
+            // The item leaving the window is admitted to the main area only
+            // if it is estimated to be used more frequently than the item
+            // the main area would evict.
+
+            const MapIterator candidate = d_map.find(d_window.front());
+            BSLS_ASSERT(candidate != d_map.end());
+
+            if (d_probation.empty() && d_protected.empty()) {
+                evictItem(candidate);
+                return;                                               // RETURN
+            }
+
+            const MapIterator victim = selectVictim();
+            const HASH        hasher = d_map.hash_function();
+
+            if (d_sketch_p->frequency(hasher(candidate->first)) >
+                               d_sketch_p->frequency(hasher(victim->first))) {
+                moveToBack(candidate, k_PROBATION);
+                evictItem(victim);
+            }
+            else {
+                evictItem(candidate);
+            }
+            return;                                                   // RETURN
+        }
+    }
+
+    evictItem(selectVictim());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::evictItem(
+                                                     const MapIterator& mapIt)
+{
+    ValuePtrType value = mapIt->second.d_value;
+
+    queue(mapIt->second.d_queue).erase(mapIt->second.d_queueIt);
+    d_map.erase(mapIt);
+
+    if (d_postEvictionCallback) {
+        d_postEvictionCallback(value);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
+{
+    if (d_map.size() < d_highWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
+        evictOne();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::QueueType&
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::queue(int queue)
+{
+    return k_WINDOW    == queue ? d_window
+         : k_PROBATION == queue ? d_probation
+         :                        d_protected;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::MapIterator
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::selectVictim()
+{
+    BSLS_ASSERT(!d_probation.empty() || !d_protected.empty());
+
+    const bool segmented =
+                        CacheEvictionPolicy::e_SLRU    == d_evictionPolicy
+                     || CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy;
+
+    // Every iteration either returns or clears a "referenced" flag or moves
+    // an item out of the protected segment into the probationary segment,
+    // so the loop terminates.
+
+    while (true) {
+        if (d_probation.empty()) {
+            const MapIterator mapIt = d_map.find(d_protected.front());
+            BSLS_ASSERT(mapIt != d_map.end());
+
+            moveToBack(mapIt, k_PROBATION);
+            continue;
+        }
+
+        const MapIterator mapIt = d_map.find(d_probation.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (CacheEvictionPolicy::e_FIFO == d_evictionPolicy
+         || 0 == mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+
+        mapIt->second.d_referenced.storeRelaxed(0);
+
+        if (!segmented) {
+            // CLOCK: give the item a second chance.
+
+            moveToBack(mapIt, k_PROBATION);
+            continue;
+        }
+
+        // Promote the item to the protected segment, and demote the least
+        // recently used protected item if the segment is over capacity.
+
+        moveToBack(mapIt, k_PROTECTED);
+
+        while (d_protected.size() > d_protectedCapacity) {
+            const MapIterator demoted = d_map.find(d_protected.front());
+            BSLS_ASSERT(demoted != d_map.end());
+
+            if (demoted->second.d_referenced.loadRelaxed()) {
+                demoted->second.d_referenced.storeRelaxed(0);
+                moveToBack(demoted, k_PROTECTED);
+            }
+            else {
+                moveToBack(demoted, k_PROBATION);
+            }
+        }
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_map(0, hashFunction, equalFunction, basicAllocator)
+, d_window(basicAllocator)
+, d_probation(basicAllocator)
+, d_protected(basicAllocator)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_windowCapacity(0)
+, d_mainCapacity(lowWatermark)
+, d_protectedCapacity(lowWatermark - lowWatermark / 5)
+, d_sketch_p(0)
+, d_postEvictionCallback(bsl::allocator_arg, basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+    if (CacheEvictionPolicy::e_TINYLFU == evictionPolicy) {
+        d_windowCapacity    = lowWatermark / 100 ? lowWatermark / 100 : 1;
+        d_mainCapacity      = lowWatermark > d_windowCapacity
+                              ? lowWatermark - d_windowCapacity
+                              : 1;
+        d_protectedCapacity = d_mainCapacity - d_mainCapacity / 5;
+
+        d_sketch_p = new (*d_allocator_p) ShardedCache_FrequencySketch(
+                                                                lowWatermark,
+                                                                d_allocator_p);
+    }
+
+    if (0 == d_protectedCapacity) {
+        d_protectedCapacity = 1;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::~ShardedCache_Shard()
+{
+    if (d_sketch_p) {
+        d_allocator_p->deleteObject(d_sketch_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    d_map.clear();
+    d_window.clear();
+    d_probation.clear();
+    d_protected.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    const MapIterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(mapIt);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::insert(
+                                                    KEY          *key_p,
+                                                    bool          moveKey,
+                                                    ValuePtrType *valuePtr_p,
+                                                    bool          moveValuePtr,
+                                                    bsl::size_t   hash)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    if (d_sketch_p) {
+        d_sketch_p->increment(hash);
+    }
+
+    enforceHighWatermark();
+
+    KEY&          key      = *key_p;
+    ValuePtrType& valuePtr = *valuePtr_p;
+
+    MapIterator mapIt = d_map.find(key);
+    if (mapIt != d_map.end()) {
+        if (moveValuePtr) {
+            mapIt->second.d_value = bslmf::MovableRefUtil::move(valuePtr);
+        }
+        else {
+            mapIt->second.d_value = valuePtr;
+        }
+
+        if (CacheEvictionPolicy::e_FIFO == d_evictionPolicy
+         || CacheEvictionPolicy::e_LRU  == d_evictionPolicy) {
+            moveToBack(mapIt, k_PROBATION);
+        }
+        else {
+            mapIt->second.d_referenced.storeRelaxed(1);
+        }
+        return false;                                                 // RETURN
+    }
+
+    const int  queueIndex = CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy
+                            ? static_cast<int>(k_WINDOW)
+                            : static_cast<int>(k_PROBATION);
+    QueueType& queue      = this->queue(queueIndex);
+
+    queue.push_back(key);
+
+    ShardedCache_QueueProctor<KEY> proctor(&queue);
+
+    typename QueueType::iterator queueIt = queue.end();
+    --queueIt;
+
+    if (moveKey) {
+        d_map.emplace(bslmf::MovableRefUtil::move(key),
+                      Entry(valuePtr, queueIt, queueIndex));
+    }
+    else {
+        d_map.emplace(key, Entry(valuePtr, queueIt, queueIndex));
+    }
+
+    proctor.release();
+
+    if (moveValuePtr) {
+        valuePtr.reset();
+    }
+
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    if (d_map.empty()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictOne();
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+    d_postEvictionCallback = postEvictionCallback;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                                    ValuePtrType *value,
+                                                    const KEY&    key,
+                                                    bsl::size_t   hash,
+                                                    bool          recordAccess)
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+
+    if (recordAccess && d_sketch_p) {
+        d_sketch_p->increment(hash);
+    }
+
+    const typename MapType::const_iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    *value = mapIt->second.d_value;
+
+    // Set the flag only if it is clear, to avoid writing to the cache line of
+    // a popular item on every lookup.
+
+    if (recordAccess
+     && CacheEvictionPolicy::e_FIFO != d_evictionPolicy
+     && 0 == mapIt->second.d_referenced.loadRelaxed()) {
+        mapIt->second.d_referenced.storeRelaxed(1);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_map.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+    return d_map.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bool ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+
+    const QueueType *queues[] = { &d_window, &d_probation, &d_protected };
+
+    for (int i = 0; i < 3; ++i) {
+        for (typename QueueType::const_iterator queueIt = queues[i]->begin();
+             queueIt != queues[i]->end();
+             ++queueIt) {
+            const typename MapType::const_iterator mapIt = d_map.find(
+                                                                    *queueIt);
+            BSLS_ASSERT(mapIt != d_map.end());
+
+            if (!visitor(mapIt->first, *mapIt->second.d_value)) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+
+    return true;
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardWatermark(
+                                                     bsl::size_t watermark,
+                                                     bsl::size_t numShards)
+{
+    return watermark / numShards + (watermark % numShards ? 1 : 0);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::createShards(
+                                                  const HASH&  hashFunction,
+                                                  const EQUAL& equalFunction)
+{
+    const bsl::size_t low  = shardWatermark(d_lowWatermark,  d_numShards);
+    const bsl::size_t high = shardWatermark(d_highWatermark, d_numShards);
+
+    d_shards_p = reinterpret_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (&d_shards_p[i]) Shard(d_evictionPolicy,
+                                   low,
+                                   high,
+                                   hashFunction,
+                                   equalFunction,
+                                   d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool ShardedCache<KEY, VALUE, HASH, EQUAL>::insertImp(
+                                                    KEY          *key_p,
+                                                    bool          moveKey,
+                                                    ValuePtrType *valuePtr_p,
+                                                    bool          moveValuePtr)
+{
+    const bsl::size_t hash = d_hashFunction(*key_p);
+
+    return d_shards_p[shardIndex(hash)].insert(key_p,
+                                               moveKey,
+                                               valuePtr_p,
+                                               moveValuePtr,
+                                               hash);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(
+                                                        bsl::size_t hash) const
+{
+    // Scramble the hash (Fibonacci hashing) so that the shard does not depend
+    // only on the low-order bits, which the hash maps of the shards use.
+
+    return 1 == d_numShards
+           ? 0
+           : static_cast<bsl::size_t>(
+                      (static_cast<bsls::Types::Uint64>(hash)
+                                               * 0x9E3779B97F4A7C15ULL)
+                                                              >> d_shardShift);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_shardShift(64 - bdlb::BitUtil::log2(
+                    static_cast<bsls::Types::Uint64>(k_DEFAULT_NUM_SHARDS)))
+, d_shards_p(0)
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_nextPopShard(0)
+, d_statistics(
+             d_numShards,
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION,
+             0,
+             d_allocator_p)
+{
+    createShards(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_shardShift(64 - bdlb::BitUtil::log2(
+                    static_cast<bsls::Types::Uint64>(k_DEFAULT_NUM_SHARDS)))
+, d_shards_p(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+, d_statistics(
+             d_numShards,
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION,
+             0,
+             d_allocator_p)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    createShards(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction(hashFunction)
+, d_numShards(bdlb::BitUtil::roundUpToBinaryPower(
+                                 static_cast<bsls::Types::Uint64>(numShards)))
+, d_shardShift(64 - bdlb::BitUtil::log2(
+                                static_cast<bsls::Types::Uint64>(d_numShards)))
+, d_shards_p(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+, d_statistics(
+             d_numShards,
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION,
+             0,
+             d_allocator_p)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(hashFunction, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                    CacheEvictionPolicy::Enum  evictionPolicy,
+                                    bsl::size_t                lowWatermark,
+                                    bsl::size_t                highWatermark,
+                                    bsl::size_t                numShards,
+                                    const HASH&                hashFunction,
+                                    const EQUAL&               equalFunction,
+                                    const bsl::string_view&    cacheName,
+                                    bdlm::MetricsRegistry     *metricsRegistry,
+                                    bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction(hashFunction)
+, d_numShards(bdlb::BitUtil::roundUpToBinaryPower(
+                                 static_cast<bsls::Types::Uint64>(numShards)))
+, d_shardShift(64 - bdlb::BitUtil::log2(
+                                static_cast<bsls::Types::Uint64>(d_numShards)))
+, d_shards_p(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+, d_statistics(d_numShards, cacheName, metricsRegistry, d_allocator_p)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(hashFunction, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        bslma::DestructionUtil::destroy(&d_shards_p[i]);
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_shards_p[shardIndex(d_hashFunction(key))].erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(INPUT_ITERATOR begin,
+                                                     INPUT_ITERATOR end)
+{
+    int count = 0;
+    for (; begin != end; ++begin) {
+        count += 0 == erase(*begin);
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                 const bsl::vector<KEY>& keys)
+{
+    return eraseBulk(keys.begin(), keys.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    ValuePtrType valuePtr = bsl::allocate_shared<VALUE>(d_allocator_p, value);
+
+    insertImp(const_cast<KEY *>(&key), false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              const KEY&               key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    ValuePtrType valuePtr = bsl::allocate_shared<VALUE>(
+                                           d_allocator_p,
+                                           bslmf::MovableRefUtil::move(value));
+
+    insertImp(const_cast<KEY *>(&key), false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                  bslmf::MovableRef<KEY> key,
+                                                  const VALUE&           value)
+{
+    KEY&         localKey = key;
+    ValuePtrType valuePtr = bsl::allocate_shared<VALUE>(d_allocator_p, value);
+
+    insertImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY&         localKey = key;
+    ValuePtrType valuePtr = bsl::allocate_shared<VALUE>(
+                                           d_allocator_p,
+                                           bslmf::MovableRefUtil::move(value));
+
+    insertImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                  const KEY&          key,
+                                                  const ValuePtrType& valuePtr)
+{
+    insertImp(const_cast<KEY *>(&key),
+              false,
+              const_cast<ValuePtrType *>(&valuePtr),
+              false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY> key,
+                                               const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+
+    insertImp(&localKey, true, const_cast<ValuePtrType *>(&valuePtr), false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(INPUT_ITERATOR begin,
+                                                      INPUT_ITERATOR end)
+{
+    int count = 0;
+    for (; begin != end; ++begin) {
+        KEY          *key_p      = const_cast<KEY *>(         &begin->first);
+        ValuePtrType *valuePtr_p = const_cast<ValuePtrType *>(&begin->second);
+
+        count += insertImp(key_p, false, valuePtr_p, false);
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    return insertBulk(data.begin(), data.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t start = d_nextPopShard.addRelaxed(1);
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (0 == d_shards_p[(start + i) & (d_numShards - 1)].popFront()) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    const bsl::size_t hash  = d_hashFunction(key);
+    const bsl::size_t index = shardIndex(hash);
+
+    const bool               timed = d_statistics.recordLookup(index);
+    const bsls::Types::Int64 start = timed ? bsls::TimeUtil::getTimer() : 0;
+
+    const int rc = d_shards_p[index].tryGetValue(value,
+                                                 key,
+                                                 hash,
+                                                 modifyEvictionQueue);
+
+    if (0 == rc) {
+        d_statistics.recordHit(index);
+    }
+
+    if (timed) {
+        d_statistics.recordLookupTime(index,
+                                      bsls::TimeUtil::getTimer() - start);
+    }
+
+    return rc;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards_p[0].equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    return d_statistics.numHits();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numLookups() const
+{
+    return d_statistics.numLookups();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t size = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        size += d_shards_p[i].size();
+    }
+
+    return size;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!d_shards_p[i].visit(visitor)) {
+            break;
+        }
+    }
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *ShardedCache<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+                       // -----------------------------
+                       // class ShardedCache_Statistics
+                       // -----------------------------
+
+// MANIPULATORS
+inline
+void ShardedCache_Statistics::recordHit(bsl::size_t shard)
+{
+    d_counters_p[shard].d_numHits.addRelaxed(1);
+}
+
+inline
+bool ShardedCache_Statistics::recordLookup(bsl::size_t shard)
+{
+    return 0 == ((d_counters_p[shard].d_numLookups.addRelaxed(1) - 1)
+                                                             & k_SAMPLE_MASK);
+}
+
+inline
+void ShardedCache_Statistics::recordLookupTime(
+                                        bsl::size_t        shard,
+                                        bsls::Types::Int64 nanoseconds)
+{
+    d_counters_p[shard].d_numSamples.addRelaxed(1);
+    d_counters_p[shard].d_sampledNanoseconds.addRelaxed(
+                               static_cast<bsls::Types::Uint64>(nanoseconds));
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
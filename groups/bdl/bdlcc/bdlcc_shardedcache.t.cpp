@@ -0,0 +1,1380 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metricdescriptor.h>
+#include <bdlm_metricsadapter.h>
+#include <bdlm_metricsregistry.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, `bdlcc::ShardedCache`, that
+// provides an in-memory key-value cache partitioned into independently locked
+// shards.  Most of the interface mirrors `bdlcc::Cache`, so the manipulators
+// and accessors are tested in the same fashion, using a single shard where
+// the order of eviction must be deterministic.  The eviction policies are
+// tested with access patterns distinguishing them: FIFO ignores lookups, LRU
+// gives looked-up items a second chance, SLRU protects looked-up items from a
+// scan, and TinyLFU refuses to admit infrequently used items.  The
+// component-private frequency sketch is tested directly.  Metrics are tested
+// by installing a test metrics adapter that records the registered
+// callbacks.
+//
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+//
+// CREATORS
+// [ 3] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 3] ShardedCache(policy, lowWat, highWat, basicAllocator);
+// [ 3] ShardedCache(policy, lowWat, highWat, numShards, hash, eq, alloc);
+// [ 6] ShardedCache(policy, low, high, n, hash, eq, name, registry, alloc);
+// [ 3] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 4] void insert(const KEY& key, const VALUE& value);
+// [ 4] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int popFront();
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 4] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 3] EQUAL equalFunction() const;
+// [ 3] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 3] HASH hashFunction() const;
+// [ 3] bsl::size_t highWatermark() const;
+// [ 3] bsl::size_t lowWatermark() const;
+// [ 6] bsls::Types::Uint64 numHits() const;
+// [ 6] bsls::Types::Uint64 numLookups() const;
+// [ 3] bsl::size_t numShards() const;
+// [ 4] bsl::size_t size() const;
+// [ 4] void visit(VISITOR& visitor) const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] FREQUENCY SKETCH
+// [ 5] EVICTION POLICIES
+// [ 7] THREAD SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] READ PERFORMANCE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS AND TEST VARIABLES
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ShardedCache<int, int>            Obj;
+typedef bdlcc::CacheEvictionPolicy              Policy;
+typedef bdlcc::ShardedCache_FrequencySketch     Sketch;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return a single-shard cache having the specified `policy`, `low` and
+/// `high` watermarks, and using the specified `allocator`.
+Obj *makeCache(Policy::Enum      policy,
+               bsl::size_t       low,
+               bsl::size_t       high,
+               bslma::Allocator *allocator)
+{
+    return new (*allocator) Obj(policy,
+                                low,
+                                high,
+                                1,
+                                bsl::hash<int>(),
+                                bsl::equal_to<int>(),
+                                allocator);
+}
+
+/// Return the number of keys in the range `[begin, end)` that are in the
+/// specified `cache`.  Do not record the lookups for the eviction policy.
+int countKeys(Obj *cache, int begin, int end)
+{
+    bsl::shared_ptr<int> value;
+
+    int count = 0;
+    for (int key = begin; key < end; ++key) {
+        count += 0 == cache->tryGetValue(&value, key, false);
+    }
+
+    return count;
+}
+
+                           // ===================
+                           // struct KeyCollector
+                           // ===================
+
+/// This visitor records the keys of the visited items.
+struct KeyCollector {
+
+    // DATA
+    bsl::vector<int> *d_keys_p;
+    bsl::size_t       d_limit;
+
+    // MANIPULATORS
+
+    /// Append the specified `key` to the keys, and return `false` if the
+    /// limit has been reached.
+    bool operator()(const int& key, const int&)
+    {
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+/// Append the specified `*value` to the specified `evicted`.
+void recordEviction(bsl::vector<int>            *evicted,
+                    const bsl::shared_ptr<int>&  value)
+{
+    evicted->push_back(*value);
+}
+
+                         // ========================
+                         // class TestMetricsAdapter
+                         // ========================
+
+/// This class implements a metrics adapter that records the registered
+/// descriptors and callbacks, so that the tests can invoke the callbacks.
+class TestMetricsAdapter : public bdlm::MetricsAdapter {
+
+    // DATA
+    bsl::vector<bdlm::MetricDescriptor> d_descriptors;
+    bsl::vector<Callback>               d_callbacks;
+    bsl::vector<int>                    d_handles;
+
+  public:
+    // CREATORS
+
+    /// Create a `TestMetricsAdapter` using the specified `basicAllocator`
+    /// to supply memory.
+    explicit TestMetricsAdapter(bslma::Allocator *basicAllocator)
+    : d_descriptors(basicAllocator)
+    , d_callbacks(basicAllocator)
+    , d_handles(basicAllocator)
+    {
+    }
+
+    /// Destroy this object.
+    ~TestMetricsAdapter() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the specified `metricDescriptor` and `callback`, and return
+    /// a callback handle identifying them.
+    CallbackHandle registerCollectionCallback(
+                  const bdlm::MetricDescriptor& metricDescriptor,
+                  const Callback&               callback) BSLS_KEYWORD_OVERRIDE
+    {
+        d_descriptors.push_back(metricDescriptor);
+        d_callbacks.push_back(callback);
+        d_handles.push_back(static_cast<int>(d_handles.size()));
+
+        return d_handles.back();
+    }
+
+    /// Mark the callback identified by the specified `handle` as removed.
+    /// Return 0.
+    int removeCollectionCallback(const CallbackHandle& handle)
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        d_handles[handle] = -1;
+        return 0;
+    }
+
+    // ACCESSORS
+
+    /// Return the value of the metric having the specified `metricName`
+    /// collected by its callback, or -1 if no callback for `metricName` is
+    /// registered.
+    double collect(const char *metricName) const
+    {
+        for (bsl::size_t i = 0; i < d_descriptors.size(); ++i) {
+            if (d_descriptors[i].metricName() == metricName
+             && 0 <= d_handles[i]) {
+                bdlm::Metric value;
+                d_callbacks[i](&value);
+                return value.theGauge();                              // RETURN
+            }
+        }
+        return -1.0;
+    }
+
+    /// Return the descriptors of the registered callbacks.
+    const bsl::vector<bdlm::MetricDescriptor>& descriptors() const
+    {
+        return d_descriptors;
+    }
+
+    /// Return the number of registered callbacks that were not removed.
+    int numRegistered() const
+    {
+        int count = 0;
+        for (bsl::size_t i = 0; i < d_handles.size(); ++i) {
+            count += 0 <= d_handles[i];
+        }
+        return count;
+    }
+};
+
+                        // ===========================
+                        // struct ThreadSafetyTestJob
+                        // ===========================
+
+/// This functor performs a mix of cache operations on a range of keys.
+struct ThreadSafetyTestJob {
+
+    // DATA
+    Obj              *d_cache_p;
+    bslmt::Barrier   *d_barrier_p;
+    bsls::AtomicInt  *d_numErrors_p;
+    int               d_seed;
+    int               d_numIterations;
+
+    // MANIPULATORS
+
+    /// Perform the operations.
+    void operator()()
+    {
+        d_barrier_p->wait();
+
+        unsigned int         state = static_cast<unsigned int>(d_seed);
+        bsl::shared_ptr<int> value;
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            state = state * 1103515245 + 12345;
+
+            const int key = static_cast<int>((state >> 8) % 512);
+
+            switch ((state >> 20) % 8) {
+              case 0: {
+                d_cache_p->erase(key);
+              } break;
+              case 1:
+              case 2: {
+                d_cache_p->insert(key, key * 3);
+              } break;
+              case 3: {
+                d_cache_p->popFront();
+              } break;
+              default: {
+                if (0 == d_cache_p->tryGetValue(&value, key)
+                 && *value != key * 3) {
+                    ++*d_numErrors_p;
+                }
+              }
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                           PERFORMANCE HARNESS
+// ----------------------------------------------------------------------------
+
+namespace SHARDEDCACHE_TEST_CASE_MINUS_1 {
+
+/// Look up the keys `[0, numKeys)` in the specified `cache`, in a
+/// pseudo-random order seeded by the specified `seed`, the specified
+/// `numLookups` times, after waiting on the specified `barrier`.
+template <class CACHE>
+void readJob(CACHE          *cache,
+             bslmt::Barrier *barrier,
+             int             numKeys,
+             int             numLookups,
+             int             seed)
+{
+    barrier->wait();
+
+    unsigned int         state = static_cast<unsigned int>(seed);
+    bsl::shared_ptr<int> value;
+
+    for (int i = 0; i < numLookups; ++i) {
+        state = state * 1103515245 + 12345;
+        cache->tryGetValue(&value, static_cast<int>((state >> 8) % numKeys));
+    }
+}
+
+/// Return the number of lookups per second achieved by the specified
+/// `numThreads` threads each performing the specified `numLookups` lookups
+/// of `numKeys` keys in the specified `cache`.
+template <class CACHE>
+double measure(CACHE *cache, int numThreads, int numKeys, int numLookups)
+{
+    for (int i = 0; i < numKeys; ++i) {
+        cache->insert(i, i);
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup group;
+
+    for (int i = 0; i < numThreads; ++i) {
+        group.addThread(bdlf::BindUtil::bind(&readJob<CACHE>,
+                                             cache,
+                                             &barrier,
+                                             numKeys,
+                                             numLookups,
+                                             i + 1));
+    }
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+    barrier.wait();
+    group.joinAll();
+    stopwatch.stop();
+
+    return static_cast<double>(numThreads) * numLookups
+                                             / stopwatch.accumulatedWallTime();
+}
+
+}  // close namespace SHARDEDCACHE_TEST_CASE_MINUS_1
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator  da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator talloc("usage", veryVeryVeryVerbose);
+
+///Example 1: A Scan-Resistant Quote Cache
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches quotes keyed by ticker symbol, and that a
+// small set of popular symbols is looked up far more often than the rest.
+// Occasionally, a batch job loads quotes for many other symbols, each of
+// which is used once; with a plain LRU cache, such a scan would evict the
+// popular symbols.
+//
+// First, we create a cache of up to 4 items using the TinyLFU policy, with a
+// single shard so that the example is deterministic:
+// ```
+    bdlcc::ShardedCache<bsl::string, double> cache(
+                                         bdlcc::CacheEvictionPolicy::e_TINYLFU,
+                                         4,
+                                         4,
+                                         1,
+                                         bsl::hash<bsl::string>(),
+                                         bsl::equal_to<bsl::string>(),
+                                         "quotes",
+                                         0,
+                                         &talloc);
+// ```
+// Then, we insert a popular symbol and look it up repeatedly:
+// ```
+    const bsl::string ibm("IBM", &talloc);
+
+    cache.insert(ibm, 140.5);
+
+    bsl::shared_ptr<double> value;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT(0 == cache.tryGetValue(&value, ibm));
+    }
+// ```
+// Next, the batch job inserts quotes for 100 other symbols:
+// ```
+    for (int i = 0; i < 100; ++i) {
+        char buffer[16];
+        snprintf(buffer, sizeof buffer, "SYM%d", i);
+
+        cache.insert(bsl::string(buffer, &talloc), i);
+    }
+    ASSERT(4 == cache.size());
+// ```
+// Finally, we observe that the popular symbol survived the scan, and that
+// the cache kept count of the lookups:
+// ```
+    ASSERT(0 == cache.tryGetValue(&value, ibm));
+    ASSERT(140.5 == *value);
+
+    ASSERT(11 == cache.numLookups());
+    ASSERT(11 == cache.numHits());
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        // 1. Concurrent insertions, lookups, erasures, and evictions under
+        //    each eviction policy neither corrupt the cache nor return
+        //    values not associated with the requested key.
+        //
+        // 2. The watermarks are respected once the threads are done.
+        //
+        // 3. All memory is returned.
+        //
+        // Plan:
+        // 1. For each policy, run several threads performing a pseudo-random
+        //    mix of operations on a cache having 4 shards and a small
+        //    capacity, so that evictions are frequent.  Verify the values
+        //    found, the size of the cache, and its consistency as observed
+        //    by `visit`.  (C-1..3)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        const int k_NUM_THREADS    = 8;
+        const int k_NUM_ITERATIONS = 20000;
+
+        const Policy::Enum POLICIES[] = { Policy::e_FIFO,
+                                          Policy::e_LRU,
+                                          Policy::e_SLRU,
+                                          Policy::e_TINYLFU };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const Policy::Enum POLICY = POLICIES[ti];
+
+            if (veryVerbose) { T_ P(POLICY) }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            bsls::AtomicInt numErrors(0);
+            {
+                TestMetricsAdapter    adapter(&ta);
+                bdlm::MetricsRegistry registry(&ta);
+                registry.setMetricsAdapter(&adapter);
+
+                Obj mX(POLICY,
+                       100,
+                       120,
+                       4,
+                       bsl::hash<int>(),
+                       bsl::equal_to<int>(),
+                       "ts",
+                       &registry,
+                       &ta);
+
+                bsl::vector<int> evicted(&ta);
+
+                bslmt::Barrier     barrier(k_NUM_THREADS);
+                bslmt::ThreadGroup group(&ta);
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ThreadSafetyTestJob job = { &mX,
+                                                &barrier,
+                                                &numErrors,
+                                                i + 1,
+                                                k_NUM_ITERATIONS };
+                    group.addThread(job);
+                }
+                group.joinAll();
+
+                ASSERTV(POLICY, numErrors, 0 == numErrors);
+                ASSERTV(POLICY, mX.size(), mX.size() <= 4 * 30);
+
+                bsl::vector<int> keys(&ta);
+                KeyCollector     collector = { &keys, 100000 };
+                mX.visit(collector);
+
+                ASSERTV(POLICY, keys.size(), mX.size() == keys.size());
+
+                ASSERT(0 < adapter.collect("bde.cache.hitratio"));
+                ASSERT(1 > adapter.collect("bde.cache.hitratio"));
+            }
+            ASSERTV(POLICY, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // METRICS
+        //
+        // Concerns:
+        // 1. The hit ratio and lookup latency metrics are registered with
+        //    the supplied registry, or with the default registry if none is
+        //    supplied, under the expected names, and are unregistered on
+        //    destruction.
+        //
+        // 2. The hit ratio metric reports the fraction of the lookups since
+        //    the previous collection that were hits, and 0 if there were
+        //    none.
+        //
+        // 3. The lookup latency metric reports a non-negative duration, and
+        //    0 when no lookup was sampled.
+        //
+        // 4. `numLookups` and `numHits` report the totals.
+        //
+        // Plan:
+        // 1. Create caches with a registry having a test adapter, and
+        //    verify the registered descriptors and their removal.  (C-1)
+        //
+        // 2. Perform lookups with known outcomes and collect the metrics
+        //    through the callbacks registered with the adapter.  (C-2..4)
+        //
+        // Testing:
+        //   ShardedCache(policy, low, high, n, hash, eq, name, registry, a);
+        //   bsls::Types::Uint64 numHits() const;
+        //   bsls::Types::Uint64 numLookups() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "METRICS" << endl
+                          << "=======" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object",   veryVeryVeryVerbose);
+
+        TestMetricsAdapter    adapter(&sa);
+        bdlm::MetricsRegistry registry(&sa);
+        registry.setMetricsAdapter(&adapter);
+
+        {
+            Obj mX(Policy::e_LRU,
+                   100,
+                   100,
+                   4,
+                   bsl::hash<int>(),
+                   bsl::equal_to<int>(),
+                   "metrics",
+                   &registry,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(2 == adapter.numRegistered());
+            ASSERT(2 == adapter.descriptors().size());
+
+            const bdlm::MetricDescriptor& HR = adapter.descriptors()[0];
+            const bdlm::MetricDescriptor& LL = adapter.descriptors()[1];
+
+            ASSERT("bde.cache.hitratio"      == HR.metricName());
+            ASSERT("bde.cache.lookuplatency" == LL.metricName());
+            ASSERT("bdlcc.shardedcache"      == HR.objectTypeName());
+            ASSERT("sc"                      == HR.objectTypeAbbreviation());
+            ASSERT("metrics"                 == HR.objectIdentifier());
+            ASSERT(HR.instanceNumber()       == LL.instanceNumber());
+
+            ASSERT(0.0 == adapter.collect("bde.cache.hitratio"));
+            ASSERT(0.0 == adapter.collect("bde.cache.lookuplatency"));
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i, i);
+            }
+
+            bsl::shared_ptr<int> value;
+            for (int i = 0; i < 40; ++i) {
+                mX.tryGetValue(&value, i % 20);
+            }
+
+            ASSERT(40 == X.numLookups());
+            ASSERT(20 == X.numHits());
+
+            ASSERT(0.5 == adapter.collect("bde.cache.hitratio"));
+            ASSERT(0.0 == adapter.collect("bde.cache.hitratio"));
+            ASSERT(0.0 <= adapter.collect("bde.cache.lookuplatency"));
+            ASSERT(0.0 == adapter.collect("bde.cache.lookuplatency"));
+
+            for (int i = 0; i < 4; ++i) {
+                mX.tryGetValue(&value, 3, false);
+            }
+            ASSERT(1.0 == adapter.collect("bde.cache.hitratio"));
+
+            ASSERT(44 == X.numLookups());
+            ASSERT(24 == X.numHits());
+        }
+        ASSERT(0 == adapter.numRegistered());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EVICTION POLICIES
+        //
+        // Concerns:
+        // 1. `e_FIFO` evicts items in insertion order, regardless of lookups.
+        //
+        // 2. `e_LRU` gives items looked up since they were last examined a
+        //    second chance, and a lookup with `modifyEvictionQueue == false`
+        //    does not count.
+        //
+        // 3. `e_SLRU` retains looked-up items during a scan of items used
+        //    once, where `e_LRU` does not.
+        //
+        // 4. `e_TINYLFU` does not admit items used less frequently than the
+        //    items they would replace.
+        //
+        // 5. `popFront` evicts the item the policy would evict next.
+        //
+        // Plan:
+        // 1. Using single-shard caches, perform access patterns for which the
+        //    expected contents are known, and verify the contents and the
+        //    items passed to the post-eviction callback.  (C-1..5)
+        //
+        // Testing:
+        //   EVICTION POLICIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION POLICIES" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        bsl::shared_ptr<int> value;
+
+        if (verbose) cout << "\tFIFO" << endl;
+        {
+            Obj *mX = makeCache(Policy::e_FIFO, 3, 3, &ta);
+
+            bsl::vector<int> evicted(&ta);
+            mX->setPostEvictionCallback(
+                   bdlf::BindUtil::bind(&recordEviction,
+                                        &evicted,
+                                        bdlf::PlaceHolders::_1));
+
+            mX->insert(1, 1);
+            mX->insert(2, 2);
+            mX->insert(3, 3);
+            ASSERT(0 == mX->tryGetValue(&value, 1));
+            mX->insert(4, 4);
+
+            ASSERT(1 == evicted.size());
+            ASSERT(1 == evicted[0]);
+            ASSERT(3 == countKeys(mX, 2, 5));
+
+            ASSERT(0 == mX->popFront());
+            ASSERT(2 == evicted.size());
+            ASSERT(2 == evicted[1]);
+
+            ta.deleteObject(mX);
+        }
+
+        if (verbose) cout << "\tLRU" << endl;
+        {
+            Obj *mX = makeCache(Policy::e_LRU, 3, 3, &ta);
+
+            bsl::vector<int> evicted(&ta);
+            mX->setPostEvictionCallback(
+                   bdlf::BindUtil::bind(&recordEviction,
+                                        &evicted,
+                                        bdlf::PlaceHolders::_1));
+
+            mX->insert(1, 1);
+            mX->insert(2, 2);
+            mX->insert(3, 3);
+            ASSERT(0 == mX->tryGetValue(&value, 1));
+            ASSERT(0 == mX->tryGetValue(&value, 2, false));
+            mX->insert(4, 4);
+
+            ASSERT(1 == evicted.size());
+            ASSERT(2 == evicted[0]);
+            ASSERT(1 == countKeys(mX, 1, 2));
+            ASSERT(2 == countKeys(mX, 3, 5));
+
+            ASSERT(0 == mX->popFront());
+            ASSERT(2 == evicted.size());
+            ASSERT(3 == evicted[1]);
+
+            // Re-inserting an existing key moves it to the back.
+
+            mX->insert(1, 10);
+            ASSERT(0 == mX->popFront());
+            ASSERT(3 == evicted.size());
+            ASSERT(4 == evicted[2]);
+
+            ASSERT(0 == mX->tryGetValue(&value, 1));
+            ASSERT(10 == *value);
+
+            ta.deleteObject(mX);
+        }
+
+        if (verbose) cout << "\tSLRU versus LRU under a scan" << endl;
+        {
+            const Policy::Enum POLICIES[]     = { Policy::e_LRU,
+                                                  Policy::e_SLRU };
+            const int          EXP_RETAINED[] = { 0, 2 };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                Obj *mX = makeCache(POLICIES[ti], 5, 5, &ta);
+
+                mX->insert(1, 1);
+                mX->insert(2, 2);
+                ASSERT(0 == mX->tryGetValue(&value, 1));
+                ASSERT(0 == mX->tryGetValue(&value, 2));
+
+                for (int key = 100; key < 120; ++key) {
+                    mX->insert(key, key);
+                    ASSERT(5 >= mX->size());
+                }
+
+                ASSERTV(POLICIES[ti],
+                        EXP_RETAINED[ti] == countKeys(mX, 1, 3));
+
+                ta.deleteObject(mX);
+            }
+        }
+
+        if (verbose) cout << "\tTinyLFU admission" << endl;
+        {
+            const Policy::Enum POLICIES[] = { Policy::e_LRU,
+                                              Policy::e_TINYLFU };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                const Policy::Enum POLICY = POLICIES[ti];
+
+                Obj *mX = makeCache(POLICY, 100, 100, &ta);
+
+                for (int key = 0; key < 100; ++key) {
+                    mX->insert(key, key);
+                }
+                for (int round = 0; round < 3; ++round) {
+                    for (int key = 0; key < 100; ++key) {
+                        ASSERT(0 == mX->tryGetValue(&value, key));
+                    }
+                }
+
+                for (int key = 1000; key < 1020; ++key) {
+                    mX->insert(key, key);
+                    ASSERT(0 == mX->tryGetValue(&value, key));
+                }
+
+                const int numOld  = countKeys(mX, 0, 100);
+                const int numScan = countKeys(mX, 1000, 1020);
+
+                if (veryVerbose) { T_ P_(POLICY) P_(numOld) P(numScan) }
+
+                ASSERTV(POLICY, 100 == mX->size());
+
+                if (Policy::e_TINYLFU == POLICY) {
+                    // Only the newest scan item, in the admission window,
+                    // may remain.
+
+                    ASSERTV(numScan, 1 >= numScan);
+                }
+                else {
+                    ASSERTV(numScan, 20 == numScan);
+                }
+
+                ta.deleteObject(mX);
+            }
+        }
+
+        if (verbose) cout << "\tTinyLFU admits frequent items" << endl;
+        {
+            Obj *mX = makeCache(Policy::e_TINYLFU, 100, 100, &ta);
+
+            for (int key = 0; key < 100; ++key) {
+                mX->insert(key, key);
+            }
+
+            // Keys looked up often before being inserted are admitted.
+
+            for (int key = 1000; key < 1010; ++key) {
+                for (int i = 0; i < 8; ++i) {
+                    ASSERT(1 == mX->tryGetValue(&value, key));
+                }
+            }
+            for (int key = 1000; key < 1010; ++key) {
+                mX->insert(key, key);
+            }
+            mX->insert(2000, 2000);
+
+            const int numFrequent = countKeys(mX, 1000, 1010);
+            ASSERTV(numFrequent, 10 == numFrequent);
+
+            ta.deleteObject(mX);
+        }
+        value.reset();
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        // 1. Inserted items can be found by `tryGetValue`, and inserting an
+        //    existing key replaces its value.
+        //
+        // 2. `erase`, `eraseBulk`, and `popFront` remove items and invoke the
+        //    post-eviction callback; `clear` does not.
+        //
+        // 3. `insertBulk` and `eraseBulk` return the number of items inserted
+        //    and removed.
+        //
+        // 4. `visit` visits each item once and stops when the visitor
+        //    returns `false`.
+        //
+        // 5. Items are distributed among the shards.
+        //
+        // Plan:
+        // 1. Exercise each manipulator on caches with each policy and with 1
+        //    and 8 shards, verifying the results using the accessors.
+        //    (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int popFront();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsl::size_t size() const;
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        const Policy::Enum POLICIES[] = { Policy::e_FIFO,
+                                          Policy::e_LRU,
+                                          Policy::e_SLRU,
+                                          Policy::e_TINYLFU };
+        const bsl::size_t  SHARDS[]   = { 1, 8 };
+
+        for (int ti = 0; ti < 4; ++ti) {
+        for (int tj = 0; tj < 2; ++tj) {
+            const Policy::Enum POLICY = POLICIES[ti];
+            const bsl::size_t  NS     = SHARDS[tj];
+
+            if (veryVerbose) { T_ P_(POLICY) P(NS) }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(POLICY,
+                       1000,
+                       1000,
+                       NS,
+                       bsl::hash<int>(),
+                       bsl::equal_to<int>(),
+                       &ta);
+                const Obj& X = mX;
+
+                bsl::vector<int> evicted(&ta);
+                mX.setPostEvictionCallback(
+                       bdlf::BindUtil::bind(&recordEviction,
+                                            &evicted,
+                                            bdlf::PlaceHolders::_1));
+
+                bsl::shared_ptr<int> value;
+
+                for (int i = 0; i < 50; ++i) {
+                    mX.insert(i, i * 2);
+                }
+                ASSERT(50 == X.size());
+
+                for (int i = 0; i < 50; ++i) {
+                    ASSERT(0 == mX.tryGetValue(&value, i));
+                    ASSERT(i * 2 == *value);
+                }
+                ASSERT(1 == mX.tryGetValue(&value, 50));
+
+                mX.insert(7, 700);
+                ASSERT(50 == X.size());
+                ASSERT(0 == mX.tryGetValue(&value, 7));
+                ASSERT(700 == *value);
+
+                bsl::shared_ptr<int> ptr = bsl::allocate_shared<int>(&ta, 9);
+                mX.insert(50, ptr);
+                ASSERT(0 == mX.tryGetValue(&value, 50));
+                ASSERT(ptr == value);
+
+                ASSERT(0 == mX.erase(50));
+                ASSERT(1 == mX.erase(50));
+                ASSERT(1 == evicted.size());
+                ASSERT(9 == evicted[0]);
+
+                bsl::vector<Obj::KVType> data(&ta);
+                for (int i = 45; i < 55; ++i) {
+                    data.push_back(
+                          Obj::KVType(i, bsl::allocate_shared<int>(&ta, i)));
+                }
+                ASSERT(5 == mX.insertBulk(data));
+                ASSERT(55 == X.size());
+
+                bsl::vector<int> keys(&ta);
+                for (int i = 50; i < 60; ++i) {
+                    keys.push_back(i);
+                }
+                ASSERT(5 == mX.eraseBulk(keys));
+                ASSERT(50 == X.size());
+                ASSERT(6 == evicted.size());
+
+                keys.clear();
+                KeyCollector all = { &keys, 1000 };
+                mX.visit(all);
+                ASSERT(50 == keys.size());
+
+                bsl::sort(keys.begin(), keys.end());
+                for (int i = 0; i < 50; ++i) {
+                    ASSERTV(i, keys[i], i == keys[i]);
+                }
+
+                keys.clear();
+                KeyCollector three = { &keys, 3 };
+                mX.visit(three);
+                ASSERT(3 == keys.size());
+
+                ASSERT(0 == mX.popFront());
+                ASSERT(49 == X.size());
+                ASSERT(7 == evicted.size());
+
+                mX.clear();
+                ASSERT(0 == X.size());
+                ASSERT(7 == evicted.size());
+                ASSERT(1 == mX.popFront());
+                ASSERT(1 == mX.tryGetValue(&value, 1));
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        }
+
+        if (verbose) cout << "\tWatermarks are divided among shards" << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(Policy::e_LRU,
+                   40,
+                   64,
+                   4,
+                   bsl::hash<int>(),
+                   bsl::equal_to<int>(),
+                   &ta);
+
+            for (int i = 0; i < 10000; ++i) {
+                mX.insert(i, i);
+                ASSERTV(i, mX.size(), mX.size() <= 64);
+            }
+            ASSERT(40 <= mX.size());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. Each constructor creates an empty cache having the specified
+        //    attributes, the default attributes otherwise.
+        //
+        // 2. The number of shards is rounded up to a power of 2.
+        //
+        // 3. The allocator is propagated, and the default allocator is used
+        //    if none is supplied.
+        //
+        // Plan:
+        // 1. Create objects using each constructor and verify the
+        //    accessors and the allocator use.  (C-1..3)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, hash, eq, alloc);
+        //   ~ShardedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                          X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                         X.highWatermark());
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(0   == X.size());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   <  ta.numBlocksInUse());
+            ASSERT(0   == X.numLookups());
+            ASSERT(0   == X.numHits());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            Obj mX(Policy::e_FIFO, 10, 20, &ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_FIFO == X.evictionPolicy());
+            ASSERT(10  == X.lowWatermark());
+            ASSERT(20  == X.highWatermark());
+            ASSERT(16  == X.numShards());
+            ASSERT(&ta == X.allocator());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        const bsl::size_t DATA[][2] = { {  1,  1 },
+                                        {  2,  2 },
+                                        {  3,  4 },
+                                        {  5,  8 },
+                                        { 64, 64 },
+                                        { 65, 128 } };
+
+        for (int ti = 0; ti < 6; ++ti) {
+            Obj mX(Policy::e_TINYLFU,
+                   1000,
+                   2000,
+                   DATA[ti][0],
+                   bsl::hash<int>(),
+                   bsl::equal_to<int>(),
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERTV(ti, X.numShards(), DATA[ti][1] == X.numShards());
+            ASSERT(Policy::e_TINYLFU == X.evictionPolicy());
+            ASSERT(1000 == X.lowWatermark());
+            ASSERT(2000 == X.highWatermark());
+            ASSERT(X.hashFunction()(5) == bsl::hash<int>()(5));
+            ASSERT(X.equalFunction()(5, 5));
+            ASSERT(!X.equalFunction()(5, 6));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            bslma::TestAllocatorMonitor dam(&da);
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(&da == X.allocator());
+                ASSERT(dam.isInUseUp());
+            }
+            ASSERT(dam.isInUseSame());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FREQUENCY SKETCH
+        //
+        // Concerns:
+        // 1. The estimated frequency of a hash is at least the number of
+        //    increments of that hash since the counters were halved, up to
+        //    15.
+        //
+        // 2. The estimates saturate at 15.
+        //
+        // 3. The counters are halved periodically.
+        //
+        // 4. Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        // 1. Increment a few hashes a known number of times and verify the
+        //    estimates.  (C-1..2)
+        //
+        // 2. Increment many distinct hashes and verify that the estimates of
+        //    the original hashes decreased.  (C-3)
+        //
+        // 3. Use a test allocator.  (C-4)
+        //
+        // Testing:
+        //   FREQUENCY SKETCH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FREQUENCY SKETCH" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Sketch mX(1000, &ta);  const Sketch& X = mX;
+
+            ASSERT(0 < ta.numBlocksInUse());
+
+            for (bsl::size_t h = 0; h < 20; ++h) {
+                ASSERTV(h, X.frequency(h), 0 == X.frequency(h));
+            }
+
+            for (bsl::size_t h = 0; h < 20; ++h) {
+                for (bsl::size_t i = 0; i < h; ++i) {
+                    mX.increment(h * 7919);
+                }
+            }
+
+            for (bsl::size_t h = 0; h < 20; ++h) {
+                const int EXP       = h < 15 ? static_cast<int>(h) : 15;
+                const int frequency = X.frequency(h * 7919);
+
+                ASSERTV(h, frequency, EXP <= frequency);
+                ASSERTV(h, frequency, 15  >= frequency);
+            }
+            ASSERT(15 == X.frequency(19 * 7919));
+
+            // 1000 is rounded up to 1024 words, so the counters are halved
+            // after 10240 increments.
+
+            for (bsl::size_t h = 1000000; h < 1011000; ++h) {
+                mX.increment(h);
+            }
+            ASSERTV(X.frequency(19 * 7919), 8 >= X.frequency(19 * 7919));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a cache with each policy, insert, look up, and evict
+        //    items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const Policy::Enum POLICIES[] = { Policy::e_FIFO,
+                                          Policy::e_LRU,
+                                          Policy::e_SLRU,
+                                          Policy::e_TINYLFU };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            Obj mX(POLICIES[ti], 8, 10, &ta);  const Obj& X = mX;
+
+            bsl::shared_ptr<int> value;
+
+            mX.insert(1, 10);
+            mX.insert(2, 20);
+            ASSERT(2 == X.size());
+
+            ASSERT(0  == mX.tryGetValue(&value, 1));
+            ASSERT(10 == *value);
+            ASSERT(1  == mX.tryGetValue(&value, 3));
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(X.size() <= 16 * 1);
+
+            ASSERT(0 == mX.erase(999));
+            mX.clear();
+            ASSERT(0 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ PERFORMANCE
+        //
+        // Concerns:
+        // 1. Concurrent lookups scale better in `bdlcc::ShardedCache` than in
+        //    `bdlcc::Cache`.
+        //
+        // Plan:
+        // 1. For each LRU-like policy, measure the throughput of the
+        //    specified number of threads (default 4) looking up keys in a
+        //    `bdlcc::Cache` and in a `bdlcc::ShardedCache` holding 100000
+        //    items.  (C-1)
+        //
+        // Testing:
+        //   READ PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READ PERFORMANCE" << endl
+                          << "================" << endl;
+
+        using namespace SHARDEDCACHE_TEST_CASE_MINUS_1;
+
+        const int k_NUM_THREADS = argc > 2 ? atoi(argv[2]) : 4;
+        const int k_NUM_KEYS    = 100000;
+        const int k_NUM_LOOKUPS = argc > 3 ? atoi(argv[3]) : 1000000;
+
+        const Policy::Enum POLICIES[] = { Policy::e_FIFO,
+                                          Policy::e_LRU,
+                                          Policy::e_SLRU,
+                                          Policy::e_TINYLFU };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const Policy::Enum POLICY = POLICIES[ti];
+
+            double cacheRate = 0;
+            {
+                bdlcc::Cache<int, int> cache(POLICY,
+                                             k_NUM_KEYS * 2,
+                                             k_NUM_KEYS * 2);
+                cacheRate = measure(&cache,
+                                    k_NUM_THREADS,
+                                    k_NUM_KEYS,
+                                    k_NUM_LOOKUPS);
+            }
+
+            double shardedRate = 0;
+            {
+                Obj cache(POLICY, k_NUM_KEYS * 2, k_NUM_KEYS * 2);
+                shardedRate = measure(&cache,
+                                      k_NUM_THREADS,
+                                      k_NUM_KEYS,
+                                      k_NUM_LOOKUPS);
+            }
+
+            printf("%-10s threads: %d  Cache: %12.0f/s  "
+                   "ShardedCache: %12.0f/s  (x%.1f)\n",
+                   Policy::e_FIFO    == POLICY ? "FIFO"
+                   : Policy::e_LRU   == POLICY ? "LRU"
+                   : Policy::e_SLRU  == POLICY ? "SLRU"
+                   :                             "TINYLFU",
+                   k_NUM_THREADS,
+                   cacheRate,
+                   shardedRate,
+                   shardedRate / cacheRate);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
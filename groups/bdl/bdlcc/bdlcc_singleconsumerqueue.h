@@ -29,6 +29,14 @@ BSLS_IDENT("$Id: $")
 // provided.  The `tryPopFront` method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Batch variants of these methods are also provided: `pushBack` and
+// `tryPushBack` accepting an iterator range, and `popFront` and `tryPopFront`
+// accepting a maximum number of elements and a `bsl::vector` to which the
+// removed elements are appended.  A batch operation reserves elements in bulk
+// rather than one at a time, and wakes blocked threads once per batch rather
+// than once per element, amortizing the per-element synchronization cost when
+// elements are produced or consumed in bursts.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // `disablePushBack` method.  When disabled, `pushBack` and `tryPushBack` fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -169,6 +177,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_atomicoperations.h>
 
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
 namespace BloombergLP {
 namespace bdlcc {
 
@@ -240,6 +251,20 @@ class SingleConsumerQueue {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE* value);
 
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue and append them, in order, to the specified `buffer`.  If
+    /// the queue is empty, block until it is not empty.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`.  On failure, `buffer` is not
+    /// changed.  Threads blocked due to the queue being empty will return
+    /// `e_DISABLED` if `disablePopFront` is invoked.  The behavior is
+    /// undefined unless `0 < maxNumItems` and the invoker of this method is
+    /// the single consumer.  Note that the removed nodes are returned to the
+    /// producers with a single atomic operation.  Also note that `*buffer`
+    /// is not cleared -- the popped elements are appended after any
+    /// pre-existing contents.
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -252,6 +277,18 @@ class SingleConsumerQueue {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  On failure, a (possibly empty) prefix of the
+    /// range has been appended.  The behavior is undefined unless
+    /// `FORWARD_ITERATOR` meets the requirements of a forward iterator and
+    /// its value type is convertible to `TYPE`.  Note that nodes available
+    /// for reuse are reserved for the range with a single atomic operation,
+    /// and a blocked consumer is signalled at most once per reservation.
+    template <class FORWARD_ITERATOR>
+    int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -269,6 +306,18 @@ class SingleConsumerQueue {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumItems` elements from the
+    /// front of this queue without blocking, and, if successful, append the
+    /// removed elements, in order, to the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`, and `e_EMPTY` if
+    /// `!isPopFrontDisabled()` and the queue was empty.  On failure,
+    /// `buffer` is not changed.  The behavior is undefined unless
+    /// `0 < maxNumItems` and the invoker of this method is the single
+    /// consumer.  Note that `*buffer` is not cleared -- the popped elements
+    /// are appended after any pre-existing contents.
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -281,6 +330,15 @@ class SingleConsumerQueue {
     /// changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order, and return the number of
+    /// elements appended.  Note that fewer than `bsl::distance(begin, end)`
+    /// elements are appended only if `isPushBackDisabled()`.  The behavior
+    /// is undefined unless `FORWARD_ITERATOR` meets the requirements of a
+    /// forward iterator and its value type is convertible to `TYPE`.
+    template <class FORWARD_ITERATOR>
+    bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -372,6 +430,13 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFront(bsl::size_t        maxNumItems,
+                                        bsl::vector<TYPE> *buffer)
+{
+    return d_impl.popFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -384,6 +449,14 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITERATOR>
+int SingleConsumerQueue<TYPE>::pushBack(FORWARD_ITERATOR begin,
+                                        FORWARD_ITERATOR end)
+{
+    return d_impl.pushBack(begin, end);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -396,6 +469,13 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFront(bsl::size_t        maxNumItems,
+                                           bsl::vector<TYPE> *buffer)
+{
+    return d_impl.tryPopFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -408,6 +488,14 @@ int SingleConsumerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITERATOR>
+bsl::size_t SingleConsumerQueue<TYPE>::tryPushBack(FORWARD_ITERATOR begin,
+                                                   FORWARD_ITERATOR end)
+{
+    return d_impl.tryPushBack(begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -23,6 +23,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -81,12 +82,16 @@ using namespace bsl;
 // [ 5] SingleConsumerQueue(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -100,13 +105,15 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
 // [10] CONCERN: `popFront` and `tryPopFront` honor move-semantics
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
+// [13] CONCERN: batch operations
+// [-1] PERFORMANCE: per-item cost of batch operations
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -646,6 +653,77 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     s_continue = 0;
 }
 
+struct BatchData {
+    Obj *d_obj_p;      // queue under test
+    int  d_id;         // identifier of the pushing thread
+    int  d_numItems;   // number of items to push or pop
+    int  d_batchSize;  // maximum number of items per operation
+};
+
+/// Push `d_numItems` values to `d_obj_p` of the specified `arg`, which must
+/// be a `BatchData`, using `pushBack` on ranges of at most `d_batchSize`
+/// values.  The values pushed by thread `d_id` are
+/// `d_id * d_numItems + [0 .. d_numItems)`, in increasing order.
+extern "C" void *batchPush(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int value = data.d_id * data.d_numItems;
+    int end   = value + data.d_numItems;
+
+    while (value < end) {
+        values.clear();
+        while (value < end
+            && static_cast<int>(values.size()) < data.d_batchSize) {
+            values.push_back(value++);
+        }
+        ASSERT(e_SUCCESS == data.d_obj_p->pushBack(values.begin(),
+                                                   values.end()));
+    }
+
+    return 0;
+}
+
+/// Pop `d_numItems` values from `d_obj_p` of the specified `arg`, which
+/// must be a `BatchData`, using `popFront(TYPE *)`.
+extern "C" void *singlePop(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    int value;
+
+    for (int i = 0; i < data.d_numItems; ++i) {
+        ASSERT(e_SUCCESS == data.d_obj_p->popFront(&value));
+    }
+
+    return 0;
+}
+
+/// Pop `d_numItems` values from `d_obj_p` of the specified `arg`, which
+/// must be a `BatchData`, using `popFront` with a maximum of `d_batchSize`
+/// values per operation.
+extern "C" void *batchPop(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int numPopped = 0;
+
+    while (numPopped < data.d_numItems) {
+        values.clear();
+        ASSERT(e_SUCCESS == data.d_obj_p->popFront(data.d_batchSize,
+                                                   &values));
+        numPopped += static_cast<int>(values.size());
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -843,6 +921,201 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 13: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBack` and `tryPushBack` taking a range append the elements
+        //    of the range, in order, and `tryPushBack` returns the number of
+        //    elements appended.
+        //
+        // 2. `popFront` and `tryPopFront` taking a maximum number of items
+        //    remove at most that many elements, in order, and append them to
+        //    the supplied buffer without disturbing its existing contents.
+        //
+        // 3. `tryPopFront` returns `e_EMPTY` on an empty queue, and the
+        //    batch methods fail when the queue is disabled, leaving the
+        //    buffer unchanged.
+        //
+        // 4. Concurrent batch producers and a batch consumer transfer every
+        //    element exactly once, and the elements from one producer are
+        //    consumed in the order produced.
+        //
+        // 5. The batch methods work with allocating types and allocate
+        //    memory only from the object allocator.
+        //
+        // Plan:
+        // 1. Directly exercise the batch methods on a queue of `int` and
+        //    verify the results with the single-element methods and the
+        //    accessors.  (C-1..3)
+        //
+        // 2. Create several threads using `pushBack` on ranges while the main
+        //    thread uses `popFront` with a maximum number of items; verify
+        //    the consumed values.  (C-4)
+        //
+        // 3. Repeat a subset of P-1 with a queue of `bsl::string` using a
+        //    test allocator and verify the default allocator is unused.
+        //    (C-5)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+        //   int tryPopFront(bsl::size_t maxNumItems, vector<TYPE> *buffer);
+        //   bsl::size_t tryPushBack(FORWARD_ITERATOR, FORWARD_ITERATOR);
+        //   CONCERN: batch operations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: BATCH OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        const int DATA[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nDirect test of batch methods." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 3));
+            ASSERT(3 == X.numElements());
+
+            ASSERT(0 == mX.tryPushBack(DATA, DATA));
+            ASSERT(7 == mX.tryPushBack(DATA + 3, DATA + NUM_DATA));
+            ASSERT(10 == X.numElements());
+
+            bsl::vector<int> buffer(1, -1);
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(3, &buffer));
+            ASSERT(4 == buffer.size());
+            ASSERT(7 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFront(100, &buffer));
+            ASSERT(11 == buffer.size());
+            ASSERT(0 == X.numElements());
+
+            ASSERT(-1 == buffer[0]);
+            for (int i = 1; i < 11; ++i) {
+                ASSERTV(i, buffer[i], DATA[i - 1] == buffer[i]);
+            }
+
+            ASSERT(e_EMPTY == mX.tryPopFront(4, &buffer));
+            ASSERT(11 == buffer.size());
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 2));
+
+            buffer.clear();
+            ASSERT(e_SUCCESS == mX.popFront(1, &buffer));
+            ASSERT(1 == buffer.size() && DATA[0] == buffer[0]);
+
+            int value;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(DATA[1] == value);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBack(DATA, DATA + 2));
+            ASSERT(0 == mX.tryPushBack(DATA, DATA + 2));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            mX.pushBack(DATA, DATA + 2);
+
+            mX.disablePopFront();
+
+            buffer.clear();
+            ASSERT(e_DISABLED == mX.popFront(2, &buffer));
+            ASSERT(e_DISABLED == mX.tryPopFront(2, &buffer));
+            ASSERT(buffer.empty());
+            ASSERT(2 == X.numElements());
+        }
+
+        if (verbose) cout << "\nConcurrent batch producers." << endl;
+        {
+            enum { k_NUM_PUSHERS = 4, k_NUM_ITEMS = 10000 };
+
+            static const int BATCH_SIZES[] = { 1, 7, 64 };
+
+            for (int ti = 0; ti < 3; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                Obj mX;  const Obj& X = mX;
+
+                BatchData                 data[k_NUM_PUSHERS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_PUSHERS];
+
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    BatchData d = { &mX, i, k_NUM_ITEMS, BATCH_SIZE };
+
+                    data[i] = d;
+                    bslmt::ThreadUtil::create(&handles[i],
+                                              batchPush,
+                                              &data[i]);
+                }
+
+                bsl::vector<int> next(k_NUM_PUSHERS);
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    next[i] = i * k_NUM_ITEMS;
+                }
+
+                bsl::vector<int> buffer;
+                int              numPopped = 0;
+
+                while (numPopped < k_NUM_PUSHERS * k_NUM_ITEMS) {
+                    buffer.clear();
+                    ASSERT(e_SUCCESS == mX.popFront(BATCH_SIZE, &buffer));
+                    ASSERT(0 < buffer.size());
+                    ASSERT(static_cast<int>(buffer.size()) <= BATCH_SIZE);
+
+                    for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                        const int id = buffer[i] / k_NUM_ITEMS;
+
+                        ASSERTV(BATCH_SIZE, buffer[i], next[id] == buffer[i]);
+                        next[id] = buffer[i] + 1;
+                    }
+
+                    numPopped += static_cast<int>(buffer.size());
+                }
+
+                for (int i = 0; i < k_NUM_PUSHERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                ASSERT(0 == X.numElements());
+            }
+        }
+
+        if (verbose) cout << "\nAllocating type." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const char *LONG = "this string is long enough to allocate memory";
+
+            bsl::vector<bsl::string> values(&sa);
+            for (int i = 0; i < 5; ++i) {
+                values.push_back(bsl::string(LONG, &sa));
+            }
+
+            {
+                AllocObj mX(&sa);  const AllocObj& X = mX;
+
+                ASSERT(5 == mX.tryPushBack(values.begin(), values.end()));
+                ASSERT(5 == X.numElements());
+
+                bsl::vector<bsl::string> buffer(&sa);
+
+                ASSERT(e_SUCCESS == mX.popFront(2, &buffer));
+                ASSERT(2 == buffer.size());
+                ASSERT(LONG == buffer[1]);
+                ASSERT(&sa == buffer[1].get_allocator().mechanism());
+            }
+
+            ASSERT(0 == da.numBlocksTotal());
+        }
+      } break;
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2539,6 +2812,86 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PER-ITEM COST OF BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. Measure the cost per element of transferring elements from a
+        //    producer thread to a consumer thread using the single-element
+        //    methods and using the batch methods with batch sizes of 1, 16,
+        //    and 256.
+        //
+        // Plan:
+        // 1. For each batch size, transfer a fixed number of elements from a
+        //    thread using `pushBack` on ranges to a thread using `popFront`
+        //    with a maximum number of items, and report the elapsed wall time
+        //    per element.  Repeat with `pushBack(const TYPE&)` and
+        //    `popFront(TYPE *)` as a baseline.
+        //
+        // Testing:
+        //   PERFORMANCE: per-item cost of batch operations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PER-ITEM COST OF BATCH OPERATIONS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const int k_NUM_ITEMS = 1 << 22;
+
+        {
+            Obj mX;
+
+            BatchData data = { &mX, 0, k_NUM_ITEMS, 1 };
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, singlePop, &data);
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                mX.pushBack(i);
+            }
+
+            bslmt::ThreadUtil::join(handle);
+
+            timer.stop();
+
+            cout << "single:\t"
+                 << timer.accumulatedWallTime() * 1.0e9 / k_NUM_ITEMS
+                 << " ns/item" << endl;
+        }
+
+        static const int BATCH_SIZES[] = { 1, 16, 256 };
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int BATCH_SIZE = BATCH_SIZES[ti];
+
+            Obj mX;
+
+            BatchData pushData = { &mX, 0, k_NUM_ITEMS, BATCH_SIZE };
+            BatchData popData  = { &mX, 0, k_NUM_ITEMS, BATCH_SIZE };
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, batchPop, &popData);
+
+            batchPush(&pushData);
+
+            bslmt::ThreadUtil::join(handle);
+
+            timer.stop();
+
+            cout << "batch " << BATCH_SIZE << ":\t"
+                 << timer.accumulatedWallTime() * 1.0e9 / k_NUM_ITEMS
+                 << " ns/item" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -96,6 +96,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslalg_scalarprimitives.h>
 
+#include <bslma_destructorguard.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_movableref.h>
@@ -109,6 +110,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -183,6 +186,95 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
     ~SingleConsumerQueueImpl_PopCompleteGuard();
 };
 
+           // ===================================================
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ===================================================
+
+/// This class implements a guard that automatically invokes
+/// `popBatchComplete` on the managed queue upon destruction with the number
+/// of nodes consumed and the number of those nodes that were marked for
+/// reclamation.
+template <class TYPE>
+class SingleConsumerQueueImpl_PopBatchCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;       // managed queue
+    bsl::size_t  d_numNodes;      // number of nodes consumed
+    bsl::size_t  d_numReclaimed;  // number of consumed nodes reclaimed
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopBatchCompleteGuard();
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popBatchComplete` guard managing the specified `queue`.
+    explicit
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue);
+
+    /// Destroy this object and invoke the `popBatchComplete` method on the
+    /// managed queue.
+    ~SingleConsumerQueueImpl_PopBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate a node has been consumed.  If the specified `isReclaimed` is
+    /// `true`, the node was marked for reclamation.
+    void advance(bool isReclaimed);
+};
+
+          // ====================================================
+          // class SingleConsumerQueueImpl_PushBatchCompleteGuard
+          // ====================================================
+
+/// This class implements a guard that automatically invokes
+/// `pushBatchComplete` on the managed queue upon destruction with the
+/// sequence of reserved nodes that were not written and whether the consumer
+/// must be signalled.
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PushBatchCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;       // managed queue
+    NODE        *d_node_p;        // first reserved node not yet written
+    bsl::size_t  d_numRemaining;  // number of reserved nodes not yet written
+    bool         d_signal;        // if `true`, the consumer is blocked
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PushBatchCompleteGuard();
+    SingleConsumerQueueImpl_PushBatchCompleteGuard(
+                        const SingleConsumerQueueImpl_PushBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PushBatchCompleteGuard& operator=(
+                        const SingleConsumerQueueImpl_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushBatchComplete` guard managing the specified `numNodes`
+    /// reserved nodes, starting at the specified `node`, of the specified
+    /// `queue`.
+    SingleConsumerQueueImpl_PushBatchCompleteGuard(TYPE        *queue,
+                                                   NODE        *node,
+                                                   bsl::size_t  numNodes);
+
+    /// Destroy this object and invoke the `pushBatchComplete` method on the
+    /// managed queue.
+    ~SingleConsumerQueueImpl_PushBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate the first managed node has been written and made readable,
+    /// and that the specified `next` node is the first managed node not yet
+    /// written.  If the specified `signal` is `true`, the consumer was
+    /// blocked on the written node and must be signalled.  The behavior is
+    /// undefined unless a managed node remains to be written.
+    void advance(NODE *next, bool signal);
+};
+
              // ===============================================
              // class SingleConsumerQueueImpl_AllocateLockGuard
              // ===============================================
@@ -355,6 +447,22 @@ class SingleConsumerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                                          SingleConsumerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
+    friend class SingleConsumerQueueImpl_PushBatchCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     // PRIVATE CLASS METHODS
 
     /// Return the available attribute from the specified `state`.
@@ -362,6 +470,13 @@ class SingleConsumerQueueImpl {
 
     // PRIVATE MANIPULATORS
 
+    /// Reserve, without allocating, up to the specified `maxNumNodes`
+    /// consecutive nodes to assign the values being pushed into this queue,
+    /// load into the specified `first` a pointer to the first reserved node,
+    /// and return the number of nodes reserved.  Return 0, with no effect on
+    /// `first`, if no nodes are available for reuse.
+    bsl::size_t acquireNodes(bsl::size_t maxNumNodes, Node **first);
+
     /// If the specified `value` does not have its lowest-order bit set to
     /// the value of the specified `bitValue`, increment `value` until it
     /// does.  Note that this method is used to modify the generation counts
@@ -372,12 +487,43 @@ class SingleConsumerQueueImpl {
     /// Mark the specified `node` as a node to be reclaimed.
     void markReclaim(Node *node);
 
+    /// Make the specified `numNodes` consumed nodes, the specified
+    /// `numReclaimed` of which were marked for reclamation, available to
+    /// the producers, and if the queue is empty then signal the queue empty
+    /// condition.  This method is used by a guard within
+    /// `popFrontBatchHelper` to complete a batch of "pop" operations,
+    /// including in the presence of an exception.
+    void popBatchComplete(bsl::size_t numNodes, bsl::size_t numReclaimed);
+
     /// If the specified `destruct` is true, destruct the value stored in
     /// `d_nextRead`.  Mark `d_nextRead` writable, and if the queue is empty
     /// then signal the queue empty condition.  This method is used to
     /// complete the reclamation of a node in the presence of an exception.
     void popComplete(bool destruct);
 
+    /// Remove up to the specified `maxNumItems` readable elements from the
+    /// front of this queue, without blocking, append them to the specified
+    /// `buffer`, and return the number of elements removed.
+    bsl::size_t popFrontBatchHelper(bsl::size_t        maxNumItems,
+                                    bsl::vector<TYPE> *buffer);
+
+    /// Mark the specified `numNodes` consecutive nodes, starting at the
+    /// specified `node`, as nodes to be reclaimed, and, if the specified
+    /// `signal` is `true`, signal the blocked consumer.  This method is used
+    /// by a guard within `pushBackBatchHelper` to complete a batch of "push"
+    /// operations, including in the presence of an exception.
+    void pushBatchComplete(Node *node, bsl::size_t numNodes, bool signal);
+
+    /// Assign copies of the specified `count` elements starting at the
+    /// specified `*begin` to the `count` consecutive reserved nodes starting
+    /// at the specified `first`, make the nodes readable, signal the
+    /// consumer once if it is blocked, and advance `*begin` past the
+    /// assigned elements.
+    template <class FORWARD_ITERATOR>
+    void pushBackBatchHelper(FORWARD_ITERATOR *begin,
+                             Node             *first,
+                             bsl::size_t       count);
+
     /// Return a pointer to the node to assign the value being pushed into
     /// this queue, or 0 if `isPushBackDisabled()`.
     Node *pushBackHelper();
@@ -388,6 +534,14 @@ class SingleConsumerQueueImpl {
     /// locked state is set (i.e., `pushBackHelper`).
     void releaseAllocateLock();
 
+    /// Block until the node referenced by `d_nextRead` is readable,
+    /// reclaiming any nodes marked for reclamation, or until the value of
+    /// `d_popFrontDisabled` differs from the specified `generation`.  Return
+    /// 0 if the node is readable, and `e_DISABLED` otherwise.  The behavior
+    /// is undefined unless the invoker of this method is the single
+    /// consumer.
+    int waitUntilReadable(unsigned int generation);
+
     // NOT IMPLEMENTED
     SingleConsumerQueueImpl(const SingleConsumerQueueImpl&);
     SingleConsumerQueueImpl& operator=(const SingleConsumerQueueImpl&);
@@ -439,6 +593,20 @@ class SingleConsumerQueueImpl {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE *value);
 
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue and append them, in order, to the specified `buffer`.  If
+    /// the queue is empty, block until it is not empty.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`.  On failure, `buffer` is not
+    /// changed.  Threads blocked due to the queue being empty will return
+    /// `e_DISABLED` if `disablePopFront` is invoked.  The behavior is
+    /// undefined unless `0 < maxNumItems` and the invoker of this method is
+    /// the single consumer.  Note that the removed nodes are returned to the
+    /// producers with a single atomic operation.  Also note that `*buffer`
+    /// is not cleared -- the popped elements are appended after any
+    /// pre-existing contents.
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -451,6 +619,18 @@ class SingleConsumerQueueImpl {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  On failure, a (possibly empty) prefix of the
+    /// range has been appended.  The behavior is undefined unless
+    /// `FORWARD_ITERATOR` meets the requirements of a forward iterator and
+    /// its value type is convertible to `TYPE`.  Note that nodes available
+    /// for reuse are reserved for the range with a single atomic operation,
+    /// and a blocked consumer is signalled at most once per reservation.
+    template <class FORWARD_ITERATOR>
+    int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -468,6 +648,18 @@ class SingleConsumerQueueImpl {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumItems` elements from the
+    /// front of this queue without blocking, and, if successful, append the
+    /// removed elements, in order, to the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`, and `e_EMPTY` if
+    /// `!isPopFrontDisabled()` and the queue was empty.  On failure,
+    /// `buffer` is not changed.  The behavior is undefined unless
+    /// `0 < maxNumItems` and the invoker of this method is the single
+    /// consumer.  Note that `*buffer` is not cleared -- the popped elements
+    /// are appended after any pre-existing contents.
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, retun
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -480,6 +672,15 @@ class SingleConsumerQueueImpl {
     /// changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order, and return the number of
+    /// elements appended.  Note that fewer than `bsl::distance(begin, end)`
+    /// elements are appended only if `isPushBackDisabled()`.  The behavior
+    /// is undefined unless `FORWARD_ITERATOR` meets the requirements of a
+    /// forward iterator and its value type is convertible to `TYPE`.
+    template <class FORWARD_ITERATOR>
+    bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -592,6 +793,77 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+           // ---------------------------------------------------
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                     SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numNodes(0)
+, d_numReclaimed(0)
+{
+}
+
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                               ~SingleConsumerQueueImpl_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_numNodes, d_numReclaimed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::advance(
+                                                              bool isReclaimed)
+{
+    ++d_numNodes;
+    if (isReclaimed) {
+        ++d_numReclaimed;
+    }
+}
+
+          // ----------------------------------------------------
+          // class SingleConsumerQueueImpl_PushBatchCompleteGuard
+          // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::
+        SingleConsumerQueueImpl_PushBatchCompleteGuard(TYPE        *queue,
+                                                       NODE        *node,
+                                                       bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numRemaining(numNodes)
+, d_signal(false)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::
+                              ~SingleConsumerQueueImpl_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_node_p, d_numRemaining, d_signal);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::advance(
+                                                                  NODE *next,
+                                                                  bool  signal)
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    d_node_p = next;
+    --d_numRemaining;
+    d_signal = d_signal || signal;
+}
+
           // ------------------------------------------------------
           // class SingleConsumerQueueImpl_AllocateLockGuardProctor
           // ------------------------------------------------------
@@ -624,6 +896,66 @@ bsls::Types::Int64 SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                         ::acquireNodes(bsl::size_t maxNumNodes, Node **first)
+{
+    // Reserve as many of the available nodes as are needed (up to
+    // 'maxNumNodes') and indicate a thread is intending to use existing nodes
+    // ('k_USE_INC'), as in the fast path of 'pushBackHelper'.  While the use
+    // indication is present, an allocation can not begin and the sequence of
+    // nodes starting at 'd_nextWrite' is stable.
+
+    bsls::Types::Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 count;
+
+    do {
+        expState = state;
+
+        count = available(state);
+
+        if (0 >= count || 0 != (state & k_ALLOCATE_MASK)) {
+            return 0;                                                 // RETURN
+        }
+
+        if (static_cast<bsls::Types::Int64>(maxNumNodes) < count) {
+            count = static_cast<bsls::Types::Int64>(maxNumNodes);
+        }
+
+        state = ATOMIC_OP::testAndSwapInt64AcqRel(
+                                        &d_state,
+                                        state,
+                                        state + k_USE_INC
+                                              - k_AVAILABLE_INC * count);
+    } while (state != expState);
+
+    Node *nextWrite =
+                   static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsls::Types::Int64 i = 0; i < count; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    *first = nextWrite;
+
+    return static_cast<bsl::size_t>(count);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -660,6 +992,30 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+          ::popBatchComplete(bsl::size_t numNodes, bsl::size_t numReclaimed)
+{
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    ATOMIC_OP::addInt64AcqRel(&d_capacity,
+                              static_cast<bsls::Types::Int64>(numReclaimed));
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                        &d_state,
+                        k_AVAILABLE_INC * static_cast<bsls::Types::Int64>(
+                                                                    numNodes));
+
+    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                                                    ::popComplete(bool destruct)
@@ -687,6 +1043,113 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                     ::popFrontBatchHelper(bsl::size_t        maxNumItems,
+                                           bsl::vector<TYPE> *buffer)
+{
+    // The consumed nodes are marked writable, and 'd_nextRead' advanced,
+    // before the value is removed from the node.  This is safe since a
+    // producer can not write to a node until it is made available in
+    // 'd_state' (by the guard's invocation of 'popBatchComplete'), and
+    // ensures a node is consumed even if removing the value throws.
+
+    SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                              SingleConsumerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+    bsl::size_t numPopped = 0;
+
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+    while (   numPopped < maxNumItems
+           && (e_READABLE == nodeState || e_RECLAIM == nodeState)) {
+        Node *node = nextRead;
+
+        nextRead =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+        ATOMIC_OP::setIntRelease(&node->d_state, e_WRITABLE);
+        ATOMIC_OP::setPtrRelease(&d_nextRead, nextRead);
+
+        guard.advance(e_RECLAIM == nodeState);
+
+        if (e_READABLE == nodeState) {
+            bslma::DestructorGuard<TYPE> valueGuard(&node->d_value.object());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            buffer->push_back(bslmf::MovableRefUtil::move(
+                                                     node->d_value.object()));
+#else
+            buffer->push_back(node->d_value.object());
+#endif
+
+            ++numPopped;
+        }
+
+        nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+    }
+
+    return numPopped;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+          ::pushBatchComplete(Node *node, bsl::size_t numNodes, bool signal)
+{
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+        Node *next =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+        markReclaim(node);
+        node = next;
+    }
+
+    if (signal) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITERATOR>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                           ::pushBackBatchHelper(FORWARD_ITERATOR *begin,
+                                                 Node             *first,
+                                                 bsl::size_t       count)
+{
+    SingleConsumerQueueImpl_PushBatchCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this, first, count);
+
+    Node *node = first;
+    for (bsl::size_t i = 0; i < count; ++i, ++*begin) {
+        bslalg::ScalarPrimitives::construct(node->d_value.address(),
+                                            **begin,
+                                            allocator());
+
+        // Obtain the next node before the written node is made readable,
+        // after which the node may be consumed and reused.
+
+        Node *next =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+        int nodeState = ATOMIC_OP::swapIntAcqRel(&node->d_state, e_READABLE);
+
+        guard.advance(next, e_WRITABLE_AND_BLOCKED == nodeState);
+
+        node = next;
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
                      SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -843,6 +1306,52 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     ATOMIC_OP::addInt64AcqRel(&d_state, -k_ALLOCATE_INC);
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                ::waitUntilReadable(unsigned int generation)
+{
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+    do {
+        // Note that 'e_WRITABLE_AND_BLOCKED != nodeState' since if the one
+        // consumer sets this state, the one consumer waits until the node is
+        // readable, and either the producer that signalled the consumer
+        // changed the node state already, or the consumer will change the node
+        // state in 'popComplete'.
+
+        if (e_WRITABLE == nodeState) {
+            bslmt::ThreadUtil::yield();
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+            if (e_WRITABLE == nodeState) {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
+                                                     e_WRITABLE_AND_BLOCKED);
+                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        ATOMIC_OP::testAndSwapIntAcqRel(&nextRead->d_state,
+                                                        e_WRITABLE_AND_BLOCKED,
+                                                        e_WRITABLE);
+                        return e_DISABLED;                            // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+                }
+            }
+        }
+        if (e_RECLAIM == nodeState) {
+            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
+            popComplete(false);
+            nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+        }
+    } while (e_RECLAIM == nodeState);
+
+    return 0;
+}
+
 // CREATORS
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
@@ -945,44 +1454,13 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
         return e_DISABLED;                                            // RETURN
     }
 
-    Node *nextRead =
-                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
-    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-    do {
-        // Note that 'e_WRITABLE_AND_BLOCKED != nodeState' since if the one
-        // consumer sets this state, the one consumer waits until the node is
-        // readable, and either the producer that signalled the consumer
-        // changed the node state already, or the consumer will change the node
-        // state in 'popComplete'.
+    int rv = waitUntilReadable(generation);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
 
-        if (e_WRITABLE == nodeState) {
-            bslmt::ThreadUtil::yield();
-            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-            if (e_WRITABLE == nodeState) {
-                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
-                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
-                                                     e_WRITABLE_AND_BLOCKED);
-                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
-                    if (generation !=
-                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
-                        ATOMIC_OP::testAndSwapIntAcqRel(&nextRead->d_state,
-                                                        e_WRITABLE_AND_BLOCKED,
-                                                        e_WRITABLE);
-                        return e_DISABLED;                            // RETURN
-                    }
-                    d_readCondition.wait(&d_readMutex);
-                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-                }
-            }
-        }
-        if (e_RECLAIM == nodeState) {
-            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
-            popComplete(false);
-            nextRead =
+    Node *nextRead =
                     static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
-            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-        }
-    } while (e_RECLAIM == nodeState);
 
     SingleConsumerQueueImpl_PopCompleteGuard<
                               SingleConsumerQueueImpl<TYPE,
@@ -999,6 +1477,29 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    int rv = waitUntilReadable(generation);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    popFrontBatchHelper(maxNumItems, buffer);
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1068,6 +1569,17 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITERATOR>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
+                                                       FORWARD_ITERATOR begin,
+                                                       FORWARD_ITERATOR end)
+{
+    bsl::size_t length = static_cast<bsl::size_t>(bsl::distance(begin, end));
+
+    return length == tryPushBack(begin, end) ? 0 : e_DISABLED;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1141,6 +1653,26 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (0 == popFrontBatchHelper(maxNumItems, buffer)) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -1155,6 +1687,44 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITERATOR>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                ::tryPushBack(FORWARD_ITERATOR begin,
+                                              FORWARD_ITERATOR end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t remaining = static_cast<bsl::size_t>(
+                                                   bsl::distance(begin, end));
+    bsl::size_t numPushed = 0;
+
+    while (0 < remaining) {
+        Node        *first;
+        bsl::size_t  count = acquireNodes(remaining, &first);
+
+        if (0 == count) {
+            // No nodes are available for reuse; 'pushBackHelper' will
+            // allocate additional nodes.
+
+            first = pushBackHelper();
+            if (0 == first) {
+                break;
+            }
+            count = 1;
+        }
+
+        pushBackBatchHelper(&begin, first, count);
+
+        remaining -= count;
+        numPushed += count;
+    }
+
+    return numPushed;
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -75,6 +75,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
+#include <bslma_destructorguard.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_movableref.h>
@@ -88,6 +89,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -166,6 +169,93 @@ class SingleProducerQueueImpl_PopCompleteGuard {
     ~SingleProducerQueueImpl_PopCompleteGuard();
 };
 
+           // ===================================================
+           // class SingleProducerQueueImpl_PopBatchCompleteGuard
+           // ===================================================
+
+/// This class implements a guard that automatically invokes
+/// `popBatchComplete` upon destruction with the sequence of reserved nodes
+/// that were not consumed.
+template <class TYPE, class NODE>
+class SingleProducerQueueImpl_PopBatchCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;       // managed queue owning the managed nodes
+    NODE        *d_node_p;        // first reserved node not yet consumed
+    bsl::size_t  d_numRemaining;  // number of reserved nodes not consumed
+    bool         d_isEmpty;       // if true, the empty condition will be
+                                  // signalled
+
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_PopBatchCompleteGuard();
+    SingleProducerQueueImpl_PopBatchCompleteGuard(
+                         const SingleProducerQueueImpl_PopBatchCompleteGuard&);
+    SingleProducerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleProducerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popBatchComplete` guard managing the specified `numNodes`
+    /// reserved nodes, starting at the specified `node`, of the specified
+    /// `queue` that will cause the empty condition to be signalled if the
+    /// specified `isEmpty` is `true`.
+    SingleProducerQueueImpl_PopBatchCompleteGuard(TYPE        *queue,
+                                                  NODE        *node,
+                                                  bsl::size_t  numNodes,
+                                                  bool         isEmpty);
+
+    /// Destroy this object and invoke the `TYPE::popBatchComplete` method
+    /// with the managed nodes.
+    ~SingleProducerQueueImpl_PopBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate the first managed node has been consumed, and that the
+    /// specified `next` node is the first managed node not yet consumed.
+    /// The behavior is undefined unless a managed node remains to be
+    /// consumed.
+    void advance(NODE *next);
+};
+
+           // ====================================================
+           // class SingleProducerQueueImpl_PushBatchCompleteGuard
+           // ====================================================
+
+/// This class implements a guard that automatically invokes
+/// `pushBatchComplete` on the managed queue upon destruction with the number
+/// of elements written.
+template <class TYPE>
+class SingleProducerQueueImpl_PushBatchCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;     // managed queue
+    bsl::size_t  d_numPushed;   // number of elements written
+
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_PushBatchCompleteGuard();
+    SingleProducerQueueImpl_PushBatchCompleteGuard(
+                        const SingleProducerQueueImpl_PushBatchCompleteGuard&);
+    SingleProducerQueueImpl_PushBatchCompleteGuard& operator=(
+                        const SingleProducerQueueImpl_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushBatchComplete` guard managing the specified `queue`.
+    explicit
+    SingleProducerQueueImpl_PushBatchCompleteGuard(TYPE *queue);
+
+    /// Destroy this object and invoke the `pushBatchComplete` method on the
+    /// managed queue.
+    ~SingleProducerQueueImpl_PushBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate an element has been written.
+    void advance();
+};
+
                       // =============================
                       // class SingleProducerQueueImpl
                       // =============================
@@ -270,6 +360,22 @@ class SingleProducerQueueImpl {
                                                             MUTEX,
                                                             CONDITION>::Node >;
 
+    friend class SingleProducerQueueImpl_PopBatchCompleteGuard<
+                           SingleProducerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleProducerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
+    friend class SingleProducerQueueImpl_PushBatchCompleteGuard<
+                                          SingleProducerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
     // PRIVATE CLASS METHODS
 
     /// Return `true` if the specified `state` implies all elements in the
@@ -299,6 +405,20 @@ class SingleProducerQueueImpl {
 
     // PRIVATE MANIPULATORS
 
+    /// Reserve, without blocking, up to the specified `maxNumItems` elements
+    /// of this queue that are not needed by threads blocked in a dequeue
+    /// operation, load into the specified `state` the resulting value of
+    /// `d_state`, and return the number of elements reserved.
+    bsl::size_t acquireAvailable(bsl::size_t         maxNumItems,
+                                 bsls::Types::Int64 *state);
+
+    /// Reserve an element of this queue, blocking until an element is
+    /// available or until the value of `d_popFrontDisabled` differs from the
+    /// specified `generation`, and load into the specified `state` the
+    /// resulting value of `d_state`.  Return 0 if an element was reserved,
+    /// and `e_DISABLED` otherwise.
+    int acquireElement(unsigned int generation, bsls::Types::Int64 *state);
+
     /// If the specified `value` does not have its lowest-order bit set to
     /// the value of the specified `bitValue`, increment `value` until it
     /// does.  Note that this method is used to modify the generation counts
@@ -313,12 +433,34 @@ class SingleProducerQueueImpl {
     /// exception.
     void popComplete(Node *node, bool isEmpty);
 
+    /// Destruct the values stored in the specified `numNodes` consecutive
+    /// nodes starting at the specified `node`, mark the nodes writable, and
+    /// if the specified `isEmpty` is `true` then signal the queue empty
+    /// condition.  This method is used within `popFrontBatchRaw` by a guard
+    /// to complete a batch of "pop" operations, including in the presence of
+    /// an exception.
+    void popBatchComplete(Node *node, bsl::size_t numNodes, bool isEmpty);
+
+    /// Remove the specified `count` elements, without verifying the
+    /// availability of the elements, from the front of this queue, append
+    /// them to the specified `buffer`, and if the specified `isEmpty` is
+    /// `true` then signal the queue empty condition.
+    void popFrontBatchRaw(bsl::size_t        count,
+                          bsl::vector<TYPE> *buffer,
+                          bool               isEmpty);
+
     /// Remove the element, without verifying the availability of the
     /// element, from the front of this queue, load that element into the
     /// specified `value`, and if the specified `isEmpty` is `true` then
     /// signal the queue empty condition.
     void popFrontRaw(TYPE* value, bool isEmpty);
 
+    /// Make the specified `numPushed` written elements available to the
+    /// consumers, and signal a blocked consumer if appropriate.  This method
+    /// is used by a guard within `tryPushBack` to complete a batch of "push"
+    /// operations, including in the presence of an exception.
+    void pushBatchComplete(bsl::size_t numPushed);
+
     /// Return all memory to the allocator.  This method is intended to be
     /// used by the destructor and to avoid a memory leak when there is an
     /// exception during construction.
@@ -371,6 +513,19 @@ class SingleProducerQueueImpl {
     /// `e_DISABLED` if `disablePopFront` is invoked.
     int popFront(TYPE *value);
 
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue and append them, in order, to the specified `buffer`.  If
+    /// the queue is empty, block until it is not empty.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`.  On failure, `buffer` is not
+    /// changed.  Threads blocked due to the queue being empty will return
+    /// `e_DISABLED` if `disablePopFront` is invoked.  The behavior is
+    /// undefined unless `0 < maxNumItems`.  Note that the elements are
+    /// reserved with a single atomic operation.  Also note that `*buffer` is
+    /// not cleared -- the popped elements are appended after any
+    /// pre-existing contents.
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -385,6 +540,19 @@ class SingleProducerQueueImpl {
     /// method is the single producer.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  On failure, no elements have been appended.
+    /// The behavior is undefined unless the invoker of this method is the
+    /// single producer, `FORWARD_ITERATOR` meets the requirements of a
+    /// forward iterator, and its value type is convertible to `TYPE`.  Note
+    /// that the appended elements are made available to the consumers with a
+    /// single atomic operation, and a blocked consumer is signalled at most
+    /// once.
+    template <class FORWARD_ITERATOR>
+    int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -399,6 +567,17 @@ class SingleProducerQueueImpl {
     /// the queue was empty.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumItems` elements from the
+    /// front of this queue without blocking, and, if successful, append the
+    /// removed elements, in order, to the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value otherwise.  Specifically, return
+    /// `e_DISABLED` if `isPopFrontDisabled()`, and `e_EMPTY` if
+    /// `!isPopFrontDisabled()` and the queue was empty.  On failure,
+    /// `buffer` is not changed.  The behavior is undefined unless
+    /// `0 < maxNumItems`.  Note that `*buffer` is not cleared -- the popped
+    /// elements are appended after any pre-existing contents.
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -413,6 +592,16 @@ class SingleProducerQueueImpl {
     /// method is the single producer.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append copies of the elements in the specified range `[begin .. end)`
+    /// to the back of this queue, in order, and return the number of
+    /// elements appended.  Note that 0 is returned if
+    /// `isPushBackDisabled()`.  The behavior is undefined unless the invoker
+    /// of this method is the single producer, `FORWARD_ITERATOR` meets the
+    /// requirements of a forward iterator, and its value type is convertible
+    /// to `TYPE`.
+    template <class FORWARD_ITERATOR>
+    bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -528,6 +717,71 @@ SingleProducerQueueImpl_PopCompleteGuard<TYPE, NODE>::
     d_queue_p->popComplete(d_node_p, d_isEmpty);
 }
 
+           // ---------------------------------------------------
+           // class SingleProducerQueueImpl_PopBatchCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleProducerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+          SingleProducerQueueImpl_PopBatchCompleteGuard(TYPE        *queue,
+                                                        NODE        *node,
+                                                        bsl::size_t  numNodes,
+                                                        bool         isEmpty)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numRemaining(numNodes)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE, class NODE>
+SingleProducerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+                               ~SingleProducerQueueImpl_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_node_p, d_numRemaining, d_isEmpty);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleProducerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::advance(
+                                                                    NODE *next)
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    d_node_p = next;
+    --d_numRemaining;
+}
+
+           // ----------------------------------------------------
+           // class SingleProducerQueueImpl_PushBatchCompleteGuard
+           // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::
+                    SingleProducerQueueImpl_PushBatchCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::
+                              ~SingleProducerQueueImpl_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::advance()
+{
+    ++d_numPushed;
+}
+
                       // -----------------------------
                       // class SingleProducerQueueImpl
                       // -----------------------------
@@ -583,6 +837,84 @@ bool SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                          acquireAvailable(bsl::size_t         maxNumItems,
+                                           bsls::Types::Int64 *state)
+{
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 count;
+
+    *state = ATOMIC_OP::getInt64Acquire(&d_state);
+
+    do {
+        // Elements needed by threads blocked in a dequeue operation are not
+        // available (see 'tryPopFront').
+
+        expState = *state;
+
+        count = getAvailable(*state) - (*state & k_BLOCKED_MASK);
+
+        if (0 >= count) {
+            return 0;                                                 // RETURN
+        }
+
+        if (static_cast<bsls::Types::Int64>(maxNumItems) < count) {
+            count = static_cast<bsls::Types::Int64>(maxNumItems);
+        }
+
+        *state = ATOMIC_OP::testAndSwapInt64AcqRel(
+                                             &d_state,
+                                             *state,
+                                             *state - k_AVAILABLE_INC * count);
+    } while (*state != expState);
+
+    *state -= k_AVAILABLE_INC * count;
+
+    return static_cast<bsl::size_t>(count);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                acquireElement(unsigned int        generation,
+                                               bsls::Types::Int64 *state)
+{
+    *state = ATOMIC_OP::addInt64NvAcqRel(&d_state, -k_AVAILABLE_INC);
+
+    if (willHaveBlockedThread(*state)) {
+        bslmt::ThreadUtil::yield();
+        *state = ATOMIC_OP::getInt64Acquire(&d_state);
+        if (willHaveBlockedThread(*state)) {
+            {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+
+                *state = ATOMIC_OP::addInt64NvAcqRel(
+                                              &d_state,
+                                              k_AVAILABLE_INC + k_BLOCKED_INC);
+
+                while (isEmpty(*state)) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        ATOMIC_OP::addInt64AcqRel(&d_state, -k_BLOCKED_INC);
+                        return e_DISABLED;                            // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    *state = ATOMIC_OP::getInt64Acquire(&d_state);
+                }
+
+                *state = ATOMIC_OP::addInt64NvAcqRel(
+                                           &d_state,
+                                           -(k_AVAILABLE_INC + k_BLOCKED_INC));
+            }
+            if (canSupplyBlockedThread(*state)) {
+                d_readCondition.signal();
+            }
+        }
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -616,6 +948,88 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                      popBatchComplete(Node        *node,
+                                                       bsl::size_t  numNodes,
+                                                       bool         isEmpty)
+{
+    // If an exception occurred while consuming the batch, the values that
+    // were not consumed are discarded.
+
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+        Node *next =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+        popComplete(node, false);
+
+        node = next;
+    }
+
+    if (isEmpty) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                 popFrontBatchRaw(bsl::size_t        count,
+                                                  bsl::vector<TYPE> *buffer,
+                                                  bool               isEmpty)
+{
+    // Claim the 'count' nodes starting at 'd_nextRead' with a single update
+    // to 'd_nextRead'.  The links between the reserved nodes can not be
+    // modified by the producer until the nodes are marked writable.
+
+    Node *readFrom =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+    Node *exp;
+    do {
+        Node *next = readFrom;
+        for (bsl::size_t i = 0; i < count; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        exp      = readFrom;
+        readFrom = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                   &d_nextRead,
+                                                                   readFrom,
+                                                                   next));
+    } while (readFrom != exp);
+
+    SingleProducerQueueImpl_PopBatchCompleteGuard<
+                             SingleProducerQueueImpl<TYPE,
+                                                     ATOMIC_OP,
+                                                     MUTEX,
+                                                     CONDITION>,
+                             Node> guard(this, readFrom, count, isEmpty);
+
+    buffer->reserve(buffer->size() + count);
+
+    for (bsl::size_t i = 0; i < count; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        buffer->push_back(bslmf::MovableRefUtil::move(
+                                                 readFrom->d_value.object()));
+#else
+        buffer->push_back(readFrom->d_value.object());
+#endif
+
+        Node *next =
+              static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&readFrom->d_next));
+
+        popComplete(readFrom, false);
+
+        guard.advance(next);
+
+        readFrom = next;
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
                                           popFrontRaw(TYPE *value,
@@ -650,6 +1064,33 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 #endif
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                      pushBatchComplete(bsl::size_t numPushed)
+{
+    if (0 == numPushed) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 count =
+                                   static_cast<bsls::Types::Int64>(numPushed);
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                      &d_state,
+                                                      k_AVAILABLE_INC * count);
+
+    // Signal a blocked thread only if the elements became available due to
+    // this batch; the signalled thread will signal further blocked threads
+    // if additional elements are available (see 'popFront').
+
+    if (canSupplyBlockedThread(state) && getAvailable(state) <= count) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
                                                                 releaseAllRaw()
@@ -792,41 +1233,44 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
         return e_DISABLED;                                            // RETURN
     }
 
-    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
-                                                           -k_AVAILABLE_INC);
+    bsls::Types::Int64 state;
 
-    if (willHaveBlockedThread(state)) {
-        bslmt::ThreadUtil::yield();
-        state = ATOMIC_OP::getInt64Acquire(&d_state);
-        if (willHaveBlockedThread(state)) {
-            {
-                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+    int rv = acquireElement(generation, &state);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
 
-                state = ATOMIC_OP::addInt64NvAcqRel(
-                                              &d_state,
-                                              k_AVAILABLE_INC + k_BLOCKED_INC);
+    popFrontRaw(value, isEmpty(state));
 
-                while (isEmpty(state)) {
-                    if (generation !=
-                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
-                        ATOMIC_OP::addInt64AcqRel(&d_state, -k_BLOCKED_INC);
-                        return e_DISABLED;                            // RETURN
-                    }
-                    d_readCondition.wait(&d_readMutex);
-                    state = ATOMIC_OP::getInt64Acquire(&d_state);
-                }
+    return 0;
+}
 
-                state = ATOMIC_OP::addInt64NvAcqRel(
-                                           &d_state,
-                                           -(k_AVAILABLE_INC + k_BLOCKED_INC));
-            }
-            if (canSupplyBlockedThread(state)) {
-                d_readCondition.signal();
-            }
-        }
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
     }
 
-    popFrontRaw(value, isEmpty(state));
+    bsls::Types::Int64 state;
+
+    int rv = acquireElement(generation, &state);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    bsl::size_t count = 1;
+    if (1 < maxNumItems) {
+        count += acquireAvailable(maxNumItems - 1, &state);
+    }
+
+    popFrontBatchRaw(count, buffer, isEmpty(state));
 
     return 0;
 }
@@ -922,6 +1366,21 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITERATOR>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
+                                                       FORWARD_ITERATOR begin,
+                                                       FORWARD_ITERATOR end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    tryPushBack(begin, end);
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
                                                                    TYPE *value)
@@ -965,6 +1424,31 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsls::Types::Int64 state;
+
+    bsl::size_t count = acquireAvailable(maxNumItems, &state);
+    if (0 == count) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    popFrontBatchRaw(count, buffer, isEmpty(state));
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -979,6 +1463,63 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITERATOR>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                          tryPushBack(FORWARD_ITERATOR begin,
+                                                      FORWARD_ITERATOR end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    // The elements are written, and 'd_nextWrite' advanced, exactly as in
+    // 'pushBack', but the elements are made available to the consumers (in
+    // 'd_state') once, by the guard, after all elements are written.
+
+    SingleProducerQueueImpl_PushBatchCompleteGuard<
+                              SingleProducerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+    bsl::size_t numPushed = 0;
+
+    Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+    for (; begin != end; ++begin) {
+        Node *next = static_cast<Node *>(
+                                 ATOMIC_OP::getPtrAcquire(&nextWrite->d_next));
+
+        if (e_WRITABLE != ATOMIC_OP::getIntAcquire(&next->d_state)) {
+            Node *n = static_cast<Node *>(
+                                       d_allocator_p->allocate(sizeof(Node)));
+
+            ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
+            ATOMIC_OP::initPointer(&n->d_next, next);
+
+            ATOMIC_OP::setPtrRelease(&nextWrite->d_next, n);
+
+            next = n;
+        }
+
+        bslalg::ScalarPrimitives::construct(nextWrite->d_value.address(),
+                                            *begin,
+                                            d_allocator_p);
+
+        ATOMIC_OP::setIntRelease(&nextWrite->d_state, e_READABLE);
+        ATOMIC_OP::setPtrRelease(&d_nextWrite, next);
+
+        guard.advance();
+        ++numPushed;
+
+        nextWrite = next;
+    }
+
+    return numPushed;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -78,12 +78,16 @@ using namespace bsl;
 // [ 5] SingleProducerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleProducerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [14] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [14] int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [14] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [14] bsl::size_t tryPushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -104,6 +108,7 @@ using namespace bsl;
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
 // [13] CONCERN: `numElements` is not lower-bound due to `tryPopFront`
+// [14] CONCERN: batch operations
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -956,6 +961,75 @@ extern "C" void *tryPopFront(void *arg)
 
 } // close namespace Case13
 
+struct BatchData {
+    Obj             *d_obj_p;      // queue under test
+    int              d_id;         // identifier of the pushing thread
+    int              d_numItems;   // number of items to push or pop
+    int              d_batchSize;  // maximum number of items per operation
+    bsls::AtomicInt *d_count_p;    // number of items popped
+};
+
+/// Push `d_numItems` values to `d_obj_p` of the specified `arg`, which must
+/// be a `BatchData`, using `pushBack` on ranges of at most `d_batchSize`
+/// values.  The values pushed by thread `d_id` are
+/// `d_id * d_numItems + [0 .. d_numItems)`, in increasing order.
+extern "C" void *batchPush(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int value = data.d_id * data.d_numItems;
+    int end   = value + data.d_numItems;
+
+    while (value < end) {
+        values.clear();
+        while (value < end
+            && static_cast<int>(values.size()) < data.d_batchSize) {
+            values.push_back(value++);
+        }
+        ASSERT(e_SUCCESS == data.d_obj_p->pushBack(values.begin(),
+                                                   values.end()));
+    }
+
+    return 0;
+}
+
+/// Pop values from `d_obj_p` of the specified `arg`, which must be a
+/// `BatchData`, using `popFront` with a maximum of `d_batchSize` values per
+/// operation until the queue is dequeue disabled, verify the values are
+/// popped in increasing order, and add the number of values popped to
+/// `*d_count_p`.
+extern "C" void *batchPopUntilDisabled(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+
+    bsl::vector<int> values;
+    values.reserve(data.d_batchSize);
+
+    int last = -1;
+
+    while (true) {
+        values.clear();
+        if (e_SUCCESS != data.d_obj_p->popFront(data.d_batchSize, &values)) {
+            break;
+        }
+
+        ASSERT(0 < values.size());
+        ASSERT(static_cast<int>(values.size()) <= data.d_batchSize);
+
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            ASSERTV(last, values[i], last < values[i]);
+            last = values[i];
+        }
+
+        data.d_count_p->add(static_cast<int>(values.size()));
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1078,6 +1152,187 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBack` and `tryPushBack` taking a range append the elements
+        //    of the range, in order, and `tryPushBack` returns the number of
+        //    elements appended.
+        //
+        // 2. `popFront` and `tryPopFront` taking a maximum number of items
+        //    remove at most that many elements, in order, and append them to
+        //    the supplied buffer without disturbing its existing contents.
+        //
+        // 3. `tryPopFront` returns `e_EMPTY` on an empty queue, and the
+        //    batch methods fail when the queue is disabled, leaving the
+        //    buffer unchanged.
+        //
+        // 4. A batch producer and concurrent batch consumers transfer every
+        //    element exactly once, and each consumer observes the elements
+        //    in the order produced.
+        //
+        // 5. The batch methods work with allocating types and allocate
+        //    memory only from the object allocator.
+        //
+        // Plan:
+        // 1. Directly exercise the batch methods on a queue of `int` and
+        //    verify the results with the single-element methods and the
+        //    accessors.  (C-1..3)
+        //
+        // 2. Create several threads using `popFront` with a maximum number
+        //    of items while the main thread uses `pushBack` on ranges; verify
+        //    the consumed values.  (C-4)
+        //
+        // 3. Repeat a subset of P-1 with a queue of `bsl::string` using a
+        //    test allocator and verify the default allocator is unused.
+        //    (C-5)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
+        //   int tryPopFront(bsl::size_t maxNumItems, vector<TYPE> *buffer);
+        //   bsl::size_t tryPushBack(FORWARD_ITERATOR, FORWARD_ITERATOR);
+        //   CONCERN: batch operations
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: BATCH OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        const int DATA[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nDirect test of batch methods." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 3));
+            ASSERT(3 == X.numElements());
+
+            ASSERT(0 == mX.tryPushBack(DATA, DATA));
+            ASSERT(7 == mX.tryPushBack(DATA + 3, DATA + NUM_DATA));
+            ASSERT(10 == X.numElements());
+
+            bsl::vector<int> buffer(1, -1);
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(3, &buffer));
+            ASSERT(4 == buffer.size());
+            ASSERT(7 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFront(100, &buffer));
+            ASSERT(11 == buffer.size());
+            ASSERT(0 == X.numElements());
+
+            ASSERT(-1 == buffer[0]);
+            for (int i = 1; i < 11; ++i) {
+                ASSERTV(i, buffer[i], DATA[i - 1] == buffer[i]);
+            }
+
+            ASSERT(e_EMPTY == mX.tryPopFront(4, &buffer));
+            ASSERT(11 == buffer.size());
+
+            ASSERT(e_SUCCESS == mX.pushBack(DATA, DATA + 2));
+
+            buffer.clear();
+            ASSERT(e_SUCCESS == mX.popFront(1, &buffer));
+            ASSERT(1 == buffer.size() && DATA[0] == buffer[0]);
+
+            int value;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(DATA[1] == value);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBack(DATA, DATA + 2));
+            ASSERT(0 == mX.tryPushBack(DATA, DATA + 2));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            mX.pushBack(DATA, DATA + 2);
+
+            mX.disablePopFront();
+
+            buffer.clear();
+            ASSERT(e_DISABLED == mX.popFront(2, &buffer));
+            ASSERT(e_DISABLED == mX.tryPopFront(2, &buffer));
+            ASSERT(buffer.empty());
+            ASSERT(2 == X.numElements());
+        }
+
+        if (verbose) cout << "\nConcurrent batch consumers." << endl;
+        {
+            enum { k_NUM_POPPERS = 4, k_NUM_ITEMS = 40000 };
+
+            static const int BATCH_SIZES[] = { 1, 7, 64 };
+
+            for (int ti = 0; ti < 3; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                Obj mX;  const Obj& X = mX;
+
+                bsls::AtomicInt           count(0);
+                BatchData                 data[k_NUM_POPPERS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_POPPERS];
+
+                for (int i = 0; i < k_NUM_POPPERS; ++i) {
+                    BatchData d = { &mX, i, 0, BATCH_SIZE, &count };
+
+                    data[i] = d;
+                    bslmt::ThreadUtil::create(&handles[i],
+                                              batchPopUntilDisabled,
+                                              &data[i]);
+                }
+
+                BatchData pushData = { &mX, 0, k_NUM_ITEMS, BATCH_SIZE, 0 };
+
+                batchPush(&pushData);
+
+                ASSERT(e_SUCCESS == mX.waitUntilEmpty());
+
+                mX.disablePopFront();
+
+                for (int i = 0; i < k_NUM_POPPERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                ASSERTV(BATCH_SIZE, count, k_NUM_ITEMS == count);
+                ASSERT(0 == X.numElements());
+            }
+        }
+
+        if (verbose) cout << "\nAllocating type." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const char *LONG = "this string is long enough to allocate memory";
+
+            bsl::vector<bsl::string> values(&sa);
+            for (int i = 0; i < 5; ++i) {
+                values.push_back(bsl::string(LONG, &sa));
+            }
+
+            {
+                AllocObj mX(&sa);  const AllocObj& X = mX;
+
+                ASSERT(5 == mX.tryPushBack(values.begin(), values.end()));
+                ASSERT(5 == X.numElements());
+
+                bsl::vector<bsl::string> buffer(&sa);
+
+                ASSERT(e_SUCCESS == mX.popFront(2, &buffer));
+                ASSERT(2 == buffer.size());
+                ASSERT(LONG == buffer[1]);
+                ASSERT(&sa == buffer[1].get_allocator().mechanism());
+            }
+
+            ASSERT(0 == da.numBlocksTotal());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // `numElements` IS NOT LOWER_BOUND DUE TO `tryPopFront`
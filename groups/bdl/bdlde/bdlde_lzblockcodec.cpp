@@ -0,0 +1,348 @@
+// bdlde_lzblockcodec.cpp                                             -*-C++-*-
+#include <bdlde_lzblockcodec.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_lzblockcodec_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstring.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The compressed representation is a sequence of "sequences", each of which
+// is a token byte, whose high nibble holds the length of the literal run and
+// whose low nibble holds the length of the match less 4, followed by:
+//
+// * the bytes extending the literal length, if its nibble is 15: each byte is
+//   added to the length, and a byte less than 255 ends the extension;
+// * the literal bytes;
+// * the 2-byte little-endian offset of the match (absent from the last
+//   sequence, which holds only literals);
+// * the bytes extending the match length, as for the literal length.
+//
+// Following the LZ4 block format, the last 5 bytes of a block are always
+// literals, and the last match starts at least 12 bytes before the end of the
+// block.  The compressor is greedy: at each position it looks up the previous
+// position having the same 4-byte hash, and emits a match if the 4 bytes are
+// equal, extending it forward as far as possible.  Positions that repeatedly
+// fail to match are skipped at an increasing stride, so that incompressible
+// data is processed quickly.
+
+namespace BloombergLP {
+namespace bdlde {
+
+namespace {
+
+enum {
+    k_MIN_MATCH          = 4,       // shortest match that can be encoded
+
+    k_LAST_LITERALS      = 5,       // number of trailing bytes that are
+                                    // always literals
+
+    k_MATCH_FIND_LIMIT   = 12,      // minimum distance from the start of the
+                                    // last match to the end of the block
+
+    k_MAX_OFFSET         = 65535,   // largest offset that can be encoded
+
+    k_HASH_LOG           = 12,      // log2 of the number of hash entries
+
+    k_SKIP_TRIGGER       = 6,       // log2 of the number of failed lookups
+                                    // after which the search stride grows
+
+    k_RUN_MASK           = 15       // nibble value indicating an extended
+                                    // length
+};
+
+/// Return the 4 bytes at the specified `address` as an unsigned integer in
+/// native byte order.
+inline
+unsigned int read32(const char *address)
+{
+    unsigned int value;
+    bsl::memcpy(&value, address, sizeof value);
+    return value;
+}
+
+/// Return the index of the hash table entry for the specified 4-byte
+/// `sequence`.
+inline
+unsigned int hash(unsigned int sequence)
+{
+    return (sequence * 2654435761U) >> (32 - k_HASH_LOG);
+}
+
+/// Write, at the specified `destination`, the bytes extending a length
+/// whose nibble is `k_RUN_MASK` to the specified `length`, and return the
+/// address following the last byte written.  The behavior is undefined
+/// unless `k_RUN_MASK <= length`.
+inline
+char *writeLength(char *destination, bsl::size_t length)
+{
+    length -= k_RUN_MASK;
+    while (255 <= length) {
+        *destination++ = static_cast<char>(255);
+        length        -= 255;
+    }
+    *destination++ = static_cast<char>(length);
+    return destination;
+}
+
+/// Write, at the specified `destination`, a sequence of the specified
+/// `numLiterals` literal bytes at the specified `literals`, followed by a
+/// match at the specified `offset` of the specified `matchLength`, and
+/// return the address following the last byte written.  If `matchLength`
+/// is 0, write a last sequence holding only literals.
+char *writeSequence(char        *destination,
+                    const char  *literals,
+                    bsl::size_t  numLiterals,
+                    bsl::size_t  offset,
+                    bsl::size_t  matchLength)
+{
+    char *token = destination++;
+
+    unsigned char tokenValue = numLiterals < k_RUN_MASK
+                             ? static_cast<unsigned char>(numLiterals << 4)
+                             : static_cast<unsigned char>(k_RUN_MASK << 4);
+    if (k_RUN_MASK <= numLiterals) {
+        destination = writeLength(destination, numLiterals);
+    }
+
+    bsl::memcpy(destination, literals, numLiterals);
+    destination += numLiterals;
+
+    if (0 < matchLength) {
+        *destination++ = static_cast<char>(offset & 0xff);
+        *destination++ = static_cast<char>(offset >> 8);
+
+        const bsl::size_t code = matchLength - k_MIN_MATCH;
+        if (code < k_RUN_MASK) {
+            tokenValue = static_cast<unsigned char>(tokenValue | code);
+        }
+        else {
+            tokenValue = static_cast<unsigned char>(tokenValue | k_RUN_MASK);
+            destination = writeLength(destination, code);
+        }
+    }
+
+    *token = static_cast<char>(tokenValue);
+    return destination;
+}
+
+/// Load, into the specified `length`, the sum of its value and the bytes
+/// extending it, read from the specified `*position`, which is advanced
+/// past them, and not beyond the specified `end`.  Return 0 on success, and
+/// a non-zero value if the extension is truncated.
+inline
+int readLength(bsl::size_t  *length,
+               const char  **position,
+               const char   *end)
+{
+    unsigned char byte;
+    do {
+        if (*position == end) {
+            return -1;                                                // RETURN
+        }
+        byte     = static_cast<unsigned char>(**position);
+        *length += byte;
+        ++*position;
+    } while (255 == byte);
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // struct LzBlockCodec
+                            // -------------------
+
+// CLASS METHODS
+bsl::size_t LzBlockCodec::compress(char        *destination,
+                                   const char  *source,
+                                   bsl::size_t  length)
+{
+    BSLS_ASSERT(destination);
+    BSLS_ASSERT(source || 0 == length);
+
+    char *output = destination;
+
+    if (length <= k_MATCH_FIND_LIMIT) {
+        output = writeSequence(output, source, length, 0, 0);
+        return output - destination;                                  // RETURN
+    }
+
+    unsigned int table[1 << k_HASH_LOG];
+    bsl::memset(table, 0, sizeof table);
+
+    const bsl::size_t matchStartLimit = length - k_MATCH_FIND_LIMIT;
+    const bsl::size_t matchEndLimit   = length - k_LAST_LITERALS;
+
+    bsl::size_t anchor   = 0;  // start of the pending literals
+    bsl::size_t position = 1;  // position being searched for a match
+    unsigned    attempts = 1u << k_SKIP_TRIGGER;
+
+    table[hash(read32(source))] = 0;
+
+    while (position < matchStartLimit) {
+        const unsigned int  sequence  = read32(source + position);
+        unsigned int       *entry     = &table[hash(sequence)];
+        const bsl::size_t   candidate = *entry;
+
+        *entry = static_cast<unsigned int>(position);
+
+        if (position - candidate > k_MAX_OFFSET
+         || read32(source + candidate) != sequence) {
+            position += attempts++ >> k_SKIP_TRIGGER;
+            continue;
+        }
+
+        // Extend the match forward, not beyond the trailing literals.
+
+        bsl::size_t matchLength = k_MIN_MATCH;
+        while (position + matchLength < matchEndLimit
+            && source[candidate + matchLength]
+                                         == source[position + matchLength]) {
+            ++matchLength;
+        }
+
+        output = writeSequence(output,
+                               source + anchor,
+                               position - anchor,
+                               position - candidate,
+                               matchLength);
+
+        position += matchLength;
+        anchor    = position;
+        attempts  = 1u << k_SKIP_TRIGGER;
+
+        // Index a position within the match, improving the chances that the
+        // next sequence matches.
+
+        if (position < matchStartLimit) {
+            table[hash(read32(source + position - 2))] =
+                                     static_cast<unsigned int>(position - 2);
+        }
+    }
+
+    output = writeSequence(output, source + anchor, length - anchor, 0, 0);
+
+    BSLS_ASSERT(static_cast<bsl::size_t>(output - destination) <=
+                                                maxCompressedLength(length));
+
+    return output - destination;
+}
+
+int LzBlockCodec::decompress(bsl::size_t *decompressedLength,
+                             char        *destination,
+                             bsl::size_t  capacity,
+                             const char  *source,
+                             bsl::size_t  length)
+{
+    BSLS_ASSERT(decompressedLength);
+    BSLS_ASSERT(destination || 0 == capacity);
+    BSLS_ASSERT(source      || 0 == length);
+
+    const char *input    = source;
+    const char *inputEnd = source + length;
+    bsl::size_t produced = 0;
+
+    while (true) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(input == inputEnd)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return -1;                                                // RETURN
+        }
+
+        const unsigned char token = static_cast<unsigned char>(*input++);
+
+        bsl::size_t numLiterals = token >> 4;
+        if (k_RUN_MASK == numLiterals
+         && 0 != readLength(&numLiterals, &input, inputEnd)) {
+            return -2;                                                // RETURN
+        }
+
+        if (numLiterals > static_cast<bsl::size_t>(inputEnd - input)
+         || numLiterals > capacity - produced) {
+            return -3;                                                // RETURN
+        }
+
+        bsl::memcpy(destination + produced, input, numLiterals);
+        input    += numLiterals;
+        produced += numLiterals;
+
+        if (input == inputEnd) {
+            // The last sequence holds only literals, and its match length is
+            // always written as 0.
+
+            if (0 != (token & k_RUN_MASK)) {
+                return -8;                                            // RETURN
+            }
+            break;
+        }
+
+        if (2 > inputEnd - input) {
+            return -4;                                                // RETURN
+        }
+
+        const bsl::size_t offset =
+                       static_cast<bsl::size_t>(
+                                        static_cast<unsigned char>(input[0]))
+                     | static_cast<bsl::size_t>(
+                                   static_cast<unsigned char>(input[1])) << 8;
+        input += 2;
+
+        if (0 == offset || offset > produced) {
+            return -5;                                                // RETURN
+        }
+
+        bsl::size_t matchLength = token & k_RUN_MASK;
+        if (k_RUN_MASK == matchLength
+         && 0 != readLength(&matchLength, &input, inputEnd)) {
+            return -6;                                                // RETURN
+        }
+        matchLength += k_MIN_MATCH;
+
+        if (matchLength > capacity - produced) {
+            return -7;                                                // RETURN
+        }
+
+        char       *output = destination + produced;
+        const char *match  = output - offset;
+
+        if (offset >= matchLength) {
+            bsl::memcpy(output, match, matchLength);
+        }
+        else {
+            // The match overlaps the data it produces, repeating the last
+            // `offset` bytes.
+
+            for (bsl::size_t i = 0; i < matchLength; ++i) {
+                output[i] = match[i];
+            }
+        }
+        produced += matchLength;
+    }
+
+    *decompressedLength = produced;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,175 @@
+// bdlde_lzblockcodec.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLDE_LZBLOCKCODEC
+#define INCLUDED_BDLDE_LZBLOCKCODEC
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide a fast LZ77-class compressor for blocks of data.
+//
+//@CLASSES:
+//  bdlde::LzBlockCodec: namespace for LZ block compression and decompression
+//
+//@SEE_ALSO: bdlde_crc32c
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdlde::LzBlockCodec`, that compresses and decompresses blocks of data held
+// in memory using a byte-oriented LZ77-class algorithm favoring speed over
+// compression ratio.  A block is compressed independently of any other block,
+// so that a stream of data compressed in blocks can be decompressed starting
+// from any block boundary.
+//
+// The compressed representation of a block is the LZ4 block format: a
+// sequence of literal runs, each optionally followed by a back-reference (an
+// offset of at most 65535 bytes and a length of at least 4 bytes) to data
+// previously decompressed from the same block.  The compressed representation
+// does not record the length of the uncompressed data, nor include any
+// checksum; applications are expected to frame compressed blocks with such
+// information as they require.  In particular, a compressed block truncated
+// immediately following a run of literals is itself a valid compressed block
+// (of shorter data), so that truncation can be detected only by comparing the
+// decompressed length with the original length.
+//
+// The compressor finds back-references using a small hash table of recently
+// seen 4-byte sequences, held on the stack, and does not allocate memory.  On
+// text such as log files, it typically compresses at several hundred
+// megabytes per second per core, to between a quarter and a half of the
+// original size, and decompresses several times faster than it compresses.
+//
+// `decompress` validates the compressed representation as it proceeds, and
+// never reads or writes out of the bounds of the supplied buffers, even if
+// the compressed data is corrupt.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing and Decompressing a Block
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a repetitive text compactly.
+//
+// First, we create the text:
+// ```
+// bsl::string text;
+// for (int i = 0; i < 100; ++i) {
+//     text += "INFO request served in 10 ms\n";
+// }
+// ```
+// Then, we compress it into a buffer large enough to hold the compressed
+// representation of any data of the same length:
+// ```
+// const bsl::size_t maxLength =
+//                       bdlde::LzBlockCodec::maxCompressedLength(text.size());
+// bsl::vector<char> compressed(maxLength);
+//
+// const bsl::size_t compressedLength = bdlde::LzBlockCodec::compress(
+//                                                         compressed.data(),
+//                                                         text.data(),
+//                                                         text.size());
+// assert(compressedLength < text.size() / 10);
+// ```
+// Finally, we decompress it, supplying a buffer having the length of the
+// original text, and verify the result:
+// ```
+// bsl::vector<char> decompressed(text.size());
+// bsl::size_t       decompressedLength;
+//
+// int rc = bdlde::LzBlockCodec::decompress(&decompressedLength,
+//                                          decompressed.data(),
+//                                          decompressed.size(),
+//                                          compressed.data(),
+//                                          compressedLength);
+// assert(0           == rc);
+// assert(text.size() == decompressedLength);
+// assert(text        == bsl::string(decompressed.data(),
+//                                   decompressedLength));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                            // ===================
+                            // struct LzBlockCodec
+                            // ===================
+
+/// This utility `struct` provides a namespace for functions that compress
+/// and decompress blocks of data.
+struct LzBlockCodec {
+
+    // CLASS METHODS
+
+    /// Load, into the specified `destination`, the compressed
+    /// representation of the specified `length` bytes at the specified
+    /// `source`, and return the length of the compressed representation.
+    /// The behavior is undefined unless `destination` refers to at least
+    /// `maxCompressedLength(length)` bytes that do not overlap `source`.
+    /// Note that data that does not compress is represented in slightly
+    /// more than `length` bytes.
+    static bsl::size_t compress(char        *destination,
+                                const char  *source,
+                                bsl::size_t  length);
+
+    /// Load, into the specified `destination` having the specified
+    /// `capacity` (in bytes), the data decompressed from the compressed
+    /// representation held by the specified `length` bytes at the specified
+    /// `source`, and load the length of the decompressed data into the
+    /// specified `decompressedLength`.  Return 0 on success, and a non-zero
+    /// value if `source` is not a valid compressed representation, or if
+    /// the decompressed data is longer than `capacity` (in which case the
+    /// contents of `destination` and `decompressedLength` are unspecified).
+    /// The behavior is undefined unless `destination` and `source` do not
+    /// overlap.
+    static int decompress(bsl::size_t *decompressedLength,
+                          char        *destination,
+                          bsl::size_t  capacity,
+                          const char  *source,
+                          bsl::size_t  length);
+
+    /// Return the maximum length of the compressed representation of data
+    /// of the specified `length` (in bytes).
+    static bsl::size_t maxCompressedLength(bsl::size_t length);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct LzBlockCodec
+                            // -------------------
+
+// CLASS METHODS
+inline
+bsl::size_t LzBlockCodec::maxCompressedLength(bsl::size_t length)
+{
+    return length + length / 255 + 16;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,633 @@
+// bdlde_lzblockcodec.t.cpp                                           -*-C++-*-
+#include <bdlde_lzblockcodec.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility compressing and decompressing blocks
+// of data.  We verify that decompressing the output of `compress` restores
+// the original data for a variety of compressible and incompressible inputs
+// (including inputs around the lengths at which the format's end-of-block
+// rules apply), that the compressed length never exceeds
+// `maxCompressedLength`, that compressible data is compressed, that
+// `decompress` decodes hand-written compressed blocks, and that `decompress`
+// detects, without exceeding the bounds of its buffers, truncations and
+// corruptions of valid compressed blocks.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_t compress(char *, const char *, size_t);
+// [ 2] size_t maxCompressedLength(size_t);
+// [ 2] int decompress(size_t *, char *, size_t, const char *, size_t);
+// [ 3] int decompress(size_t *, char *, size_t, const char *, size_t);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::LzBlockCodec Util;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return a pseudo-random number updating the specified `seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245U + 12345U;
+    return *seed >> 8;
+}
+
+/// Return the specified `length` bytes of text resembling a log file,
+/// generated from the specified `seed`.
+bsl::string makeLogText(bsl::size_t length, unsigned int seed)
+{
+    static const char *const k_WORDS[] = {
+        "INFO", "WARN", "DEBUG", "request", "served", "in", "ms", "client",
+        "connected", "session", "timeout", "order", "price", "quantity"
+    };
+    const unsigned int k_NUM_WORDS = sizeof k_WORDS / sizeof *k_WORDS;
+
+    bsl::string text;
+    while (text.size() < length) {
+        text += "18MAY2026_18:58:12.";
+        text += static_cast<char>('0' + nextRandom(&seed) % 10);
+        text += " 7959:1 ";
+        for (int i = 0; i < 6; ++i) {
+            text += k_WORDS[nextRandom(&seed) % k_NUM_WORDS];
+            text += ' ';
+        }
+        text += bsl::to_string(nextRandom(&seed) % 100000);
+        text += '\n';
+    }
+    text.resize(length);
+    return text;
+}
+
+/// Return `true` if compressing then decompressing the specified `data`
+/// restores it, and the compressed length does not exceed
+/// `maxCompressedLength`, and `false` otherwise.  Load the compressed
+/// length into the optionally specified `compressedLength`.
+bool roundTrip(const bsl::string& data, bsl::size_t *compressedLength = 0)
+{
+    const bsl::size_t bound = Util::maxCompressedLength(data.size());
+
+    // Surround the output with guard bytes to detect overruns.
+
+    bsl::vector<char> compressed(bound + 2, '\x5a');
+    const bsl::size_t length = Util::compress(compressed.data() + 1,
+                                              data.data(),
+                                              data.size());
+    if (compressedLength) {
+        *compressedLength = length;
+    }
+    if (length > bound || '\x5a' != compressed[bound + 1]
+                       || '\x5a' != compressed[0]) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::vector<char> decompressed(data.size() + 1);
+    bsl::size_t       decompressedLength = 0;
+
+    if (0 != Util::decompress(&decompressedLength,
+                              decompressed.data(),
+                              data.size(),
+                              compressed.data() + 1,
+                              length)) {
+        return false;                                                 // RETURN
+    }
+
+    return decompressedLength == data.size()
+        && 0 == bsl::memcmp(decompressed.data(), data.data(), data.size());
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing and Decompressing a Block
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a repetitive text compactly.
+//
+// First, we create the text:
+// ```
+        bsl::string text;
+        for (int i = 0; i < 100; ++i) {
+            text += "INFO request served in 10 ms\n";
+        }
+// ```
+// Then, we compress it into a buffer large enough to hold the compressed
+// representation of any data of the same length:
+// ```
+        const bsl::size_t maxLength =
+                         bdlde::LzBlockCodec::maxCompressedLength(text.size());
+        bsl::vector<char> compressed(maxLength);
+
+        const bsl::size_t compressedLength = bdlde::LzBlockCodec::compress(
+                                                             compressed.data(),
+                                                             text.data(),
+                                                             text.size());
+        ASSERT(compressedLength < text.size() / 10);
+// ```
+// Finally, we decompress it, supplying a buffer having the length of the
+// original text, and verify the result:
+// ```
+        bsl::vector<char> decompressed(text.size());
+        bsl::size_t       decompressedLength;
+
+        int rc = bdlde::LzBlockCodec::decompress(&decompressedLength,
+                                                 decompressed.data(),
+                                                 decompressed.size(),
+                                                 compressed.data(),
+                                                 compressedLength);
+        ASSERT(0           == rc);
+        ASSERT(text.size() == decompressedLength);
+        ASSERT(text        == bsl::string(decompressed.data(),
+                                          decompressedLength));
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECOMPRESSING INVALID DATA
+        //
+        // Concerns:
+        // 1. `decompress` decodes valid hand-written blocks, including
+        //    matches that overlap the data they produce and extended lengths.
+        //
+        // 2. `decompress` fails on every truncation of a valid block, or (if
+        //    the block is truncated following a run of literals, which is
+        //    indistinguishable from the end of a block) produces less data
+        //    than the original.
+        //
+        // 3. `decompress` fails if the decompressed data exceeds the supplied
+        //    capacity, and does not write beyond it.
+        //
+        // 4. `decompress` fails on offsets of 0 and offsets preceding the
+        //    start of the block.
+        //
+        // 5. `decompress` does not read or write out of bounds on corrupt
+        //    input.
+        //
+        // Plan:
+        // 1. Decode hand-written blocks and verify the output.  (C-1)
+        //
+        // 2. Decode every proper prefix of a compressed block.  (C-2)
+        //
+        // 3. Decode a block into buffers one byte too short, surrounded by
+        //    guard bytes.  (C-3)
+        //
+        // 4. Decode hand-written blocks having invalid offsets.  (C-4)
+        //
+        // 5. Decode compressed blocks in which single bytes are replaced by
+        //    pseudo-random values, into a buffer surrounded by guard bytes,
+        //    and verify the guard bytes; memory checkers detect out-of-bounds
+        //    reads.  (C-5)
+        //
+        // Testing:
+        //   int decompress(size_t *, char *, size_t, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECOMPRESSING INVALID DATA" << endl
+                          << "==========================" << endl;
+
+        if (verbose) cout << "\tDecoding hand-written blocks." << endl;
+        {
+            // One literal, a 10-byte match at offset 1, then 5 literals.
+
+            const char  BLOCK[] = "\x16" "a" "\x01\x00" "\x50" "bbbbb";
+            char        output[64];
+            bsl::size_t length = 0;
+
+            ASSERT(0 == Util::decompress(&length,
+                                         output,
+                                         sizeof output,
+                                         BLOCK,
+                                         sizeof BLOCK - 1));
+            ASSERT(16 == length);
+            ASSERT(bsl::string("aaaaaaaaaaabbbbb") ==
+                                                  bsl::string(output, length));
+
+            // Extended literal length (15 + 2) and match length
+            // (4 + 15 + 255 + 1).
+
+            bsl::string block;
+            block += static_cast<char>(0xff);
+            block += '\x02';
+            block += "abcdefghijklmnopq";
+            block += "\x02";
+            block += '\0';
+            block += static_cast<char>(0xff);
+            block += '\x01';
+            block += "\x10" "z";
+
+            bsl::vector<char> buffer(1024);
+            ASSERT(0 == Util::decompress(&length,
+                                         buffer.data(),
+                                         buffer.size(),
+                                         block.data(),
+                                         block.size()));
+            ASSERTV(length, 17 + 275 + 1 == length);
+
+            bsl::string expected("abcdefghijklmnopq");
+            while (expected.size() < 17 + 275) {
+                expected += expected[expected.size() - 2];
+            }
+            expected += 'z';
+            ASSERT(expected == bsl::string(buffer.data(), length));
+
+            // An empty block is a single token with no literals.
+
+            ASSERT(0 == Util::decompress(&length, output, 0, "\x00", 1));
+            ASSERT(0 == length);
+
+            // No token at all is invalid.
+
+            ASSERT(0 != Util::decompress(&length, output, 0, "", 0));
+
+            // The last sequence must not encode a match length.
+
+            ASSERT(0 == Util::decompress(&length, output, 64, "\x50" "bbbbb",
+                                         6));
+            ASSERT(0 != Util::decompress(&length, output, 64, "\x51" "bbbbb",
+                                         6));
+        }
+
+        if (verbose) cout << "\tDecoding invalid offsets." << endl;
+        {
+            char        output[64];
+            bsl::size_t length;
+
+            const char ZERO[]   = "\x10" "a" "\x00\x00" "\x50" "bbbbb";
+            const char BEFORE[] = "\x10" "a" "\x02\x00" "\x50" "bbbbb";
+
+            ASSERT(0 != Util::decompress(&length,
+                                         output,
+                                         sizeof output,
+                                         ZERO,
+                                         sizeof ZERO - 1));
+            ASSERT(0 != Util::decompress(&length,
+                                         output,
+                                         sizeof output,
+                                         BEFORE,
+                                         sizeof BEFORE - 1));
+        }
+
+        const bsl::string DATA = u::makeLogText(4000, 7);
+
+        bsl::vector<char> compressed(Util::maxCompressedLength(DATA.size()));
+        const bsl::size_t compressedLength = Util::compress(compressed.data(),
+                                                            DATA.data(),
+                                                            DATA.size());
+
+        if (verbose) cout << "\tDecoding truncated blocks." << endl;
+        {
+            bsl::vector<char> output(DATA.size());
+            bsl::size_t       length;
+
+            for (bsl::size_t i = 0; i < compressedLength; ++i) {
+                bsl::vector<char> prefix(compressed.begin(),
+                                         compressed.begin() + i);
+
+                const int rc = Util::decompress(&length,
+                                                output.data(),
+                                                output.size(),
+                                                prefix.data(),
+                                                prefix.size());
+                ASSERTV(i, 0 != rc || length < DATA.size());
+            }
+        }
+
+        if (verbose) cout << "\tDecoding into short buffers." << endl;
+        {
+            bsl::vector<char> output(DATA.size() + 1, '\x5a');
+            bsl::size_t       length;
+
+            ASSERT(0 != Util::decompress(&length,
+                                         output.data(),
+                                         DATA.size() - 1,
+                                         compressed.data(),
+                                         compressedLength));
+            ASSERT('\x5a' == output[DATA.size() - 1]);
+            ASSERT('\x5a' == output[DATA.size()]);
+        }
+
+        if (verbose) cout << "\tDecoding corrupt blocks." << endl;
+        {
+            unsigned int seed    = 11;
+            int          numOk   = 0;
+
+            for (int i = 0; i < 2000; ++i) {
+                bsl::vector<char> corrupt(compressed.begin(),
+                                          compressed.begin() +
+                                                             compressedLength);
+                const bsl::size_t index = u::nextRandom(&seed) %
+                                                              compressedLength;
+                corrupt[index] = static_cast<char>(u::nextRandom(&seed));
+
+                bsl::vector<char> output(DATA.size() + 16, '\x5a');
+                bsl::size_t       length;
+
+                const int rc = Util::decompress(&length,
+                                                output.data() + 8,
+                                                DATA.size(),
+                                                corrupt.data(),
+                                                corrupt.size());
+                if (0 == rc) {
+                    ++numOk;
+                    ASSERTV(i, length <= DATA.size());
+                }
+                for (int j = 0; j < 8; ++j) {
+                    ASSERTV(i, j, '\x5a' == output[j]);
+                    ASSERTV(i, j, '\x5a' == output[DATA.size() + 8 + j]);
+                }
+            }
+
+            if (veryVerbose) { P(numOk); }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        output[16];
+            bsl::size_t length;
+
+            ASSERT_PASS(Util::decompress(&length, output, 1, "\x00", 1));
+            ASSERT_FAIL(Util::decompress(0,       output, 1, "\x00", 1));
+            ASSERT_FAIL(Util::decompress(&length, 0,      1, "\x00", 1));
+            ASSERT_FAIL(Util::decompress(&length, output, 1, 0,      1));
+
+            ASSERT_PASS(Util::compress(output, "", 0));
+            ASSERT_FAIL(Util::compress(0,      "", 0));
+            ASSERT_FAIL(Util::compress(output, 0,  1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // COMPRESSING AND DECOMPRESSING
+        //
+        // Concerns:
+        // 1. Decompressing the output of `compress` restores the input, for
+        //    inputs of every length up to a few hundred bytes, and for long
+        //    inputs.
+        //
+        // 2. The compressed length does not exceed `maxCompressedLength`,
+        //    and `compress` does not write beyond it.
+        //
+        // 3. Repetitive data, including runs of a single byte, and text
+        //    resembling log files, are compressed.
+        //
+        // 4. Incompressible data is handled.
+        //
+        // Plan:
+        // 1. Round-trip prefixes of several inputs of every length from 0 to
+        //    300, and long inputs of repetitive, log-like, and random data,
+        //    verifying guard bytes around the compressed output.  (C-1, 2, 4)
+        //
+        // 2. Verify the compression ratio of repetitive and log-like
+        //    data.  (C-3)
+        //
+        // Testing:
+        //   size_t compress(char *, const char *, size_t);
+        //   size_t maxCompressedLength(size_t);
+        //   int decompress(size_t *, char *, size_t, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPRESSING AND DECOMPRESSING" << endl
+                          << "=============================" << endl;
+
+        unsigned int seed = 3;
+
+        bsl::string random;
+        for (int i = 0; i < 300000; ++i) {
+            random += static_cast<char>(u::nextRandom(&seed));
+        }
+
+        const bsl::string logText = u::makeLogText(300000, 5);
+        const bsl::string run(300000, 'x');
+
+        bsl::string alternating;
+        for (int i = 0; i < 300000; ++i) {
+            alternating += static_cast<char>('a' + i % 7);
+        }
+
+        const bsl::string *const INPUTS[] = {
+            &random, &logText, &run, &alternating
+        };
+        const int NUM_INPUTS = sizeof INPUTS / sizeof *INPUTS;
+
+        if (verbose) cout << "\tRound-tripping short inputs." << endl;
+
+        for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+            for (bsl::size_t length = 0; length <= 300; ++length) {
+                const bsl::string data(INPUTS[ti]->substr(0, length));
+
+                ASSERTV(ti, length, u::roundTrip(data));
+            }
+        }
+
+        if (verbose) cout << "\tRound-tripping long inputs." << endl;
+
+        for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+            const bsl::size_t LENGTHS[] = { 1000, 65535, 65536, 65537,
+                                            100000, 300000 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const bsl::string data(INPUTS[ti]->substr(0, LENGTHS[li]));
+                bsl::size_t       compressedLength;
+
+                ASSERTV(ti, li, u::roundTrip(data, &compressedLength));
+
+                if (veryVerbose) {
+                    T_ P_(ti) P_(data.size()) P(compressedLength);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tVerifying compression ratios." << endl;
+        {
+            bsl::size_t compressedLength;
+
+            ASSERT(u::roundTrip(run, &compressedLength));
+            ASSERTV(compressedLength, compressedLength < run.size() / 100);
+
+            ASSERT(u::roundTrip(alternating, &compressedLength));
+            ASSERTV(compressedLength,
+                    compressedLength < alternating.size() / 100);
+
+            ASSERT(u::roundTrip(logText, &compressedLength));
+            ASSERTV(compressedLength, compressedLength < logText.size() / 2);
+
+            ASSERT(u::roundTrip(random, &compressedLength));
+            ASSERTV(compressedLength, compressedLength >= random.size());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Compress and decompress a short text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string TEXT("abcabcabcabcabcabcabcabcabcabc hello world");
+
+        char              compressed[128];
+        const bsl::size_t compressedLength = Util::compress(compressed,
+                                                            TEXT.data(),
+                                                            TEXT.size());
+        ASSERTV(compressedLength, compressedLength < TEXT.size());
+
+        char        output[128];
+        bsl::size_t length = 0;
+
+        ASSERT(0 == Util::decompress(&length,
+                                     output,
+                                     sizeof output,
+                                     compressed,
+                                     compressedLength));
+        ASSERT(TEXT == bsl::string(output, length));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,405 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // `BSLS_THROW`
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // `bsl::size_t`
+#include <bsl_new.h>                 // `bsl::bad_alloc`
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // `GetSystemInfo`, `VirtualAlloc`, `VirtualFree`
+
+#else
+
+#include <sys/mman.h>  // `mmap`, `munmap`, `madvise`
+#include <unistd.h>    // `sysconf`
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <stdio.h>        // `fopen`, `fscanf`, `fclose`
+#include <string.h>       // `strcmp`
+#include <sys/syscall.h>  // `SYS_mbind`
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+/// This `struct` precedes each block returned by `allocate`, at the start of
+/// its mapping, and records the length of the mapping.
+struct Header {
+
+    union {
+        bsls::Types::size_type d_mappedSize;  // length of the mapping
+
+        bsls::AlignmentUtil::MaxAlignedType
+                               d_dummy;       // force maximum alignment
+    } d_header;
+};
+
+BSLMF_ASSERT(sizeof(Header) == bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+enum {
+    k_MPOL_PREFERRED = 1,     // `MPOL_PREFERRED` of <numaif.h>
+
+    k_MAX_NUMA_NODES = 1024   // nodes representable in the node mask
+};
+
+#endif
+
+// HELPER FUNCTIONS
+
+/// Return the size (in bytes) of a system memory page.
+bsls::Types::size_type getSystemPageSize()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;                                           // RETURN
+
+#else
+
+    return static_cast<bsls::Types::size_type>(sysconf(_SC_PAGESIZE));
+                                                                      // RETURN
+
+#endif
+}
+
+/// Return the size (in bytes) of a huge page on this system, or the
+/// specified `pageSize` if huge pages are not supported.
+bsls::Types::size_type getHugePageSize(bsls::Types::size_type pageSize)
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+    (void)pageSize;
+
+    bsls::Types::size_type hugePageSize = 2 * 1024 * 1024;
+
+    if (FILE *meminfo = fopen("/proc/meminfo", "r")) {
+        char          name[64];
+        unsigned long value;
+
+        while (2 == fscanf(meminfo, "%63s %lu kB\n", name, &value)) {
+            if (0 == strcmp(name, "Hugepagesize:")) {
+                hugePageSize = static_cast<bsls::Types::size_type>(value)
+                                                                      * 1024;
+                break;                                                 // BREAK
+            }
+        }
+        fclose(meminfo);
+    }
+    return hugePageSize;                                              // RETURN
+
+#else
+
+    return pageSize;                                                  // RETURN
+
+#endif
+}
+
+/// Return the specified `size` rounded up to the nearest multiple of the
+/// specified `boundary`.  The behavior is undefined unless `boundary` is a
+/// power of 2.
+inline
+bsls::Types::size_type roundUp(bsls::Types::size_type size,
+                               bsls::Types::size_type boundary)
+{
+    return (size + boundary - 1) & ~(boundary - 1);
+}
+
+/// Return a page-aligned mapping of the specified `size` (in bytes), or 0 if
+/// the memory cannot be mapped.  If the specified `alignment` is not 0, the
+/// mapping is aligned on `alignment`.  If the specified `hugeTlb` is `true`,
+/// the mapping is backed by the pre-reserved huge-page pool (and aligned on
+/// the huge-page size).  The behavior is undefined unless `size` is a
+/// positive multiple of the page size, and `alignment` is 0 or a power of 2
+/// greater than the page size.
+void *systemMap(bsls::Types::size_type size,
+                bsls::Types::size_type alignment,
+                bool                   hugeTlb)
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    (void)alignment;
+    (void)hugeTlb;
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    int flags = MAP_ANON | MAP_PRIVATE;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (hugeTlb) {
+        // Huge-page mappings are aligned on the huge-page size.
+
+        void *address = mmap(0,
+                             size,
+                             PROT_READ | PROT_WRITE,
+                             flags | MAP_HUGETLB,
+                             -1,
+                             0);
+        return MAP_FAILED == address ? 0 : address;                   // RETURN
+    }
+#else
+    (void)hugeTlb;
+#endif
+
+    if (0 == alignment) {
+        void *address = mmap(0, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        return MAP_FAILED == address ? 0 : address;                   // RETURN
+    }
+
+    // Over-map by `alignment`, and unmap the excess before and after the
+    // aligned mapping.
+
+    const bsls::Types::size_type mapSize = size + alignment;
+
+    void *address = mmap(0, mapSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    char *begin   = static_cast<char *>(address);
+    char *aligned = begin
+                  + (alignment - reinterpret_cast<bsls::Types::UintPtr>(begin)
+                                                     % alignment) % alignment;
+    char *end     = aligned + size;
+
+    if (aligned != begin) {
+        munmap(begin, aligned - begin);
+    }
+    if (end != begin + mapSize) {
+        munmap(end, begin + mapSize - end);
+    }
+    return aligned;                                                   // RETURN
+
+#endif
+}
+
+/// Unmap the mapping at the specified `address` having the specified `size`.
+/// The behavior is undefined unless `address` and `size` describe a mapping
+/// returned by `systemMap`.
+void systemUnmap(void *address, bsls::Types::size_type size)
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+/// Advise the kernel to back the specified `size` bytes at the specified
+/// `address` with transparent huge pages, if supported on this platform.
+void adviseHugePages(void *address, bsls::Types::size_type size)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+
+    // Failure (e.g., if transparent huge pages are disabled) leaves the
+    // mapping backed by regular pages, which is not an error.
+
+    madvise(address, size, MADV_HUGEPAGE);
+
+#else
+
+    (void)address;
+    (void)size;
+
+#endif
+}
+
+/// Set the NUMA policy of the specified `size` bytes at the specified
+/// `address` to prefer the specified `node`.  Return 0 on success, and a
+/// non-zero value otherwise (including on platforms not supporting NUMA
+/// placement).
+int bindToNode(void *address, bsls::Types::size_type size, int node)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+
+    static const int k_BITS_PER_WORD = static_cast<int>(
+                                                    8 * sizeof(unsigned long));
+
+    unsigned long nodeMask[k_MAX_NUMA_NODES / k_BITS_PER_WORD] = {};
+
+    nodeMask[node / k_BITS_PER_WORD] |= 1UL << (node % k_BITS_PER_WORD);
+
+    // The kernel ignores the last bit of `maxnode`.
+
+    return static_cast<int>(syscall(SYS_mbind,
+                                    address,
+                                    size,
+                                    k_MPOL_PREFERRED,
+                                    nodeMask,
+                                    k_MAX_NUMA_NODES + 1,
+                                    0));                              // RETURN
+
+#else
+
+    (void)address;
+    (void)size;
+    (void)node;
+
+    return -1;                                                        // RETURN
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(HugePageMode hugePageMode,
+                                     int          numaNode,
+                                     PrefaultMode prefaultMode)
+: d_hugePageMode(hugePageMode)
+, d_numaNode(numaNode)
+, d_prefaultMode(prefaultMode)
+, d_pageSize(getSystemPageSize())
+, d_hugePageSize(getHugePageSize(d_pageSize))
+, d_numBytesMapped(0)
+, d_numHugeTlbFallbacks(0)
+, d_numNumaBindFailures(0)
+{
+    BSLS_ASSERT(k_NO_NUMA_NODE <= numaNode);
+    BSLS_ASSERT(numaNode < 1024);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::size_type totalSize = size + sizeof(Header);
+    const bool                   huge = e_NONE != d_hugePageMode
+                                     && totalSize >= d_hugePageSize
+                                     && d_hugePageSize > d_pageSize;
+
+    bsls::Types::size_type  mappedSize = 0;
+    void                   *address    = 0;
+
+    if (huge && e_EXPLICIT == d_hugePageMode) {
+        mappedSize = roundUp(totalSize, d_hugePageSize);
+        address    = systemMap(mappedSize, 0, true);
+
+        if (!address) {
+            ++d_numHugeTlbFallbacks;
+        }
+    }
+
+    if (!address) {
+        mappedSize = roundUp(totalSize, d_pageSize);
+        address    = systemMap(mappedSize, huge ? d_hugePageSize : 0, false);
+
+        if (address && huge) {
+            // Only the whole huge pages are advised: the remainder of the
+            // block stays on regular pages (see {Huge Pages}).
+
+            adviseHugePages(address,
+                            mappedSize / d_hugePageSize * d_hugePageSize);
+        }
+    }
+
+    if (!address) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    if (k_NO_NUMA_NODE != d_numaNode
+     && 0 != bindToNode(address, mappedSize, d_numaNode)) {
+        ++d_numNumaBindFailures;
+    }
+
+    if (e_PREFAULT == d_prefaultMode) {
+        // Write to every page, so that the kernel assigns it now (a read
+        // could map the shared zero page instead).
+
+        volatile char *page = static_cast<char *>(address);
+        for (bsls::Types::size_type offset = 0;
+                                            offset < mappedSize;
+                                            offset += d_pageSize) {
+            page[offset] = 0;
+        }
+    }
+
+    d_numBytesMapped.addRelaxed(static_cast<bsls::Types::Int64>(mappedSize));
+
+    Header *header = static_cast<Header *>(address);
+    header->d_header.d_mappedSize = mappedSize;
+
+    return header + 1;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header                       *header = static_cast<Header *>(address) - 1;
+    const bsls::Types::size_type  mappedSize = header->d_header.d_mappedSize;
+
+    BSLS_ASSERT(0 == mappedSize % d_pageSize);
+
+    d_numBytesMapped.addRelaxed(
+                               -static_cast<bsls::Types::Int64>(mappedSize));
+
+    systemUnmap(header, mappedSize);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
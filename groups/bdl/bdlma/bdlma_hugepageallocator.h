@@ -0,0 +1,364 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator supplying huge-page, NUMA-local memory.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: thread-safe allocator mapping memory directly
+//
+//@SEE_ALSO: bdlma_guardingallocator, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// `bdlma::HugePageAllocator`, that implements the `bslma::Allocator` protocol
+// by mapping each block directly from the operating system, optionally backed
+// by huge pages, placed on a preferred NUMA node, and pre-faulted:
+// ```
+//  ,------------------------.
+// ( bdlma::HugePageAllocator )
+//  `------------------------'
+//              |         ctor/dtor
+//              |         hugePageMode
+//              |         hugePageSize
+//              |         numaNode
+//              |         numBytesMapped
+//              |         numHugeTlbFallbacks
+//              |         numNumaBindFailures
+//              |         pageSize
+//              |         prefaultMode
+//              V
+//     ,----------------.
+//    ( bslma::Allocator )
+//     `----------------'
+//                        allocate
+//                        deallocate
+// ```
+// A `bdlma::HugePageAllocator` is intended as the *upstream* allocator of the
+// memory managers in this package that obtain large chunks of memory and
+// carve them into smaller blocks, such as `bdlma::SequentialAllocator`,
+// `bdlma::Multipool`, and `bdlma::ConcurrentPool`.  Large, long-lived arenas
+// accessed at random (e.g., order books) spend much of their time in TLB
+// misses when backed by regular (typically 4 KB) pages; a huge page
+// (typically 2 MB) is mapped by a single TLB entry.
+//
+// Each block is mapped separately, preceded by a maximally-aligned header,
+// and rounded up to a whole number of pages, so a `bdlma::HugePageAllocator`
+// should *not* be used to allocate small objects directly: configure the
+// client memory manager to request large chunks (e.g., by supplying a large
+// initial size to a `bdlma::SequentialAllocator`, or a large
+// `maxBlocksPerChunk` to a pool).  Requests for less than one huge page are
+// served from regular pages.
+//
+///Huge Pages
+///----------
+// The `HugePageMode` supplied at construction selects how blocks of at least
+// `hugePageSize()` bytes are backed:
+//
+// * `e_NONE`: by regular pages.
+// * `e_TRANSPARENT`: by transparent huge pages: the mapping is aligned on a
+//   huge-page boundary, and its whole huge pages are advised (with
+//   `madvise(MADV_HUGEPAGE)`) to be backed by huge pages, which the kernel
+//   provides if available.  The remainder of the block, less than one huge
+//   page, is backed by regular pages, so that a request slightly larger than
+//   a multiple of the huge-page size (as made by memory managers adding their
+//   own header to a chunk) does not commit an additional huge page.
+// * `e_EXPLICIT`: by pages of the pre-reserved huge-page pool (mapped with
+//   `MAP_HUGETLB`), the block being rounded up to a whole number of huge
+//   pages.  If the pool cannot satisfy the request, the block is backed as
+//   for `e_TRANSPARENT`, and `numHugeTlbFallbacks()` is incremented.
+//
+// Huge pages are supported on Linux only; on other platforms every mode
+// behaves as `e_NONE`.
+//
+///NUMA Placement
+///--------------
+// If a NUMA node is supplied at construction, the pages of each block are
+// placed preferably on that node (with `mbind(MPOL_PREFERRED)`), falling back
+// to other nodes only when the node is exhausted.  A failure to set the
+// policy (e.g., for a node that does not exist) is not an error: the block is
+// placed according to the default policy, and `numNumaBindFailures()` is
+// incremented.  NUMA placement is supported on Linux only, and is ignored on
+// other platforms.
+//
+///Pre-Faulting
+///------------
+// By default, physical pages are assigned lazily, the first time each page is
+// touched, so that the first pass over a fresh arena pays for its page
+// faults.  If `e_PREFAULT` is supplied at construction, every page of a block
+// is touched by `allocate` (after the NUMA policy is set), moving this cost
+// to the allocation.
+//
+///Thread Safety
+///-------------
+// `bdlma::HugePageAllocator` is fully thread-safe (see `bsldoc_glossary`).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Arena with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large, randomly accessed table of price levels,
+// allocated from a `bdlma::SequentialAllocator` arena.  We supply the arena
+// with huge pages, on the NUMA node of the thread that will access the table.
+//
+// First, we create a huge-page allocator, requesting transparent huge pages
+// on node 0, pre-faulted so that the first pass over the table incurs no page
+// faults:
+// ```
+// bdlma::HugePageAllocator hugePageAllocator(
+//                                   bdlma::HugePageAllocator::e_TRANSPARENT,
+//                                   0,
+//                                   bdlma::HugePageAllocator::e_PREFAULT);
+// ```
+// Then, we create an arena obtaining its buffers from the huge-page
+// allocator.  We supply an initial buffer size of one huge page, so that each
+// buffer obtained by the arena is backed by huge pages:
+// ```
+// bdlma::SequentialAllocator arena(hugePageAllocator.hugePageSize(),
+//                                  &hugePageAllocator);
+// ```
+// Next, we allocate the table from the arena, and use it:
+// ```
+// const int  numLevels = 100000;
+// double    *levels    = static_cast<double *>(
+//                               arena.allocate(numLevels * sizeof(double)));
+//
+// for (int i = 0; i < numLevels; ++i) {
+//     levels[i] = i * 0.01;
+// }
+// assert(hugePageAllocator.numBytesMapped() >=
+//                            static_cast<bsls::Types::Int64>(
+//                                           numLevels * sizeof(double)));
+// ```
+// Finally, we note that the memory is returned to the operating system when
+// the arena releases it:
+// ```
+// arena.release();
+// assert(0 == hugePageAllocator.numBytesMapped());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+/// This class defines a concrete thread-safe allocator mechanism that
+/// implements the `bslma::Allocator` protocol by mapping each block of
+/// memory directly from the operating system, optionally backed by huge
+/// pages, placed on a preferred NUMA node, and pre-faulted, according to
+/// the options (optionally) supplied at construction.  Note that, like
+/// `bdlma::GuardingAllocator`, an allocator cannot be supplied at
+/// construction.
+class HugePageAllocator : public bslma::Allocator {
+
+  public:
+    // TYPES
+
+    /// Enumerate the ways in which blocks of at least one huge page may be
+    /// backed (see {Huge Pages}).
+    enum HugePageMode {
+        e_NONE,         // regular pages
+        e_TRANSPARENT,  // transparent huge pages, if available
+        e_EXPLICIT      // reserved huge pages, else transparent huge pages
+    };
+
+    /// Enumerate whether the pages of a block are touched on allocation
+    /// (see {Pre-Faulting}).
+    enum PrefaultMode {
+        e_NO_PREFAULT,  // pages are assigned on first access
+        e_PREFAULT      // pages are assigned by `allocate`
+    };
+
+    enum {
+        k_NO_NUMA_NODE = -1  // no preferred NUMA node
+    };
+
+  private:
+    // DATA
+    HugePageMode                d_hugePageMode;     // huge-page backing
+
+    int                         d_numaNode;         // preferred NUMA node,
+                                                    // or `k_NO_NUMA_NODE`
+
+    PrefaultMode                d_prefaultMode;     // pre-fault on allocation
+
+    bsls::Types::size_type      d_pageSize;         // system page size
+
+    bsls::Types::size_type      d_hugePageSize;     // system huge page size
+
+    bsls::AtomicInt64           d_numBytesMapped;   // bytes currently mapped
+
+    bsls::AtomicInt             d_numHugeTlbFallbacks;
+                                                    // `e_EXPLICIT` requests
+                                                    // not served from the
+                                                    // huge-page pool
+
+    bsls::AtomicInt             d_numNumaBindFailures;
+                                                    // failures to set the NUMA
+                                                    // policy of a block
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+  public:
+    // CREATORS
+
+    /// Create a huge-page allocator.  Optionally specify a `hugePageMode`
+    /// indicating how blocks of at least `hugePageSize()` bytes are backed;
+    /// if `hugePageMode` is not specified, `e_TRANSPARENT` is used.
+    /// Optionally specify a `numaNode` on which pages are preferably
+    /// placed; if `numaNode` is not specified, or is `k_NO_NUMA_NODE`, the
+    /// default NUMA policy applies.  Optionally specify a `prefaultMode`
+    /// indicating whether `allocate` touches every page of a block; if
+    /// `prefaultMode` is not specified, `e_NO_PREFAULT` is used.  The
+    /// behavior is undefined unless `k_NO_NUMA_NODE <= numaNode < 1024`.
+    explicit
+    HugePageAllocator(HugePageMode hugePageMode = e_TRANSPARENT,
+                      int          numaNode     = k_NO_NUMA_NODE,
+                      PrefaultMode prefaultMode = e_NO_PREFAULT);
+
+    /// Destroy this allocator object.  Note that destroying this allocator
+    /// has no effect on any outstanding allocated memory.
+    ~HugePageAllocator() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Return a newly-allocated block of memory of (at least) the specified
+    /// positive `size` (in bytes), mapped from the operating system as
+    /// configured at construction.  If `size` is 0, a null pointer is
+    /// returned with no other effect.  If the memory cannot be mapped, a
+    /// `bsl::bad_alloc` exception is thrown (or, if exceptions are
+    /// disabled, 0 is returned).  The returned block is maximally aligned.
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the memory block at the specified `address` back to the
+    /// operating system.  If `address` is 0, this function has no effect.
+    /// The behavior is undefined unless `address` was allocated using this
+    /// allocator object and has not already been deallocated.
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the huge-page mode of this allocator.
+    HugePageMode hugePageMode() const;
+
+    /// Return the size (in bytes) of a huge page on this system, or of a
+    /// regular page if huge pages are not supported on this platform.
+    bsls::Types::size_type hugePageSize() const;
+
+    /// Return the number of `allocate` requests, made in `e_EXPLICIT` mode,
+    /// that could not be served from the pre-reserved huge-page pool.
+    int numHugeTlbFallbacks() const;
+
+    /// Return the number of bytes currently mapped by this allocator,
+    /// including the rounding of each block to a whole number of pages.
+    bsls::Types::Int64 numBytesMapped() const;
+
+    /// Return the number of `allocate` requests for which the NUMA policy
+    /// could not be set.
+    int numNumaBindFailures() const;
+
+    /// Return the preferred NUMA node of this allocator, or
+    /// `k_NO_NUMA_NODE` if none was supplied.
+    int numaNode() const;
+
+    /// Return the size (in bytes) of a regular page on this system.
+    bsls::Types::size_type pageSize() const;
+
+    /// Return the pre-fault mode of this allocator.
+    PrefaultMode prefaultMode() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+HugePageAllocator::HugePageMode HugePageAllocator::hugePageMode() const
+{
+    return d_hugePageMode;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::hugePageSize() const
+{
+    return d_hugePageSize;
+}
+
+inline
+int HugePageAllocator::numHugeTlbFallbacks() const
+{
+    return d_numHugeTlbFallbacks.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 HugePageAllocator::numBytesMapped() const
+{
+    return d_numBytesMapped.loadRelaxed();
+}
+
+inline
+int HugePageAllocator::numNumaBindFailures() const
+{
+    return d_numNumaBindFailures.loadRelaxed();
+}
+
+inline
+int HugePageAllocator::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::pageSize() const
+{
+    return d_pageSize;
+}
+
+inline
+HugePageAllocator::PrefaultMode HugePageAllocator::prefaultMode() const
+{
+    return d_prefaultMode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,966 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_concurrentpool.h>
+#include <bdlma_multipool.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/mman.h>  // `mincore`
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlma::HugePageAllocator` maps memory directly from the operating system.
+// Whether a mapping is actually backed by huge pages, or placed on a given
+// NUMA node, depends on the configuration of the host, and cannot be
+// verified portably; we verify instead the observable contract: the size and
+// alignment of the mappings (through `numBytesMapped` and the addresses
+// returned), the accounting of huge-page and NUMA failures, the residency of
+// pre-faulted pages (on Linux, through `mincore`), and the use of the
+// allocator as the upstream allocator of the memory managers of this
+// package, from several threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HugePageAllocator(HugePageMode, int numaNode, PrefaultMode);
+// [ 2] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] HugePageMode hugePageMode() const;
+// [ 2] bsls::Types::size_type hugePageSize() const;
+// [ 3] int numHugeTlbFallbacks() const;
+// [ 3] bsls::Types::Int64 numBytesMapped() const;
+// [ 4] int numNumaBindFailures() const;
+// [ 2] int numaNode() const;
+// [ 2] bsls::Types::size_type pageSize() const;
+// [ 2] PrefaultMode prefaultMode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: UPSTREAM OF MEMORY MANAGERS
+// [ 6] CONCERN: THREAD SAFETY
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: RANDOM ACCESS OVER A LARGE ARENA
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::Int64       Int64;
+
+const int k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// Size of the header preceding each block.
+
+const size_type k_HEADER_SIZE = k_MAX_ALIGN;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND TYPES
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the specified `size` rounded up to the nearest multiple of the
+/// specified `boundary`.
+size_type roundUp(size_type size, size_type boundary)
+{
+    return (size + boundary - 1) / boundary * boundary;
+}
+
+/// Return `true` if the specified `value` is a power of 2, and `false`
+/// otherwise.
+bool isPowerOfTwo(size_type value)
+{
+    return value && 0 == (value & (value - 1));
+}
+
+/// Return the number of the pages of the specified `pageSize` in the
+/// specified `size` bytes at the specified page-aligned `address` that are
+/// resident in memory, or -1 if residency cannot be determined on this
+/// platform.
+int numResidentPages(void *address, size_type size, size_type pageSize)
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    const size_type              numPages = (size + pageSize - 1) / pageSize;
+    bsl::vector<unsigned char>   residency(numPages);
+
+    if (0 != mincore(address, size, residency.data())) {
+        return -1;                                                    // RETURN
+    }
+
+    int count = 0;
+    for (size_type i = 0; i < numPages; ++i) {
+        count += residency[i] & 1;
+    }
+    return count;
+#else
+    (void)address;
+    (void)size;
+    (void)pageSize;
+    return -1;
+#endif
+}
+
+/// Return the amount (in kilobytes) of anonymous memory backed by
+/// transparent huge pages in this system, or -1 if it cannot be determined.
+Int64 anonHugePagesKb()
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    FILE *meminfo = bsl::fopen("/proc/meminfo", "r");
+    if (!meminfo) {
+        return -1;                                                    // RETURN
+    }
+
+    Int64 result = -1;
+    char  line[256];
+    while (bsl::fgets(line, sizeof line, meminfo)) {
+        long long value;
+        if (1 == bsl::sscanf(line, "AnonHugePages: %lld kB", &value)) {
+            result = value;
+            break;                                                     // BREAK
+        }
+    }
+    bsl::fclose(meminfo);
+    return result;
+#else
+    return -1;
+#endif
+}
+
+/// This `struct` is a node of a cyclic list occupying one cache line.
+struct ChaseNode {
+    ChaseNode *d_next_p;
+    char       d_padding[64 - sizeof(ChaseNode *)];
+};
+
+/// Link the specified `numNodes` nodes at the specified `nodes` into a
+/// single random cycle (using Sattolo's algorithm, seeded with the specified
+/// `seed`), follow the specified `numSteps` links from the first node, and
+/// return the average time (in nanoseconds) per step.
+double chase(ChaseNode *nodes, size_type numNodes, int numSteps, unsigned seed)
+{
+    bsl::vector<size_type> order(numNodes);
+    for (size_type i = 0; i < numNodes; ++i) {
+        order[i] = i;
+    }
+
+    unsigned long long state = seed;
+    for (size_type i = numNodes - 1; i > 0; --i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const size_type j = static_cast<size_type>(state >> 33) % i;
+        const size_type tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+    for (size_type i = 0; i < numNodes; ++i) {
+        nodes[order[i]].d_next_p = &nodes[order[(i + 1) % numNodes]];
+    }
+
+    bsls::Stopwatch sw;
+    sw.start();
+
+    ChaseNode *node = nodes;
+    for (int i = 0; i < numSteps; ++i) {
+        node = node->d_next_p;
+    }
+
+    sw.stop();
+
+    // Prevent the loop from being optimized away.
+
+    if (0 == node) {
+        cout << "unreachable" << endl;
+    }
+    return sw.elapsedTime() * 1e9 / numSteps;
+}
+
+/// Allocate and deallocate, through the `bdlma::ConcurrentPool` at the
+/// specified `pool` address, blocks of memory, writing to each.
+extern "C" void *hugePageAllocatorThread(void *pool)
+{
+    bdlma::ConcurrentPool *mX = static_cast<bdlma::ConcurrentPool *>(pool);
+
+    bsl::vector<void *> blocks;
+    blocks.reserve(1000);
+
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            void *p = mX->allocate();
+            bsl::memset(p, round, mX->blockSize());
+            blocks.push_back(p);
+        }
+        for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+            mX->deallocate(blocks[i]);
+        }
+        blocks.clear();
+    }
+    return 0;
+}
+
+/// Allocate and deallocate, through the `bdlma::HugePageAllocator` at the
+/// specified `allocator` address, blocks of various sizes, writing to each.
+extern "C" void *hugePageAllocatorDirectThread(void *allocator)
+{
+    Obj *mX = static_cast<Obj *>(allocator);
+
+    for (int i = 0; i < 200; ++i) {
+        const size_type size = 1 + (i * 7919) % (3 * 1024 * 1024);
+        char           *p    = static_cast<char *>(mX->allocate(size));
+
+        p[0]        = 1;
+        p[size - 1] = 1;
+
+        mX->deallocate(p);
+    }
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Backing an Arena with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large, randomly accessed table of price levels,
+// allocated from a `bdlma::SequentialAllocator` arena.  We supply the arena
+// with huge pages, on the NUMA node of the thread that will access the table.
+//
+// First, we create a huge-page allocator, requesting transparent huge pages
+// on node 0, pre-faulted so that the first pass over the table incurs no page
+// faults:
+// ```
+    bdlma::HugePageAllocator hugePageAllocator(
+                                      bdlma::HugePageAllocator::e_TRANSPARENT,
+                                      0,
+                                      bdlma::HugePageAllocator::e_PREFAULT);
+// ```
+// Then, we create an arena obtaining its buffers from the huge-page
+// allocator.  We supply an initial buffer size of one huge page, so that each
+// buffer obtained by the arena is backed by huge pages:
+// ```
+    bdlma::SequentialAllocator arena(hugePageAllocator.hugePageSize(),
+                                     &hugePageAllocator);
+// ```
+// Next, we allocate the table from the arena, and use it:
+// ```
+    const int  numLevels = 100000;
+    double    *levels    = static_cast<double *>(
+                                  arena.allocate(numLevels * sizeof(double)));
+
+    for (int i = 0; i < numLevels; ++i) {
+        levels[i] = i * 0.01;
+    }
+    ASSERT(hugePageAllocator.numBytesMapped() >=
+                               static_cast<bsls::Types::Int64>(
+                                              numLevels * sizeof(double)));
+// ```
+// Finally, we note that the memory is returned to the operating system when
+// the arena releases it:
+// ```
+    arena.release();
+    ASSERT(0 == hugePageAllocator.numBytesMapped());
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        // 1. The allocator may be used concurrently from several threads,
+        //    directly or as the upstream allocator of a thread-safe pool, and
+        //    its statistics remain consistent.
+        //
+        // Plan:
+        // 1. Allocate and deallocate blocks of various sizes directly from
+        //    several threads, and verify that no memory remains mapped.
+        //
+        // 2. Allocate and deallocate blocks from a `bdlma::ConcurrentPool`
+        //    supplied by the allocator from several threads.  Destroy the
+        //    pool, and verify that no memory remains mapped.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        Obj mX(Obj::e_TRANSPARENT);
+
+        {
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                                              &handles[i],
+                                              u::hugePageAllocatorDirectThread,
+                                              &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            ASSERTV(mX.numBytesMapped(), 0 == mX.numBytesMapped());
+        }
+
+        {
+            bdlma::ConcurrentPool pool(48,
+                                       bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                       1 << 16,
+                                       &mX);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                                                    &handles[i],
+                                                    u::hugePageAllocatorThread,
+                                                    &pool));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            ASSERT(0 < mX.numBytesMapped());
+        }
+        ASSERTV(mX.numBytesMapped(), 0 == mX.numBytesMapped());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: UPSTREAM OF MEMORY MANAGERS
+        //
+        // Concerns:
+        // 1. The allocator supplies the chunks of a
+        //    `bdlma::SequentialAllocator`, a `bdlma::Multipool`, and a
+        //    `bdlma::ConcurrentPool`, whose memory is usable, and which
+        //    return all the memory to it on release and destruction.
+        //
+        // Plan:
+        // 1. For each huge-page mode, fill each memory manager with blocks
+        //    obtained from the allocator, write to the blocks, and verify
+        //    that the blocks are distinct.  Release (or destroy) the memory
+        //    manager, and verify that no memory remains mapped.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: UPSTREAM OF MEMORY MANAGERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: UPSTREAM OF MEMORY MANAGERS" << endl
+                          << "====================================" << endl;
+
+        const Obj::HugePageMode MODES[] = {
+            Obj::e_NONE, Obj::e_TRANSPARENT, Obj::e_EXPLICIT
+        };
+
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        for (int mi = 0; mi < 3; ++mi) {
+            const Obj::HugePageMode MODE = MODES[mi];
+
+            Obj mX(MODE);  const Obj& X = mX;
+
+            if (veryVerbose) { T_ P(MODE) }
+
+            {
+                bdlma::SequentialAllocator arena(X.hugePageSize(), &mX);
+
+                char *previous = 0;
+                for (int i = 0; i < 100000; ++i) {
+                    char *p = static_cast<char *>(arena.allocate(100));
+                    bsl::memset(p, i & 0xff, 100);
+                    ASSERTV(MODE, i, p != previous);
+                    previous = p;
+                }
+                ASSERT(100000 * 100 <= X.numBytesMapped());
+
+                arena.release();
+                ASSERTV(MODE, X.numBytesMapped(), 0 == X.numBytesMapped());
+            }
+
+            {
+                bdlma::Multipool multipool(8,
+                                           bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                           1024,
+                                           &mX);
+
+                bsl::vector<char *> blocks(&sa);
+                for (int i = 0; i < 50000; ++i) {
+                    const int size = 8 << (i % 8);
+                    char     *p    = static_cast<char *>(
+                                                    multipool.allocate(size));
+                    bsl::memset(p, i & 0xff, size);
+                    blocks.push_back(p);
+                }
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    ASSERTV(MODE, i,
+                            static_cast<char>(i & 0xff) == blocks[i][0]);
+                    multipool.deallocate(blocks[i]);
+                }
+            }
+            ASSERTV(MODE, X.numBytesMapped(), 0 == X.numBytesMapped());
+
+            {
+                bdlma::ConcurrentPool pool(64,
+                                           bsls::BlockGrowth::BSLS_CONSTANT,
+                                           1 << 15,
+                                           &mX);
+
+                bsl::vector<void *> blocks(&sa);
+                for (int i = 0; i < 100000; ++i) {
+                    void *p = pool.allocate();
+                    bsl::memset(p, i & 0xff, 64);
+                    blocks.push_back(p);
+                }
+
+                // Each chunk exceeds one huge page.
+
+                ASSERTV(MODE, 4 <= X.numBytesMapped() / (1 << 20));
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    pool.deallocate(blocks[i]);
+                }
+            }
+            ASSERTV(MODE, X.numBytesMapped(), 0 == X.numBytesMapped());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // NUMA PLACEMENT AND PRE-FAULTING
+        //
+        // Concerns:
+        // 1. Requesting a NUMA node that exists (node 0 on any Linux host
+        //    supporting NUMA) does not prevent allocation.
+        //
+        // 2. A failure to set the NUMA policy (for a node that does not exist)
+        //    is counted by `numNumaBindFailures`, and is not an error.
+        //
+        // 3. Without pre-faulting, the pages of a fresh block are not
+        //    resident; with pre-faulting, they are all resident.
+        //
+        // Plan:
+        // 1. Allocate blocks from allocators requesting node 0, node 1023,
+        //    and no node; write to the blocks, and verify the failure
+        //    counts.  (C-1..2)
+        //
+        // 2. On Linux, use `mincore` to count the resident pages of blocks
+        //    allocated with and without pre-faulting.  (C-3)
+        //
+        // Testing:
+        //   int numNumaBindFailures() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NUMA PLACEMENT AND PRE-FAULTING" << endl
+                          << "===============================" << endl;
+
+        const size_type SIZES[] = { 1, 5000, 3 * 1024 * 1024 };
+
+        if (verbose) cout << "\nTesting NUMA placement." << endl;
+        {
+            Obj mA(Obj::e_TRANSPARENT, 0);     const Obj& A = mA;
+            Obj mB(Obj::e_TRANSPARENT, 1023);  const Obj& B = mB;
+            Obj mC(Obj::e_TRANSPARENT);        const Obj& C = mC;
+
+            for (int i = 0; i < 3; ++i) {
+                const size_type SIZE = SIZES[i];
+
+                char *a = static_cast<char *>(mA.allocate(SIZE));
+                char *b = static_cast<char *>(mB.allocate(SIZE));
+                char *c = static_cast<char *>(mC.allocate(SIZE));
+
+                bsl::memset(a, 1, SIZE);
+                bsl::memset(b, 2, SIZE);
+                bsl::memset(c, 3, SIZE);
+
+                mA.deallocate(a);
+                mB.deallocate(b);
+                mC.deallocate(c);
+            }
+
+            if (veryVerbose) {
+                P_(A.numNumaBindFailures());  P(B.numNumaBindFailures());
+            }
+
+            ASSERTV(A.numNumaBindFailures(), A.numNumaBindFailures() <= 3);
+            ASSERTV(B.numNumaBindFailures(), 3 == B.numNumaBindFailures());
+            ASSERTV(C.numNumaBindFailures(), 0 == C.numNumaBindFailures());
+        }
+
+        if (verbose) cout << "\nTesting pre-faulting." << endl;
+        {
+            Obj mLazy(Obj::e_NONE);
+            Obj mEager(Obj::e_NONE, Obj::k_NO_NUMA_NODE, Obj::e_PREFAULT);
+
+            const size_type PAGE_SIZE = mLazy.pageSize();
+
+            for (int i = 0; i < 3; ++i) {
+                const size_type SIZE  = SIZES[i];
+                const size_type BYTES = u::roundUp(SIZE + k_HEADER_SIZE,
+                                                   PAGE_SIZE);
+                const int       PAGES = static_cast<int>(BYTES / PAGE_SIZE);
+
+                char *lazy  = static_cast<char *>(mLazy.allocate(SIZE));
+                char *eager = static_cast<char *>(mEager.allocate(SIZE));
+
+                const int LAZY  = u::numResidentPages(lazy - k_HEADER_SIZE,
+                                                      BYTES,
+                                                      PAGE_SIZE);
+                const int EAGER = u::numResidentPages(eager - k_HEADER_SIZE,
+                                                      BYTES,
+                                                      PAGE_SIZE);
+
+                if (veryVerbose) { T_ P_(SIZE) P_(PAGES) P_(LAZY) P(EAGER) }
+
+                if (-1 != LAZY) {
+                    // Only the page holding the header has been written.
+
+                    ASSERTV(SIZE, LAZY, 1 == LAZY);
+                    ASSERTV(SIZE, EAGER, PAGES, PAGES == EAGER);
+                }
+
+                mLazy.deallocate(lazy);
+                mEager.deallocate(eager);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        // 1. `allocate` returns 0 for a size of 0, and `deallocate` has no
+        //    effect for a null address.
+        //
+        // 2. `allocate` returns a maximally-aligned, writable block, preceded
+        //    by a header at the start of its mapping.
+        //
+        // 3. Blocks smaller than one huge page, or allocated in `e_NONE` mode,
+        //    are mapped on regular pages; in `e_TRANSPARENT` mode, larger
+        //    blocks are mapped at a huge-page boundary, rounded up to a
+        //    regular page; in `e_EXPLICIT` mode, larger blocks are mapped on
+        //    whole huge pages, or else counted as fallbacks, and mapped as in
+        //    `e_TRANSPARENT` mode.
+        //
+        // 4. `deallocate` unmaps the block.
+        //
+        // Plan:
+        // 1. For each mode, and a set of sizes about the huge-page size,
+        //    allocate a block, write to all of it, and verify its alignment,
+        //    the number of bytes mapped, and the number of fallbacks.
+        //    Deallocate the block and verify that no memory is mapped.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   int numHugeTlbFallbacks() const;
+        //   bsls::Types::Int64 numBytesMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        const Obj::HugePageMode MODES[] = {
+            Obj::e_NONE, Obj::e_TRANSPARENT, Obj::e_EXPLICIT
+        };
+
+        for (int mi = 0; mi < 3; ++mi) {
+            const Obj::HugePageMode MODE = MODES[mi];
+
+            Obj mX(MODE);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == X.numBytesMapped());
+
+            const size_type PAGE = X.pageSize();
+            const size_type HUGE_PAGE = X.hugePageSize();
+            const bool      HUGE_SUPPORTED = HUGE_PAGE > PAGE;
+
+            const size_type SIZES[] = {
+                1,
+                PAGE - k_HEADER_SIZE,
+                PAGE - k_HEADER_SIZE + 1,
+                HUGE_PAGE - k_HEADER_SIZE - 1,
+                HUGE_PAGE - k_HEADER_SIZE,
+                HUGE_PAGE,
+                2 * HUGE_PAGE + 100,
+            };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const size_type SIZE = SIZES[si];
+                const bool      LARGE = HUGE_SUPPORTED
+                                     && SIZE + k_HEADER_SIZE >= HUGE_PAGE
+                                     && Obj::e_NONE != MODE;
+
+                const int FALLBACKS = X.numHugeTlbFallbacks();
+
+                char *p = static_cast<char *>(mX.allocate(SIZE));
+
+                ASSERTV(MODE, SIZE, p);
+                const bsls::Types::UintPtr ADDRESS =
+                                     reinterpret_cast<bsls::Types::UintPtr>(p);
+                const bsls::Types::UintPtr BASE = ADDRESS - k_HEADER_SIZE;
+
+                ASSERTV(MODE, SIZE, 0 == ADDRESS % k_MAX_ALIGN);
+
+                ASSERTV(MODE, SIZE, 0 == BASE % PAGE);
+
+                bsl::memset(p, 0x5a, SIZE);
+
+                size_type EXP = u::roundUp(SIZE + k_HEADER_SIZE, PAGE);
+                if (LARGE && Obj::e_EXPLICIT == MODE
+                          && FALLBACKS == X.numHugeTlbFallbacks()) {
+                    EXP = u::roundUp(SIZE + k_HEADER_SIZE, HUGE_PAGE);
+                }
+                if (LARGE) {
+                    ASSERTV(MODE, SIZE, 0 == BASE % HUGE_PAGE);
+                }
+                if (!LARGE || Obj::e_EXPLICIT != MODE) {
+                    ASSERTV(MODE, SIZE, FALLBACKS == X.numHugeTlbFallbacks());
+                }
+                else {
+                    ASSERTV(MODE, SIZE, FALLBACKS + 1 >=
+                                                     X.numHugeTlbFallbacks());
+                }
+
+                ASSERTV(MODE, SIZE, EXP, X.numBytesMapped(),
+                        static_cast<Int64>(EXP) == X.numBytesMapped());
+
+                mX.deallocate(p);
+                ASSERTV(MODE, SIZE, 0 == X.numBytesMapped());
+            }
+
+            if (veryVerbose) { T_ P_(MODE) P(X.numHugeTlbFallbacks()) }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The default constructor selects transparent huge pages, no NUMA
+        //    node, and no pre-faulting.
+        //
+        // 2. The options supplied at construction are reported by the
+        //    accessors.
+        //
+        // 3. The page size and huge-page size are powers of 2, the latter not
+        //    smaller than the former.
+        //
+        // 4. No memory is mapped by a new allocator.
+        //
+        // Plan:
+        // 1. Create allocators with default and explicit options and verify
+        //    the accessors.  (C-1..4)
+        //
+        // Testing:
+        //   HugePageAllocator(HugePageMode, int numaNode, PrefaultMode);
+        //   ~HugePageAllocator();
+        //   HugePageMode hugePageMode() const;
+        //   bsls::Types::size_type hugePageSize() const;
+        //   int numaNode() const;
+        //   bsls::Types::size_type pageSize() const;
+        //   PrefaultMode prefaultMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT  == X.hugePageMode());
+            ASSERT(Obj::k_NO_NUMA_NODE == X.numaNode());
+            ASSERT(Obj::e_NO_PREFAULT  == X.prefaultMode());
+
+            ASSERTV(X.pageSize(), u::isPowerOfTwo(X.pageSize()));
+            ASSERTV(X.hugePageSize(), u::isPowerOfTwo(X.hugePageSize()));
+            ASSERTV(X.pageSize(), X.hugePageSize(),
+                    X.pageSize() <= X.hugePageSize());
+
+            ASSERT(0 == X.numBytesMapped());
+            ASSERT(0 == X.numHugeTlbFallbacks());
+            ASSERT(0 == X.numNumaBindFailures());
+
+            if (veryVerbose) { P_(X.pageSize())  P(X.hugePageSize()) }
+        }
+
+        {
+            Obj mX(Obj::e_EXPLICIT, 3, Obj::e_PREFAULT);  const Obj& X = mX;
+
+            ASSERT(Obj::e_EXPLICIT == X.hugePageMode());
+            ASSERT(3               == X.numaNode());
+            ASSERT(Obj::e_PREFAULT == X.prefaultMode());
+        }
+
+        {
+            Obj mX(Obj::e_NONE);  const Obj& X = mX;
+
+            ASSERT(Obj::e_NONE         == X.hugePageMode());
+            ASSERT(Obj::k_NO_NUMA_NODE == X.numaNode());
+            ASSERT(Obj::e_NO_PREFAULT  == X.prefaultMode());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Allocate a small and a large block, write to them, and
+        //    deallocate them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        char *p = static_cast<char *>(mX.allocate(100));
+        char *q = static_cast<char *>(mX.allocate(4 * X.hugePageSize()));
+
+        ASSERT(p);
+        ASSERT(q);
+
+        bsl::memset(p, 1, 100);
+        bsl::memset(q, 2, 4 * X.hugePageSize());
+
+        ASSERT(static_cast<Int64>(4 * X.hugePageSize() + 100) <=
+                                                          X.numBytesMapped());
+
+        mX.deallocate(p);
+        mX.deallocate(q);
+
+        ASSERT(0 == X.numBytesMapped());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANDOM ACCESS OVER A LARGE ARENA
+        //
+        // Concerns:
+        // 1. Measure the effect of huge pages on the cost of random accesses
+        //    over an arena much larger than the reach of the TLB.
+        //
+        // Plan:
+        // 1. Allocate an arena (of 256 MB, or of the number of megabytes
+        //    given as the second argument) through a
+        //    `bdlma::SequentialAllocator` supplied, in turn, by
+        //    `bslma::NewDeleteAllocator`, and by `bdlma::HugePageAllocator`
+        //    in `e_NONE`, `e_TRANSPARENT`, and `e_EXPLICIT` modes (all
+        //    pre-faulted).
+        //    Link its cache-line-sized nodes into a random cycle, and report
+        //    the average time of following a link, and the memory backed by
+        //    transparent huge pages.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: RANDOM ACCESS OVER A LARGE ARENA
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: RANDOM ACCESS OVER A LARGE ARENA" << endl
+             << "=============================================" << endl;
+
+        const int       ARENA_MB  = argc > 2 && 0 < bsl::atoi(argv[2])
+                                  ? bsl::atoi(argv[2])
+                                  : 256;
+        const size_type ARENA     = static_cast<size_type>(ARENA_MB) << 20;
+        const size_type NUM_NODES = ARENA / sizeof(u::ChaseNode);
+        const int       NUM_STEPS = 20 * 1000 * 1000;
+
+        cout << "arena: " << ARENA_MB << " MB, " << NUM_NODES << " nodes, "
+             << NUM_STEPS << " steps" << endl;
+
+        const char *NAMES[] = {
+            "bslma::NewDeleteAllocator       ",
+            "HugePageAllocator(e_NONE)       ",
+            "HugePageAllocator(e_TRANSPARENT)",
+            "HugePageAllocator(e_EXPLICIT)   ",
+        };
+
+        for (int ai = 0; ai < 4; ++ai) {
+            Obj mH(0 == ai ? Obj::e_NONE
+                           : static_cast<Obj::HugePageMode>(ai - 1),
+                   Obj::k_NO_NUMA_NODE,
+                   Obj::e_PREFAULT);
+
+            bslma::Allocator *upstream = 0 == ai
+                               ? &bslma::NewDeleteAllocator::singleton()
+                               : static_cast<bslma::Allocator *>(&mH);
+
+            const Int64 HUGE_BEFORE = u::anonHugePagesKb();
+
+            bdlma::SequentialAllocator arena(upstream);
+
+            u::ChaseNode *nodes = static_cast<u::ChaseNode *>(
+                                                       arena.allocate(ARENA));
+
+            const Int64 HUGE_AFTER = u::anonHugePagesKb();
+
+            const double NS = u::chase(nodes, NUM_NODES, NUM_STEPS, 12345);
+
+            cout << NAMES[ai] << ": " << NS << " ns/access";
+            if (-1 != HUGE_BEFORE && -1 != HUGE_AFTER) {
+                cout << ", transparent huge pages: "
+                     << (HUGE_AFTER - HUGE_BEFORE) / 1024 << " MB";
+            }
+            if (0 != ai) {
+                cout << ", huge TLB fallbacks: " << mH.numHugeTlbFallbacks();
+            }
+            cout << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,244 @@
+// bdlma_sizedmultipool.cpp                                           -*-C++-*-
+#include <bdlma_sizedmultipool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sizedmultipool_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+
+// TYPES
+enum {
+    k_DEFAULT_MAX_BLOCK_SIZE = 4096,     // default largest pooled size
+
+    k_DEFAULT_MAX_CHUNK_SIZE = 32,       // default maximum number of blocks
+                                         // per chunk
+
+    k_QUANTUM                = 16,       // spacing of the small size classes
+
+    k_NUM_SMALL_CLASSES      = 8,        // size classes up to 128 bytes
+
+    k_LOG2_SMALL_LIMIT       = 7,        // log2 of 128
+
+    k_CLASSES_PER_DOUBLING   = 4,        // size classes between consecutive
+                                         // powers of two above 128 bytes
+
+    k_MAX_BLOCK_SIZE         = 1 << 30   // largest supported pooled size
+};
+
+BSLMF_ASSERT(static_cast<int>(k_QUANTUM) %
+                              bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT == 0);
+
+/// Return the index of the smallest size class not less than the specified
+/// `size`.  The behavior is undefined unless `1 <= size`.
+inline
+int sizeClassIndex(bsls::Types::size_type size)
+{
+    if (size <= k_NUM_SMALL_CLASSES * k_QUANTUM) {
+        return static_cast<int>((size + k_QUANTUM - 1) / k_QUANTUM) - 1;
+                                                                      // RETURN
+    }
+
+    // Above 128 bytes, `size - 1` lies in `[2^p, 2^(p + 1))` for some
+    // `p >= 7`, which is divided into four size classes of `2^(p - 2)` bytes.
+
+    const bsl::uint64_t s = size - 1;
+    const int           p = 63 - bdlb::BitUtil::numLeadingUnsetBits(s);
+
+    return k_NUM_SMALL_CLASSES
+         + (p - k_LOG2_SMALL_LIMIT) * k_CLASSES_PER_DOUBLING
+         + static_cast<int>((s - (bsl::uint64_t(1) << p)) >> (p - 2));
+}
+
+/// Return the block size of the size class having the specified `index`.
+/// The behavior is undefined unless `0 <= index`.
+inline
+bsls::Types::size_type sizeClassSize(int index)
+{
+    if (index < k_NUM_SMALL_CLASSES) {
+        return static_cast<bsls::Types::size_type>(index + 1) * k_QUANTUM;
+                                                                      // RETURN
+    }
+
+    const int j = index - k_NUM_SMALL_CLASSES;
+    const int p = k_LOG2_SMALL_LIMIT + j / k_CLASSES_PER_DOUBLING;
+    const int k = j % k_CLASSES_PER_DOUBLING;
+
+    return (bsls::Types::size_type(1) << p)
+         + (bsls::Types::size_type(1) << (p - 2)) * (k + 1);
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // class SizedMultipool
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+void SizedMultipool::initialize(bsls::Types::size_type      maxBlockSize,
+                                bsls::BlockGrowth::Strategy growthStrategy,
+                                int                         maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= maxBlockSize);
+    BSLS_ASSERT(maxBlockSize <= k_MAX_BLOCK_SIZE);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    d_numPools     = sizeClassIndex(maxBlockSize) + 1;
+    d_maxBlockSize = sizeClassSize(d_numPools - 1);
+
+    d_pools_p = static_cast<Pool *>(
+                      d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                                d_pools_p,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Pool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_pools_p + i) Pool(sizeClassSize(i),
+                                 growthStrategy,
+                                 maxBlocksPerChunk,
+                                 d_allocator_p);
+    }
+
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+}
+
+// CREATORS
+SizedMultipool::SizedMultipool(bslma::Allocator *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(k_DEFAULT_MAX_BLOCK_SIZE,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+SizedMultipool::SizedMultipool(bsls::Types::size_type  maxBlockSize,
+                               bslma::Allocator       *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(maxBlockSize,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+SizedMultipool::SizedMultipool(
+                              bsls::Types::size_type       maxBlockSize,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              int                          maxBlocksPerChunk,
+                              bslma::Allocator            *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(maxBlockSize, growthStrategy, maxBlocksPerChunk);
+}
+
+SizedMultipool::~SizedMultipool()
+{
+    BSLS_ASSERT(d_pools_p);
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(d_allocator_p);
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+        d_pools_p[i].~Pool();
+    }
+    d_allocator_p->deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void *SizedMultipool::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        if (size <= d_maxBlockSize) {
+            return d_pools_p[sizeClassIndex(size)].allocate();        // RETURN
+        }
+
+        // The requested size is large and will not be pooled.
+
+        return d_blockList.allocate(size);                            // RETURN
+    }
+
+    return 0;
+}
+
+void SizedMultipool::deallocate(void *address, bsls::Types::size_type size)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(1 <= size);
+
+    if (size <= d_maxBlockSize) {
+        d_pools_p[sizeClassIndex(size)].deallocate(address);
+    }
+    else {
+        d_blockList.deallocate(address);
+    }
+}
+
+void SizedMultipool::release()
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+    }
+    d_blockList.release();
+}
+
+void SizedMultipool::reserveCapacity(bsls::Types::size_type size,
+                                     int                    numBlocks)
+{
+    BSLS_ASSERT(size <= d_maxBlockSize);
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        d_pools_p[sizeClassIndex(size)].reserveCapacity(numBlocks);
+    }
+}
+
+// ACCESSORS
+bsls::Types::size_type SizedMultipool::blockSize(
+                                            bsls::Types::size_type size) const
+{
+    if (0 == size || size > d_maxBlockSize) {
+        return size;                                                  // RETURN
+    }
+    return sizeClassSize(sizeClassIndex(size));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
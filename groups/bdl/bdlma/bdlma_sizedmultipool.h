@@ -0,0 +1,339 @@
+// bdlma_sizedmultipool.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLMA_SIZEDMULTIPOOL
+#define INCLUDED_BDLMA_SIZEDMULTIPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a header-free multipool using sized deallocation.
+//
+//@CLASSES:
+//  bdlma::SizedMultipool: multipool whose clients supply the block size
+//
+//@SEE_ALSO: bdlma_multipool, bdlma_sizedmultipoolallocator
+//
+//@DESCRIPTION: This component implements a memory manager,
+// `bdlma::SizedMultipool`, that maintains a configurable number of
+// `bdlma::Pool` objects, each dispensing maximally-aligned memory blocks of a
+// unique size, like `bdlma::Multipool`.  Unlike `bdlma::Multipool`, which
+// prepends to each block a maximally-aligned header identifying the pool of
+// the block, `bdlma::SizedMultipool` requires that the size of a block be
+// supplied when it is deallocated, and stores no per-block header.  For the
+// small blocks that dominate node-based data structures, the header of a
+// `bdlma::Multipool` can double the memory used: a 16-byte request is served
+// from the pool of 32-byte blocks (on platforms where the maximal alignment
+// is 16 bytes).  `bdlma::SizedMultipool` serves it from a 16-byte block.
+//
+// Each allocation (deallocation) request allocates memory from (returns
+// memory to) the pool managing blocks of the smallest size not less than the
+// requested size, or else from a separately managed list of memory blocks, if
+// the requested size exceeds `maxPooledBlockSize()`.  Both the `release`
+// method and the destructor of a `bdlma::SizedMultipool` release all memory
+// currently allocated via the object.
+//
+///Size Classes
+///------------
+// The block sizes of the pools (*size classes*) are spaced more closely than
+// the powers of two used by `bdlma::Multipool`, so as to limit the memory
+// lost to rounding requests up to a block size:
+//
+// * up to 128 bytes, every multiple of 16 bytes is a size class;
+// * above 128 bytes, each interval between two consecutive powers of two is
+//   divided into four size classes (e.g., 160, 192, 224, and 256 bytes).
+//
+// A request is therefore rounded up by at most 15 bytes, or 25% of its size.
+// Since each size class is a multiple of 16 bytes, every block is maximally
+// aligned on all supported platforms.  The largest pooled size,
+// `maxPooledBlockSize()`, is the smallest size class not less than the
+// (optional) maximum block size supplied at construction.  Use the
+// `blockSize` accessor to obtain the size of the block dispensed for a given
+// request.
+//
+///Sized Deallocation
+///------------------
+// The `deallocate` method of `bdlma::SizedMultipool` takes the size of the
+// block, which must be the size passed to `allocate` when the block was
+// obtained.  Standard allocators and memory resources supply this size on
+// deallocation: `bsl::allocator<T>::deallocate(p, n)` calls
+// `bsl::memory_resource::deallocate(p, n * sizeof(T), alignof(T))`, and the
+// node pools of `bslstl` containers return each chunk of nodes with its size.
+// See `bdlma_sizedmultipoolallocator` for an allocator that takes advantage
+// of this.
+//
+///Thread Safety
+///-------------
+// `bdlma::SizedMultipool` is *not* thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Fixed-Size Nodes
+/// - - - - - - - - - - - - - - - - - - -
+// In this example, we implement a minimal singly-linked stack of integers,
+// whose nodes are allocated from a `bdlma::SizedMultipool`.  Since the stack
+// knows the size of its nodes, it can deallocate them without any per-node
+// header.
+//
+// First, we define the stack:
+// ```
+// /// This class implements a stack of `int` values.
+// class IntStack {
+//
+//     // PRIVATE TYPES
+//     struct Node {
+//         Node *d_next_p;
+//         int   d_value;
+//     };
+//
+//     // DATA
+//     Node                  *d_top_p;       // top of the stack
+//     bdlma::SizedMultipool  d_multipool;   // supplies the nodes
+//
+//   public:
+//     // CREATORS
+//     explicit IntStack(bslma::Allocator *basicAllocator = 0)
+//     : d_top_p(0)
+//     , d_multipool(basicAllocator)
+//     {
+//     }
+//
+//     // MANIPULATORS
+//     void push(int value)
+//     {
+//         Node *node = static_cast<Node *>(
+//                                       d_multipool.allocate(sizeof(Node)));
+//         node->d_next_p = d_top_p;
+//         node->d_value  = value;
+//         d_top_p        = node;
+//     }
+//
+//     int pop()
+//     {
+//         Node *node = d_top_p;
+//         int   value = node->d_value;
+//         d_top_p = node->d_next_p;
+//         d_multipool.deallocate(node, sizeof(Node));
+//         return value;
+//     }
+//
+//     // ACCESSORS
+//     bool isEmpty() const
+//     {
+//         return 0 == d_top_p;
+//     }
+// };
+// ```
+// Then, we push and pop values:
+// ```
+// bslma::TestAllocator ta;
+// {
+//     IntStack stack(&ta);
+//     for (int i = 0; i < 100; ++i) {
+//         stack.push(i);
+//     }
+//     for (int i = 99; i >= 0; --i) {
+//         assert(i == stack.pop());
+//     }
+//     assert(stack.isEmpty());
+// }
+// assert(0 == ta.numBlocksInUse());
+// ```
+// Finally, we note that each 16-byte node (on 64-bit platforms) occupies a
+// 16-byte block, whereas a `bdlma::Multipool` would dispense it from a
+// 32-byte block:
+// ```
+// bdlma::SizedMultipool multipool(&ta);
+// assert(16 == multipool.blockSize(16));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_pool.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                            // ====================
+                            // class SizedMultipool
+                            // ====================
+
+/// This class implements a memory manager that maintains a configurable
+/// number of `bdlma::Pool` objects, each dispensing memory blocks of a unique
+/// size (see {Size Classes}), without a per-block header.  Each allocation
+/// (deallocation) request allocates memory from (returns memory to) the
+/// internal pool having the smallest block size not less than the requested
+/// size, or, if no pool manages memory blocks of sufficient size, from a
+/// separately managed list of memory blocks.  Both the `release` method and
+/// the destructor of a `bdlma::SizedMultipool` release all memory currently
+/// allocated via the object.
+class SizedMultipool {
+
+    // DATA
+    Pool                   *d_pools_p;       // array of memory pools, one per
+                                             // size class
+
+    int                     d_numPools;      // number of memory pools
+
+    bsls::Types::size_type  d_maxBlockSize;  // largest pooled block size;
+                                             // dispensed by the
+                                             // `d_numPools - 1`th pool
+
+    BlockList               d_blockList;     // memory manager for "large"
+                                             // memory blocks
+
+    bslma::Allocator       *d_allocator_p;   // holds (but does not own)
+                                             // allocator
+
+  private:
+    // NOT IMPLEMENTED
+    SizedMultipool(const SizedMultipool&);
+    SizedMultipool& operator=(const SizedMultipool&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Initialize this multipool with the specified `maxBlockSize`,
+    /// `growthStrategy`, and `maxBlocksPerChunk`.
+    void initialize(bsls::Types::size_type      maxBlockSize,
+                    bsls::BlockGrowth::Strategy growthStrategy,
+                    int                         maxBlocksPerChunk);
+
+  public:
+    // CREATORS
+
+    /// Create a sized multipool memory manager.  Optionally specify a
+    /// `maxBlockSize`, such that requests of at most `maxBlockSize` bytes
+    /// are served from internal pools; the size of the largest pooled block
+    /// is the smallest size class not less than `maxBlockSize`.  If
+    /// `maxBlockSize` is not specified, 4096 is used.  If `maxBlockSize` is
+    /// specified, optionally specify a `growthStrategy` indicating whether
+    /// the number of blocks allocated at once for every internal
+    /// `bdlma::Pool` should be either fixed or grow geometrically, starting
+    /// with 1, and a `maxBlocksPerChunk`, indicating the maximum number of
+    /// blocks to be allocated at once when a pool must be replenished.  If
+    /// `growthStrategy` is not specified, geometric growth is used; if
+    /// `maxBlocksPerChunk` is not specified, 32 is used.  Optionally specify
+    /// a `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `1 <= maxBlockSize <= 2^30` and
+    /// `1 <= maxBlocksPerChunk`.
+    explicit
+    SizedMultipool(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SizedMultipool(bsls::Types::size_type  maxBlockSize,
+                   bslma::Allocator       *basicAllocator = 0);
+    SizedMultipool(bsls::Types::size_type       maxBlockSize,
+                   bsls::BlockGrowth::Strategy  growthStrategy,
+                   int                          maxBlocksPerChunk,
+                   bslma::Allocator            *basicAllocator = 0);
+
+    /// Destroy this multipool.  All memory allocated from this memory pool
+    /// is released.
+    ~SizedMultipool();
+
+    // MANIPULATORS
+
+    /// Return the address of a contiguous block of maximally-aligned memory
+    /// of (at least) the specified `size` (in bytes).  If `size` is 0, no
+    /// memory is allocated and 0 is returned.  If
+    /// `size > maxPooledBlockSize()`, the memory allocation is managed
+    /// directly by the underlying allocator, and will not be pooled, but
+    /// will be deallocated when the `release` method is called, or when this
+    /// object is destroyed.
+    void *allocate(bsls::Types::size_type size);
+
+    /// Relinquish the memory block at the specified `address`, of the
+    /// specified `size` (in bytes), back to this multipool object for reuse.
+    /// The behavior is undefined unless `address` is non-zero, was allocated
+    /// by this multipool object by a call to `allocate` with the same
+    /// `size`, and has not already been deallocated.
+    void deallocate(void *address, bsls::Types::size_type size);
+
+    /// Relinquish all memory currently allocated via this multipool object.
+    void release();
+
+    /// Reserve memory from this multipool to satisfy memory requests for at
+    /// least the specified `numBlocks` having the specified `size` (in
+    /// bytes) before the pool replenishes.  If `size` is 0, this method has
+    /// no effect.  The behavior is undefined unless
+    /// `size <= maxPooledBlockSize()` and `0 <= numBlocks`.
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+
+    // ACCESSORS
+
+    /// Return the size of the block dispensed by this multipool for a
+    /// request of the specified `size` (in bytes): the smallest size class
+    /// not less than `size`, or `size` itself if `size` is 0 or
+    /// `size > maxPooledBlockSize()`.
+    bsls::Types::size_type blockSize(bsls::Types::size_type size) const;
+
+    /// Return the number of pools managed by this multipool object.
+    int numPools() const;
+
+    /// Return the maximum size of memory blocks that are pooled by this
+    /// multipool object.
+    bsls::Types::size_type maxPooledBlockSize() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to allocate memory.  Note
+    /// that this allocator can not be used to deallocate memory allocated
+    /// through this pool.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class SizedMultipool
+                            // --------------------
+
+// ACCESSORS
+inline
+int SizedMultipool::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bsls::Types::size_type SizedMultipool::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+// Aspects
+
+inline
+bslma::Allocator *SizedMultipool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,634 @@
+// bdlma_sizedmultipool.t.cpp                                         -*-C++-*-
+#include <bdlma_sizedmultipool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlma::SizedMultipool` is a memory manager whose behavior is observed
+// through the addresses of the blocks it dispenses, through the memory it
+// obtains from a test allocator, and through its accessors.  The size classes
+// are verified against their documented definition, and the absence of a
+// per-block header is verified by observing that consecutive blocks carved
+// from a chunk are exactly one size class apart.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SizedMultipool(bslma::Allocator *basicAllocator = 0);
+// [ 2] SizedMultipool(size_type maxBlockSize, Allocator *ba = 0);
+// [ 3] SizedMultipool(size_type, Strategy, int, Allocator *ba = 0);
+// [ 4] ~SizedMultipool();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address, bsls::Types::size_type size);
+// [ 4] void release();
+// [ 4] void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 2] bsls::Types::size_type blockSize(bsls::Types::size_type size) const;
+// [ 2] int numPools() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SizedMultipool Obj;
+typedef bsls::Types::size_type size_type;
+
+const int k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND TYPES
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the smallest size class not less than the specified `size`, as
+/// documented in the component header, computed by enumerating the size
+/// classes.  The behavior is undefined unless `1 <= size`.
+size_type oracleBlockSize(size_type size)
+{
+    size_type blockSize = 16;
+    while (blockSize < size) {
+        if (blockSize < 128) {
+            blockSize += 16;
+        }
+        else {
+            size_type power = 128;
+            while (power * 2 <= blockSize) {
+                power *= 2;
+            }
+            blockSize += power / 4;
+        }
+    }
+    return blockSize;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: Allocating Fixed-Size Nodes
+/// - - - - - - - - - - - - - - - - - - -
+// In this example, we implement a minimal singly-linked stack of integers,
+// whose nodes are allocated from a `bdlma::SizedMultipool`.  Since the stack
+// knows the size of its nodes, it can deallocate them without any per-node
+// header.
+//
+// First, we define the stack:
+// ```
+    /// This class implements a stack of `int` values.
+    class IntStack {
+
+        // PRIVATE TYPES
+        struct Node {
+            Node *d_next_p;
+            int   d_value;
+        };
+
+        // DATA
+        Node                  *d_top_p;       // top of the stack
+        bdlma::SizedMultipool  d_multipool;   // supplies the nodes
+
+      public:
+        // CREATORS
+        explicit IntStack(bslma::Allocator *basicAllocator = 0)
+        : d_top_p(0)
+        , d_multipool(basicAllocator)
+        {
+        }
+
+        // MANIPULATORS
+        void push(int value)
+        {
+            Node *node = static_cast<Node *>(
+                                          d_multipool.allocate(sizeof(Node)));
+            node->d_next_p = d_top_p;
+            node->d_value  = value;
+            d_top_p        = node;
+        }
+
+        int pop()
+        {
+            Node *node = d_top_p;
+            int   value = node->d_value;
+            d_top_p = node->d_next_p;
+            d_multipool.deallocate(node, sizeof(Node));
+            return value;
+        }
+
+        // ACCESSORS
+        bool isEmpty() const
+        {
+            return 0 == d_top_p;
+        }
+    };
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we push and pop values:
+// ```
+    bslma::TestAllocator ta;
+    {
+        IntStack stack(&ta);
+        for (int i = 0; i < 100; ++i) {
+            stack.push(i);
+        }
+        for (int i = 99; i >= 0; --i) {
+            ASSERT(i == stack.pop());
+        }
+        ASSERT(stack.isEmpty());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+// ```
+// Finally, we note that each 16-byte node (on 64-bit platforms) occupies a
+// 16-byte block, whereas a `bdlma::Multipool` would dispense it from a
+// 32-byte block:
+// ```
+    bdlma::SizedMultipool multipool(&ta);
+    ASSERT(16 == multipool.blockSize(16));
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELEASE, RESERVE CAPACITY, AND DESTRUCTOR
+        //
+        // Concerns:
+        // 1. `release` returns all pooled and large blocks to the allocator,
+        //    and the multipool remains usable.
+        //
+        // 2. `reserveCapacity` obtains memory for the requested number of
+        //    blocks at once, from which subsequent requests are served, and
+        //    has no effect for a size of 0.
+        //
+        // 3. The destructor returns all memory to the allocator.
+        //
+        // Plan:
+        // 1. Allocate pooled and large blocks, call `release`, and verify the
+        //    memory in use.  Allocate again.  (C-1)
+        //
+        // 2. Reserve capacity and verify that the following allocations
+        //    obtain no memory.  (C-2)
+        //
+        // 3. Destroy the multipool and verify that no memory is in use.
+        //    (C-3)
+        //
+        // Testing:
+        //   void release();
+        //   void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        //   ~SizedMultipool();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "RELEASE, RESERVE CAPACITY, AND DESTRUCTOR" << endl
+                        << "=========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(&ta);
+
+            // The array of pools.
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            ASSERTV(NUM_BLOCKS, 1 == NUM_BLOCKS);
+
+            for (size_type size = 1; size <= 10000; size += 37) {
+                mX.allocate(size);
+            }
+            ASSERT(NUM_BLOCKS < ta.numBlocksInUse());
+
+            mX.release();
+            ASSERTV(ta.numBlocksInUse(), NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.reserveCapacity(40, 10);
+            const bsls::Types::Int64 NUM_RESERVED = ta.numBlocksInUse();
+            ASSERTV(NUM_RESERVED, NUM_BLOCKS + 1 == NUM_RESERVED);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, mX.allocate(33 + i));
+            }
+            ASSERTV(ta.numBlocksInUse(), NUM_RESERVED == ta.numBlocksInUse());
+
+            mX.reserveCapacity(0, 10);
+            ASSERTV(ta.numBlocksInUse(), NUM_RESERVED == ta.numBlocksInUse());
+
+            mX.allocate(100000);
+            ASSERT(NUM_RESERVED + 1 == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        // 1. `allocate` returns 0 for a size of 0, and otherwise a
+        //    maximally-aligned block of at least the requested size, distinct
+        //    from other allocated blocks.
+        //
+        // 2. Pooled blocks have no header: consecutive blocks of a chunk are
+        //    one size class apart.
+        //
+        // 3. `deallocate` returns a pooled block to the pool of its size
+        //    class, from which it is reused.
+        //
+        // 4. Requests larger than `maxPooledBlockSize` are served from a
+        //    block obtained from the allocator, returned by `deallocate`.
+        //
+        // Plan:
+        // 1. For each size up to twice `maxPooledBlockSize`, allocate blocks
+        //    from a multipool having fixed chunks of 4 blocks, and verify
+        //    their alignment and distance.  Fill the blocks, and verify their
+        //    contents before deallocating them.  (C-1..2, 4)
+        //
+        // 2. Deallocate a block and allocate a block of another size in the
+        //    same size class; verify that the block is reused.  (C-3)
+        //
+        // Testing:
+        //   SizedMultipool(size_type, Strategy, int, Allocator *ba = 0);
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address, bsls::Types::size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        Obj        mX(600, bsls::BlockGrowth::BSLS_CONSTANT, 4, &ta);
+        const Obj& X = mX;
+
+        ASSERT(0 == mX.allocate(0));
+
+        const size_type MAX = X.maxPooledBlockSize();
+        ASSERTV(MAX, 640 == MAX);
+
+        bsl::vector<char *> blocks(&sa);
+        bsl::vector<size_type> sizes(&sa);
+        bsl::set<char *> unique(&sa);
+
+        for (size_type size = 1; size <= 2 * MAX; ++size) {
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            char *p = static_cast<char *>(mX.allocate(size));
+            char *q = static_cast<char *>(mX.allocate(size));
+
+            ASSERTV(size, p && q);
+            ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                               % k_MAX_ALIGN);
+            ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(q)
+                                                               % k_MAX_ALIGN);
+            if (size <= MAX) {
+                // Blocks are carved in increasing addresses from a chunk of
+                // four, unless the pair straddles two chunks.
+
+                const size_type BLOCK_SIZE = X.blockSize(size);
+                ASSERTV(size, BLOCK_SIZE, q - p,
+                        static_cast<size_type>(q - p) == BLOCK_SIZE
+                     || NUM_BLOCKS + 1 == ta.numBlocksInUse());
+            }
+            else {
+                ASSERTV(size, NUM_BLOCKS + 2 == ta.numBlocksInUse());
+            }
+
+            bsl::memset(p, static_cast<int>(size & 0xff), size);
+            bsl::memset(q, static_cast<int>(size & 0xff), size);
+
+            blocks.push_back(p);
+            blocks.push_back(q);
+            sizes.push_back(size);
+            sizes.push_back(size);
+            unique.insert(p);
+            unique.insert(q);
+        }
+        ASSERTV(blocks.size(), unique.size(), blocks.size() == unique.size());
+
+        for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+            const size_type SIZE = sizes[i];
+            for (size_type j = 0; j < SIZE; ++j) {
+                ASSERTV(SIZE, j,
+                        static_cast<char>(SIZE & 0xff) == blocks[i][j]);
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            mX.deallocate(blocks[i], SIZE);
+            if (SIZE > MAX) {
+                ASSERTV(SIZE, NUM_BLOCKS - 1 == ta.numBlocksInUse());
+            }
+            else {
+                ASSERTV(SIZE, NUM_BLOCKS == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting reuse within a size class." << endl;
+        {
+            void *p = mX.allocate(20);
+            mX.deallocate(p, 20);
+            ASSERT(p == mX.allocate(32));
+
+            void *q = mX.allocate(300);
+            mX.deallocate(q, 300);
+            ASSERT(q == mX.allocate(257));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SIZE CLASSES AND ACCESSORS
+        //
+        // Concerns:
+        // 1. `blockSize` returns the smallest size class not less than the
+        //    requested size, as documented, for every pooled size, and the
+        //    requested size otherwise.
+        //
+        // 2. Each size class is a multiple of the maximal alignment, and
+        //    exceeds the request by at most 15 bytes or 25%.
+        //
+        // 3. `maxPooledBlockSize` is the smallest size class not less than the
+        //    maximum block size supplied at construction, and `numPools` is
+        //    the number of size classes up to it.
+        //
+        // 4. `allocator` returns the allocator supplied at construction, or
+        //    the default allocator.
+        //
+        // Plan:
+        // 1. Compare `blockSize` with an oracle enumerating the size classes,
+        //    and verify its bounds.  (C-1..2)
+        //
+        // 2. Create multipools having various maximum block sizes and verify
+        //    the accessors.  (C-3..4)
+        //
+        // Testing:
+        //   SizedMultipool(bslma::Allocator *basicAllocator = 0);
+        //   SizedMultipool(size_type maxBlockSize, Allocator *ba = 0);
+        //   bsls::Types::size_type blockSize(bsls::Types::size_type) const;
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SIZE CLASSES AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        {
+            Obj        mX(&ta);
+            const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERTV(X.maxPooledBlockSize(), 4096 == X.maxPooledBlockSize());
+            ASSERTV(X.numPools(), 28 == X.numPools());
+
+            ASSERT(0 == X.blockSize(0));
+            ASSERT(5000 == X.blockSize(5000));
+
+            for (size_type size = 1; size <= 4096; ++size) {
+                const size_type EXP        = u::oracleBlockSize(size);
+                const size_type BLOCK_SIZE = X.blockSize(size);
+
+                ASSERTV(size, EXP, BLOCK_SIZE, EXP == BLOCK_SIZE);
+                ASSERTV(size, 0 == BLOCK_SIZE % k_MAX_ALIGN);
+                ASSERTV(size, BLOCK_SIZE <= size + 15
+                           || BLOCK_SIZE * 4 <= size * 5);
+            }
+        }
+
+        {
+            const struct {
+                int       d_line;
+                size_type d_maxBlockSize;
+                size_type d_expMaxPooled;
+                int       d_expNumPools;
+            } DATA[] = {
+                //LINE  MAX        EXP MAX     EXP NUM POOLS
+                //----  ---------  ----------  -------------
+                { L_,           1,         16,             1 },
+                { L_,          16,         16,             1 },
+                { L_,          17,         32,             2 },
+                { L_,         128,        128,             8 },
+                { L_,         129,        160,             9 },
+                { L_,         256,        256,            12 },
+                { L_,         257,        320,            13 },
+                { L_,        1000,       1024,            20 },
+                { L_,     1 << 20,    1 << 20,            60 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE = DATA[ti].d_line;
+                const size_type MAX  = DATA[ti].d_maxBlockSize;
+
+                Obj        mX(MAX, &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, X.maxPooledBlockSize(),
+                        DATA[ti].d_expMaxPooled == X.maxPooledBlockSize());
+                ASSERTV(LINE, X.numPools(),
+                        DATA[ti].d_expNumPools == X.numPools());
+                ASSERTV(LINE, X.maxPooledBlockSize() == X.blockSize(MAX));
+            }
+        }
+
+        {
+            bslma::TestAllocator         da("default", veryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj mX;
+            ASSERT(&da == mX.allocator());
+        }
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a multipool, allocate blocks of several sizes, including
+        //    a large block, deallocate them, and verify that freed blocks are
+        //    reused.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(256, &ta);
+
+            ASSERT(256 == mX.maxPooledBlockSize());
+
+            void *p = mX.allocate(16);
+            void *q = mX.allocate(200);
+            void *r = mX.allocate(1024);
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(r);
+
+            mX.deallocate(q, 200);
+            ASSERT(q == mX.allocate(193));
+
+            mX.deallocate(p, 16);
+            mX.deallocate(q, 193);
+            mX.deallocate(r, 1024);
+
+            mX.release();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
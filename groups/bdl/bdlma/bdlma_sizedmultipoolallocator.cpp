@@ -0,0 +1,101 @@
+// bdlma_sizedmultipoolallocator.cpp                                  -*-C++-*-
+#include <bdlma_sizedmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sizedmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+
+const bsl::size_t k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+}  // close unnamed namespace
+
+                       // -----------------------------
+                       // class SizedMultipoolAllocator
+                       // -----------------------------
+
+// PROTECTED MANIPULATORS
+void *SizedMultipoolAllocator::do_allocate(bsl::size_t bytes,
+                                           bsl::size_t alignment)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            bytes && alignment <= k_MAX_ALIGNMENT)) {
+        return d_multipool.allocate(bytes);                           // RETURN
+    }
+
+    // Zero-sized and over-aligned requests are served, through the unsized
+    // interface, by the base class.
+
+    return ManagedAllocator::do_allocate(bytes, alignment);
+}
+
+void SizedMultipoolAllocator::do_deallocate(void        *p,
+                                            bsl::size_t  bytes,
+                                            bsl::size_t  alignment)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            bytes && alignment <= k_MAX_ALIGNMENT)) {
+        d_multipool.deallocate(p, bytes);
+        return;                                                       // RETURN
+    }
+
+    ManagedAllocator::do_deallocate(p, bytes, alignment);
+}
+
+// CREATORS
+SizedMultipoolAllocator::~SizedMultipoolAllocator()
+{
+}
+
+// MANIPULATORS
+void *SizedMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::size_type blockSize = size + sizeof(Header);
+
+    Header *h = static_cast<Header *>(d_multipool.allocate(blockSize));
+    h->d_header.d_size = blockSize;
+
+    return h + 1;
+}
+
+void SizedMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    BSLS_ASSERT(sizeof(Header) < h->d_header.d_size);
+
+    d_multipool.deallocate(h, h->d_header.d_size);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
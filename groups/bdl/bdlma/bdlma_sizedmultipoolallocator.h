@@ -0,0 +1,352 @@
+// bdlma_sizedmultipoolallocator.h                                    -*-C++-*-
+#ifndef INCLUDED_BDLMA_SIZEDMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_SIZEDMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pooling allocator using sized deallocation.
+//
+//@CLASSES:
+//  bdlma::SizedMultipoolAllocator: allocator over header-free size classes
+//
+//@SEE_ALSO: bdlma_sizedmultipool, bdlma_multipoolallocator
+//
+//@DESCRIPTION: This component provides a managed allocator,
+// `bdlma::SizedMultipoolAllocator`, that implements the
+// `bdlma::ManagedAllocator` protocol using a `bdlma::SizedMultipool`, whose
+// pooled memory blocks carry no per-block header.  Like a
+// `bdlma::MultipoolAllocator`, it serves each request from the pool of the
+// smallest block size not less than the requested size, or, for large
+// requests, directly from the underlying allocator, and its `release` method
+// and destructor release all memory allocated via the object.
+// ```
+//  ,------------------------------.
+// ( bdlma::SizedMultipoolAllocator )
+//  `------------------------------'
+//               |         ctor/dtor
+//               |         blockSize
+//               |         maxPooledBlockSize
+//               |         numPools
+//               |         reserveCapacity
+//               V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//               |         release
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//               |         allocate
+//               |         deallocate
+//               V
+//    ,---------------------.
+//   ( bsl::memory_resource )
+//    `---------------------'
+//                         do_allocate
+//                         do_deallocate
+// ```
+//
+///Sized and Unsized Requests
+///--------------------------
+// `bslma::Allocator` derives from `bsl::memory_resource`, whose protected
+// virtual `do_deallocate` method receives the size (and alignment) of the
+// block being deallocated.  Standard allocators use this interface:
+// `bsl::allocator<T>` (and therefore every `bsl` container, including the
+// node pools of `bsl::map` and `bsl::unordered_map`), `bsl::memory_resource`,
+// and `bslma::AllocatorUtil` all deallocate a block with the size with which
+// it was allocated.  `bdlma::SizedMultipoolAllocator` overrides
+// `do_allocate` and `do_deallocate` to allocate such *sized* requests from
+// its multipool without any header.
+//
+// The `allocate(size)` and `deallocate(address)` methods of the
+// `bslma::Allocator` protocol, used by `bslma::Allocator`-aware code that does
+// not retain the size of its blocks (e.g., `bslma::ManagedPtr`, or
+// `deleteObject`), are *unsized*: each block allocated by `allocate` is
+// preceded by a maximally-aligned header recording its size, at the same cost
+// as the header of a `bdlma::MultipoolAllocator`.
+//
+// The two interfaces must not be mixed: a block allocated by `allocate` must
+// be deallocated by `deallocate`, and a block allocated through
+// `bsl::memory_resource` (or `bsl::allocator`) must be deallocated through
+// `bsl::memory_resource` (or `bsl::allocator`) with the same size and
+// alignment, as required by the contract of `bsl::memory_resource`.  Requests
+// for zero bytes, or for an alignment greater than
+// `bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT`, are forwarded by the sized
+// interface to the unsized one.
+//
+///Thread Safety
+///-------------
+// `bdlma::SizedMultipoolAllocator` is *not* thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reducing the Footprint of a Map
+/// - - - - - - - - - - - - - - - - - - - - -
+// In this example, we supply the memory of a `bsl::map` from a
+// `bdlma::SizedMultipoolAllocator`, and compare the memory obtained from the
+// underlying allocator with that obtained by a `bdlma::MultipoolAllocator`.
+//
+// First, we define a function that fills a map having the specified
+// allocator, and returns the number of bytes obtained from the underlying
+// test allocator:
+// ```
+// template <class ALLOCATOR>
+// bsls::Types::Int64 mapFootprint(int numElements)
+// {
+//     bslma::TestAllocator ta;
+//     ALLOCATOR            allocator(&ta);
+//
+//     bsl::map<int, int> map(&allocator);
+//     for (int i = 0; i < numElements; ++i) {
+//         map[i] = i;
+//     }
+//     return ta.numBytesInUse();
+// }
+// ```
+// Then, we compare both allocators.  The nodes of the map are allocated in
+// chunks by the node pool of the map, each deallocated with its size, so the
+// chunks obtained from the sized multipool allocator carry no header, and are
+// rounded up to a closer size class:
+// ```
+// const bsls::Types::Int64 sized =
+//                 mapFootprint<bdlma::SizedMultipoolAllocator>(10000);
+// const bsls::Types::Int64 unsized =
+//                 mapFootprint<bdlma::MultipoolAllocator>(10000);
+// assert(sized < unsized);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+#include <bdlma_sizedmultipool.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // =============================
+                       // class SizedMultipoolAllocator
+                       // =============================
+
+/// This class implements the `bdlma::ManagedAllocator` protocol to provide
+/// an allocator that serves sized requests (see {Sized and Unsized
+/// Requests}) from the header-free size classes of a
+/// `bdlma::SizedMultipool`.  Both the `release` method and the destructor
+/// of a `bdlma::SizedMultipoolAllocator` release all memory allocated via
+/// the object.
+class SizedMultipoolAllocator : public ManagedAllocator {
+
+    // PRIVATE TYPES
+
+    /// This `struct` precedes each block allocated by the unsized
+    /// `allocate` method, and stores the size of the underlying block.
+    struct Header {
+
+        union {
+            bsls::Types::size_type d_size;     // size of this memory block,
+                                               // including this header
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    // DATA
+    SizedMultipool d_multipool;  // manager for allocated memory blocks
+
+  private:
+    // NOT IMPLEMENTED
+    SizedMultipoolAllocator(const SizedMultipoolAllocator&);
+    SizedMultipoolAllocator& operator=(const SizedMultipoolAllocator&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Return a newly allocated block of memory of (at least) the specified
+    /// `bytes` and having at least the specified `alignment`.  If `bytes` is
+    /// positive and `alignment` is at most
+    /// `bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT`, the block is allocated
+    /// from the multipool without a header; otherwise the request is
+    /// forwarded to the `bslma::Allocator` implementation of this method.
+    void *do_allocate(bsl::size_t bytes,
+                      bsl::size_t alignment) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the memory block at the specified `p` address, having the
+    /// specified `bytes` and `alignment`, back to this allocator.  The
+    /// behavior is undefined unless `p` was returned by `do_allocate` with
+    /// the same `bytes` and `alignment`, and has not already been
+    /// deallocated.
+    void do_deallocate(void        *p,
+                       bsl::size_t  bytes,
+                       bsl::size_t  alignment) BSLS_KEYWORD_OVERRIDE;
+
+  public:
+    // CREATORS
+
+    /// Create a sized multipool allocator.  Optionally specify a
+    /// `maxBlockSize`, such that requests of at most `maxBlockSize` bytes
+    /// are pooled (see `bdlma_sizedmultipool`); if `maxBlockSize` is not
+    /// specified, 4096 is used.  If `maxBlockSize` is specified, optionally
+    /// specify a `growthStrategy` and a `maxBlocksPerChunk` for the
+    /// internal pools; if not specified, geometric growth up to 32 blocks
+    /// per chunk is used.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `1 <= maxBlockSize <= 2^30` and `1 <= maxBlocksPerChunk`.
+    explicit
+    SizedMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SizedMultipoolAllocator(bsls::Types::size_type  maxBlockSize,
+                            bslma::Allocator       *basicAllocator = 0);
+    SizedMultipoolAllocator(bsls::Types::size_type       maxBlockSize,
+                            bsls::BlockGrowth::Strategy  growthStrategy,
+                            int                          maxBlocksPerChunk,
+                            bslma::Allocator            *basicAllocator = 0);
+
+    /// Destroy this allocator.  All memory allocated from this allocator is
+    /// released.
+    ~SizedMultipoolAllocator() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Reserve memory from this allocator to satisfy sized memory requests
+    /// for at least the specified `numObjects` having the specified `size`
+    /// (in bytes) before the pool replenishes.  If `size` is 0, this method
+    /// has no effect.  The behavior is undefined unless
+    /// `size <= maxPooledBlockSize()` and `0 <= numObjects`.
+    void reserveCapacity(bsls::Types::size_type size, int numObjects);
+
+                                // Virtual Functions
+
+    /// Return the address of a contiguous block of maximally-aligned memory
+    /// of (at least) the specified `size` (in bytes), preceded by a header
+    /// recording its size.  If `size` is 0, no memory is allocated and 0 is
+    /// returned.
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the memory block at the specified `address` back to this
+    /// allocator for reuse.  If `address` is 0, this method has no effect.
+    /// The behavior is undefined unless `address` was allocated by the
+    /// `allocate` method of this allocator, and has not already been
+    /// deallocated.
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+
+    /// Release all memory currently allocated through this allocator.
+    void release() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the size of the block dispensed by this allocator for a sized
+    /// request of the specified `size` (in bytes).  See
+    /// `bdlma::SizedMultipool::blockSize`.
+    bsls::Types::size_type blockSize(bsls::Types::size_type size) const;
+
+    /// Return the number of pools managed by this allocator.
+    int numPools() const;
+
+    /// Return the maximum size of memory blocks that are pooled by this
+    /// allocator.
+    bsls::Types::size_type maxPooledBlockSize() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class SizedMultipoolAllocator
+                       // -----------------------------
+
+// CREATORS
+inline
+SizedMultipoolAllocator::SizedMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(basicAllocator)
+{
+}
+
+inline
+SizedMultipoolAllocator::SizedMultipoolAllocator(
+                                       bsls::Types::size_type  maxBlockSize,
+                                       bslma::Allocator       *basicAllocator)
+: d_multipool(maxBlockSize, basicAllocator)
+{
+}
+
+inline
+SizedMultipoolAllocator::SizedMultipoolAllocator(
+                                bsls::Types::size_type       maxBlockSize,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                int                          maxBlocksPerChunk,
+                                bslma::Allocator            *basicAllocator)
+: d_multipool(maxBlockSize, growthStrategy, maxBlocksPerChunk, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void SizedMultipoolAllocator::reserveCapacity(
+                                             bsls::Types::size_type size,
+                                             int                    numObjects)
+{
+    d_multipool.reserveCapacity(size, numObjects);
+}
+
+inline
+void SizedMultipoolAllocator::release()
+{
+    d_multipool.release();
+}
+
+// ACCESSORS
+inline
+bsls::Types::size_type SizedMultipoolAllocator::blockSize(
+                                            bsls::Types::size_type size) const
+{
+    return d_multipool.blockSize(size);
+}
+
+inline
+int SizedMultipoolAllocator::numPools() const
+{
+    return d_multipool.numPools();
+}
+
+inline
+bsls::Types::size_type SizedMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_multipool.maxPooledBlockSize();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,834 @@
+// bdlma_sizedmultipoolallocator.t.cpp                                -*-C++-*-
+#include <bdlma_sizedmultipoolallocator.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_memory_resource.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlma::SizedMultipoolAllocator` adapts a `bdlma::SizedMultipool` to the
+// `bdlma::ManagedAllocator` protocol.  We verify that sized requests, made
+// through `bsl::memory_resource` and `bsl::allocator`, are served without a
+// header (consecutive blocks carved from a chunk are exactly one size class
+// apart), that unsized requests are served with a header, that requests the
+// multipool cannot serve are forwarded, and that standard containers using
+// the allocator return all their memory and have a smaller footprint than
+// with a `bdlma::MultipoolAllocator`.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SizedMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 4] SizedMultipoolAllocator(size_type maxBlockSize, Allocator *ba = 0);
+// [ 2] SizedMultipoolAllocator(size_type, Strategy, int, Allocator *ba = 0);
+// [ 4] ~SizedMultipoolAllocator();
+//
+// PROTECTED MANIPULATORS
+// [ 2] void *do_allocate(bsl::size_t bytes, bsl::size_t alignment);
+// [ 2] void do_deallocate(void *p, bsl::size_t bytes, bsl::size_t align);
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void release();
+// [ 4] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+//
+// ACCESSORS
+// [ 4] bsls::Types::size_type blockSize(bsls::Types::size_type size) const;
+// [ 4] int numPools() const;
+// [ 4] bsls::Types::size_type maxPooledBlockSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: STANDARD CONTAINERS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONTAINER FOOTPRINT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SizedMultipoolAllocator Obj;
+typedef bsls::Types::size_type         size_type;
+
+const int k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND TYPES
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return `true` if the specified `address` is aligned on the specified
+/// `alignment`, and `false` otherwise.
+bool isAligned(const void *address, int alignment)
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % alignment;
+}
+
+/// Fill a `bsl::map` having the specified `numElements` with memory from an
+/// object of the (template parameter) `ALLOCATOR` type, and return the number
+/// of bytes obtained from the underlying allocator.  Optionally specify the
+/// address of a `elapsed` stopwatch, used to time the filling of the map.
+template <class ALLOCATOR>
+bsls::Types::Int64 mapFootprint(int             numElements,
+                                bsls::Stopwatch *elapsed = 0)
+{
+    bslma::TestAllocator ta;
+    ALLOCATOR            allocator(&ta);
+
+    bsl::map<int, int> map(&allocator);
+    if (elapsed) {
+        elapsed->start(true);
+    }
+    for (int i = 0; i < numElements; ++i) {
+        map[i] = i;
+    }
+    if (elapsed) {
+        elapsed->stop();
+    }
+    return ta.numBytesInUse();
+}
+
+/// Fill a `bsl::unordered_map` having the specified `numElements` with
+/// memory from an object of the (template parameter) `ALLOCATOR` type, and
+/// return the number of bytes obtained from the underlying allocator.
+/// Optionally specify the address of a `elapsed` stopwatch, used to time the
+/// filling of the map.
+template <class ALLOCATOR>
+bsls::Types::Int64 unorderedMapFootprint(int              numElements,
+                                         bsls::Stopwatch *elapsed = 0)
+{
+    bslma::TestAllocator ta;
+    ALLOCATOR            allocator(&ta);
+
+    bsl::unordered_map<int, int> map(&allocator);
+    if (elapsed) {
+        elapsed->start(true);
+    }
+    for (int i = 0; i < numElements; ++i) {
+        map[i] = i;
+    }
+    if (elapsed) {
+        elapsed->stop();
+    }
+    return ta.numBytesInUse();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: Reducing the Footprint of a Map
+/// - - - - - - - - - - - - - - - - - - - - -
+// In this example, we supply the memory of a `bsl::map` from a
+// `bdlma::SizedMultipoolAllocator`, and compare the memory obtained from the
+// underlying allocator with that obtained by a `bdlma::MultipoolAllocator`.
+//
+// First, we define a function that fills a map having the specified
+// allocator, and returns the number of bytes obtained from the underlying
+// test allocator:
+// ```
+    template <class ALLOCATOR>
+    bsls::Types::Int64 mapFootprint(int numElements)
+    {
+        bslma::TestAllocator ta;
+        ALLOCATOR            allocator(&ta);
+
+        bsl::map<int, int> map(&allocator);
+        for (int i = 0; i < numElements; ++i) {
+            map[i] = i;
+        }
+        return ta.numBytesInUse();
+    }
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we compare both allocators.  The nodes of the map are allocated in
+// chunks by the node pool of the map, each deallocated with its size, so the
+// chunks obtained from the sized multipool allocator carry no header, and are
+// rounded up to a closer size class:
+// ```
+    const bsls::Types::Int64 sized =
+                    mapFootprint<bdlma::SizedMultipoolAllocator>(10000);
+    const bsls::Types::Int64 unsized =
+                    mapFootprint<bdlma::MultipoolAllocator>(10000);
+    ASSERT(sized < unsized);
+// ```
+
+        if (verbose) {
+            P_(sized);  P(unsized);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: STANDARD CONTAINERS
+        //
+        // Concerns:
+        // 1. Standard containers using the allocator, whose nodes, node
+        //    chunks, bucket arrays, and buffers are deallocated with their
+        //    sizes, operate correctly, and return all their memory to the
+        //    allocator: refilling a container obtains no additional memory
+        //    from the underlying allocator.
+        //
+        // 2. The memory obtained by node-based containers is less than that
+        //    obtained through a `bdlma::MultipoolAllocator`.
+        //
+        // Plan:
+        // 1. Fill a map, an unordered map, a vector of strings, and a shared
+        //    pointer.  Destroy them and verify that filling them again obtains
+        //    no more memory.  (C-1)
+        //
+        // 2. Compare the footprints of maps and unordered maps filled with
+        //    memory from both allocators.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: STANDARD CONTAINERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: STANDARD CONTAINERS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(&ta);
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int pass = 0; pass < 2; ++pass) {
+                {
+                    bsl::map<int, int>           map(&mX);
+                    bsl::unordered_map<int, int> hash(&mX);
+                    bsl::vector<bsl::string>     strings(&mX);
+
+                    for (int i = 0; i < 1000; ++i) {
+                        map[i]  = i;
+                        hash[i] = i;
+                        strings.push_back(bsl::string(i % 100, 'x'));
+                    }
+                    bsl::shared_ptr<int> sp =
+                                         bsl::allocate_shared<int>(&mX, 42);
+
+                    for (int i = 0; i < 1000; ++i) {
+                        ASSERTV(i, i == map[i]);
+                        ASSERTV(i, i == hash[i]);
+                        ASSERTV(i, bsl::string(i % 100, 'x') == strings[i]);
+                    }
+                    ASSERT(42 == *sp);
+
+                    for (int i = 0; i < 1000; i += 2) {
+                        map.erase(i);
+                        hash.erase(i);
+                    }
+                    ASSERT(500 == map.size());
+                    ASSERT(500 == hash.size());
+                }
+                if (0 == pass) {
+                    numBytes = ta.numBytesInUse();
+                }
+                else {
+                    ASSERTV(numBytes, ta.numBytesInUse(),
+                            numBytes == ta.numBytesInUse());
+                }
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            const bsls::Types::Int64 SIZED =
+                          u::mapFootprint<Obj>(10000);
+            const bsls::Types::Int64 UNSIZED =
+                          u::mapFootprint<bdlma::MultipoolAllocator>(10000);
+            ASSERTV(SIZED, UNSIZED, SIZED < UNSIZED);
+        }
+        {
+            const bsls::Types::Int64 SIZED =
+                 u::unorderedMapFootprint<Obj>(10000);
+            const bsls::Types::Int64 UNSIZED =
+                 u::unorderedMapFootprint<bdlma::MultipoolAllocator>(10000);
+            ASSERTV(SIZED, UNSIZED, SIZED < UNSIZED);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELEASE, RESERVE CAPACITY, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The accessors forward to the multipool, configured with the
+        //    maximum block size supplied at construction.
+        //
+        // 2. `release` returns all memory, allocated through either
+        //    interface, to the underlying allocator, and the allocator remains
+        //    usable.
+        //
+        // 3. `reserveCapacity` reserves blocks for sized requests.
+        //
+        // 4. The destructor returns all memory to the underlying allocator.
+        //
+        // Plan:
+        // 1. Verify the accessors of allocators having several maximum block
+        //    sizes.  (C-1)
+        //
+        // 2. Allocate through both interfaces, release, and verify the memory
+        //    in use.  (C-2)
+        //
+        // 3. Reserve capacity, and verify that sized requests obtain no more
+        //    memory.  (C-3)
+        //
+        // 4. Destroy the allocator, and verify that no memory is in use.
+        //    (C-4)
+        //
+        // Testing:
+        //   SizedMultipoolAllocator(size_type, Allocator *ba = 0);
+        //   ~SizedMultipoolAllocator();
+        //   void release();
+        //   void reserveCapacity(bsls::Types::size_type, int numObjects);
+        //   bsls::Types::size_type blockSize(bsls::Types::size_type) const;
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                         << endl
+                         << "RELEASE, RESERVE CAPACITY, AND ACCESSORS" << endl
+                         << "========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(28   == X.numPools());
+            ASSERT(16   == X.blockSize(16));
+            ASSERT(160  == X.blockSize(129));
+        }
+        {
+            Obj mX(1000, &ta);  const Obj& X = mX;
+
+            ASSERT(1024 == X.maxPooledBlockSize());
+            ASSERT(20   == X.numPools());
+            ASSERT(2000 == X.blockSize(2000));
+        }
+
+        {
+            Obj                   mX(&ta);
+            bsl::memory_resource *mr = &mX;
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            for (size_type size = 1; size <= 10000; size += 37) {
+                ASSERTV(size, mr->allocate(size, 1));
+                ASSERTV(size, mX.allocate(size));
+            }
+            ASSERT(NUM_BLOCKS < ta.numBlocksInUse());
+
+            mX.release();
+            ASSERTV(ta.numBlocksInUse(), NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.reserveCapacity(24, 10);
+            const bsls::Types::Int64 NUM_RESERVED = ta.numBlocksInUse();
+            ASSERT(NUM_BLOCKS + 1 == NUM_RESERVED);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, mr->allocate(24, 8));
+            }
+            ASSERTV(ta.numBlocksInUse(), NUM_RESERVED == ta.numBlocksInUse());
+
+            ASSERT(mX.allocate(10));
+            ASSERT(mr->allocate(100000, 8));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // UNSIZED INTERFACE
+        //
+        // Concerns:
+        // 1. `allocate` returns 0 for a size of 0, and otherwise a
+        //    maximally-aligned block of at least the requested size, preceded
+        //    by a maximally-aligned header.
+        //
+        // 2. `deallocate` returns a block to the pool of its size class, and
+        //    has no effect for a null address.
+        //
+        // 3. Large blocks are allocated from, and returned to, the underlying
+        //    allocator.
+        //
+        // 4. Facilities deallocating through the unsized interface, such as
+        //    `bslma::ManagedPtr`, operate correctly.
+        //
+        // Plan:
+        // 1. Allocate and deallocate blocks of every size up to twice the
+        //    largest pooled size from an allocator having fixed chunks of 4
+        //    blocks.  Verify alignment, distance, reuse, and memory in use.
+        //    (C-1..3)
+        //
+        // 2. Create and destroy a `bslma::ManagedPtr` using the allocator.
+        //    (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "UNSIZED INTERFACE" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        for (size_type size = 1; size <= 1280; ++size) {
+            Obj        mX(600, bsls::BlockGrowth::BSLS_CONSTANT, 4, &ta);
+            const Obj& X = mX;
+
+            // Each block is preceded by a maximally-aligned header.
+
+            const size_type          WITH_HEADER = size + k_MAX_ALIGN;
+            const bool               POOLED = WITH_HEADER <= 640;
+            const size_type          BLOCK_SIZE = X.blockSize(WITH_HEADER);
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            char *blocks[4];
+            for (int i = 0; i < 4; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, i, u::isAligned(blocks[i], k_MAX_ALIGN));
+                ASSERTV(size, i, !POOLED
+                     || blocks[0] + i * BLOCK_SIZE == blocks[i]);
+
+                bsl::memset(blocks[i], 0xa5, size);
+            }
+            ASSERTV(size, ta.numBlocksInUse(),
+                    NUM_BLOCKS + (POOLED ? 1 : 4) == ta.numBlocksInUse());
+
+            mX.deallocate(blocks[2]);
+            char *p = static_cast<char *>(mX.allocate(size));
+            ASSERTV(size, !POOLED || blocks[2] == p);
+            blocks[2] = p;
+
+            for (int i = 0; i < 4; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERTV(size, ta.numBlocksInUse(),
+                    NUM_BLOCKS + (POOLED ? 1 : 0) == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            bslma::ManagedPtr<bsl::string> mp(
+                                     new (mX) bsl::string("hello", &mX), &mX);
+            ASSERT("hello" == *mp);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SIZED INTERFACE
+        //
+        // Concerns:
+        // 1. Sized requests, made through `bsl::memory_resource` or
+        //    `bsl::allocator`, are served from the multipool without a
+        //    header: consecutive blocks carved from a chunk are one size class
+        //    apart, and are suitably aligned.
+        //
+        // 2. A block deallocated with its size is returned to the pool of its
+        //    size class, and is reused.
+        //
+        // 3. Large sized requests are served from, and returned to, the
+        //    underlying allocator.
+        //
+        // 4. Zero-sized requests, and requests for an alignment greater than
+        //    the maximal alignment, are forwarded to the unsized interface and
+        //    satisfy their contract.
+        //
+        // Plan:
+        // 1. For every size up to twice the largest pooled size, allocate two
+        //    blocks through `bsl::memory_resource` from an allocator having
+        //    fixed chunks of 4 blocks, and verify their distance, alignment,
+        //    and the memory in use after deallocation.  (C-1..3)
+        //
+        // 2. Allocate and deallocate objects through `bsl::allocator`, and
+        //    verify their distance.  (C-1..2)
+        //
+        // 3. Allocate zero bytes, and blocks aligned on 32, 64, and 4096
+        //    bytes, and deallocate them.  (C-4)
+        //
+        // Testing:
+        //   SizedMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+        //   SizedMultipoolAllocator(size_type, Strategy, int, Allocator *);
+        //   void *do_allocate(bsl::size_t bytes, bsl::size_t alignment);
+        //   void do_deallocate(void *p, bsl::size_t bytes, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SIZED INTERFACE" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nTesting `bsl::memory_resource`." << endl;
+        {
+            for (size_type size = 1; size <= 1280; ++size) {
+                Obj                   mX(600,
+                                         bsls::BlockGrowth::BSLS_CONSTANT,
+                                         4,
+                                         &ta);
+                const Obj&            X = mX;
+                bsl::memory_resource *mr = &mX;
+
+                const bool               POOLED = size <= 640;
+                const size_type          BLOCK_SIZE = X.blockSize(size);
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                char *blocks[4];
+                for (int i = 0; i < 4; ++i) {
+                    blocks[i] = static_cast<char *>(mr->allocate(size, 1));
+
+                    ASSERTV(size, i, u::isAligned(blocks[i], k_MAX_ALIGN));
+                    ASSERTV(size, i, !POOLED
+                         || blocks[0] + i * BLOCK_SIZE == blocks[i]);
+
+                    bsl::memset(blocks[i], 0xa5, size);
+                }
+                ASSERTV(size, ta.numBlocksInUse(),
+                        NUM_BLOCKS + (POOLED ? 1 : 4) == ta.numBlocksInUse());
+
+                // The chunk is exhausted: a freed block is reused next.
+
+                mr->deallocate(blocks[2], size, 1);
+                char *p = static_cast<char *>(mr->allocate(size, 1));
+                ASSERTV(size, !POOLED || blocks[2] == p);
+                blocks[2] = p;
+
+                for (int i = 0; i < 4; ++i) {
+                    mr->deallocate(blocks[i], size, 1);
+                }
+                ASSERTV(size, ta.numBlocksInUse(),
+                        NUM_BLOCKS + (POOLED ? 1 : 0) == ta.numBlocksInUse());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `bsl::allocator`." << endl;
+        {
+            Obj        mX(4096, bsls::BlockGrowth::BSLS_CONSTANT, 2, &ta);
+            const Obj& X = mX;
+
+            struct Node {
+                void *d_next_p;
+                int   d_value;
+            };
+
+            bsl::allocator<Node> alloc(&mX);
+
+            Node *p = alloc.allocate(1);
+            Node *q = alloc.allocate(1);
+
+            const size_type DISTANCE =
+                        static_cast<size_type>(reinterpret_cast<char *>(q)
+                                             - reinterpret_cast<char *>(p));
+            ASSERTV(DISTANCE, X.blockSize(sizeof(Node)) == DISTANCE);
+
+            // The chunk of two blocks is exhausted: a freed block is reused
+            // next.
+
+            alloc.deallocate(p, 1);
+            ASSERT(p == alloc.allocate(1));
+
+            Node *r = alloc.allocate(10);
+            alloc.deallocate(r, 10);
+            alloc.deallocate(q, 1);
+            alloc.deallocate(p, 1);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting forwarded requests." << endl;
+        {
+            Obj                   mX(&ta);
+            bsl::memory_resource *mr = &mX;
+
+            void *p = mr->allocate(0, 1);
+            ASSERT(p);
+            mr->deallocate(p, 0, 1);
+
+            const bsl::size_t ALIGNMENTS[] = { 32, 64, 4096 };
+            for (int i = 0; i < 3; ++i) {
+                const bsl::size_t ALIGN = ALIGNMENTS[i];
+
+                void *q = mr->allocate(100, ALIGN);
+                ASSERTV(ALIGN, u::isAligned(q, static_cast<int>(ALIGN)));
+                bsl::memset(q, 0xff, 100);
+                mr->deallocate(q, 100, ALIGN);
+            }
+
+            mX.release();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create an allocator, allocate and deallocate memory through both
+        //    interfaces, and fill a container.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj                   mX(&ta);
+            bsl::memory_resource *mr = &mX;
+
+            void *p = mX.allocate(16);
+            void *q = mr->allocate(16, 8);
+            ASSERT(p);
+            ASSERT(q);
+
+            mr->deallocate(q, 16, 8);
+            ASSERT(q == mr->allocate(16, 8));
+
+            mX.deallocate(p);
+            mr->deallocate(q, 16, 8);
+
+            bsl::map<int, bsl::string> map(&mX);
+            map[1] = "one";
+            map[2] = "two";
+            ASSERT(2 == map.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONTAINER FOOTPRINT
+        //
+        // Concerns:
+        // 1. Compare the memory obtained, and the time taken, by node-based
+        //    containers supplied by a `bdlma::MultipoolAllocator` and a
+        //    `bdlma::SizedMultipoolAllocator`.
+        //
+        // Plan:
+        // 1. For several numbers of elements (or the number given as the
+        //    second argument), fill a `bsl::map` and a `bsl::unordered_map`
+        //    using each allocator, and report the bytes obtained from the
+        //    underlying allocator and the time taken.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CONTAINER FOOTPRINT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: CONTAINER FOOTPRINT" << endl
+             << "================================" << endl;
+
+        const int DEFAULT_SIZES[] = { 1000, 10000, 100000, 1000000 };
+
+        bsl::vector<int> sizes;
+        if (argc > 2 && 0 < bsl::atoi(argv[2])) {
+            sizes.push_back(bsl::atoi(argv[2]));
+        }
+        else {
+            sizes.assign(DEFAULT_SIZES,
+                         DEFAULT_SIZES + sizeof DEFAULT_SIZES
+                                                      / sizeof *DEFAULT_SIZES);
+        }
+
+        for (bsl::size_t i = 0; i < sizes.size(); ++i) {
+            const int N = sizes[i];
+
+            bsls::Stopwatch sw;
+
+            const bsls::Types::Int64 MAP_SIZED = u::mapFootprint<Obj>(N, &sw);
+            const double             MAP_SIZED_T = sw.accumulatedWallTime();
+
+            const bsls::Types::Int64 MAP_MULTI =
+                          u::mapFootprint<bdlma::MultipoolAllocator>(N, &sw);
+            const double             MAP_MULTI_T = sw.accumulatedWallTime();
+
+            const bsls::Types::Int64 HASH_SIZED =
+                                     u::unorderedMapFootprint<Obj>(N, &sw);
+            const double             HASH_SIZED_T = sw.accumulatedWallTime();
+
+            const bsls::Types::Int64 HASH_MULTI =
+                 u::unorderedMapFootprint<bdlma::MultipoolAllocator>(N, &sw);
+            const double             HASH_MULTI_T = sw.accumulatedWallTime();
+
+            cout << "elements: " << N << endl;
+            cout << "\tmap<int, int>:           sized "
+                 << MAP_SIZED << " bytes (" << MAP_SIZED_T << "s), "
+                 << "multipool " << MAP_MULTI << " bytes ("
+                 << MAP_MULTI_T << "s), saving "
+                 << 100.0 * static_cast<double>(MAP_MULTI - MAP_SIZED)
+                                           / static_cast<double>(MAP_MULTI)
+                 << "%" << endl;
+            cout << "\tunordered_map<int, int>: sized "
+                 << HASH_SIZED << " bytes (" << HASH_SIZED_T << "s), "
+                 << "multipool " << HASH_MULTI << " bytes ("
+                 << HASH_MULTI_T << "s), saving "
+                 << 100.0 * static_cast<double>(HASH_MULTI - HASH_SIZED)
+                                           / static_cast<double>(HASH_MULTI)
+                 << "%" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
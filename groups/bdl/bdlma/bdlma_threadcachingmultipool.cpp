@@ -0,0 +1,592 @@
+// bdlma_threadcachingmultipool.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingmultipool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipool_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement `new`
+
+namespace BloombergLP {
+
+enum {
+    k_DEFAULT_NUM_POOLS          = 10,
+    k_DEFAULT_MAGAZINE_CAPACITY  = 32,
+    k_MAX_MAGAZINE_BYTES         = 8 * 1024,
+    k_MIN_BLOCK_SIZE             = 8,
+    k_CACHE_LINE_SIZE            = 64
+};
+
+namespace bdlma {
+
+                   // ======================================
+                   // struct ThreadCachingMultipool_Magazine
+                   // ======================================
+
+/// This component-private `struct` holds the addresses of up to `capacity`
+/// free blocks of one size class, where `capacity` is that of the depot of
+/// the size class.  A magazine is allocated with room for `capacity`
+/// addresses in `d_blocks`.
+struct ThreadCachingMultipool_Magazine {
+
+    // DATA
+    ThreadCachingMultipool_Magazine *d_next_p;     // next magazine in the
+                                                   // depot
+
+    int                              d_numBlocks;  // number of free blocks
+
+    void                            *d_blocks[1];  // free blocks (extends
+                                                   // past the end of this
+                                                   // `struct`)
+};
+
+                    // ===================================
+                    // struct ThreadCachingMultipool_Depot
+                    // ===================================
+
+/// This component-private `struct` holds the magazines of one size class that
+/// are not owned by a thread.  Each depot occupies its own cache lines.
+struct ThreadCachingMultipool_Depot {
+
+    // DATA
+    bsls::SpinLock                   d_lock;       // guards `d_full_p` and
+                                                   // `d_empty_p`
+
+    ThreadCachingMultipool_Magazine *d_full_p;     // list of non-empty
+                                                   // magazines
+
+    ThreadCachingMultipool_Magazine *d_empty_p;    // list of empty magazines
+
+    bsls::Types::size_type           d_blockSize;  // size of each block,
+                                                   // including its header
+
+    int                              d_capacity;   // capacity of each
+                                                   // magazine
+
+    char                             d_padding[k_CACHE_LINE_SIZE];
+                                                   // keep `d_lock` of the
+                                                   // next depot on another
+                                                   // cache line
+
+    // CREATORS
+
+    /// Create a depot, having no magazines, for blocks of the specified
+    /// `blockSize` held in magazines of the specified `capacity`.
+    ThreadCachingMultipool_Depot(bsls::Types::size_type blockSize,
+                                 int                    capacity)
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_full_p(0)
+    , d_empty_p(0)
+    , d_blockSize(blockSize)
+    , d_capacity(capacity)
+    {
+    }
+};
+
+                    // ===================================
+                    // struct ThreadCachingMultipool_Cache
+                    // ===================================
+
+/// This component-private `struct` holds the magazines owned by one thread,
+/// for each size class of a multipool.  A cache is allocated with room for
+/// one `Slot` per size class following it, addressed by `d_slots_p`.
+struct ThreadCachingMultipool_Cache {
+
+    // TYPES
+    struct Slot {
+        ThreadCachingMultipool_Magazine *d_loaded_p;    // magazine to
+                                                        // allocate from, and
+                                                        // deallocate to
+
+        ThreadCachingMultipool_Magazine *d_previous_p;  // magazine exchanged
+                                                        // with the loaded one
+    };
+
+    // DATA
+    ThreadCachingMultipool         *d_multipool_p;  // multipool (held, not
+                                                    // owned)
+
+    ThreadCachingMultipool_Cache   *d_next_p;       // next cache of the
+                                                    // multipool
+
+    Slot                           *d_slots_p;      // one slot per size
+                                                    // class
+
+    bool                            d_inUse;        // `true` if owned by a
+                                                    // thread
+};
+
+                        // ----------------------------
+                        // class ThreadCachingMultipool
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipool::releaseCache(void *cache)
+{
+    Cache                  *c         = static_cast<Cache *>(cache);
+    ThreadCachingMultipool *multipool = c->d_multipool_p;
+
+    for (int i = 0; i < multipool->d_numPools; ++i) {
+        Depot&       depot = multipool->d_depots_p[i];
+        Cache::Slot& slot  = c->d_slots_p[i];
+
+        Magazine *magazines[] = { slot.d_loaded_p, slot.d_previous_p };
+
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        for (int j = 0; j < 2; ++j) {
+            Magazine *magazine = magazines[j];
+            if (!magazine) {
+                continue;                                           // CONTINUE
+            }
+            if (magazine->d_numBlocks) {
+                magazine->d_next_p = depot.d_full_p;
+                depot.d_full_p     = magazine;
+            }
+            else {
+                magazine->d_next_p = depot.d_empty_p;
+                depot.d_empty_p    = magazine;
+            }
+        }
+        slot.d_loaded_p   = 0;
+        slot.d_previous_p = 0;
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&multipool->d_mutex);
+    c->d_inUse = false;
+}
+
+// PRIVATE MANIPULATORS
+inline
+ThreadCachingMultipool::Cache *ThreadCachingMultipool::acquireCache()
+{
+    Cache *cache = static_cast<Cache *>(
+                                bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (cache = d_caches_p; cache; cache = cache->d_next_p) {
+            if (!cache->d_inUse) {
+                break;                                                 // BREAK
+            }
+        }
+
+        if (!cache) {
+            cache = static_cast<Cache *>(d_metadata.allocate(
+                        sizeof(Cache) + d_numPools * sizeof(Cache::Slot)));
+
+            cache->d_multipool_p = this;
+            cache->d_slots_p     = reinterpret_cast<Cache::Slot *>(cache + 1);
+            for (int i = 0; i < d_numPools; ++i) {
+                cache->d_slots_p[i].d_loaded_p   = 0;
+                cache->d_slots_p[i].d_previous_p = 0;
+            }
+            cache->d_next_p = d_caches_p;
+            d_caches_p      = cache;
+
+            ++d_numCaches;
+        }
+
+        cache->d_inUse = true;
+    }
+
+    int rc = bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    return cache;
+}
+
+void *ThreadCachingMultipool::allocateSlow(Cache *cache, int pool)
+{
+    Depot&       depot = d_depots_p[pool];
+    Cache::Slot& slot  = cache->d_slots_p[pool];
+
+    BSLS_ASSERT(!slot.d_loaded_p || 0 == slot.d_loaded_p->d_numBlocks);
+
+    if (slot.d_previous_p && slot.d_previous_p->d_numBlocks) {
+        Magazine *previous = slot.d_previous_p;
+        slot.d_previous_p  = slot.d_loaded_p;
+        slot.d_loaded_p    = previous;
+
+        return previous->d_blocks[--previous->d_numBlocks];           // RETURN
+    }
+
+    // Exchange the (empty) previous magazine for a full one from the depot.
+
+    Magazine *full;
+    {
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        full = depot.d_full_p;
+        if (full) {
+            depot.d_full_p = full->d_next_p;
+
+            if (slot.d_previous_p) {
+                slot.d_previous_p->d_next_p = depot.d_empty_p;
+                depot.d_empty_p             = slot.d_previous_p;
+            }
+        }
+    }
+
+    if (full) {
+        slot.d_previous_p = slot.d_loaded_p;
+        slot.d_loaded_p   = full;
+
+        return full->d_blocks[--full->d_numBlocks];                   // RETURN
+    }
+
+    // The depot has no blocks: fill the loaded magazine with new blocks.
+
+    if (!slot.d_loaded_p) {
+        slot.d_loaded_p = obtainEmptyMagazine(pool);
+    }
+
+    Magazine   *magazine = slot.d_loaded_p;
+    const int   capacity = depot.d_capacity;
+    char       *chunk;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        chunk = static_cast<char *>(d_chunks.allocate(
+                                                capacity * depot.d_blockSize));
+    }
+
+    for (int i = capacity - 1; i >= 0; --i, chunk += depot.d_blockSize) {
+        magazine->d_blocks[i] = chunk;
+    }
+    magazine->d_numBlocks = capacity;
+
+    return magazine->d_blocks[--magazine->d_numBlocks];
+}
+
+void ThreadCachingMultipool::deallocateSlow(Cache  *cache,
+                                            int     pool,
+                                            Header *header)
+{
+    Depot&       depot = d_depots_p[pool];
+    Cache::Slot& slot  = cache->d_slots_p[pool];
+
+    if (!slot.d_loaded_p) {
+        slot.d_loaded_p = obtainEmptyMagazine(pool);
+    }
+    else if (slot.d_previous_p && 0 == slot.d_previous_p->d_numBlocks) {
+        Magazine *previous = slot.d_previous_p;
+        slot.d_previous_p  = slot.d_loaded_p;
+        slot.d_loaded_p    = previous;
+    }
+    else {
+        // Exchange the (full) previous magazine for an empty one from the
+        // depot.
+
+        BSLS_ASSERT(slot.d_loaded_p->d_numBlocks == depot.d_capacity);
+
+        Magazine *empty;
+        {
+            bsls::SpinLockGuard guard(&depot.d_lock);
+
+            if (slot.d_previous_p) {
+                slot.d_previous_p->d_next_p = depot.d_full_p;
+                depot.d_full_p              = slot.d_previous_p;
+            }
+
+            empty = depot.d_empty_p;
+            if (empty) {
+                depot.d_empty_p = empty->d_next_p;
+            }
+        }
+
+        if (!empty) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            empty = newMagazine(pool);
+        }
+
+        slot.d_previous_p = slot.d_loaded_p;
+        slot.d_loaded_p   = empty;
+    }
+
+    Magazine *loaded = slot.d_loaded_p;
+    loaded->d_blocks[loaded->d_numBlocks++] = header;
+}
+
+void ThreadCachingMultipool::initialize(int maxBlocksPerMagazine)
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(d_numPools <= 32);
+    BSLS_ASSERT(1 <= maxBlocksPerMagazine);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_cacheKey, &releaseCache);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    d_depots_p = static_cast<Depot *>(
+                           d_metadata.allocate(d_numPools * sizeof(Depot)));
+
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    for (int i = 0; i < d_numPools; ++i) {
+        const bsls::Types::size_type blockSize =
+                              bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                             d_maxBlockSize + sizeof(Header));
+
+        int capacity = static_cast<int>(
+                             blockSize < k_MAX_MAGAZINE_BYTES
+                             ? k_MAX_MAGAZINE_BYTES / blockSize
+                             : 1);
+        if (capacity > maxBlocksPerMagazine) {
+            capacity = maxBlocksPerMagazine;
+        }
+
+        new (d_depots_p + i) Depot(blockSize, capacity);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+}
+
+ThreadCachingMultipool::Magazine *ThreadCachingMultipool::newMagazine(
+                                                                      int pool)
+{
+    Magazine *magazine = static_cast<Magazine *>(d_metadata.allocate(
+                        offsetof(Magazine, d_blocks)
+                      + d_depots_p[pool].d_capacity * sizeof(void *)));
+
+    magazine->d_next_p    = 0;
+    magazine->d_numBlocks = 0;
+
+    return magazine;
+}
+
+ThreadCachingMultipool::Magazine *
+ThreadCachingMultipool::obtainEmptyMagazine(int pool)
+{
+    Depot& depot = d_depots_p[pool];
+    {
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        Magazine *empty = depot.d_empty_p;
+        if (empty) {
+            depot.d_empty_p = empty->d_next_p;
+            return empty;                                             // RETURN
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return newMagazine(pool);
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingMultipool::findPool(bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingMultipool::ThreadCachingMultipool(
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_numCaches(0)
+, d_caches_p(0)
+, d_chunks(basicAllocator)
+, d_metadata(basicAllocator)
+, d_blockList(basicAllocator)
+{
+    initialize(k_DEFAULT_MAGAZINE_CAPACITY);
+}
+
+ThreadCachingMultipool::ThreadCachingMultipool(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_numCaches(0)
+, d_caches_p(0)
+, d_chunks(basicAllocator)
+, d_metadata(basicAllocator)
+, d_blockList(basicAllocator)
+{
+    initialize(k_DEFAULT_MAGAZINE_CAPACITY);
+}
+
+ThreadCachingMultipool::ThreadCachingMultipool(
+                                        int               numPools,
+                                        int               maxBlocksPerMagazine,
+                                        bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_numCaches(0)
+, d_caches_p(0)
+, d_chunks(basicAllocator)
+, d_metadata(basicAllocator)
+, d_blockList(basicAllocator)
+{
+    initialize(maxBlocksPerMagazine);
+}
+
+ThreadCachingMultipool::~ThreadCachingMultipool()
+{
+    // Delete the key first, so that no thread exiting from now on returns its
+    // magazines to the depots.
+
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipool::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        if (size <= d_maxBlockSize) {
+            const int    pool     = findPool(size);
+            Cache       *cache    = acquireCache();
+            Magazine    *magazine = cache->d_slots_p[pool].d_loaded_p;
+
+            Header *p;
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(magazine
+                                                && magazine->d_numBlocks)) {
+                p = static_cast<Header *>(
+                                 magazine->d_blocks[--magazine->d_numBlocks]);
+            }
+            else {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                p = static_cast<Header *>(allocateSlow(cache, pool));
+            }
+
+            p->d_header.d_poolIdx = pool;
+
+            return p + 1;                                             // RETURN
+        }
+
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Header *p = static_cast<Header *>(
+                d_blockList.allocate(size + static_cast<int>(sizeof(Header))));
+
+        p->d_header.d_poolIdx = -1;
+
+        return p + 1;                                                 // RETURN
+    }
+
+    return 0;
+}
+
+void ThreadCachingMultipool::deallocate(void *address)
+{
+    BSLS_ASSERT(address);
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int pool = h->d_header.d_poolIdx;
+
+    if (-1 == pool) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(0 <= pool && pool < d_numPools);
+
+    Cache     *cache    = acquireCache();
+    Magazine  *magazine = cache->d_slots_p[pool].d_loaded_p;
+    const int  capacity = d_depots_p[pool].d_capacity;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                               magazine && magazine->d_numBlocks < capacity)) {
+        magazine->d_blocks[magazine->d_numBlocks++] = h;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        deallocateSlow(cache, pool, h);
+    }
+}
+
+void ThreadCachingMultipool::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    for (Cache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        for (int i = 0; i < d_numPools; ++i) {
+            Cache::Slot& slot = cache->d_slots_p[i];
+            if (slot.d_loaded_p) {
+                slot.d_loaded_p->d_numBlocks = 0;
+            }
+            if (slot.d_previous_p) {
+                slot.d_previous_p->d_numBlocks = 0;
+            }
+        }
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        Depot& depot = d_depots_p[i];
+
+        bsls::SpinLockGuard depotGuard(&depot.d_lock);
+
+        while (depot.d_full_p) {
+            Magazine *magazine    = depot.d_full_p;
+            depot.d_full_p        = magazine->d_next_p;
+            magazine->d_numBlocks = 0;
+            magazine->d_next_p    = depot.d_empty_p;
+            depot.d_empty_p       = magazine;
+        }
+    }
+
+    d_chunks.release();
+    d_blockList.release();
+}
+
+// ACCESSORS
+int ThreadCachingMultipool::magazineCapacity(
+                                            bsls::Types::size_type size) const
+{
+    BSLS_ASSERT(1 <= size);
+    BSLS_ASSERT(size <= d_maxBlockSize);
+
+    return d_depots_p[findPool(size)].d_capacity;
+}
+
+int ThreadCachingMultipool::numThreadCaches() const
+{
+    return d_numCaches;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,484 @@
+// bdlma_threadcachingmultipool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOL
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool caching memory blocks per thread.
+//
+//@CLASSES:
+//   bdlma::ThreadCachingMultipool: multipool with per-thread block caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipool, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component implements a memory manager,
+// `bdlma::ThreadCachingMultipool`, that dispenses memory blocks of a
+// configurable number of sizes, like `bdlma::ConcurrentMultipool`, but that
+// serves most allocation and deallocation requests from a cache owned by the
+// calling thread, without synchronizing with other threads.  Each multipool
+// allocation (deallocation) request allocates memory from (returns memory to)
+// the *size class* managing memory blocks of the smallest size not less than
+// the requested size, or else from a separately managed list of memory
+// blocks, if no size class managing memory blocks of sufficient size exists.
+// The block size of the first size class is 8 bytes, with the block size of
+// each successive size class doubling.  Both the `release` method and the
+// destructor of a `bdlma::ThreadCachingMultipool` release all memory
+// currently allocated via the object.
+//
+// A `bdlma::ConcurrentMultipool` serves every request from a
+// `bdlma::ConcurrentPool` shared by all threads, whose free list is updated
+// by an atomic operation on a single cache line for every allocation and
+// deallocation, and whose replenishment is serialized by a mutex.  When many
+// threads allocate and deallocate blocks of the same size -- in particular
+// when blocks allocated by producer threads are deallocated by consumer
+// threads -- that cache line is contended.  A `bdlma::ThreadCachingMultipool`
+// is intended for such workloads.
+//
+///Magazines and the Depot
+///-----------------------
+// The blocks of a size class are held in *magazines*: arrays of the
+// addresses of free blocks, having a capacity that depends on the block size
+// (at most 32 blocks, and at most 8 kilobytes of blocks).  For each size
+// class, each thread using the multipool owns up to two magazines: a
+// *loaded* magazine, from which blocks are allocated and to which blocks are
+// deallocated, and a *previous* magazine.  A thread exchanges its loaded and
+// previous magazines when the loaded magazine is empty (on allocation) or
+// full (on deallocation) and the previous one is not, so that a thread
+// alternating allocations and deallocations around the boundary of a
+// magazine does not exchange magazines with other threads.  Otherwise, the
+// thread exchanges a whole magazine with the *depot* of the size class,
+// shared by all threads, that holds full and empty magazines:
+//
+// * On allocation, the thread obtains a full magazine from the depot, or, if
+//   there is none, fills a magazine with blocks carved from a newly allocated
+//   chunk of memory.
+// * On deallocation, the thread returns its full previous magazine to the
+//   depot, and obtains an empty magazine from it.
+//
+// The depot is locked only for the time needed to link or unlink one
+// magazine, and every such operation transfers a whole magazine of blocks,
+// without accessing the blocks themselves.  A block may be deallocated by a
+// thread other than the one that allocated it: the block is cached by the
+// deallocating thread, and returns to the depot in one of its magazines.
+//
+///Memory Bounds
+///- - - - - - -
+// The capacity of the magazines of a size class is limited both by a
+// configurable number of blocks (32 by default) and by the number of blocks
+// fitting in 8 kilobytes (but is at least 1).  Each thread therefore caches
+// at most two magazines of blocks per size class -- at most 16 kilobytes of
+// free blocks (plus their headers) for the size classes of blocks not larger
+// than 4 kilobytes.  When a thread exits, its magazines are returned to the
+// depots, and the (now empty) thread cache is reused by the next thread to
+// use the multipool.  Memory obtained from the underlying allocator for
+// pooled blocks is returned to it only by `release` or by the destructor.
+// The (small) bookkeeping data structures -- magazines and thread caches --
+// are retained until the multipool is destroyed.  Note that each
+// `bdlma::ThreadCachingMultipool` allocates one thread-specific storage key
+// (see `bslmt::ThreadUtil::createKey`), of which a process has a limited
+// number.
+//
+///Thread Safety
+///-------------
+// `bdlma::ThreadCachingMultipool` is *thread-safe*, meaning that `allocate`,
+// `deallocate`, `deleteObject`, and `deleteObjectRaw` can be invoked
+// concurrently from any thread.  However, `release` must not be invoked while
+// another thread is allocating or deallocating memory from the same
+// multipool.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// In this example, a producer thread allocates messages that are processed,
+// and deallocated, by a consumer thread.  The blocks deallocated by the
+// consumer are returned in magazines to the depot of their size class, from
+// which the producer obtains them.
+//
+// First, we define a message, and a queue of messages allocated from a
+// multipool:
+// ```
+// struct Message {
+//     int  d_sequenceNumber;
+//     char d_payload[60];
+// };
+//
+// struct MessageQueue {
+//     bdlma::ThreadCachingMultipool *d_multipool_p;
+//     bsl::deque<Message *>          d_messages;
+//     bslmt::Mutex                   d_mutex;
+//     bslmt::Condition               d_condition;
+// };
+// ```
+// Then, we define the function run by the consumer thread, which processes
+// messages until it receives a message having a negative sequence number,
+// and deallocates each message:
+// ```
+// extern "C" void *consume(void *arg)
+// {
+//     MessageQueue *queue = static_cast<MessageQueue *>(arg);
+//
+//     for (int expected = 0; ; ++expected) {
+//         Message *message;
+//         {
+//             bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+//
+//             while (queue->d_messages.empty()) {
+//                 queue->d_condition.wait(&queue->d_mutex);
+//             }
+//             message = queue->d_messages.front();
+//             queue->d_messages.pop_front();
+//         }
+//
+//         const int sequenceNumber = message->d_sequenceNumber;
+//         queue->d_multipool_p->deallocate(message);
+//
+//         if (sequenceNumber < 0) {
+//             break;
+//         }
+//         assert(expected == sequenceNumber);
+//     }
+//     return 0;
+// }
+// ```
+// Next, we create the multipool and the queue, and start the consumer
+// thread:
+// ```
+// bdlma::ThreadCachingMultipool multipool;
+//
+// MessageQueue queue;
+// queue.d_multipool_p = &multipool;
+//
+// bslmt::ThreadUtil::Handle consumer;
+// bslmt::ThreadUtil::create(&consumer, &consume, &queue);
+// ```
+// Finally, we produce messages, allocated from the multipool, and wait for
+// the consumer to process them:
+// ```
+// for (int i = 0; i <= 1000; ++i) {
+//     Message *message = static_cast<Message *>(
+//                                     multipool.allocate(sizeof(Message)));
+//     message->d_sequenceNumber = i < 1000 ? i : -1;
+//
+//     bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+//     queue.d_messages.push_back(message);
+//     queue.d_condition.signal();
+// }
+//
+// bslmt::ThreadUtil::join(consumer);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_infrequentdeleteblocklist.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct ThreadCachingMultipool_Cache;
+struct ThreadCachingMultipool_Depot;
+struct ThreadCachingMultipool_Magazine;
+
+                        // ============================
+                        // class ThreadCachingMultipool
+                        // ============================
+
+/// This class implements a memory manager that dispenses memory blocks of a
+/// configurable number of sizes, each successive size being twice the
+/// previous one, from magazines of free blocks cached by each thread, and
+/// exchanged in whole with a depot shared by all threads (see {Magazines and
+/// the Depot}).  Requests for blocks larger than the largest pooled size are
+/// served from a separately managed list of memory blocks.  Both the
+/// `release` method and the destructor release all memory currently
+/// allocated via the object.
+class ThreadCachingMultipool {
+
+    // PRIVATE TYPES
+    typedef ThreadCachingMultipool_Cache    Cache;
+    typedef ThreadCachingMultipool_Depot    Depot;
+    typedef ThreadCachingMultipool_Magazine Magazine;
+
+    /// This `struct` provides header information for each allocated memory
+    /// block.  The header stores the index of the size class of the block,
+    /// or -1 if the block is not pooled.
+    struct Header {
+
+        union {
+            int                    d_poolIdx;  // size class of this memory
+                                               // block
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    // DATA
+    Depot                    *d_depots_p;       // array of `d_numPools`
+                                                // depots, one per size class
+
+    int                       d_numPools;       // number of size classes
+
+    bsls::Types::size_type    d_maxBlockSize;   // largest pooled block size;
+                                                // always a power of 2
+
+    bsls::AtomicInt           d_numCaches;      // number of thread caches
+
+    bslmt::ThreadUtil::Key    d_cacheKey;       // key of the cache of the
+                                                // calling thread
+
+    Cache                    *d_caches_p;       // list of all thread caches
+
+    bdlma::InfrequentDeleteBlockList
+                              d_chunks;         // chunks of pooled blocks
+
+    bdlma::InfrequentDeleteBlockList
+                              d_metadata;       // depots, caches, and
+                                                // magazines
+
+    bdlma::BlockList          d_blockList;      // memory manager for "large"
+                                                // memory blocks
+
+    bslmt::Mutex              d_mutex;          // guards `d_caches_p`,
+                                                // `d_chunks`, `d_metadata`,
+                                                // and `d_blockList`
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipool(const ThreadCachingMultipool&)
+                                                          BSLS_KEYWORD_DELETED;
+    ThreadCachingMultipool& operator=(const ThreadCachingMultipool&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the magazines of the specified `cache` to the depots of its
+    /// multipool, and make `cache` available to another thread.  This
+    /// function is called by `bslmt::ThreadUtil` when a thread having a
+    /// cache exits.
+    static void releaseCache(void *cache);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the cache of the calling thread, assigning one to it if it
+    /// has none.
+    Cache *acquireCache();
+
+    /// Return a block of the size class having the specified `pool` index,
+    /// after exchanging magazines with the depot, or filling a magazine
+    /// with new blocks, for the specified `cache`.  The behavior is
+    /// undefined unless the loaded magazine of `cache` for `pool` is empty
+    /// or absent.
+    void *allocateSlow(Cache *cache, int pool);
+
+    /// Return the specified block `header` of the size class having the
+    /// specified `pool` index to the specified `cache`, after exchanging
+    /// magazines with the depot.  The behavior is undefined unless the
+    /// loaded magazine of `cache` for `pool` is full or absent.
+    void deallocateSlow(Cache *cache, int pool, Header *header);
+
+    /// Initialize this multipool with the specified `maxBlocksPerMagazine`.
+    void initialize(int maxBlocksPerMagazine);
+
+    /// Return a new empty magazine of the size class having the specified
+    /// `pool` index.  The behavior is undefined unless `d_mutex` is locked.
+    Magazine *newMagazine(int pool);
+
+    /// Return an empty magazine of the size class having the specified
+    /// `pool` index, from its depot if it holds one, or a new one
+    /// otherwise.
+    Magazine *obtainEmptyMagazine(int pool);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the size class in this multipool for an
+    /// allocation request of the specified `size` (in bytes).  Note that
+    /// the index of the size class managing memory blocks having the
+    /// minimum block size is 0.
+    int findPool(bsls::Types::size_type size) const;
+
+  public:
+    // CREATORS
+
+    /// Create a thread-caching multipool.  Optionally specify `numPools`,
+    /// indicating the number of size classes; the block size of the first
+    /// size class is 8 bytes, with the block size of each additional size
+    /// class successively doubling.  If `numPools` is not specified, an
+    /// implementation-defined number of size classes `N` -- covering memory
+    /// blocks ranging in size from `2^3 = 8` to `2^(N+2)` -- is used.  If
+    /// `numPools` is specified, optionally specify `maxBlocksPerMagazine`,
+    /// indicating the maximum number of blocks held by a magazine, and
+    /// therefore transferred at once between a thread and the depot of a
+    /// size class; if `maxBlocksPerMagazine` is not specified, 32 is used.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `1 <= numPools <= 32` and
+    /// `1 <= maxBlocksPerMagazine`.  Note that the capacity of the
+    /// magazines of a size class is also limited to 8 kilobytes of blocks,
+    /// but is at least 1.
+    explicit ThreadCachingMultipool(bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipool(int               numPools,
+                                    bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipool(int               numPools,
+                           int               maxBlocksPerMagazine,
+                           bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this multipool.  All memory allocated from this multipool is
+    /// released.  The behavior is undefined if a thread is using this
+    /// multipool.
+    ~ThreadCachingMultipool();
+
+    // MANIPULATORS
+
+    /// Return the address of a contiguous block of maximally-aligned memory
+    /// of (at least) the specified `size` (in bytes).  If
+    /// `size > maxPooledBlockSize()`, the memory allocation is managed
+    /// directly by the underlying allocator, and will not be pooled, but
+    /// will be deallocated when the `release` method is called, or when
+    /// this object is destroyed.  If `size` is 0, no memory is allocated
+    /// and 0 is returned.
+    void *allocate(bsls::Types::size_type size);
+
+    /// Relinquish the memory block at the specified `address` back to this
+    /// multipool object for reuse.  The behavior is undefined unless
+    /// `address` is non-zero, was allocated by this multipool object, and
+    /// has not already been deallocated.  Note that `address` may have been
+    /// allocated by another thread.
+    void deallocate(void *address);
+
+    /// Destroy the specified `object` based on its dynamic type and then
+    /// use this multipool object to deallocate its memory footprint.  This
+    /// method has no effect if `object` is 0.  The behavior is undefined
+    /// unless `object`, when cast appropriately to `void *`, was allocated
+    /// using this multipool object and has not already been deallocated.
+    /// Note that `dynamic_cast<void *>(object)` is applied if `TYPE` is
+    /// polymorphic, and `static_cast<void *>(object)` is applied otherwise.
+    template <class TYPE>
+    void deleteObject(const TYPE *object);
+
+    /// Destroy the specified `object` and then use this multipool to
+    /// deallocate its memory footprint.  This method has no effect if
+    /// `object` is 0.  The behavior is undefined unless `object` is **not** a
+    /// secondary base class pointer (i.e., the address is (numerically) the
+    /// same as when it was originally dispensed by this multipool), was
+    /// allocated using this multipool, and has not already been
+    /// deallocated.
+    template <class TYPE>
+    void deleteObjectRaw(const TYPE *object);
+
+    /// Relinquish all memory currently allocated via this multipool object,
+    /// including the blocks cached by each thread, but excluding the
+    /// bookkeeping data structures of the thread caches.  The behavior is
+    /// undefined if another thread is allocating or deallocating memory
+    /// from this multipool during this call.
+    void release();
+
+    // ACCESSORS
+
+    /// Return the maximum number of blocks held by a magazine of the size
+    /// class serving requests of the specified `size` (in bytes).  The
+    /// behavior is undefined unless `1 <= size <= maxPooledBlockSize()`.
+    int magazineCapacity(bsls::Types::size_type size) const;
+
+    /// Return the number of thread caches created by this multipool, that
+    /// is, the maximum number of threads that have concurrently used it.
+    int numThreadCaches() const;
+
+    /// Return the number of size classes managed by this multipool object.
+    int numPools() const;
+
+    /// Return the maximum size of memory blocks that are pooled by this
+    /// multipool object.  Note that the maximum value is defined as:
+    /// ```
+    /// 2 ^ (numPools + 2)
+    /// ```
+    /// where `numPools` is either specified at construction, or an
+    /// implementation-defined value.
+    bsls::Types::size_type maxPooledBlockSize() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to allocate memory.  Note
+    /// that this allocator can not be used to deallocate memory
+    /// allocated through this pool.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class ThreadCachingMultipool
+                        // ----------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void ThreadCachingMultipool::deleteObject(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObject(object, this);
+}
+
+template <class TYPE>
+inline
+void ThreadCachingMultipool::deleteObjectRaw(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObjectRaw(object, this);
+}
+
+// ACCESSORS
+inline
+int ThreadCachingMultipool::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bsls::Types::size_type ThreadCachingMultipool::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+// Aspects
+
+inline
+bslma::Allocator *ThreadCachingMultipool::allocator() const
+{
+    return d_blockList.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1232 @@
+// bdlma_threadcachingmultipool.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingmultipool.h>
+
+#include <bdlma_concurrentmultipool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlma::ThreadCachingMultipool` is a thread-safe memory manager.  Its
+// behavior is observed through the memory it obtains from a test allocator
+// (chunks of blocks, magazines, thread caches, and large blocks), through the
+// addresses of the blocks it dispenses, and through its accessors.  Most
+// concerns involve several threads, which are synchronized with barriers so
+// that the memory obtained from the test allocator is deterministic.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipool(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingMultipool(int numPools, bslma::Allocator *ba = 0);
+// [ 3] ThreadCachingMultipool(int, int, bslma::Allocator *);
+// [ 6] ~ThreadCachingMultipool();
+//
+// MANIPULATORS
+// [ 2] void *allocate(bsls::Types::size_type size);
+// [ 2] void deallocate(void *address);
+// [ 2] void deleteObject(const TYPE *object);
+// [ 2] void deleteObjectRaw(const TYPE *object);
+// [ 6] void release();
+//
+// ACCESSORS
+// [ 3] int magazineCapacity(bsls::Types::size_type size) const;
+// [ 5] int numThreadCaches() const;
+// [ 2] int numPools() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CROSS-THREAD DEALLOCATION
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: PRODUCER/CONSUMER AND SAME-THREAD PATTERNS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipool Obj;
+
+const int k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND TYPES
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the capacity of the magazines of a multipool having the specified
+/// `maxBlocksPerMagazine` for requests of the specified `size`, as
+/// documented in the component header.
+int expectedCapacity(bsls::Types::size_type size, int maxBlocksPerMagazine)
+{
+    bsls::Types::size_type pooled = 8;
+    while (pooled < size) {
+        pooled *= 2;
+    }
+    const bsls::Types::size_type blockSize =
+                       bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                        pooled + k_MAX_ALIGN);
+
+    int capacity = blockSize < 8192 ? static_cast<int>(8192 / blockSize) : 1;
+
+    return capacity < maxBlocksPerMagazine ? capacity : maxBlocksPerMagazine;
+}
+
+/// This `struct` describes the work of the threads of a test case.
+struct ThreadArgs {
+    Obj                 *d_multipool_p;     // multipool under test
+    bslmt::Barrier      *d_barrier_p;       // synchronizes the threads
+    bsl::vector<void *> *d_blocks_p;        // blocks shared by the threads
+    int                  d_size;            // size of each block
+    int                  d_numBlocks;       // blocks per round
+    int                  d_numRounds;       // number of rounds
+};
+
+/// Allocate `d_numBlocks` blocks of `d_size` bytes from the multipool of the
+/// `ThreadArgs` object at the specified `args` into `*d_blocks_p`, then wait
+/// on the barrier twice (while a consumer deallocates them), for each of
+/// `d_numRounds` rounds.
+extern "C" void *produceBlocks(void *args)
+{
+    ThreadArgs& a = *static_cast<ThreadArgs *>(args);
+
+    for (int round = 0; round < a.d_numRounds; ++round) {
+        for (int i = 0; i < a.d_numBlocks; ++i) {
+            void *block = a.d_multipool_p->allocate(a.d_size);
+            bsl::memset(block, i & 0xff, a.d_size);
+            (*a.d_blocks_p)[i] = block;
+        }
+        a.d_barrier_p->wait();
+        a.d_barrier_p->wait();
+    }
+    return 0;
+}
+
+/// Wait on the barrier of the `ThreadArgs` object at the specified `args`
+/// for the producer to fill `*d_blocks_p`, then verify and deallocate each
+/// of those blocks and wait on the barrier again, for each of `d_numRounds`
+/// rounds.
+extern "C" void *consumeBlocks(void *args)
+{
+    ThreadArgs& a = *static_cast<ThreadArgs *>(args);
+
+    for (int round = 0; round < a.d_numRounds; ++round) {
+        a.d_barrier_p->wait();
+        for (int i = 0; i < a.d_numBlocks; ++i) {
+            unsigned char *block =
+                         static_cast<unsigned char *>((*a.d_blocks_p)[i]);
+            for (int j = 0; j < a.d_size; ++j) {
+                ASSERTV(round, i, j, (i & 0xff) == block[j]);
+            }
+            a.d_multipool_p->deallocate(block);
+        }
+        a.d_barrier_p->wait();
+    }
+    return 0;
+}
+
+/// Allocate, and then deallocate, `d_numBlocks` blocks of `d_size` bytes
+/// from the multipool of the `ThreadArgs` object at the specified `args`,
+/// waiting on the barrier (if any) before returning.
+extern "C" void *allocateAndDeallocate(void *args)
+{
+    ThreadArgs& a = *static_cast<ThreadArgs *>(args);
+
+    bsl::vector<void *> blocks(a.d_numBlocks);
+    for (int i = 0; i < a.d_numBlocks; ++i) {
+        blocks[i] = a.d_multipool_p->allocate(a.d_size);
+    }
+    for (int i = 0; i < a.d_numBlocks; ++i) {
+        a.d_multipool_p->deallocate(blocks[i]);
+    }
+    if (a.d_barrier_p) {
+        a.d_barrier_p->wait();
+    }
+    return 0;
+}
+
+/// Allocate blocks of pseudo-random sizes from the multipool of the
+/// `ThreadArgs` object at the specified `args`, fill them with a pattern
+/// identifying the block, and deallocate them in a pseudo-random order
+/// after verifying the pattern, for `d_numRounds` rounds.
+extern "C" void *stress(void *args)
+{
+    ThreadArgs& a = *static_cast<ThreadArgs *>(args);
+
+    const int k_NUM_LIVE = 64;
+
+    unsigned int   seed = static_cast<unsigned int>(
+                           reinterpret_cast<bsls::Types::UintPtr>(&a) >> 4);
+    unsigned char *live[k_NUM_LIVE] = { 0 };
+    int            sizes[k_NUM_LIVE] = { 0 };
+
+    for (int round = 0; round < a.d_numRounds; ++round) {
+        seed = seed * 1103515245 + 12345;
+
+        const int slot = static_cast<int>((seed >> 8) % k_NUM_LIVE);
+        if (live[slot]) {
+            for (int j = 0; j < sizes[slot]; ++j) {
+                ASSERTV(round, slot, j, (slot & 0xff) == live[slot][j]);
+            }
+            a.d_multipool_p->deallocate(live[slot]);
+            live[slot] = 0;
+        }
+        else {
+            sizes[slot] = static_cast<int>((seed >> 16) % (a.d_size + 1));
+            if (0 == sizes[slot]) {
+                sizes[slot] = 1;
+            }
+            live[slot] = static_cast<unsigned char *>(
+                                   a.d_multipool_p->allocate(sizes[slot]));
+            bsl::memset(live[slot], slot & 0xff, sizes[slot]);
+        }
+    }
+
+    for (int i = 0; i < k_NUM_LIVE; ++i) {
+        if (live[i]) {
+            a.d_multipool_p->deallocate(live[i]);
+        }
+    }
+    return 0;
+}
+
+                          // ========================
+                          // struct BenchmarkArgs<MP>
+                          // ========================
+
+/// This `struct` describes the work of a producer or consumer thread of the
+/// performance test, using a multipool of type `MP`.
+template <class MP>
+struct BenchmarkArgs {
+    MP                    *d_multipool_p;   // multipool under test
+    bsl::deque<void *>    *d_queue_p;       // blocks passed to the consumer
+    bslmt::Mutex          *d_mutex_p;       // guards `*d_queue_p`
+    bslmt::Condition      *d_condition_p;   // signaled on push
+    int                    d_numBlocks;     // blocks to produce
+    int                    d_size;          // size of each block
+};
+
+/// Allocate `d_numBlocks` blocks and push them in batches to the queue of
+/// the `BenchmarkArgs<MP>` object at the specified `args`, followed by a
+/// null address.
+template <class MP>
+void *benchmarkProduce(void *args)
+{
+    BenchmarkArgs<MP>& a = *static_cast<BenchmarkArgs<MP> *>(args);
+
+    const int k_BATCH = 64;
+    void     *batch[k_BATCH];
+
+    for (int i = 0; i < a.d_numBlocks; i += k_BATCH) {
+        for (int j = 0; j < k_BATCH; ++j) {
+            batch[j] = a.d_multipool_p->allocate(a.d_size);
+        }
+        bslmt::LockGuard<bslmt::Mutex> guard(a.d_mutex_p);
+        a.d_queue_p->insert(a.d_queue_p->end(), batch, batch + k_BATCH);
+        a.d_condition_p->signal();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(a.d_mutex_p);
+    a.d_queue_p->push_back(0);
+    a.d_condition_p->signal();
+    return 0;
+}
+
+/// Deallocate the blocks popped from the queue of the `BenchmarkArgs<MP>`
+/// object at the specified `args`, until a null address is popped.
+template <class MP>
+void *benchmarkConsume(void *args)
+{
+    BenchmarkArgs<MP>& a = *static_cast<BenchmarkArgs<MP> *>(args);
+
+    bsl::vector<void *> batch;
+    while (true) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(a.d_mutex_p);
+            while (a.d_queue_p->empty()) {
+                a.d_condition_p->wait(a.d_mutex_p);
+            }
+            batch.assign(a.d_queue_p->begin(), a.d_queue_p->end());
+            a.d_queue_p->clear();
+        }
+        for (bsl::size_t i = 0; i < batch.size(); ++i) {
+            if (0 == batch[i]) {
+                return 0;                                             // RETURN
+            }
+            a.d_multipool_p->deallocate(batch[i]);
+        }
+    }
+}
+
+extern "C" void *benchmarkProduceTcm(void *args)
+{
+    return benchmarkProduce<Obj>(args);
+}
+
+extern "C" void *benchmarkConsumeTcm(void *args)
+{
+    return benchmarkConsume<Obj>(args);
+}
+
+extern "C" void *benchmarkProduceCm(void *args)
+{
+    return benchmarkProduce<bdlma::ConcurrentMultipool>(args);
+}
+
+extern "C" void *benchmarkConsumeCm(void *args)
+{
+    return benchmarkConsume<bdlma::ConcurrentMultipool>(args);
+}
+
+/// Return the number of seconds taken by a producer thread allocating the
+/// specified `numBlocks` blocks of the specified `size` from the specified
+/// `multipool`, and a consumer thread deallocating them.
+template <class MP>
+double timeProducerConsumer(MP                     *multipool,
+                            int                     numBlocks,
+                            int                     size,
+                            bslmt_ThreadFunction    producer,
+                            bslmt_ThreadFunction    consumer)
+{
+    bsl::deque<void *> queue;
+    bslmt::Mutex       mutex;
+    bslmt::Condition   condition;
+
+    BenchmarkArgs<MP> args = { multipool,
+                               &queue,
+                               &mutex,
+                               &condition,
+                               numBlocks,
+                               size };
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    bslmt::ThreadUtil::Handle handles[2];
+    bslmt::ThreadUtil::create(&handles[0], consumer, &args);
+    bslmt::ThreadUtil::create(&handles[1], producer, &args);
+    bslmt::ThreadUtil::join(handles[1]);
+    bslmt::ThreadUtil::join(handles[0]);
+
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+/// Return the number of seconds taken by the calling thread to allocate and
+/// deallocate, in batches of 16, the specified `numBlocks` blocks of the
+/// specified `size` from the specified `multipool`.
+template <class MP>
+double timeSameThread(MP *multipool, int numBlocks, int size)
+{
+    void *batch[16];
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numBlocks; i += 16) {
+        for (int j = 0; j < 16; ++j) {
+            batch[j] = multipool->allocate(size);
+        }
+        for (int j = 0; j < 16; ++j) {
+            multipool->deallocate(batch[j]);
+        }
+    }
+
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// In this example, a producer thread allocates messages that are processed,
+// and deallocated, by a consumer thread.  The blocks deallocated by the
+// consumer are returned in magazines to the depot of their size class, from
+// which the producer obtains them.
+//
+// First, we define a message, and a queue of messages allocated from a
+// multipool:
+// ```
+    struct Message {
+        int  d_sequenceNumber;
+        char d_payload[60];
+    };
+
+    struct MessageQueue {
+        bdlma::ThreadCachingMultipool *d_multipool_p;
+        bsl::deque<Message *>          d_messages;
+        bslmt::Mutex                   d_mutex;
+        bslmt::Condition               d_condition;
+    };
+// ```
+// Then, we define the function run by the consumer thread, which processes
+// messages until it receives a message having a negative sequence number,
+// and deallocates each message:
+// ```
+    extern "C" void *consume(void *arg)
+    {
+        MessageQueue *queue = static_cast<MessageQueue *>(arg);
+
+        for (int expected = 0; ; ++expected) {
+            Message *message;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+
+                while (queue->d_messages.empty()) {
+                    queue->d_condition.wait(&queue->d_mutex);
+                }
+                message = queue->d_messages.front();
+                queue->d_messages.pop_front();
+            }
+
+            const int sequenceNumber = message->d_sequenceNumber;
+            queue->d_multipool_p->deallocate(message);
+
+            if (sequenceNumber < 0) {
+                break;
+            }
+            ASSERT(expected == sequenceNumber);
+        }
+        return 0;
+    }
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Next, we create the multipool and the queue, and start the consumer
+// thread:
+// ```
+    bdlma::ThreadCachingMultipool multipool;
+
+    MessageQueue queue;
+    queue.d_multipool_p = &multipool;
+
+    bslmt::ThreadUtil::Handle consumer;
+    bslmt::ThreadUtil::create(&consumer, &consume, &queue);
+// ```
+// Finally, we produce messages, allocated from the multipool, and wait for
+// the consumer to process them:
+// ```
+    for (int i = 0; i <= 1000; ++i) {
+        Message *message = static_cast<Message *>(
+                                        multipool.allocate(sizeof(Message)));
+        message->d_sequenceNumber = i < 1000 ? i : -1;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+        queue.d_messages.push_back(message);
+        queue.d_condition.signal();
+    }
+
+    bslmt::ThreadUtil::join(consumer);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        // 1. Blocks allocated concurrently by several threads, of sizes in
+        //    every size class and larger, are distinct: writing to a block
+        //    does not corrupt another.
+        //
+        // 2. All memory is returned to the allocator on destruction.
+        //
+        // Plan:
+        // 1. In each of several threads, repeatedly allocate blocks of
+        //    pseudo-random size, fill them with a pattern, and deallocate
+        //    them in pseudo-random order after verifying the pattern.  (C-1)
+        //
+        // 2. Destroy the multipool and verify that no memory is in use.
+        //    (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 6 };
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(6, 4, &ta);
+
+            u::ThreadArgs args = { &mX, 0, 0, 600, 0, 20000 };
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          &u::stress,
+                                                          &args));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            ASSERTV(mX.numThreadCaches(),
+                    1 <= mX.numThreadCaches()
+                 && mX.numThreadCaches() <= k_NUM_THREADS);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RELEASE AND DESTRUCTOR
+        //
+        // Concerns:
+        // 1. `release` returns to the allocator all memory for pooled and
+        //    large blocks, including blocks cached by threads that have
+        //    exited and by threads that are still running.
+        //
+        // 2. The multipool is usable after `release`, by the threads that
+        //    used it before, and does not dispense blocks that were cached
+        //    before `release`.
+        //
+        // 3. The destructor returns all memory to the allocator.
+        //
+        // Plan:
+        // 1. Allocate and deallocate blocks in another thread and in the main
+        //    thread, and allocate large blocks.  Call `release` and verify
+        //    that the memory in use is that of the bookkeeping only (i.e.,
+        //    equal to that in use after allocating and deallocating a block
+        //    in each thread).  (C-1)
+        //
+        // 2. Allocate blocks after `release` and verify that each is obtained
+        //    from the allocator.  (C-2)
+        //
+        // 3. Destroy the multipool and verify that no memory is in use.
+        //    (C-3)
+        //
+        // Testing:
+        //   void release();
+        //   ~ThreadCachingMultipool();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RELEASE AND DESTRUCTOR" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(4, 4, &ta);
+
+            u::ThreadArgs args = { &mX, 0, 0, 8, 100, 1 };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &u::allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            u::allocateAndDeallocate(&args);
+
+            void *large = mX.allocate(1000);
+            ASSERT(large);
+
+            const bsls::Types::Int64 NUM_CHUNKS_BEFORE = ta.numBlocksInUse();
+
+            mX.release();
+
+            // What remains are the depots, the thread cache (used by both
+            // threads in turn), and the magazines.
+
+            const bsls::Types::Int64 NUM_BOOKKEEPING = ta.numBlocksInUse();
+            ASSERTV(NUM_CHUNKS_BEFORE, NUM_BOOKKEEPING,
+                    NUM_CHUNKS_BEFORE - 1 - 100 / 4 == NUM_BOOKKEEPING);
+            ASSERTV(mX.numThreadCaches(), 1 == mX.numThreadCaches());
+
+            // Each block now comes from a new chunk of 4 blocks.
+
+            bsl::set<void *> blocks;
+            for (int i = 0; i < 8; ++i) {
+                blocks.insert(mX.allocate(8));
+            }
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_BOOKKEEPING + 2 == ta.numBlocksInUse());
+            ASSERTV(blocks.size(), 8 == blocks.size());
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &u::allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THREAD EXIT AND CACHE REUSE
+        //
+        // Concerns:
+        // 1. When a thread exits, the blocks it caches are returned to the
+        //    depots, and are dispensed to other threads without obtaining
+        //    more memory from the allocator.
+        //
+        // 2. The cache of an exited thread is reused by the next thread, so
+        //    that the number of thread caches is the maximum number of
+        //    threads concurrently using the multipool.
+        //
+        // Plan:
+        // 1. In a thread, allocate and deallocate blocks.  After the thread
+        //    exits, run another thread allocating the same number of blocks,
+        //    and verify that no memory was obtained from the allocator.
+        //    (C-1..2)
+        //
+        // 2. Run several threads that each allocate and deallocate, and then
+        //    wait on a barrier, so that all use the multipool concurrently.
+        //    Verify the number of thread caches.  (C-2)
+        //
+        // Testing:
+        //   int numThreadCaches() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD EXIT AND CACHE REUSE" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        Obj                  mX(4, 8, &ta);
+        ASSERTV(mX.numThreadCaches(), 0 == mX.numThreadCaches());
+
+        u::ThreadArgs args = { &mX, 0, 0, 16, 200, 1 };
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                              &u::allocateAndDeallocate,
+                                              &args));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+        ASSERTV(mX.numThreadCaches(), 1 == mX.numThreadCaches());
+
+        const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+        for (int i = 0; i < 5; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &u::allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(i, mX.numThreadCaches(), 1 == mX.numThreadCaches());
+            ASSERTV(i, NUM_BYTES, ta.numBytesInUse(),
+                    NUM_BYTES == ta.numBytesInUse());
+        }
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslmt::Barrier barrier(k_NUM_THREADS);
+        args.d_barrier_p = &barrier;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                                                    &handles[i],
+                                                    &u::allocateAndDeallocate,
+                                                    &args));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+        ASSERTV(mX.numThreadCaches(),
+                k_NUM_THREADS == mX.numThreadCaches());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CROSS-THREAD DEALLOCATION
+        //
+        // Concerns:
+        // 1. A block allocated by one thread may be deallocated by another,
+        //    and is not corrupted in between.
+        //
+        // 2. Blocks deallocated by a consumer thread are returned, in
+        //    magazines, to the producer thread, so that the memory obtained
+        //    from the allocator by a producer/consumer pipeline is bounded.
+        //
+        // Plan:
+        // 1. In a producer thread, allocate a batch of blocks and fill them
+        //    with a pattern; in a consumer thread, verify the pattern and
+        //    deallocate the blocks.  Repeat for many rounds.  (C-1)
+        //
+        // 2. Verify that the memory in use after the rounds is that in use
+        //    after running a few rounds.  (C-2)
+        //
+        // Testing:
+        //   CROSS-THREAD DEALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CROSS-THREAD DEALLOCATION" << endl
+                          << "=========================" << endl;
+
+        const int SIZES[]   = { 1, 24, 100, 500 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator ta("object", veryVerbose);
+            Obj                  mX(8, 8, &ta);
+
+            bsl::vector<void *> blocks(100);
+            bslmt::Barrier      barrier(2);
+
+            u::ThreadArgs args = { &mX, &barrier, &blocks, SIZE, 100, 5 };
+
+            bsls::Types::Int64 numBytes[2];
+            for (int run = 0; run < 2; ++run) {
+                bslmt::ThreadUtil::Handle handles[2];
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[0],
+                                                      &u::produceBlocks,
+                                                      &args));
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[1],
+                                                      &u::consumeBlocks,
+                                                      &args));
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[0]));
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[1]));
+
+                numBytes[run] = ta.numBytesInUse();
+                args.d_numRounds = 100;
+            }
+
+            if (veryVerbose) { T_ P_(SIZE) P_(numBytes[0]) P(numBytes[1]) }
+
+            ASSERTV(SIZE, numBytes[0], numBytes[1],
+                    numBytes[0] == numBytes[1]);
+            ASSERTV(SIZE, mX.numThreadCaches(), 2 == mX.numThreadCaches());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MAGAZINE CAPACITY AND CACHE BOUNDS
+        //
+        // Concerns:
+        // 1. The capacity of the magazines of a size class is limited by
+        //    `maxBlocksPerMagazine` and by 8 kilobytes of blocks, but is at
+        //    least 1.
+        //
+        // 2. Blocks are obtained from the allocator one magazine at a time.
+        //
+        // 3. A thread reuses the blocks it deallocates, in LIFO order.
+        //
+        // 4. A thread caches at most two magazines of blocks per size class,
+        //    returning the others to the depot, from which another thread
+        //    obtains them.
+        //
+        // Plan:
+        // 1. Verify `magazineCapacity` for each size class of multipools
+        //    having various `maxBlocksPerMagazine`.  (C-1)
+        //
+        // 2. Allocate blocks one by one and verify that a chunk is obtained
+        //    from the allocator every `magazineCapacity` blocks.  (C-2)
+        //
+        // 3. Deallocate and reallocate blocks, and verify their addresses.
+        //    (C-3)
+        //
+        // 4. Deallocate many blocks in the main thread, then allocate them in
+        //    another thread, and verify that only blocks beyond the two
+        //    magazines cached by the main thread are reused.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingMultipool(int, int, bslma::Allocator *);
+        //   int magazineCapacity(bsls::Types::size_type size) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MAGAZINE CAPACITY AND CACHE BOUNDS" << endl
+                          << "==================================" << endl;
+
+        if (verbose) cout << "\nTesting `magazineCapacity`." << endl;
+        {
+            const int MAX_BLOCKS[] = { 1, 2, 5, 32, 1000 };
+            const int NUM_MAX_BLOCKS = sizeof MAX_BLOCKS / sizeof *MAX_BLOCKS;
+
+            for (int ti = 0; ti < NUM_MAX_BLOCKS; ++ti) {
+                const int MAX = MAX_BLOCKS[ti];
+
+                bslma::TestAllocator ta("object", veryVerbose);
+                Obj                  mX(14, MAX, &ta);
+                const Obj&           X = mX;
+
+                for (bsls::Types::size_type size = 1;
+                     size <= X.maxPooledBlockSize();
+                     size = size * 2 + 1) {
+                    const int EXP = u::expectedCapacity(size, MAX);
+
+                    ASSERTV(MAX, size, EXP, X.magazineCapacity(size),
+                            EXP == X.magazineCapacity(size));
+                    ASSERTV(MAX, size, 1 <= X.magazineCapacity(size));
+                }
+            }
+            Obj mX(&defaultAllocator);
+            ASSERTV(mX.magazineCapacity(8), 32 == mX.magazineCapacity(8));
+            ASSERTV(mX.magazineCapacity(4096),
+                    u::expectedCapacity(4096, 32) ==
+                                                   mX.magazineCapacity(4096));
+        }
+
+        if (verbose) cout << "\nTesting chunk allocation and reuse." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+            Obj                  mX(4, 5, &ta);
+
+            void *block = mX.allocate(20);
+            mX.deallocate(block);
+
+            // The depots, the thread cache, one magazine, and one chunk.
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < 25; ++i) {
+                blocks.push_back(mX.allocate(20));
+                ASSERTV(i, ta.numBlocksInUse(),
+                        NUM_BLOCKS + i / 5 == ta.numBlocksInUse());
+            }
+
+            // LIFO reuse of the loaded magazine.
+
+            mX.deallocate(blocks[24]);
+            mX.deallocate(blocks[23]);
+            ASSERT(blocks[23] == mX.allocate(20));
+            ASSERT(blocks[24] == mX.allocate(20));
+
+            // Deallocating 25 blocks fills five magazines: three go to the
+            // depot.
+
+            for (int i = 0; i < 25; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            bsl::vector<void *> otherBlocks(25);
+
+            u::ThreadArgs args = { &mX, 0, &otherBlocks, 20, 15, 1 };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &u::allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // The other thread obtained three magazines from the depot, and
+            // a thread cache.
+
+            ASSERTV(NUM_BYTES, ta.numBytesInUse(),
+                    NUM_BYTES < ta.numBytesInUse());
+            ASSERTV(NUM_BLOCKS + 4, ta.numBlocksInUse(),
+                    NUM_BLOCKS + 4 + 1 + 4 == ta.numBlocksInUse());
+
+            args.d_numBlocks = 16;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &u::allocateAndDeallocate,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // The 16th block required a new chunk, and deallocating the 16
+            // blocks a new magazine.
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS + 4 + 1 + 4 + 1 + 1 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        // 1. `allocate` returns 0 for a size of 0, and otherwise a
+        //    maximally-aligned block of at least the requested size, distinct
+        //    from other allocated blocks.
+        //
+        // 2. Requests larger than `maxPooledBlockSize` are served from a
+        //    block obtained from the allocator, returned by `deallocate`.
+        //
+        // 3. The accessors report the configuration of the multipool.
+        //
+        // 4. `deleteObject` and `deleteObjectRaw` destroy the object and
+        //    deallocate its block.
+        //
+        // 5. No memory is obtained from the default allocator.
+        //
+        // Plan:
+        // 1. For multipools having various numbers of size classes, allocate
+        //    blocks of every size up to twice `maxPooledBlockSize`, fill them
+        //    and verify alignment, distinctness, and the memory obtained for
+        //    large blocks.  (C-1..3, 5)
+        //
+        // 2. Create objects with placement new and delete them.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingMultipool(bslma::Allocator *ba = 0);
+        //   ThreadCachingMultipool(int numPools, bslma::Allocator *ba = 0);
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void deleteObject(const TYPE *object);
+        //   void deleteObjectRaw(const TYPE *object);
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+            Obj                  mX(&ta);
+            const Obj&           X = mX;
+
+            ASSERTV(X.numPools(), 10 == X.numPools());
+            ASSERTV(X.maxPooledBlockSize(), 4096 == X.maxPooledBlockSize());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == mX.allocate(0));
+        }
+        {
+            bslma::TestAllocator         da("default", veryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj mX;
+            ASSERT(&da == mX.allocator());
+        }
+
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        for (int numPools = 1; numPools <= 8; ++numPools) {
+            bslma::TestAllocator ta("object", veryVerbose);
+            Obj                  mX(numPools, &ta);
+            const Obj&           X = mX;
+
+            const bsls::Types::size_type MAX = 4 << numPools;
+
+            ASSERTV(numPools, numPools == X.numPools());
+            ASSERTV(numPools, MAX == X.maxPooledBlockSize());
+
+            bsl::vector<void *> blocks(&sa);
+            bsl::set<void *>    unique(&sa);
+            for (bsls::Types::size_type size = 1; size <= 2 * MAX; ++size) {
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(numPools, size, p);
+                ASSERTV(numPools, size,
+                        0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                               % k_MAX_ALIGN);
+                if (size > MAX) {
+                    ASSERTV(numPools, size,
+                            NUM_BLOCKS + 1 == ta.numBlocksInUse());
+                }
+                bsl::memset(p, static_cast<int>(size & 0xff), size);
+
+                blocks.push_back(p);
+                unique.insert(p);
+            }
+            ASSERTV(numPools, blocks.size() == unique.size());
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                const bsls::Types::size_type SIZE = i + 1;
+                const char *p = static_cast<char *>(blocks[i]);
+                for (bsls::Types::size_type j = 0; j < SIZE; ++j) {
+                    ASSERTV(numPools, SIZE, j,
+                            static_cast<char>(SIZE & 0xff) == p[j]);
+                }
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+                mX.deallocate(blocks[i]);
+                if (SIZE > MAX) {
+                    ASSERTV(numPools, SIZE,
+                            NUM_BLOCKS - 1 == ta.numBlocksInUse());
+                }
+            }
+        }
+
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+            Obj                  mX(&ta);
+
+            bsl::string *s = new (mX.allocate(sizeof(bsl::string)))
+                                              bsl::string("a long string that "
+                                                          "allocates memory",
+                                                          &ta);
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            mX.deleteObject(s);
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_BLOCKS - 1 == ta.numBlocksInUse());
+
+            s = new (mX.allocate(sizeof(bsl::string)))
+                                              bsl::string("another long string"
+                                                          " allocating memory",
+                                                          &ta);
+            mX.deleteObjectRaw(s);
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_BLOCKS - 1 == ta.numBlocksInUse());
+
+            mX.deleteObject(static_cast<bsl::string *>(0));
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a multipool, allocate blocks of several sizes, including
+        //    a large block, deallocate them, and verify that freed blocks are
+        //    reused.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(3, &ta);
+
+            ASSERT(32 == mX.maxPooledBlockSize());
+
+            void *p = mX.allocate(k_MAX_ALIGN);
+            void *q = mX.allocate(20);
+            void *r = mX.allocate(1024);
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(r);
+            ASSERT(p != q);
+            ASSERT(1 == mX.numThreadCaches());
+
+            mX.deallocate(q);
+            ASSERT(q == mX.allocate(17));
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            mX.deallocate(r);
+
+            mX.release();
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PRODUCER/CONSUMER AND SAME-THREAD PATTERNS
+        //
+        // Concerns:
+        // 1. Passing blocks from a producer thread to a consumer thread is
+        //    faster with `bdlma::ThreadCachingMultipool` than with
+        //    `bdlma::ConcurrentMultipool`.
+        //
+        // 2. Allocating and deallocating blocks in one thread is not slower.
+        //
+        // Plan:
+        // 1. Time both multipools for both patterns and report the results.
+        //    The number of blocks may be given as the second argument.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: PRODUCER/CONSUMER AND SAME-THREAD PATTERNS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: PRODUCER/CONSUMER AND SAME-THREAD PATTERNS"
+             << endl
+             << "======================================================="
+             << endl;
+
+        const int NUM_BLOCKS = argc > 2 && bsl::atoi(argv[2]) > 0
+                             ? bsl::atoi(argv[2]) / 64 * 64
+                             : 1 << 22;
+
+        const int SIZES[]   = { 16, 64, 256 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        cout << "blocks: " << NUM_BLOCKS << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bdlma::ConcurrentMultipool concurrent;
+            Obj                        caching;
+
+            const double CM_PC = u::timeProducerConsumer(
+                                                  &concurrent,
+                                                  NUM_BLOCKS,
+                                                  SIZE,
+                                                  &u::benchmarkProduceCm,
+                                                  &u::benchmarkConsumeCm);
+            const double TCM_PC = u::timeProducerConsumer(
+                                                  &caching,
+                                                  NUM_BLOCKS,
+                                                  SIZE,
+                                                  &u::benchmarkProduceTcm,
+                                                  &u::benchmarkConsumeTcm);
+            const double CM_ST  = u::timeSameThread(&concurrent,
+                                                    NUM_BLOCKS,
+                                                    SIZE);
+            const double TCM_ST = u::timeSameThread(&caching,
+                                                    NUM_BLOCKS,
+                                                    SIZE);
+
+            cout << "size " << SIZE
+                 << ": producer/consumer: concurrent " << CM_PC
+                 << "s, thread-caching " << TCM_PC
+                 << "s; same thread: concurrent " << CM_ST
+                 << "s, thread-caching " << TCM_ST << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,109 @@
+// bdlmt_coroutinetask.cpp                                            -*-C++-*-
+#include <bdlmt_coroutinetask.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_coroutinetask_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+/// Return the offset, from the start of a block holding a coroutine frame of
+/// the specified `size`, of the address at which the allocator of the frame
+/// is stored.
+bsl::size_t allocatorOffset(bsl::size_t size)
+{
+    return bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ----------------------------------
+                     // class CoroutineTask_SyncWaitSignal
+                     // ----------------------------------
+
+// CREATORS
+CoroutineTask_SyncWaitSignal::CoroutineTask_SyncWaitSignal()
+: d_isSet(false)
+{
+}
+
+// MANIPULATORS
+void CoroutineTask_SyncWaitSignal::set()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_isSet = true;
+    d_condition.signal();
+}
+
+void CoroutineTask_SyncWaitSignal::wait()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (!d_isSet) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+                       // ------------------------------
+                       // struct CoroutineTask_FrameUtil
+                       // ------------------------------
+
+// CLASS METHODS
+void *CoroutineTask_FrameUtil::allocate(bsl::size_t       size,
+                                        bslma::Allocator *allocator)
+{
+    bslma::Allocator  *frameAllocator = bslma::Default::allocator(allocator);
+    const bsl::size_t  offset         = u::allocatorOffset(size);
+
+    char *frame = static_cast<char *>(
+                frameAllocator->allocate(offset + sizeof(bslma::Allocator *)));
+
+    *reinterpret_cast<bslma::Allocator **>(frame + offset) = frameAllocator;
+
+    return frame;
+}
+
+void CoroutineTask_FrameUtil::deallocate(void *frame, bsl::size_t size)
+{
+    BSLS_ASSERT(frame);
+
+    char *block = static_cast<char *>(frame);
+
+    bslma::Allocator *allocator = *reinterpret_cast<bslma::Allocator **>(
+                                             block + u::allocatorOffset(size));
+    allocator->deallocate(block);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
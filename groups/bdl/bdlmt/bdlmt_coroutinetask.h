@@ -0,0 +1,771 @@
+// bdlmt_coroutinetask.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMT_COROUTINETASK
+#define INCLUDED_BDLMT_COROUTINETASK
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lazily started coroutine task allocating from `bslma`.
+//
+//@CLASSES:
+//  bdlmt::CoroutineTask: coroutine return type producing a `TYPE` result
+//
+//@SEE_ALSO: bdlmt_coroutineutil, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a class template,
+// `bdlmt::CoroutineTask`, that is the return type of a C++20 coroutine
+// producing a (possibly `void`) result of the template parameter `TYPE`.  A
+// task is *lazy*: the body of the coroutine does not start running until the
+// task is awaited (using `co_await` from another coroutine) or waited for
+// (using `syncWait` from ordinary code).  The task owns the coroutine frame,
+// and destroys it when the task is destroyed.
+//
+// This component is available only on platforms supporting C++20 coroutines,
+// as indicated by `BSLS_COMPILERFEATURES_SUPPORT_COROUTINE`.
+//
+///Awaiting a Task
+///---------------
+// When a coroutine executes `co_await` on a task (an rvalue of type
+// `bdlmt::CoroutineTask<TYPE>`), the awaiting coroutine is suspended, and the
+// task's coroutine is resumed on the same thread using symmetric transfer
+// (which, in optimized builds, does not grow the stack).  When the task's
+// coroutine completes, the awaiting coroutine is resumed, again by symmetric
+// transfer, on whatever thread the task completed, and the `co_await`
+// expression yields the result of the task, or rethrows the exception that
+// escaped the task's coroutine.
+//
+// `syncWait` starts a task from ordinary (non-coroutine) code and blocks the
+// calling thread until the task completes, which might happen on another
+// thread if the task switched threads (for example, using
+// `bdlmt::CoroutineUtil::scheduleOn`).
+//
+///Frame Allocation
+///----------------
+// The frame of a coroutine returning a `bdlmt::CoroutineTask` is allocated
+// from a `bslma::Allocator`.  Following the BDE convention for allocator
+// arguments, if the *last* parameter of the coroutine has a type that is
+// convertible to `bslma::Allocator *`, the frame is allocated from the
+// allocator supplied in that argument (or from the currently installed default
+// allocator if that argument is 0); otherwise, the frame is allocated from the
+// currently installed default allocator.  Note that the allocator supplied to
+// a coroutine must remain valid until the frame is destroyed.
+//
+///Thread Safety
+///-------------
+// A `bdlmt::CoroutineTask` object is not thread-safe: it must be awaited, or
+// waited for, by at most one thread at a time, and at most once.  Distinct
+// task objects can be used concurrently from distinct threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Composing Tasks
+/// - - - - - - - - - - - - -
+// Suppose that we want to compute a value using a coroutine that awaits other
+// coroutines, and that the frames of the coroutines should be allocated from
+// an allocator of our choice.
+//
+// First, we define a coroutine that computes the square of its argument, and
+// that takes the allocator as its last parameter:
+// ```
+// bdlmt::CoroutineTask<int> square(int value, bslma::Allocator *)
+// {
+//     co_return value * value;
+// }
+// ```
+// Then, we define a coroutine that sums the squares of two values, passing
+// its allocator on to the coroutines that it awaits:
+// ```
+// bdlmt::CoroutineTask<int> sumOfSquares(int               a,
+//                                        int               b,
+//                                        bslma::Allocator *allocator)
+// {
+//     int result = co_await square(a, allocator);
+//     result    += co_await square(b, allocator);
+//     co_return result;
+// }
+// ```
+// Next, we create a task, which does not start running yet, supplying a test
+// allocator from which its frame is allocated:
+// ```
+// bslma::TestAllocator ta;
+//
+// bdlmt::CoroutineTask<int> task = sumOfSquares(3, 4, &ta);
+// assert(1 == ta.numBlocksInUse());
+// ```
+// Finally, we run the task to completion, and verify its result:
+// ```
+// assert(25 == task.syncWait());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsl_coroutine.h>
+#include <bsl_cstddef.h>
+#include <bsl_exception.h>
+#include <bsl_type_traits.h>
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+namespace BloombergLP {
+namespace bdlmt {
+
+template <class TYPE>
+class CoroutineTask;
+
+                     // ==================================
+                     // class CoroutineTask_SyncWaitSignal
+                     // ==================================
+
+/// This component-private class provides a one-shot signal on which the
+/// thread calling `CoroutineTask::syncWait` waits for the completion of the
+/// task.
+class CoroutineTask_SyncWaitSignal {
+
+    // DATA
+    bslmt::Mutex     d_mutex;      // protects `d_isSet`
+    bslmt::Condition d_condition;  // signaled when `d_isSet` becomes `true`
+    bool             d_isSet;      // `true` once `set` is called
+
+  private:
+    // NOT IMPLEMENTED
+    CoroutineTask_SyncWaitSignal(const CoroutineTask_SyncWaitSignal&)
+                                                          BSLS_KEYWORD_DELETED;
+    CoroutineTask_SyncWaitSignal& operator=(
+                     const CoroutineTask_SyncWaitSignal&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a signal that is not set.
+    CoroutineTask_SyncWaitSignal();
+
+    // MANIPULATORS
+
+    /// Set this signal, waking up the thread blocked in `wait`, if any.
+    void set();
+
+    /// Block the calling thread until this signal is set.
+    void wait();
+};
+
+                       // ==============================
+                       // struct CoroutineTask_FrameUtil
+                       // ==============================
+
+/// This component-private utility `struct` provides functions that allocate
+/// and deallocate coroutine frames, recording the allocator of each frame
+/// after the frame itself.
+struct CoroutineTask_FrameUtil {
+
+    // CLASS METHODS
+
+    /// Return the address of a newly allocated block of memory holding a
+    /// coroutine frame of the specified `size`, allocated from the specified
+    /// `allocator`.  If `allocator` is 0, the currently installed default
+    /// allocator is used.
+    static void *allocate(bsl::size_t size, bslma::Allocator *allocator);
+
+    /// Return the allocator to be used for a coroutine having the specified
+    /// `argument` as its last parameter, that is, `argument` if its type is
+    /// convertible to `bslma::Allocator *`, and 0 otherwise.
+    template <class ARG_TYPE>
+    static bslma::Allocator *allocatorFrom(const ARG_TYPE& argument);
+
+    /// Deallocate the specified `frame`, which holds a coroutine frame of the
+    /// specified `size`, to the allocator from which it was allocated.  The
+    /// behavior is undefined unless `frame` was returned by `allocate` with
+    /// `size`.
+    static void deallocate(void *frame, bsl::size_t size);
+};
+
+                      // ===============================
+                      // class CoroutineTask_PromiseBase
+                      // ===============================
+
+/// This component-private class provides the part of the promise type of a
+/// `CoroutineTask` that does not depend on the type of the result.
+class CoroutineTask_PromiseBase {
+
+  public:
+    // PUBLIC TYPES
+
+    /// This `struct` provides the awaiter of the final suspension point of a
+    /// task's coroutine, which resumes the awaiting coroutine, if any, and
+    /// otherwise sets the signal of the waiting thread.
+    struct FinalAwaiter {
+
+        // ACCESSORS
+
+        /// Return `false`.
+        bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+        /// Return the coroutine awaiting the specified `handle`, if any, and
+        /// otherwise set the signal of the thread waiting for `handle`, and
+        /// return a no-op coroutine.
+        template <class PROMISE>
+        bsl::coroutine_handle<> await_suspend(
+                bsl::coroutine_handle<PROMISE> handle) const
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+        /// Do nothing.  Note that a coroutine is never resumed from its
+        /// final suspension point.
+        void await_resume() const BSLS_KEYWORD_NOEXCEPT;
+    };
+
+  private:
+    // DATA
+    bsl::coroutine_handle<>       d_continuation;  // awaiting coroutine, if
+                                                   // any
+
+    CoroutineTask_SyncWaitSignal *d_signal_p;      // signal of the waiting
+                                                   // thread, if any
+
+    bsl::exception_ptr            d_exception;     // exception that escaped
+                                                   // the coroutine, if any
+
+    // FRIENDS
+    friend struct FinalAwaiter;
+    template <class TYPE>
+    friend class CoroutineTask;
+
+  protected:
+    // PROTECTED ACCESSORS
+
+    /// Rethrow the exception that escaped the coroutine, if any.
+    void rethrowIfFailed() const;
+
+  public:
+    // CLASS METHODS
+
+    /// Return the address of a newly allocated block of memory holding a
+    /// coroutine frame of the specified `size`, allocated from the allocator
+    /// supplied as the last of the specified `arguments` of the coroutine,
+    /// if its type is convertible to `bslma::Allocator *`, and from the
+    /// currently installed default allocator otherwise.
+    template <class... ARGS>
+    static void *operator new(bsl::size_t size, const ARGS&... arguments);
+
+    /// Deallocate the specified `frame` having the specified `size`.
+    static void operator delete(void *frame, bsl::size_t size);
+
+    // CREATORS
+
+    /// Create a promise having no continuation and no exception.
+    CoroutineTask_PromiseBase();
+
+    // MANIPULATORS
+
+    /// Return an awaiter that suspends the coroutine before its body runs.
+    bsl::suspend_always initial_suspend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an awaiter that transfers control to the awaiting coroutine
+    /// when the coroutine completes.
+    FinalAwaiter final_suspend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Store the exception currently being handled, so that it is rethrown
+    /// when the result is retrieved.
+    void unhandled_exception() BSLS_KEYWORD_NOEXCEPT;
+};
+
+                        // ===========================
+                        // class CoroutineTask_Promise
+                        // ===========================
+
+/// This component-private class template provides the promise type of a
+/// `CoroutineTask<TYPE>`, holding the result of the coroutine.
+template <class TYPE>
+class CoroutineTask_Promise : public CoroutineTask_PromiseBase {
+
+    // DATA
+    bsls::ObjectBuffer<TYPE> d_value;     // result, if `d_hasValue`
+    bool                     d_hasValue;  // `true` if `d_value` holds a value
+
+  private:
+    // NOT IMPLEMENTED
+    CoroutineTask_Promise(const CoroutineTask_Promise&) BSLS_KEYWORD_DELETED;
+    CoroutineTask_Promise& operator=(const CoroutineTask_Promise&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a promise having no result.
+    CoroutineTask_Promise();
+
+    /// Destroy this object.
+    ~CoroutineTask_Promise();
+
+    // MANIPULATORS
+
+    /// Return the task owning the coroutine of this promise.
+    CoroutineTask<TYPE> get_return_object();
+
+    /// Store the specified `value` as the result of the coroutine.
+    template <class VALUE_TYPE>
+    void return_value(VALUE_TYPE&& value);
+
+    /// Return the result of the coroutine, moving it out of this promise, or
+    /// rethrow the exception that escaped the coroutine.  The behavior is
+    /// undefined unless the coroutine completed.
+    TYPE result();
+};
+
+/// This component-private specialization provides the promise type of a
+/// `CoroutineTask<void>`.
+template <>
+class CoroutineTask_Promise<void> : public CoroutineTask_PromiseBase {
+
+  public:
+    // MANIPULATORS
+
+    /// Return the task owning the coroutine of this promise.
+    CoroutineTask<void> get_return_object();
+
+    /// Do nothing.
+    void return_void() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Rethrow the exception that escaped the coroutine, if any.  The
+    /// behavior is undefined unless the coroutine completed.
+    void result();
+};
+
+                            // ===================
+                            // class CoroutineTask
+                            // ===================
+
+/// This move-only class template is the return type of a coroutine producing
+/// a result of the (template parameter) `TYPE`, owning the frame of the
+/// coroutine.  See {Description}.
+template <class TYPE>
+class CoroutineTask {
+
+  public:
+    // TYPES
+    typedef CoroutineTask_Promise<TYPE> promise_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::coroutine_handle<promise_type> Handle;
+
+    /// This `class` provides the awaiter returned by `operator co_await`.
+    class Awaiter {
+
+        // DATA
+        Handle d_handle;  // awaited coroutine
+
+      public:
+        // CREATORS
+
+        /// Create an awaiter of the coroutine having the specified `handle`.
+        explicit Awaiter(Handle handle);
+
+        // MANIPULATORS
+
+        /// Return `false`.
+        bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+        /// Record the specified `awaiting` coroutine as the continuation of
+        /// the awaited coroutine, and return the awaited coroutine, so that
+        /// it is resumed.
+        bsl::coroutine_handle<> await_suspend(
+                     bsl::coroutine_handle<> awaiting) BSLS_KEYWORD_NOEXCEPT;
+
+        /// Return the result of the awaited coroutine, or rethrow the
+        /// exception that escaped it.
+        TYPE await_resume();
+    };
+
+    // DATA
+    Handle d_handle;  // owned coroutine, or a null handle if moved from
+
+    // FRIENDS
+    friend class CoroutineTask_Promise<TYPE>;
+
+    // PRIVATE CREATORS
+
+    /// Create a task owning the coroutine having the specified `handle`.
+    explicit CoroutineTask(Handle handle);
+
+  private:
+    // NOT IMPLEMENTED
+    CoroutineTask(const CoroutineTask&) BSLS_KEYWORD_DELETED;
+    CoroutineTask& operator=(const CoroutineTask&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a task owning the coroutine owned by the specified `original`
+    /// task, leaving `original` owning no coroutine.
+    CoroutineTask(bslmf::MovableRef<CoroutineTask> original)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+    /// Destroy this task, and the frame of the coroutine it owns, if any.
+    /// The behavior is undefined if the coroutine is running.
+    ~CoroutineTask();
+
+    // MANIPULATORS
+
+    /// Return an awaiter that starts the coroutine owned by this task and
+    /// suspends the awaiting coroutine until it completes.  The behavior is
+    /// undefined unless this task owns a coroutine that has not been
+    /// started.
+    Awaiter operator co_await() && BSLS_KEYWORD_NOEXCEPT;
+
+    /// Start the coroutine owned by this task, block the calling thread until
+    /// the coroutine completes, and return its result, or rethrow the
+    /// exception that escaped it.  The behavior is undefined unless this task
+    /// owns a coroutine that has not been started, and the calling thread is
+    /// not needed for the coroutine to complete.
+    TYPE syncWait();
+
+    // ACCESSORS
+
+    /// Return `true` if this task owns a coroutine that has completed, and
+    /// `false` otherwise.
+    bool isDone() const;
+
+    /// Return `true` if this task owns a coroutine, and `false` otherwise.
+    bool isValid() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // struct CoroutineTask_FrameUtil
+                       // ------------------------------
+
+// CLASS METHODS
+template <class ARG_TYPE>
+inline
+bslma::Allocator *CoroutineTask_FrameUtil::allocatorFrom(
+                                                      const ARG_TYPE& argument)
+{
+    if constexpr (bsl::is_convertible<const ARG_TYPE&,
+                                      bslma::Allocator *>::value) {
+        return argument;                                              // RETURN
+    }
+    else {
+        (void)argument;
+        return 0;                                                     // RETURN
+    }
+}
+
+                      // -------------------------------
+                      // class CoroutineTask_PromiseBase
+                      // -------------------------------
+
+                                // ------------
+                                // FinalAwaiter
+                                // ------------
+
+// ACCESSORS
+inline
+bool CoroutineTask_PromiseBase::FinalAwaiter::await_ready() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+template <class PROMISE>
+inline
+bsl::coroutine_handle<> CoroutineTask_PromiseBase::FinalAwaiter::await_suspend(
+                  bsl::coroutine_handle<PROMISE> handle) const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    CoroutineTask_PromiseBase& promise = handle.promise();
+
+    if (promise.d_continuation) {
+        return promise.d_continuation;                                // RETURN
+    }
+
+    // The waiting thread may destroy the frame as soon as the signal is set,
+    // so the promise must not be accessed after calling `set`.
+
+    CoroutineTask_SyncWaitSignal *signal = promise.d_signal_p;
+    if (signal) {
+        signal->set();
+    }
+    return bsl::noop_coroutine();
+}
+
+inline
+void CoroutineTask_PromiseBase::FinalAwaiter::await_resume() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+}
+
+// PROTECTED ACCESSORS
+inline
+void CoroutineTask_PromiseBase::rethrowIfFailed() const
+{
+    if (d_exception) {
+        bsl::rethrow_exception(d_exception);
+    }
+}
+
+// CLASS METHODS
+template <class... ARGS>
+inline
+void *CoroutineTask_PromiseBase::operator new(bsl::size_t     size,
+                                              const ARGS&...  arguments)
+{
+    bslma::Allocator *allocator = 0;
+    ((allocator = CoroutineTask_FrameUtil::allocatorFrom(arguments)), ...);
+
+    return CoroutineTask_FrameUtil::allocate(size, allocator);
+}
+
+inline
+void CoroutineTask_PromiseBase::operator delete(void        *frame,
+                                                bsl::size_t  size)
+{
+    CoroutineTask_FrameUtil::deallocate(frame, size);
+}
+
+// CREATORS
+inline
+CoroutineTask_PromiseBase::CoroutineTask_PromiseBase()
+: d_continuation()
+, d_signal_p(0)
+, d_exception()
+{
+}
+
+// MANIPULATORS
+inline
+bsl::suspend_always CoroutineTask_PromiseBase::initial_suspend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return bsl::suspend_always();
+}
+
+inline
+CoroutineTask_PromiseBase::FinalAwaiter
+CoroutineTask_PromiseBase::final_suspend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return FinalAwaiter();
+}
+
+inline
+void CoroutineTask_PromiseBase::unhandled_exception() BSLS_KEYWORD_NOEXCEPT
+{
+    d_exception = bsl::current_exception();
+}
+
+                        // ---------------------------
+                        // class CoroutineTask_Promise
+                        // ---------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+CoroutineTask_Promise<TYPE>::CoroutineTask_Promise()
+: d_hasValue(false)
+{
+}
+
+template <class TYPE>
+inline
+CoroutineTask_Promise<TYPE>::~CoroutineTask_Promise()
+{
+    if (d_hasValue) {
+        d_value.object().~TYPE();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+CoroutineTask<TYPE> CoroutineTask_Promise<TYPE>::get_return_object()
+{
+    return CoroutineTask<TYPE>(
+         bsl::coroutine_handle<CoroutineTask_Promise>::from_promise(*this));
+}
+
+template <class TYPE>
+template <class VALUE_TYPE>
+inline
+void CoroutineTask_Promise<TYPE>::return_value(VALUE_TYPE&& value)
+{
+    BSLS_ASSERT(!d_hasValue);
+
+    ::new (d_value.buffer()) TYPE(static_cast<VALUE_TYPE&&>(value));
+    d_hasValue = true;
+}
+
+template <class TYPE>
+inline
+TYPE CoroutineTask_Promise<TYPE>::result()
+{
+    rethrowIfFailed();
+
+    BSLS_ASSERT(d_hasValue);
+
+    return bslmf::MovableRefUtil::move(d_value.object());
+}
+
+inline
+CoroutineTask<void> CoroutineTask_Promise<void>::get_return_object()
+{
+    return CoroutineTask<void>(
+         bsl::coroutine_handle<CoroutineTask_Promise>::from_promise(*this));
+}
+
+inline
+void CoroutineTask_Promise<void>::return_void() const BSLS_KEYWORD_NOEXCEPT
+{
+}
+
+inline
+void CoroutineTask_Promise<void>::result()
+{
+    rethrowIfFailed();
+}
+
+                            // -------------------
+                            // class CoroutineTask
+                            // -------------------
+
+                                  // -------
+                                  // Awaiter
+                                  // -------
+
+// CREATORS
+template <class TYPE>
+inline
+CoroutineTask<TYPE>::Awaiter::Awaiter(Handle handle)
+: d_handle(handle)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+bool CoroutineTask<TYPE>::Awaiter::await_ready() const BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+template <class TYPE>
+inline
+bsl::coroutine_handle<> CoroutineTask<TYPE>::Awaiter::await_suspend(
+                       bsl::coroutine_handle<> awaiting) BSLS_KEYWORD_NOEXCEPT
+{
+    d_handle.promise().d_continuation = awaiting;
+    return d_handle;
+}
+
+template <class TYPE>
+inline
+TYPE CoroutineTask<TYPE>::Awaiter::await_resume()
+{
+    return d_handle.promise().result();
+}
+
+// PRIVATE CREATORS
+template <class TYPE>
+inline
+CoroutineTask<TYPE>::CoroutineTask(Handle handle)
+: d_handle(handle)
+{
+}
+
+// CREATORS
+template <class TYPE>
+inline
+CoroutineTask<TYPE>::CoroutineTask(bslmf::MovableRef<CoroutineTask> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_handle(bslmf::MovableRefUtil::access(original).d_handle)
+{
+    bslmf::MovableRefUtil::access(original).d_handle = Handle();
+}
+
+template <class TYPE>
+inline
+CoroutineTask<TYPE>::~CoroutineTask()
+{
+    if (d_handle) {
+        d_handle.destroy();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+typename CoroutineTask<TYPE>::Awaiter
+CoroutineTask<TYPE>::operator co_await() && BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT(d_handle);
+    BSLS_ASSERT(!d_handle.done());
+
+    return Awaiter(d_handle);
+}
+
+template <class TYPE>
+TYPE CoroutineTask<TYPE>::syncWait()
+{
+    BSLS_ASSERT(d_handle);
+    BSLS_ASSERT(!d_handle.done());
+
+    CoroutineTask_SyncWaitSignal signal;
+
+    d_handle.promise().d_signal_p = &signal;
+    d_handle.resume();
+    signal.wait();
+
+    return d_handle.promise().result();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bool CoroutineTask<TYPE>::isDone() const
+{
+    return d_handle && d_handle.done();
+}
+
+template <class TYPE>
+inline
+bool CoroutineTask<TYPE>::isValid() const
+{
+    return static_cast<bool>(d_handle);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
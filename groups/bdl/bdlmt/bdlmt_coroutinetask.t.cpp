@@ -0,0 +1,717 @@
+// bdlmt_coroutinetask.t.cpp                                          -*-C++-*-
+#include <bdlmt_coroutinetask.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlmt::CoroutineTask` is the return type of a lazily started coroutine.
+// We verify that the coroutine does not start before the task is awaited or
+// waited for, that results (including results of allocator-aware types and
+// exceptions) are delivered to the awaiting coroutine and to `syncWait`,
+// that chains of synchronously completing tasks can be awaited, and that
+// frames are allocated from, and returned to, the allocator passed
+// as the last argument of the coroutine, or the default allocator.
+//
+// The component is available only if `BSLS_COMPILERFEATURES_SUPPORT_COROUTINE`
+// is set; otherwise every test case is empty.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void *promise_type::operator new(size_t, const ARGS&...);
+// [ 3] void promise_type::operator delete(void *, size_t);
+//
+// CREATORS
+// [ 2] CoroutineTask(bslmf::MovableRef<CoroutineTask> original);
+// [ 2] ~CoroutineTask();
+//
+// MANIPULATORS
+// [ 4] Awaiter operator co_await() &&;
+// [ 2] TYPE syncWait();
+//
+// ACCESSORS
+// [ 2] bool isDone() const;
+// [ 2] bool isValid() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: exceptions propagate to the awaiting coroutine
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+namespace {
+
+/// Set the specified `*started` to `true`, and return the specified `value`.
+bdlmt::CoroutineTask<int> record(bool *started, int value)
+{
+    *started = true;
+    co_return value;
+}
+
+/// Return the specified `value`, allocating the frame from the specified
+/// `allocator`.
+bdlmt::CoroutineTask<int> identity(int value, bslma::Allocator *)
+{
+    co_return value;
+}
+
+/// Return the specified `value`, allocating the frame from the default
+/// allocator, since the allocator argument is not the last argument.
+bdlmt::CoroutineTask<int> identityNotLast(bslma::Allocator *, int value)
+{
+    co_return value;
+}
+
+/// Return a string holding the specified `value`, allocating the frame from
+/// the specified `allocator`.
+bdlmt::CoroutineTask<bsl::string> makeString(const char       *value,
+                                             bslma::Allocator *allocator)
+{
+    co_return bsl::string(value, allocator);
+}
+
+/// Increment the specified `*counter`.
+bdlmt::CoroutineTask<void> increment(int *counter)
+{
+    ++*counter;
+    co_return;
+}
+
+/// Await the specified `numIterations` tasks incrementing the specified
+/// `*counter`, and return `*counter`.
+bdlmt::CoroutineTask<int> incrementMany(int *counter, int numIterations)
+{
+    for (int i = 0; i < numIterations; ++i) {
+        co_await increment(counter);
+    }
+    co_return *counter;
+}
+
+/// Return the sum of the specified `depth` nested awaits of tasks that each
+/// add 1, allocating the frames from the specified `allocator`.
+bdlmt::CoroutineTask<int> nested(int depth, bslma::Allocator *allocator)
+{
+    if (0 == depth) {
+        co_return 0;
+    }
+    co_return 1 + co_await nested(depth - 1, allocator);
+}
+
+/// Resume the awaiting coroutine on a thread of the specified `pool`, and
+/// return the identifier of that thread.
+bdlmt::CoroutineTask<bslmt::ThreadUtil::Id> hop(bdlmt::FixedThreadPool *pool)
+{
+    struct Awaiter {
+        bdlmt::FixedThreadPool *d_pool_p;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(bsl::coroutine_handle<> handle) const
+        {
+            d_pool_p->enqueueJob([handle]() { handle.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+
+    co_await Awaiter{pool};
+    co_return bslmt::ThreadUtil::selfId();
+}
+
+#ifdef BDE_BUILD_TARGET_EXC
+/// Throw `bsl::runtime_error` having the specified `message`.
+bdlmt::CoroutineTask<int> fail(const char *message)
+{
+    throw bsl::runtime_error(message);
+    co_return 0;
+}
+
+/// Await a task that throws, and return 1 if the exception is caught.
+bdlmt::CoroutineTask<int> catchFailure()
+{
+    try {
+        co_await fail("inner");
+    }
+    catch (const bsl::runtime_error& e) {
+        ASSERT(bsl::string("inner") == e.what());
+        co_return 1;
+    }
+    co_return 0;
+}
+#endif
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Composing Tasks
+/// - - - - - - - - - - - - -
+// Suppose that we want to compute a value using a coroutine that awaits other
+// coroutines, and that the frames of the coroutines should be allocated from
+// an allocator of our choice.
+//
+// First, we define a coroutine that computes the square of its argument, and
+// that takes the allocator as its last parameter:
+// ```
+    bdlmt::CoroutineTask<int> square(int value, bslma::Allocator *)
+    {
+        co_return value * value;
+    }
+// ```
+// Then, we define a coroutine that sums the squares of two values, passing
+// its allocator on to the coroutines that it awaits:
+// ```
+    bdlmt::CoroutineTask<int> sumOfSquares(int               a,
+                                           int               b,
+                                           bslma::Allocator *allocator)
+    {
+        int result = co_await square(a, allocator);
+        result    += co_await square(b, allocator);
+        co_return result;
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        using namespace USAGE_EXAMPLE;
+
+// Next, we create a task, which does not start running yet, supplying a test
+// allocator from which its frame is allocated:
+// ```
+    bslma::TestAllocator ta;
+
+    bdlmt::CoroutineTask<int> task = sumOfSquares(3, 4, &ta);
+    ASSERT(1 == ta.numBlocksInUse());
+// ```
+// Finally, we run the task to completion, and verify its result:
+// ```
+    ASSERT(25 == task.syncWait());
+// ```
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTIONS PROPAGATE
+        //
+        // Concerns:
+        // 1. An exception escaping a coroutine is rethrown by `co_await` in
+        //    the awaiting coroutine.
+        //
+        // 2. An exception escaping a coroutine is rethrown by `syncWait`.
+        //
+        // 3. No memory is leaked when a coroutine fails.
+        //
+        // Plan:
+        // 1. Await a failing task from a coroutine that catches the
+        //    exception, and verify that it was caught.  (C-1)
+        //
+        // 2. Call `syncWait` on a failing task, and verify that the exception
+        //    is thrown.  (C-2)
+        //
+        // 3. Verify that the default allocator has no blocks in use at the
+        //    end of the test.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: exceptions propagate to the awaiting coroutine
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: EXCEPTIONS PROPAGATE" << endl
+                          << "=============================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE && defined(BDE_BUILD_TARGET_EXC)
+        {
+            bdlmt::CoroutineTask<int> task = catchFailure();
+            ASSERT(1 == task.syncWait());
+        }
+        {
+            bdlmt::CoroutineTask<int> task = fail("outer");
+
+            bool caught = false;
+            try {
+                task.syncWait();
+            }
+            catch (const bsl::runtime_error& e) {
+                caught = true;
+                ASSERT(bsl::string("outer") == e.what());
+            }
+            ASSERT(caught);
+            ASSERT(task.isDone());
+        }
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `operator co_await`
+        //
+        // Concerns:
+        // 1. Awaiting a task starts its coroutine, and the `co_await`
+        //    expression yields its result.
+        //
+        // 2. Awaiting a `CoroutineTask<void>` runs its coroutine.
+        //
+        // 3. Results of allocator-aware types are moved to the awaiting
+        //    coroutine.
+        //
+        // 4. Many tasks that complete synchronously can be awaited,
+        //    sequentially or nested.  Note that whether symmetric transfer
+        //    avoids growing the stack depends on the optimization level, so
+        //    the number of tasks is modest.
+        //
+        // 5. The awaiting coroutine is resumed on the thread on which the
+        //    awaited task completes.
+        //
+        // Plan:
+        // 1. Await tasks of types `int`, `void` and `bsl::string`, and verify
+        //    the results.  (C-1..3)
+        //
+        // 2. Await ten thousand `void` tasks in a loop, and a chain of a
+        //    thousand nested tasks.  (C-4)
+        //
+        // 3. Await a task that hops to a thread pool, and verify that the
+        //    awaiting coroutine continues on that thread.  (C-5)
+        //
+        // Testing:
+        //   Awaiter operator co_await() &&;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `operator co_await`" << endl
+                          << "===========================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\nAwaiting tasks of various types." << endl;
+        {
+            struct Local {
+                static bdlmt::CoroutineTask<int> run(bslma::Allocator *alloc)
+                {
+                    int counter = 0;
+                    co_await increment(&counter);
+
+                    bsl::string s = co_await makeString(
+                                 "a string too long for the small buffer",
+                                 alloc);
+                    ASSERT(alloc == s.get_allocator().mechanism());
+                    ASSERT("a string too long for the small buffer" == s);
+
+                    co_return counter + co_await identity(41, alloc);
+                }
+            };
+
+            bdlmt::CoroutineTask<int> task = Local::run(&ta);
+            ASSERT(42 == task.syncWait());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nAwaiting many tasks." << endl;
+        {
+            const int NUM_ITERATIONS = 10 * 1000;
+
+            int                       counter = 0;
+            bdlmt::CoroutineTask<int> task    = incrementMany(&counter,
+                                                              NUM_ITERATIONS);
+            ASSERT(NUM_ITERATIONS == task.syncWait());
+
+            const int DEPTH = 1000;
+
+            bdlmt::CoroutineTask<int> deep = nested(DEPTH, &ta);
+            ASSERT(DEPTH == deep.syncWait());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nResuming on the completing thread." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 10, &ta);
+            ASSERT(0 == pool.start());
+
+            struct Local {
+                static bdlmt::CoroutineTask<bool> run(
+                                                 bdlmt::FixedThreadPool *pool)
+                {
+                    bslmt::ThreadUtil::Id id = co_await hop(pool);
+                    co_return id == bslmt::ThreadUtil::selfId();
+                }
+            };
+
+            bdlmt::CoroutineTask<bool> task = Local::run(&pool);
+            ASSERT(true == task.syncWait());
+
+            pool.stop();
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING FRAME ALLOCATION
+        //
+        // Concerns:
+        // 1. The frame is allocated, when the coroutine is called, from the
+        //    allocator passed as the last argument of the coroutine.
+        //
+        // 2. The frame is allocated from the default allocator if the last
+        //    argument is not an allocator, or is a null allocator.
+        //
+        // 3. The frame is returned to the allocator from which it was
+        //    allocated when the task is destroyed, whether or not the
+        //    coroutine ran.
+        //
+        // Plan:
+        // 1. Call coroutines taking an allocator as their last argument, as
+        //    another argument, or not at all, and verify the allocators used,
+        //    before and after running the coroutines, and after destroying
+        //    the tasks.  (C-1..3)
+        //
+        // Testing:
+        //   void *promise_type::operator new(size_t, const ARGS&...);
+        //   void promise_type::operator delete(void *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING FRAME ALLOCATION" << endl
+                          << "========================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\nAllocator as the last argument." << endl;
+        {
+            bdlmt::CoroutineTask<int> task = identity(5, &ta);
+
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            ASSERT(5 == task.syncWait());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(1 == ta.numBlocksTotal());
+
+        if (verbose) cout << "\nUnstarted coroutine." << endl;
+        {
+            bdlmt::CoroutineTask<int> task = identity(5, &ta);
+
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNull allocator." << endl;
+        {
+            bdlmt::CoroutineTask<int> task = identity(5, 0);
+
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+            ASSERT(5 == task.syncWait());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nAllocator not the last argument." << endl;
+        {
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            bdlmt::CoroutineTask<int> task = identityNotLast(&ta, 5);
+
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+            ASSERT(5 == task.syncWait());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nNo arguments." << endl;
+        {
+            int counter = 0;
+
+            struct Local {
+                static bdlmt::CoroutineTask<void> run(int *counter)
+                {
+                    co_await increment(counter);
+                }
+            };
+
+            bdlmt::CoroutineTask<void> task = Local::run(&counter);
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+
+            task.syncWait();
+            ASSERT(1 == counter);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `syncWait`, MOVE CONSTRUCTOR AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The coroutine does not start until `syncWait` is called.
+        //
+        // 2. `syncWait` returns the result of the coroutine, including when
+        //    the coroutine completes on another thread.
+        //
+        // 3. `isValid` and `isDone` reflect the state of the task.
+        //
+        // 4. The move constructor transfers ownership of the coroutine,
+        //    leaving the source invalid.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create a task recording whether it started, and verify the
+        //    accessors before and after `syncWait`.  (C-1..3)
+        //
+        // 2. Call `syncWait` on a task that hops to a thread pool.  (C-2)
+        //
+        // 3. Move a task, and verify both tasks.  (C-4)
+        //
+        // 4. Verify that calling `syncWait` twice, or on a moved-from task,
+        //    is detected.  (C-5)
+        //
+        // Testing:
+        //   CoroutineTask(bslmf::MovableRef<CoroutineTask> original);
+        //   ~CoroutineTask();
+        //   TYPE syncWait();
+        //   bool isDone() const;
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `syncWait`, MOVE CONSTRUCTOR AND "
+                          << "ACCESSORS" << endl
+                          << "========================================="
+                          << "=========" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            bool started = false;
+
+            bdlmt::CoroutineTask<int> task = record(&started, 7);
+
+            ASSERT(false == started);
+            ASSERT(true  == task.isValid());
+            ASSERT(false == task.isDone());
+
+            bdlmt::CoroutineTask<int> moved(
+                                         bslmf::MovableRefUtil::move(task));
+
+            ASSERT(false == task.isValid());
+            ASSERT(false == task.isDone());
+            ASSERT(true  == moved.isValid());
+            ASSERT(false == started);
+
+            ASSERT(7 == moved.syncWait());
+
+            ASSERT(true == started);
+            ASSERT(true == moved.isDone());
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_FAIL(task.syncWait());
+                ASSERT_FAIL(moved.syncWait());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nCompleting on another thread." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 10, &ta);
+            ASSERT(0 == pool.start());
+
+            bdlmt::CoroutineTask<bslmt::ThreadUtil::Id> task = hop(&pool);
+
+            bslmt::ThreadUtil::Id id = task.syncWait();
+            ASSERT(id != bslmt::ThreadUtil::selfId());
+            ASSERT(task.isDone());
+
+            pool.stop();
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Run a coroutine awaiting another coroutine, and verify the
+        //    result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            bdlmt::CoroutineTask<int> task = nested(3, &ta);
+
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT(3 == task.syncWait());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#else
+        if (verbose) cout << "Coroutines are not supported." << endl;
+#endif
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,586 @@
+// bdlmt_coroutineutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMT_COROUTINEUTIL
+#define INCLUDED_BDLMT_COROUTINEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide awaitables resuming coroutines on thread pools and timers.
+//
+//@CLASSES:
+//  bdlmt::CoroutineUtil: namespace for awaitable thread pool operations
+//
+//@SEE_ALSO: bdlmt_coroutinetask, bdlmt_fixedthreadpool, bdlmt_eventscheduler
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdlmt::CoroutineUtil`, whose functions return *awaitables*: objects that a
+// C++20 coroutine (typically, one returning a `bdlmt::CoroutineTask`) passes
+// to `co_await` to suspend until an event happens, and to be resumed on a
+// thread determined by the event:
+//
+// * `scheduleOn` resumes the coroutine on a thread of an executor (such as a
+//   `bdlmt::FixedThreadPool` or a `bdlmt::ThreadPool`).
+// * `sleepUntil` resumes the coroutine on the dispatcher thread of a
+//   `bdlmt::EventScheduler` at (or after) a time.
+// * `popFront` resumes the coroutine, on the awaiting thread or on a thread of
+//   an executor, when an item is popped from a `bdlcc::BoundedQueue`.
+//
+// This component is available only on platforms supporting C++20 coroutines,
+// as indicated by `BSLS_COMPILERFEATURES_SUPPORT_COROUTINE`.
+//
+///Executors
+///---------
+// An *executor* is an object of a type providing the method:
+// ```
+// int enqueueJob(const bsl::function<void()>& job);
+// ```
+// that arranges for `job` to be invoked on some thread, and returns 0 on
+// success and a non-zero value, without invoking `job`, otherwise.
+// `bdlmt::FixedThreadPool` and `bdlmt::ThreadPool` are executors.
+//
+///Cost of a Hop
+///-------------
+// Resuming a coroutine on another thread is called a *hop*.  The job that an
+// awaitable of this component enqueues for a hop holds only the handle of the
+// suspended coroutine (and, for `popFront`, the address of the awaitable), so
+// it is stored in the small-object buffer of `bsl::function`: a hop allocates
+// no memory, unlike a continuation written in callback style that binds its
+// state into a `bsl::function`.  The state of the coroutine lives in its
+// frame, which is allocated once, when the coroutine is called (see
+// {`bdlmt_coroutinetask`|Frame Allocation}).
+//
+///Awaiting a Queue
+///----------------
+// `popFront` first tries to pop an item without blocking, in which case the
+// coroutine is not suspended.  Otherwise, the coroutine is suspended, and a
+// job that blocks until an item is available is enqueued on the supplied
+// executor; the coroutine is then resumed on that thread.  Note that a thread
+// of the executor is therefore occupied for as long as the queue stays empty:
+// an executor used to await queues must have more threads than the number of
+// coroutines that can wait on empty queues at once, to make progress.
+//
+///Lifetime
+///--------
+// A suspended coroutine is resumed only by the job or event enqueued by the
+// awaitable on which it is suspended.  If that job or event never runs (for
+// example, because the `bdlmt::EventScheduler` is destroyed before the time
+// is reached, or its events are cancelled), the coroutine is never resumed,
+// and its frame is not destroyed until the `bdlmt::CoroutineTask` owning it
+// is destroyed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Request on a Thread Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we handle requests by coroutines, and that the expensive part
+// of handling a request should run on a thread pool, rather than on the thread
+// that received the request.
+//
+// First, we define a coroutine that hops to a thread pool, computes a result
+// there, and reports the thread on which it ran:
+// ```
+// bdlmt::CoroutineTask<int> handleRequest(
+//                                     bdlmt::FixedThreadPool     *pool,
+//                                     int                         request,
+//                                     bslmt::ThreadUtil::Handle  *thread)
+// {
+//     int rc = co_await bdlmt::CoroutineUtil::scheduleOn(pool);
+//     if (0 != rc) {
+//         co_return -1;
+//     }
+//
+//     *thread = bslmt::ThreadUtil::self();
+//     co_return request * 2;
+// }
+// ```
+// Then, we create and start a thread pool:
+// ```
+// bdlmt::FixedThreadPool pool(2, 10);
+// pool.start();
+// ```
+// Now, we create a task handling a request, and wait for it to complete:
+// ```
+// bslmt::ThreadUtil::Handle thread = bslmt::ThreadUtil::self();
+//
+// bdlmt::CoroutineTask<int> task = handleRequest(&pool, 21, &thread);
+// assert(42 == task.syncWait());
+// ```
+// Finally, we verify that the request was handled on a thread of the pool:
+// ```
+// assert(!bslmt::ThreadUtil::areEqual(thread, bslmt::ThreadUtil::self()));
+//
+// pool.stop();
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_boundedqueue.h>
+
+#include <bdlmt_eventscheduler.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_coroutine.h>
+#include <bsl_functional.h>
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                         // ==========================
+                         // class CoroutineUtil_Resume
+                         // ==========================
+
+/// This component-private class provides a function object that resumes a
+/// suspended coroutine.  It is small enough to be stored in the small-object
+/// buffer of a `bsl::function`.
+class CoroutineUtil_Resume {
+
+    // DATA
+    bsl::coroutine_handle<> d_handle;  // coroutine to resume
+
+  public:
+    // CREATORS
+
+    /// Create a function object resuming the specified `handle`.
+    explicit CoroutineUtil_Resume(bsl::coroutine_handle<> handle);
+
+    // ACCESSORS
+
+    /// Resume the coroutine of this object.
+    void operator()() const;
+};
+
+                    // ===================================
+                    // class CoroutineUtil_ScheduleAwaiter
+                    // ===================================
+
+/// This component-private class template provides the awaitable returned by
+/// `CoroutineUtil::scheduleOn`.
+template <class EXECUTOR>
+class CoroutineUtil_ScheduleAwaiter {
+
+    // DATA
+    EXECUTOR *d_executor_p;  // executor on which to resume (held, not owned)
+    int       d_status;      // status of the enqueue, if it failed
+
+  public:
+    // CREATORS
+
+    /// Create an awaitable resuming the awaiting coroutine on the specified
+    /// `executor`.
+    explicit CoroutineUtil_ScheduleAwaiter(EXECUTOR *executor);
+
+    // MANIPULATORS
+
+    /// Return `false`.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Enqueue a job resuming the specified `handle` on the executor of this
+    /// object.  Return `true` if the job was enqueued (so that the coroutine
+    /// stays suspended), and `false` otherwise.
+    bool await_suspend(bsl::coroutine_handle<> handle);
+
+    /// Return 0 if the coroutine was resumed by the executor, and the
+    /// non-zero status returned by the executor if the job could not be
+    /// enqueued.
+    int await_resume() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+                      // ================================
+                      // class CoroutineUtil_SleepAwaiter
+                      // ================================
+
+/// This component-private class provides the awaitable returned by
+/// `CoroutineUtil::sleepUntil`.
+class CoroutineUtil_SleepAwaiter {
+
+    // DATA
+    EventScheduler     *d_scheduler_p;  // scheduler (held, not owned)
+    bsls::TimeInterval  d_epochTime;    // time at which to resume
+
+  public:
+    // CREATORS
+
+    /// Create an awaitable resuming the awaiting coroutine on the dispatcher
+    /// thread of the specified `scheduler` at the specified `epochTime`.
+    CoroutineUtil_SleepAwaiter(EventScheduler            *scheduler,
+                               const bsls::TimeInterval&  epochTime);
+
+    // MANIPULATORS
+
+    /// Return `false`.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Schedule an event resuming the specified `handle` on the scheduler of
+    /// this object.
+    void await_suspend(bsl::coroutine_handle<> handle);
+
+    /// Do nothing.
+    void await_resume() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+                    // ===================================
+                    // class CoroutineUtil_PopFrontAwaiter
+                    // ===================================
+
+/// This component-private class template provides the awaitable returned by
+/// `CoroutineUtil::popFront`.
+template <class TYPE, class EXECUTOR>
+class CoroutineUtil_PopFrontAwaiter {
+
+    // PRIVATE TYPES
+
+    /// This `class` provides the job that blocks until an item is popped
+    /// and then resumes the awaiting coroutine.  It is small enough to be
+    /// stored in the small-object buffer of a `bsl::function`.
+    class PopJob {
+
+        // DATA
+        CoroutineUtil_PopFrontAwaiter *d_awaiter_p;  // awaitable (held, not
+                                                     // owned)
+
+        bsl::coroutine_handle<>        d_handle;     // coroutine to resume
+
+      public:
+        // CREATORS
+
+        /// Create a job popping an item for the specified `awaiter` and then
+        /// resuming the specified `handle`.
+        PopJob(CoroutineUtil_PopFrontAwaiter *awaiter,
+               bsl::coroutine_handle<>        handle);
+
+        // ACCESSORS
+
+        /// Pop an item, blocking until one is available, record the status,
+        /// and resume the coroutine of this job.
+        void operator()() const;
+    };
+
+    // DATA
+    TYPE                      *d_value_p;     // result (held, not owned)
+    bdlcc::BoundedQueue<TYPE> *d_queue_p;     // queue (held, not owned)
+    EXECUTOR                  *d_executor_p;  // executor on which to block
+                                              // (held, not owned)
+    int                        d_status;      // status of the pop
+
+  public:
+    // CREATORS
+
+    /// Create an awaitable popping an item of the specified `queue` into the
+    /// specified `value`, blocking on the specified `executor` if the queue
+    /// is empty.
+    CoroutineUtil_PopFrontAwaiter(TYPE                      *value,
+                                  bdlcc::BoundedQueue<TYPE> *queue,
+                                  EXECUTOR                  *executor);
+
+    // MANIPULATORS
+
+    /// Try to pop an item without blocking.  Return `true` if the awaiting
+    /// coroutine need not be suspended (because an item was popped or the
+    /// queue is disabled), and `false` otherwise.
+    bool await_ready();
+
+    /// Enqueue a job, on the executor of this object, popping an item and
+    /// resuming the specified `handle`.  Return `true` if the job was
+    /// enqueued (so that the coroutine stays suspended), and `false`
+    /// otherwise.
+    bool await_suspend(bsl::coroutine_handle<> handle);
+
+    /// Return the status of the pop: 0 if an item was popped, the status
+    /// returned by the queue if popping failed, or the non-zero status
+    /// returned by the executor if the job could not be enqueued.
+    int await_resume() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+                            // ====================
+                            // struct CoroutineUtil
+                            // ====================
+
+/// This `struct` provides a namespace for functions returning awaitables
+/// that resume coroutines on thread pools and timers.
+struct CoroutineUtil {
+
+    // CLASS METHODS
+
+    /// Return an awaitable that pops an item of the specified `queue` into
+    /// the specified `value`.  If an item is available, it is popped without
+    /// suspending the awaiting coroutine; otherwise, the coroutine is
+    /// suspended, and resumed on a thread of the specified `executor` once
+    /// an item is popped.  The `co_await` expression yields 0 if an item was
+    /// popped, `bdlcc::BoundedQueue<TYPE>::e_DISABLED` if popping from
+    /// `queue` is disabled, and the non-zero status returned by `executor` if
+    /// it fails to accept the job (in which case the coroutine is not
+    /// suspended).  Note that a thread of `executor` is occupied while the
+    /// queue is empty; see {Awaiting a Queue}.
+    template <class TYPE, class EXECUTOR>
+    static CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR> popFront(
+                                          TYPE                      *value,
+                                          bdlcc::BoundedQueue<TYPE> *queue,
+                                          EXECUTOR                  *executor);
+
+    /// Return an awaitable that suspends the awaiting coroutine and resumes
+    /// it on a thread of the specified `executor`.  The `co_await` expression
+    /// yields 0 on success, and the non-zero status returned by `executor` if
+    /// it fails to accept the job, in which case the coroutine is not
+    /// suspended, and continues on the awaiting thread.
+    template <class EXECUTOR>
+    static CoroutineUtil_ScheduleAwaiter<EXECUTOR> scheduleOn(
+                                                           EXECUTOR *executor);
+
+    /// Return an awaitable that suspends the awaiting coroutine and resumes
+    /// it on the dispatcher thread of the specified `scheduler` at or after
+    /// the specified `epochTime`, an absolute time represented as an interval
+    /// from the epoch of the clock of `scheduler`.  If `epochTime` is in the
+    /// past, the coroutine is resumed as soon as possible.  Note that the
+    /// coroutine should hop to another executor (using `scheduleOn`) before
+    /// doing lengthy work, so as not to delay other events of `scheduler`.
+    static CoroutineUtil_SleepAwaiter sleepUntil(
+                                        EventScheduler            *scheduler,
+                                        const bsls::TimeInterval&  epochTime);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class CoroutineUtil_Resume
+                         // --------------------------
+
+// CREATORS
+inline
+CoroutineUtil_Resume::CoroutineUtil_Resume(bsl::coroutine_handle<> handle)
+: d_handle(handle)
+{
+}
+
+// ACCESSORS
+inline
+void CoroutineUtil_Resume::operator()() const
+{
+    d_handle.resume();
+}
+
+                    // -----------------------------------
+                    // class CoroutineUtil_ScheduleAwaiter
+                    // -----------------------------------
+
+// CREATORS
+template <class EXECUTOR>
+inline
+CoroutineUtil_ScheduleAwaiter<EXECUTOR>::CoroutineUtil_ScheduleAwaiter(
+                                                            EXECUTOR *executor)
+: d_executor_p(executor)
+, d_status(0)
+{
+    BSLS_ASSERT(executor);
+}
+
+// MANIPULATORS
+template <class EXECUTOR>
+inline
+bool CoroutineUtil_ScheduleAwaiter<EXECUTOR>::await_ready() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+template <class EXECUTOR>
+inline
+bool CoroutineUtil_ScheduleAwaiter<EXECUTOR>::await_suspend(
+                                                bsl::coroutine_handle<> handle)
+{
+    // Once the job is enqueued, the coroutine can be resumed (and this
+    // object destroyed) on another thread, so `d_status` is written only if
+    // the job is not enqueued.
+
+    const int rc = d_executor_p->enqueueJob(CoroutineUtil_Resume(handle));
+    if (0 != rc) {
+        d_status = rc;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+template <class EXECUTOR>
+inline
+int CoroutineUtil_ScheduleAwaiter<EXECUTOR>::await_resume() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_status;
+}
+
+                      // --------------------------------
+                      // class CoroutineUtil_SleepAwaiter
+                      // --------------------------------
+
+// CREATORS
+inline
+CoroutineUtil_SleepAwaiter::CoroutineUtil_SleepAwaiter(
+                                         EventScheduler            *scheduler,
+                                         const bsls::TimeInterval&  epochTime)
+: d_scheduler_p(scheduler)
+, d_epochTime(epochTime)
+{
+    BSLS_ASSERT(scheduler);
+}
+
+// MANIPULATORS
+inline
+bool CoroutineUtil_SleepAwaiter::await_ready() const BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+inline
+void CoroutineUtil_SleepAwaiter::await_suspend(bsl::coroutine_handle<> handle)
+{
+    d_scheduler_p->scheduleEvent(d_epochTime, CoroutineUtil_Resume(handle));
+}
+
+inline
+void CoroutineUtil_SleepAwaiter::await_resume() const BSLS_KEYWORD_NOEXCEPT
+{
+}
+
+                    // -----------------------------------
+                    // class CoroutineUtil_PopFrontAwaiter
+                    // -----------------------------------
+
+                                   // ------
+                                   // PopJob
+                                   // ------
+
+// CREATORS
+template <class TYPE, class EXECUTOR>
+inline
+CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::PopJob::PopJob(
+                                 CoroutineUtil_PopFrontAwaiter *awaiter,
+                                 bsl::coroutine_handle<>        handle)
+: d_awaiter_p(awaiter)
+, d_handle(handle)
+{
+}
+
+// ACCESSORS
+template <class TYPE, class EXECUTOR>
+inline
+void CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::PopJob::operator()() const
+{
+    // The awaitable lives in the frame of the suspended coroutine, so it
+    // remains valid until the coroutine is resumed.
+
+    d_awaiter_p->d_status = d_awaiter_p->d_queue_p->popFront(
+                                                       d_awaiter_p->d_value_p);
+    d_handle.resume();
+}
+
+// CREATORS
+template <class TYPE, class EXECUTOR>
+inline
+CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::CoroutineUtil_PopFrontAwaiter(
+                                           TYPE                      *value,
+                                           bdlcc::BoundedQueue<TYPE> *queue,
+                                           EXECUTOR                  *executor)
+: d_value_p(value)
+, d_queue_p(queue)
+, d_executor_p(executor)
+, d_status(0)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(queue);
+    BSLS_ASSERT(executor);
+}
+
+// MANIPULATORS
+template <class TYPE, class EXECUTOR>
+inline
+bool CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::await_ready()
+{
+    d_status = d_queue_p->tryPopFront(d_value_p);
+    return bdlcc::BoundedQueue<TYPE>::e_EMPTY != d_status;
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+bool CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::await_suspend(
+                                                bsl::coroutine_handle<> handle)
+{
+    const int rc = d_executor_p->enqueueJob(PopJob(this, handle));
+    if (0 != rc) {
+        d_status = rc;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+int CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>::await_resume() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_status;
+}
+
+                            // --------------------
+                            // struct CoroutineUtil
+                            // --------------------
+
+// CLASS METHODS
+template <class TYPE, class EXECUTOR>
+inline
+CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR> CoroutineUtil::popFront(
+                                           TYPE                      *value,
+                                           bdlcc::BoundedQueue<TYPE> *queue,
+                                           EXECUTOR                  *executor)
+{
+    return CoroutineUtil_PopFrontAwaiter<TYPE, EXECUTOR>(value,
+                                                         queue,
+                                                         executor);
+}
+
+template <class EXECUTOR>
+inline
+CoroutineUtil_ScheduleAwaiter<EXECUTOR> CoroutineUtil::scheduleOn(
+                                                            EXECUTOR *executor)
+{
+    return CoroutineUtil_ScheduleAwaiter<EXECUTOR>(executor);
+}
+
+inline
+CoroutineUtil_SleepAwaiter CoroutineUtil::sleepUntil(
+                                         EventScheduler            *scheduler,
+                                         const bsls::TimeInterval&  epochTime)
+{
+    return CoroutineUtil_SleepAwaiter(scheduler, epochTime);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
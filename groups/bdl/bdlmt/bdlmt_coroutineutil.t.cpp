@@ -0,0 +1,761 @@
+// bdlmt_coroutineutil.t.cpp                                          -*-C++-*-
+#include <bdlmt_coroutineutil.h>
+
+#include <bdlmt_coroutinetask.h>
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlmt::CoroutineUtil` provides functions returning awaitables.  For each
+// awaitable we verify the thread on which the awaiting coroutine is resumed,
+// the value yielded by `co_await`, the behavior when the executor rejects the
+// job, and, for `scheduleOn`, that a hop does not allocate memory.  A
+// negative test case compares the cost of a hop with a continuation written
+// in callback style.
+//
+// The component is available only if `BSLS_COMPILERFEATURES_SUPPORT_COROUTINE`
+// is set; otherwise every test case is empty.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] popFront(TYPE *, bdlcc::BoundedQueue<TYPE> *, EXECUTOR *);
+// [ 2] scheduleOn(EXECUTOR *executor);
+// [ 3] sleepUntil(EventScheduler *, const bsls::TimeInterval&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: COST OF A HOP
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+typedef bdlmt::CoroutineUtil Util;
+#endif
+
+typedef bslmt::ThreadUtil::Id ThreadId;
+
+// ============================================================================
+//                   GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+namespace {
+
+/// Hop to a thread of the specified `executor`, load into the specified
+/// `*thread` the identifier of the thread on which the coroutine continues,
+/// and return the status of the hop.
+template <class EXECUTOR>
+bdlmt::CoroutineTask<int> hopTo(EXECUTOR *executor, ThreadId *thread)
+{
+    const int rc = co_await Util::scheduleOn(executor);
+    *thread = bslmt::ThreadUtil::selfId();
+    co_return rc;
+}
+
+/// Hop to a thread of the specified `executor` the specified `numHops`
+/// times, and return the number of hops that succeeded.
+template <class EXECUTOR>
+bdlmt::CoroutineTask<int> hopMany(EXECUTOR *executor, int numHops)
+{
+    int numSucceeded = 0;
+    for (int i = 0; i < numHops; ++i) {
+        if (0 == co_await Util::scheduleOn(executor)) {
+            ++numSucceeded;
+        }
+    }
+    co_return numSucceeded;
+}
+
+/// Sleep on the specified `scheduler` until the specified `epochTime`, and
+/// load into the specified `*thread` the identifier of the thread on which
+/// the coroutine continues, and into the specified `*wakeTime` the time of
+/// `scheduler` at which it continues.
+bdlmt::CoroutineTask<void> sleepUntil(bdlmt::EventScheduler     *scheduler,
+                                      const bsls::TimeInterval&  epochTime,
+                                      ThreadId                  *thread,
+                                      bsls::TimeInterval        *wakeTime)
+{
+    co_await Util::sleepUntil(scheduler, epochTime);
+    *thread   = bslmt::ThreadUtil::selfId();
+    *wakeTime = scheduler->now();
+}
+
+/// Pop an item of the specified `queue` into the specified `*value`,
+/// blocking on the specified `executor` if needed, load into the specified
+/// `*thread` the identifier of the thread on which the coroutine continues,
+/// and return the status of the pop.
+bdlmt::CoroutineTask<int> pop(int                       *value,
+                              bdlcc::BoundedQueue<int>  *queue,
+                              bdlmt::FixedThreadPool    *executor,
+                              ThreadId                  *thread)
+{
+    const int rc = co_await Util::popFront(value, queue, executor);
+    *thread = bslmt::ThreadUtil::selfId();
+    co_return rc;
+}
+
+/// This `struct` holds the state of a chain of hops written in callback
+/// style.
+struct CallbackChain {
+    bdlmt::FixedThreadPool *d_pool_p;
+    bslmt::Latch           *d_done_p;
+};
+
+/// Count down the specified `remaining` hops of the specified `chain`,
+/// enqueuing the next hop as a callback bound to its state, and arrive on the
+/// latch of `chain` after the last hop.
+void callbackHop(CallbackChain *chain, int remaining)
+{
+    if (0 == remaining) {
+        chain->d_done_p->arrive();
+        return;                                                       // RETURN
+    }
+    chain->d_pool_p->enqueueJob(bdlf::BindUtil::bind(&callbackHop,
+                                                     chain,
+                                                     remaining - 1));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Request on a Thread Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we handle requests by coroutines, and that the expensive part
+// of handling a request should run on a thread pool, rather than on the thread
+// that received the request.
+//
+// First, we define a coroutine that hops to a thread pool, computes a result
+// there, and reports the thread on which it ran:
+// ```
+    bdlmt::CoroutineTask<int> handleRequest(
+                                        bdlmt::FixedThreadPool     *pool,
+                                        int                         request,
+                                        bslmt::ThreadUtil::Handle  *thread)
+    {
+        int rc = co_await bdlmt::CoroutineUtil::scheduleOn(pool);
+        if (0 != rc) {
+            co_return -1;
+        }
+
+        *thread = bslmt::ThreadUtil::self();
+        co_return request * 2;
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create and start a thread pool:
+// ```
+    bdlmt::FixedThreadPool pool(2, 10);
+    pool.start();
+// ```
+// Now, we create a task handling a request, and wait for it to complete:
+// ```
+    bslmt::ThreadUtil::Handle thread = bslmt::ThreadUtil::self();
+
+    bdlmt::CoroutineTask<int> task = handleRequest(&pool, 21, &thread);
+    ASSERT(42 == task.syncWait());
+// ```
+// Finally, we verify that the request was handled on a thread of the pool:
+// ```
+    ASSERT(!bslmt::ThreadUtil::areEqual(thread, bslmt::ThreadUtil::self()));
+
+    pool.stop();
+// ```
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `popFront`
+        //
+        // Concerns:
+        // 1. If the queue has an item, it is popped without suspending the
+        //    awaiting coroutine, and `co_await` yields 0.
+        //
+        // 2. If the queue is empty, the coroutine is resumed on a thread of
+        //    the executor once an item is pushed, and `co_await` yields 0.
+        //
+        // 3. If popping is disabled, `co_await` yields `e_DISABLED` without
+        //    suspending the coroutine, including while the coroutine waits.
+        //
+        // 4. If the queue is empty and the executor rejects the job,
+        //    `co_await` yields a non-zero value without suspending the
+        //    coroutine.
+        //
+        // Plan:
+        // 1. Pop from a queue having an item, and verify the value and the
+        //    thread.  (C-1)
+        //
+        // 2. Pop from an empty queue, push an item from another thread after
+        //    a delay, and verify the value and the thread.  (C-2)
+        //
+        // 3. Pop from a disabled queue, and disable a queue while a coroutine
+        //    waits on it.  (C-3)
+        //
+        // 4. Pop from an empty queue using a stopped executor.  (C-4)
+        //
+        // Testing:
+        //   popFront(TYPE *, bdlcc::BoundedQueue<TYPE> *, EXECUTOR *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `popFront`" << endl
+                          << "==================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        typedef bdlcc::BoundedQueue<int> Queue;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bdlmt::FixedThreadPool pool(1, 10, &ta);
+        ASSERT(0 == pool.start());
+
+        bdlmt::FixedThreadPool producer(1, 10, &ta);
+        ASSERT(0 == producer.start());
+
+        const ThreadId mainThread = bslmt::ThreadUtil::selfId();
+
+        if (verbose) cout << "\nPopping an available item." << endl;
+        {
+            Queue queue(4, &ta);
+            ASSERT(0 == queue.pushBack(7));
+
+            int      value  = 0;
+            ThreadId thread = ThreadId();
+
+            bdlmt::CoroutineTask<int> task = pop(&value, &queue, &pool,
+                                                 &thread);
+            ASSERT(0 == task.syncWait());
+            ASSERT(7 == value);
+            ASSERT(mainThread == thread);
+        }
+
+        if (verbose) cout << "\nWaiting for an item." << endl;
+        {
+            Queue queue(4, &ta);
+
+            producer.enqueueJob([&queue]() {
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                queue.pushBack(9);
+            });
+
+            int      value  = 0;
+            ThreadId thread = ThreadId();
+
+            bdlmt::CoroutineTask<int> task = pop(&value, &queue, &pool,
+                                                 &thread);
+            ASSERT(0 == task.syncWait());
+            ASSERT(9 == value);
+            ASSERT(mainThread != thread);
+
+            producer.drain();
+        }
+
+        if (verbose) cout << "\nPopping from a disabled queue." << endl;
+        {
+            Queue queue(4, &ta);
+            queue.disablePopFront();
+
+            int      value  = 0;
+            ThreadId thread = ThreadId();
+
+            bdlmt::CoroutineTask<int> task = pop(&value, &queue, &pool,
+                                                 &thread);
+            ASSERT(Queue::e_DISABLED == task.syncWait());
+            ASSERT(mainThread == thread);
+        }
+        {
+            Queue queue(4, &ta);
+
+            producer.enqueueJob([&queue]() {
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                queue.disablePopFront();
+            });
+
+            int      value  = 0;
+            ThreadId thread = ThreadId();
+
+            bdlmt::CoroutineTask<int> task = pop(&value, &queue, &pool,
+                                                 &thread);
+            ASSERT(Queue::e_DISABLED == task.syncWait());
+            ASSERT(mainThread != thread);
+
+            producer.drain();
+        }
+
+        producer.stop();
+        pool.stop();
+
+        if (verbose) cout << "\nRejected job." << endl;
+        {
+            Queue queue(4, &ta);
+
+            int      value  = 0;
+            ThreadId thread = ThreadId();
+
+            bdlmt::CoroutineTask<int> task = pop(&value, &queue, &pool,
+                                                 &thread);
+            ASSERT(0 != task.syncWait());
+            ASSERT(mainThread == thread);
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `sleepUntil`
+        //
+        // Concerns:
+        // 1. The awaiting coroutine is resumed on the dispatcher thread of the
+        //    scheduler, no earlier than the specified time.
+        //
+        // 2. A time in the past resumes the coroutine as soon as possible.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Sleep until 50 milliseconds from now, and verify the time and
+        //    thread at which the coroutine continues.  (C-1)
+        //
+        // 2. Sleep until the epoch.  (C-2)
+        //
+        // 3. Verify that a null scheduler is detected.  (C-3)
+        //
+        // Testing:
+        //   sleepUntil(EventScheduler *, const bsls::TimeInterval&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `sleepUntil`" << endl
+                          << "====================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bdlmt::EventScheduler scheduler(&ta);
+        ASSERT(0 == scheduler.start());
+
+        const ThreadId mainThread = bslmt::ThreadUtil::selfId();
+
+        if (verbose) cout << "\nSleeping until a future time." << endl;
+        {
+            const bsls::TimeInterval epochTime =
+                              scheduler.now() + bsls::TimeInterval(0.05);
+
+            ThreadId           thread   = mainThread;
+            bsls::TimeInterval wakeTime;
+
+            bdlmt::CoroutineTask<void> task = sleepUntil(&scheduler,
+                                                         epochTime,
+                                                         &thread,
+                                                         &wakeTime);
+            task.syncWait();
+
+            ASSERTV(epochTime, wakeTime, epochTime <= wakeTime);
+            ASSERT(mainThread != thread);
+        }
+
+        if (verbose) cout << "\nSleeping until a past time." << endl;
+        {
+            ThreadId           thread   = mainThread;
+            bsls::TimeInterval wakeTime;
+
+            bdlmt::CoroutineTask<void> task = sleepUntil(&scheduler,
+                                                         bsls::TimeInterval(),
+                                                         &thread,
+                                                         &wakeTime);
+            task.syncWait();
+
+            ASSERT(mainThread != thread);
+        }
+
+        scheduler.stop();
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::sleepUntil(&scheduler, bsls::TimeInterval()));
+            ASSERT_FAIL(Util::sleepUntil(0, bsls::TimeInterval()));
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `scheduleOn`
+        //
+        // Concerns:
+        // 1. The awaiting coroutine is resumed on a thread of the executor,
+        //    and `co_await` yields 0.
+        //
+        // 2. Both `bdlmt::FixedThreadPool` and `bdlmt::ThreadPool` can be
+        //    used as executors.
+        //
+        // 3. If the executor rejects the job, `co_await` yields a non-zero
+        //    value, and the coroutine continues on the awaiting thread.
+        //
+        // 4. A hop does not allocate memory from the default allocator.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Hop to each kind of thread pool, and verify the status and the
+        //    thread.  (C-1..2)
+        //
+        // 2. Hop to a stopped thread pool.  (C-3)
+        //
+        // 3. Perform many hops between two thread pools using the test
+        //    allocator as the default allocator, and verify that the number
+        //    of default allocations does not depend on the number of hops.
+        //    (C-4)
+        //
+        // 4. Verify that a null executor is detected.  (C-5)
+        //
+        // Testing:
+        //   scheduleOn(EXECUTOR *executor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `scheduleOn`" << endl
+                          << "====================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const ThreadId mainThread = bslmt::ThreadUtil::selfId();
+
+        if (verbose) cout << "\nHopping to a `FixedThreadPool`." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 10, &ta);
+            ASSERT(0 == pool.start());
+
+            ThreadId thread = mainThread;
+
+            bdlmt::CoroutineTask<int> task = hopTo(&pool, &thread);
+            ASSERT(0 == task.syncWait());
+            ASSERT(mainThread != thread);
+
+            pool.stop();
+
+            if (verbose) cout << "\nHopping to a stopped pool." << endl;
+
+            bdlmt::CoroutineTask<int> rejected = hopTo(&pool, &thread);
+            ASSERT(0 != rejected.syncWait());
+            ASSERT(mainThread == thread);
+        }
+
+        if (verbose) cout << "\nHopping to a `ThreadPool`." << endl;
+        {
+            bslmt::ThreadAttributes attributes;
+            bdlmt::ThreadPool       pool(attributes, 1, 1, 1000, &ta);
+            ASSERT(0 == pool.start());
+
+            ThreadId thread = mainThread;
+
+            bdlmt::CoroutineTask<int> task = hopTo(&pool, &thread);
+            ASSERT(0 == task.syncWait());
+            ASSERT(mainThread != thread);
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\nCounting allocations per hop." << endl;
+        {
+            bdlmt::FixedThreadPool pool(2, 10, &ta);
+            ASSERT(0 == pool.start());
+
+            bsls::Types::Int64 numAllocations[2];
+
+            const int NUM_HOPS[2] = { 1, 1000 };
+            for (int i = 0; i < 2; ++i) {
+                const bsls::Types::Int64 before =
+                                             defaultAllocator.numAllocations();
+                {
+                    bdlmt::CoroutineTask<int> task = hopMany(&pool,
+                                                             NUM_HOPS[i]);
+                    ASSERT(NUM_HOPS[i] == task.syncWait());
+                }
+                numAllocations[i] = defaultAllocator.numAllocations() - before;
+            }
+
+            ASSERTV(numAllocations[0], numAllocations[1],
+                    numAllocations[0] == numAllocations[1]);
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlmt::FixedThreadPool pool(1, 10, &ta);
+
+            ASSERT_PASS(Util::scheduleOn(&pool));
+            ASSERT_FAIL(Util::scheduleOn<bdlmt::FixedThreadPool>(0));
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Hop to a thread pool a few times.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bdlmt::FixedThreadPool pool(2, 10, &ta);
+        ASSERT(0 == pool.start());
+
+        bdlmt::CoroutineTask<int> task = hopMany(&pool, 10);
+        ASSERT(10 == task.syncWait());
+
+        pool.stop();
+#else
+        if (verbose) cout << "Coroutines are not supported." << endl;
+#endif
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF A HOP
+        //
+        // Concerns:
+        // 1. Resuming a coroutine on a thread pool costs no more than
+        //    enqueuing a continuation written in callback style.
+        //
+        // Plan:
+        // 1. Time a chain of hops on a single-threaded pool, written with
+        //    `co_await scheduleOn` and in callback style (each job enqueuing
+        //    the next, bound to its state with `bdlf::BindUtil`), and report
+        //    the time and the default allocations per hop.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COST OF A HOP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: COST OF A HOP" << endl
+                          << "==========================" << endl;
+
+#if BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        const int NUM_HOPS = 1000 * 1000;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bdlmt::FixedThreadPool pool(1, 100, &ta);
+        ASSERT(0 == pool.start());
+
+        bsls::Stopwatch timer;
+
+        {
+            bslmt::Latch  done(1);
+            CallbackChain chain = { &pool, &done };
+
+            const bsls::Types::Int64 before =
+                                             defaultAllocator.numAllocations();
+
+            timer.start();
+            callbackHop(&chain, NUM_HOPS);
+            done.wait();
+            timer.stop();
+
+            const double allocations = static_cast<double>(
+                      defaultAllocator.numAllocations() - before) / NUM_HOPS;
+
+            cout << "callback:  "
+                 << timer.elapsedTime() * 1e9 / NUM_HOPS << " ns/hop, "
+                 << allocations << " allocations/hop" << endl;
+        }
+
+        timer.reset();
+
+        {
+            const bsls::Types::Int64 before =
+                                             defaultAllocator.numAllocations();
+
+            timer.start();
+            bdlmt::CoroutineTask<int> task = hopMany(&pool, NUM_HOPS);
+            ASSERT(NUM_HOPS == task.syncWait());
+            timer.stop();
+
+            const double allocations = static_cast<double>(
+                      defaultAllocator.numAllocations() - before) / NUM_HOPS;
+
+            cout << "coroutine: "
+                 << timer.elapsedTime() * 1e9 / NUM_HOPS << " ns/hop, "
+                 << allocations << " allocations/hop" << endl;
+        }
+
+        pool.stop();
+#endif
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
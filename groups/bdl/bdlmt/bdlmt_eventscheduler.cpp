@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bdlf_bind.h>
 
 #include <bdlm_instancecount.h>
@@ -12,6 +14,9 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
 #include <bdlt_timeunitratio.h>
 
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
 #include <bsls_assert.h>
 #include <bsls_review.h>
 #include <bsls_systemtime.h>
@@ -157,6 +162,497 @@ bsls::TimeInterval EventSchedulerTestTimeSource_Data::currentTime() const
     return d_currentTime;
 }
 
+                    // ------------------------------------
+                    // class EventScheduler_TimingWheelNode
+                    // ------------------------------------
+
+// CREATORS
+EventScheduler_TimingWheelNode::EventScheduler_TimingWheelNode(
+                                        bsls::Types::Int64  time,
+                                        const EventData&    data,
+                                        bslma::Allocator   *basicAllocator)
+: d_next_p(0)
+, d_prev_p(0)
+, d_time(time)
+, d_list(-1)
+, d_refCount(1)
+, d_data(data, basicAllocator)
+{
+}
+
+                      // --------------------------------
+                      // class EventScheduler_TimingWheel
+                      // --------------------------------
+
+// PRIVATE MANIPULATORS
+void EventScheduler_TimingWheel::advance(bsls::Types::Int64 tick)
+{
+    while (d_nextTick <= tick) {
+        int level = 0;
+        while (level < k_NUM_LEVELS && 0 == d_occupied[level]) {
+            ++level;
+        }
+
+        if (k_NUM_LEVELS == level) {
+            if (0 == d_lists[k_OVERFLOW_LIST]) {
+                setNextTick(tick + 1);
+                return;                                               // RETURN
+            }
+
+            // Only overflow events remain: jump to the start of the span of
+            // the top level that contains the earliest of them (or to
+            // 'tick + 1', if that is sooner).
+
+            bsls::Types::Int64 minTick =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+            Node *node = d_lists[k_OVERFLOW_LIST];
+            do {
+                minTick = bsl::min(minTick, tickOf(node->d_time));
+                node    = node->d_next_p;
+            } while (node != d_lists[k_OVERFLOW_LIST]);
+
+            const int          shift = k_BITS_PER_LEVEL * k_NUM_LEVELS;
+            bsls::Types::Int64 start = (minTick >> shift) << shift;
+
+            setNextTick(bsl::min(tick + 1, bsl::max(start, d_nextTick + 1)));
+            continue;
+        }
+
+        const bsls::Types::Uint64 bits  = d_occupied[level];
+        const int                 slot  =
+                                     bdlb::BitUtil::numTrailingUnsetBits(bits);
+        const int                 shift = k_BITS_PER_LEVEL * level;
+
+        // The first tick of the span of 'slot'; the invariants maintained by
+        // 'place' and 'setNextTick' guarantee it is not before 'd_nextTick'
+        // for level 0, and after 'd_nextTick' for the other levels.
+
+        const bsls::Types::Int64 start =
+                  ((d_nextTick >> (shift + k_BITS_PER_LEVEL))
+                                                 << (shift + k_BITS_PER_LEVEL))
+                | (static_cast<bsls::Types::Int64>(slot) << shift);
+
+        if (start > tick) {
+            setNextTick(tick + 1);
+            return;                                                   // RETURN
+        }
+
+        if (0 == level) {
+            // Expire the tick: move the nodes of the slot to the due list.
+
+            const int index = slot;
+            while (d_lists[index]) {
+                Node *node = d_lists[index];
+                unlink(node);
+                link(node, k_DUE_LIST);
+            }
+            setNextTick(start + 1);
+        }
+        else {
+            // 'setNextTick' redistributes the slot whose span begins.
+
+            setNextTick(start);
+        }
+    }
+}
+
+void EventScheduler_TimingWheel::deleteNode(Node *node)
+{
+    node->~Node();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_pool.deallocate(node);
+}
+
+void EventScheduler_TimingWheel::link(Node *node, int index)
+{
+    BSLS_ASSERT(0 > node->d_list);
+
+    Node *head = d_lists[index];
+    if (head) {
+        node->d_next_p           = head;
+        node->d_prev_p           = head->d_prev_p;
+        head->d_prev_p->d_next_p = node;
+        head->d_prev_p           = node;
+    }
+    else {
+        node->d_next_p = node;
+        node->d_prev_p = node;
+        d_lists[index] = node;
+    }
+    node->d_list = index;
+
+    if (index < k_DUE_LIST) {
+        d_occupied[index / k_SLOTS_PER_LEVEL] |=
+                  static_cast<bsls::Types::Uint64>(1)
+                                               << (index % k_SLOTS_PER_LEVEL);
+    }
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::place(Node *node)
+{
+    const bsls::Types::Int64 tick = tickOf(node->d_time);
+
+    if (tick < d_nextTick) {
+        link(node, k_DUE_LIST);
+        return tick;                                                  // RETURN
+    }
+
+    // The level is the one containing the most-significant digit in which
+    // 'tick' differs from 'd_nextTick'.
+
+    const bsls::Types::Uint64 diff = static_cast<bsls::Types::Uint64>(tick)
+                                ^ static_cast<bsls::Types::Uint64>(d_nextTick);
+    const int level = 0 == diff
+                      ? 0
+                      : (63 - bdlb::BitUtil::numLeadingUnsetBits(diff))
+                                                            / k_BITS_PER_LEVEL;
+
+    if (level >= k_NUM_LEVELS) {
+        link(node, k_OVERFLOW_LIST);
+    }
+    else {
+        const int slot = static_cast<int>(
+                              (tick >> (k_BITS_PER_LEVEL * level))
+                                                    & (k_SLOTS_PER_LEVEL - 1));
+        link(node, level * k_SLOTS_PER_LEVEL + slot);
+    }
+    return tick;
+}
+
+void EventScheduler_TimingWheel::replaceList(int index)
+{
+    Node *list = d_lists[index];
+    if (0 == list) {
+        return;                                                       // RETURN
+    }
+
+    // Detach the whole list first, since 'place' may link nodes back into
+    // the same list (e.g., the overflow list).
+
+    d_lists[index] = 0;
+    if (index < k_DUE_LIST) {
+        d_occupied[index / k_SLOTS_PER_LEVEL] &=
+               ~(static_cast<bsls::Types::Uint64>(1)
+                                              << (index % k_SLOTS_PER_LEVEL));
+    }
+
+    list->d_prev_p->d_next_p = 0;
+    while (list) {
+        Node *node     = list;
+        list           = list->d_next_p;
+        node->d_list   = -1;
+        place(node);
+    }
+}
+
+void EventScheduler_TimingWheel::setNextTick(bsls::Types::Int64 tick)
+{
+    BSLS_ASSERT(d_nextTick <= tick);
+
+    const int                topShift = k_BITS_PER_LEVEL * k_NUM_LEVELS;
+    const bsls::Types::Int64 previous = d_nextTick;
+
+    d_nextTick = tick;
+
+    if ((previous >> topShift) != (tick >> topShift)) {
+        replaceList(k_OVERFLOW_LIST);
+    }
+
+    // Redistribute, from the top level down, any slot whose span now
+    // contains 'd_nextTick'; its nodes belong to the lower levels.  Note
+    // that 'place' never links a node into such a slot.
+
+    for (int level = k_NUM_LEVELS - 1; 0 < level; --level) {
+        const int slot = static_cast<int>(
+                        (tick >> (k_BITS_PER_LEVEL * level))
+                                                    & (k_SLOTS_PER_LEVEL - 1));
+        replaceList(level * k_SLOTS_PER_LEVEL + slot);
+    }
+}
+
+void EventScheduler_TimingWheel::unlink(Node *node)
+{
+    BSLS_ASSERT(0 <= node->d_list);
+
+    const int index = node->d_list;
+
+    if (node->d_next_p == node) {
+        d_lists[index] = 0;
+        if (index < k_DUE_LIST) {
+            d_occupied[index / k_SLOTS_PER_LEVEL] &=
+               ~(static_cast<bsls::Types::Uint64>(1)
+                                              << (index % k_SLOTS_PER_LEVEL));
+        }
+    }
+    else {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (d_lists[index] == node) {
+            d_lists[index] = node->d_next_p;
+        }
+    }
+    node->d_next_p = 0;
+    node->d_prev_p = 0;
+    node->d_list   = -1;
+}
+
+// PRIVATE ACCESSORS
+bsls::Types::Int64 EventScheduler_TimingWheel::nextWakeTime() const
+{
+    BSLS_ASSERT(0 == d_lists[k_DUE_LIST]);
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (d_occupied[level]) {
+            const int slot  =
+                      bdlb::BitUtil::numTrailingUnsetBits(d_occupied[level]);
+            const int shift = k_BITS_PER_LEVEL * level;
+
+            return timeOf(((d_nextTick >> (shift + k_BITS_PER_LEVEL))
+                                                 << (shift + k_BITS_PER_LEVEL))
+                        | (static_cast<bsls::Types::Int64>(slot) << shift));
+                                                                      // RETURN
+        }
+    }
+
+    bsls::Types::Int64 minTime =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+    if (const Node *node = d_lists[k_OVERFLOW_LIST]) {
+        do {
+            minTime = bsl::min(minTime, timeOf(tickOf(node->d_time)));
+            node    = node->d_next_p;
+        } while (node != d_lists[k_OVERFLOW_LIST]);
+    }
+    return minTime;
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::tickOf(
+                                                bsls::Types::Int64 time) const
+{
+    // Round up, so that an event never expires before its scheduled time.
+    // Note that '%' truncates toward zero, so this is correct for negative
+    // times as well.
+
+    return time / d_tickLength + (0 < time % d_tickLength ? 1 : 0);
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::timeOf(
+                                                bsls::Types::Int64 tick) const
+{
+    const bsls::Types::Int64 k_MAX =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+
+    return tick > k_MAX / d_tickLength ? k_MAX : tick * d_tickLength;
+}
+
+// CREATORS
+EventScheduler_TimingWheel::EventScheduler_TimingWheel(
+                                        bsls::Types::Int64  tickLength,
+                                        bslma::Allocator   *basicAllocator)
+: d_tickLength(tickLength)
+, d_nextTick(0)
+, d_wakeTime(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_length(0)
+, d_pool(sizeof(Node), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < tickLength);
+
+    bsl::fill(d_lists, d_lists + k_NUM_LISTS, static_cast<Node *>(0));
+    bsl::fill(d_occupied,
+              d_occupied + k_NUM_LEVELS,
+              static_cast<bsls::Types::Uint64>(0));
+}
+
+EventScheduler_TimingWheel::~EventScheduler_TimingWheel()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+void EventScheduler_TimingWheel::add(Node               **result,
+                                     bsls::Types::Int64   time,
+                                     const EventData&     data,
+                                     bool                *isNewTop)
+{
+    BSLS_ASSERT(isNewTop);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Node *node = static_cast<Node *>(d_pool.allocate());
+
+    bslma::DeallocatorProctor<bdlma::Pool> proctor(node, &d_pool);
+    new (node) Node(time, data, d_allocator_p);
+    proctor.release();
+
+    if (result) {
+        node->d_refCount.addRelaxed(1);
+        *result = node;
+    }
+
+    const bsls::Types::Int64 wakeTime = timeOf(place(node));
+    ++d_length;
+
+    *isNewTop = wakeTime < d_wakeTime;
+    if (*isNewTop) {
+        d_wakeTime = wakeTime;
+    }
+}
+
+EventScheduler_TimingWheelNode *
+EventScheduler_TimingWheel::addReference(Node *node)
+{
+    node->d_refCount.addRelaxed(1);
+    return node;
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::frontRaw(
+                                                   Node               **front,
+                                                   bsls::Types::Int64   now)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Round down, so that only ticks that have fully begun are expired.
+
+    bsls::Types::Int64 tick = now / d_tickLength;
+    if (now % d_tickLength < 0) {
+        --tick;
+    }
+    advance(tick);
+
+    if (Node *node = d_lists[k_DUE_LIST]) {
+        node->d_refCount.addRelaxed(1);
+        *front     = node;
+        d_wakeTime = node->d_time;
+        return node->d_time;                                          // RETURN
+    }
+
+    *front     = 0;
+    d_wakeTime = nextWakeTime();
+    return d_wakeTime;
+}
+
+void EventScheduler_TimingWheel::releaseReference(Node *node)
+{
+    if (0 == node->d_refCount.addAcqRel(-1)) {
+        deleteNode(node);
+    }
+}
+
+int EventScheduler_TimingWheel::remove(const Node *node)
+{
+    if (0 == node) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *item = const_cast<Node *>(node);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (0 > item->d_list) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        unlink(item);
+        --d_length;
+    }
+
+    releaseReference(item);
+    return e_SUCCESS;
+}
+
+void EventScheduler_TimingWheel::removeAll()
+{
+    Node *removed = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (int i = 0; i < k_NUM_LISTS; ++i) {
+            while (Node *node = d_lists[i]) {
+                unlink(node);
+                node->d_next_p = removed;
+                removed        = node;
+            }
+        }
+        d_length = 0;
+    }
+
+    // Release the references held by the wheel outside the lock, since
+    // destroying an event destroys the user-supplied callback.
+
+    while (removed) {
+        Node *node = removed;
+        removed    = removed->d_next_p;
+        node->d_next_p = 0;
+        releaseReference(node);
+    }
+}
+
+int EventScheduler_TimingWheel::update(const Node         *node,
+                                       bsls::Types::Int64  time,
+                                       bool               *isNewTop)
+{
+    BSLS_ASSERT(isNewTop);
+
+    if (0 == node) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *item = const_cast<Node *>(node);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 > item->d_list) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+    unlink(item);
+    item->d_time = time;
+
+    const bsls::Types::Int64 wakeTime = timeOf(place(item));
+
+    *isNewTop = wakeTime < d_wakeTime;
+    if (*isNewTop) {
+        d_wakeTime = wakeTime;
+    }
+    return e_SUCCESS;
+}
+
+// ACCESSORS
+int EventScheduler_TimingWheel::length() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    return d_length;
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::minTime() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // The due list, the levels (in increasing order, and the slots of each
+    // level in increasing order), and the overflow list hold successively
+    // later events, so only the first non-empty list must be searched.
+
+    const Node *list = d_lists[k_DUE_LIST];
+    for (int level = 0; 0 == list && level < k_NUM_LEVELS; ++level) {
+        if (d_occupied[level]) {
+            list = d_lists[level * k_SLOTS_PER_LEVEL
+                    + bdlb::BitUtil::numTrailingUnsetBits(d_occupied[level])];
+        }
+    }
+    if (0 == list) {
+        list = d_lists[k_OVERFLOW_LIST];
+    }
+
+    bsls::Types::Int64 minTime =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+    if (const Node *node = list) {
+        do {
+            minTime = bsl::min(minTime, node->d_time);
+            node    = node->d_next_p;
+        } while (node != list);
+    }
+    return minTime;
+}
+
                            // --------------------
                            // class EventScheduler
                            // --------------------
@@ -214,6 +710,33 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::AtomicInt64 *now)
     return t;
 }
 
+void EventScheduler::addEventRaw(Event              **event,
+                                 bsls::Types::Int64   startTime,
+                                 const EventData&     eventData)
+{
+    bool newTop;
+
+    if (d_timingWheel_p) {
+        typedef EventScheduler_TimingWheelNode Node;
+
+        d_timingWheel_p->add(reinterpret_cast<Node **>(event),
+                             startTime,
+                             eventData,
+                             &newTop);
+    }
+    else {
+        d_eventQueue.addRawR(reinterpret_cast<EventQueue::Pair **>(event),
+                             startTime,
+                             eventData,
+                             &newTop);
+    }
+
+    if (newTop) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_queueCondition.signal();
+    }
+}
+
 void EventScheduler::dispatchEvents()
 {
     // set the dispatcher thread id
@@ -221,6 +744,11 @@ void EventScheduler::dispatchEvents()
 
     d_cachedNow = d_currentTimeFunctor().totalMicroseconds();
 
+    if (d_timingWheel_p) {
+        dispatchTimingWheelEvents();
+        return;                                                       // RETURN
+    }
+
     while (1) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
@@ -270,32 +798,151 @@ void EventScheduler::dispatchEvents()
         BSLS_ASSERT(0 != d_currentEvent || 0 != d_currentRecurringEvent);
 
         if (d_currentRecurringEvent) {
-            RecurringEventData& data = d_currentRecurringEvent->data();
-            bsls::Types::Int64 nowOffset = data.d_nowOffset(data.d_eventIdx);
+            dispatchRecurringEvent(&lock, t);
+        }
+        else { // d_currentEvent
+            EventData& data = d_currentEvent->data();
+            bsls::Types::Int64 nowOffset = data.d_nowOffset();
             if (nowOffset <= 0) {
-                ++data.d_eventIdx;
-                int ret = d_recurringQueue.updateR(
-                                      d_currentRecurringEvent,
-                                      t + data.d_interval.totalMicroseconds());
+                int ret = d_eventQueue.remove(d_currentEvent);
                 if (0 == ret) {
                     lock.release()->unlock();
                     d_dispatcherFunctor(data.d_callback);
+                    data.d_callback = 0;
                 }
             }
             else {
-                int ret = d_recurringQueue.updateR(
-                                      d_currentRecurringEvent,
-                                      d_cachedNow + nowOffset);
+                int ret = d_eventQueue.updateR(
+                                d_currentEvent,
+                                d_cachedNow + nowOffset);
                 (void) ret;
+                d_eventQueue.releaseReferenceRaw(d_currentEvent);
+                d_currentEvent = 0;
+            }
+        }
+    }
+}
+
+void EventScheduler::dispatchRecurringEvent(
+                                   bslmt::LockGuard<bslmt::Mutex> *lock,
+                                   bsls::Types::Int64              t)
+{
+    BSLS_ASSERT(d_currentRecurringEvent);
+
+    RecurringEventData& data = d_currentRecurringEvent->data();
+    bsls::Types::Int64 nowOffset = data.d_nowOffset(data.d_eventIdx);
+    if (nowOffset <= 0) {
+        ++data.d_eventIdx;
+        int ret = d_recurringQueue.updateR(
+                                      d_currentRecurringEvent,
+                                      t + data.d_interval.totalMicroseconds());
+        if (0 == ret) {
+            lock->release()->unlock();
+            d_dispatcherFunctor(data.d_callback);
+        }
+    }
+    else {
+        int ret = d_recurringQueue.updateR(d_currentRecurringEvent,
+                                           d_cachedNow + nowOffset);
+        (void) ret;
+        d_recurringQueue.releaseReferenceRaw(d_currentRecurringEvent);
+        d_currentRecurringEvent = 0;
+    }
+}
+
+void EventScheduler::dispatchTimingWheelEvents()
+{
+    const bsls::Types::Int64 k_NO_EVENT =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        releaseCurrentEvents();
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            // reset the dispatcher thread id, as the same id may be reused by
+            // the OS after the thread terminates
+            d_dispatcherThreadId.storeRelease(invalidThreadId());
+
+            return;                                                   // RETURN
+        }
+
+        BSLS_ASSERT(0 == d_currentRecurringEvent);
+        BSLS_ASSERT(0 == d_currentWheelEvent);
+
+        d_cachedNow = d_currentTimeFunctor().totalMicroseconds();
+
+        d_recurringQueue.frontRaw(&d_currentRecurringEvent);
+
+        // Expire the elapsed ticks of the wheel.  If a one-time event is due,
+        // 'd_currentWheelEvent' refers to it and 't' is its scheduled time;
+        // otherwise 't' is the time at which the wheel must next be examined.
+
+        bsls::Types::Int64 t = d_timingWheel_p->frontRaw(&d_currentWheelEvent,
+                                                         d_cachedNow);
+
+        if (d_currentRecurringEvent) {
+            bsls::Types::Int64 recurringEventTime =
+                                               d_currentRecurringEvent->key();
+
+            // Prefer overdue events over overdue clocks if running behind.
+
+            if (t < recurringEventTime
+             || (d_currentWheelEvent && t < d_cachedNow)) {
                 d_recurringQueue.releaseReferenceRaw(d_currentRecurringEvent);
                 d_currentRecurringEvent = 0;
             }
+            else {
+                if (d_currentWheelEvent) {
+                    d_timingWheel_p->releaseReference(d_currentWheelEvent);
+                    d_currentWheelEvent = 0;
+                }
+                t = recurringEventTime;
+            }
         }
-        else { // d_currentEvent
-            EventData& data = d_currentEvent->data();
+
+        if (0 == d_currentRecurringEvent && 0 == d_currentWheelEvent) {
+            ++d_waitCount;
+            if (k_NO_EVENT == t) {
+                d_queueCondition.wait(&d_mutex);
+            }
+            else {
+                bsls::TimeInterval w;
+                w.addMicroseconds(t);
+                d_queueCondition.timedWait(&d_mutex, w);
+            }
+            continue;
+        }
+
+        if (t > d_cachedNow) {
+            releaseCurrentEvents();
+            bsls::TimeInterval w;
+            w.addMicroseconds(t);
+            ++d_waitCount;
+            d_queueCondition.timedWait(&d_mutex, w);
+            continue;
+        }
+
+        // We have an event due for execution.
+
+        if (d_currentRecurringEvent) {
+            dispatchRecurringEvent(&lock, t);
+        }
+        else { // d_currentWheelEvent
+            EventData& data = d_currentWheelEvent->data();
             bsls::Types::Int64 nowOffset = data.d_nowOffset();
             if (nowOffset <= 0) {
-                int ret = d_eventQueue.remove(d_currentEvent);
+                int ret = d_timingWheel_p->remove(d_currentWheelEvent);
                 if (0 == ret) {
                     lock.release()->unlock();
                     d_dispatcherFunctor(data.d_callback);
@@ -303,12 +950,13 @@ void EventScheduler::dispatchEvents()
                 }
             }
             else {
-                int ret = d_eventQueue.updateR(
-                                d_currentEvent,
-                                d_cachedNow + nowOffset);
+                bool isNewTop;
+                int  ret = d_timingWheel_p->update(d_currentWheelEvent,
+                                                   d_cachedNow + nowOffset,
+                                                   &isNewTop);
                 (void) ret;
-                d_eventQueue.releaseReferenceRaw(d_currentEvent);
-                d_currentEvent = 0;
+                d_timingWheel_p->releaseReference(d_currentWheelEvent);
+                d_currentWheelEvent = 0;
             }
         }
     }
@@ -353,6 +1001,11 @@ void EventScheduler::releaseCurrentEvents()
         d_eventQueue.releaseReferenceRaw(d_currentEvent);
         d_currentEvent = 0;
     }
+
+    if (d_currentWheelEvent) {
+        d_timingWheel_p->releaseReference(d_currentWheelEvent);
+        d_currentWheelEvent = 0;
+    }
 }
 
 void
@@ -367,10 +1020,21 @@ EventScheduler::scheduleEvent(EventHandle               *event,
         startTime = d_cachedNow;
     }
 
-    d_eventQueue.addR(&event->d_handle,
-                      startTime,
-                      eventData,
-                      &newTop);
+    if (d_timingWheel_p) {
+        EventScheduler_TimingWheelNode *node;
+        d_timingWheel_p->add(&node, startTime, eventData, &newTop);
+
+        event->release();
+        event->d_timingWheel_p = d_timingWheel_p;
+        event->d_wheelEvent_p  = node;
+    }
+    else {
+        event->release();
+        d_eventQueue.addR(&event->d_handle,
+                          startTime,
+                          eventData,
+                          &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -381,21 +1045,12 @@ EventScheduler::scheduleEvent(EventHandle               *event,
 void EventScheduler::scheduleEvent(const bsls::TimeInterval&   epochTime,
                                    const EventData&            eventData)
 {
-    bool newTop;
-
     bsls::Types::Int64 startTime = epochTime.totalMicroseconds();
     if (startTime < d_cachedNow) {
         startTime = d_cachedNow;
     }
 
-    d_eventQueue.addR(startTime,
-                      eventData,
-                      &newTop);
-
-    if (newTop) {
-        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-        d_queueCondition.signal();
-    }
+    addEventRaw(0, startTime, eventData);
 }
 
 void
@@ -453,6 +1108,7 @@ EventScheduler::EventScheduler()
             bslma::Default::defaultAllocator(),
             createDefaultCurrentTimeFunctor(bsls::SystemClockType::e_REALTIME))
 , d_eventQueue()
+, d_timingWheel_p(0)
 , d_recurringQueue()
 , d_dispatcherFunctor(bsl::allocator_arg_t(),
                       bslma::Default::defaultAllocator(),
@@ -463,6 +1119,7 @@ EventScheduler::EventScheduler()
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName()
@@ -477,6 +1134,7 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -486,6 +1144,7 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(basicAllocator)
@@ -502,6 +1161,7 @@ EventScheduler::EventScheduler(const bsl::string_view&  eventSchedulerName,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -511,6 +1171,7 @@ EventScheduler::EventScheduler(const bsl::string_view&  eventSchedulerName,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -523,6 +1184,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 : d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -533,6 +1195,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 , d_eventSchedulerName(basicAllocator)
@@ -549,6 +1212,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 : d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -559,6 +1223,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -566,6 +1231,74 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
     initialize(metricsRegistry, eventSchedulerName);
 }
 
+EventScheduler::EventScheduler(
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          tickGranularity,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(basicAllocator)
+{
+    BSLS_ASSERT(1 <= tickGranularity.totalMicroseconds());
+
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+
+    d_timingWheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                          tickGranularity.totalMicroseconds(),
+                                          allocator());
+}
+
+EventScheduler::EventScheduler(
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          tickGranularity,
+                          const bsl::string_view&            eventSchedulerName,
+                          bdlm::MetricsRegistry             *metricsRegistry,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(eventSchedulerName, basicAllocator)
+{
+    BSLS_ASSERT(1 <= tickGranularity.totalMicroseconds());
+
+    initialize(metricsRegistry, eventSchedulerName);
+
+    d_timingWheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                          tickGranularity.totalMicroseconds(),
+                                          allocator());
+}
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
 EventScheduler::EventScheduler(
                              const bsl::chrono::system_clock&,
@@ -574,6 +1307,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -583,6 +1317,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(basicAllocator)
@@ -601,6 +1336,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -610,6 +1346,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -624,6 +1361,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -633,6 +1371,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_MONOTONIC)
 , d_eventSchedulerName(basicAllocator)
@@ -651,6 +1390,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
@@ -660,6 +1400,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_MONOTONIC)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -675,6 +1416,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -684,6 +1426,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(basicAllocator)
@@ -702,6 +1445,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -711,6 +1455,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -725,6 +1470,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -735,6 +1481,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 , d_eventSchedulerName(basicAllocator)
@@ -753,6 +1500,36 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(eventSchedulerName, basicAllocator)
+{
+    initialize(metricsRegistry, eventSchedulerName);
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          tickGranularity,
+                          const bsl::string_view&            eventSchedulerName,
+                          bdlm::MetricsRegistry             *metricsRegistry,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -763,11 +1540,18 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
 {
+    BSLS_ASSERT(1 <= tickGranularity.totalMicroseconds());
+
     initialize(metricsRegistry, eventSchedulerName);
+
+    d_timingWheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                          tickGranularity.totalMicroseconds(),
+                                          allocator());
 }
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
@@ -779,6 +1563,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -788,6 +1573,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(basicAllocator)
@@ -807,6 +1593,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -816,6 +1603,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -831,6 +1619,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -840,6 +1629,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_MONOTONIC)
 , d_eventSchedulerName(basicAllocator)
@@ -859,6 +1649,7 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
 , d_eventQueue(basicAllocator)
+, d_timingWheel_p(0)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
@@ -868,6 +1659,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_MONOTONIC)
 , d_eventSchedulerName(eventSchedulerName, basicAllocator)
@@ -879,6 +1671,10 @@ EventScheduler::EventScheduler(
 EventScheduler::~EventScheduler()
 {
     BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_dispatcherThread);
+
+    if (d_timingWheel_p) {
+        allocator()->deleteObject(d_timingWheel_p);
+    }
 }
 
 // MANIPULATORS
@@ -906,6 +1702,9 @@ int EventScheduler::cancelEvent(RecurringEventHandle *handle)
 
 void EventScheduler::cancelAllEvents()
 {
+    if (d_timingWheel_p) {
+        d_timingWheel_p->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 }
@@ -915,12 +1714,17 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_timingWheel_p) {
+        d_timingWheel_p->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent
+         && 0 == d_currentWheelEvent
+         && 0 == d_currentRecurringEvent) {
             break;
         }
         else {
@@ -972,11 +1776,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    const EventQueue::Pair *itemPtr =
-                             reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
-    int ret = d_eventQueue.remove(itemPtr);
+    int ret = removeEvent(handle);
     if (EventQueue::e_NOT_FOUND != ret) {
         return ret;                                                   // RETURN
     }
@@ -987,7 +1787,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent != itemPtr) {
+        if (!isCurrentEvent(handle)) {
             break;
         }
         else {
@@ -1024,14 +1824,11 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newEpochTime)
 {
-    const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
     bool isNewTop;
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    if (h) {
-        h->data().d_nowOffset = returnZero;
+    if (handle) {
+        eventData(handle).d_nowOffset = returnZero;
     }
 
     bsls::Types::Int64 startTime = newEpochTime.totalMicroseconds();
@@ -1039,9 +1836,7 @@ int EventScheduler::rescheduleEvent(const Event               *handle,
         startTime = d_cachedNow;
     }
 
-    int ret = d_eventQueue.updateR(h,
-                                   startTime,
-                                   &isNewTop);
+    int ret = updateEvent(handle, startTime, &isNewTop);
 
     if (0 == ret && isNewTop) {
         d_queueCondition.signal();
@@ -1056,16 +1851,14 @@ int EventScheduler::rescheduleEventAndWait(
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
     int ret;
 
     {
         bool isNewTop;
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-        if (h) {
-            h->data().d_nowOffset = returnZero;
+        if (handle) {
+            eventData(handle).d_nowOffset = returnZero;
         }
 
         bsls::Types::Int64 startTime = newEpochTime.totalMicroseconds();
@@ -1073,15 +1866,13 @@ int EventScheduler::rescheduleEventAndWait(
             startTime = d_cachedNow;
         }
 
-        ret = d_eventQueue.updateR(h,
-                                   startTime,
-                                   &isNewTop);
+        ret = updateEvent(handle, startTime, &isNewTop);
 
         if (0 == ret) {
             if (isNewTop) {
                 d_queueCondition.signal();
             }
-            if (d_currentEvent != h) {
+            if (!isCurrentEvent(handle)) {
                 return 0;                                             // RETURN
             }
         }
@@ -1091,7 +1882,7 @@ int EventScheduler::rescheduleEventAndWait(
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent!=h) {
+        if (!isCurrentEvent(handle)) {
             break;
         }
         else {
@@ -1107,22 +1898,12 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
                                       const bsls::TimeInterval&      epochTime,
                                       const bsl::function<void()>&   callback)
 {
-    bool newTop;
-
     bsls::Types::Int64 startTime = epochTime.totalMicroseconds();
     if (startTime < d_cachedNow) {
         startTime = d_cachedNow;
     }
 
-    d_eventQueue.addRawR((EventQueue::Pair **)event,
-                         startTime,
-                         EventData(callback, returnZero),
-                         &newTop);
-
-    if (newTop) {
-        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-        d_queueCondition.signal();
-    }
+    addEventRaw(event, startTime, EventData(callback, returnZero));
 }
 
 void
@@ -1156,6 +1937,12 @@ EventScheduler::scheduleRecurringEventRaw(
     }
 }
 
+void EventScheduler::setThreadPlacement(const ThreadPlacement& placement)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_threadPlacement = placement;
+}
+
 int EventScheduler::start()
 {
     bslmt::ThreadAttributes attr;
@@ -1189,6 +1976,20 @@ int EventScheduler::start(const bslmt::ThreadAttributes& threadAttributes)
         }
     }
 
+    if (ThreadPlacement::e_ANY_NUMA_NODE != d_threadPlacement.numaNode()) {
+        modAttr.setNumaNode(d_threadPlacement.numaNode());
+    }
+    else if (ThreadPlacement::e_NONE != d_threadPlacement.policy()) {
+        modAttr.setNumaNode(bslmt::ThreadAttributes::e_UNSET_NUMA_NODE);
+    }
+
+    bsl::vector<int> cpus(allocator());
+    d_threadPlacement.loadCpuOrder(&cpus);
+    if (!cpus.empty()) {
+        cpus.resize(1);
+        modAttr.setCpuAffinity(cpus);
+    }
+
     if (bslmt::ThreadUtil::createWithAllocator(
                 &d_dispatcherThread,
                 modAttr,
@@ -1244,13 +2045,21 @@ bsls::TimeInterval EventScheduler::nextPendingEventTime() const
             minTime = time;
         }
 
-        EventQueue::PairHandle currentEvent;
-        if (0 == d_eventQueue.front(&currentEvent)) {
-            bsls::Types::Int64 time = currentEvent.key();
+        if (d_timingWheel_p) {
+            bsls::Types::Int64 time = d_timingWheel_p->minTime();
             if (time < minTime) {
                 minTime = time;
             }
         }
+        else {
+            EventQueue::PairHandle currentEvent;
+            if (0 == d_eventQueue.front(&currentEvent)) {
+                bsls::Types::Int64 time = currentEvent.key();
+                if (time < minTime) {
+                    minTime = time;
+                }
+            }
+        }
     }
 
     bsls::TimeInterval rv;
@@ -1258,6 +2067,12 @@ bsls::TimeInterval EventScheduler::nextPendingEventTime() const
     return rv;
 }
 
+ThreadPlacement EventScheduler::threadPlacement() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_threadPlacement;
+}
+
                     // ----------------------------------
                     // class EventSchedulerTestTimeSource
                     // ----------------------------------
@@ -22,7 +22,7 @@ BSLS_IDENT("$Id: $")
 //  * object type name: "bdlmt.eventscheduler"
 //  * object type abbreviation: "es"
 //
-//@SEE_ALSO: bdlmt_timereventscheduler
+//@SEE_ALSO: bdlmt_timereventscheduler, bdlmt_threadplacement
 //
 //@DESCRIPTION: This component provides a thread-safe event scheduler.
 // `bdlmt::EventScheduler`, that implements methods to schedule and cancel
@@ -114,6 +114,27 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Timing-Wheel Event Queue
+///------------------------
+// By default, one-time events are stored in a skip list ordered by their
+// scheduled time, so scheduling, rescheduling, and cancelling a one-time
+// event take time logarithmic in the number of pending events.  Applications
+// that arm very large numbers of one-time events, most of which are cancelled
+// before they fire (e.g., I/O timeouts), can instead supply a tick
+// granularity at construction, in which case one-time events are stored in a
+// hierarchical timing wheel.  Scheduling, rescheduling, and cancelling a
+// one-time event stored in a timing wheel take constant time, and the memory
+// for the events is recycled through an internal pool.
+//
+// The price of the timing wheel is precision: an event is dispatched at the
+// first tick boundary at or after its scheduled time, so it may be dispatched
+// up to one tick later than it would be with the default queue, and events
+// falling within the same tick are dispatched in the order they were
+// scheduled rather than strictly in the order of their scheduled times.
+// Events are still never dispatched before their scheduled time.  Recurring
+// events, event handles, the "Raw" API, and the `bde.startlag` metric behave
+// identically for both kinds of queue.
+//
 ///Supported Clock Types
 ///---------------------
 // An `EventScheduler` optionally accepts a clock type at construction
@@ -208,6 +229,19 @@ BSLS_IDENT("$Id: $")
 // `threadName` attribute is not set, the default value "bdl.EventSched" will
 // be used.
 //
+///Placement of the Dispatcher Thread
+///----------------------------------
+// The dispatcher thread can be bound to a CPU of the host by supplying a
+// `bdlmt::ThreadPlacement` to `setThreadPlacement` before calling `start`.
+// Under the `e_COMPACT` and `e_SCATTER` policies, the dispatcher thread is
+// bound to the first CPU of the order described by
+// `bdlmt::ThreadPlacement::loadCpuOrder`; under the `e_NONE` policy, it is
+// restricted to the placement's NUMA node, if any.  A placement having a NUMA
+// node replaces the `numaNode` attribute of the `bslmt::ThreadAttributes`
+// passed to `start`, and the `e_COMPACT` and `e_SCATTER` policies replace both
+// its `numaNode` and `cpuAffinity` attributes.  Note that, at this time,
+// placement is honored only on Linux.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -436,6 +470,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlm_metricsregistry.h>
 
+#include <bdlma_pool.h>
+
+#include <bdlmt_threadplacement.h>
+
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 
@@ -476,6 +514,8 @@ namespace bdlmt {
 class EventSchedulerEventHandle;
 class EventSchedulerRecurringEventHandle;
 class EventSchedulerTestTimeSource_Data;
+class EventScheduler_TimingWheel;
+class EventScheduler_TimingWheelNode;
 
                             // ====================
                             // class EventScheduler
@@ -621,6 +661,8 @@ class EventScheduler {
     friend class EventSchedulerEventHandle;
     friend class EventSchedulerRecurringEventHandle;
     friend class EventSchedulerTestTimeSource;
+    friend class EventScheduler_TimingWheel;
+    friend class EventScheduler_TimingWheelNode;
 
   public:
     // PUBLIC TYPES
@@ -658,6 +700,12 @@ class EventScheduler {
 
     EventQueue            d_eventQueue;         // events
 
+    EventScheduler_TimingWheel
+                         *d_timingWheel_p;      // events, if a tick
+                                                // granularity was supplied at
+                                                // construction (owned), and 0
+                                                // otherwise
+
     RecurringEventQueue   d_recurringQueue;     // recurring events
 
     Dispatcher            d_dispatcherFunctor;  // dispatch events
@@ -672,6 +720,10 @@ class EventScheduler {
     bslmt::Mutex          d_dispatcherMutex;    // serialize starting/stopping
                                                 // dispatcher thread
 
+    ThreadPlacement       d_threadPlacement;    // placement of the dispatcher
+                                                // thread on CPUs, applied by
+                                                // `start`
+
     mutable bslmt::Mutex  d_mutex;              // synchronizes access to
                                                 // condition variables
 
@@ -704,6 +756,11 @@ class EventScheduler {
                                                 // scheduled recurring event
                                                 // being executed
 
+    EventScheduler_TimingWheelNode
+                         *d_currentWheelEvent;  // Raw reference to the
+                                                // scheduled timing-wheel event
+                                                // being executed
+
     unsigned int          d_waitCount;          // count of the number of waits
                                                 // performed in the main
                                                 // dispatch loop, used in
@@ -761,6 +818,18 @@ class EventScheduler {
 
     // PRIVATE MANIPULATORS
 
+    /// Add a one-time event having the specified `eventData` and scheduled at
+    /// the specified `startTime` to the queue of one-time events, and wake
+    /// the dispatcher thread if the event becomes the next one to be
+    /// dispatched.  If the specified `event` is not 0, load into `event` a
+    /// reference to the added event that must be released using
+    /// `releaseEventRaw`.  Note that `startTime` is expressed in terms of
+    /// the number of microseconds elapsed since the epoch of the clock
+    /// indicated at construction.
+    void addEventRaw(Event              **event,
+                     bsls::Types::Int64   startTime,
+                     const EventData&     eventData);
+
     /// Pick either `d_currentEvent` or `d_currentRecurringEvent` as the
     /// next event to be executed, given that the current time is the
     /// specified (absolute) `now` interval, and return the (absolute)
@@ -782,6 +851,20 @@ class EventScheduler {
     /// implements the dispatching thread.
     void dispatchEvents();
 
+    /// Dispatch `d_currentRecurringEvent`, which is due at the specified
+    /// `t`, and reschedule it for its next occurrence.  If the callback of
+    /// the event is invoked, unlock the mutex managed by the specified
+    /// `lock` and release it from `lock` beforehand.  The behavior is
+    /// undefined unless `d_currentRecurringEvent` refers to a valid event
+    /// and `lock` manages `d_mutex`.
+    void dispatchRecurringEvent(bslmt::LockGuard<bslmt::Mutex> *lock,
+                                bsls::Types::Int64              t);
+
+    /// While d_running is true, execute events in the timing wheel and
+    /// recurring event queue at their scheduled times.  Note that this
+    /// method implements the dispatching thread when a tick granularity was
+    /// supplied at construction.
+    void dispatchTimingWheelEvents();
 
     /// Initialize this event scheduler using the stored attributes and the
     /// specified `metricsRegistry` and `eventSchedulerName`.  If
@@ -790,10 +873,15 @@ class EventScheduler {
     void initialize(bdlm::MetricsRegistry   *metricsRegistry,
                     const bsl::string_view&  eventSchedulerName);
 
-    /// Release `d_currentRecurringEvent` and `d_currentEvent`, if they
-    /// refer to valid events.
+    /// Release `d_currentRecurringEvent`, `d_currentEvent`, and
+    /// `d_currentWheelEvent`, if they refer to valid events.
     void releaseCurrentEvents();
 
+    /// Remove the one-time event referred to by the specified `handle` from
+    /// the queue of one-time events.  Return 0 on success, `e_NOT_FOUND` if
+    /// the event is no longer pending, and `e_INVALID` if `handle` is 0.
+    int removeEvent(const Event *handle);
+
     /// Schedule the callback of the specified `eventData` to be dispatched
     /// at the specified `epochTime` truncated to microseconds.  Load into
     /// the specified `event` pointer a handle that can be used to cancel
@@ -852,6 +940,30 @@ class EventScheduler {
                                    const RecurringEventData&   eventData,
                                    const bsls::TimeInterval&   startEpochTime);
 
+    /// Move the one-time event referred to by the specified `handle` to the
+    /// specified `newTime`, and load into the specified `isNewTop` whether
+    /// the dispatcher thread must be woken to observe the change.  Return 0
+    /// on success, `e_NOT_FOUND` if the event is no longer pending, and
+    /// `e_INVALID` if `handle` is 0.  Note that `newTime` is expressed in
+    /// terms of the number of microseconds elapsed since the epoch of the
+    /// clock indicated at construction.
+    int updateEvent(const Event        *handle,
+                    bsls::Types::Int64  newTime,
+                    bool               *isNewTop);
+
+    // PRIVATE ACCESSORS
+
+    /// Return a reference providing modifiable access to the data of the
+    /// one-time event referred to by the specified `handle`.  The behavior
+    /// is undefined unless `handle` refers to a one-time event of this
+    /// scheduler.
+    EventData& eventData(const Event *handle) const;
+
+    /// Return `true` if the one-time event referred to by the specified
+    /// `handle` is the event currently being dispatched, and `false`
+    /// otherwise.  The behavior is undefined unless `d_mutex` is locked.
+    bool isCurrentEvent(const Event *handle) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(EventScheduler, bslma::UsesBslmaAllocator);
@@ -908,6 +1020,41 @@ class EventScheduler {
                             bdlm::MetricsRegistry       *metricsRegistry,
                             bslma::Allocator            *basicAllocator = 0);
 
+    /// Create an event scheduler using the default dispatcher functor (see
+    /// {The Dispatcher Thread and the Dispatcher Functor} in the
+    /// component-level documentation) and using the specified `clockType`
+    /// to indicate the epoch used for all time intervals (see {Supported
+    /// Clock Types} in the component documentation), that stores one-time
+    /// events in a timing wheel having the specified `tickGranularity` (see
+    /// {Timing-Wheel Event Queue} in the component documentation).
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `tickGranularity` is at least
+    /// one microsecond.
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    tickGranularity,
+                   bslma::Allocator            *basicAllocator = 0);
+
+    /// Create an event scheduler using the default dispatcher functor (see
+    /// {The Dispatcher Thread and the Dispatcher Functor} in the
+    /// component-level documentation), using the specified `clockType` to
+    /// indicate the epoch used for all time intervals (see {Supported Clock
+    /// Types} in the component documentation), that stores one-time events
+    /// in a timing wheel having the specified `tickGranularity` (see
+    /// {Timing-Wheel Event Queue} in the component documentation), the
+    /// specified `eventSchedulerName` to be used to identify this event
+    /// scheduler, and the specified `metricsRegistry` to be used for
+    /// reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::singleton()` is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `tickGranularity` is at least one microsecond.
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    tickGranularity,
+                   const bsl::string_view&      eventSchedulerName,
+                   bdlm::MetricsRegistry       *metricsRegistry,
+                   bslma::Allocator            *basicAllocator = 0);
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
     /// Create an event scheduler using the default dispatcher functor (see
     /// {The Dispatcher Thread and the Dispatcher Functor} in the
@@ -1017,6 +1164,27 @@ class EventScheduler {
                    bdlm::MetricsRegistry       *metricsRegistry,
                    bslma::Allocator            *basicAllocator = 0);
 
+    /// Create an event scheduler using the specified `dispatcherFunctor`
+    /// (see {The Dispatcher Thread and the Dispatcher Functor} in the
+    /// component-level documentation), using the specified `clockType` to
+    /// indicate the epoch used for all time intervals (see {Supported Clock
+    /// Types} in the component documentation), that stores one-time events
+    /// in a timing wheel having the specified `tickGranularity` (see
+    /// {Timing-Wheel Event Queue} in the component documentation), the
+    /// specified `eventSchedulerName` to be used to identify this event
+    /// scheduler, and the specified `metricsRegistry` to be used for
+    /// reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::singleton()` is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `tickGranularity` is at least one microsecond.
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    tickGranularity,
+                   const bsl::string_view&      eventSchedulerName,
+                   bdlm::MetricsRegistry       *metricsRegistry,
+                   bslma::Allocator            *basicAllocator = 0);
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
     /// Create an event scheduler using the specified `dispatcherFunctor`
     /// (see {The Dispatcher Thread and the Dispatcher Functor} in the
@@ -1381,6 +1549,13 @@ class EventScheduler {
                                                                t_CLOCK::now());
 #endif
 
+    /// Set the placement of the dispatcher thread of this scheduler on CPUs
+    /// to the specified `placement` (see
+    /// {Placement of the Dispatcher Thread}).  The placement takes effect
+    /// the next time this scheduler is started; a dispatcher thread that is
+    /// already running is not affected.
+    void setThreadPlacement(const ThreadPlacement& placement);
+
     /// Begin dispatching events on this scheduler using default attributes
     /// for the dispatcher thread.  Return 0 on success, and a nonzero value
     /// otherwise.  If another thread is currently executing `stop`, wait
@@ -1408,7 +1583,10 @@ class EventScheduler {
     /// otherwise "bdl.EventSched".  The behavior is undefined if this method
     /// is invoked in the dispatcher thread (i.e., in a job executed by this
     /// scheduler).  Note that any event whose time has already passed is
-    /// pending and will be dispatched immediately.
+    /// pending and will be dispatched immediately.  Also note that the
+    /// dispatcher thread is placed on CPUs as described by
+    /// `threadPlacement()`, and that, on Linux, starting fails if the
+    /// placement designates a NUMA node having no online CPU.
     int start(const bslmt::ThreadAttributes& threadAttributes);
 
     /// End the dispatching of events on this scheduler (but do not remove
@@ -1464,12 +1642,287 @@ class EventScheduler {
     /// microseconds.
     bsls::TimeInterval nextPendingEventTime() const;
 
+    /// Return the placement of the dispatcher thread of this scheduler on
+    /// CPUs.
+    ThreadPlacement threadPlacement() const;
+
+    /// Return the tick granularity of the timing wheel in which this
+    /// scheduler stores one-time events, or a zero interval if this
+    /// scheduler stores one-time events in the default skip list (see
+    /// {Timing-Wheel Event Queue} in the component documentation).
+    bsls::TimeInterval tickGranularity() const;
+
                                   // Aspects
 
     /// Return the allocator used by this object to supply memory.
     bslma::Allocator *allocator() const;
 };
 
+                    // ====================================
+                    // class EventScheduler_TimingWheelNode
+                    // ====================================
+
+/// This component-private class holds a one-time event stored in an
+/// `EventScheduler_TimingWheel`.  A node is linked into at most one list of
+/// the timing wheel at a time, and is reference counted: the wheel holds one
+/// reference while the node is linked, and each handle holds another.
+class EventScheduler_TimingWheelNode {
+
+    // PRIVATE TYPES
+    typedef EventScheduler::EventData EventData;
+
+    // DATA
+    EventScheduler_TimingWheelNode *d_next_p;    // next node in the list
+
+    EventScheduler_TimingWheelNode *d_prev_p;    // previous node in the list
+
+    bsls::Types::Int64              d_time;      // scheduled time, in
+                                                 // microseconds
+
+    int                             d_list;      // index of the list this
+                                                 // node is linked into, or
+                                                 // negative if not linked
+
+    bsls::AtomicInt                 d_refCount;  // number of references
+
+    EventData                       d_data;      // callback and clock offset
+
+    // FRIENDS
+    friend class EventScheduler_TimingWheel;
+
+  private:
+    // NOT IMPLEMENTED
+    EventScheduler_TimingWheelNode(const EventScheduler_TimingWheelNode&);
+    EventScheduler_TimingWheelNode& operator=(
+                                        const EventScheduler_TimingWheelNode&);
+
+  public:
+    // CREATORS
+
+    /// Create an unlinked node scheduled at the specified `time` and having
+    /// a copy of the specified `data`, with a reference count of one.  Use
+    /// the specified `basicAllocator` to supply memory.
+    EventScheduler_TimingWheelNode(bsls::Types::Int64  time,
+                                   const EventData&    data,
+                                   bslma::Allocator   *basicAllocator);
+
+    // MANIPULATORS
+
+    /// Return a reference providing modifiable access to the data of this
+    /// node.
+    EventData& data();
+
+    // ACCESSORS
+
+    /// Return the scheduled time of this node, in microseconds.
+    bsls::Types::Int64 time() const;
+};
+
+                      // ================================
+                      // class EventScheduler_TimingWheel
+                      // ================================
+
+/// This component-private class implements the hierarchical timing wheel in
+/// which an `EventScheduler` stores one-time events when a tick granularity
+/// is supplied at construction.  Time is divided into ticks of a fixed
+/// length, and an event scheduled at time `t` expires at tick
+/// `ceil(t / tickLength)`.  The wheel has `k_NUM_LEVELS` levels of
+/// `k_SLOTS_PER_LEVEL` slots; a slot at level `L` covers
+/// `k_SLOTS_PER_LEVEL ** L` consecutive ticks, and an event is stored at the
+/// lowest level whose current span contains its expiry tick.  Adding,
+/// moving, and removing an event are constant-time operations; as the wheel
+/// advances, the contents of a higher-level slot are redistributed to the
+/// lower levels when its span begins, and the contents of a level-0 slot are
+/// moved to a list of due events when its tick expires.  Events expiring
+/// beyond the span of the top level are kept in an overflow list until the
+/// wheel comes within range.  This class is thread-safe.
+class EventScheduler_TimingWheel {
+
+  public:
+    // PUBLIC TYPES
+    typedef EventScheduler_TimingWheelNode Node;
+    typedef EventScheduler::EventData      EventData;
+
+    enum {
+        e_SUCCESS   = EventScheduler::EventQueue::e_SUCCESS,
+        e_NOT_FOUND = EventScheduler::EventQueue::e_NOT_FOUND,
+        e_INVALID   = EventScheduler::EventQueue::e_INVALID
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_BITS_PER_LEVEL  = 6,
+        k_SLOTS_PER_LEVEL = 1 << k_BITS_PER_LEVEL,
+        k_NUM_LEVELS      = 6,
+        k_DUE_LIST        = k_NUM_LEVELS * k_SLOTS_PER_LEVEL,
+        k_OVERFLOW_LIST   = k_DUE_LIST + 1,
+        k_NUM_LISTS       = k_OVERFLOW_LIST + 1
+    };
+
+    // DATA
+    bsls::Types::Int64   d_tickLength;              // tick length, in
+                                                    // microseconds
+
+    bsls::Types::Int64   d_nextTick;                // earliest tick that has
+                                                    // not yet expired
+
+    bsls::Types::Int64   d_wakeTime;                // time by which the
+                                                    // dispatcher will next
+                                                    // examine the wheel
+
+    Node                *d_lists[k_NUM_LISTS];      // circular lists of the
+                                                    // slots, due events, and
+                                                    // overflow events
+
+    bsls::Types::Uint64  d_occupied[k_NUM_LEVELS];  // per-level bit mask of
+                                                    // non-empty slots
+
+    int                  d_length;                  // number of linked nodes
+
+    bdlma::Pool          d_pool;                    // node memory
+
+    mutable bslmt::Mutex d_mutex;                   // synchronizes access
+
+    bslma::Allocator    *d_allocator_p;             // memory allocator (held,
+                                                    // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    EventScheduler_TimingWheel(const EventScheduler_TimingWheel&);
+    EventScheduler_TimingWheel& operator=(const EventScheduler_TimingWheel&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Expire every tick up to and including the specified `tick`: move the
+    /// events of expired level-0 slots to the due list, and redistribute
+    /// the events of higher-level slots whose span begins.  The behavior is
+    /// undefined unless `d_mutex` is locked.
+    void advance(bsls::Types::Int64 tick);
+
+    /// Destroy the specified `node` and return its memory to the pool.  The
+    /// behavior is undefined unless `node` is not linked and has no
+    /// outstanding references.
+    void deleteNode(Node *node);
+
+    /// Append the specified `node` to the list having the specified
+    /// `index`.  The behavior is undefined unless `node` is not linked and
+    /// `d_mutex` is locked.
+    void link(Node *node, int index);
+
+    /// Link the specified `node` into the list appropriate for its expiry
+    /// tick relative to `d_nextTick`, and return the expiry tick.  The
+    /// behavior is undefined unless `node` is not linked and `d_mutex` is
+    /// locked.
+    bsls::Types::Int64 place(Node *node);
+
+    /// Re-place every node of the list having the specified `index`.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void replaceList(int index);
+
+    /// Set `d_nextTick` to the specified `tick`, and redistribute the
+    /// events of any slot (or of the overflow list) whose span now contains
+    /// `d_nextTick`.  The behavior is undefined unless `d_mutex` is locked
+    /// and `d_nextTick <= tick`.
+    void setNextTick(bsls::Types::Int64 tick);
+
+    /// Unlink the specified `node` from the list into which it is linked.
+    /// The behavior is undefined unless `node` is linked and `d_mutex` is
+    /// locked.
+    void unlink(Node *node);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the earliest time at which the dispatcher must next examine
+    /// this wheel, or `INT64_MAX` if the wheel is empty.  The behavior is
+    /// undefined unless `d_mutex` is locked and the due list is empty.
+    bsls::Types::Int64 nextWakeTime() const;
+
+    /// Return the expiry tick of an event scheduled at the specified
+    /// `time`.
+    bsls::Types::Int64 tickOf(bsls::Types::Int64 time) const;
+
+    /// Return the time at which the specified `tick` begins, saturated to
+    /// `INT64_MAX`.
+    bsls::Types::Int64 timeOf(bsls::Types::Int64 tick) const;
+
+  public:
+    // CLASS METHODS
+
+    /// Return the node referred to by the specified `handle`.
+    static Node *toNode(const EventScheduler::Event *handle);
+
+    /// Return the raw event handle referring to the specified `node`.
+    static EventScheduler::Event *toEvent(Node *node);
+
+    // CREATORS
+
+    /// Create an empty timing wheel having ticks of the specified
+    /// `tickLength` microseconds.  Use the specified `basicAllocator` to
+    /// supply memory.  The behavior is undefined unless `0 < tickLength`.
+    EventScheduler_TimingWheel(bsls::Types::Int64  tickLength,
+                               bslma::Allocator   *basicAllocator);
+
+    /// Destroy this object.  The behavior is undefined unless no references
+    /// other than those held by the wheel itself are outstanding.
+    ~EventScheduler_TimingWheel();
+
+    // MANIPULATORS
+
+    /// Add an event having the specified `data` and scheduled at the
+    /// specified `time`, and load into the specified `isNewTop` whether the
+    /// dispatcher thread must be woken to observe it.  If the specified
+    /// `result` is not 0, load into it an additional reference to the new
+    /// node.
+    void add(Node               **result,
+             bsls::Types::Int64   time,
+             const EventData&     data,
+             bool                *isNewTop);
+
+    /// Add a reference to the specified `node` and return `node`.
+    Node *addReference(Node *node);
+
+    /// Expire the ticks up to the one containing the specified `now`.  If
+    /// an event is due, load into the specified `front` a new reference to
+    /// the earliest due event and return its scheduled time; otherwise
+    /// load 0 into `front` and return the earliest time at which this
+    /// method must be called again, or `INT64_MAX` if the wheel is empty.
+    bsls::Types::Int64 frontRaw(Node **front, bsls::Types::Int64 now);
+
+    /// Release a reference to the specified `node`, destroying it if that
+    /// was the last reference.
+    void releaseReference(Node *node);
+
+    /// Remove the specified `node` from this wheel.  Return 0 on success,
+    /// `e_NOT_FOUND` if `node` is not in the wheel, and `e_INVALID` if
+    /// `node` is 0.
+    int remove(const Node *node);
+
+    /// Remove all nodes from this wheel.
+    void removeAll();
+
+    /// Move the specified `node` to the specified `time`, and load into the
+    /// specified `isNewTop` whether the dispatcher thread must be woken to
+    /// observe it.  Return 0 on success, `e_NOT_FOUND` if `node` is not in
+    /// the wheel, and `e_INVALID` if `node` is 0.
+    int update(const Node         *node,
+               bsls::Types::Int64  time,
+               bool               *isNewTop);
+
+    // ACCESSORS
+
+    /// Return the number of nodes in this wheel.
+    int length() const;
+
+    /// Return the earliest scheduled time of the nodes in this wheel, or
+    /// `INT64_MAX` if the wheel is empty.
+    bsls::Types::Int64 minTime() const;
+
+    /// Return the tick length of this wheel, in microseconds.
+    bsls::Types::Int64 tickLength() const;
+};
+
                       // ===============================
                       // class EventSchedulerEventHandle
                       // ===============================
@@ -1484,7 +1937,12 @@ class EventSchedulerEventHandle
     typedef EventScheduler::EventQueue EventQueue;
 
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle          d_handle;          // skip-list event
+
+    EventScheduler_TimingWheel     *d_timingWheel_p;   // wheel owning
+                                                       // 'd_wheelEvent_p'
+
+    EventScheduler_TimingWheelNode *d_wheelEvent_p;    // timing-wheel event
 
     // FRIENDS
     friend class EventScheduler;
@@ -1638,6 +2096,51 @@ class EventSchedulerTestTimeSource {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+                    // ------------------------------------
+                    // class EventScheduler_TimingWheelNode
+                    // ------------------------------------
+
+// MANIPULATORS
+inline
+EventScheduler::EventData& EventScheduler_TimingWheelNode::data()
+{
+    return d_data;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 EventScheduler_TimingWheelNode::time() const
+{
+    return d_time;
+}
+
+                      // --------------------------------
+                      // class EventScheduler_TimingWheel
+                      // --------------------------------
+
+// CLASS METHODS
+inline
+EventScheduler_TimingWheelNode *
+EventScheduler_TimingWheel::toNode(const EventScheduler::Event *handle)
+{
+    return reinterpret_cast<Node *>(
+                const_cast<void *>(reinterpret_cast<const void *>(handle)));
+}
+
+inline
+EventScheduler::Event *EventScheduler_TimingWheel::toEvent(Node *node)
+{
+    return reinterpret_cast<EventScheduler::Event *>(
+                                              reinterpret_cast<void *>(node));
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 EventScheduler_TimingWheel::tickLength() const
+{
+    return d_tickLength;
+}
+
                       // -------------------------------
                       // class EventSchedulerEventHandle
                       // -------------------------------
@@ -1645,6 +2148,8 @@ class EventSchedulerTestTimeSource {
 // CREATORS
 inline
 EventSchedulerEventHandle::EventSchedulerEventHandle()
+: d_timingWheel_p(0)
+, d_wheelEvent_p(0)
 {
 }
 
@@ -1652,12 +2157,19 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_timingWheel_p(original.d_timingWheel_p)
+, d_wheelEvent_p(original.d_wheelEvent_p
+                 ? d_timingWheel_p->addReference(original.d_wheelEvent_p)
+                 : 0)
 {
 }
 
 inline
 EventSchedulerEventHandle::~EventSchedulerEventHandle()
 {
+    if (d_wheelEvent_p) {
+        d_timingWheel_p->releaseReference(d_wheelEvent_p);
+    }
 }
 
 // MANIPULATORS
@@ -1666,6 +2178,18 @@ EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
     d_handle = rhs.d_handle;
+
+    // Acquire the new reference before releasing the old one, so that
+    // self-assignment is safe.
+
+    EventScheduler_TimingWheelNode *wheelEvent = rhs.d_wheelEvent_p
+                      ? rhs.d_timingWheel_p->addReference(rhs.d_wheelEvent_p)
+                      : 0;
+    if (d_wheelEvent_p) {
+        d_timingWheel_p->releaseReference(d_wheelEvent_p);
+    }
+    d_timingWheel_p = rhs.d_timingWheel_p;
+    d_wheelEvent_p  = wheelEvent;
     return *this;
 }
 
@@ -1673,6 +2197,10 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+    if (d_wheelEvent_p) {
+        d_timingWheel_p->releaseReference(d_wheelEvent_p);
+        d_wheelEvent_p = 0;
+    }
 }
 }  // close package namespace
 
@@ -1684,6 +2212,10 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelEvent_p) {
+        return bdlmt::EventScheduler_TimingWheel::toEvent(d_wheelEvent_p);
+                                                                      // RETURN
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -1779,19 +2311,70 @@ bsls::Types::Int64 EventScheduler::timeUntilTriggerRecurring(
 }
 #endif
 
+// PRIVATE MANIPULATORS
+inline
+int EventScheduler::removeEvent(const Event *handle)
+{
+    if (d_timingWheel_p) {
+        return d_timingWheel_p->remove(
+                                   EventScheduler_TimingWheel::toNode(handle));
+                                                                      // RETURN
+    }
+
+    return d_eventQueue.remove(reinterpret_cast<const EventQueue::Pair *>(
+                                      reinterpret_cast<const void *>(handle)));
+}
+
+inline
+int EventScheduler::updateEvent(const Event        *handle,
+                                bsls::Types::Int64  newTime,
+                                bool               *isNewTop)
+{
+    if (d_timingWheel_p) {
+        return d_timingWheel_p->update(
+                                    EventScheduler_TimingWheel::toNode(handle),
+                                    newTime,
+                                    isNewTop);                        // RETURN
+    }
+
+    return d_eventQueue.updateR(reinterpret_cast<const EventQueue::Pair *>(
+                                       reinterpret_cast<const void *>(handle)),
+                                newTime,
+                                isNewTop);
+}
+
+// PRIVATE ACCESSORS
+inline
+EventScheduler::EventData& EventScheduler::eventData(const Event *handle) const
+{
+    if (d_timingWheel_p) {
+        return EventScheduler_TimingWheel::toNode(handle)->data();    // RETURN
+    }
+
+    return reinterpret_cast<const EventQueue::Pair *>(
+                            reinterpret_cast<const void *>(handle))->data();
+}
+
+inline
+bool EventScheduler::isCurrentEvent(const Event *handle) const
+{
+    const void *event = handle;
+
+    return 0 != event && (event == static_cast<const void *>(d_currentEvent)
+                       || event == static_cast<const void *>(
+                                                       d_currentWheelEvent));
+}
+
 // MANIPULATORS
 inline
 int EventScheduler::cancelEvent(const Event *handle)
 {
-    const EventQueue::Pair *itemPtr =
-                       reinterpret_cast<const EventQueue::Pair*>(
-                                       reinterpret_cast<const void*>(handle));
     // We release the resources for the functor early (rather than waiting for
     // handle to be released), since large objects may be bound to the functor
     // and it may be surprising to users that they are not released until the
     // handle is released.
-    itemPtr->data().d_callback = 0;
-    return d_eventQueue.remove(itemPtr);
+    eventData(handle).d_callback = 0;
+    return removeEvent(handle);
 }
 
 inline
@@ -1811,10 +2394,16 @@ int EventScheduler::cancelEvent(const RecurringEvent *handle)
 inline
 void EventScheduler::releaseEventRaw(Event *handle)
 {
-    EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
-                                              reinterpret_cast<void*>(handle));
-    h->data().d_callback = 0;
-    d_eventQueue.releaseReferenceRaw(h);
+    eventData(handle).d_callback = 0;
+    if (d_timingWheel_p) {
+        d_timingWheel_p->releaseReference(
+                                   EventScheduler_TimingWheel::toNode(handle));
+    }
+    else {
+        d_eventQueue.releaseReferenceRaw(
+                                    reinterpret_cast<EventQueue::Pair *>(
+                                             reinterpret_cast<void*>(handle)));
+    }
 }
 
 inline
@@ -1839,22 +2428,19 @@ int EventScheduler::rescheduleEvent(
                                                                       // RETURN
     }
 
-    const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
     bool                           isNewTop;
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     bsls::TimeInterval offsetFromNow(newEpochTime - t_CLOCK::now());
 
-    if (h) {
-        h->data().d_nowOffset = bdlf::BindUtil::bind(
+    if (handle) {
+        eventData(handle).d_nowOffset = bdlf::BindUtil::bind(
                                          timeUntilTrigger<t_CLOCK, t_DURATION>,
                                          newEpochTime);
     }
 
-    int ret = d_eventQueue.updateR(h,
-                                   (now() + offsetFromNow).totalMicroseconds(),
-                                   &isNewTop);
+    int ret = updateEvent(handle,
+                          (now() + offsetFromNow).totalMicroseconds(),
+                          &isNewTop);
 
     if (0 == ret && isNewTop) {
         d_queueCondition.signal();
@@ -1874,30 +2460,27 @@ int EventScheduler::rescheduleEventAndWait(
                                                                       // RETURN
     }
 
-    int                     ret;
-    const EventQueue::Pair *h =
-        reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
+    int ret;
     {
         bool                           isNewTop;
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
         bsls::TimeInterval offsetFromNow(newEpochTime - t_CLOCK::now());
 
-        if (h) {
-            h->data().d_nowOffset = bdlf::BindUtil::bind(
+        if (handle) {
+            eventData(handle).d_nowOffset = bdlf::BindUtil::bind(
                                          timeUntilTrigger<t_CLOCK, t_DURATION>,
                                          newEpochTime);
         }
 
-        ret = d_eventQueue.updateR(h,
-                                   (now() + offsetFromNow).totalMicroseconds(),
-                                   &isNewTop);
+        ret = updateEvent(handle,
+                          (now() + offsetFromNow).totalMicroseconds(),
+                          &isNewTop);
 
         if (0 == ret) {
             if (isNewTop) {
                 d_queueCondition.signal();
             }
-            if (d_currentEvent != h) {
+            if (!isCurrentEvent(handle)) {
                 return 0;                                             // RETURN
             }
         }
@@ -1906,7 +2489,7 @@ int EventScheduler::rescheduleEventAndWait(
     // Wait until event is rescheduled or dispatched.
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent != h) {
+        if (!isCurrentEvent(handle)) {
             break;
         }
         else {
@@ -1998,20 +2581,12 @@ void EventScheduler::scheduleEventRaw(
             startTime = d_cachedNow;
         }
 
-        bool newTop;
-        d_eventQueue.addRawR(
-                (EventQueue::Pair **)event,
-                startTime,
-                EventData(
-                    callback,
-                    bdlf::BindUtil::bind(timeUntilTrigger<t_CLOCK, t_DURATION>,
-                                         epochTime)),
-                &newTop);
-
-        if (newTop) {
-            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-            d_queueCondition.signal();
-        }
+        addEventRaw(event,
+                    startTime,
+                    EventData(callback,
+                              bdlf::BindUtil::bind(
+                                         timeUntilTrigger<t_CLOCK, t_DURATION>,
+                                         epochTime)));
     }
 }
 #endif
@@ -2173,6 +2748,13 @@ inline
 EventScheduler::Event*
 EventScheduler::addEventRefRaw(Event *handle) const
 {
+    if (d_timingWheel_p) {
+        return EventScheduler_TimingWheel::toEvent(
+                                d_timingWheel_p->addReference(
+                                  EventScheduler_TimingWheel::toNode(handle)));
+                                                                      // RETURN
+    }
+
     EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
     return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
@@ -2211,7 +2793,8 @@ bsls::TimeInterval EventScheduler::now() const
 inline
 int EventScheduler::numEvents() const
 {
-    return d_eventQueue.length();
+    return d_timingWheel_p ? d_timingWheel_p->length()
+                           : d_eventQueue.length();
 }
 
 inline
@@ -2220,6 +2803,16 @@ int EventScheduler::numRecurringEvents() const
     return d_recurringQueue.length();
 }
 
+inline
+bsls::TimeInterval EventScheduler::tickGranularity() const
+{
+    bsls::TimeInterval result;
+    if (d_timingWheel_p) {
+        result.addMicroseconds(d_timingWheel_p->tickLength());
+    }
+    return result;
+}
+
                                   // Aspects
 
 inline
@@ -26,6 +26,7 @@
 #include <bslma_testallocatormonitor.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadgroup.h>
@@ -62,6 +63,7 @@
 #include <bsl_set.h>
 #include <bsl_sstream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -110,6 +112,9 @@ using namespace bsl;
 // [ 8] bdlmt::EventScheduler(dispatcher, ident, adapter, alloc = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, id, adapter, alloc = 0);
+// [36] bdlmt::EventScheduler(clockType, tick, alloc = 0);
+// [36] bdlmt::EventScheduler(clockType, tick, id, adapter, alloc = 0);
+// [36] bdlmt::EventScheduler(disp, clockType, tick, id, adapter, alloc = 0);
 //
 // [ 1] ~bdlmt::EventScheduler();
 //
@@ -127,6 +132,8 @@ using namespace bsl;
 //
 // [16] int start(const bslmt::ThreadAttributes& threadAttributes);
 //
+// [37] void setThreadPlacement(const ThreadPlacement& placement);
+//
 // [ 9] void stop();
 //
 // ACCESSORS
@@ -135,6 +142,8 @@ using namespace bsl;
 // [ 9] bool isStarted() const;
 // [23] bsls::TimeInterval now() const;
 // [34] bsls::TimeInterval nextPendingEventTime() const;
+// [37] ThreadPlacement threadPlacement() const;
+// [36] bsls::TimeInterval tickGranularity() const;
 // [24] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -152,6 +161,8 @@ using namespace bsl;
 // [32] CONCERN: `EventData` and `RecurringEventData` are allocator-aware.
 // [33] CONCERN: THREAD NAMES
 // [35] CONCERN: DESTROY THE CALLBACK AFTER EXECUTION
+// [36] TESTING TIMING-WHEEL EVENT QUEUE
+// [-2] PERFORMANCE: SKIP LIST VS. TIMING WHEEL
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1403,6 +1414,115 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 36 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_36 {
+
+/// Load into the specified `result` the current time of the specified
+/// `timeSource`.
+void recordTime(bsls::TimeInterval                         *result,
+                const bdlmt::EventSchedulerTestTimeSource  *timeSource)
+{
+    *result = timeSource->now();
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_36
+
+// ============================================================================
+//                         CASE 37 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_37 {
+
+/// Load into the specified `cpu` and `numaNode` the CPU and NUMA node on
+/// which the calling thread runs, and arrive at the specified `latch`.
+void recordPlacement(int *cpu, int *numaNode, bslmt::Latch *latch)
+{
+    *cpu      = bslmt::ThreadUtil::currentCpu();
+    *numaNode = bslmt::ThreadUtil::currentNumaNode();
+    latch->arrive();
+}
+
+/// Start the specified `scheduler`, dispatch one event, load into the
+/// specified `cpu` and `numaNode` the CPU and NUMA node on which the
+/// dispatcher thread ran that event, and stop `scheduler`.  Return the
+/// status of `start`.
+int observePlacement(Obj *scheduler, int *cpu, int *numaNode)
+{
+    const int rc = scheduler->start();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bslmt::Latch latch(1);
+    scheduler->scheduleEvent(scheduler->now(),
+                             bdlf::BindUtil::bind(&recordPlacement,
+                                                  cpu,
+                                                  numaNode,
+                                                  &latch));
+    latch.wait();
+    scheduler->stop();
+    return 0;
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_37
+
+// ============================================================================
+//                         CASE -2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_MINUS_2 {
+
+/// Schedule the specified `numEvents` one-time events on the specified
+/// `scheduler` at pseudo-random times within the next 30 seconds,
+/// reschedule each of them once, and cancel them all, and print the average
+/// time taken by each kind of operation to `cout`.  Use the specified
+/// `allocator` to supply memory for the event handles.
+void runBenchmark(Obj *scheduler, int numEvents, bslma::Allocator *allocator)
+{
+    bsl::vector<EventHandle> handles(numEvents, allocator);
+
+    const bsls::TimeInterval NOW  = scheduler->now();
+    unsigned int             seed = 12345;
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numEvents; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bsls::TimeInterval time = NOW;
+        time.addMicroseconds((seed >> 8) % 30000000);
+
+        scheduler->scheduleEvent(&handles[i], time, noop);
+    }
+    const double schedule = timer.accumulatedWallTime();
+
+    for (int i = 0; i < numEvents; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bsls::TimeInterval time = NOW;
+        time.addMicroseconds((seed >> 8) % 30000000);
+
+        scheduler->rescheduleEvent(handles[i], time);
+    }
+    const double reschedule = timer.accumulatedWallTime() - schedule;
+
+    for (int i = 0; i < numEvents; ++i) {
+        scheduler->cancelEvent(handles[i]);
+        handles[i].release();
+    }
+    const double cancel = timer.accumulatedWallTime() - schedule - reschedule;
+
+    const double NS = 1e9 / numEvents;
+
+    cout << "schedule "     << schedule   * NS << " ns"
+         << ", reschedule " << reschedule * NS << " ns"
+         << ", cancel "     << cancel     * NS << " ns";
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_MINUS_2
+
 
 // ============================================================================
 //                         CASE 28 RELATED ENTITIES
@@ -2960,6 +3080,385 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        // 1. By default, the scheduler's placement is `ThreadPlacement()`,
+        //    and `setThreadPlacement` sets the value returned by
+        //    `threadPlacement`.
+        //
+        // 2. On Linux, under the `e_COMPACT` policy, the dispatcher thread
+        //    runs on the first CPU of the placement's CPU order.
+        //
+        // 3. On Linux, under the `e_NONE` policy with a NUMA node, the
+        //    dispatcher thread runs on that node.
+        //
+        // 4. On Linux, `start` fails if the placement designates a NUMA node
+        //    that does not exist, leaving the scheduler stopped.
+        //
+        // Plan:
+        // 1. Verify the placement of a newly created scheduler, set a
+        //    placement, and verify it.  (C-1)
+        //
+        // 2. Start schedulers with each placement, dispatch one event, and
+        //    compare the CPU and node observed by the event with those
+        //    expected.  (C-2..3)
+        //
+        // 3. Start a scheduler whose placement names a node beyond the last
+        //    online node, and verify that `start` fails.  (C-4)
+        //
+        // Testing:
+        //   void setThreadPlacement(const ThreadPlacement& placement);
+        //   ThreadPlacement threadPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THREAD PLACEMENT" << endl
+                          << "========================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_37;
+
+        typedef bdlmt::ThreadPlacement Placement;
+
+        bsl::vector<int> nodes;
+        bslmt::CpuTopologyUtil::loadOnlineNumaNodes(&nodes);
+
+        if (verbose) cout << "Setting and getting the placement" << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Placement() == X.threadPlacement());
+
+            const Placement PLACEMENT(Placement::e_SCATTER, nodes.front());
+            mX.setThreadPlacement(PLACEMENT);
+            ASSERT(PLACEMENT == X.threadPlacement());
+        }
+
+        if (verbose) cout << "Compact placement" << endl;
+        {
+            const Placement PLACEMENT(Placement::e_COMPACT);
+
+            bsl::vector<int> order;
+            PLACEMENT.loadCpuOrder(&order);
+            ASSERT(!order.empty());
+
+            Obj mX(&ta);
+            mX.setThreadPlacement(PLACEMENT);
+
+            int cpu  = -2;
+            int node = -2;
+            ASSERT(0 == observePlacement(&mX, &cpu, &node));
+            ASSERT(-2 != cpu);
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(order.front(), cpu, order.front() == cpu);
+#endif
+        }
+
+        if (verbose) cout << "Restricting the thread to a NUMA node" << endl;
+        {
+            const int NODE = nodes.back();
+
+            Obj mX(&ta);
+            mX.setThreadPlacement(Placement(Placement::e_NONE, NODE));
+
+            int cpu  = -2;
+            int node = -2;
+            ASSERT(0 == observePlacement(&mX, &cpu, &node));
+            ASSERT(-2 != node);
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(NODE, node, NODE == node);
+#endif
+        }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        if (verbose) cout << "Nonexistent NUMA node" << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.setThreadPlacement(Placement(Placement::e_COMPACT,
+                                            nodes.back() + 1));
+
+            ASSERT(0 != mX.start());
+            ASSERT(!X.isStarted());
+        }
+#endif
+      } break;
+      case 36: {
+        // --------------------------------------------------------------------
+        // TESTING TIMING-WHEEL EVENT QUEUE
+        //
+        // Concerns:
+        // 1. `tickGranularity` returns the value supplied at construction,
+        //    and 0 for a scheduler using the default event queue.
+        //
+        // 2. `numEvents` and `nextPendingEventTime` reflect the one-time
+        //    events scheduled, rescheduled, and cancelled, including events
+        //    in the past and events beyond the span of the wheel.
+        //
+        // 3. A one-time event is never dispatched before its scheduled time,
+        //    and is dispatched once the first tick boundary at or after its
+        //    scheduled time is reached.
+        //
+        // 4. Cancelled events are not dispatched, and rescheduled events are
+        //    dispatched at their new time.
+        //
+        // 5. `cancelAllEvents` removes all one-time events, and all memory
+        //    is supplied by the object allocator and released.
+        //
+        // Plan:
+        // 1. Create schedulers with each of the new constructors and verify
+        //    the value returned by `tickGranularity`.  (C-1)
+        //
+        // 2. Without starting a scheduler, schedule, reschedule, and cancel
+        //    events at a range of times spanning every level of the wheel as
+        //    well as the past and the overflow list, and verify `numEvents`
+        //    and `nextPendingEventTime` after each operation.  (C-2)
+        //
+        // 3. Using a test time source, schedule events at unaligned times in
+        //    a permuted order, cancel and reschedule some of them, then
+        //    advance the time to just before, and then to the tick boundary
+        //    at or after, each scheduled time and verify whether and when
+        //    each event was dispatched.  (C-3,4)
+        //
+        // 4. Verify that `cancelAllEvents` empties the queue, and use a test
+        //    allocator to verify that all memory is released.  (C-5)
+        //
+        // Testing:
+        //   bdlmt::EventScheduler(clockType, tick, alloc = 0);
+        //   bdlmt::EventScheduler(clockType, tick, id, adapter, alloc = 0);
+        //   bdlmt::EventScheduler(disp, clockType, tick, id, adapter, a = 0);
+        //   bsls::TimeInterval tickGranularity() const;
+        //   TESTING TIMING-WHEEL EVENT QUEUE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMING-WHEEL EVENT QUEUE" << endl
+                          << "================================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_36;
+
+        const bsls::TimeInterval TICK(0, 1000000);  // 1 millisecond
+        const bsls::TimeInterval US(0, 1000);       // 1 microsecond
+        const bsls::TimeInterval NONE =
+                                bsls::TimeInterval(INT64_MAX / 1000000,
+                                                   INT64_MAX % 1000000 * 1000);
+
+        if (verbose) cout << "\tTesting `tickGranularity`." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(bsls::TimeInterval() == mX.tickGranularity());
+
+            Obj mY(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+            ASSERT(TICK == mY.tickGranularity());
+            ASSERT(bsls::SystemClockType::e_MONOTONIC == mY.clockType());
+            ASSERT(&ta  == mY.allocator());
+
+            bdlm::MetricsRegistry registry(&ta);
+
+            Obj mZ(bsls::SystemClockType::e_REALTIME,
+                   US,
+                   "a",
+                   &registry,
+                   &ta);
+            ASSERT(US == mZ.tickGranularity());
+            ASSERT(bsls::SystemClockType::e_REALTIME == mZ.clockType());
+
+            Obj mW(&dispatcherFunction,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   bsls::TimeInterval(1),
+                   "b",
+                   &registry,
+                   &ta);
+            ASSERT(bsls::TimeInterval(1) == mW.tickGranularity());
+        }
+
+        if (verbose) cout << "\tTesting queue operations." << endl;
+        {
+            Obj                                 mX(
+                                            bsls::SystemClockType::e_MONOTONIC,
+                                            TICK,
+                                            &ta);
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            if (timeSource.now().nanoseconds() % 1000) {
+                timeSource.advanceTime(bsls::TimeInterval(
+                               0,
+                               1000 - timeSource.now().nanoseconds() % 1000));
+            }
+
+            const bsls::TimeInterval NOW = mX.now();
+
+            // The wheel spans `64 ** 6` ticks (about 795 days); the last
+            // offset is beyond that span.
+
+            const double OFFSETS[] = { 0.0003, 0.05, 3.0, 300.0, 20000.0,
+                                       2592000.0, 172800000.0 };
+            enum { k_NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS };
+
+            EventHandle handles[k_NUM_OFFSETS];
+
+            for (int i = k_NUM_OFFSETS - 1; 0 <= i; --i) {
+                const bsls::TimeInterval T = NOW + OFFSETS[i];
+
+                mX.scheduleEvent(&handles[i], T, noop);
+
+                ASSERTV(i, k_NUM_OFFSETS - i == mX.numEvents());
+                ASSERTV(i, T == mX.nextPendingEventTime());
+            }
+
+            for (int i = 0; i < k_NUM_OFFSETS - 1; ++i) {
+                ASSERTV(i, 0 == mX.cancelEvent(handles[i]));
+                ASSERTV(i, 0 != mX.cancelEvent(handles[i]));
+
+                ASSERTV(i, k_NUM_OFFSETS - i - 1 == mX.numEvents());
+                ASSERTV(i, NOW + OFFSETS[i + 1] == mX.nextPendingEventTime());
+            }
+
+            // Move the overflow event through every level of the wheel.
+
+            EventHandle& far = handles[k_NUM_OFFSETS - 1];
+            for (int i = k_NUM_OFFSETS - 1; 0 <= i; --i) {
+                const bsls::TimeInterval T = NOW + OFFSETS[i];
+
+                ASSERTV(i, 0 == mX.rescheduleEvent(far, T));
+                ASSERTV(i, 1 == mX.numEvents());
+                ASSERTV(i, T == mX.nextPendingEventTime());
+            }
+
+            // An event in the past is due immediately.
+
+            EventHandle past;
+            mX.scheduleEvent(&past, NOW - bsls::TimeInterval(5), noop);
+            ASSERT(2 == mX.numEvents());
+            ASSERT(NOW >= mX.nextPendingEventTime());
+
+            ASSERT(0 == mX.cancelEvent(past));
+            ASSERT(NOW + OFFSETS[0] == mX.nextPendingEventTime());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.scheduleEvent(NOW + bsls::TimeInterval(i % 97), noop);
+            }
+            ASSERT(1001 == mX.numEvents());
+
+            mX.cancelAllEvents();
+
+            ASSERT(0    == mX.numEvents());
+            ASSERT(NONE == mX.nextPendingEventTime());
+            ASSERT(0    != mX.cancelEvent(far));
+        }
+
+        if (verbose) cout << "\tTesting dispatch times." << endl;
+        {
+            Obj                                 mX(
+                                            bsls::SystemClockType::e_MONOTONIC,
+                                            TICK,
+                                            &ta);
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            // Align the time source to a microsecond so that all times below
+            // are exact.
+
+            if (timeSource.now().nanoseconds() % 1000) {
+                timeSource.advanceTime(bsls::TimeInterval(
+                               0,
+                               1000 - timeSource.now().nanoseconds() % 1000));
+            }
+
+            const bsls::TimeInterval START = mX.now();
+
+            enum { k_NUM_EVENTS = 200 };
+
+            bsls::TimeInterval scheduled[k_NUM_EVENTS];
+            bsls::TimeInterval fired[k_NUM_EVENTS];
+            EventHandle        handles[k_NUM_EVENTS];
+
+            // Event `i` is scheduled `37 * i * i` milliseconds (plus a
+            // fraction of a tick) after `START`, spanning four levels of the
+            // wheel; the events are scheduled in a permuted order.
+
+            for (int j = 0; j < k_NUM_EVENTS; ++j) {
+                const int i = j * 71 % k_NUM_EVENTS;
+
+                scheduled[i] = START;
+                scheduled[i].addMilliseconds(37LL * i * i);
+                scheduled[i].addMicroseconds(300 + j);
+
+                const bsls::TimeInterval T = 2 == i % 5
+                                           ? START + bsls::TimeInterval(86400)
+                                           : scheduled[i];
+
+                mX.scheduleEvent(&handles[i],
+                                 T,
+                                 bdlf::BindUtil::bind(&recordTime,
+                                                      &fired[i],
+                                                      &timeSource));
+            }
+
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                if (2 == i % 5) {
+                    ASSERTV(i, 0 == mX.rescheduleEvent(handles[i],
+                                                       scheduled[i]));
+                }
+                else if (4 == i % 5) {
+                    ASSERTV(i, 0 == mX.cancelEvent(handles[i]));
+                }
+            }
+
+            ASSERT(k_NUM_EVENTS - k_NUM_EVENTS / 5 == mX.numEvents());
+
+            bsls::TimeInterval farFired;
+            const bsls::TimeInterval FAR = START + bsls::TimeInterval(2000 *
+                                                                     86400);
+            mX.scheduleEvent(FAR,
+                             bdlf::BindUtil::bind(&recordTime,
+                                                  &farFired,
+                                                  &timeSource));
+
+            ASSERT(0 == mX.start());
+
+            const bsls::Types::Int64 TICK_US = TICK.totalMicroseconds();
+
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                const bsls::TimeInterval& T = scheduled[i];
+
+                timeSource.advanceTime(T - US - timeSource.now());
+
+                ASSERTV(i, bsls::TimeInterval() == fired[i]);
+
+                bsls::Types::Int64 boundaryUs = T.totalMicroseconds()
+                                              + TICK_US - 1;
+                boundaryUs -= boundaryUs % TICK_US;
+
+                bsls::TimeInterval boundary;
+                boundary.addMicroseconds(boundaryUs);
+
+                timeSource.advanceTime(boundary - timeSource.now());
+
+                if (4 == i % 5) {
+                    ASSERTV(i, bsls::TimeInterval() == fired[i]);
+                }
+                else {
+                    ASSERTV(i, T, fired[i], boundary == fired[i]);
+                    ASSERTV(i, 0 != mX.cancelEvent(handles[i]));
+                }
+            }
+
+            ASSERT(1 == mX.numEvents());
+            ASSERT(FAR == mX.nextPendingEventTime());
+
+            timeSource.advanceTime(FAR - US - timeSource.now());
+            ASSERT(bsls::TimeInterval() == farFired);
+
+            timeSource.advanceTime(TICK);
+            ASSERT(FAR < farFired);
+            ASSERT(0 == mX.numEvents());
+
+            mX.stop();
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 35: {
         // --------------------------------------------------------------------
         // TESTING CONCERN: DESTROY THE CALLBACK AFTER EXECUTION
@@ -8440,6 +8939,55 @@ int main(int argc, char *argv[])
             x.cancelAllEvents();
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SKIP LIST VS. TIMING WHEEL
+        //
+        // Concerns:
+        // 1. Scheduling, rescheduling, and cancelling one-time events is
+        //    cheaper with the timing wheel than with the default skip list
+        //    when many events are pending.
+        //
+        // Plan:
+        // 1. For each kind of event queue, schedule a number of events
+        //    (optionally specified as the second argument, 1000000 by
+        //    default) at pseudo-random times within the next 30 seconds,
+        //    reschedule each of them once, and cancel them all, reporting the
+        //    average time of each operation.  The scheduler is not started.
+        //
+        // Testing:
+        //   PERFORMANCE: SKIP LIST VS. TIMING WHEEL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SKIP LIST VS. TIMING WHEEL" << endl
+                          << "=======================================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_MINUS_2;
+
+        const int numEvents = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, &oa);
+
+            cout << "skip list:    ";
+            runBenchmark(&mX, numEvents, &ta);
+            cout << ", memory " << oa.numBytesMax() << " bytes" << endl;
+        }
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(bsls::SystemClockType::e_MONOTONIC,
+                   bsls::TimeInterval(0, 1000000),
+                   &oa);
+
+            cout << "timing wheel: ";
+            runBenchmark(&mX, numEvents, &ta);
+            cout << ", memory " << oa.numBytesMax() << " bytes" << endl;
+        }
+      } break;
       case -100: {
         // --------------------------------------------------------------------
         // The router simulation (kind of) test
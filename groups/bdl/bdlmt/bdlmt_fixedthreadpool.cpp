@@ -16,8 +16,10 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 #include <bsls_platform.h>
 #include <bsls_timeutil.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
 #include <bsl_c_signal.h>              // sigfillset
@@ -152,7 +154,8 @@ void FixedThreadPool::workerThread()
     } while (d_drainFlag);
 }
 
-int FixedThreadPool::startNewThread()
+int FixedThreadPool::startNewThread(
+                                    const bslmt::ThreadAttributes& attributes)
 {
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Block all asynchronous signals.
@@ -164,7 +167,7 @@ int FixedThreadPool::startNewThread()
     bsl::function<void()> workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
 
-    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    int rc = d_threadGroup.addThread(workerThreadFunc, attributes);
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask.
@@ -274,8 +277,26 @@ int FixedThreadPool::start()
         return 0;                                                     // RETURN
     }
 
+    bsl::vector<int> cpus(d_threadAttributes.allocator());
+    d_threadPlacement.loadCpuOrder(&cpus);
+
+    bslmt::ThreadAttributes attributes(d_threadAttributes,
+                                       d_threadAttributes.allocator());
+    if (ThreadPlacement::e_ANY_NUMA_NODE != d_threadPlacement.numaNode()) {
+        attributes.setNumaNode(d_threadPlacement.numaNode());
+    }
+    else if (ThreadPlacement::e_NONE != d_threadPlacement.policy()) {
+        attributes.setNumaNode(bslmt::ThreadAttributes::e_UNSET_NUMA_NODE);
+    }
+
+    bsl::vector<int> affinity(1, 0, d_threadAttributes.allocator());
     for (int i = 0; i < d_numThreads; ++i)  {
-        if (0 != startNewThread()) {
+        if (!cpus.empty()) {
+            affinity[0] = cpus[i % cpus.size()];
+            attributes.setCpuAffinity(affinity);
+        }
+
+        if (0 != startNewThread(attributes)) {
             // Submit a sufficient number of arrivals to the barrier to release
             // all threads ('d_numThreads + 1');
 
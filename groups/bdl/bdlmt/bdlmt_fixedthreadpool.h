@@ -23,7 +23,7 @@ BSLS_IDENT("$Id: $")
 //  * object type name: "bdlmt.fixedthreadpool"
 //  * object type abbreviation: "ftp"
 //
-//@SEE_ALSO: bdlmt_threadpool
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_threadplacement
 //
 //@DESCRIPTION: This component defines a portable and efficient implementation
 // of a thread pool, `bdlmt::FixedThreadPool`, that can be used to distribute
@@ -105,6 +105,22 @@ BSLS_IDENT("$Id: $")
 // `threadName` attribute is not set, the default value "bdl.FixedPool" will be
 // used.
 //
+///Thread Placement
+///----------------
+// The threads of a pool can be bound to CPUs of the host by supplying a
+// `bdlmt::ThreadPlacement` to `setThreadPlacement` before calling `start`.
+// Under the `e_COMPACT` and `e_SCATTER` policies, the thread having index `i`
+// is bound to the single CPU at index `i` (modulo the number of CPUs) of the
+// order described by `bdlmt::ThreadPlacement::loadCpuOrder`; under the
+// `e_NONE` policy, every thread is restricted to the placement's NUMA node,
+// if any.  For example, a pool having `placement.numCores()` threads and the
+// placement `bdlmt::ThreadPlacement(bdlmt::ThreadPlacement::e_COMPACT, n)`
+// runs one thread on each physical core of NUMA node `n`.  A placement having
+// a NUMA node replaces the `numaNode` attribute of the
+// `bslmt::ThreadAttributes` supplied at construction, and the `e_COMPACT` and
+// `e_SCATTER` policies replace both its `numaNode` and `cpuAffinity`
+// attributes.  Note that, at this time, placement is honored only on Linux.
+//
 ///Usage
 ///-----
 // This example demonstrates the use of a `bdlmt::FixedThreadPool` to
@@ -319,6 +335,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlm_metricsregistry.h>
 
+#include <bdlmt_threadplacement.h>
+
 #include <bsla_deprecated.h>
 
 #include <bslma_allocator.h>
@@ -410,7 +428,7 @@ class FixedThreadPool {
     bslmt::Barrier          d_barrier;            // barrier to sync threads
                                                   // during `start` and `drain`
 
-    bslmt::Mutex            d_metaMutex;          // mutex to ensure that there
+    mutable bslmt::Mutex    d_metaMutex;          // mutex to ensure that there
                                                   // is only one controlling
                                                   // thread at any time
 
@@ -423,6 +441,10 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    ThreadPlacement         d_threadPlacement;    // placement of processing
+                                                  // threads on CPUs, applied
+                                                  // by `start`
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -448,10 +470,10 @@ class FixedThreadPool {
     /// The main function executed by each worker thread.
     void workerThread();
 
-    /// Internal method to spawn a new processing thread and increment the
-    /// current count.  Note that this method must be called with
-    /// `d_metaMutex` locked.
-    int startNewThread();
+    /// Internal method to spawn a new processing thread having the specified
+    /// `attributes` and increment the current count.  Note that this method
+    /// must be called with `d_metaMutex` locked.
+    int startNewThread(const bslmt::ThreadAttributes& attributes);
 
     // NOT IMPLEMENTED
     FixedThreadPool(const FixedThreadPool&);
@@ -609,11 +631,19 @@ class FixedThreadPool {
     /// method, `false == isStarted()`.
     void shutdown();
 
-    /// Spawn threads until there are `numThreads()` processing threads.  On
+    /// Set the placement of the processing threads of this thread pool on
+    /// CPUs to the specified `placement` (see {Thread Placement}).  The
+    /// placement takes effect the next time the pool is started; threads
+    /// that are already running are not affected.
+    void setThreadPlacement(const ThreadPlacement& placement);
+
+    /// Spawn threads until there are `numThreads()` processing threads,
+    /// placing them on CPUs as described by `threadPlacement()`.  On
     /// success, enable enqueuing and return 0.  Otherwise, join all threads
     /// (ensuring `false == isStarted()`) and return -1.  If the thread pool
     /// was already started (`isStarted()` is `true`), this method has no
-    /// effect.
+    /// effect.  Note that, on Linux, starting fails if the placement
+    /// designates a NUMA node having no online CPU.
     int start();
 
     /// Disable enqueuing jobs on this thread pool, wait until all active
@@ -653,6 +683,10 @@ class FixedThreadPool {
     /// Return the capacity of the queue used to enqueue jobs by this thread
     /// pool.
     int queueCapacity() const;
+
+    /// Return the placement of the processing threads of this thread pool
+    /// on CPUs.
+    ThreadPlacement threadPlacement() const;
 };
 
 // ============================================================================
@@ -757,6 +791,14 @@ void FixedThreadPool::shutdown()
     }
 }
 
+inline
+void FixedThreadPool::setThreadPlacement(const ThreadPlacement& placement)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    d_threadPlacement = placement;
+}
+
 inline
 void FixedThreadPool::stop()
 {
@@ -813,6 +855,14 @@ int FixedThreadPool::queueCapacity() const
     return static_cast<int>(d_queue.capacity());
 }
 
+inline
+ThreadPlacement FixedThreadPool::threadPlacement() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    return d_threadPlacement;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -14,6 +14,7 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_testutil.h>
 #include <bslmt_threadutil.h>
@@ -97,6 +98,8 @@ using bsl::flush;
 // [ 4] int queueCapacity() const;
 // [ 4] int numThreadsStarted() const;
 // [ 5] int tryEnqueueJob(FixedThreadPoolJobFunc, void *);
+// [21] void setThreadPlacement(const ThreadPlacement&);
+// [21] ThreadPlacement threadPlacement() const;
 // ----------------------------------------------------------------------------
 // [ 2] TESTING HELPER FUNCTIONS
 // [ 2] Breathing test
@@ -110,6 +113,7 @@ using bsl::flush;
 // [18] DRQS 167232024: `drain` FAILS TO WAIT FOR ALL JOBS TO FINISH
 // [19] CONCERN: POOL OBJECT CAN OUTLIVE USED `MetricsRegistry`
 // [20] THREAD NAMES
+// [21] THREAD PLACEMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -366,6 +370,66 @@ void threadNameCheckJob(void *arg)
 
 }  // close namespace THREAD_NAMES_TEST
 
+// ============================================================================
+//                          CASE 21 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace THREAD_PLACEMENT_TEST {
+
+/// This `struct` collects the CPUs and NUMA nodes on which the jobs of a
+/// pool run.
+struct Observations {
+    bslmt::Barrier   d_barrier;   // holds each thread until all run a job
+    bslmt::Mutex     d_mutex;     // protects the vectors below
+    bsl::vector<int> d_cpus;      // CPUs observed
+    bsl::vector<int> d_numaNodes; // NUMA nodes observed
+
+    explicit Observations(int numThreads)
+    : d_barrier(numThreads)
+    {
+    }
+};
+
+/// Record the current CPU and NUMA node in the specified `observations`,
+/// then wait on its barrier so that no thread of the pool runs more than one
+/// job.
+void observePlacementJob(Observations *observations)
+{
+    const int cpu  = bslmt::ThreadUtil::currentCpu();
+    const int node = bslmt::ThreadUtil::currentNumaNode();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&observations->d_mutex);
+
+        observations->d_cpus.push_back(cpu);
+        observations->d_numaNodes.push_back(node);
+    }
+    observations->d_barrier.wait();
+}
+
+/// Start the specified `pool` having the specified `numThreads` threads, run
+/// one job on each thread, load the CPUs and NUMA nodes observed into the
+/// specified `observations`, and stop the pool.  Return the status of
+/// `start`.
+int runObservations(Obj *pool, Observations *observations, int numThreads)
+{
+    const int rc = pool->start();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(
+                                                       &observePlacementJob,
+                                                       observations)));
+    }
+    pool->stop();
+
+    bsl::sort(observations->d_cpus.begin(), observations->d_cpus.end());
+    return 0;
+}
+
+}  // close namespace THREAD_PLACEMENT_TEST
+
 /// This function does nothing.
 void noop(void *)
 {
@@ -1114,6 +1178,128 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        // 1. By default, the pool's placement is `ThreadPlacement()`, and
+        //    `setThreadPlacement` sets the value returned by
+        //    `threadPlacement`.
+        //
+        // 2. On Linux, under the `e_COMPACT` policy, thread `i` runs on the
+        //    CPU at index `i` (modulo the number of CPUs) of the placement's
+        //    CPU order.
+        //
+        // 3. On Linux, under the `e_NONE` policy with a NUMA node, every
+        //    thread runs on that node.
+        //
+        // 4. On Linux, `start` fails if the placement designates a NUMA node
+        //    that does not exist, leaving the pool stopped.
+        //
+        // Plan:
+        // 1. Verify the placement of a newly created pool, set a placement,
+        //    and verify it.  (C-1)
+        //
+        // 2. Start pools with each placement, run one job per thread, and
+        //    compare the observed CPUs and nodes with those expected.
+        //    (C-2..3)
+        //
+        // 3. Start a pool whose placement names a node beyond the last
+        //    online node, and verify that `start` fails.  (C-4)
+        //
+        // Testing:
+        //   void setThreadPlacement(const ThreadPlacement&);
+        //   ThreadPlacement threadPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING THREAD PLACEMENT\n"
+                             "========================\n";
+
+        namespace TC = THREAD_PLACEMENT_TEST;
+
+        typedef bdlmt::ThreadPlacement Placement;
+
+        const int k_NUM_THREADS = 3;
+
+        bsl::vector<int> nodes;
+        bslmt::CpuTopologyUtil::loadOnlineNumaNodes(&nodes);
+
+        if (verbose) cout << "Setting and getting the placement\n";
+        {
+            Obj mX(k_NUM_THREADS, 10, &testAllocator);  const Obj& X = mX;
+
+            ASSERT(Placement() == X.threadPlacement());
+
+            const Placement PLACEMENT(Placement::e_SCATTER, nodes.front());
+            mX.setThreadPlacement(PLACEMENT);
+            ASSERT(PLACEMENT == X.threadPlacement());
+        }
+
+        if (verbose) cout << "Compact placement\n";
+        {
+            const Placement PLACEMENT(Placement::e_COMPACT);
+
+            bsl::vector<int> order;
+            PLACEMENT.loadCpuOrder(&order);
+            ASSERT(!order.empty());
+
+            bsl::vector<int> expected;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                expected.push_back(order[i % order.size()]);
+            }
+            bsl::sort(expected.begin(), expected.end());
+
+            Obj mX(k_NUM_THREADS, 10, &testAllocator);
+            mX.setThreadPlacement(PLACEMENT);
+
+            TC::Observations observations(k_NUM_THREADS);
+            ASSERT(0 == TC::runObservations(&mX,
+                                            &observations,
+                                            k_NUM_THREADS));
+
+            ASSERT(k_NUM_THREADS ==
+                             static_cast<int>(observations.d_cpus.size()));
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(expected == observations.d_cpus);
+#endif
+        }
+
+        if (verbose) cout << "Restricting threads to a NUMA node\n";
+        {
+            const int NODE = nodes.back();
+
+            Obj mX(k_NUM_THREADS, 10, &testAllocator);
+            mX.setThreadPlacement(Placement(Placement::e_NONE, NODE));
+
+            TC::Observations observations(k_NUM_THREADS);
+            ASSERT(0 == TC::runObservations(&mX,
+                                            &observations,
+                                            k_NUM_THREADS));
+
+            for (bsl::size_t i = 0; i < observations.d_numaNodes.size(); ++i) {
+                const int OBSERVED = observations.d_numaNodes[i];
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                ASSERTV(NODE, OBSERVED, NODE == OBSERVED);
+#else
+                (void)OBSERVED;
+#endif
+            }
+        }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        if (verbose) cout << "Nonexistent NUMA node\n";
+        {
+            Obj mX(k_NUM_THREADS, 10, &testAllocator);  const Obj& X = mX;
+            mX.setThreadPlacement(Placement(Placement::e_COMPACT,
+                                            nodes.back() + 1));
+
+            ASSERT(0 != mX.start());
+            ASSERT(!X.isStarted());
+            ASSERT(0 == X.numThreadsStarted());
+        }
+#endif
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING THREAD NAMES
@@ -7,6 +7,11 @@ BSLS_IDENT_RCSID(bdlmt_multiqueuethreadpool_cpp,"$Id$ $CSID$")
 
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
 
 #include <bslma_default.h>
 
@@ -20,6 +25,7 @@ BSLS_IDENT_RCSID(bdlmt_multiqueuethreadpool_cpp,"$Id$ $CSID$")
 #include <bsls_stackaddressutil.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_memory.h>
@@ -127,6 +133,42 @@ void MultiQueueThreadPool_Queue::setPaused()
     }
 }
 
+int MultiQueueThreadPool_Queue::schedule()
+{
+    BSLMT_MUTEXASSERT_IS_LOCKED(&d_lock);
+
+    if (d_isMeasuring) {
+        d_scheduleTime = bsls::TimeUtil::getTimer();
+    }
+
+    return d_multiQueueThreadPool_p->d_threadPool_p->enqueueJob(
+                                                               d_processingCb);
+}
+
+void MultiQueueThreadPool_Queue::collectBacklog(bdlm::Metric *value)
+{
+    *value = bdlm::Metric::Gauge(length());
+}
+
+void MultiQueueThreadPool_Queue::collectStartLag(bdlm::Metric *value)
+{
+    bsls::Types::Int64 totalStartLag;
+    bsls::Types::Int64 numStarts;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+        totalStartLag   = d_totalStartLag;
+        numStarts       = d_numStarts;
+        d_totalStartLag = 0;
+        d_numStarts     = 0;
+    }
+
+    *value = bdlm::Metric::Gauge(
+                    numStarts
+                    ? static_cast<double>(totalStartLag) / 1.0e9 / numStarts
+                    : 0.0);
+}
+
 // CREATORS
 MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
                                     MultiQueueThreadPool *multiQueueThreadPool,
@@ -137,6 +179,8 @@ MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
 , d_runState(e_NOT_SCHEDULED)
 , d_batch(basicAllocator)
 , d_batchSize(1)
+, d_batchTimeLimit(0)
+, d_weight(1)
 , d_lock()
 , d_pauseCondition()
 , d_pauseCount(0)
@@ -144,6 +188,10 @@ MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
                                      &MultiQueueThreadPool_Queue::executeFront,
                                      this))
 , d_processor(bslmt::ThreadUtil::invalidHandle())
+, d_isMeasuring(false)
+, d_scheduleTime(0)
+, d_totalStartLag(0)
+, d_numStarts(0)
 {
     d_batch.reserve(d_batchSize);
 }
@@ -163,6 +211,24 @@ void MultiQueueThreadPool_Queue::setBatchSize(int batchSize)
     d_batch.reserve(d_batchSize);
 }
 
+void MultiQueueThreadPool_Queue::setBatchTimeLimit(int microseconds)
+{
+    BSLS_ASSERT(0 <= microseconds);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    d_batchTimeLimit = microseconds;
+}
+
+void MultiQueueThreadPool_Queue::setWeight(int weight)
+{
+    BSLS_ASSERT(1 <= weight);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    d_weight = weight;
+}
+
 int MultiQueueThreadPool_Queue::enable()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
@@ -221,11 +287,20 @@ void MultiQueueThreadPool_Queue::drainWaitWhilePausing()
 
 void MultiQueueThreadPool_Queue::executeFront()
 {
+    bsls::Types::Int64 timeLimit = 0;  // nanoseconds, or 0 for no limit
+    bsls::Types::Int64 startTime = 0;
+
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
         BSLS_ASSERT(!d_list.empty());
 
+        if (d_isMeasuring) {
+            startTime        = bsls::TimeUtil::getTimer();
+            d_totalStartLag += startTime - d_scheduleTime;
+            ++d_numStarts;
+        }
+
         if (e_PAUSING == d_runState) {
             setPaused();
 
@@ -239,8 +314,17 @@ void MultiQueueThreadPool_Queue::executeFront()
         bsl::size_t count;
 
         if (e_DELETING != d_enqueueState) {
-            count = bsl::min(static_cast<bsl::size_t>(d_batchSize),
-                             d_list.size());
+            // Note that the weight scales the batch size and time limit (see
+            // {Queue Weights}); the product of the batch size and weight is
+            // computed in 64 bits to avoid overflow.
+
+            count = static_cast<bsl::size_t>(bsl::min(
+                      static_cast<bsls::Types::Uint64>(d_batchSize) * d_weight,
+                      static_cast<bsls::Types::Uint64>(d_list.size())));
+
+            timeLimit = static_cast<bsls::Types::Int64>(d_batchTimeLimit)
+                      * 1000
+                      * d_weight;
 
             d_multiQueueThreadPool_p->d_numExecuted += static_cast<int>(count);
         }
@@ -263,12 +347,51 @@ void MultiQueueThreadPool_Queue::executeFront()
     // creating a new state to reflect this situation while the 'd_batch' are
     // executing, we leave 'd_runState' as 'e_SCHEDULED'.
 
+    if (timeLimit && 0 == startTime) {
+        startTime = bsls::TimeUtil::getTimer();
+    }
+
     {
         MultiQueueThreadPool_ClearGuard<bsl::vector<Job> > guard(&d_batch);
 
-        for (bsl::size_t i = 0; i < d_batch.size(); ++i) {
-            d_batch[i]();
-            d_batch[i] = Job();
+        bsl::size_t numStarted = 0;
+
+        while (numStarted < d_batch.size()) {
+            d_batch[numStarted]();
+            d_batch[numStarted] = Job();
+            ++numStarted;
+
+            if (timeLimit
+             && numStarted < d_batch.size()
+             && bsls::TimeUtil::getTimer() - startTime >= timeLimit) {
+                break;
+            }
+        }
+
+        if (numStarted < d_batch.size()) {
+            // The time limit expired: return the jobs not started to the
+            // front of the queue, in order, unless the queue was deleted
+            // while the batch was executing, in which case they are deleted
+            // along with the remainder of the queue.  Note that no thread can
+            // start processing this queue before the 'd_runState' is examined
+            // below, so the returned jobs cannot be executed out of order.
+
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_lock);
+
+            const int numReturned =
+                              static_cast<int>(d_batch.size() - numStarted);
+
+            d_multiQueueThreadPool_p->d_numExecuted -= numReturned;
+
+            if (e_DELETING == d_enqueueState) {
+                d_multiQueueThreadPool_p->d_numDeleted += numReturned;
+            }
+            else {
+                for (bsl::size_t i = d_batch.size(); i > numStarted; --i) {
+                    d_list.push_front(
+                              bslmf::MovableRefUtil::move(d_batch[i - 1]));
+                }
+            }
         }
     }
 
@@ -287,8 +410,7 @@ void MultiQueueThreadPool_Queue::executeFront()
 
         if (e_SCHEDULED == d_runState) {
             if (!d_list.empty()) {
-                int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+                int status = schedule();
 
                 BSLS_ASSERT_OPT(0 == status);  (void)status;
             }
@@ -386,8 +508,7 @@ int MultiQueueThreadPool_Queue::pushBack(bslmf::MovableRef<Job> functor)
 
             ++d_multiQueueThreadPool_p->d_numActiveQueues;
 
-            const int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+            const int status = schedule();
 
             BSLS_ASSERT_OPT(0 == status);  (void)status;
         }
@@ -413,8 +534,7 @@ int MultiQueueThreadPool_Queue::pushFront(bslmf::MovableRef<Job> functor)
 
             ++d_multiQueueThreadPool_p->d_numActiveQueues;
 
-            const int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+            const int status = schedule();
 
             BSLS_ASSERT_OPT(0 == status);  (void)status;
         }
@@ -425,14 +545,71 @@ int MultiQueueThreadPool_Queue::pushFront(bslmf::MovableRef<Job> functor)
     return 1;
 }
 
+void MultiQueueThreadPool_Queue::registerMetrics(
+                                      bdlm::MetricsRegistry   *metricsRegistry,
+                                      const bsl::string_view&  queueName)
+{
+    BSLS_ASSERT(metricsRegistry);
+
+    bdlm::InstanceCount::Value instanceNumber =
+         bdlm::InstanceCount::nextInstanceNumber<MultiQueueThreadPool_Queue>();
+
+    bdlm::MetricDescriptor backlog(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.backlog",
+             instanceNumber,
+             "bdlmt.multiqueuethreadpool",
+             "mqtp",
+             queueName);
+
+    metricsRegistry->registerCollectionCallback(
+                   &d_backlogHandle,
+                   backlog,
+                   bdlf::BindUtil::bind(
+                                 &MultiQueueThreadPool_Queue::collectBacklog,
+                                 this,
+                                 bdlf::PlaceHolders::_1));
+
+    bdlm::MetricDescriptor startLag(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.startlag",
+             instanceNumber,
+             "bdlmt.multiqueuethreadpool",
+             "mqtp",
+             queueName);
+
+    metricsRegistry->registerCollectionCallback(
+                   &d_startLagHandle,
+                   startLag,
+                   bdlf::BindUtil::bind(
+                                 &MultiQueueThreadPool_Queue::collectStartLag,
+                                 this,
+                                 bdlf::PlaceHolders::_1));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    d_isMeasuring   = true;
+    d_scheduleTime  = bsls::TimeUtil::getTimer();
+    d_totalStartLag = 0;
+    d_numStarts     = 0;
+}
+
 void MultiQueueThreadPool_Queue::reset()
 {
-    d_list.clear();
-    d_enqueueState = e_ENQUEUING_ENABLED;
-    d_runState     = e_NOT_SCHEDULED;
-    d_pauseCount   = 0;
-    d_processor    = bslmt::ThreadUtil::invalidHandle();
+    d_backlogHandle.unregister();
+    d_startLagHandle.unregister();
 
+    d_list.clear();
+    d_enqueueState   = e_ENQUEUING_ENABLED;
+    d_runState       = e_NOT_SCHEDULED;
+    d_batchSize      = 1;
+    d_batchTimeLimit = 0;
+    d_weight         = 1;
+    d_pauseCount     = 0;
+    d_processor      = bslmt::ThreadUtil::invalidHandle();
+    d_isMeasuring    = false;
+    d_totalStartLag  = 0;
+    d_numStarts      = 0;
 }
 
 int MultiQueueThreadPool_Queue::resume()
@@ -462,8 +639,7 @@ int MultiQueueThreadPool_Queue::resume()
     if (!d_list.empty()) {
         ++d_multiQueueThreadPool_p->d_numActiveQueues;
 
-        int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+        int status = schedule();
 
         if (0 != status) {
             --d_multiQueueThreadPool_p->d_numActiveQueues;
@@ -555,6 +731,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(
 , d_numExecuted(0)
 , d_numEnqueued(0)
 , d_numDeleted(0)
+, d_metricsRegistry_p(0)
 {
     if (threadAttributes.threadName().empty()) {
         bslmt::ThreadAttributes modAttr(threadAttributes);  // name is empty,
@@ -577,6 +754,56 @@ MultiQueueThreadPool::MultiQueueThreadPool(
     }
 }
 
+MultiQueueThreadPool::MultiQueueThreadPool(
+                              const bslmt::ThreadAttributes&  threadAttributes,
+                              int                             minThreads,
+                              int                             maxThreads,
+                              int                             maxIdleTime,
+                              const bsl::string_view&         threadPoolName,
+                              bdlm::MetricsRegistry          *metricsRegistry,
+                              bslma::Allocator               *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadPoolIsOwned(true)
+, d_queuePool(bdlf::BindUtil::bind(&createMultiQueueThreadPool_Queue,
+                                   bdlf::PlaceHolders::_1,
+                                   bdlf::PlaceHolders::_2,
+                                   this),
+              -1,
+              basicAllocator)
+, d_queueRegistry(basicAllocator)
+, d_nextId(1)
+, d_state(e_STATE_STOPPED)
+, d_numActiveQueues(0)
+, d_numExecuted(0)
+, d_numEnqueued(0)
+, d_numDeleted(0)
+, d_metricsRegistry_p(metricsRegistry)
+{
+    if (threadAttributes.threadName().empty() && threadPoolName.empty()) {
+        bslmt::ThreadAttributes modAttr(threadAttributes);  // name is empty,
+                                                            // no alloc
+        modAttr.setThreadName(s_defaultThreadName);         // short string,
+                                                            // no alloc
+
+        d_threadPool_p = new (*d_allocator_p) ThreadPool(modAttr,
+                                                         minThreads,
+                                                         maxThreads,
+                                                         maxIdleTime,
+                                                         threadPoolName,
+                                                         metricsRegistry,
+                                                         d_allocator_p);
+    }
+    else {
+        d_threadPool_p = new (*d_allocator_p) ThreadPool(threadAttributes,
+                                                         minThreads,
+                                                         maxThreads,
+                                                         maxIdleTime,
+                                                         threadPoolName,
+                                                         metricsRegistry,
+                                                         d_allocator_p);
+    }
+}
+
 MultiQueueThreadPool::MultiQueueThreadPool(ThreadPool       *threadPool,
                                            bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
@@ -595,6 +822,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(ThreadPool       *threadPool,
 , d_numExecuted(0)
 , d_numEnqueued(0)
 , d_numDeleted(0)
+, d_metricsRegistry_p(0)
 {
     BSLS_ASSERT(threadPool);
 }
@@ -622,6 +850,26 @@ int MultiQueueThreadPool::createQueue()
     return id;
 }
 
+int MultiQueueThreadPool::createQueue(const bsl::string_view& queueName)
+{
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    int id = d_nextId++;
+
+    // Note that 'd_queuePool' does its own synchronization.
+
+    MultiQueueThreadPool_Queue *queue = d_queuePool.getObject();
+
+    queue->registerMetrics(d_metricsRegistry_p
+                           ? d_metricsRegistry_p
+                           : &bdlm::MetricsRegistry::defaultInstance(),
+                           queueName);
+
+    d_queueRegistry[id] = queue;
+
+    return id;
+}
+
 int MultiQueueThreadPool::deleteQueue(int                   id,
                                       const CleanupFunctor& cleanupFunctor)
 {
@@ -11,6 +11,20 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 // bdlmt::MultiQueueThreadPool: multi-threaded, serial processing of queues
 //
+//@METRICS:
+//
+// * `bde.backlog`
+//   > number of jobs in a named queue
+//
+// * `bde.startlag`
+//   > mean seconds between a named queue being scheduled for processing and
+//   > the processing starting (may be 0.0)
+//
+// Associated Metric Attributes:
+//  * object type name: "bdlmt.multiqueuethreadpool"
+//  * object type abbreviation: "mqtp"
+//  * object identifier: the name supplied to `createQueue`
+//
 //@SEE_ALSO: bdlmt_threadpool
 //
 //@DESCRIPTION: This component defines a dynamic, configurable pool of queues,
@@ -70,6 +84,43 @@ BSLS_IDENT("$Id: $")
 // encouraged to use benchmarks to guide their decision when setting this
 // option.
 //
+///Job Execution Time Limit
+///------------------------
+// A batch of jobs can additionally be bounded in time: if a queue is
+// configured with a non-zero *batch time limit*, the thread processing a batch
+// stops starting jobs from the batch once that much time has elapsed since the
+// start of the batch, and returns the jobs not yet started to the front of the
+// queue, from where they are processed (in their original order) when the
+// queue is next scheduled.  At least one job is executed per batch, and a
+// running job is never interrupted.  Combining a large batch size with a time
+// limit amortizes the cost of scheduling a queue over many short jobs, while
+// bounding the time for which a queue having a large backlog can occupy a
+// thread.  By default a queue's batch time limit is 0 (i.e., no limit).
+//
+///Queue Weights
+///-------------
+// The queues of a `bdlmt::MultiQueueThreadPool` share the threads of the
+// underlying thread pool: a queue having jobs is scheduled by enqueuing a
+// processing job to the thread pool, and each time that processing job runs
+// it executes one batch of jobs before re-enqueuing itself (behind the
+// processing jobs of the other queues).  When the thread pool is saturated,
+// each queue having a backlog therefore receives one batch per "round".  A
+// queue's *weight* multiplies both its batch size and its batch time limit,
+// so that a queue of weight `w` receives about `w` times the share of the
+// threads of a queue of weight 1 having the same backlog and job cost.  By
+// default a queue's weight is 1.
+//
+///Metrics
+///-------
+// A queue created with a name (using the `createQueue` overload taking a
+// `queueName`) registers the `bde.backlog` and `bde.startlag` metrics (see
+// {`@METRICS`}), identified by that name, with the `bdlm::MetricsRegistry`
+// supplied at construction of the `bdlmt::MultiQueueThreadPool` (or with the
+// default registry if none is supplied).  The metrics are unregistered when
+// the queue is deleted.  Queues created without a name register no metrics,
+// and incur no cost for measuring their start lag; this keeps the cost of
+// very large numbers of anonymous queues unchanged.
+//
 ///Thread Names for Sub-Threads
 ///----------------------------
 // To facilitate debugging, users can provide a thread name as the `threadName`
@@ -84,6 +135,14 @@ BSLS_IDENT("$Id: $")
 // and is passed to the multi queue thread pool at construction, the subthreads
 // will be named however was specified when that thread pool was created.
 //
+///Thread Placement
+///----------------
+// The processing threads of a thread pool owned by a
+// `bdlmt::MultiQueueThreadPool` can be bound to CPUs of the host by supplying
+// a `bdlmt::ThreadPlacement` to `setThreadPlacement` before calling `start`
+// (see {`bdlmt_threadpool`|Thread Placement}).  The placement of a thread pool
+// supplied at construction is set on that thread pool directly.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -351,6 +410,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlmt_threadpool.h>
 
+#include <bdlm_metricsregistry.h>
+
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
@@ -368,10 +429,12 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_types.h>
 
 #include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_map.h>
+#include <bsl_string_view.h>
 
 namespace BloombergLP {
 namespace bdlmt {
@@ -421,6 +484,13 @@ class MultiQueueThreadPool_Queue {
 
     int                        d_batchSize;      // execution batch size
 
+    int                        d_batchTimeLimit; // execution batch time
+                                                 // limit, in microseconds, or
+                                                 // 0 for no limit
+
+    int                        d_weight;         // multiplier of the batch
+                                                 // size and time limit
+
     mutable bslmt::Mutex       d_lock;           // protect queue and
                                                  // informational members
 
@@ -436,6 +506,27 @@ class MultiQueueThreadPool_Queue {
     bslmt::ThreadUtil::Handle  d_processor;      // current worker thread, or
                                                  // ThreadUtil::invalidHandle()
 
+    bool                       d_isMeasuring;    // `true` if the metrics of
+                                                 // this queue are registered
+
+    bsls::Types::Int64         d_scheduleTime;   // `bsls::TimeUtil` timer
+                                                 // value when this queue was
+                                                 // last scheduled, if
+                                                 // `d_isMeasuring`
+
+    bsls::Types::Int64         d_totalStartLag;  // sum of the start lags, in
+                                                 // nanoseconds, since the last
+                                                 // collection
+
+    bsls::Types::Int64         d_numStarts;      // number of batches started
+                                                 // since the last collection
+
+    bdlm::MetricsRegistryRegistrationHandle
+                               d_backlogHandle;  // backlog metric handle
+
+    bdlm::MetricsRegistryRegistrationHandle
+                               d_startLagHandle; // start lag metric handle
+
     // NOT IMPLEMENTED
     MultiQueueThreadPool_Queue();
     MultiQueueThreadPool_Queue(const MultiQueueThreadPool_Queue&);
@@ -449,6 +540,21 @@ class MultiQueueThreadPool_Queue {
     /// is in a locked state and `e_PAUSING == d_runState`.
     void setPaused();
 
+    /// Enqueue the processing callback of this queue to the associated
+    /// thread pool, recording the time if the metrics of this queue are
+    /// registered.  Return 0 on success, and a non-zero value otherwise.
+    /// The behavior is undefined unless this queue's lock is in a locked
+    /// state.
+    int schedule();
+
+    /// Load into the specified `value` the number of jobs in this queue.
+    void collectBacklog(bdlm::Metric *value);
+
+    /// Load into the specified `value` the mean start lag, in seconds, of
+    /// the batches started since the previous collection, or 0 if no batch
+    /// was started, and reset the accumulated start lag.
+    void collectStartLag(bdlm::Metric *value);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(MultiQueueThreadPool_Queue,
@@ -484,9 +590,11 @@ class MultiQueueThreadPool_Queue {
     /// Block until all threads waiting for this queue to pause are released.
     void drainWaitWhilePausing();
 
-    /// Execute the `Job` at the front of this queue, dequeue the `Job`, and
-    /// if the queue is not paused schedule a callback from the associated
-    /// thread pool.  The behavior is undefined if this queue is empty.
+    /// Execute the batch of `Job` objects at the front of this queue (see
+    /// {`Job Execution Batch Size`} and {`Job Execution Time Limit`}),
+    /// dequeue the executed jobs, and if the queue is not paused and is not
+    /// empty schedule a callback from the associated thread pool.  The
+    /// behavior is undefined if this queue is empty.
     void executeFront();
 
     /// Permanently disable enqueueing from this queue, and enqueue a job
@@ -528,6 +636,13 @@ class MultiQueueThreadPool_Queue {
     /// unchanged.
     int pushFront(bslmf::MovableRef<Job> functor);
 
+    /// Register the `bde.backlog` and `bde.startlag` metrics of this queue,
+    /// identified by the specified `queueName`, with the specified
+    /// `metricsRegistry` (see {`Metrics`}).  The metrics remain registered
+    /// until this queue is reset or destroyed.
+    void registerMetrics(bdlm::MetricsRegistry   *metricsRegistry,
+                         const bsl::string_view&  queueName);
+
     /// Reset this queue to its initial state.  The behavior is undefined
     /// unless this queue's lock is in an unlocked state.  After this method
     /// returns, the object is ready for use as though it were a new object.
@@ -549,6 +664,20 @@ class MultiQueueThreadPool_Queue {
     /// all queues.
     void setBatchSize(int batchSize);
 
+    /// Configure this queue to stop starting the jobs of a batch once the
+    /// specified `microseconds`, multiplied by the weight of this queue,
+    /// have elapsed since the start of the batch (see
+    /// {`Job Execution Time Limit`}).  If `microseconds` is 0, batches are
+    /// not limited in time.  The behavior is undefined unless
+    /// `0 <= microseconds`.  Note that the initial value for the execution
+    /// batch time limit is 0 for all queues.
+    void setBatchTimeLimit(int microseconds);
+
+    /// Configure this queue to have the specified `weight` (see
+    /// {`Queue Weights`}).  The behavior is undefined unless
+    /// `1 <= weight`.  Note that the initial weight is 1 for all queues.
+    void setWeight(int weight);
+
     /// Wait until any currently-executing job on the queue completes and
     /// the queue is paused.  Note that pausing differs from `disable` in
     /// that (1) `pause` stops processing for a queue, and (2) does *not*
@@ -565,6 +694,10 @@ class MultiQueueThreadPool_Queue {
     /// the available jobs will be processed in the current batch.
     int batchSize() const;
 
+    /// Return an instantaneous snapshot of the execution batch time limit,
+    /// in microseconds (see {`Job Execution Time Limit`}).
+    int batchTimeLimit() const;
+
     /// Report whether all jobs in this queue are finished.
     bool isDrained() const;
 
@@ -577,6 +710,10 @@ class MultiQueueThreadPool_Queue {
 
     /// Return an instantaneous snapshot of the length of this queue.
     int length() const;
+
+    /// Return an instantaneous snapshot of the weight of this queue (see
+    /// {`Queue Weights`}).
+    int weight() const;
 };
 
                         // ==========================
@@ -648,6 +785,10 @@ class MultiQueueThreadPool {
     bsls::AtomicInt   d_numDeleted;         // the total number of requests
                                             // deleted from this pool since the
                                             // last time this value was reset
+
+    bdlm::MetricsRegistry
+                     *d_metricsRegistry_p;  // registry of the metrics of
+                                            // named queues (held, not owned)
   private:
     // NOT IMPLEMENTED
     MultiQueueThreadPool(const MultiQueueThreadPool&);
@@ -700,10 +841,36 @@ class MultiQueueThreadPool {
                          int                             maxIdleTime,
                          bslma::Allocator               *basicAllocator = 0);
 
+    /// Construct a `MultiQueueThreadPool` with the specified
+    /// `threadAttributes`, the specified `minThreads` minimum number of
+    /// threads, the specified `maxThreads` maximum number of threads, the
+    /// specified `maxIdleTime` idle time (in milliseconds) after which a
+    /// thread may be considered for destruction, the specified
+    /// `threadPoolName` to be used to identify the underlying thread pool,
+    /// and the specified `metricsRegistry` to be used for reporting the
+    /// metrics of the underlying thread pool and of named queues (see
+    /// {`Metrics`}).  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::defaultInstance()` is used.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 <= minThreads`,
+    /// `minThreads <= maxThreads`, and `0 <= maxIdleTime`.  Note that the
+    /// `MultiQueueThreadPool` is created without any queues.  Although
+    /// queues may be created, `start` must be called before enqueuing jobs.
+    MultiQueueThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         int                             maxIdleTime,
+                         const bsl::string_view&         threadPoolName,
+                         bdlm::MetricsRegistry          *metricsRegistry,
+                         bslma::Allocator               *basicAllocator = 0);
+
     /// Construct a `MultiQueueThreadPool` with the specified `threadPool`.
     /// Optionally specify a `basicAllocator` used to supply memory.  If
     /// `basicAllocator` is 0, the default memory allocator is used.  The
-    /// behavior is undefined if `threadPool` is 0.  Note that the
+    /// behavior is undefined if `threadPool` is 0.  Note that the metrics
+    /// of named queues are registered with
+    /// `bdlm::MetricsRegistry::defaultInstance()`.  Note that the
     /// `MultiQueueThreadPool` is created without any queues.  Although
     /// queues may be created, `start` must be called before enqueuing jobs.
     explicit
@@ -735,6 +902,13 @@ class MultiQueueThreadPool {
     /// queue.
     int createQueue();
 
+    /// Create a queue with unlimited capacity and a default number of
+    /// initial elements, and register its `bde.backlog` and `bde.startlag`
+    /// metrics, identified by the specified `queueName` (see {`Metrics`}).
+    /// Return a non-zero queue ID.  The queue ID can be used to enqueue
+    /// jobs to the queue, or to control or delete the queue.
+    int createQueue(const bsl::string_view& queueName);
+
     /// Disable enqueuing to the queue associated with the specified `id`,
     /// and enqueue the specified `cleanupFunctor` to the *front* of the
     /// queue.  The `cleanupFunctor` is guaranteed to be the last queue
@@ -837,6 +1011,30 @@ class MultiQueueThreadPool {
     /// queues.
     int setBatchSize(int id, int batchSize);
 
+    /// Configure the queue specified by `id` to stop starting the jobs of a
+    /// batch once the specified `microseconds`, multiplied by the weight of
+    /// the queue, have elapsed since the start of the batch (see
+    /// {`Job Execution Time Limit`}).  If `microseconds` is 0, batches are
+    /// not limited in time.  Return 0 on success, and a non-zero value
+    /// otherwise.  The behavior is undefined unless `0 <= microseconds`.
+    /// Note that the initial value for the execution batch time limit is 0
+    /// for all queues.
+    int setBatchTimeLimit(int id, int microseconds);
+
+    /// Configure the queue specified by `id` to have the specified `weight`
+    /// (see {`Queue Weights`}).  Return 0 on success, and a non-zero value
+    /// otherwise.  The behavior is undefined unless `1 <= weight`.  Note
+    /// that the initial weight is 1 for all queues.
+    int setWeight(int id, int weight);
+
+    /// Set the placement of the processing threads of the thread pool owned
+    /// by this object on CPUs to the specified `placement` (see
+    /// {`Thread Placement`}).  The placement takes effect the next time
+    /// this object is started; threads that are already running are not
+    /// affected.  The behavior is undefined unless this object was
+    /// constructed with thread attributes (i.e., it owns its thread pool).
+    void setThreadPlacement(const ThreadPlacement& placement);
+
     /// Disable queuing on all queues, and wait until all non-paused queues
     /// are empty.  Then, delete all queues, and shut down the thread pool
     /// if the thread pool is owned by this object.
@@ -869,6 +1067,12 @@ class MultiQueueThreadPool {
     /// the current batch.
     int batchSize(int id) const;
 
+    /// Return an instantaneous snapshot of the execution batch time limit,
+    /// in microseconds (see {`Job Execution Time Limit`}), of the queue
+    /// associated with the specified `id`, or -1 if `id` is not a valid
+    /// queue id.
+    int batchTimeLimit(int id) const;
+
     /// Return `true` if the queue associated with the specified `id` is
     /// currently paused, or `false` otherwise (including if `id` is not a
     /// valid queue id).
@@ -903,6 +1107,11 @@ class MultiQueueThreadPool {
     /// Return a reference to the non-modifiable thread pool owned by this
     /// object.
     const ThreadPool& threadPool() const;
+
+    /// Return an instantaneous snapshot of the weight (see
+    /// {`Queue Weights`}) of the queue associated with the specified `id`,
+    /// or -1 if `id` is not a valid queue id.
+    int weight(int id) const;
 };
 
 // ============================================================================
@@ -922,6 +1131,14 @@ int MultiQueueThreadPool_Queue::batchSize() const
     return d_batchSize;
 }
 
+inline
+int MultiQueueThreadPool_Queue::batchTimeLimit() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    return d_batchTimeLimit;
+}
+
 inline
 bool MultiQueueThreadPool_Queue::isDrained() const
 {
@@ -955,6 +1172,14 @@ int MultiQueueThreadPool_Queue::length() const
     return static_cast<int>(d_list.size());
 }
 
+inline
+int MultiQueueThreadPool_Queue::weight() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    return d_weight;
+}
+
                         // --------------------------
                         // class MultiQueueThreadPool
                         // --------------------------
@@ -1072,6 +1297,50 @@ int MultiQueueThreadPool::setBatchSize(int id, int batchSize)
     return 0;
 }
 
+inline
+int MultiQueueThreadPool::setBatchTimeLimit(int id, int microseconds)
+{
+    BSLS_ASSERT_SAFE(0 <= microseconds);
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    MultiQueueThreadPool_Queue *queue;
+
+    if (findIfUsable(id, &queue)) {
+        return 1;                                                     // RETURN
+    }
+
+    queue->setBatchTimeLimit(microseconds);
+
+    return 0;
+}
+
+inline
+int MultiQueueThreadPool::setWeight(int id, int weight)
+{
+    BSLS_ASSERT_SAFE(1 <= weight);
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    MultiQueueThreadPool_Queue *queue;
+
+    if (findIfUsable(id, &queue)) {
+        return 1;                                                     // RETURN
+    }
+
+    queue->setWeight(weight);
+
+    return 0;
+}
+
+inline
+void MultiQueueThreadPool::setThreadPlacement(const ThreadPlacement& placement)
+{
+    BSLS_ASSERT(d_threadPoolIsOwned);
+
+    d_threadPool_p->setThreadPlacement(placement);
+}
+
 // ACCESSORS
 inline
 int MultiQueueThreadPool::batchSize(int id) const
@@ -1087,6 +1356,20 @@ int MultiQueueThreadPool::batchSize(int id) const
     return -1;
 }
 
+inline
+int MultiQueueThreadPool::batchTimeLimit(int id) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() != iter) {
+        return iter->second->batchTimeLimit();                        // RETURN
+    }
+
+    return -1;
+}
+
 inline
 bool MultiQueueThreadPool::isEnabled(int id) const
 {
@@ -1166,6 +1449,20 @@ const ThreadPool& MultiQueueThreadPool::threadPool() const
     return *d_threadPool_p;
 }
 
+inline
+int MultiQueueThreadPool::weight(int id) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() != iter) {
+        return iter->second->weight();                                // RETURN
+    }
+
+    return -1;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
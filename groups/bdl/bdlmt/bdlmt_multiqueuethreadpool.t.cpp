@@ -4,6 +4,11 @@
 
 #include <bdlf_bind.h>
 
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
+#include <bdlm_metricsadapter.h>
+#include <bdlm_metricsregistry.h>
+
 #include <bsla_maybeunused.h>
 
 #include <bslma_testallocator.h>
@@ -12,6 +17,7 @@
 #include <bslmf_movableref.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_latch.h>
 #include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
@@ -77,13 +83,25 @@ using namespace BloombergLP;
 //                         int                             maxThreads,
 //                         int                             maxIdleTime,
 //                         bslma::Allocator               *basicAllocator = 0);
+// [39] bdlmt::MultiQueueThreadPool(
+//                         const bslmt::ThreadAttributes&  threadAttributes,
+//                         int                             minThreads,
+//                         int                             maxThreads,
+//                         int                             maxIdleTime,
+//                         const bsl::string_view&         threadPoolName,
+//                         bdlm::MetricsRegistry          *metricsRegistry,
+//                         bslma::Allocator               *basicAllocator = 0);
 // [ 7] bdlmt::MultiQueueThreadPool(bdlmt::ThreadPool *threadPool,
 //                                  bslma::Allocator  *basicAllocator = 0);
 // [ 2] ~bdlmt::MultiQueueThreadPool();
 //
 // MANIPULATORS
 // [33] void setBatchSize(int id, int batchSize);
+// [37] int setBatchTimeLimit(int id, int microseconds);
+// [38] int setWeight(int id, int weight);
+// [40] void setThreadPlacement(const ThreadPlacement& placement);
 // [ 2] int createQueue();
+// [39] int createQueue(const bsl::string_view& queueName);
 // [ 2] int deleteQueue(int id, const bsl::function<void()>& cleanupFunc);
 // [ 2] int enqueueJob(int id, const bsl::function<void()>& functor);
 // [ 6] int enableQueue(int id);
@@ -95,6 +113,8 @@ using namespace BloombergLP;
 //
 // ACCESSORS
 // [33] int batchSize(int id) const;
+// [37] int batchTimeLimit(int id) const;
+// [38] int weight(int id) const;
 // [13] void numProcessed(int *, int *, int * = 0) const;
 // [ 4] int numQueues() const;
 // [13] int numElements() const;
@@ -126,7 +146,7 @@ using namespace BloombergLP;
 // [34] DRQS 176332566: external threadpool shutdown race
 // [35] MOVING JOBS
 // [36] DRQS 176750534: destroy each job before starting the next
-// [37] USAGE EXAMPLE 1
+// [41] USAGE EXAMPLE 1
 // [-2] PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
@@ -1806,6 +1826,171 @@ struct DoNothing {
     void operator()() const {}
 };
 
+// ============================================================================
+//                       For test cases 37, 38, and 39
+// ----------------------------------------------------------------------------
+
+/// This class records, in order, the values supplied to `record` by jobs.
+class Case37Journal {
+
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+    bsl::vector<int>     d_values;
+
+  public:
+    // MANIPULATORS
+
+    /// Append the specified `value` to this journal.
+    void record(int value)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_values.push_back(value);
+    }
+
+    // ACCESSORS
+
+    /// Return a copy of the values recorded by this journal.
+    bsl::vector<int> values() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_values;
+    }
+};
+
+/// Sleep for the specified `microseconds`, then record the specified
+/// `value` in the specified `journal`.
+void case37Job(Case37Journal *journal, int value, int microseconds)
+{
+    if (microseconds) {
+        bslmt::ThreadUtil::microSleep(microseconds);
+    }
+    journal->record(value);
+}
+
+/// Delete the queue having the specified `id` from the specified `pool`,
+/// then record the specified `value` in the specified `journal`.
+void case37DeleteJob(Obj *pool, int id, Case37Journal *journal, int value)
+{
+    ASSERT(0 == pool->deleteQueue(id, noop));
+    journal->record(value);
+}
+
+                         // ========================
+                         // class TestMetricsAdapter
+                         // ========================
+
+/// This class implements a metrics adapter that records the registered
+/// descriptors and callbacks, so that the tests can invoke the callbacks.
+class TestMetricsAdapter : public bdlm::MetricsAdapter {
+
+    // DATA
+    bsl::vector<bdlm::MetricDescriptor> d_descriptors;
+    bsl::vector<Callback>               d_callbacks;
+    bsl::vector<int>                    d_handles;
+
+  public:
+    // CREATORS
+
+    /// Create a `TestMetricsAdapter` using the specified `basicAllocator`
+    /// to supply memory.
+    explicit TestMetricsAdapter(bslma::Allocator *basicAllocator)
+    : d_descriptors(basicAllocator)
+    , d_callbacks(basicAllocator)
+    , d_handles(basicAllocator)
+    {
+    }
+
+    /// Destroy this object.
+    ~TestMetricsAdapter() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the specified `metricDescriptor` and `callback`, and return
+    /// a callback handle identifying them.
+    CallbackHandle registerCollectionCallback(
+                  const bdlm::MetricDescriptor& metricDescriptor,
+                  const Callback&               callback) BSLS_KEYWORD_OVERRIDE
+    {
+        d_descriptors.push_back(metricDescriptor);
+        d_callbacks.push_back(callback);
+        d_handles.push_back(static_cast<int>(d_handles.size()));
+
+        return d_handles.back();
+    }
+
+    /// Mark the callback identified by the specified `handle` as removed.
+    /// Return 0.
+    int removeCollectionCallback(const CallbackHandle& handle)
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        d_handles[handle] = -1;
+        return 0;
+    }
+
+    // ACCESSORS
+
+    /// Return the value of the metric collected by the callback having the
+    /// specified `index`, or -1 if that callback was removed.  The behavior
+    /// is undefined unless `index < descriptors().size()`.
+    double collect(bsl::size_t index) const
+    {
+        if (0 > d_handles[index]) {
+            return -1.0;                                              // RETURN
+        }
+
+        bdlm::Metric value;
+        d_callbacks[index](&value);
+        return value.theGauge();
+    }
+
+    /// Return the descriptors of the registered callbacks.
+    const bsl::vector<bdlm::MetricDescriptor>& descriptors() const
+    {
+        return d_descriptors;
+    }
+
+    /// Return the number of registered callbacks that were not removed.
+    int numRegistered() const
+    {
+        int count = 0;
+        for (bsl::size_t i = 0; i < d_handles.size(); ++i) {
+            count += 0 <= d_handles[i];
+        }
+        return count;
+    }
+};
+
+// ============================================================================
+//                             For test case 40
+// ----------------------------------------------------------------------------
+
+/// This `struct` collects the CPUs on which the jobs of a pool run.
+struct Case40Observations {
+    bslmt::Barrier   d_barrier;  // holds each thread until all run a job
+    bslmt::Mutex     d_mutex;    // protects `d_cpus`
+    bsl::vector<int> d_cpus;     // CPUs observed
+
+    explicit Case40Observations(int numThreads)
+    : d_barrier(numThreads)
+    {
+    }
+};
+
+/// Record the current CPU in the specified `observations`, then wait on its
+/// barrier so that no thread of the pool runs more than one job.
+void case40ObserveCpu(Case40Observations *observations)
+{
+    const int cpu = bslmt::ThreadUtil::currentCpu();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&observations->d_mutex);
+
+        observations->d_cpus.push_back(cpu);
+    }
+    observations->d_barrier.wait();
+}
+
 // ============================================================================
 //                              MAIN PROGRAM
 
@@ -1827,7 +2012,7 @@ int main(int argc, char *argv[]) {
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:
-      case 37: {
+      case 41: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1908,6 +2093,623 @@ int main(int argc, char *argv[]) {
         ASSERT(0 <  ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 40: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        // 1. `setThreadPlacement` sets the placement of the owned thread
+        //    pool, as returned by `threadPool().threadPlacement()`.
+        //
+        // 2. On Linux, under the `e_COMPACT` policy, the threads of the
+        //    owned thread pool run on the first CPUs of the placement's CPU
+        //    order.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Verify the placement of the thread pool of a newly created
+        //    object, set a placement, and verify it.  (C-1)
+        //
+        // 2. Start an object whose thread pool has equal minimum and maximum
+        //    numbers of threads, enqueue one job to each of that many
+        //    queues, and compare the CPUs observed by the jobs with those
+        //    expected.  (C-2)
+        //
+        // 3. Verify that setting the placement of an object constructed with
+        //    an external thread pool is detected.  (C-3)
+        //
+        // Testing:
+        //   void setThreadPlacement(const ThreadPlacement& placement);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING THREAD PLACEMENT\n"
+                          << "========================\n";
+
+        typedef bdlmt::ThreadPlacement Placement;
+
+        const int k_NUM_THREADS = 3;
+
+        if (verbose) cout << "\nSetting the placement." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(),
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   30);
+            const Obj& X = mX;
+
+            ASSERT(Placement() == X.threadPool().threadPlacement());
+
+            const Placement PLACEMENT(Placement::e_SCATTER);
+            mX.setThreadPlacement(PLACEMENT);
+            ASSERT(PLACEMENT == X.threadPool().threadPlacement());
+        }
+
+        if (verbose) cout << "\nCompact placement." << endl;
+        {
+            const Placement PLACEMENT(Placement::e_COMPACT);
+
+            bsl::vector<int> order;
+            PLACEMENT.loadCpuOrder(&order);
+            ASSERT(!order.empty());
+
+            bsl::vector<int> expected;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                expected.push_back(order[i % order.size()]);
+            }
+            bsl::sort(expected.begin(), expected.end());
+
+            Obj mX(bslmt::ThreadAttributes(),
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   30);
+            mX.setThreadPlacement(PLACEMENT);
+
+            STARTPOOL(mX);
+
+            Case40Observations observations(k_NUM_THREADS);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const int queueId = mX.createQueue();
+
+                ASSERT(0 == mX.enqueueJob(queueId,
+                                          bdlf::BindUtil::bind(
+                                                            &case40ObserveCpu,
+                                                            &observations)));
+            }
+            mX.stop();
+
+            bsl::sort(observations.d_cpus.begin(), observations.d_cpus.end());
+
+            ASSERT(k_NUM_THREADS ==
+                             static_cast<int>(observations.d_cpus.size()));
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(expected == observations.d_cpus);
+#endif
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+            Obj mY(&pool);
+
+            ASSERT_PASS(mX.setThreadPlacement(Placement()));
+            ASSERT_FAIL(mY.setThreadPlacement(Placement()));
+        }
+      } break;
+      case 39: {
+        // --------------------------------------------------------------------
+        // TESTING METRICS
+        //
+        // Concerns:
+        // 1. The constructor taking a `metricsRegistry` registers the metric
+        //    of the underlying thread pool with that registry.
+        //
+        // 2. Queues created without a name register no metrics.
+        //
+        // 3. A queue created with a name registers the `bde.backlog` and
+        //    `bde.startlag` metrics, identified by that name, with the
+        //    registry supplied at construction.
+        //
+        // 4. The backlog metric reports the number of jobs in the queue.
+        //
+        // 5. The start lag metric reports the mean delay between scheduling
+        //    and processing the queue since the previous collection.
+        //
+        // 6. The metrics of a queue are unregistered when it is deleted, and
+        //    a reused queue created without a name registers no metrics.
+        //
+        // Plan:
+        // 1. Install a test metrics adapter on a registry supplied at
+        //    construction and verify the registered descriptors.  (C-1..3)
+        //
+        // 2. Enqueue jobs to a paused named queue and collect the backlog.
+        //    (C-4)
+        //
+        // 3. Block the single pool thread with a job on another queue, then
+        //    enqueue a job to the named queue, and verify the collected start
+        //    lag reflects the delay, and that it is reset by collection.
+        //    (C-5)
+        //
+        // 4. Delete the named queue, create an anonymous queue, and verify
+        //    the number of registered callbacks.  (C-6)
+        //
+        // Testing:
+        //   MultiQueueThreadPool(attr, min, max, idle, name, registry, *ba);
+        //   int createQueue(const bsl::string_view& queueName);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING METRICS\n"
+                          << "===============\n";
+
+        TestMetricsAdapter    adapter(&ta);
+        bdlm::MetricsRegistry registry(&ta);
+
+        registry.setMetricsAdapter(&adapter);
+
+        {
+            Obj mX(bslmt::ThreadAttributes(),
+                   1,
+                   1,
+                   30,
+                   "pool",
+                   &registry,
+                   &ta);
+
+            STARTPOOL(mX);
+
+            const bsl::vector<bdlm::MetricDescriptor>& DESCRIPTORS =
+                                                        adapter.descriptors();
+
+            ASSERTV(DESCRIPTORS.size(), 1 == DESCRIPTORS.size());
+            ASSERT("bdlmt.threadpool" == DESCRIPTORS[0].objectTypeName());
+            ASSERT("pool"             == DESCRIPTORS[0].objectIdentifier());
+
+            if (verbose) cout << "\nAnonymous queues register no metrics."
+                              << endl;
+
+            const int anonymousId = mX.createQueue();
+
+            ASSERTV(DESCRIPTORS.size(), 1 == DESCRIPTORS.size());
+
+            if (verbose) cout << "\nNamed queues register metrics." << endl;
+
+            const int namedId = mX.createQueue("instrument");
+
+            ASSERTV(DESCRIPTORS.size(), 3 == DESCRIPTORS.size());
+
+            for (bsl::size_t i = 1; i < DESCRIPTORS.size(); ++i) {
+                const bdlm::MetricDescriptor& D = DESCRIPTORS[i];
+
+                ASSERTV(i, "bdlmt.multiqueuethreadpool" == D.objectTypeName());
+                ASSERTV(i, "mqtp"       == D.objectTypeAbbreviation());
+                ASSERTV(i, "instrument" == D.objectIdentifier());
+            }
+            ASSERT("bde.backlog"  == DESCRIPTORS[1].metricName());
+            ASSERT("bde.startlag" == DESCRIPTORS[2].metricName());
+
+            if (verbose) cout << "\nTesting the backlog metric." << endl;
+
+            ASSERT(0.0 == adapter.collect(1));
+
+            ASSERT(0 == mX.pauseQueue(namedId));
+            for (int i = 0; i < 5; ++i) {
+                ASSERT(0 == mX.enqueueJob(namedId, noop));
+            }
+
+            ASSERTV(adapter.collect(1), 5.0 == adapter.collect(1));
+
+            ASSERT(0 == mX.resumeQueue(namedId));
+            mX.drain();
+
+            ASSERTV(adapter.collect(1), 0.0 == adapter.collect(1));
+
+            if (verbose) cout << "\nTesting the start lag metric." << endl;
+
+            adapter.collect(2);  // discard the lag of the previous dispatch
+
+            ASSERT(0.0 == adapter.collect(2));
+
+            Case37Journal journal;
+
+            ASSERT(0 == mX.enqueueJob(anonymousId,
+                                      bdlf::BindUtil::bind(&case37Job,
+                                                           &journal,
+                                                           0,
+                                                           50 * 1000)));
+            bslmt::ThreadUtil::microSleep(5 * 1000);
+            ASSERT(0 == mX.enqueueJob(namedId, noop));
+            mX.drain();
+
+            const double LAG = adapter.collect(2);
+
+            ASSERTV(LAG, 0.02 <= LAG);
+            ASSERTV(LAG, 10.0 >  LAG);
+
+            ASSERTV(adapter.collect(2), 0.0 == adapter.collect(2));
+
+            if (verbose) cout << "\nDeleting queues unregisters metrics."
+                              << endl;
+
+            ASSERT(3 == adapter.numRegistered());
+
+            ASSERT(0 == mX.deleteQueue(namedId));
+
+            ASSERT(1 == adapter.numRegistered());
+
+            const int reusedId = mX.createQueue();
+
+            ASSERT(1 == adapter.numRegistered());
+
+            ASSERT(0 == mX.deleteQueue(reusedId));
+            ASSERT(0 == mX.deleteQueue(anonymousId));
+        }
+
+        ASSERT(0 == adapter.numRegistered());
+      } break;
+      case 38: {
+        // --------------------------------------------------------------------
+        // TESTING WEIGHT
+        //
+        // Concerns:
+        // 1. The value returned by `weight` matches the value assigned by
+        //    `setWeight`, and is 1 for new queues, including queues reused
+        //    from a deleted queue.
+        //
+        // 2. A queue of weight `w` executes `w` times its batch size per
+        //    dispatch, so that, with one thread, two backlogged queues are
+        //    processed in the ratio of their weights.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Set and read back weights on valid and invalid queue ids, then
+        //    delete and recreate a queue.  (C-1)
+        //
+        // 2. Using a single-threaded pool, enqueue jobs recording their queue
+        //    to two paused queues of weights 3 and 1, resume both, and verify
+        //    the exact interleaving.  (C-2)
+        //
+        // 3. Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   int setWeight(int id, int weight);
+        //   int weight(int id) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING WEIGHT\n"
+                          << "==============\n";
+
+        if (verbose) cout << "\nTesting `weight`." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);  const Obj& X = mX;
+
+            STARTPOOL(mX);
+
+            ASSERT(-1 == X.weight(0));
+            ASSERT( 0 != mX.setWeight(0, 2));
+
+            int queueId = mX.createQueue();
+
+            ASSERT( 1 == X.weight(queueId));
+            ASSERT(-1 == X.weight(queueId + 1));
+
+            ASSERT( 0 == mX.setWeight(queueId, 5));
+            ASSERT( 0 != mX.setWeight(queueId + 1, 5));
+            ASSERT( 5 == X.weight(queueId));
+
+            ASSERT( 0 == mX.setBatchSize(queueId, 4));
+            ASSERT( 0 == mX.setBatchTimeLimit(queueId, 100));
+
+            ASSERT( 0 == mX.deleteQueue(queueId));
+
+            // The queue object is reused from the pool of queues.
+
+            queueId = mX.createQueue();
+
+            ASSERT( 1 == X.weight(queueId));
+            ASSERT( 1 == X.batchSize(queueId));
+            ASSERT( 0 == X.batchTimeLimit(queueId));
+        }
+
+        if (verbose) cout << "\nTesting weighted processing." << endl;
+        {
+            enum { k_NUM_JOBS = 30, k_WEIGHT = 3, k_A = 'A', k_B = 'B' };
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            STARTPOOL(mX);
+
+            Case37Journal journal;
+
+            const int idA = mX.createQueue();
+            const int idB = mX.createQueue();
+
+            ASSERT(0 == mX.setWeight(idA, k_WEIGHT));
+
+            ASSERT(0 == mX.pauseQueue(idA));
+            ASSERT(0 == mX.pauseQueue(idB));
+
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                mX.enqueueJob(idA,
+                              bdlf::BindUtil::bind(&case37Job,
+                                                   &journal,
+                                                   static_cast<int>(k_A),
+                                                   0));
+                mX.enqueueJob(idB,
+                              bdlf::BindUtil::bind(&case37Job,
+                                                   &journal,
+                                                   static_cast<int>(k_B),
+                                                   0));
+            }
+
+            // Block the only thread so that both queues are scheduled before
+            // either is processed.
+
+            bslmt::Barrier barrier(2);
+
+            const int idBlock = mX.createQueue();
+            mX.enqueueJob(idBlock, bdlf::BindUtil::bind(&waitWait, &barrier));
+            barrier.wait();
+
+            ASSERT(0 == mX.resumeQueue(idA));
+            ASSERT(0 == mX.resumeQueue(idB));
+
+            barrier.wait();
+            mX.drain();
+
+            const bsl::vector<int> VALUES = journal.values();
+
+            ASSERTV(VALUES.size(), 2 * k_NUM_JOBS == VALUES.size());
+
+            for (bsl::size_t i = 0; i < VALUES.size(); ++i) {
+                const int round = static_cast<int>(i) / (k_WEIGHT + 1);
+
+                const int slot  = static_cast<int>(i) % (k_WEIGHT + 1);
+
+                const bool isA  = round < k_NUM_JOBS / k_WEIGHT
+                               && slot  < k_WEIGHT;
+
+                const int EXP = isA ? k_A : k_B;
+
+                ASSERTV(i, VALUES[i], EXP == VALUES[i]);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            STARTPOOL(mX);
+            int queueId = mX.createQueue();
+
+            ASSERT_SAFE_PASS(mX.setWeight(queueId,  1));
+            ASSERT_SAFE_PASS(mX.setWeight(queueId,  2));
+            ASSERT_SAFE_FAIL(mX.setWeight(queueId,  0));
+            ASSERT_SAFE_FAIL(mX.setWeight(queueId, -1));
+        }
+      } break;
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH TIME LIMIT
+        //
+        // Concerns:
+        // 1. The value returned by `batchTimeLimit` matches the value
+        //    assigned by `setBatchTimeLimit`, and is 0 for new queues.
+        //
+        // 2. Without a time limit, a batch executes all of its jobs before
+        //    another queue is processed.
+        //
+        // 3. With a time limit, a batch stops once the limit has elapsed, the
+        //    jobs not started are executed later in their original order, and
+        //    other queues are processed in the meantime.
+        //
+        // 4. Jobs returned to a queue that is deleted while the batch is
+        //    executing are counted as deleted, and no job is lost.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Set and read back time limits on valid and invalid queue ids.
+        //    (C-1)
+        //
+        // 2. Using a single-threaded pool, enqueue slow jobs to a paused
+        //    queue having a large batch size, and one job to another paused
+        //    queue, resume both while the thread is blocked, and verify the
+        //    position at which the job of the second queue executes, with and
+        //    without a time limit.  (C-2..3)
+        //
+        // 3. Enqueue slow jobs to a time-limited queue whose first job deletes
+        //    the queue, and verify the processed counts.  (C-4)
+        //
+        // 4. Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   int setBatchTimeLimit(int id, int microseconds);
+        //   int batchTimeLimit(int id) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING BATCH TIME LIMIT\n"
+                          << "========================\n";
+
+        if (verbose) cout << "\nTesting `batchTimeLimit`." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);  const Obj& X = mX;
+
+            STARTPOOL(mX);
+
+            ASSERT(-1 == X.batchTimeLimit(0));
+            ASSERT( 0 != mX.setBatchTimeLimit(0, 10));
+
+            int queueId = mX.createQueue();
+
+            ASSERT( 0 == X.batchTimeLimit(queueId));
+            ASSERT(-1 == X.batchTimeLimit(queueId + 1));
+
+            ASSERT( 0 == mX.setBatchTimeLimit(queueId, 10));
+            ASSERT( 0 != mX.setBatchTimeLimit(queueId + 1, 10));
+            ASSERT(10 == X.batchTimeLimit(queueId));
+
+            ASSERT( 0 == mX.setBatchTimeLimit(queueId, 0));
+            ASSERT( 0 == X.batchTimeLimit(queueId));
+        }
+
+        if (verbose) cout << "\nTesting time-limited batches." << endl;
+        {
+            enum { k_NUM_JOBS = 20, k_SLEEP = 1000, k_OTHER = -1 };
+
+            for (int limit = 0; limit <= 2000; limit += 2000) {
+                if (veryVerbose) { T_; P(limit); }
+
+                Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+                STARTPOOL(mX);
+
+                Case37Journal journal;
+
+                const int idA = mX.createQueue();
+                const int idB = mX.createQueue();
+
+                ASSERT(0 == mX.setBatchSize(idA, 100));
+                ASSERT(0 == mX.setBatchTimeLimit(idA, limit));
+
+                ASSERT(0 == mX.pauseQueue(idA));
+                ASSERT(0 == mX.pauseQueue(idB));
+
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    mX.enqueueJob(idA, bdlf::BindUtil::bind(&case37Job,
+                                                            &journal,
+                                                            i,
+                                                            k_SLEEP));
+                }
+                mX.enqueueJob(idB, bdlf::BindUtil::bind(&case37Job,
+                                                        &journal,
+                                                        k_OTHER,
+                                                        0));
+
+                // Block the only thread so that both queues are scheduled
+                // before either is processed.
+
+                bslmt::Barrier barrier(2);
+
+                const int idBlock = mX.createQueue();
+                mX.enqueueJob(idBlock,
+                              bdlf::BindUtil::bind(&waitWait, &barrier));
+                barrier.wait();
+
+                ASSERT(0 == mX.resumeQueue(idA));
+                ASSERT(0 == mX.resumeQueue(idB));
+
+                barrier.wait();
+                mX.drain();
+
+                const bsl::vector<int> VALUES = journal.values();
+
+                ASSERTV(VALUES.size(), k_NUM_JOBS + 1 == VALUES.size());
+
+                int position = -1;
+                int expected = 0;
+                for (bsl::size_t i = 0; i < VALUES.size(); ++i) {
+                    if (k_OTHER == VALUES[i]) {
+                        position = static_cast<int>(i);
+                    }
+                    else {
+                        ASSERTV(limit, i, VALUES[i], expected == VALUES[i]);
+                        ++expected;
+                    }
+                }
+
+                if (0 == limit) {
+                    ASSERTV(position, k_NUM_JOBS == position);
+                }
+                else {
+                    ASSERTV(position, 1 <= position);
+                    ASSERTV(position, k_NUM_JOBS > position);
+                }
+
+                int numExecuted;
+                int numEnqueued;
+                int numDeleted;
+
+                mX.numProcessed(&numExecuted, &numEnqueued, &numDeleted);
+
+                ASSERTV(numExecuted, k_NUM_JOBS + 2 == numExecuted);
+                ASSERTV(numEnqueued, k_NUM_JOBS + 2 == numEnqueued);
+                ASSERTV(numDeleted,  0              == numDeleted);
+            }
+        }
+
+        if (verbose) cout << "\nTesting deletion during a batch." << endl;
+        {
+            enum { k_NUM_JOBS = 20, k_SLEEP = 1000 };
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            STARTPOOL(mX);
+
+            Case37Journal journal;
+
+            const int queueId = mX.createQueue();
+
+            ASSERT(0 == mX.setBatchSize(queueId, 100));
+            ASSERT(0 == mX.setBatchTimeLimit(queueId, 2000));
+
+            ASSERT(0 == mX.pauseQueue(queueId));
+
+            mX.enqueueJob(queueId, bdlf::BindUtil::bind(&case37DeleteJob,
+                                                        &mX,
+                                                        queueId,
+                                                        &journal,
+                                                        0));
+            for (int i = 1; i < k_NUM_JOBS; ++i) {
+                mX.enqueueJob(queueId, bdlf::BindUtil::bind(&case37Job,
+                                                            &journal,
+                                                            i,
+                                                            k_SLEEP));
+            }
+
+            ASSERT(0 == mX.resumeQueue(queueId));
+
+            mX.drain();
+
+            ASSERT(0 == mX.numQueues());
+
+            int numExecuted;
+            int numEnqueued;
+            int numDeleted;
+
+            mX.numProcessed(&numExecuted, &numEnqueued, &numDeleted);
+
+            ASSERTV(numEnqueued, k_NUM_JOBS == numEnqueued);
+            ASSERTV(numExecuted, numDeleted,
+                    k_NUM_JOBS == numExecuted + numDeleted);
+            ASSERTV(numExecuted, k_NUM_JOBS > numExecuted);
+
+            const bsl::vector<int> VALUES = journal.values();
+
+            ASSERTV(VALUES.size(),
+                    numExecuted == static_cast<int>(VALUES.size()));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            STARTPOOL(mX);
+            int queueId = mX.createQueue();
+
+            ASSERT_SAFE_PASS(mX.setBatchTimeLimit(queueId,  0));
+            ASSERT_SAFE_PASS(mX.setBatchTimeLimit(queueId,  1));
+            ASSERT_SAFE_FAIL(mX.setBatchTimeLimit(queueId, -1));
+        }
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // DRQS 176750534: destroy each job before starting the next
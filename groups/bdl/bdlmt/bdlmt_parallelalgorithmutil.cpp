@@ -0,0 +1,180 @@
+// bdlmt_parallelalgorithmutil.cpp                                    -*-C++-*-
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_parallelalgorithmutil_cpp,"$Id$ $CSID$")
+
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+/// Append to the specified `bounds` the ends of the leaves obtained by
+/// recursively splitting the range `[begin, end)` into halves until each
+/// part has at most the specified `grainSize` elements.
+void split(bsl::vector<bsl::size_t> *bounds,
+           bsl::size_t               begin,
+           bsl::size_t               end,
+           bsl::size_t               grainSize)
+{
+    if (end - begin <= grainSize) {
+        bounds->push_back(end);
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t middle = begin + (end - begin) / 2;
+
+    split(bounds, begin,  middle, grainSize);
+    split(bounds, middle, end,    grainSize);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ---------------------------------
+                     // class ParallelAlgorithmUtil_Batch
+                     // ---------------------------------
+
+// CLASS METHODS
+void ParallelAlgorithmUtil_Batch::help(
+                     const bsl::shared_ptr<ParallelAlgorithmUtil_Batch>& batch)
+{
+    batch->work();
+}
+
+// CREATORS
+ParallelAlgorithmUtil_Batch::ParallelAlgorithmUtil_Batch(
+                                        bsl::size_t          numLeaves,
+                                        const LeafFunction&  function,
+                                        bslma::Allocator    *basicAllocator)
+: d_function(bsl::allocator_arg, basicAllocator, function)
+, d_numLeaves(numLeaves)
+, d_nextLeaf(0)
+, d_latch(static_cast<int>(numLeaves))
+{
+    BSLS_ASSERT(0 < numLeaves);
+    BSLS_ASSERT(numLeaves <=
+                static_cast<bsl::size_t>(bsl::numeric_limits<int>::max()));
+}
+
+// MANIPULATORS
+void ParallelAlgorithmUtil_Batch::wait()
+{
+    d_latch.wait();
+}
+
+void ParallelAlgorithmUtil_Batch::work()
+{
+    for (;;) {
+        const bsl::size_t leaf = static_cast<bsl::size_t>(
+                                                       d_nextLeaf.add(1) - 1);
+        if (leaf >= d_numLeaves) {
+            return;                                                   // RETURN
+        }
+
+        d_function(leaf);
+        d_latch.arrive();
+    }
+}
+
+                    // ------------------------------------
+                    // struct ParallelAlgorithmUtil_ImpUtil
+                    // ------------------------------------
+
+// CLASS METHODS
+bsl::size_t ParallelAlgorithmUtil_ImpUtil::grainSize(
+                                        bsl::size_t numElements,
+                                        bsl::size_t requestedGrainSize,
+                                        int         numThreads)
+{
+    if (0 != requestedGrainSize) {
+        return requestedGrainSize;                                    // RETURN
+    }
+
+    const bsl::size_t numParticipants =
+                         static_cast<bsl::size_t>(bsl::max(0, numThreads)) + 1;
+    const bsl::size_t numLeaves       =
+                  ParallelAlgorithmUtil::k_LEAVES_PER_THREAD * numParticipants;
+
+    const bsl::size_t grain = (numElements + numLeaves - 1) / numLeaves;
+
+    return 0 == grain ? 1 : grain;
+}
+
+void ParallelAlgorithmUtil_ImpUtil::loadMergeParts(
+                                        bsl::vector<MergePart>   *merges,
+                                        bsl::vector<bsl::size_t> *runBounds,
+                                        bsl::size_t               grainSize)
+{
+    BSLS_ASSERT(merges);
+    BSLS_ASSERT(runBounds);
+    BSLS_ASSERT(2 <= runBounds->size());
+    BSLS_ASSERT(0 < grainSize);
+
+    const bsl::vector<bsl::size_t>& bounds = *runBounds;
+
+    bsl::vector<bsl::size_t> mergedBounds;
+    mergedBounds.reserve(bounds.size() / 2 + 1);
+    mergedBounds.push_back(bounds[0]);
+
+    merges->clear();
+
+    for (bsl::size_t i = 0; i + 1 < bounds.size(); i += 2) {
+        MergePart part;
+        part.d_begin  = bounds[i];
+        part.d_middle = bounds[i + 1];
+        part.d_end    = i + 2 < bounds.size() ? bounds[i + 2] : part.d_middle;
+        part.d_splitBegin = 0;
+        part.d_splitEnd   = 0;
+
+        const bsl::size_t length = part.d_end - part.d_begin;
+
+        for (bsl::size_t out = 0; out < length; out += grainSize) {
+            part.d_outBegin = out;
+            part.d_outEnd   = bsl::min(out + grainSize, length);
+            merges->push_back(part);
+        }
+
+        mergedBounds.push_back(part.d_end);
+    }
+
+    runBounds->swap(mergedBounds);
+}
+
+void ParallelAlgorithmUtil_ImpUtil::partition(
+                                        bsl::vector<bsl::size_t> *bounds,
+                                        bsl::size_t               numElements,
+                                        bsl::size_t               grainSize)
+{
+    BSLS_ASSERT(bounds);
+    BSLS_ASSERT(0 < grainSize);
+
+    bounds->clear();
+    bounds->push_back(0);
+
+    if (0 < numElements) {
+        u::split(bounds, 0, numElements, grainSize);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
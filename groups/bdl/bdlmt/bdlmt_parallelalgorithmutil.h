@@ -0,0 +1,1283 @@
+// bdlmt_parallelalgorithmutil.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+#define INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel algorithms running on a `bdlmt` thread pool.
+//
+//@CLASSES:
+//  bdlmt::ParallelAlgorithmUtil: namespace for parallel range algorithms
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdlmt::ParallelAlgorithmUtil`, whose functions apply an operation to the
+// elements of a random-access range in parallel, using the threads of a
+// caller-supplied thread pool (a `bdlmt::FixedThreadPool` or a
+// `bdlmt::ThreadPool`):
+//
+// * `parallelForEach` invokes a function on each element.
+// * `parallelTransform` stores the result of a function of each element into
+//   an output range.
+// * `parallelReduce` combines the elements with an associative operation.
+// * `parallelSort` sorts the elements.
+//
+// Each function returns once the operation is complete on all the elements.
+//
+///Partitioning and Grain Size
+///---------------------------
+// A range is partitioned by recursive splitting: a range having more than
+// `grainSize` elements is split into two halves, which are split in turn,
+// until every part (called a *leaf*) has at most `grainSize` elements.  The
+// leaves are then processed by the calling thread and by up to one job per
+// thread of the pool, each of which repeatedly claims the next unprocessed
+// leaf until none is left.  Leaves are thus balanced dynamically between the
+// threads, and the calling thread makes progress even if every thread of the
+// pool is busy (in particular, when an algorithm is invoked from a job running
+// on the same pool).
+//
+// If `grainSize` is 0 (the default), it is chosen so that the range is split
+// into about `k_LEAVES_PER_THREAD` leaves per thread taking part (the threads
+// of the pool and the calling thread), which balances load well for elements
+// of uniform cost.  Clients processing elements of very small cost (where the
+// overhead of a leaf, around a microsecond, matters) should specify a larger
+// grain size, and clients processing elements of very uneven cost a smaller
+// one.
+//
+///Reduction Order
+///---------------
+// `parallelReduce` reduces each leaf sequentially, and then combines the
+// partial results of the leaves.  If `e_ANY_ORDER` is specified (the
+// default), the partial results are combined as the leaves complete, so the
+// result is unspecified unless the operation is commutative as well as
+// associative (floating-point addition, for example, is not associative, and
+// its result can vary from run to run).  If `e_DETERMINISTIC` is specified,
+// the partial results are combined in the order of the leaves in the range,
+// so the result depends only on the input and the partitioning, which is
+// determined by the number of elements and the grain size.  Note that the
+// partitioning does not depend on the pool if the grain size is specified.
+//
+///Sorting
+///-------
+// `parallelSort` sorts the leaves in parallel, and then merges adjacent
+// sorted runs in rounds, each merge being itself split into parts of about
+// `grainSize` elements that are merged in parallel.  The sort is not stable,
+// and uses a temporary copy of the range, allocated from the currently
+// installed default allocator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Pricing a Portfolio
+/// - - - - - - - - - - - - - - -
+// Suppose that we compute the value of a portfolio of positions, and that
+// pricing a position is expensive, so we want to price the positions in
+// parallel on a thread pool.
+//
+// First, we define the function that prices a position:
+// ```
+// double price(int position)
+// {
+//     return position * 1.5;
+// }
+// ```
+// Then, we create and start a thread pool:
+// ```
+// bdlmt::FixedThreadPool pool(4, 100);
+// pool.start();
+// ```
+// Next, we create the positions, and price them in parallel:
+// ```
+// bsl::vector<int> positions;
+// for (int i = 1; i <= 1000; ++i) {
+//     positions.push_back(i);
+// }
+//
+// bsl::vector<double> prices(positions.size());
+// bdlmt::ParallelAlgorithmUtil::parallelTransform(&pool,
+//                                                 positions.begin(),
+//                                                 positions.end(),
+//                                                 prices.begin(),
+//                                                 &price);
+// assert(1500.0 == prices[999]);
+// ```
+// Now, we add the prices, in a deterministic order, so that the value of the
+// portfolio is reproducible:
+// ```
+// double value = bdlmt::ParallelAlgorithmUtil::parallelReduce(
+//                          &pool,
+//                          prices.begin(),
+//                          prices.end(),
+//                          0.0,
+//                          bsl::plus<double>(),
+//                          bdlmt::ParallelAlgorithmUtil::e_DETERMINISTIC);
+// assert(1.5 * 500 * 1001 == value);
+// ```
+// Finally, we sort the prices in decreasing order:
+// ```
+// bdlmt::ParallelAlgorithmUtil::parallelSort(&pool,
+//                                            prices.begin(),
+//                                            prices.end(),
+//                                            bsl::greater<double>());
+// assert(1500.0 == prices[0]);
+//
+// pool.stop();
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                     // =================================
+                     // class ParallelAlgorithmUtil_Batch
+                     // =================================
+
+/// This component-private class holds the state, shared by the calling
+/// thread and the jobs it enqueues, of one invocation of a parallel
+/// algorithm: the function processing a leaf, the number of leaves, the
+/// index of the next leaf to claim, and a latch counting the leaves
+/// processed.
+class ParallelAlgorithmUtil_Batch {
+
+  public:
+    // TYPES
+
+    /// Function invoked with the index of a leaf to process it.
+    typedef bsl::function<void(bsl::size_t)> LeafFunction;
+
+  private:
+    // DATA
+    LeafFunction       d_function;   // processes a leaf
+    const bsl::size_t  d_numLeaves;  // number of leaves
+    bsls::AtomicUint64 d_nextLeaf;   // index of the next leaf to claim
+    bslmt::Latch       d_latch;      // counts down the leaves processed
+
+  private:
+    // NOT IMPLEMENTED
+    ParallelAlgorithmUtil_Batch(const ParallelAlgorithmUtil_Batch&)
+                                                          BSLS_KEYWORD_DELETED;
+    ParallelAlgorithmUtil_Batch& operator=(
+                      const ParallelAlgorithmUtil_Batch&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ParallelAlgorithmUtil_Batch,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Process leaves of the specified `batch` until none is left to claim.
+    /// This function is the job enqueued on the pool.
+    static void help(const bsl::shared_ptr<ParallelAlgorithmUtil_Batch>&
+                                                                       batch);
+
+    // CREATORS
+
+    /// Create a batch of the specified `numLeaves` leaves processed by the
+    /// specified `function`.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `0 < numLeaves`.
+    ParallelAlgorithmUtil_Batch(bsl::size_t          numLeaves,
+                                const LeafFunction&  function,
+                                bslma::Allocator    *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Block until every leaf of this batch has been processed.
+    void wait();
+
+    /// Claim and process leaves of this batch until none is left to claim.
+    void work();
+};
+
+                    // ====================================
+                    // struct ParallelAlgorithmUtil_ImpUtil
+                    // ====================================
+
+/// This component-private utility `struct` provides the partitioning and
+/// scheduling shared by the parallel algorithms.
+struct ParallelAlgorithmUtil_ImpUtil {
+
+    // TYPES
+    typedef ParallelAlgorithmUtil_Batch::LeafFunction LeafFunction;
+
+    /// This `struct` describes one part of a merge of two adjacent sorted
+    /// runs, `[d_begin, d_middle)` and `[d_middle, d_end)`: the elements of
+    /// the merged run at positions `[d_outBegin, d_outEnd)` relative to
+    /// `d_begin`, of which the elements of the first run are those at
+    /// positions `[d_splitBegin, d_splitEnd)` relative to `d_begin`.
+    struct MergePart {
+        bsl::size_t d_begin;
+        bsl::size_t d_middle;
+        bsl::size_t d_end;
+        bsl::size_t d_outBegin;
+        bsl::size_t d_outEnd;
+        bsl::size_t d_splitBegin;
+        bsl::size_t d_splitEnd;
+    };
+
+    // CLASS METHODS
+
+    /// Return the number of threads of the specified `pool`.
+    static int concurrency(const FixedThreadPool *pool);
+
+    /// Return the maximum number of threads of the specified `pool`.
+    static int concurrency(const ThreadPool *pool);
+
+    /// Enqueue the specified `job` on the specified `pool`, without blocking
+    /// if the queue of `pool` is full.  Return 0 on success, and a non-zero
+    /// value otherwise.
+    static int enqueueJob(FixedThreadPool             *pool,
+                          const FixedThreadPool::Job&  job);
+    static int enqueueJob(ThreadPool *pool, const ThreadPool::Job& job);
+
+    /// Return the grain size to use for a range of the specified
+    /// `numElements` processed by the specified `numThreads` threads of a
+    /// pool and the calling thread: the specified `requestedGrainSize` if it
+    /// is not 0, and otherwise a size splitting the range into about
+    /// `k_LEAVES_PER_THREAD` leaves per thread.
+    static bsl::size_t grainSize(bsl::size_t numElements,
+                                 bsl::size_t requestedGrainSize,
+                                 int         numThreads);
+
+    /// Load into the specified `merges` the parts, of at most the specified
+    /// `grainSize` elements, of the merges of the pairs of adjacent runs
+    /// delimited by the specified `runBounds`, where run `i` is
+    /// `[runBounds[i], runBounds[i + 1])`, and replace `runBounds` with the
+    /// bounds of the merged runs.  A trailing unpaired run is "merged" with
+    /// an empty run.  The behavior is undefined unless `0 < grainSize` and
+    /// `runBounds` has at least two elements.
+    static void loadMergeParts(bsl::vector<MergePart>   *merges,
+                               bsl::vector<bsl::size_t> *runBounds,
+                               bsl::size_t               grainSize);
+
+    /// Load into the specified `bounds` the bounds of the leaves obtained
+    /// by recursively splitting a range of the specified `numElements` into
+    /// halves until each part has at most the specified `grainSize`
+    /// elements, where leaf `i` is `[(*bounds)[i], (*bounds)[i + 1])`.  If
+    /// `numElements` is 0, `bounds` is loaded with the single value 0.  The
+    /// behavior is undefined unless `0 < grainSize`.
+    static void partition(bsl::vector<bsl::size_t> *bounds,
+                          bsl::size_t               numElements,
+                          bsl::size_t               grainSize);
+
+    /// Process the specified `numLeaves` leaves by invoking the specified
+    /// `function` with the index of each leaf, on the calling thread and on
+    /// the threads of the specified `pool`, and return when every leaf has
+    /// been processed.  Note that the calling thread stops enqueuing jobs
+    /// on `pool` as soon as one is rejected.
+    template <class POOL>
+    static void run(POOL                *pool,
+                    bsl::size_t          numLeaves,
+                    const LeafFunction&  function);
+};
+
+                  // =======================================
+                  // class ParallelAlgorithmUtil_ForEachLeaf
+                  // =======================================
+
+/// This component-private class template processes a leaf of
+/// `parallelForEach`.
+template <class ITERATOR, class FUNCTION>
+class ParallelAlgorithmUtil_ForEachLeaf {
+
+    // DATA
+    ITERATOR                        d_first;     // start of the range
+    const FUNCTION                 *d_function_p;  // applied function
+    const bsl::vector<bsl::size_t> *d_bounds_p;  // leaf bounds
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor applying the specified `function` to the
+    /// leaves, delimited by the specified `bounds`, of the range starting at
+    /// the specified `first`.
+    ParallelAlgorithmUtil_ForEachLeaf(
+                                   ITERATOR                        first,
+                                   const FUNCTION                 *function,
+                                   const bsl::vector<bsl::size_t> *bounds);
+
+    // ACCESSORS
+
+    /// Apply a copy of the function to each element of the specified
+    /// `leaf`.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                 // =========================================
+                 // class ParallelAlgorithmUtil_TransformLeaf
+                 // =========================================
+
+/// This component-private class template processes a leaf of
+/// `parallelTransform`.
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+class ParallelAlgorithmUtil_TransformLeaf {
+
+    // DATA
+    INPUT_ITERATOR                  d_first;       // start of the input
+    OUTPUT_ITERATOR                 d_result;      // start of the output
+    const FUNCTION                 *d_function_p;  // applied function
+    const bsl::vector<bsl::size_t> *d_bounds_p;    // leaf bounds
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor storing, into the range starting at the
+    /// specified `result`, the specified `function` of the elements of the
+    /// leaves, delimited by the specified `bounds`, of the range starting at
+    /// the specified `first`.
+    ParallelAlgorithmUtil_TransformLeaf(
+                                   INPUT_ITERATOR                  first,
+                                   OUTPUT_ITERATOR                 result,
+                                   const FUNCTION                 *function,
+                                   const bsl::vector<bsl::size_t> *bounds);
+
+    // ACCESSORS
+
+    /// Store a copy of the function of each element of the specified
+    /// `leaf` into the corresponding element of the output.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                   // ======================================
+                   // class ParallelAlgorithmUtil_ReduceLeaf
+                   // ======================================
+
+/// This component-private class template processes a leaf of
+/// `parallelReduce`: it reduces the leaf, and either stores the partial
+/// result at the index of the leaf, or combines it, under a mutex, into the
+/// overall result.
+template <class ITERATOR, class TYPE, class OPERATION>
+class ParallelAlgorithmUtil_ReduceLeaf {
+
+    // DATA
+    ITERATOR                        d_first;        // start of the range
+    const OPERATION                *d_operation_p;  // reduction
+    const bsl::vector<bsl::size_t> *d_bounds_p;     // leaf bounds
+    bsl::vector<TYPE>              *d_partials_p;   // partial results, or 0
+    TYPE                           *d_result_p;     // overall result, if
+                                                    // `0 == d_partials_p`
+    bslmt::Mutex                   *d_mutex_p;      // protects `*d_result_p`
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor reducing, with the specified `operation`,
+    /// the leaves, delimited by the specified `bounds`, of the range
+    /// starting at the specified `first`, and storing the partial result of
+    /// each leaf into the specified `partials` or, if `partials` is 0,
+    /// combining it into the specified `result` under the specified
+    /// `mutex`.
+    ParallelAlgorithmUtil_ReduceLeaf(
+                                  ITERATOR                        first,
+                                  const OPERATION                *operation,
+                                  const bsl::vector<bsl::size_t> *bounds,
+                                  bsl::vector<TYPE>              *partials,
+                                  TYPE                           *result,
+                                  bslmt::Mutex                   *mutex);
+
+    // ACCESSORS
+
+    /// Reduce the specified `leaf`, and store or combine the partial
+    /// result.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                    // ====================================
+                    // class ParallelAlgorithmUtil_SortLeaf
+                    // ====================================
+
+/// This component-private class template sorts a leaf of `parallelSort`.
+template <class ITERATOR, class COMPARATOR>
+class ParallelAlgorithmUtil_SortLeaf {
+
+    // DATA
+    ITERATOR                        d_first;          // start of the range
+    const COMPARATOR               *d_comparator_p;   // ordering
+    const bsl::vector<bsl::size_t> *d_bounds_p;       // leaf bounds
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor sorting, according to the specified
+    /// `comparator`, the leaves, delimited by the specified `bounds`, of the
+    /// range starting at the specified `first`.
+    ParallelAlgorithmUtil_SortLeaf(ITERATOR                        first,
+                                   const COMPARATOR               *comparator,
+                                   const bsl::vector<bsl::size_t> *bounds);
+
+    // ACCESSORS
+
+    /// Sort the specified `leaf`.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                   // =====================================
+                   // class ParallelAlgorithmUtil_SplitLeaf
+                   // =====================================
+
+/// This component-private class template computes the elements of the first
+/// run merged by a part of a merge round of `parallelSort`.  The parts of a
+/// round are split before any is merged, because merging moves elements out
+/// of the source range.
+template <class SOURCE_ITERATOR, class COMPARATOR>
+class ParallelAlgorithmUtil_SplitLeaf {
+
+    // PRIVATE TYPES
+    typedef ParallelAlgorithmUtil_ImpUtil::MergePart MergePart;
+
+    // DATA
+    SOURCE_ITERATOR         d_source;        // start of the source
+    const COMPARATOR       *d_comparator_p;  // ordering
+    bsl::vector<MergePart> *d_parts_p;       // merge parts
+
+    // PRIVATE ACCESSORS
+
+    /// Return the number of elements of the specified sorted run `a`, of
+    /// the specified `numA` elements, among the first specified `diagonal`
+    /// elements of the merge of `a` with the specified sorted run `b`, of
+    /// the specified `numB` elements, where the elements of `a` precede the
+    /// equivalent elements of `b`.  The behavior is undefined unless
+    /// `diagonal <= numA + numB`.
+    bsl::size_t split(SOURCE_ITERATOR a,
+                      bsl::size_t     numA,
+                      SOURCE_ITERATOR b,
+                      bsl::size_t     numB,
+                      bsl::size_t     diagonal) const;
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor loading the split positions of the specified
+    /// `parts` of merges of sorted runs, according to the specified
+    /// `comparator`, of the range starting at the specified `source`.
+    ParallelAlgorithmUtil_SplitLeaf(SOURCE_ITERATOR         source,
+                                    const COMPARATOR       *comparator,
+                                    bsl::vector<MergePart> *parts);
+
+    // ACCESSORS
+
+    /// Load the split positions of the merge part having the specified
+    /// `leaf` index.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                   // =====================================
+                   // class ParallelAlgorithmUtil_MergeLeaf
+                   // =====================================
+
+/// This component-private class template performs a part of a merge round
+/// of `parallelSort`, moving elements from a source range to a destination
+/// range.
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+class ParallelAlgorithmUtil_MergeLeaf {
+
+    // PRIVATE TYPES
+    typedef ParallelAlgorithmUtil_ImpUtil::MergePart MergePart;
+
+    // DATA
+    SOURCE_ITERATOR               d_source;        // start of the source
+    DESTINATION_ITERATOR          d_destination;   // start of the destination
+    const COMPARATOR             *d_comparator_p;  // ordering
+    const bsl::vector<MergePart> *d_parts_p;       // merge parts
+
+  public:
+    // CREATORS
+
+    /// Create a leaf processor performing the specified `parts`, whose split
+    /// positions are loaded, of merges of sorted runs of the range starting
+    /// at the specified `source`, according to the specified `comparator`,
+    /// into the range starting at the specified `destination`.
+    ParallelAlgorithmUtil_MergeLeaf(
+                                  SOURCE_ITERATOR               source,
+                                  DESTINATION_ITERATOR          destination,
+                                  const COMPARATOR             *comparator,
+                                  const bsl::vector<MergePart> *parts);
+
+    // ACCESSORS
+
+    /// Perform the merge part having the specified `leaf` index.
+    void operator()(bsl::size_t leaf) const;
+};
+
+                        // ============================
+                        // struct ParallelAlgorithmUtil
+                        // ============================
+
+/// This `struct` provides a namespace for algorithms processing the
+/// elements of a random-access range in parallel on a thread pool.  In each
+/// function, the (template parameter) `POOL` is `bdlmt::FixedThreadPool` or
+/// `bdlmt::ThreadPool`, and the pool must be started for the algorithm to
+/// use its threads (otherwise, the calling thread does all the work).  The
+/// behavior is undefined if an applied function, operation, or comparator
+/// throws an exception.
+struct ParallelAlgorithmUtil {
+
+    // TYPES
+    enum ReduceOrder {
+        e_ANY_ORDER,       // partial results are combined as they complete
+        e_DETERMINISTIC    // partial results are combined in range order
+    };
+
+    enum {
+        k_LEAVES_PER_THREAD = 4  // leaves per thread for the default grain
+                                 // size
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Merge, according to the specified `comparator`, the pairs of
+    /// adjacent sorted runs, delimited by the specified `runBounds`, of the
+    /// range starting at the specified `source` into the range starting at
+    /// the specified `destination`, in parts of at most the specified
+    /// `grainSize` elements processed on the specified `pool`, and replace
+    /// `runBounds` with the bounds of the merged runs.
+    template <class POOL,
+              class SOURCE_ITERATOR,
+              class DESTINATION_ITERATOR,
+              class COMPARATOR>
+    static void mergeRound(POOL                     *pool,
+                           SOURCE_ITERATOR           source,
+                           DESTINATION_ITERATOR      destination,
+                           bsl::vector<bsl::size_t> *runBounds,
+                           bsl::size_t               grainSize,
+                           const COMPARATOR&         comparator);
+
+  public:
+    // CLASS METHODS
+
+    /// Invoke a copy of the specified `function` on each element of the
+    /// range `[first, last)`, in parallel on the threads of the specified
+    /// `pool` and the calling thread, and return once `function` has been
+    /// invoked on every element.  Optionally specify a `grainSize`, the
+    /// maximum number of elements processed sequentially by one thread; if
+    /// `grainSize` is 0 or not specified, it is chosen from the number of
+    /// elements and threads (see {Partitioning and Grain Size}).  The
+    /// behavior is undefined unless `[first, last)` is a valid range.  Note
+    /// that `function` may be invoked concurrently on distinct copies, and
+    /// that the order of invocations is unspecified.
+    template <class POOL, class RANDOM_ITERATOR, class FUNCTION>
+    static void parallelForEach(POOL            *pool,
+                                RANDOM_ITERATOR  first,
+                                RANDOM_ITERATOR  last,
+                                const FUNCTION&  function,
+                                bsl::size_t      grainSize = 0);
+
+    /// Return the result of combining, with the specified `operation`, the
+    /// specified `initialValue` and the elements of the range
+    /// `[first, last)`, computed in parallel on the threads of the specified
+    /// `pool` and the calling thread.  Optionally specify an `order` in which
+    /// the partial results of the leaves are combined; if `order` is not
+    /// specified, `e_ANY_ORDER` is used (see {Reduction Order}).  Optionally
+    /// specify a `grainSize`, the maximum number of elements reduced
+    /// sequentially by one thread; if `grainSize` is 0 or not specified, it
+    /// is chosen from the number of elements and threads.  `TYPE` must be
+    /// copy-constructible, copy-assignable, and constructible from the
+    /// elements of the range.  The behavior is undefined unless
+    /// `[first, last)` is a valid range and `operation` is associative (and,
+    /// unless `order` is `e_DETERMINISTIC`, commutative).
+    template <class POOL, class RANDOM_ITERATOR, class TYPE, class OPERATION>
+    static TYPE parallelReduce(POOL             *pool,
+                               RANDOM_ITERATOR   first,
+                               RANDOM_ITERATOR   last,
+                               const TYPE&       initialValue,
+                               const OPERATION&  operation,
+                               ReduceOrder       order = e_ANY_ORDER,
+                               bsl::size_t       grainSize = 0);
+
+    /// Sort the elements of the range `[first, last)` in ascending order,
+    /// according to `operator<` or, if specified, the specified
+    /// `comparator`, in parallel on the threads of the specified `pool` and
+    /// the calling thread.  Optionally specify a `grainSize`, the maximum
+    /// number of elements sorted or merged sequentially by one thread; if
+    /// `grainSize` is 0 or not specified, it is chosen from the number of
+    /// elements and threads.  The sort is not stable.  The elements must be
+    /// copy-constructible and move-assignable.  The behavior is undefined
+    /// unless `[first, last)` is a valid range and `comparator` induces a
+    /// strict weak ordering.
+    template <class POOL, class RANDOM_ITERATOR>
+    static void parallelSort(POOL            *pool,
+                             RANDOM_ITERATOR  first,
+                             RANDOM_ITERATOR  last);
+    template <class POOL, class RANDOM_ITERATOR, class COMPARATOR>
+    static void parallelSort(POOL              *pool,
+                             RANDOM_ITERATOR    first,
+                             RANDOM_ITERATOR    last,
+                             const COMPARATOR&  comparator,
+                             bsl::size_t        grainSize = 0);
+
+    /// Store, into the range of the same length starting at the specified
+    /// `result`, the result of a copy of the specified `function` invoked on
+    /// each element of the range `[first, last)`, in parallel on the threads
+    /// of the specified `pool` and the calling thread, and return the end of
+    /// the output range.  Optionally specify a `grainSize`, the maximum
+    /// number of elements processed sequentially by one thread; if
+    /// `grainSize` is 0 or not specified, it is chosen from the number of
+    /// elements and threads.  The behavior is undefined unless
+    /// `[first, last)` is a valid range, and the output range is valid and
+    /// does not overlap with the input range unless `result == first`.
+    template <class POOL,
+              class RANDOM_INPUT_ITERATOR,
+              class RANDOM_OUTPUT_ITERATOR,
+              class FUNCTION>
+    static RANDOM_OUTPUT_ITERATOR parallelTransform(
+                                  POOL                   *pool,
+                                  RANDOM_INPUT_ITERATOR   first,
+                                  RANDOM_INPUT_ITERATOR   last,
+                                  RANDOM_OUTPUT_ITERATOR  result,
+                                  const FUNCTION&         function,
+                                  bsl::size_t             grainSize = 0);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // ------------------------------------
+                    // struct ParallelAlgorithmUtil_ImpUtil
+                    // ------------------------------------
+
+// CLASS METHODS
+inline
+int ParallelAlgorithmUtil_ImpUtil::concurrency(const FixedThreadPool *pool)
+{
+    BSLS_ASSERT(pool);
+
+    return pool->numThreads();
+}
+
+inline
+int ParallelAlgorithmUtil_ImpUtil::concurrency(const ThreadPool *pool)
+{
+    BSLS_ASSERT(pool);
+
+    return pool->maxThreads();
+}
+
+inline
+int ParallelAlgorithmUtil_ImpUtil::enqueueJob(FixedThreadPool            *pool,
+                                              const FixedThreadPool::Job&  job)
+{
+    BSLS_ASSERT(pool);
+
+    return pool->tryEnqueueJob(job);
+}
+
+inline
+int ParallelAlgorithmUtil_ImpUtil::enqueueJob(ThreadPool             *pool,
+                                              const ThreadPool::Job&  job)
+{
+    BSLS_ASSERT(pool);
+
+    return pool->enqueueJob(job);
+}
+
+template <class POOL>
+void ParallelAlgorithmUtil_ImpUtil::run(POOL                *pool,
+                                        bsl::size_t          numLeaves,
+                                        const LeafFunction&  function)
+{
+    if (0 == numLeaves) {
+        return;                                                       // RETURN
+    }
+
+    if (1 == numLeaves) {
+        function(0);
+        return;                                                       // RETURN
+    }
+
+    // The batch is shared with the jobs, which might run after this function
+    // returns (once every leaf is claimed, a late job returns without
+    // invoking `function`).
+
+    bsl::shared_ptr<ParallelAlgorithmUtil_Batch> batch;
+    batch.createInplace(bslma::Default::defaultAllocator(),
+                        numLeaves,
+                        function);
+
+    const bsl::size_t numJobs = bsl::min<bsl::size_t>(
+                                          numLeaves - 1,
+                                          static_cast<bsl::size_t>(
+                                              bsl::max(0, concurrency(pool))));
+
+    // Helper jobs are optional: the calling thread processes any leaf that
+    // no job claims, so a job that cannot be enqueued without blocking is
+    // not enqueued.
+
+    for (bsl::size_t i = 0; i < numJobs; ++i) {
+        if (0 != enqueueJob(pool,
+                            bdlf::BindUtil::bind(
+                                         &ParallelAlgorithmUtil_Batch::help,
+                                         batch))) {
+            break;
+        }
+    }
+
+    batch->work();
+    batch->wait();
+}
+
+                  // ---------------------------------------
+                  // class ParallelAlgorithmUtil_ForEachLeaf
+                  // ---------------------------------------
+
+// CREATORS
+template <class ITERATOR, class FUNCTION>
+inline
+ParallelAlgorithmUtil_ForEachLeaf<ITERATOR, FUNCTION>::
+ParallelAlgorithmUtil_ForEachLeaf(ITERATOR                        first,
+                                  const FUNCTION                 *function,
+                                  const bsl::vector<bsl::size_t> *bounds)
+: d_first(first)
+, d_function_p(function)
+, d_bounds_p(bounds)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class FUNCTION>
+void ParallelAlgorithmUtil_ForEachLeaf<ITERATOR, FUNCTION>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    FUNCTION function(*d_function_p);
+
+    const ITERATOR end = d_first + (*d_bounds_p)[leaf + 1];
+    for (ITERATOR it = d_first + (*d_bounds_p)[leaf]; it != end; ++it) {
+        function(*it);
+    }
+}
+
+                 // -----------------------------------------
+                 // class ParallelAlgorithmUtil_TransformLeaf
+                 // -----------------------------------------
+
+// CREATORS
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+inline
+ParallelAlgorithmUtil_TransformLeaf<INPUT_ITERATOR,
+                                    OUTPUT_ITERATOR,
+                                    FUNCTION>::
+ParallelAlgorithmUtil_TransformLeaf(INPUT_ITERATOR                  first,
+                                    OUTPUT_ITERATOR                 result,
+                                    const FUNCTION                 *function,
+                                    const bsl::vector<bsl::size_t> *bounds)
+: d_first(first)
+, d_result(result)
+, d_function_p(function)
+, d_bounds_p(bounds)
+{
+}
+
+// ACCESSORS
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+void ParallelAlgorithmUtil_TransformLeaf<INPUT_ITERATOR,
+                                         OUTPUT_ITERATOR,
+                                         FUNCTION>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    FUNCTION function(*d_function_p);
+
+    const bsl::size_t begin = (*d_bounds_p)[leaf];
+    const bsl::size_t end   = (*d_bounds_p)[leaf + 1];
+
+    INPUT_ITERATOR  input  = d_first  + begin;
+    OUTPUT_ITERATOR output = d_result + begin;
+    for (bsl::size_t i = begin; i < end; ++i, ++input, ++output) {
+        *output = function(*input);
+    }
+}
+
+                   // --------------------------------------
+                   // class ParallelAlgorithmUtil_ReduceLeaf
+                   // --------------------------------------
+
+// CREATORS
+template <class ITERATOR, class TYPE, class OPERATION>
+inline
+ParallelAlgorithmUtil_ReduceLeaf<ITERATOR, TYPE, OPERATION>::
+ParallelAlgorithmUtil_ReduceLeaf(ITERATOR                        first,
+                                 const OPERATION                *operation,
+                                 const bsl::vector<bsl::size_t> *bounds,
+                                 bsl::vector<TYPE>              *partials,
+                                 TYPE                           *result,
+                                 bslmt::Mutex                   *mutex)
+: d_first(first)
+, d_operation_p(operation)
+, d_bounds_p(bounds)
+, d_partials_p(partials)
+, d_result_p(result)
+, d_mutex_p(mutex)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class TYPE, class OPERATION>
+void ParallelAlgorithmUtil_ReduceLeaf<ITERATOR, TYPE, OPERATION>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    const ITERATOR end = d_first + (*d_bounds_p)[leaf + 1];
+    ITERATOR       it  = d_first + (*d_bounds_p)[leaf];
+
+    BSLS_ASSERT(it != end);
+
+    TYPE partial(*it);
+    for (++it; it != end; ++it) {
+        partial = (*d_operation_p)(partial, *it);
+    }
+
+    if (d_partials_p) {
+        (*d_partials_p)[leaf] = partial;
+    }
+    else {
+        bslmt::LockGuard<bslmt::Mutex> guard(d_mutex_p);
+
+        *d_result_p = (*d_operation_p)(*d_result_p, partial);
+    }
+}
+
+                    // ------------------------------------
+                    // class ParallelAlgorithmUtil_SortLeaf
+                    // ------------------------------------
+
+// CREATORS
+template <class ITERATOR, class COMPARATOR>
+inline
+ParallelAlgorithmUtil_SortLeaf<ITERATOR, COMPARATOR>::
+ParallelAlgorithmUtil_SortLeaf(ITERATOR                        first,
+                               const COMPARATOR               *comparator,
+                               const bsl::vector<bsl::size_t> *bounds)
+: d_first(first)
+, d_comparator_p(comparator)
+, d_bounds_p(bounds)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class COMPARATOR>
+inline
+void ParallelAlgorithmUtil_SortLeaf<ITERATOR, COMPARATOR>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    bsl::sort(d_first + (*d_bounds_p)[leaf],
+              d_first + (*d_bounds_p)[leaf + 1],
+              *d_comparator_p);
+}
+
+                   // -------------------------------------
+                   // class ParallelAlgorithmUtil_SplitLeaf
+                   // -------------------------------------
+
+// PRIVATE ACCESSORS
+template <class SOURCE_ITERATOR, class COMPARATOR>
+bsl::size_t
+ParallelAlgorithmUtil_SplitLeaf<SOURCE_ITERATOR, COMPARATOR>::split(
+                                              SOURCE_ITERATOR a,
+                                              bsl::size_t     numA,
+                                              SOURCE_ITERATOR b,
+                                              bsl::size_t     numB,
+                                              bsl::size_t     diagonal) const
+{
+    BSLS_ASSERT(diagonal <= numA + numB);
+
+    // Binary search, on the merge path, for the first element of `a` that
+    // is not among the first `diagonal` elements of the merged run.
+
+    bsl::size_t low  = diagonal > numB ? diagonal - numB : 0;
+    bsl::size_t high = bsl::min(diagonal, numA);
+
+    while (low < high) {
+        const bsl::size_t middle = low + (high - low) / 2;
+        if (!(*d_comparator_p)(b[diagonal - middle - 1], a[middle])) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// CREATORS
+template <class SOURCE_ITERATOR, class COMPARATOR>
+inline
+ParallelAlgorithmUtil_SplitLeaf<SOURCE_ITERATOR, COMPARATOR>::
+ParallelAlgorithmUtil_SplitLeaf(SOURCE_ITERATOR         source,
+                                const COMPARATOR       *comparator,
+                                bsl::vector<MergePart> *parts)
+: d_source(source)
+, d_comparator_p(comparator)
+, d_parts_p(parts)
+{
+}
+
+// ACCESSORS
+template <class SOURCE_ITERATOR, class COMPARATOR>
+void ParallelAlgorithmUtil_SplitLeaf<SOURCE_ITERATOR, COMPARATOR>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    MergePart& part = (*d_parts_p)[leaf];
+
+    const SOURCE_ITERATOR a = d_source + part.d_begin;
+    const SOURCE_ITERATOR b = d_source + part.d_middle;
+
+    const bsl::size_t numA = part.d_middle - part.d_begin;
+    const bsl::size_t numB = part.d_end    - part.d_middle;
+
+    part.d_splitBegin = split(a, numA, b, numB, part.d_outBegin);
+    part.d_splitEnd   = split(a, numA, b, numB, part.d_outEnd);
+}
+
+                   // -------------------------------------
+                   // class ParallelAlgorithmUtil_MergeLeaf
+                   // -------------------------------------
+
+// CREATORS
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+inline
+ParallelAlgorithmUtil_MergeLeaf<SOURCE_ITERATOR,
+                                DESTINATION_ITERATOR,
+                                COMPARATOR>::
+ParallelAlgorithmUtil_MergeLeaf(SOURCE_ITERATOR               source,
+                                DESTINATION_ITERATOR          destination,
+                                const COMPARATOR             *comparator,
+                                const bsl::vector<MergePart> *parts)
+: d_source(source)
+, d_destination(destination)
+, d_comparator_p(comparator)
+, d_parts_p(parts)
+{
+}
+
+// ACCESSORS
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+void ParallelAlgorithmUtil_MergeLeaf<SOURCE_ITERATOR,
+                                     DESTINATION_ITERATOR,
+                                     COMPARATOR>::operator()(
+                                                        bsl::size_t leaf) const
+{
+    const MergePart&  part       = (*d_parts_p)[leaf];
+    const COMPARATOR& comparator = *d_comparator_p;
+
+    const SOURCE_ITERATOR a = d_source + part.d_begin;
+    const SOURCE_ITERATOR b = d_source + part.d_middle;
+
+    bsl::size_t       i    = part.d_splitBegin;
+    bsl::size_t       j    = part.d_outBegin - i;
+    const bsl::size_t endI = part.d_splitEnd;
+    const bsl::size_t endJ = part.d_outEnd - endI;
+
+    DESTINATION_ITERATOR output = d_destination + part.d_begin
+                                                + part.d_outBegin;
+
+    while (i < endI && j < endJ) {
+        if (comparator(b[j], a[i])) {
+            *output = bslmf::MovableRefUtil::move(b[j]);
+            ++j;
+        }
+        else {
+            *output = bslmf::MovableRefUtil::move(a[i]);
+            ++i;
+        }
+        ++output;
+    }
+    for (; i < endI; ++i, ++output) {
+        *output = bslmf::MovableRefUtil::move(a[i]);
+    }
+    for (; j < endJ; ++j, ++output) {
+        *output = bslmf::MovableRefUtil::move(b[j]);
+    }
+}
+
+                        // ----------------------------
+                        // struct ParallelAlgorithmUtil
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+template <class POOL,
+          class SOURCE_ITERATOR,
+          class DESTINATION_ITERATOR,
+          class COMPARATOR>
+void ParallelAlgorithmUtil::mergeRound(POOL                     *pool,
+                                       SOURCE_ITERATOR           source,
+                                       DESTINATION_ITERATOR      destination,
+                                       bsl::vector<bsl::size_t> *runBounds,
+                                       bsl::size_t               grainSize,
+                                       const COMPARATOR&         comparator)
+{
+    typedef ParallelAlgorithmUtil_ImpUtil::MergePart MergePart;
+
+    bsl::vector<MergePart> parts;
+    ParallelAlgorithmUtil_ImpUtil::loadMergeParts(&parts,
+                                                  runBounds,
+                                                  grainSize);
+
+    ParallelAlgorithmUtil_ImpUtil::run(
+        pool,
+        parts.size(),
+        ParallelAlgorithmUtil_SplitLeaf<SOURCE_ITERATOR, COMPARATOR>(
+                                                                  source,
+                                                                  &comparator,
+                                                                  &parts));
+
+    ParallelAlgorithmUtil_ImpUtil::run(
+        pool,
+        parts.size(),
+        ParallelAlgorithmUtil_MergeLeaf<SOURCE_ITERATOR,
+                                        DESTINATION_ITERATOR,
+                                        COMPARATOR>(source,
+                                                    destination,
+                                                    &comparator,
+                                                    &parts));
+}
+
+// CLASS METHODS
+template <class POOL, class RANDOM_ITERATOR, class FUNCTION>
+void ParallelAlgorithmUtil::parallelForEach(POOL            *pool,
+                                            RANDOM_ITERATOR  first,
+                                            RANDOM_ITERATOR  last,
+                                            const FUNCTION&  function,
+                                            bsl::size_t      grainSize)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_ImpUtil ImpUtil;
+
+    const bsl::size_t numElements = last - first;
+
+    bsl::vector<bsl::size_t> bounds;
+    ImpUtil::partition(&bounds,
+                       numElements,
+                       ImpUtil::grainSize(numElements,
+                                          grainSize,
+                                          ImpUtil::concurrency(pool)));
+
+    ImpUtil::run(pool,
+                 bounds.size() - 1,
+                 ParallelAlgorithmUtil_ForEachLeaf<RANDOM_ITERATOR, FUNCTION>(
+                                                                   first,
+                                                                   &function,
+                                                                   &bounds));
+}
+
+template <class POOL, class RANDOM_ITERATOR, class TYPE, class OPERATION>
+TYPE ParallelAlgorithmUtil::parallelReduce(POOL             *pool,
+                                           RANDOM_ITERATOR   first,
+                                           RANDOM_ITERATOR   last,
+                                           const TYPE&       initialValue,
+                                           const OPERATION&  operation,
+                                           ReduceOrder       order,
+                                           bsl::size_t       grainSize)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_ImpUtil                             ImpUtil;
+    typedef ParallelAlgorithmUtil_ReduceLeaf<RANDOM_ITERATOR,
+                                             TYPE,
+                                             OPERATION>               Leaf;
+
+    const bsl::size_t numElements = last - first;
+
+    bsl::vector<bsl::size_t> bounds;
+    ImpUtil::partition(&bounds,
+                       numElements,
+                       ImpUtil::grainSize(numElements,
+                                          grainSize,
+                                          ImpUtil::concurrency(pool)));
+
+    const bsl::size_t numLeaves = bounds.size() - 1;
+
+    TYPE result(initialValue);
+
+    if (e_DETERMINISTIC == order) {
+        bsl::vector<TYPE> partials(numLeaves, initialValue);
+
+        ImpUtil::run(pool,
+                     numLeaves,
+                     Leaf(first, &operation, &bounds, &partials, 0, 0));
+
+        for (bsl::size_t i = 0; i < numLeaves; ++i) {
+            result = operation(result, partials[i]);
+        }
+    }
+    else {
+        bslmt::Mutex mutex;
+
+        ImpUtil::run(pool,
+                     numLeaves,
+                     Leaf(first, &operation, &bounds, 0, &result, &mutex));
+    }
+
+    return result;
+}
+
+template <class POOL, class RANDOM_ITERATOR>
+inline
+void ParallelAlgorithmUtil::parallelSort(POOL            *pool,
+                                         RANDOM_ITERATOR  first,
+                                         RANDOM_ITERATOR  last)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type
+                                                                     ValueType;
+
+    parallelSort(pool, first, last, bsl::less<ValueType>());
+}
+
+template <class POOL, class RANDOM_ITERATOR, class COMPARATOR>
+void ParallelAlgorithmUtil::parallelSort(POOL              *pool,
+                                         RANDOM_ITERATOR    first,
+                                         RANDOM_ITERATOR    last,
+                                         const COMPARATOR&  comparator,
+                                         bsl::size_t        grainSize)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_ImpUtil ImpUtil;
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type
+                                                                     ValueType;
+
+    const bsl::size_t numElements = last - first;
+    const bsl::size_t grain       = ImpUtil::grainSize(
+                                                   numElements,
+                                                   grainSize,
+                                                   ImpUtil::concurrency(pool));
+
+    bsl::vector<bsl::size_t> runBounds;
+    ImpUtil::partition(&runBounds, numElements, grain);
+
+    if (runBounds.size() <= 2) {
+        bsl::sort(first, last, comparator);
+        return;                                                       // RETURN
+    }
+
+    ImpUtil::run(pool,
+                 runBounds.size() - 1,
+                 ParallelAlgorithmUtil_SortLeaf<RANDOM_ITERATOR, COMPARATOR>(
+                                                                  first,
+                                                                  &comparator,
+                                                                  &runBounds));
+
+    // Merge the sorted runs in rounds, alternating between the range and a
+    // buffer of the same size.
+
+    bsl::vector<ValueType> buffer(first, last);
+    bool                   isInBuffer = false;
+
+    while (runBounds.size() > 2) {
+        if (isInBuffer) {
+            mergeRound(pool,
+                       buffer.begin(),
+                       first,
+                       &runBounds,
+                       grain,
+                       comparator);
+        }
+        else {
+            mergeRound(pool,
+                       first,
+                       buffer.begin(),
+                       &runBounds,
+                       grain,
+                       comparator);
+        }
+        isInBuffer = !isInBuffer;
+    }
+
+    if (isInBuffer) {
+        // Move the elements back, "merging" the single sorted run with an
+        // empty run, in parallel.
+
+        mergeRound(pool, buffer.begin(), first, &runBounds, grain, comparator);
+    }
+}
+
+template <class POOL,
+          class RANDOM_INPUT_ITERATOR,
+          class RANDOM_OUTPUT_ITERATOR,
+          class FUNCTION>
+RANDOM_OUTPUT_ITERATOR ParallelAlgorithmUtil::parallelTransform(
+                                        POOL                   *pool,
+                                        RANDOM_INPUT_ITERATOR   first,
+                                        RANDOM_INPUT_ITERATOR   last,
+                                        RANDOM_OUTPUT_ITERATOR  result,
+                                        const FUNCTION&         function,
+                                        bsl::size_t             grainSize)
+{
+    BSLS_ASSERT(pool);
+
+    typedef ParallelAlgorithmUtil_ImpUtil ImpUtil;
+
+    const bsl::size_t numElements = last - first;
+
+    bsl::vector<bsl::size_t> bounds;
+    ImpUtil::partition(&bounds,
+                       numElements,
+                       ImpUtil::grainSize(numElements,
+                                          grainSize,
+                                          ImpUtil::concurrency(pool)));
+
+    ImpUtil::run(pool,
+                 bounds.size() - 1,
+                 ParallelAlgorithmUtil_TransformLeaf<RANDOM_INPUT_ITERATOR,
+                                                     RANDOM_OUTPUT_ITERATOR,
+                                                     FUNCTION>(first,
+                                                               result,
+                                                               &function,
+                                                               &bounds));
+
+    return result + numElements;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
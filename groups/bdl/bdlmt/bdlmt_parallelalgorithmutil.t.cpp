@@ -0,0 +1,1078 @@
+// bdlmt_parallelalgorithmutil.t.cpp                                  -*-C++-*-
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_numeric.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// `bdlmt::ParallelAlgorithmUtil` provides algorithms whose results must be
+// those of the corresponding sequential algorithms, for every number of
+// elements, grain size, and pool.  We first test the component-private
+// partitioning functions, and then compare each algorithm with its
+// sequential counterpart on ranges of a selection of sizes (including 0, 1,
+// and sizes that are not powers of two), with explicit grain sizes and the
+// default one, on both kinds of pool.  We also verify that an algorithm
+// invoked from a job of a single-threaded pool, on that same pool, completes,
+// and that a deterministic reduction with a non-commutative operation
+// matches the sequential one.  A negative test case reports the scaling of
+// the algorithms with the number of threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void parallelForEach(POOL *, IT, IT, const FUNC&, size_t = 0);
+// [ 5] TYPE parallelReduce(POOL *, IT, IT, const TYPE&, const OP&, ...);
+// [ 6] void parallelSort(POOL *, IT, IT);
+// [ 6] void parallelSort(POOL *, IT, IT, const COMP&, size_t = 0);
+// [ 4] OUT parallelTransform(POOL *, IN, IN, OUT, const FUNC&, size_t);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] PARTITIONING
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ParallelAlgorithmUtil         Util;
+typedef bdlmt::ParallelAlgorithmUtil_ImpUtil ImpUtil;
+
+/// Numbers of elements of the tested ranges.
+const bsl::size_t SIZES[] = { 0, 1, 2, 3, 7, 8, 100, 1000, 1023, 4097 };
+const int         NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+/// Grain sizes used to process the tested ranges (0 selects the default).
+const bsl::size_t GRAINS[] = { 0, 1, 3, 64, 100000 };
+const int         NUM_GRAINS = static_cast<int>(sizeof GRAINS /
+                                                sizeof *GRAINS);
+
+// ============================================================================
+//                   GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Load into the specified `values` the specified `size` pseudo-random
+/// values derived from the specified `seed`, in `[0, 1000)`.
+void loadRandom(bsl::vector<int> *values, bsl::size_t size, unsigned seed)
+{
+    values->resize(size);
+    for (bsl::size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        (*values)[i] = static_cast<int>((seed >> 8) % 1000);
+    }
+}
+
+/// This functor increments the value it is invoked on.
+struct Increment {
+    void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+/// This functor returns its argument multiplied by 3, plus 1.
+struct Affine {
+    long long operator()(int value) const
+    {
+        return 3LL * value + 1;
+    }
+};
+
+/// This functor returns the concatenation of its arguments, an associative
+/// but not commutative operation.
+struct Concatenate {
+    bsl::string operator()(const bsl::string& lhs,
+                           const bsl::string& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+/// This functor returns the square root of its argument.
+struct SquareRoot {
+    double operator()(double value) const
+    {
+        return bsl::sqrt(value);
+    }
+};
+
+/// This functor orders integers by their last decimal digit, and then
+/// decreasingly.
+struct LastDigitThenGreater {
+    bool operator()(int lhs, int rhs) const
+    {
+        if (lhs % 10 != rhs % 10) {
+            return lhs % 10 < rhs % 10;                               // RETURN
+        }
+        return lhs > rhs;
+    }
+};
+
+/// This `struct` holds the arguments of `nestedForEach`.
+struct NestedArgs {
+    bdlmt::FixedThreadPool *d_pool_p;
+    bsl::vector<int>       *d_values_p;
+    bslmt::Latch           *d_done_p;
+};
+
+/// Increment, from a job of the pool of the specified `args`, the values of
+/// `args` in parallel on that same pool, and arrive on the latch of `args`.
+void nestedForEach(NestedArgs *args)
+{
+    Util::parallelForEach(args->d_pool_p,
+                          args->d_values_p->begin(),
+                          args->d_values_p->end(),
+                          Increment(),
+                          1);
+    args->d_done_p->arrive();
+}
+
+/// Verify, for each tested size and grain, that `parallelForEach` on the
+/// specified `pool` increments every element exactly once.
+template <class POOL>
+void testForEach(POOL *pool)
+{
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const bsl::size_t SIZE = SIZES[ti];
+
+        for (int tj = 0; tj < NUM_GRAINS; ++tj) {
+            const bsl::size_t GRAIN = GRAINS[tj];
+
+            bsl::vector<int> values;
+            loadRandom(&values, SIZE, static_cast<unsigned>(ti));
+
+            bsl::vector<int> expected(values);
+            bsl::for_each(expected.begin(), expected.end(), Increment());
+
+            Util::parallelForEach(pool,
+                                  values.begin(),
+                                  values.end(),
+                                  Increment(),
+                                  GRAIN);
+
+            ASSERTV(SIZE, GRAIN, expected == values);
+        }
+    }
+}
+
+/// Verify, for each tested size and grain, that `parallelTransform` on the
+/// specified `pool` produces the same output as `bsl::transform`.
+template <class POOL>
+void testTransform(POOL *pool)
+{
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const bsl::size_t SIZE = SIZES[ti];
+
+        for (int tj = 0; tj < NUM_GRAINS; ++tj) {
+            const bsl::size_t GRAIN = GRAINS[tj];
+
+            bsl::vector<int> values;
+            loadRandom(&values, SIZE, static_cast<unsigned>(ti));
+
+            bsl::vector<long long> expected(SIZE);
+            bsl::transform(values.begin(),
+                           values.end(),
+                           expected.begin(),
+                           Affine());
+
+            bsl::vector<long long> results(SIZE, -1);
+
+            const bsl::vector<long long>::iterator end =
+                                 Util::parallelTransform(pool,
+                                                         values.begin(),
+                                                         values.end(),
+                                                         results.begin(),
+                                                         Affine(),
+                                                         GRAIN);
+
+            ASSERTV(SIZE, GRAIN, results.end() == end);
+            ASSERTV(SIZE, GRAIN, expected == results);
+        }
+    }
+}
+
+/// Verify, for each tested size and grain, that `parallelReduce` on the
+/// specified `pool` produces the sequential result in both orders, and, in
+/// deterministic order, with a non-commutative operation.
+template <class POOL>
+void testReduce(POOL *pool)
+{
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const bsl::size_t SIZE = SIZES[ti];
+
+        bsl::vector<int> values;
+        loadRandom(&values, SIZE, static_cast<unsigned>(ti));
+
+        const long long EXP_SUM = bsl::accumulate(values.begin(),
+                                                  values.end(),
+                                                  17LL);
+
+        bsl::vector<bsl::string> words(SIZE);
+        for (bsl::size_t i = 0; i < SIZE; ++i) {
+            words[i] = static_cast<char>('a' + values[i] % 26);
+        }
+        const bsl::string EXP_WORD = bsl::accumulate(words.begin(),
+                                                     words.end(),
+                                                     bsl::string("<"));
+
+        for (int tj = 0; tj < NUM_GRAINS; ++tj) {
+            const bsl::size_t GRAIN = GRAINS[tj];
+
+            long long sum = Util::parallelReduce(pool,
+                                                 values.begin(),
+                                                 values.end(),
+                                                 17LL,
+                                                 bsl::plus<long long>(),
+                                                 Util::e_ANY_ORDER,
+                                                 GRAIN);
+            ASSERTV(SIZE, GRAIN, EXP_SUM == sum);
+
+            sum = Util::parallelReduce(pool,
+                                       values.begin(),
+                                       values.end(),
+                                       17LL,
+                                       bsl::plus<long long>(),
+                                       Util::e_DETERMINISTIC,
+                                       GRAIN);
+            ASSERTV(SIZE, GRAIN, EXP_SUM == sum);
+
+            const bsl::string word = Util::parallelReduce(
+                                                        pool,
+                                                        words.begin(),
+                                                        words.end(),
+                                                        bsl::string("<"),
+                                                        Concatenate(),
+                                                        Util::e_DETERMINISTIC,
+                                                        GRAIN);
+            ASSERTV(SIZE, GRAIN, EXP_WORD == word);
+        }
+    }
+}
+
+/// Verify, for each tested size and grain, that `parallelSort` on the
+/// specified `pool` sorts integers, with the default and a custom
+/// comparator, and strings.
+template <class POOL>
+void testSort(POOL *pool)
+{
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const bsl::size_t SIZE = SIZES[ti];
+
+        for (int tj = 0; tj < NUM_GRAINS; ++tj) {
+            const bsl::size_t GRAIN = GRAINS[tj];
+
+            bsl::vector<int> values;
+            loadRandom(&values, SIZE, static_cast<unsigned>(ti + tj));
+
+            bsl::vector<int> expected(values);
+            bsl::sort(expected.begin(), expected.end());
+
+            bsl::vector<int> results(values);
+            Util::parallelSort(pool,
+                               results.begin(),
+                               results.end(),
+                               bsl::less<int>(),
+                               GRAIN);
+            ASSERTV(SIZE, GRAIN, expected == results);
+
+            bsl::sort(expected.begin(),
+                      expected.end(),
+                      LastDigitThenGreater());
+
+            results = values;
+            Util::parallelSort(pool,
+                               results.begin(),
+                               results.end(),
+                               LastDigitThenGreater(),
+                               GRAIN);
+            ASSERTV(SIZE, GRAIN, expected == results);
+
+            bsl::vector<bsl::string> words(SIZE);
+            for (bsl::size_t i = 0; i < SIZE; ++i) {
+                words[i].assign(static_cast<bsl::size_t>(values[i] % 7),
+                                static_cast<char>('a' + values[i] % 3));
+                words[i].append(100, 'x');  // not a short string
+            }
+
+            bsl::vector<bsl::string> expectedWords(words);
+            bsl::sort(expectedWords.begin(), expectedWords.end());
+
+            Util::parallelSort(pool,
+                               words.begin(),
+                               words.end(),
+                               bsl::less<bsl::string>(),
+                               GRAIN);
+            ASSERTV(SIZE, GRAIN, expectedWords == words);
+        }
+
+        bsl::vector<int> values;
+        loadRandom(&values, SIZE, static_cast<unsigned>(ti));
+
+        bsl::vector<int> expected(values);
+        bsl::sort(expected.begin(), expected.end());
+
+        Util::parallelSort(pool, values.begin(), values.end());
+        ASSERTV(SIZE, expected == values);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Pricing a Portfolio
+/// - - - - - - - - - - - - - - -
+// Suppose that we compute the value of a portfolio of positions, and that
+// pricing a position is expensive, so we want to price the positions in
+// parallel on a thread pool.
+//
+// First, we define the function that prices a position:
+// ```
+    double price(int position)
+    {
+        return position * 1.5;
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create and start a thread pool:
+// ```
+    bdlmt::FixedThreadPool pool(4, 100);
+    pool.start();
+// ```
+// Next, we create the positions, and price them in parallel:
+// ```
+    bsl::vector<int> positions;
+    for (int i = 1; i <= 1000; ++i) {
+        positions.push_back(i);
+    }
+
+    bsl::vector<double> prices(positions.size());
+    bdlmt::ParallelAlgorithmUtil::parallelTransform(&pool,
+                                                    positions.begin(),
+                                                    positions.end(),
+                                                    prices.begin(),
+                                                    &price);
+    ASSERT(1500.0 == prices[999]);
+// ```
+// Now, we add the prices, in a deterministic order, so that the value of the
+// portfolio is reproducible:
+// ```
+    double value = bdlmt::ParallelAlgorithmUtil::parallelReduce(
+                             &pool,
+                             prices.begin(),
+                             prices.end(),
+                             0.0,
+                             bsl::plus<double>(),
+                             bdlmt::ParallelAlgorithmUtil::e_DETERMINISTIC);
+    ASSERT(1.5 * 500 * 1001 == value);
+// ```
+// Finally, we sort the prices in decreasing order:
+// ```
+    bdlmt::ParallelAlgorithmUtil::parallelSort(&pool,
+                                               prices.begin(),
+                                               prices.end(),
+                                               bsl::greater<double>());
+    ASSERT(1500.0 == prices[0]);
+
+    pool.stop();
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // `parallelSort`
+        //
+        // Concerns:
+        // 1. The range is sorted according to the comparator, or to
+        //    `operator<` if none is specified, whatever the number of
+        //    elements and the grain size, including when the number of runs
+        //    is odd and when the result of the last merge round is in the
+        //    buffer.
+        //
+        // 2. Elements owning memory are moved without corruption.
+        //
+        // 3. The algorithm works with both kinds of pool.
+        //
+        // Plan:
+        // 1. For each tested size and grain, on a `FixedThreadPool` and a
+        //    `ThreadPool`, sort pseudo-random integers with `bsl::less`, with
+        //    a comparator ordering by last digit, and without comparator, as
+        //    well as long strings, and compare with `bsl::sort`.  The grain
+        //    sizes yield both odd and even numbers of merge rounds.  (C-1..3)
+        //
+        // Testing:
+        //   void parallelSort(POOL *, IT, IT);
+        //   void parallelSort(POOL *, IT, IT, const COMP&, size_t = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`parallelSort`" << endl
+                          << "==============" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        ASSERT(0 == fixedPool.start());
+        testSort(&fixedPool);
+        fixedPool.stop();
+
+        bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 0, 3, 100);
+        ASSERT(0 == pool.start());
+        testSort(&pool);
+        pool.stop();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // `parallelReduce`
+        //
+        // Concerns:
+        // 1. The result is the initial value combined with every element,
+        //    whatever the number of elements, the grain size, and the order.
+        //
+        // 2. The result for an empty range is the initial value.
+        //
+        // 3. In deterministic order, the partial results are combined in
+        //    range order, so a non-commutative operation gives the
+        //    sequential result.
+        //
+        // Plan:
+        // 1. For each tested size and grain, on a `FixedThreadPool` and a
+        //    `ThreadPool`, sum pseudo-random integers in both orders, and
+        //    concatenate strings in deterministic order, and compare with
+        //    `bsl::accumulate`.  (C-1..3)
+        //
+        // Testing:
+        //   TYPE parallelReduce(POOL *, IT, IT, const TYPE&, const OP&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`parallelReduce`" << endl
+                          << "================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        ASSERT(0 == fixedPool.start());
+        testReduce(&fixedPool);
+        fixedPool.stop();
+
+        bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 0, 3, 100);
+        ASSERT(0 == pool.start());
+        testReduce(&pool);
+        pool.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // `parallelTransform`
+        //
+        // Concerns:
+        // 1. Each output element is the function of the corresponding input
+        //    element, whatever the number of elements and the grain size.
+        //
+        // 2. The returned iterator is the end of the output range.
+        //
+        // 3. The output range may be the input range.
+        //
+        // Plan:
+        // 1. For each tested size and grain, on a `FixedThreadPool` and a
+        //    `ThreadPool`, transform pseudo-random integers, and compare with
+        //    `bsl::transform`.  (C-1..2)
+        //
+        // 2. Transform a range in place.  (C-3)
+        //
+        // Testing:
+        //   OUT parallelTransform(POOL *, IN, IN, OUT, const FUNC&, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`parallelTransform`" << endl
+                          << "===================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        ASSERT(0 == fixedPool.start());
+        testTransform(&fixedPool);
+
+        {
+            bsl::vector<double> values(1000);
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                values[i] = static_cast<double>(i * i);
+            }
+
+            Util::parallelTransform(&fixedPool,
+                                    values.begin(),
+                                    values.end(),
+                                    values.begin(),
+                                    SquareRoot(),
+                                    7);
+
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                ASSERTV(i, static_cast<double>(i) == values[i]);
+            }
+        }
+        fixedPool.stop();
+
+        bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 0, 3, 100);
+        ASSERT(0 == pool.start());
+        testTransform(&pool);
+        pool.stop();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // `parallelForEach`
+        //
+        // Concerns:
+        // 1. The function is invoked exactly once on each element, whatever
+        //    the number of elements and the grain size.
+        //
+        // 2. The algorithm works with both kinds of pool.
+        //
+        // 3. The algorithm completes when invoked from a job of a
+        //    single-threaded pool on that same pool.
+        //
+        // 4. The algorithm completes, on the calling thread, if the pool is
+        //    not started.
+        //
+        // Plan:
+        // 1. For each tested size and grain, on a `FixedThreadPool` and a
+        //    `ThreadPool`, increment pseudo-random integers, and compare with
+        //    `bsl::for_each`.  (C-1..2)
+        //
+        // 2. From a job of a single-threaded `FixedThreadPool`, increment a
+        //    range in parallel on that pool with a grain of 1, and verify the
+        //    result.  (C-3)
+        //
+        // 3. Increment a range on a pool that is not started, and verify the
+        //    result.  (C-4)
+        //
+        // Testing:
+        //   void parallelForEach(POOL *, IT, IT, const FUNC&, size_t = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`parallelForEach`" << endl
+                          << "=================" << endl;
+
+        {
+            bdlmt::FixedThreadPool fixedPool(4, 1000);
+            ASSERT(0 == fixedPool.start());
+            testForEach(&fixedPool);
+            fixedPool.stop();
+
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 0, 3, 100);
+            ASSERT(0 == pool.start());
+            testForEach(&pool);
+            pool.stop();
+        }
+
+        if (verbose) cout << "\tInvoking from a job of the pool." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 100);
+            ASSERT(0 == pool.start());
+
+            bsl::vector<int> values(100, 5);
+            bslmt::Latch     done(1);
+            NestedArgs       args = { &pool, &values, &done };
+
+            ASSERT(0 == pool.enqueueJob(bdlf::BindUtil::bind(&nestedForEach,
+                                                             &args)));
+            done.wait();
+
+            ASSERT(bsl::vector<int>(100, 6) == values);
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\tInvoking on a pool that is not started."
+                          << endl;
+        {
+            bdlmt::FixedThreadPool pool(2, 100);
+
+            bsl::vector<int> values(100, 5);
+            Util::parallelForEach(&pool,
+                                  values.begin(),
+                                  values.end(),
+                                  Increment(),
+                                  10);
+
+            ASSERT(bsl::vector<int>(100, 6) == values);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PARTITIONING
+        //
+        // Concerns:
+        // 1. The default grain size splits a range into about
+        //    `k_LEAVES_PER_THREAD` leaves per participating thread, and is
+        //    at least 1; a requested grain size is used as is.
+        //
+        // 2. `partition` yields contiguous, non-empty leaves covering the
+        //    range, each of at most the grain size, obtained by halving.
+        //
+        // 3. `loadMergeParts` pairs adjacent runs, merges a trailing unpaired
+        //    run with an empty run, splits each merge into parts of at most
+        //    the grain size covering the merged run, and loads the bounds of
+        //    the merged runs.
+        //
+        // Plan:
+        // 1. Verify `grainSize` for a table of inputs.  (C-1)
+        //
+        // 2. For a range of sizes and grains, verify the properties of the
+        //    bounds loaded by `partition`, and verify the bounds for a few
+        //    inputs explicitly.  (C-2)
+        //
+        // 3. Verify the parts and bounds loaded by `loadMergeParts` for even
+        //    and odd numbers of runs.  (C-3)
+        //
+        // Testing:
+        //   PARTITIONING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARTITIONING" << endl
+                          << "============" << endl;
+
+        if (verbose) cout << "\tTesting `grainSize`." << endl;
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_numElements;
+                bsl::size_t d_requested;
+                int         d_numThreads;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                //LINE  NUM     REQ  THREADS  EXP
+                //----  ------  ---  -------  ----
+                { L_,        0,   0,       0,    1 },
+                { L_,        1,   0,       0,    1 },
+                { L_,        4,   0,       0,    1 },
+                { L_,        5,   0,       0,    2 },
+                { L_,     1000,   0,       0,  250 },
+                { L_,     1000,   0,       3,   63 },
+                { L_,     1000,   7,       3,    7 },
+                { L_,  1 << 20,   0,      63, 4096 },
+                { L_,       10,   0,      -1,    3 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE    = DATA[ti].d_line;
+                const bsl::size_t NUM     = DATA[ti].d_numElements;
+                const bsl::size_t REQ     = DATA[ti].d_requested;
+                const int         THREADS = DATA[ti].d_numThreads;
+                const bsl::size_t EXP     = DATA[ti].d_expected;
+
+                ASSERTV(LINE, EXP == ImpUtil::grainSize(NUM, REQ, THREADS));
+            }
+        }
+
+        if (verbose) cout << "\tTesting `partition`." << endl;
+        {
+            bsl::vector<bsl::size_t> bounds;
+
+            ImpUtil::partition(&bounds, 0, 4);
+            ASSERT(1 == bounds.size());
+            ASSERT(0 == bounds[0]);
+
+            ImpUtil::partition(&bounds, 10, 3);
+            const bsl::size_t EXP[] = { 0, 2, 5, 7, 10 };
+            ASSERT(bsl::vector<bsl::size_t>(EXP, EXP + 5) == bounds);
+
+            for (bsl::size_t n = 1; n <= 200; ++n) {
+                for (bsl::size_t grain = 1; grain <= n + 1; ++grain) {
+                    ImpUtil::partition(&bounds, n, grain);
+
+                    ASSERTV(n, grain, 2 <= bounds.size());
+                    ASSERTV(n, grain, 0 == bounds.front());
+                    ASSERTV(n, grain, n == bounds.back());
+
+                    for (bsl::size_t i = 1; i < bounds.size(); ++i) {
+                        const bsl::size_t length = bounds[i] - bounds[i - 1];
+
+                        ASSERTV(n, grain, i, 0 < length);
+                        ASSERTV(n, grain, i, length <= grain);
+
+                        // Halving yields leaves of at least half the grain.
+
+                        ASSERTV(n, grain, i, 2 * length >= grain
+                                          || 1 == bounds.size() - 1);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting `loadMergeParts`." << endl;
+        {
+            typedef ImpUtil::MergePart MergePart;
+
+            bsl::vector<MergePart> parts;
+
+            const bsl::size_t BOUNDS[] = { 0, 3, 5, 9 };
+            bsl::vector<bsl::size_t> bounds(BOUNDS, BOUNDS + 4);
+
+            ImpUtil::loadMergeParts(&parts, &bounds, 2);
+
+            ASSERT(3 == bounds.size());
+            ASSERT(0 == bounds[0]);
+            ASSERT(5 == bounds[1]);
+            ASSERT(9 == bounds[2]);
+
+            ASSERT(5 == parts.size());
+
+            static const struct {
+                bsl::size_t d_begin;
+                bsl::size_t d_middle;
+                bsl::size_t d_end;
+                bsl::size_t d_outBegin;
+                bsl::size_t d_outEnd;
+            } EXP[] = {
+                { 0, 3, 5, 0, 2 },
+                { 0, 3, 5, 2, 4 },
+                { 0, 3, 5, 4, 5 },
+                { 5, 9, 9, 0, 2 },
+                { 5, 9, 9, 2, 4 },
+            };
+
+            for (bsl::size_t i = 0; i < parts.size() && i < 5; ++i) {
+                ASSERTV(i, EXP[i].d_begin    == parts[i].d_begin);
+                ASSERTV(i, EXP[i].d_middle   == parts[i].d_middle);
+                ASSERTV(i, EXP[i].d_end      == parts[i].d_end);
+                ASSERTV(i, EXP[i].d_outBegin == parts[i].d_outBegin);
+                ASSERTV(i, EXP[i].d_outEnd   == parts[i].d_outEnd);
+            }
+
+            ImpUtil::loadMergeParts(&parts, &bounds, 100);
+
+            ASSERT(2 == bounds.size());
+            ASSERT(0 == bounds[0]);
+            ASSERT(9 == bounds[1]);
+
+            ASSERT(1 == parts.size());
+            ASSERT(0 == parts[0].d_begin);
+            ASSERT(5 == parts[0].d_middle);
+            ASSERT(9 == parts[0].d_end);
+            ASSERT(0 == parts[0].d_outBegin);
+            ASSERT(9 == parts[0].d_outEnd);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. On a started `FixedThreadPool`, invoke each algorithm on a small
+        //    range and verify the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlmt::FixedThreadPool pool(2, 100);
+        ASSERT(0 == pool.start());
+
+        bsl::vector<int> values;
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(99 - i);
+        }
+
+        Util::parallelForEach(&pool,
+                              values.begin(),
+                              values.end(),
+                              Increment());
+        ASSERT(100 == values[0]);
+        ASSERT(  1 == values[99]);
+
+        bsl::vector<long long> results(100);
+        ASSERT(results.end() == Util::parallelTransform(&pool,
+                                                        values.begin(),
+                                                        values.end(),
+                                                        results.begin(),
+                                                        Affine()));
+        ASSERT(301 == results[0]);
+
+        ASSERT(5050 == Util::parallelReduce(&pool,
+                                            values.begin(),
+                                            values.end(),
+                                            0,
+                                            bsl::plus<int>()));
+
+        Util::parallelSort(&pool, values.begin(), values.end());
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, i + 1 == values[i]);
+        }
+
+        pool.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        //
+        // Concerns:
+        // 1. The algorithms scale with the number of threads of the pool, up
+        //    to the number of hardware threads (at most 64).
+        //
+        // Plan:
+        // 1. For pools of 1, 2, 4, ... threads, up to the number of hardware
+        //    threads, time `parallelTransform`, `parallelReduce` (in
+        //    deterministic order), and `parallelSort` on a large
+        //    `bsl::vector<double>`, and report the speedup relative to the
+        //    corresponding sequential algorithm.  Note that the calling
+        //    thread also takes part, so a pool of `N` threads uses up to
+        //    `N + 1` threads.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SCALING WITH THE NUMBER OF THREADS"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        const bsl::size_t NUM_ELEMENTS = 1 << 23;
+
+        int maxThreads = bslmt::ThreadUtil::hardwareConcurrency();
+        if (maxThreads < 1) {
+            maxThreads = 1;
+        }
+        if (maxThreads > 64) {
+            maxThreads = 64;
+        }
+
+        bsl::vector<double> input(NUM_ELEMENTS);
+        {
+            bsl::vector<int> values;
+            loadRandom(&values, NUM_ELEMENTS, 1);
+            for (bsl::size_t i = 0; i < NUM_ELEMENTS; ++i) {
+                input[i] = values[i] + static_cast<double>(i) / NUM_ELEMENTS;
+            }
+        }
+
+        bsl::vector<double> output(NUM_ELEMENTS);
+        bsls::Stopwatch     timer;
+
+        timer.start();
+        bsl::transform(input.begin(),
+                       input.end(),
+                       output.begin(),
+                       SquareRoot());
+        timer.stop();
+        const double seqTransform = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        volatile double sum = bsl::accumulate(input.begin(), input.end(), 0.0);
+        timer.stop();
+        const double seqReduce = timer.elapsedTime();
+        (void)sum;
+
+        output = input;
+        timer.reset();
+        timer.start();
+        bsl::sort(output.begin(), output.end());
+        timer.stop();
+        const double seqSort = timer.elapsedTime();
+
+        cout << "elements: " << NUM_ELEMENTS
+             << ", hardware threads: " << maxThreads << endl
+             << "sequential: transform " << seqTransform
+             << "s, reduce " << seqReduce
+             << "s, sort " << seqSort << "s" << endl;
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            bdlmt::FixedThreadPool pool(numThreads, 1000);
+            ASSERT(0 == pool.start());
+
+            timer.reset();
+            timer.start();
+            Util::parallelTransform(&pool,
+                                    input.begin(),
+                                    input.end(),
+                                    output.begin(),
+                                    SquareRoot());
+            timer.stop();
+            const double transform = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            sum = Util::parallelReduce(&pool,
+                                       input.begin(),
+                                       input.end(),
+                                       0.0,
+                                       bsl::plus<double>(),
+                                       Util::e_DETERMINISTIC);
+            timer.stop();
+            const double reduce = timer.elapsedTime();
+
+            output = input;
+            timer.reset();
+            timer.start();
+            Util::parallelSort(&pool, output.begin(), output.end());
+            timer.stop();
+            const double sort = timer.elapsedTime();
+
+            ASSERT(bsl::is_sorted(output.begin(), output.end()));
+
+            cout << "threads: " << numThreads
+                 << "  transform x" << seqTransform / transform
+                 << "  reduce x"    << seqReduce    / reduce
+                 << "  sort x"      << seqSort      / sort << endl;
+
+            pool.stop();
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
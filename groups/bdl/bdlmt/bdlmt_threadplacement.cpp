@@ -0,0 +1,156 @@
+// bdlmt_threadplacement.cpp                                          -*-C++-*-
+#include <bdlmt_threadplacement.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_threadplacement_cpp,"$Id$ $CSID$")
+
+#include <bslmt_cputopologyutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef bsl::pair<int, int> CoreAndCpu;
+
+/// Load into the specified `result` the indices of the NUMA nodes eligible
+/// under a placement having the specified `numaNode` attribute.
+void loadEligibleNodes(bsl::vector<int> *result, int numaNode)
+{
+    if (bdlmt::ThreadPlacement::e_ANY_NUMA_NODE == numaNode) {
+        bslmt::CpuTopologyUtil::loadOnlineNumaNodes(result);
+    }
+    else {
+        result->assign(1, numaNode);
+    }
+}
+
+/// Load into the specified `result` the online CPUs of the specified
+/// `numaNode`, ordered such that the first CPU of each physical core (in
+/// increasing order of core) precedes the second CPU of each core, which
+/// precedes the third, and so on.
+void loadNodeCpuOrder(bsl::vector<int> *result, int numaNode)
+{
+    bsl::vector<int> cpus(result->get_allocator());
+    bslmt::CpuTopologyUtil::loadCpusOfNumaNode(&cpus, numaNode);
+
+    bsl::vector<CoreAndCpu> sorted(result->get_allocator());
+    sorted.reserve(cpus.size());
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        const int core = bslmt::CpuTopologyUtil::coreOfCpu(cpus[i]);
+        sorted.push_back(CoreAndCpu(core, cpus[i]));
+    }
+    bsl::sort(sorted.begin(), sorted.end());
+
+    // Rank each CPU among the hardware threads of its core, then order by
+    // rank, keeping the order of cores within each rank.
+
+    bsl::vector<bsl::pair<int, CoreAndCpu> > ranked(result->get_allocator());
+    ranked.reserve(sorted.size());
+    int rank = 0;
+    for (bsl::size_t i = 0; i < sorted.size(); ++i) {
+        rank = 0 < i && sorted[i - 1].first == sorted[i].first ? rank + 1 : 0;
+        ranked.push_back(bsl::make_pair(rank, sorted[i]));
+    }
+    bsl::sort(ranked.begin(), ranked.end());
+
+    result->clear();
+    for (bsl::size_t i = 0; i < ranked.size(); ++i) {
+        result->push_back(ranked[i].second.second);
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                           // ---------------------
+                           // class ThreadPlacement
+                           // ---------------------
+
+// ACCESSORS
+void ThreadPlacement::loadCpuOrder(bsl::vector<int> *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    if (e_NONE == d_policy) {
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> nodes(result->get_allocator());
+    u::loadEligibleNodes(&nodes, d_numaNode);
+
+    bsl::vector<bsl::vector<int> > nodeCpus(nodes.size(),
+                                            bsl::vector<int>(),
+                                            result->get_allocator());
+    bsl::size_t maxNodeCpus = 0;
+    for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+        u::loadNodeCpuOrder(&nodeCpus[i], nodes[i]);
+        maxNodeCpus = bsl::max(maxNodeCpus, nodeCpus[i].size());
+    }
+
+    if (e_COMPACT == d_policy) {
+        for (bsl::size_t i = 0; i < nodeCpus.size(); ++i) {
+            result->insert(result->end(),
+                           nodeCpus[i].begin(),
+                           nodeCpus[i].end());
+        }
+    }
+    else {
+        BSLS_ASSERT(e_SCATTER == d_policy);
+
+        for (bsl::size_t j = 0; j < maxNodeCpus; ++j) {
+            for (bsl::size_t i = 0; i < nodeCpus.size(); ++i) {
+                if (j < nodeCpus[i].size()) {
+                    result->push_back(nodeCpus[i][j]);
+                }
+            }
+        }
+    }
+}
+
+int ThreadPlacement::numCores() const
+{
+    bsl::vector<int> nodes;
+    u::loadEligibleNodes(&nodes, d_numaNode);
+
+    bsl::vector<int> cores;
+    bsl::vector<int> cpus;
+    for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+        bslmt::CpuTopologyUtil::loadCpusOfNumaNode(&cpus, nodes[i]);
+
+        for (bsl::size_t j = 0; j < cpus.size(); ++j) {
+            cores.push_back(bslmt::CpuTopologyUtil::coreOfCpu(cpus[j]));
+        }
+    }
+
+    bsl::sort(cores.begin(), cores.end());
+
+    return static_cast<int>(bsl::unique(cores.begin(), cores.end())
+                                                             - cores.begin());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
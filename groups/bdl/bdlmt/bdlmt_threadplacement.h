@@ -0,0 +1,296 @@
+// bdlmt_threadplacement.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLMT_THREADPLACEMENT
+#define INCLUDED_BDLMT_THREADPLACEMENT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a policy for placing the threads of a pool on CPUs.
+//
+//@CLASSES:
+//  bdlmt::ThreadPlacement: CPU and NUMA placement policy for pool threads
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool, bdlmt_eventscheduler,
+//           bslmt_cputopologyutil, bslmt_threadattributes
+//
+//@DESCRIPTION: This component defines a simply constrained attribute class,
+// `bdlmt::ThreadPlacement`, describing how the threads of a pool are to be
+// bound to the CPUs of the host.  A placement has two attributes:
+//
+// ```
+// Name      Type                        Default
+// --------  --------------------------  ---------------
+// policy    ThreadPlacement::Policy     e_NONE
+// numaNode  int                         e_ANY_NUMA_NODE
+// ```
+// The `policy` attribute selects how threads are distributed over CPUs:
+//
+// * `e_NONE`: threads are not bound to individual CPUs.  If `numaNode` is
+//   set, each thread may run on any CPU of that node.
+//
+// * `e_COMPACT`: threads are bound to individual CPUs, filling the CPUs of
+//   one NUMA node before moving on to the next node.  Within a node, the
+//   first thread placed on each physical core is placed before any second
+//   hardware thread of a core is used.
+//
+// * `e_SCATTER`: threads are bound to individual CPUs, alternating between
+//   NUMA nodes, so that consecutive threads run on different nodes.  Within
+//   a node, physical cores are again used before their hardware siblings.
+//
+// The `numaNode` attribute, if not `e_ANY_NUMA_NODE`, restricts the threads to
+// the CPUs of the indicated node.  Note that `e_SCATTER` is equivalent to
+// `e_COMPACT` when `numaNode` is set, or when the host has a single node.
+//
+// The CPUs assigned to successive threads are obtained with `loadCpuOrder`:
+// the thread having index `i` in a pool of `n` threads is bound to the CPU at
+// index `i % cpus.size()` of the loaded `cpus`.  Choosing `numCores()` threads
+// therefore places exactly one thread on each physical core of the eligible
+// nodes.
+//
+// `bdlmt::FixedThreadPool`, `bdlmt::ThreadPool`, and
+// `bdlmt::MultiQueueThreadPool` apply a placement to their threads, and
+// `bdlmt::EventScheduler` to its dispatcher thread (see the
+// `setThreadPlacement` method of each).  The other pools of this package
+// accept a `bslmt::ThreadAttributes` object, whose `numaNode` attribute binds
+// all of their threads to the CPUs of a single node.
+//
+// Note that binding threads to CPUs is, at this time, honored only on Linux
+// (see `bslmt_threadattributes`); on other platforms a placement has no
+// effect.  The host topology is described by `bslmt::CpuTopologyUtil`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: One Thread per Core of a NUMA Node
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps its working set in memory local to NUMA node 0,
+// and we want its worker threads to run on the cores of that node, one thread
+// per physical core.
+//
+// First, we create a placement restricted to node 0:
+// ```
+// bdlmt::ThreadPlacement placement(bdlmt::ThreadPlacement::e_COMPACT, 0);
+// ```
+// Then, we obtain the number of physical cores of the node, which is the
+// number of threads we will create:
+// ```
+// const int numThreads = placement.numCores();
+// assert(0 < numThreads);
+// ```
+// Finally, we obtain the CPUs to which the threads will be bound, and observe
+// that the first `numThreads` CPUs are on distinct cores of node 0:
+// ```
+// bsl::vector<int> cpus;
+// placement.loadCpuOrder(&cpus);
+// assert(numThreads <= static_cast<int>(cpus.size()));
+//
+// typedef bslmt::CpuTopologyUtil Topology;
+//
+// for (int i = 0; i < numThreads; ++i) {
+//     assert(0 == Topology::numaNodeOfCpu(cpus[i]));
+//
+//     for (int j = 0; j < i; ++j) {
+//         assert(Topology::coreOfCpu(cpus[i]) !=
+//                                             Topology::coreOfCpu(cpus[j]));
+//     }
+// }
+// ```
+// These threads would be started by a `bdlmt::FixedThreadPool` having
+// `numThreads` threads to which `placement` is supplied.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                           // =====================
+                           // class ThreadPlacement
+                           // =====================
+
+/// This simply constrained attribute class describes how the threads of a
+/// pool are bound to the CPUs of the host.  See {Description}.
+class ThreadPlacement {
+
+  public:
+    // TYPES
+
+    /// Enumerate the policies for distributing threads over CPUs.
+    enum Policy {
+        e_NONE,     // threads are not bound to individual CPUs
+        e_COMPACT,  // fill the CPUs of each node before the next node
+        e_SCATTER   // alternate between nodes
+    };
+
+    enum {
+        e_ANY_NUMA_NODE = -1  // threads may run on any NUMA node
+    };
+
+  private:
+    // DATA
+    Policy d_policy;    // distribution of threads over CPUs
+
+    int    d_numaNode;  // node to which threads are restricted, or
+                        // `e_ANY_NUMA_NODE`
+
+    // FRIENDS
+    friend bool operator==(const ThreadPlacement&, const ThreadPlacement&);
+
+  public:
+    // CREATORS
+
+    /// Create a placement having the `e_NONE` policy and no NUMA node
+    /// restriction.
+    ThreadPlacement();
+
+    /// Create a placement having the specified `policy`.  Optionally
+    /// specify a `numaNode` restricting threads to the CPUs of that node.
+    /// If `numaNode` is not specified, threads may run on any node.  The
+    /// behavior is undefined unless `e_ANY_NUMA_NODE == numaNode` or
+    /// `0 <= numaNode`.
+    explicit
+    ThreadPlacement(Policy policy, int numaNode = e_ANY_NUMA_NODE);
+
+    //! ThreadPlacement(const ThreadPlacement& original) = default;
+    //! ~ThreadPlacement() = default;
+
+    // MANIPULATORS
+
+    //! ThreadPlacement& operator=(const ThreadPlacement& rhs) = default;
+
+    /// Set the `numaNode` attribute of this object to the specified
+    /// `value`, and return a reference providing modifiable access to this
+    /// object.  The behavior is undefined unless
+    /// `e_ANY_NUMA_NODE == value` or `0 <= value`.
+    ThreadPlacement& setNumaNode(int value);
+
+    /// Set the `policy` attribute of this object to the specified `value`,
+    /// and return a reference providing modifiable access to this object.
+    ThreadPlacement& setPolicy(Policy value);
+
+    // ACCESSORS
+
+    /// Load into the specified `result` the indices of the CPUs to which
+    /// successive threads are bound under this placement, as described in
+    /// {Description}.  `result` is empty if the policy is `e_NONE`, or if
+    /// no online CPU belongs to the `numaNode` attribute.  Note that the
+    /// host topology is read on each call.
+    void loadCpuOrder(bsl::vector<int> *result) const;
+
+    /// Return the number of physical cores having an online CPU in the
+    /// NUMA nodes eligible under this placement: the node indicated by the
+    /// `numaNode` attribute, or all nodes if it is `e_ANY_NUMA_NODE`.
+    int numCores() const;
+
+    /// Return the `numaNode` attribute of this object.
+    int numaNode() const;
+
+    /// Return the `policy` attribute of this object.
+    Policy policy() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `ThreadPlacement` objects have the
+/// same value if their `policy` and `numaNode` attributes are the same.
+bool operator==(const ThreadPlacement& lhs, const ThreadPlacement& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.  Two `ThreadPlacement` objects do not
+/// have the same value if their `policy` or `numaNode` attributes differ.
+bool operator!=(const ThreadPlacement& lhs, const ThreadPlacement& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class ThreadPlacement
+                           // ---------------------
+
+// CREATORS
+inline
+ThreadPlacement::ThreadPlacement()
+: d_policy(e_NONE)
+, d_numaNode(e_ANY_NUMA_NODE)
+{
+}
+
+inline
+ThreadPlacement::ThreadPlacement(Policy policy, int numaNode)
+: d_policy(policy)
+, d_numaNode(numaNode)
+{
+    BSLS_ASSERT(e_ANY_NUMA_NODE <= numaNode);
+}
+
+// MANIPULATORS
+inline
+ThreadPlacement& ThreadPlacement::setNumaNode(int value)
+{
+    BSLS_ASSERT(e_ANY_NUMA_NODE <= value);
+
+    d_numaNode = value;
+    return *this;
+}
+
+inline
+ThreadPlacement& ThreadPlacement::setPolicy(Policy value)
+{
+    d_policy = value;
+    return *this;
+}
+
+// ACCESSORS
+inline
+int ThreadPlacement::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+ThreadPlacement::Policy ThreadPlacement::policy() const
+{
+    return d_policy;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlmt::operator==(const ThreadPlacement& lhs, const ThreadPlacement& rhs)
+{
+    return lhs.d_policy   == rhs.d_policy
+        && lhs.d_numaNode == rhs.d_numaNode;
+}
+
+inline
+bool bdlmt::operator!=(const ThreadPlacement& lhs, const ThreadPlacement& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,553 @@
+// bdlmt_threadplacement.t.cpp                                        -*-C++-*-
+#include <bdlmt_threadplacement.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_cputopologyutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test is a simply constrained attribute class whose
+// accessors `loadCpuOrder` and `numCores` depend on the topology of the host.
+// The attributes are tested directly.  As the topology cannot be controlled,
+// the CPU orders are verified against the properties documented for each
+// policy, using `bslmt::CpuTopologyUtil` as the oracle.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadPlacement();
+// [ 2] ThreadPlacement(Policy policy, int numaNode = e_ANY_NUMA_NODE);
+//
+// MANIPULATORS
+// [ 2] ThreadPlacement& setNumaNode(int value);
+// [ 2] ThreadPlacement& setPolicy(Policy value);
+//
+// ACCESSORS
+// [ 3] void loadCpuOrder(bsl::vector<int> *result) const;
+// [ 3] int numCores() const;
+// [ 2] int numaNode() const;
+// [ 2] Policy policy() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const ThreadPlacement&, const ThreadPlacement&);
+// [ 2] bool operator!=(const ThreadPlacement&, const ThreadPlacement&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ThreadPlacement Obj;
+typedef bslmt::CpuTopologyUtil Topology;
+
+// ============================================================================
+//                          CASE 3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace CPU_ORDER_TEST {
+
+/// Return the number of distinct physical cores among the specified `cpus`.
+int numDistinctCores(const bsl::vector<int>& cpus)
+{
+    bsl::set<int> cores;
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        cores.insert(Topology::coreOfCpu(cpus[i]));
+    }
+    return static_cast<int>(cores.size());
+}
+
+/// Verify that the specified `order`, loaded for the CPUs of the specified
+/// `numaNode`, contains exactly the CPUs of that node, and that its first
+/// CPUs are on distinct cores, one per core of the node.
+void verifyNodeOrder(const bsl::vector<int>& order, int numaNode)
+{
+    bsl::vector<int> cpus;
+    Topology::loadCpusOfNumaNode(&cpus, numaNode);
+
+    bsl::vector<int> sorted(order);
+    bsl::sort(sorted.begin(), sorted.end());
+    ASSERTV(numaNode, cpus == sorted);
+
+    const int numCores = numDistinctCores(cpus);
+
+    bsl::vector<int> primaries(order.begin(), order.begin() + numCores);
+    ASSERTV(numaNode, numCores == numDistinctCores(primaries));
+}
+
+}  // close namespace CPU_ORDER_TEST
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: One Thread per Core of a NUMA Node
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps its working set in memory local to NUMA node 0,
+// and we want its worker threads to run on the cores of that node, one thread
+// per physical core.
+//
+// First, we create a placement restricted to node 0:
+// ```
+    bdlmt::ThreadPlacement placement(bdlmt::ThreadPlacement::e_COMPACT, 0);
+// ```
+// Then, we obtain the number of physical cores of the node, which is the
+// number of threads we will create:
+// ```
+    const int numThreads = placement.numCores();
+    ASSERT(0 < numThreads);
+// ```
+// Finally, we obtain the CPUs to which the threads will be bound, and observe
+// that the first `numThreads` CPUs are on distinct cores of node 0:
+// ```
+    bsl::vector<int> cpus;
+    placement.loadCpuOrder(&cpus);
+    ASSERT(numThreads <= static_cast<int>(cpus.size()));
+
+    typedef bslmt::CpuTopologyUtil Topology;
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == Topology::numaNodeOfCpu(cpus[i]));
+
+        for (int j = 0; j < i; ++j) {
+            ASSERT(Topology::coreOfCpu(cpus[i]) !=
+                                                Topology::coreOfCpu(cpus[j]));
+        }
+    }
+// ```
+// These threads would be started by a `bdlmt::FixedThreadPool` having
+// `numThreads` threads to which `placement` is supplied.
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CPU ORDER
+        //
+        // Concerns:
+        // 1. Under `e_NONE`, the CPU order is empty.
+        //
+        // 2. Under `e_COMPACT`, the order lists the CPUs of each eligible
+        //    node contiguously, in increasing order of node, and, within
+        //    each node, places one CPU of each core before any sibling.
+        //
+        // 3. Under `e_SCATTER`, the order is a permutation of the CPUs of
+        //    the eligible nodes, in which the CPUs of each node appear in the
+        //    same relative order as under `e_COMPACT`, and consecutive CPUs
+        //    are on different nodes as long as several nodes have CPUs left.
+        //
+        // 4. Restricting the placement to a node restricts the order to the
+        //    CPUs of that node, and a nonexistent node yields an empty order.
+        //
+        // 5. `numCores` is the number of distinct cores of the eligible
+        //    nodes, and the sum over nodes is the total.
+        //
+        // 6. `loadCpuOrder` uses the allocator of the supplied vector.
+        //
+        // Plan:
+        // 1. Load the orders for each policy, with and without each node, and
+        //    verify them against `bslmt::CpuTopologyUtil`.  (C-1..5)
+        //
+        // 2. Use a vector having a test allocator, and verify that the
+        //    default allocator holds no memory at the end.  (C-6)
+        //
+        // Testing:
+        //   void loadCpuOrder(bsl::vector<int> *result) const;
+        //   int numCores() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CPU ORDER\n"
+                             "=========\n";
+
+        namespace TC = CPU_ORDER_TEST;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        bsl::vector<int> nodes(&oa);
+        Topology::loadOnlineNumaNodes(&nodes);
+
+        bsl::vector<int> online(&oa);
+        Topology::loadOnlineCpus(&online);
+
+        if (verbose) { P_(nodes.size()) P(online.size()) }
+
+        if (verbose) cout << "\te_NONE\n";
+        {
+            bsl::vector<int> order(3, 1, &oa);
+
+            Obj().loadCpuOrder(&order);
+            ASSERT(order.empty());
+
+            Obj(Obj::e_NONE, nodes.front()).loadCpuOrder(&order);
+            ASSERT(order.empty());
+        }
+
+        if (verbose) cout << "\te_COMPACT\n";
+
+        bsl::vector<int> compact(&oa);
+        Obj(Obj::e_COMPACT).loadCpuOrder(&compact);
+        ASSERT(&oa == compact.get_allocator().mechanism());
+        {
+            ASSERTV(compact.size(), online.size(),
+                    compact.size() == online.size());
+
+            bsl::size_t offset = 0;
+            for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+                bsl::vector<int> cpus;
+                Topology::loadCpusOfNumaNode(&cpus, nodes[i]);
+
+                ASSERT(offset + cpus.size() <= compact.size());
+
+                const bsl::vector<int> nodeOrder(
+                                     compact.begin() + offset,
+                                     compact.begin() + offset + cpus.size());
+                TC::verifyNodeOrder(nodeOrder, nodes[i]);
+
+                bsl::vector<int> restricted(&oa);
+                Obj(Obj::e_COMPACT, nodes[i]).loadCpuOrder(&restricted);
+                ASSERTV(nodes[i], nodeOrder == restricted);
+
+                offset += cpus.size();
+            }
+        }
+
+        if (verbose) cout << "\te_SCATTER\n";
+        {
+            bsl::vector<int> scatter(&oa);
+            Obj(Obj::e_SCATTER).loadCpuOrder(&scatter);
+
+            bsl::vector<int> sortedScatter(scatter);
+            bsl::vector<int> sortedCompact(compact);
+            bsl::sort(sortedScatter.begin(), sortedScatter.end());
+            bsl::sort(sortedCompact.begin(), sortedCompact.end());
+            ASSERT(sortedScatter == sortedCompact);
+
+            if (1 == nodes.size()) {
+                ASSERT(scatter == compact);
+            }
+
+            // Group the scatter order by node, and compare with the order of
+            // each node alone.
+
+            bsl::size_t minNodeCpus = scatter.size();
+            for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+                bsl::vector<int> expected(&oa);
+                Obj(Obj::e_SCATTER, nodes[i]).loadCpuOrder(&expected);
+
+                bsl::vector<int> restricted(&oa);
+                Obj(Obj::e_COMPACT, nodes[i]).loadCpuOrder(&restricted);
+                ASSERTV(nodes[i], expected == restricted);
+
+                bsl::vector<int> actual;
+                for (bsl::size_t j = 0; j < scatter.size(); ++j) {
+                    if (nodes[i] == Topology::numaNodeOfCpu(scatter[j])) {
+                        actual.push_back(scatter[j]);
+                    }
+                }
+                ASSERTV(nodes[i], expected == actual);
+
+                minNodeCpus = bsl::min(minNodeCpus, expected.size());
+            }
+
+            // While every node has CPUs left, consecutive CPUs alternate
+            // between nodes.
+
+            for (bsl::size_t j = 0; j < minNodeCpus * nodes.size(); ++j) {
+                ASSERTV(j, nodes[j % nodes.size()] ==
+                                         Topology::numaNodeOfCpu(scatter[j]));
+            }
+        }
+
+        if (verbose) cout << "\tNonexistent node\n";
+        {
+            bsl::vector<int> order(3, 1, &oa);
+
+            Obj(Obj::e_COMPACT, nodes.back() + 1).loadCpuOrder(&order);
+            ASSERT(order.empty());
+
+            Obj(Obj::e_SCATTER, nodes.back() + 1).loadCpuOrder(&order);
+            ASSERT(order.empty());
+
+            ASSERT(0 == Obj(Obj::e_COMPACT, nodes.back() + 1).numCores());
+        }
+
+        if (verbose) cout << "\tnumCores\n";
+        {
+            const int NUM_CORES = Obj().numCores();
+
+            ASSERTV(NUM_CORES, TC::numDistinctCores(online) == NUM_CORES);
+            ASSERT(0 < NUM_CORES);
+            ASSERT(NUM_CORES <= static_cast<int>(online.size()));
+
+            int sum = 0;
+            for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+                sum += Obj(Obj::e_NONE, nodes[i]).numCores();
+            }
+            ASSERTV(sum, NUM_CORES, sum == NUM_CORES);
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ATTRIBUTES AND EQUALITY
+        //
+        // Concerns:
+        // 1. The default constructor creates an object having the `e_NONE`
+        //    policy and no NUMA node.
+        //
+        // 2. The value constructor and manipulators set the attributes, and
+        //    the manipulators return a reference to the object.
+        //
+        // 3. Two objects are equal if and only if both attributes are equal.
+        //
+        // 4. Invalid NUMA nodes are detected in appropriate build modes.
+        //
+        // Plan:
+        // 1. Create objects using each constructor and manipulator, and
+        //    verify the accessors.  (C-1..2)
+        //
+        // 2. Compare every pair of objects from a cross product of policies
+        //    and nodes.  (C-3)
+        //
+        // 3. Verify that defensive checks are triggered for a NUMA node less
+        //    than `e_ANY_NUMA_NODE`.  (C-4)
+        //
+        // Testing:
+        //   ThreadPlacement();
+        //   ThreadPlacement(Policy policy, int numaNode = e_ANY_NUMA_NODE);
+        //   ThreadPlacement& setNumaNode(int value);
+        //   ThreadPlacement& setPolicy(Policy value);
+        //   int numaNode() const;
+        //   Policy policy() const;
+        //   bool operator==(const ThreadPlacement&, const ThreadPlacement&);
+        //   bool operator!=(const ThreadPlacement&, const ThreadPlacement&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ATTRIBUTES AND EQUALITY\n"
+                             "=======================\n";
+
+        {
+            const Obj X;
+            ASSERT(Obj::e_NONE          == X.policy());
+            ASSERT(Obj::e_ANY_NUMA_NODE == X.numaNode());
+        }
+        {
+            const Obj X(Obj::e_SCATTER);
+            ASSERT(Obj::e_SCATTER       == X.policy());
+            ASSERT(Obj::e_ANY_NUMA_NODE == X.numaNode());
+
+            const Obj Y(Obj::e_COMPACT, 3);
+            ASSERT(Obj::e_COMPACT       == Y.policy());
+            ASSERT(3                    == Y.numaNode());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Obj& rv1 = mX.setPolicy(Obj::e_COMPACT);
+            ASSERT(&rv1 == &mX);
+            ASSERT(Obj::e_COMPACT == X.policy());
+
+            Obj& rv2 = mX.setNumaNode(2);
+            ASSERT(&rv2 == &mX);
+            ASSERT(2 == X.numaNode());
+
+            mX.setNumaNode(Obj::e_ANY_NUMA_NODE);
+            ASSERT(Obj::e_ANY_NUMA_NODE == X.numaNode());
+        }
+
+        const Obj::Policy POLICIES[] = { Obj::e_NONE,
+                                         Obj::e_COMPACT,
+                                         Obj::e_SCATTER };
+        const int         NODES[]    = { Obj::e_ANY_NUMA_NODE, 0, 1, 7 };
+
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+        const int NUM_NODES    = sizeof NODES    / sizeof *NODES;
+
+        for (int i = 0; i < NUM_POLICIES * NUM_NODES; ++i) {
+            const Obj X(POLICIES[i / NUM_NODES], NODES[i % NUM_NODES]);
+
+            for (int j = 0; j < NUM_POLICIES * NUM_NODES; ++j) {
+                const Obj Y(POLICIES[j / NUM_NODES], NODES[j % NUM_NODES]);
+
+                if (veryVerbose) { T_ P_(i) P(j) }
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_COMPACT, Obj::e_ANY_NUMA_NODE));
+            ASSERT_FAIL(Obj(Obj::e_COMPACT, -2));
+
+            Obj mX;
+            ASSERT_PASS(mX.setNumaNode(0));
+            ASSERT_FAIL(mX.setNumaNode(-2));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create, copy, and assign placements, and load the CPU order of
+        //    each policy.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        Obj mX;  const Obj& X = mX;
+        Obj mY(Obj::e_COMPACT);  const Obj& Y = mY;
+
+        ASSERT(X != Y);
+
+        mX = Y;
+        ASSERT(X == Y);
+
+        const Obj Z(X);
+        ASSERT(Z == X);
+
+        bsl::vector<int> cpus;
+        Z.loadCpuOrder(&cpus);
+        ASSERT(!cpus.empty());
+
+        mX.setPolicy(Obj::e_NONE);
+        X.loadCpuOrder(&cpus);
+        ASSERT(cpus.empty());
+
+        ASSERT(0 < Y.numCores());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -27,8 +27,10 @@ BSLS_IDENT_RCSID(bdlmt_threadpool_cpp,"$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
 #include <bsl_c_signal.h>              // sigfillset
@@ -266,8 +268,25 @@ int ThreadPool::startNewThread()
 #endif
 
     bslma::Allocator *alloc = d_queue.get_allocator().mechanism();
+
+    bslmt::ThreadAttributes attributes(d_threadAttributes, alloc);
+    if (ThreadPlacement::e_ANY_NUMA_NODE != d_startedPlacement.numaNode()) {
+        attributes.setNumaNode(d_startedPlacement.numaNode());
+    }
+    else if (ThreadPlacement::e_NONE != d_startedPlacement.policy()) {
+        attributes.setNumaNode(bslmt::ThreadAttributes::e_UNSET_NUMA_NODE);
+    }
+
+    if (!d_placementCpus.empty()) {
+        const bsl::size_t index = static_cast<bsl::size_t>(d_threadCount) %
+                                                        d_placementCpus.size();
+
+        bsl::vector<int> affinity(1, d_placementCpus[index], alloc);
+        attributes.setCpuAffinity(affinity);
+    }
+
     int rc = bslmt::ThreadUtil::createWithAllocator(&handle,
-                                                    d_threadAttributes,
+                                                    attributes,
                                                     ThreadPoolEntry,
                                                     this,
                                                     alloc);
@@ -421,6 +440,7 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
                        bslma::Allocator               *basicAllocator)
 : d_queue(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
+, d_placementCpus(basicAllocator)
 , d_maxThreads(maxThreads)
 , d_minThreads(minThreads)
 , d_threadCount(0)
@@ -453,6 +473,7 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
                        bslma::Allocator               *basicAllocator)
 : d_queue(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
+, d_placementCpus(basicAllocator)
 , d_maxThreads(maxThreads)
 , d_minThreads(minThreads)
 , d_threadCount(0)
@@ -483,6 +504,7 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
                        bslma::Allocator               *basicAllocator)
 : d_queue(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
+, d_placementCpus(basicAllocator)
 , d_maxThreads(maxThreads)
 , d_minThreads(minThreads)
 , d_threadCount(0)
@@ -515,6 +537,7 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
                        bslma::Allocator               *basicAllocator)
 : d_queue(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
+, d_placementCpus(basicAllocator)
 , d_maxThreads(maxThreads)
 , d_minThreads(minThreads)
 , d_threadCount(0)
@@ -629,11 +652,20 @@ double ThreadPool::resetPercentBusy()
     return percentBusy;
 }
 
+void ThreadPool::setThreadPlacement(const ThreadPlacement& placement)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_threadPlacement = placement;
+}
+
 int ThreadPool::start()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     d_enabled = 1;
 
+    d_startedPlacement = d_threadPlacement;
+    d_startedPlacement.loadCpuOrder(&d_placementCpus);
+
     while (d_threadCount < d_minThreads) {
         if (0 != startNewThread()) {
             lock.release()->unlock();
@@ -676,6 +708,12 @@ int ThreadPool::numPendingJobs() const
     return static_cast<int>(d_queue.size());
 }
 
+ThreadPlacement ThreadPool::threadPlacement() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_threadPlacement;
+}
+
 double ThreadPool::percentBusy() const
 {
     bsls::Types::Int64 last = d_lastResetTime;
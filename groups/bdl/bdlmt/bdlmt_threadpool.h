@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //  * object type name: "bdlmt.threadpool"
 //  * object type abbreviation: "tp"
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlmt_threadplacement
 //
 //@DESCRIPTION: This component defines a portable and efficient implementation
 // of a thread pool that can be used to distribute various user-defined
@@ -69,6 +69,23 @@ BSLS_IDENT("$Id: $")
 // management code, an application can easily create a thread pool, enqueue a
 // series of jobs to be executed, and wait until all the jobs have executed.
 //
+///Thread Placement
+///----------------
+// The processing threads of a pool can be bound to CPUs of the host by
+// supplying a `bdlmt::ThreadPlacement` to `setThreadPlacement`.  The CPU order
+// described by `bdlmt::ThreadPlacement::loadCpuOrder` is obtained when the
+// pool is started, and, under the `e_COMPACT` and `e_SCATTER` policies, a
+// thread created while the pool has `i` processing threads is bound to the
+// single CPU at index `i` (modulo the number of CPUs) of that order; under the
+// `e_NONE` policy, every thread is restricted to the placement's NUMA node, if
+// any.  Since threads in excess of `minThreads()` are created and destroyed
+// with the load, a pool having `maxThreads()` greater than the number of CPUs
+// in the order may have more than one thread bound to a CPU.  A placement
+// having a NUMA node replaces the `numaNode` attribute of the
+// `bslmt::ThreadAttributes` supplied at construction, and the `e_COMPACT` and
+// `e_SCATTER` policies replace both its `numaNode` and `cpuAffinity`
+// attributes.  Note that, at this time, placement is honored only on Linux.
+//
 ///Thread Safety
 ///-------------
 // The `bdlmt::ThreadPool` class is both **fully thread-safe** (i.e., all
@@ -351,6 +368,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlm_metricsregistry.h>
 
+#include <bdlmt_threadplacement.h>
+
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
@@ -374,6 +393,7 @@ BSLS_IDENT("$Id: $")
 #endif
 #include <bsl_functional.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -429,6 +449,18 @@ class ThreadPool {
                                            // thread attributes to be used when
                                            // constructing processing threads
 
+    ThreadPlacement      d_threadPlacement;
+                                           // placement of processing threads
+                                           // on CPUs, applied by `start`
+
+    ThreadPlacement      d_startedPlacement;
+                                           // placement in effect since the
+                                           // last call to `start`
+
+    bsl::vector<int>     d_placementCpus;  // CPUs to which successive
+                                           // processing threads are bound
+                                           // under `d_startedPlacement`
+
     const int            d_maxThreads;     // maximum number of processing
                                            // threads that can be started at
                                            // any given time by this thread
@@ -520,8 +552,9 @@ class ThreadPool {
     void initBlockSet();
 #endif
 
-    /// Internal method to spawn a new processing thread and increment the
-    /// current count.  This method must be called with `d_mutex` locked.
+    /// Internal method to spawn a new processing thread, placed on CPUs as
+    /// described by `d_startedPlacement`, and increment the current count.
+    /// This method must be called with `d_mutex` locked.
     int startNewThread();
 
     /// Processing thread function.
@@ -655,14 +688,22 @@ class ThreadPool {
     /// processors).
     double resetPercentBusy();
 
+    /// Set the placement of the processing threads of this thread pool on
+    /// CPUs to the specified `placement` (see {Thread Placement}).  The
+    /// placement takes effect the next time the pool is started; threads
+    /// that are already running are not affected.
+    void setThreadPlacement(const ThreadPlacement& placement);
+
     /// Disable queuing on this thread pool, cancel all queued jobs, and shut
     /// down all processing threads (after all active jobs complete).
     void shutdown();
 
     /// Enable queuing on this thread pool and spawn `minThreads()` processing
-    /// threads.  Return 0 on success, and a non-zero value otherwise.  If
+    /// threads, placing them on CPUs as described by `threadPlacement()`.
+    /// Return 0 on success, and a non-zero value otherwise.  If
     /// `minThreads()` threads were not successfully started, all threads are
-    /// stopped.
+    /// stopped.  Note that, on Linux, starting fails if the placement
+    /// designates a NUMA node having no online CPU.
     int start();
 
     /// Disable queuing on this thread pool and wait until all pending jobs
@@ -718,6 +759,10 @@ class ThreadPool {
 
     /// Return the number of times that thread creation failed.
     int threadFailures() const;
+
+    /// Return the placement of the processing threads of this thread pool
+    /// on CPUs.
+    ThreadPlacement threadPlacement() const;
 };
 
 // ============================================================================
@@ -12,6 +12,7 @@
 
 #include <bslmt_barrier.h>           // for test only
 #include <bslmt_configuration.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_latch.h>             // for test only
 #include <bslmt_lockguard.h>         // for test only
 #include <bslmt_testutil.h>
@@ -88,6 +89,8 @@ using namespace bsl;  // automatically added by script
 // [3 ] int threadFailures() const;
 // [9 ] double percentBusy() const
 // [9 ] double resetPercentBusy()
+// [18] void setThreadPlacement(const ThreadPlacement&);
+// [18] ThreadPlacement threadPlacement() const;
 // ----------------------------------------------------------------------------
 // [1 ] Breathing test
 // [7 ] Max idle time functionality
@@ -99,6 +102,8 @@ using namespace bsl;  // automatically added by script
 // [13] TESTING CPU consumption of an idle pool.
 // [15] TESTING MOVING ENQUEUEJOB METHOD
 // [16] THREAD NAMES
+// [17] INTERNAL FUNCTOR MOVE
+// [18] THREAD PLACEMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -787,6 +792,66 @@ void threadNameCheckJob(void *arg)
 
 }  // close namespace THREAD_NAMES_TEST
 
+// ============================================================================
+//                         CASE 18 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace case18 {
+
+/// This `struct` collects the CPUs and NUMA nodes on which the jobs of a
+/// pool run.
+struct Observations {
+    bslmt::Barrier   d_barrier;   // holds each thread until all run a job
+    bslmt::Mutex     d_mutex;     // protects the vectors below
+    bsl::vector<int> d_cpus;      // CPUs observed
+    bsl::vector<int> d_numaNodes; // NUMA nodes observed
+
+    explicit Observations(int numThreads)
+    : d_barrier(numThreads)
+    {
+    }
+};
+
+/// Record the current CPU and NUMA node in the specified `observations`,
+/// then wait on its barrier so that no thread of the pool runs more than one
+/// job.
+void observePlacementJob(Observations *observations)
+{
+    const int cpu  = bslmt::ThreadUtil::currentCpu();
+    const int node = bslmt::ThreadUtil::currentNumaNode();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&observations->d_mutex);
+
+        observations->d_cpus.push_back(cpu);
+        observations->d_numaNodes.push_back(node);
+    }
+    observations->d_barrier.wait();
+}
+
+/// Start the specified `pool` having the specified `numThreads` minimum and
+/// maximum number of threads, run one job on each thread, load the CPUs and
+/// NUMA nodes observed into the specified `observations`, and stop the pool.
+/// Return the status of `start`.
+int runObservations(Obj *pool, Observations *observations, int numThreads)
+{
+    const int rc = pool->start();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(
+                                                       &observePlacementJob,
+                                                       observations)));
+    }
+    pool->stop();
+
+    bsl::sort(observations->d_cpus.begin(), observations->d_cpus.end());
+    return 0;
+}
+
+}  // close namespace case18
+
 // ============================================================================
 //                         CASE 17 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -1291,6 +1356,147 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0: // 0 is always the first test case
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD PLACEMENT
+        //
+        // Concerns:
+        // 1. By default, the pool's placement is `ThreadPlacement()`, and
+        //    `setThreadPlacement` sets the value returned by
+        //    `threadPlacement`.
+        //
+        // 2. On Linux, under the `e_COMPACT` policy, the thread created while
+        //    the pool has `i` threads runs on the CPU at index `i` (modulo
+        //    the number of CPUs) of the placement's CPU order.
+        //
+        // 3. On Linux, under the `e_NONE` policy with a NUMA node, every
+        //    thread runs on that node.
+        //
+        // 4. On Linux, `start` fails if the placement designates a NUMA node
+        //    that does not exist, leaving the pool disabled.
+        //
+        // Plan:
+        // 1. Verify the placement of a newly created pool, set a placement,
+        //    and verify it.  (C-1)
+        //
+        // 2. Start pools having equal minimum and maximum numbers of threads
+        //    with each placement, run one job per thread, and compare the
+        //    observed CPUs and nodes with those expected.  (C-2..3)
+        //
+        // 3. Start a pool whose placement names a node beyond the last
+        //    online node, and verify that `start` fails.  (C-4)
+        //
+        // Testing:
+        //   void setThreadPlacement(const ThreadPlacement&);
+        //   ThreadPlacement threadPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING THREAD PLACEMENT\n"
+                             "========================\n";
+
+        typedef bdlmt::ThreadPlacement Placement;
+
+        const int k_NUM_THREADS = 3;
+        const int k_IDLE_TIME   = 100;
+
+        bslmt::ThreadAttributes attributes;
+
+        bsl::vector<int> nodes;
+        bslmt::CpuTopologyUtil::loadOnlineNumaNodes(&nodes);
+
+        if (verbose) cout << "Setting and getting the placement\n";
+        {
+            Obj mX(attributes,
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   k_IDLE_TIME,
+                   &testAllocator);
+            const Obj& X = mX;
+
+            ASSERT(Placement() == X.threadPlacement());
+
+            const Placement PLACEMENT(Placement::e_SCATTER, nodes.front());
+            mX.setThreadPlacement(PLACEMENT);
+            ASSERT(PLACEMENT == X.threadPlacement());
+        }
+
+        if (verbose) cout << "Compact placement\n";
+        {
+            const Placement PLACEMENT(Placement::e_COMPACT);
+
+            bsl::vector<int> order;
+            PLACEMENT.loadCpuOrder(&order);
+            ASSERT(!order.empty());
+
+            bsl::vector<int> expected;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                expected.push_back(order[i % order.size()]);
+            }
+            bsl::sort(expected.begin(), expected.end());
+
+            Obj mX(attributes,
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   k_IDLE_TIME,
+                   &testAllocator);
+            mX.setThreadPlacement(PLACEMENT);
+
+            case18::Observations observations(k_NUM_THREADS);
+            ASSERT(0 == case18::runObservations(&mX,
+                                                &observations,
+                                                k_NUM_THREADS));
+
+            ASSERT(k_NUM_THREADS ==
+                             static_cast<int>(observations.d_cpus.size()));
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(expected == observations.d_cpus);
+#endif
+        }
+
+        if (verbose) cout << "Restricting threads to a NUMA node\n";
+        {
+            const int NODE = nodes.back();
+
+            Obj mX(attributes,
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   k_IDLE_TIME,
+                   &testAllocator);
+            mX.setThreadPlacement(Placement(Placement::e_NONE, NODE));
+
+            case18::Observations observations(k_NUM_THREADS);
+            ASSERT(0 == case18::runObservations(&mX,
+                                                &observations,
+                                                k_NUM_THREADS));
+
+            for (bsl::size_t i = 0; i < observations.d_numaNodes.size(); ++i) {
+                const int OBSERVED = observations.d_numaNodes[i];
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                ASSERTV(NODE, OBSERVED, NODE == OBSERVED);
+#else
+                (void)OBSERVED;
+#endif
+            }
+        }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        if (verbose) cout << "Nonexistent NUMA node\n";
+        {
+            Obj mX(attributes,
+                   k_NUM_THREADS,
+                   k_NUM_THREADS,
+                   k_IDLE_TIME,
+                   &testAllocator);
+            const Obj& X = mX;
+            mX.setThreadPlacement(Placement(Placement::e_COMPACT,
+                                            nodes.back() + 1));
+
+            ASSERT(0 != mX.start());
+            ASSERT(0 == X.enabled());
+            ASSERT(0 == X.numWaitingThreads());
+        }
+#endif
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // INTERNAL FUNCTOR MOVE
@@ -0,0 +1,768 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+#include <bdlf_memfn.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+///Implementation Notes
+///--------------------
+// Each processing thread owns a `WorkStealingThreadPool_Deque`, which is an
+// implementation of the Chase-Lev work-stealing deque, using the memory
+// orderings described by Le, Pop, Cohen, and Zappa Nardelli ("Correct and
+// Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).  The owner of
+// a deque modifies `d_bottom`; thieves modify only `d_top`, using a
+// compare-and-swap.  The only conflict between the owner and a thief arises
+// when a single element remains, in which case the owner also uses a
+// compare-and-swap on `d_top` to claim the element.  Since `bsls` atomic types
+// do not provide a stand-alone fence, the sequentially consistent fences of
+// the original algorithm are obtained by using sequentially consistent
+// operations on `d_top` and `d_bottom` at those points.
+//
+// A processing thread blocks on `d_workCondition` only after registering
+// itself in `d_numSleepingThreads` and then observing (while holding
+// `d_mutex`) that `d_numPendingJobs` is not positive.  Conversely, an
+// enqueuing thread publishes the job, increments `d_numPendingJobs`, and only
+// then inspects `d_numSleepingThreads`.  Since all of these operations are
+// sequentially consistent, either the processing thread observes the new job,
+// or the enqueuing thread observes the sleeping processing thread and signals
+// the condition (after acquiring `d_mutex`, so that the signal cannot be
+// lost).
+//
+// `d_numOutstandingJobs` is incremented *before* a job is published and
+// decremented only after the job completes, so that `drain` cannot observe a
+// zero count while a job (or a job enqueued by a running job) is pending.
+//
+// `doEnqueueJob` increments `d_numOutstandingJobs` and then re-checks
+// `d_enabled`, while `stop` clears `d_enabled` and then waits for
+// `d_numOutstandingJobs` to reach 0.  Since these operations are sequentially
+// consistent, either the enqueuing thread observes that the pool is disabled
+// (and withdraws the job, undoing its increment), or `stop` observes the
+// increment and waits for the job to complete before stopping the processing
+// threads.  A job can therefore never be published after `stop` has stopped
+// the processing threads, which would leave it stranded and the outstanding
+// count non-zero.
+
+namespace BloombergLP {
+namespace {
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+// The worker state of the calling thread if it is a processing thread of a
+// `bdlmt::WorkStealingThreadPool`, and 0 otherwise.
+BSLMT_THREAD_LOCAL_VARIABLE(void *, g_currentWorker, 0);
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+void backlogMetric(bdlm::Metric                        *value,
+                   const bdlmt::WorkStealingThreadPool *object)
+{
+    *value = bdlm::Metric::Gauge(  object->numPendingJobs()
+                                 + object->numActiveThreads()
+                                 - object->numThreadsStarted());
+}
+
+/// Return the next value of the pseudo-random sequence having the specified
+/// `state`, and update `state`.
+inline
+unsigned int nextRandom(unsigned int *state)
+{
+    // xorshift32
+
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// PRIVATE CLASS METHODS
+WorkStealingThreadPool_Deque::Array *
+WorkStealingThreadPool_Deque::allocateArray(
+                                          bsls::Types::Int64  capacity,
+                                          bslma::Allocator   *allocator)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    const bsl::size_t size = sizeof(Array)
+                           + static_cast<bsl::size_t>(capacity)
+                                           * sizeof(bsls::AtomicPointer<Job>);
+
+    Array *array = new (allocator->allocate(size)) Array();
+
+    array->d_capacity = capacity;
+    array->d_next_p   = 0;
+    array->d_slots_p  = reinterpret_cast<bsls::AtomicPointer<Job> *>(
+                                                                    array + 1);
+
+    for (bsls::Types::Int64 i = 0; i < capacity; ++i) {
+        new (&array->d_slots_p[i]) bsls::AtomicPointer<Job>();
+    }
+
+    return array;
+}
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool_Deque::Array *WorkStealingThreadPool_Deque::grow(
+                                                   Array              *array,
+                                                   bsls::Types::Int64  top,
+                                                   bsls::Types::Int64  bottom)
+{
+    Array *result = allocateArray(array->d_capacity * 2, d_allocator_p);
+
+    const bsls::Types::Int64 oldMask = array->d_capacity  - 1;
+    const bsls::Types::Int64 newMask = result->d_capacity - 1;
+
+    for (bsls::Types::Int64 i = top; i < bottom; ++i) {
+        result->d_slots_p[i & newMask].storeRelaxed(
+                                  array->d_slots_p[i & oldMask].loadRelaxed());
+    }
+
+    d_array.storeRelease(result);
+
+    // A thief may still be reading from 'array', so it is retained until the
+    // deque is destroyed.
+
+    array->d_next_p = d_retired_p;
+    d_retired_p     = array;
+
+    return result;
+}
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_array(0)
+, d_retired_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_array.storeRelaxed(allocateArray(k_INITIAL_CAPACITY, d_allocator_p));
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_array.loadRelaxed());
+
+    while (d_retired_p) {
+        Array *next = d_retired_p->d_next_p;
+        d_allocator_p->deallocate(d_retired_p);
+        d_retired_p = next;
+    }
+}
+
+// MANIPULATORS
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::popBack()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+    Array                   *array  = d_array.loadRelaxed();
+
+    d_bottom.store(bottom);
+
+    const bsls::Types::Int64 top = d_top.load();
+
+    if (top > bottom) {
+        // The deque was empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = array->d_slots_p[bottom & (array->d_capacity - 1)].
+                                                                 loadRelaxed();
+
+    if (top == bottom) {
+        // This is the last element; race against thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+
+    return job;
+}
+
+void WorkStealingThreadPool_Deque::pushBack(Job *job)
+{
+    BSLS_ASSERT(job);
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+    Array                   *array  = d_array.loadRelaxed();
+
+    if (bottom - top > array->d_capacity - 1) {
+        array = grow(array, top, bottom);
+    }
+
+    array->d_slots_p[bottom & (array->d_capacity - 1)].storeRelaxed(job);
+
+    d_bottom.storeRelease(bottom + 1);
+}
+
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    const bsls::Types::Int64 top    = d_top.load();
+    const bsls::Types::Int64 bottom = d_bottom.load();
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Array *array = d_array.loadAcquire();
+    Job   *job   = array->d_slots_p[top & (array->d_capacity - 1)].
+                                                                 loadRelaxed();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        // Lost the race against the owner or another thief.
+
+        return 0;                                                     // RETURN
+    }
+
+    return job;
+}
+
+                        // ------------------------------------
+                        // class WorkStealingThreadPool::Worker
+                        // ------------------------------------
+
+// CREATORS
+WorkStealingThreadPool::Worker::Worker(WorkStealingThreadPool *pool,
+                                       int                     index,
+                                       bslma::Allocator       *basicAllocator)
+: d_pool_p(pool)
+, d_deque(basicAllocator)
+, d_batch(basicAllocator)
+, d_seed(static_cast<unsigned int>(index) * 2654435761U + 1)
+, d_index(index)
+{
+    d_batch.reserve(k_INJECTION_BATCH_SIZE);
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE CLASS DATA
+const char WorkStealingThreadPool::s_defaultThreadName[16] = { "bdl.WSPool" };
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::discardPendingJobs()
+{
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        while (Job *job = d_workers[i]->d_deque.popBack()) {
+            d_jobPool.deleteObject(job);
+            d_numPendingJobs.addRelaxed(-1);
+            d_numOutstandingJobs.addRelaxed(-1);
+        }
+    }
+
+    bsl::vector<Job *> jobs(d_allocator_p);
+    d_injectionQueue.removeAll(&jobs);
+
+    for (bsl::size_t i = 0; i < jobs.size(); ++i) {
+        d_jobPool.deleteObject(jobs[i]);
+        d_numPendingJobs.addRelaxed(-1);
+        d_numOutstandingJobs.addRelaxed(-1);
+    }
+}
+
+int WorkStealingThreadPool::doEnqueueJob(Job *job)
+{
+    d_numOutstandingJobs.add(1);
+
+    if (!d_enabled.load()) {
+        // 'stop' or 'shutdown' disabled enqueuing after the check made by
+        // 'enqueueJob'; the job must not be published.
+
+        d_jobPool.deleteObject(job);
+        if (0 == d_numOutstandingJobs.add(-1)) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_drainCondition.broadcast();
+        }
+        return e_DISABLED;                                            // RETURN
+    }
+
+    Worker *worker = 0;
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    worker = static_cast<Worker *>(g_currentWorker);
+    if (worker && this != worker->d_pool_p) {
+        worker = 0;
+    }
+#endif
+
+    if (worker) {
+        worker->d_deque.pushBack(job);
+    }
+    else {
+        d_injectionQueue.pushBack(job);
+    }
+
+    d_numPendingJobs.add(1);
+
+    wakeThreadIfNeeded();
+
+    return e_SUCCESS;
+}
+
+void WorkStealingThreadPool::executeJob(Job *job)
+{
+    d_numActiveThreads.addAcqRel(1);
+    d_numPendingJobs.add(-1);
+
+    (*job)();
+    d_jobPool.deleteObject(job);
+
+    d_numActiveThreads.addAcqRel(-1);
+
+    if (0 == d_numOutstandingJobs.add(-1)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_drainCondition.broadcast();
+    }
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    // First, look in the deque owned by 'worker'.
+
+    Job *job = worker->d_deque.popBack();
+    if (job) {
+        return job;                                                   // RETURN
+    }
+
+    // Then, move a batch of jobs from the injection queue.  The first job is
+    // returned, and the remainder are pushed (in reverse order, so that they
+    // are popped in the order they were enqueued) onto the deque of 'worker',
+    // from which other workers may steal them.
+
+    if (0 < d_injectionQueue.length()) {
+        bsl::vector<Job *>& batch = worker->d_batch;
+
+        batch.clear();
+        d_injectionQueue.tryPopFront(k_INJECTION_BATCH_SIZE, &batch);
+
+        if (!batch.empty()) {
+            for (bsl::size_t i = batch.size() - 1; 0 < i; --i) {
+                worker->d_deque.pushBack(batch[i]);
+            }
+            job = batch[0];
+            batch.clear();
+
+            return job;                                               // RETURN
+        }
+    }
+
+    // Finally, attempt to steal from the other workers, starting with a
+    // randomly chosen victim.
+
+    const unsigned int numWorkers = static_cast<unsigned int>(
+                                                             d_workers.size());
+    if (1 < numWorkers) {
+        const unsigned int start = nextRandom(&worker->d_seed) % numWorkers;
+
+        for (unsigned int i = 0; i < numWorkers; ++i) {
+            Worker *victim = d_workers[(start + i) % numWorkers];
+
+            if (victim != worker) {
+                job = victim->d_deque.steal();
+                if (job) {
+                    return job;                                       // RETURN
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::initialize(
+                                      bdlm::MetricsRegistry   *metricsRegistry,
+                                      const bsl::string_view&  threadPoolName)
+{
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(s_defaultThreadName);
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(this,
+                                                        i,
+                                                        d_allocator_p));
+    }
+
+    bdlm::MetricsRegistry *registry = metricsRegistry
+                                   ? metricsRegistry
+                                   : &bdlm::MetricsRegistry::defaultInstance();
+
+    bdlm::InstanceCount::Value instanceNumber =
+             bdlm::InstanceCount::nextInstanceNumber<WorkStealingThreadPool>();
+
+    bdlm::MetricDescriptor mdBacklog(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.backlog",
+             instanceNumber,
+             "bdlmt.workstealingthreadpool",
+             "wstp",
+             threadPoolName,
+             d_allocator_p);
+
+    registry->registerCollectionCallback(
+                                &d_backlogHandle,
+                                mdBacklog,
+                                bdlf::BindUtil::bind(&backlogMetric,
+                                                     bdlf::PlaceHolders::_1,
+                                                     this));
+}
+
+int WorkStealingThreadPool::startNewThread(Worker *worker)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                   bdlf::BindUtil::bindS(d_allocator_p,
+                                         &WorkStealingThreadPool::workerThread,
+                                         this,
+                                         worker),
+                   d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    d_running.store(false);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_workCondition.broadcast();
+    }
+    d_threadGroup.joinAll();
+}
+
+void WorkStealingThreadPool::wakeThreadIfNeeded()
+{
+    if (0 < d_numSleepingThreads.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_workCondition.signal();
+    }
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_currentWorker = worker;
+#endif
+
+    int numFruitlessSearches = 0;
+
+    while (d_running.loadAcquire()) {
+        Job *job = findJob(worker);
+
+        if (job) {
+            numFruitlessSearches = 0;
+            executeJob(job);
+            continue;
+        }
+
+        if (++numFruitlessSearches < k_SPIN_COUNT) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        numFruitlessSearches = 0;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_numSleepingThreads.add(1);
+        if (0 >= d_numPendingJobs.load() && d_running.load()) {
+            d_workCondition.wait(&d_mutex);
+        }
+        d_numSleepingThreads.add(-1);
+    }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_currentWorker = 0;
+#endif
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                            int               numThreads,
+                                            bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_workers(basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numOutstandingJobs(0)
+, d_numSleepingThreads(0)
+, d_enabled(false)
+, d_running(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                      int                      numThreads,
+                                      const bsl::string_view&  threadPoolName,
+                                      bdlm::MetricsRegistry   *metricsRegistry,
+                                      bslma::Allocator        *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_workers(basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numOutstandingJobs(0)
+, d_numSleepingThreads(0)
+, d_enabled(false)
+, d_running(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    d_threadAttributes.setThreadName(threadPoolName);
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_workers(basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numOutstandingJobs(0)
+, d_numSleepingThreads(0)
+, d_enabled(false)
+, d_running(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    initialize(
+        0,
+        (!d_threadAttributes.threadName().empty()
+         ? d_threadAttributes.threadName()
+         : bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION));
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             const bsl::string_view&         threadPoolName,
+                             bdlm::MetricsRegistry          *metricsRegistry,
+                             bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_workers(basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numOutstandingJobs(0)
+, d_numSleepingThreads(0)
+, d_enabled(false)
+, d_running(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(threadPoolName);
+    }
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+    discardPendingJobs();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObject(d_workers[i]);
+    }
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (0 != d_numOutstandingJobs.load()) {
+            d_drainCondition.wait(&d_mutex);
+        }
+    }
+}
+
+void WorkStealingThreadPool::enable()
+{
+    d_enabled.storeRelease(true);
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+        stopThreads();
+        discardPendingJobs();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_running.store(true);
+
+    for (int i = 0; i < d_numThreads; ++i)  {
+        if (0 != startNewThread(d_workers[i])) {
+            stopThreads();
+            return -1;                                                // RETURN
+        }
+    }
+
+    enable();
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            while (0 != d_numOutstandingJobs.load()) {
+                d_drainCondition.wait(&d_mutex);
+            }
+        }
+        stopThreads();
+
+        // Discard any job that was enqueued concurrently with 'disable'.
+
+        discardPendingJobs();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
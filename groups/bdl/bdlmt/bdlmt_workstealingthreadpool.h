@@ -0,0 +1,812 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool that balances load by stealing.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@METRICS:
+//
+// * `bde.backlog`
+//   > number of pending jobs minus number of "idle" threads in the thread pool
+//   > (may be negative)
+//
+// Associated Metric Attributes:
+//  * object type name: "bdlmt.workstealingthreadpool"
+//  * object type abbreviation: "wstp"
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// `bdlmt::WorkStealingThreadPool`, that executes user-defined functions
+// ("jobs") on a fixed number of processing threads, and that is designed to
+// remain scalable when a large number of threads concurrently enqueue and
+// execute short jobs.
+//
+// `bdlmt::ThreadPool` and `bdlmt::FixedThreadPool` hold every pending job in
+// a single queue, so every enqueue and every dequeue operation contends on the
+// same synchronization primitive.  A `bdlmt::WorkStealingThreadPool` instead
+// distributes pending jobs among several queues:
+//
+// * Each processing thread owns a double-ended queue of jobs (a "Chase-Lev"
+//   deque).  Jobs enqueued *from* *a* *processing* *thread* of the pool (e.g.,
+//   a job that enqueues follow-up jobs) are pushed onto the back of the deque
+//   owned by that thread, and the owning thread pops jobs from the back of its
+//   deque without taking any lock.
+//
+// * Jobs enqueued from any other thread (an "external submitter") are placed
+//   on a single *injection* *queue*.  An idle processing thread moves a batch
+//   of jobs from the injection queue to its own deque, so that the injection
+//   queue is visited once per batch rather than once per job.
+//
+// * A processing thread that finds both its own deque and the injection queue
+//   empty attempts to "steal" a job from the front of the deque owned by
+//   another, randomly chosen, processing thread.  Stealing requires only a
+//   single atomic compare-and-swap on the victim's deque.
+//
+// Processing threads that find no work spin briefly and then block until new
+// jobs are enqueued, so an idle pool does not consume CPU.
+//
+// Note that jobs are *not* executed in the order in which they were enqueued:
+// a processing thread executes the most recently enqueued job on its own
+// deque first (which benefits cache locality), whereas stolen jobs are taken
+// in the order they were enqueued.  Applications that require (approximately)
+// first-in first-out execution should use `bdlmt::FixedThreadPool` instead.
+//
+///Interface Compatibility
+///-----------------------
+// `bdlmt::WorkStealingThreadPool` provides the same `enqueueJob`, `start`,
+// `drain`, `stop`, and `shutdown` methods, with the same contracts, as
+// `bdlmt::FixedThreadPool`, so that an application can switch between the two
+// by changing only the type (and construction) of the pool.  In particular:
+//
+// * `enqueueJob` returns 0 on success and a non-zero value if enqueuing is
+//   disabled (e.g., before `start` and after `stop` or `shutdown`).  Since
+//   the pending queues are unbounded, `enqueueJob` never blocks.
+//
+// * `drain` waits until all pending jobs, and any jobs they enqueue, have
+//   completed, without disabling the pool.
+//
+// * `stop` disables enqueuing, waits until all pending jobs have completed,
+//   and joins all processing threads.
+//
+// * `shutdown` disables enqueuing, discards all pending jobs, waits until all
+//   active jobs have completed, and joins all processing threads.
+//
+///Thread Safety
+///-------------
+// The `bdlmt::WorkStealingThreadPool` class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See `bsldoc_glossary` for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// A thread pool ensures that, on unix platforms, all the threads in the pool
+// block all asynchronous signals.  Specifically all the signals, except the
+// following synchronous signals are blocked:
+// ```
+// SIGBUS
+// SIGFPE
+// SIGILL
+// SIGSEGV
+// SIGSYS
+// SIGABRT
+// SIGTRAP
+// SIGIOT
+// ```
+//
+///Thread Names for Sub-Threads
+///----------------------------
+// To facilitate debugging, users can provide a thread name as the `threadName`
+// attribute of the `bslmt::ThreadAttributes` argument passed to the
+// constructor, that will be used for all the sub-threads.  If no
+// `ThreadAttributes` object is passed, or if the `threadName` attribute is not
+// set, the default value "bdl.WSPool" will be used.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursively Splitting a Computation
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// A work-stealing pool is particularly well suited to divide-and-conquer
+// algorithms, in which each job splits its work into smaller jobs.  In this
+// example we sum the elements of a large array by recursively splitting the
+// array into halves until the pieces are small enough to be summed directly.
+//
+// First, we define the state shared by all of the jobs of the computation:
+// ```
+// struct SumContext {
+//     bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+//     const int                     *d_data_p;   // data to be summed
+//     bsls::AtomicInt64              d_sum;      // accumulated result
+// };
+// ```
+// Then, we define the job that sums the elements in the range
+// `[begin .. end)`, enqueuing two half-sized jobs if the range is large.
+// Note that because these jobs are enqueued from a processing thread of the
+// pool, they are pushed onto that thread's own deque, and will be stolen by
+// other processing threads that run out of work:
+// ```
+// void sumJob(SumContext *context, int begin, int end)
+// {
+//     enum { k_GRAIN_SIZE = 1024 };
+//
+//     if (end - begin <= k_GRAIN_SIZE) {
+//         bsls::Types::Int64 sum = 0;
+//         for (int i = begin; i < end; ++i) {
+//             sum += context->d_data_p[i];
+//         }
+//         context->d_sum.addRelaxed(sum);
+//         return;                                                   // RETURN
+//     }
+//
+//     const int middle = begin + (end - begin) / 2;
+//
+//     context->d_pool_p->enqueueJob(
+//                      bdlf::BindUtil::bind(&sumJob, context, begin, middle));
+//     context->d_pool_p->enqueueJob(
+//                        bdlf::BindUtil::bind(&sumJob, context, middle, end));
+// }
+// ```
+// Now, we create and start a pool of four threads:
+// ```
+// bdlmt::WorkStealingThreadPool pool(4);
+//
+// int rc = pool.start();
+// assert(0 == rc);
+// ```
+// Finally, we submit the initial job covering the whole array, `drain` the
+// pool to wait until it and all the jobs it (transitively) enqueued have
+// completed, and verify the result:
+// ```
+// bsl::vector<int> data(100000, 1);
+//
+// SumContext context;
+// context.d_pool_p = &pool;
+// context.d_data_p = data.data();
+//
+// pool.enqueueJob(bdlf::BindUtil::bind(&sumJob,
+//                                      &context,
+//                                      0,
+//                                      static_cast<int>(data.size())));
+// pool.drain();
+//
+// assert(100000 == context.d_sum);
+//
+// pool.stop();
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_deque.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlm_metricsregistry.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+/// This type declares the prototype for functions that are suitable to be
+/// specified `bdlmt::WorkStealingThreadPool::enqueueJob`.
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+
+                    // ==================================
+                    // class WorkStealingThreadPool_Deque
+                    // ==================================
+
+/// This component-private class implements the work-stealing deque described
+/// by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005) for
+/// pointers to jobs.  A single *owner* thread may push and pop
+/// elements at the back of the deque; any number of other threads may
+/// concurrently "steal" elements from the front of the deque.  The
+/// underlying circular array grows as needed; arrays that have been replaced
+/// are retained until the deque is destroyed, since a concurrent thief may
+/// still be reading from them.
+class WorkStealingThreadPool_Deque {
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+
+    /// A circular array of `d_capacity` atomic slots.  The slots are
+    /// allocated in the same block of memory as the `Array` object, and
+    /// immediately follow it.
+    struct Array {
+        bsls::Types::Int64        d_capacity;  // number of slots (power of 2)
+        Array                    *d_next_p;    // next retired array, if any
+        bsls::AtomicPointer<Job> *d_slots_p;   // slots of the array
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_INITIAL_CAPACITY = 256,
+        k_PADDING          = bslmt::Platform::e_CACHE_LINE_SIZE
+                                                  - sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64           d_top;         // index of the front element,
+                                               // modified by thieves
+
+    const char                  d_topPad[k_PADDING];
+                                               // padding to prevent false
+                                               // sharing
+
+    bsls::AtomicInt64           d_bottom;      // one past the index of the
+                                               // back element, modified by the
+                                               // owner only
+
+    bsls::AtomicPointer<Array>  d_array;       // current circular array
+
+    Array                      *d_retired_p;   // arrays replaced by `d_array`
+
+    bslma::Allocator           *d_allocator_p; // memory allocator (held)
+
+    // PRIVATE CLASS METHODS
+
+    /// Return a newly allocated array having the specified `capacity`
+    /// slots, using the specified `allocator` to supply memory.
+    static Array *allocateArray(bsls::Types::Int64  capacity,
+                                bslma::Allocator   *allocator);
+
+    // PRIVATE MANIPULATORS
+
+    /// Replace the current array with one of twice its capacity holding the
+    /// elements in the specified range `[top .. bottom)`, and return the new
+    /// array.  The behavior is undefined unless this method is invoked by
+    /// the owner thread.
+    Array *grow(Array              *array,
+                bsls::Types::Int64  top,
+                bsls::Types::Int64  bottom);
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty deque.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit
+    WorkStealingThreadPool_Deque(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.  Note that the jobs remaining in this deque are
+    /// not destroyed.
+    ~WorkStealingThreadPool_Deque();
+
+    // MANIPULATORS
+
+    /// Remove the job at the back of this deque and return it, or return 0
+    /// if this deque is empty.  The behavior is undefined unless this method
+    /// is invoked by the owner thread.
+    Job *popBack();
+
+    /// Append the specified `job` to the back of this deque.  The behavior
+    /// is undefined unless this method is invoked by the owner thread and
+    /// `0 != job`.
+    void pushBack(Job *job);
+
+    /// Attempt to remove the job at the front of this deque and return it.
+    /// Return 0 if this deque is empty or if another thread removed the
+    /// front job concurrently.  This method may be invoked by any thread.
+    Job *steal();
+
+    // ACCESSORS
+
+    /// Return a snapshot of the number of jobs in this deque.
+    bsls::Types::Int64 length() const;
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+/// This class implements a thread pool used for concurrently executing
+/// multiple user-defined functions ("jobs"), in which each processing thread
+/// owns a deque of pending jobs and idle threads steal jobs from busy ones.
+class WorkStealingThreadPool {
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,  // the job was enqueued
+        e_DISABLED = -1   // enqueuing is disabled
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// The per-thread state of a processing thread.
+    struct Worker {
+        WorkStealingThreadPool       *d_pool_p;    // pool owning this worker
+
+        WorkStealingThreadPool_Deque  d_deque;     // jobs owned by this
+                                                   // thread
+
+        bsl::vector<Job *>            d_batch;     // scratch buffer for
+                                                   // injection queue batches
+
+        unsigned int                  d_seed;      // state of the victim
+                                                   // selection generator
+
+        int                           d_index;     // index of this worker
+
+        // CREATORS
+
+        /// Create a `Worker` of the specified `pool` having the specified
+        /// `index`, using the specified `basicAllocator` to supply memory.
+        Worker(WorkStealingThreadPool *pool,
+               int                     index,
+               bslma::Allocator       *basicAllocator);
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_INJECTION_BATCH_SIZE = 16,  // maximum number of jobs moved from the
+                                      // injection queue per visit
+
+        k_SPIN_COUNT           = 64   // number of fruitless searches for work
+                                      // before a processing thread blocks
+    };
+
+    // PRIVATE CLASS DATA
+    static const char        s_defaultThreadName[16];  // Thread name to use
+                                                       // when none is
+                                                       // specified.
+
+    // DATA
+    bdlma::ConcurrentPool    d_jobPool;           // pool supplying `Job`
+                                                  // objects
+
+    bdlcc::Deque<Job *>      d_injectionQueue;    // jobs enqueued by
+                                                  // external submitters
+
+    bsl::vector<Worker *>    d_workers;           // per-thread state, owned
+
+    bsls::AtomicInt          d_numPendingJobs;    // number of jobs enqueued
+                                                  // but not yet started (may
+                                                  // be transiently negative)
+
+    bsls::AtomicInt          d_numActiveThreads;  // number of threads
+                                                  // processing jobs
+
+    bsls::AtomicInt64        d_numOutstandingJobs;
+                                                  // number of jobs enqueued
+                                                  // but not yet completed
+
+    bsls::AtomicInt          d_numSleepingThreads;
+                                                  // number of threads blocked,
+                                                  // or about to block, on
+                                                  // `d_workCondition`
+
+    bsls::AtomicBool         d_enabled;           // `true` if enqueuing is
+                                                  // enabled
+
+    bsls::AtomicBool         d_running;           // `true` while processing
+                                                  // threads should continue
+                                                  // to run
+
+    bslmt::Mutex             d_mutex;             // guards blocking on the
+                                                  // conditions below
+
+    bslmt::Condition         d_workCondition;     // signaled when jobs are
+                                                  // enqueued
+
+    bslmt::Condition         d_drainCondition;    // signaled when the last
+                                                  // outstanding job completes
+
+    bslmt::Mutex             d_metaMutex;         // mutex to ensure that there
+                                                  // is only one controlling
+                                                  // thread at any time
+
+    bslmt::ThreadGroup       d_threadGroup;       // threads used by this pool
+
+    bslmt::ThreadAttributes  d_threadAttributes;  // thread attributes to be
+                                                  // used when constructing
+                                                  // processing threads
+
+    const int                d_numThreads;        // number of configured
+                                                  // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;          // set of signals to be
+                                                  // blocked in managed threads
+#endif
+
+    bdlm::MetricsRegistryRegistrationHandle
+                             d_backlogHandle;     // backlog metric handle
+
+    bslma::Allocator        *d_allocator_p;       // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+
+    /// Destroy all pending jobs without executing them.  The behavior is
+    /// undefined unless no processing threads are running.
+    void discardPendingJobs();
+
+    /// Push the specified `job` onto the deque of the calling processing
+    /// thread if the calling thread is a processing thread of this pool, and
+    /// onto the injection queue otherwise, then wake a blocked processing
+    /// thread if there is one.  Return `e_SUCCESS`, or destroy `job` and
+    /// return `e_DISABLED` if enqueuing was disabled concurrently.
+    int doEnqueueJob(Job *job);
+
+    /// Execute the specified `job` on the calling processing thread and
+    /// destroy it.
+    void executeJob(Job *job);
+
+    /// Return the next job to be executed by the specified `worker`, taking
+    /// it, in order of preference, from the worker's own deque, from the
+    /// injection queue, or from the deque of another worker; return 0 if no
+    /// job was found.
+    Job *findJob(Worker *worker);
+
+    /// Initialize this thread pool using the stored attributes and the
+    /// specified `metricsRegistry` and `threadPoolName`.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::defaultInstance()`
+    /// is used.
+    void initialize(bdlm::MetricsRegistry   *metricsRegistry,
+                    const bsl::string_view&  threadPoolName);
+
+    /// Internal method to spawn the processing thread for the specified
+    /// `worker`.  Note that this method must be called with `d_metaMutex`
+    /// locked.
+    int startNewThread(Worker *worker);
+
+    /// Stop and join all processing threads.  Note that this method must be
+    /// called with `d_metaMutex` locked.
+    void stopThreads();
+
+    /// Wake one processing thread blocked waiting for work, if any.
+    void wakeThreadIfNeeded();
+
+    /// The main function executed by the processing thread associated with
+    /// the specified `worker`.
+    void workerThread(Worker *worker);
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Construct a thread pool with the specified `numThreads` number of
+    /// processing threads.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The name used for created threads is
+    /// "bdl.WSPool".  The behavior is undefined unless `1 <= numThreads`.
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `numThreads` number of
+    /// processing threads, the specified `threadPoolName` to be used to
+    /// identify this thread pool, and the specified `metricsRegistry` to be
+    /// used for reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::defaultInstance()` is used.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The name used for created threads is `threadPoolName` if not
+    /// empty, otherwise "bdl.WSPool".  The behavior is undefined unless
+    /// `1 <= numThreads`.
+    WorkStealingThreadPool(int                      numThreads,
+                           const bsl::string_view&  threadPoolName,
+                           bdlm::MetricsRegistry   *metricsRegistry,
+                           bslma::Allocator        *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes` and
+    /// `numThreads` number of processing threads.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The name used for
+    /// created threads is `threadAttributes.threadName()` if not empty,
+    /// otherwise "bdl.WSPool".  The detached state of `threadAttributes` is
+    /// ignored, and `e_CREATE_JOINABLE` is used in all cases.  The behavior
+    /// is undefined unless `1 <= numThreads`.
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes`,
+    /// `numThreads` number of processing threads, the specified
+    /// `threadPoolName` to be used to identify this thread pool, and the
+    /// specified `metricsRegistry` to be used for reporting metrics.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::defaultInstance()`
+    /// is used.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.  The name used for created threads is
+    /// `threadAttributes.threadName()` if not empty, otherwise
+    /// `threadPoolName` if not empty, otherwise "bdl.WSPool".  The detached
+    /// state of `threadAttributes` is ignored, and `e_CREATE_JOINABLE` is
+    /// used in all cases.  The behavior is undefined unless
+    /// `1 <= numThreads`.
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           const bsl::string_view&         threadPoolName,
+                           bdlm::MetricsRegistry          *metricsRegistry,
+                           bslma::Allocator               *basicAllocator = 0);
+
+    /// Remove all pending jobs without executing them, block until all
+    /// currently running jobs complete, and then destroy this thread pool.
+    ~WorkStealingThreadPool();
+
+    // MANIPULATORS
+
+    /// Disable enqueuing into this pool.  All subsequent invocations of
+    /// `enqueueJob` will fail immediately.  If the pool is already enqueue
+    /// disabled, this method has no effect.  Note that this method has no
+    /// effect on jobs currently in the pool.
+    void disable();
+
+    /// Wait until all pending jobs, including jobs enqueued by executing
+    /// jobs, complete, without disabling this pool (and may thus wait
+    /// indefinitely).  If the thread pool was not already started
+    /// (`isStarted()` is `false`), this method has no effect.  Note that if
+    /// any jobs are submitted concurrently with this method by threads other
+    /// than the processing threads of this pool, this method may or may not
+    /// wait until they have also completed.
+    void drain();
+
+    /// Enable queuing into this pool.  If the pool is not enqueue disabled,
+    /// this call has no effect.  Note that jobs enqueued before the pool is
+    /// started are executed once `start` is called.
+    void enable();
+
+    /// Enqueue the specified `functor` to be executed by a processing
+    /// thread.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_SUCCESS` on success, and `e_DISABLED` if
+    /// `!isEnabled()`.  If this method is invoked from a processing thread
+    /// of this pool, `functor` is pushed onto that thread's own deque, and
+    /// onto the shared injection queue otherwise.  This operation never
+    /// blocks.  The behavior is undefined unless `functor` is not null.
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+
+    /// Enqueue the specified `function` to be executed by a processing
+    /// thread.  The specified `userData` pointer will be passed to the
+    /// function by the processing thread.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, and `e_DISABLED` if `!isEnabled()`.  This operation never
+    /// blocks.  The behavior is undefined unless `function` is not null.
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+
+    /// Disable enqueuing jobs on this thread pool, cancel all pending jobs,
+    /// wait until all active jobs complete, and join all processing
+    /// threads.  If the thread pool was not already started (`isStarted()`
+    /// is `false`), this method has no effect.  At the completion of this
+    /// method, `false == isStarted()`.
+    void shutdown();
+
+    /// Spawn `numThreads()` processing threads.  On success, enable
+    /// enqueuing and return 0.  Otherwise, join all threads (ensuring
+    /// `false == isStarted()`) and return -1.  If the thread pool was
+    /// already started (`isStarted()` is `true`), this method has no
+    /// effect.
+    int start();
+
+    /// Disable enqueuing jobs on this thread pool, wait until all active
+    /// and pending jobs complete, and join all processing threads.  If the
+    /// thread pool was not already started (`isStarted()` is `false`), this
+    /// method has no effect.  At the completion of this method,
+    /// `false == isStarted()`.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return `true` if enqueuing jobs is enabled on this thread pool, and
+    /// `false` otherwise.
+    bool isEnabled() const;
+
+    /// Return `true` if `numThreads()` are started on this thread pool and
+    /// `false` otherwise (indicating that 0 threads are started on this
+    /// thread pool.)
+    bool isStarted() const;
+
+    /// Return a snapshot of the number of threads that are currently
+    /// processing a job for this thread pool.
+    int numActiveThreads() const;
+
+    /// Return a snapshot of the number of jobs currently enqueued to be
+    /// processed by this thread pool.
+    int numPendingJobs() const;
+
+    /// Return the number of threads passed to this thread pool at
+    /// construction.
+    int numThreads() const;
+
+    /// Return a snapshot of the number of threads currently started by this
+    /// thread pool.
+    int numThreadsStarted() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 WorkStealingThreadPool_Deque::length() const
+{
+    const bsls::Types::Int64 length = d_bottom.loadAcquire()
+                                                        - d_top.loadAcquire();
+
+    return 0 < length ? length : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled.store(false);
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    if (!d_enabled.loadAcquire()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    return doEnqueueJob(new (d_jobPool) Job(bsl::allocator_arg,
+                                            d_allocator_p,
+                                            functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    if (!d_enabled.loadAcquire()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    return doEnqueueJob(new (d_jobPool) Job(
+                                      bsl::allocator_arg,
+                                      d_allocator_p,
+                                      bslmf::MovableRefUtil::move(functor)));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                      WorkStealingThreadPoolJobFunc  function,
+                                      void                          *userData)
+{
+    BSLS_ASSERT(0 != function);
+
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled.loadAcquire();
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    const int numPendingJobs = d_numPendingJobs.loadAcquire();
+
+    return 0 < numPendingJobs ? numPendingJobs : 0;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *WorkStealingThreadPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1331 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlm_metricsregistry.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool maintains one Chase-Lev deque of jobs per
+// processing thread, plus an injection queue for jobs enqueued by other
+// threads.  We first verify the component-private deque in isolation, both
+// single-threaded (for the owner operations and growth of the underlying
+// array) and with concurrent thieves (to verify that every element is removed
+// exactly once).  We then verify that the pool can be started, drained,
+// stopped, and shut down, that jobs enqueued from inside and outside the pool
+// are all executed, and that enqueuing fails when the pool is disabled.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of enqueuing
+// jobs on this pool with `bdlmt::ThreadPool` and `bdlmt::FixedThreadPool`.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(bslma::Allocator *bA = 0);
+// [ 2] ~WorkStealingThreadPool_Deque();
+// [ 2] Job *popBack();
+// [ 2] void pushBack(Job *job);
+// [ 2] Job *steal();
+// [ 2] bsls::Types::Int64 length() const;
+//
+// WorkStealingThreadPool
+// [ 4] WorkStealingThreadPool(int numThreads, *bA = 0);
+// [ 4] WorkStealingThreadPool(nT, threadPoolName, *mR, *bA = 0);
+// [ 4] WorkStealingThreadPool(attributes, nT, *bA = 0);
+// [ 4] WorkStealingThreadPool(attributes, nT, threadPoolName, *mR, *bA = 0);
+// [ 4] ~WorkStealingThreadPool();
+// [ 4] int enqueueJob(const Job& functor);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc function, void *ud);
+// [ 4] int start();
+// [ 4] void drain();
+// [ 4] void stop();
+// [ 4] bool isStarted() const;
+// [ 4] int numThreads() const;
+// [ 4] int numThreadsStarted() const;
+// [ 4] bslma::Allocator *allocator() const;
+// [ 5] void disable();
+// [ 5] void enable();
+// [ 5] bool isEnabled() const;
+// [ 5] void shutdown();
+// [ 5] int numActiveThreads() const;
+// [ 5] int numPendingJobs() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT STEALING
+// [ 6] JOBS ENQUEUING JOBS
+// [ 7] USAGE EXAMPLE
+// [ 8] CONCURRENT ENQUEUE AND STOP
+// [-1] PERFORMANCE COMPARISON
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef Obj::Job                            Job;
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Increment the specified `counter`.
+void incrementJob(bsls::AtomicInt *counter)
+{
+    counter->addRelaxed(1);
+}
+
+/// Increment the integer addressed by the specified `counter`.
+extern "C" void incrementJobFunc(void *counter)
+{
+    static_cast<bsls::AtomicInt *>(counter)->addRelaxed(1);
+}
+
+/// Wait on the specified `barrier`, then increment the specified `counter`.
+void barrierJob(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+{
+    barrier->wait();
+    counter->addRelaxed(1);
+}
+
+/// Enqueue on the specified `pool` two jobs of depth `depth - 1` if the
+/// specified `depth` is positive, and increment the specified `counter`
+/// otherwise.  The total number of increments is `2^depth`.
+void treeJob(Obj *pool, bsls::AtomicInt *counter, int depth)
+{
+    if (0 == depth) {
+        counter->addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        int rc = pool->enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                                       pool,
+                                                       counter,
+                                                       depth - 1));
+        ASSERTV(rc, 0 == rc);
+    }
+}
+
+/// Wait on the specified `barrier`, then enqueue on the specified `pool`
+/// jobs incrementing the specified `counter` until enqueuing fails, and add
+/// the number of jobs successfully enqueued to the specified `numEnqueued`.
+void enqueueUntilDisabled(Obj             *pool,
+                          bsls::AtomicInt *counter,
+                          bsls::AtomicInt *numEnqueued,
+                          bslmt::Barrier  *barrier)
+{
+    barrier->wait();
+
+    int n = 0;
+    while (0 == pool->enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                      counter))) {
+        ++n;
+    }
+    numEnqueued->add(n);
+}
+
+/// Repeatedly steal from the specified `deque` until the specified `done`
+/// flag is set and `deque` is empty, incrementing `(*seen)[i]` for each
+/// stolen element whose address is `&elements[i]`.
+void thiefThread(Deque                          *deque,
+                 const bsls::AtomicBool         *done,
+                 Job                            *elements,
+                 bsl::vector<bsls::AtomicInt>   *seen)
+{
+    while (!done->loadAcquire() || 0 < deque->length()) {
+        Job *job = deque->steal();
+        if (job) {
+            (*seen)[job - elements].addRelaxed(1);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// This class template provides the sample functions used to benchmark the
+/// enqueuing throughput of a thread pool of the (template parameter) type
+/// `POOL`, which must provide `start`, `shutdown`, and `enqueueJob` methods.
+template <class POOL>
+struct PerformanceTest {
+
+    // CLASS DATA
+    static POOL               *s_pool_p;
+    static bsls::Types::Int64  s_busyWork;
+
+    // CLASS METHODS
+    static void initialize(bool)
+    {
+        s_pool_p->start();
+    }
+
+    static void shutdown(bool)
+    {
+        s_pool_p->shutdown();
+    }
+
+    static void cleanup(bool)
+    {
+    }
+
+    static void job()
+    {
+        bslmt::ThroughputBenchmark::busyWork(s_busyWork);
+    }
+
+    static void push(int)
+    {
+        s_pool_p->enqueueJob(&job);
+    }
+
+    /// Run the benchmark using the specified `pool` and write a line of
+    /// comma-separated results prefixed by the specified `scenarioName` to
+    /// the specified `outputFile`.  Use the specified `numPush` enqueuing
+    /// threads, performing the specified `busyPush` amount of work between
+    /// enqueues, and jobs performing the specified `busyPool` amount of
+    /// work.
+    static void run(FILE       *outputFile,
+                    const char *scenarioName,
+                    POOL       *pool,
+                    int         numPush,
+                    int         busyPush,
+                    int         busyPool)
+    {
+        s_pool_p   = pool;
+        s_busyWork = busyPool;
+
+        bslmt::ThroughputBenchmark bench;
+
+        int id = bench.addThreadGroup(&push, numPush, busyPush);
+
+        bslmt::ThroughputBenchmarkResult result;
+        bench.execute(&result, 10, 51, &initialize, &shutdown, &cleanup);
+
+        bsl::vector<double> percentiles(11);
+        result.getPercentiles(&percentiles, id);
+
+        bsl::ostringstream ss;
+        ss << scenarioName;
+        for (bsl::size_t i = 0; i < percentiles.size(); ++i) {
+            ss << ',' << static_cast<bsls::Types::Int64>(percentiles[i]);
+        }
+
+        fprintf(outputFile, "%s\n", ss.str().c_str());
+        fflush(outputFile);
+
+        s_pool_p = 0;
+    }
+};
+
+template <class POOL>
+POOL *PerformanceTest<POOL>::s_pool_p = 0;
+
+template <class POOL>
+bsls::Types::Int64 PerformanceTest<POOL>::s_busyWork = 0;
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursively Splitting a Computation
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// A work-stealing pool is particularly well suited to divide-and-conquer
+// algorithms, in which each job splits its work into smaller jobs.  In this
+// example we sum the elements of a large array by recursively splitting the
+// array into halves until the pieces are small enough to be summed directly.
+//
+// First, we define the state shared by all of the jobs of the computation:
+// ```
+struct SumContext {
+    bdlmt::WorkStealingThreadPool *d_pool_p;   // pool running the jobs
+    const int                     *d_data_p;   // data to be summed
+    bsls::AtomicInt64              d_sum;      // accumulated result
+};
+// ```
+// Then, we define the job that sums the elements in the range
+// `[begin .. end)`, enqueuing two half-sized jobs if the range is large.
+// Note that because these jobs are enqueued from a processing thread of the
+// pool, they are pushed onto that thread's own deque, and will be stolen by
+// other processing threads that run out of work:
+// ```
+void sumJob(SumContext *context, int begin, int end)
+{
+    enum { k_GRAIN_SIZE = 1024 };
+
+    if (end - begin <= k_GRAIN_SIZE) {
+        bsls::Types::Int64 sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += context->d_data_p[i];
+        }
+        context->d_sum.addRelaxed(sum);
+        return;                                                       // RETURN
+    }
+
+    const int middle = begin + (end - begin) / 2;
+
+    context->d_pool_p->enqueueJob(
+                     bdlf::BindUtil::bind(&sumJob, context, begin, middle));
+    context->d_pool_p->enqueueJob(
+                       bdlf::BindUtil::bind(&sumJob, context, middle, end));
+}
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    // access the metrics registry default instance before assign the global
+    // allocator
+
+    bdlm::MetricsRegistry::defaultInstance();
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslmt::TimedCompletionGuard completionGuard(&defaultAllocator);
+    if (0 <= test) {
+        ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                          bsl::format("case {}", test)));
+    }
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ENQUEUE AND STOP
+        //
+        // Concerns:
+        // 1. A job whose `enqueueJob` succeeds concurrently with `stop` is
+        //    executed before `stop` returns.
+        //
+        // 2. No job is left pending after `stop` returns, so that a pool
+        //    stopped while jobs are being enqueued can be restarted and
+        //    drained.
+        //
+        // Plan:
+        // 1. Repeatedly start a pool, have several threads enqueue jobs
+        //    incrementing a counter until enqueuing fails, and `stop` the
+        //    pool concurrently.  Verify that the counter equals the number
+        //    of successful enqueues, and that no job is pending.  (C-1)
+        //
+        // 2. After each round, restart and `drain` the pool, and verify that
+        //    no (stale) job is executed.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT ENQUEUE AND STOP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT ENQUEUE AND STOP" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_ENQUEUERS = 4;
+        const int NUM_ROUNDS    = 200;
+
+        {
+            Obj mX(2, &ta);
+
+            for (int round = 0; round < NUM_ROUNDS; ++round) {
+                bsls::AtomicInt counter(0);
+                bsls::AtomicInt numEnqueued(0);
+                bslmt::Barrier  barrier(NUM_ENQUEUERS + 1);
+
+                ASSERT(0 == mX.start());
+
+                bslmt::ThreadGroup enqueuers(&ta);
+                ASSERT(NUM_ENQUEUERS == enqueuers.addThreads(
+                                  bdlf::BindUtil::bind(&enqueueUntilDisabled,
+                                                       &mX,
+                                                       &counter,
+                                                       &numEnqueued,
+                                                       &barrier),
+                                  NUM_ENQUEUERS));
+
+                barrier.wait();
+                bslmt::ThreadUtil::microSleep(round % 100);
+                mX.stop();
+
+                ASSERTV(round,
+                        mX.numPendingJobs(),
+                        0 == mX.numPendingJobs());
+
+                enqueuers.joinAll();
+
+                ASSERTV(round, counter, numEnqueued, numEnqueued == counter);
+
+                ASSERT(0 == mX.start());
+                mX.drain();
+                mX.stop();
+
+                ASSERTV(round, counter, numEnqueued, numEnqueued == counter);
+            }
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Now, we create and start a pool of four threads:
+// ```
+    bdlmt::WorkStealingThreadPool pool(4);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+// ```
+// Finally, we submit the initial job covering the whole array, `drain` the
+// pool to wait until it and all the jobs it (transitively) enqueued have
+// completed, and verify the result:
+// ```
+    bsl::vector<int> data(100000, 1);
+
+    SumContext context;
+    context.d_pool_p = &pool;
+    context.d_data_p = data.data();
+
+    pool.enqueueJob(bdlf::BindUtil::bind(&sumJob,
+                                         &context,
+                                         0,
+                                         static_cast<int>(data.size())));
+    pool.drain();
+
+    ASSERT(100000 == context.d_sum);
+
+    pool.stop();
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        // 1. Jobs enqueued by a processing thread of the pool are executed.
+        //
+        // 2. `drain` waits until jobs enqueued by executing jobs (which are
+        //    pushed on the deques of the processing threads) complete.
+        //
+        // 3. Jobs enqueued by a processing thread of another pool are placed
+        //    on the injection queue of the target pool, and are executed.
+        //
+        // Plan:
+        // 1. Using pools of various sizes, enqueue a job that recursively
+        //    enqueues a binary tree of jobs, `drain` the pool, and verify
+        //    that the expected number of leaf jobs were executed.  (C-1..2)
+        //
+        // 2. Enqueue on one pool a job that enqueues jobs on a second pool;
+        //    drain both pools and verify all jobs were executed.  (C-3)
+        //
+        // Testing:
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOBS ENQUEUING JOBS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int DEPTH = 12;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            if (veryVerbose) { T_ P(numThreads); }
+
+            Obj mX(numThreads, &ta);
+
+            ASSERT(0 == mX.start());
+
+            for (int iteration = 0; iteration < 4; ++iteration) {
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                                               &mX,
+                                                               &counter,
+                                                               DEPTH)));
+                mX.drain();
+
+                ASSERTV(numThreads, counter, (1 << DEPTH) == counter);
+            }
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tEnqueue from another pool." << endl;
+        {
+            Obj mA(2, &ta);
+            Obj mB(2, &ta);
+
+            ASSERT(0 == mA.start());
+            ASSERT(0 == mB.start());
+
+            bsls::AtomicInt counter(0);
+
+            ASSERT(0 == mA.enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                                           &mB,
+                                                           &counter,
+                                                           DEPTH)));
+            mA.drain();
+            mB.drain();
+
+            // The root job runs on 'mA'; its two children and all their
+            // descendants run on 'mB'.
+
+            ASSERTV(counter, (1 << DEPTH) == counter);
+
+            mA.stop();
+            mB.stop();
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DISABLE, ENABLE, AND SHUTDOWN
+        //
+        // Concerns:
+        // 1. A pool is disabled until `start` is called, and enabled after.
+        //
+        // 2. `disable` causes `enqueueJob` to fail with `e_DISABLED`, and
+        //    `enable` restores enqueuing.
+        //
+        // 3. `shutdown` discards pending jobs, waits for active jobs, and
+        //    joins the processing threads.
+        //
+        // 4. `numActiveThreads` and `numPendingJobs` report the number of
+        //    executing and of pending jobs.
+        //
+        // 5. Jobs enqueued before `start` (after `enable`) are executed once
+        //    the pool is started.
+        //
+        // 6. Pending jobs are destroyed, without being executed, when the
+        //    pool is destroyed without having been started.
+        //
+        // Plan:
+        // 1. Verify `isEnabled` and the status of `enqueueJob` before
+        //    `start`, after `start`, after `disable`, after `enable`, and
+        //    after `shutdown`.  (C-1..2)
+        //
+        // 2. Start a pool with `N` threads, and enqueue `N` jobs that wait
+        //    on a barrier, and `M` jobs that increment a counter.  Verify
+        //    the values of `numActiveThreads` and `numPendingJobs`, then
+        //    invoke `shutdown` from a separate thread, release the barrier,
+        //    and verify that fewer than `M` counter jobs were executed.
+        //    (C-3..4)
+        //
+        // 3. Enable an unstarted pool, enqueue jobs, start the pool, drain
+        //    and verify the jobs were executed.  (C-5)
+        //
+        // 4. Enable an unstarted pool, enqueue jobs, and destroy the pool;
+        //    verify the jobs were not executed and that no memory is leaked.
+        //    (C-6)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DISABLE, ENABLE, AND SHUTDOWN" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bsls::AtomicInt counter(0);
+
+        if (verbose) cout << "\tEnabled state." << endl;
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isEnabled());
+            ASSERT(Obj::e_DISABLED ==
+                      mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                         &counter)));
+
+            ASSERT(0 == mX.start());
+            ASSERT(true == X.isEnabled());
+            ASSERT(Obj::e_SUCCESS ==
+                      mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                         &counter)));
+
+            mX.disable();
+            ASSERT(false == X.isEnabled());
+            ASSERT(Obj::e_DISABLED ==
+                      mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                         &counter)));
+
+            mX.enable();
+            ASSERT(true == X.isEnabled());
+            ASSERT(Obj::e_SUCCESS ==
+                      mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                         &counter)));
+
+            mX.drain();
+            ASSERTV(counter, 2 == counter);
+
+            mX.shutdown();
+            ASSERT(false == X.isEnabled());
+            ASSERT(false == X.isStarted());
+            ASSERT(Obj::e_DISABLED ==
+                      mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                         &counter)));
+        }
+
+        if (verbose) cout << "\tShutdown discards pending jobs." << endl;
+        {
+            const int NUM_THREADS = 4;
+            const int NUM_JOBS    = 1000;
+
+            Obj mX(NUM_THREADS, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier barrier(NUM_THREADS + 1);
+
+            counter = 0;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&barrierJob,
+                                                               &barrier,
+                                                               &counter)));
+            }
+
+            while (NUM_THREADS != X.numActiveThreads()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            }
+
+            ASSERTV(X.numPendingJobs(), NUM_JOBS == X.numPendingJobs());
+            ASSERTV(X.numActiveThreads(),
+                    NUM_THREADS == X.numActiveThreads());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&Obj::shutdown, &mX),
+                                    &ta));
+
+            // Wait until 'shutdown' has disabled the pool before releasing
+            // the jobs.
+
+            while (X.isEnabled()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            barrier.wait();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(false == X.isStarted());
+            ASSERTV(counter, NUM_THREADS <= counter);
+            ASSERTV(counter, NUM_THREADS + NUM_JOBS > counter);
+            ASSERTV(X.numPendingJobs(), 0 == X.numPendingJobs());
+            ASSERTV(X.numActiveThreads(), 0 == X.numActiveThreads());
+        }
+
+        if (verbose) cout << "\tJobs enqueued before `start`." << endl;
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+
+            mX.enable();
+
+            counter = 0;
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            }
+            ASSERTV(X.numPendingJobs(), 100 == X.numPendingJobs());
+
+            bslmt::ThreadUtil::microSleep(10000);
+            ASSERTV(counter, 0 == counter);
+
+            ASSERT(0 == mX.start());
+            mX.drain();
+            ASSERTV(counter, 100 == counter);
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tDestruction of an unstarted pool." << endl;
+        {
+            {
+                Obj mX(3, &ta);
+
+                mX.enable();
+
+                counter = 0;
+                for (int i = 0; i < 100; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                              &incrementJob,
+                                                              &counter)));
+                }
+            }
+            ASSERTV(counter, 0 == counter);
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CREATORS, START, DRAIN, AND STOP
+        //
+        // Concerns:
+        // 1. Each constructor creates a pool, having the specified number of
+        //    threads, that is not started.
+        //
+        // 2. `start` starts `numThreads()` threads, and is idempotent.
+        //
+        // 3. Every job enqueued from a thread external to the pool, using any
+        //    overload of `enqueueJob`, is executed exactly once.
+        //
+        // 4. `drain` waits until all enqueued jobs have completed, and leaves
+        //    the pool started and enabled.
+        //
+        // 5. `stop` waits until all enqueued jobs have completed and joins
+        //    the processing threads; the pool can be restarted.
+        //
+        // 6. All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        // 1. For each constructor, and for a range of thread counts, start
+        //    the pool, enqueue jobs from several external threads using each
+        //    overload of `enqueueJob`, and verify the state of the pool and
+        //    the number of executed jobs after `drain` and `stop`.  Restart
+        //    the pool and repeat.  (C-1..5)
+        //
+        // 2. Use a test allocator, installed as the default allocator, to
+        //    verify that no memory is allocated from the default allocator.
+        //    (C-6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, *bA = 0);
+        //   WorkStealingThreadPool(nT, threadPoolName, *mR, *bA = 0);
+        //   WorkStealingThreadPool(attributes, nT, *bA = 0);
+        //   WorkStealingThreadPool(attributes, nT, threadPoolName, *mR, *bA);
+        //   ~WorkStealingThreadPool();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc function, void *ud);
+        //   int start();
+        //   void drain();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, START, DRAIN, AND STOP" << endl
+                          << "================================" << endl;
+
+        const int NUM_SUBMITTERS = 4;
+        const int NUM_JOBS       = 2000;  // per submitter
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+                if (veryVerbose) { T_ P_(cfg); P(numThreads); }
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                bslma::TestAllocator da("default", veryVeryVerbose);
+
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                bslmt::ThreadAttributes attributes;
+                attributes.setThreadName("wstp.test");
+
+                Obj *objPtr = 0;
+                switch (cfg) {
+                  case 'a': {
+                    objPtr = new (ta) Obj(numThreads, &ta);
+                  } break;
+                  case 'b': {
+                    objPtr = new (ta) Obj(numThreads, "pool", 0, &ta);
+                  } break;
+                  case 'c': {
+                    objPtr = new (ta) Obj(attributes, numThreads, &ta);
+                  } break;
+                  case 'd': {
+                    objPtr = new (ta) Obj(attributes,
+                                          numThreads,
+                                          "pool",
+                                          0,
+                                          &ta);
+                  } break;
+                }
+
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                ASSERT(&ta        == X.allocator());
+                ASSERT(numThreads == X.numThreads());
+                ASSERT(false      == X.isStarted());
+                ASSERT(0          == X.numThreadsStarted());
+
+                for (int round = 0; round < 2; ++round) {
+                    ASSERT(0          == mX.start());
+                    ASSERT(0          == mX.start());
+                    ASSERT(true       == X.isStarted());
+                    ASSERT(numThreads == X.numThreadsStarted());
+
+                    bsls::AtomicInt counter(0);
+
+                    bslmt::ThreadGroup submitters(&ta);
+                    for (int i = 0; i < NUM_SUBMITTERS; ++i) {
+                        struct Submit {
+                            static void run(Obj *pool, bsls::AtomicInt *c)
+                            {
+                                for (int j = 0; j < NUM_JOBS; ++j) {
+                                    int rc;
+                                    if (0 == j % 3) {
+                                        rc = pool->enqueueJob(
+                                                           &incrementJobFunc,
+                                                           c);
+                                    }
+                                    else if (1 == j % 3) {
+                                        const Job job = bdlf::BindUtil::bind(
+                                                                 &incrementJob,
+                                                                 c);
+                                        rc = pool->enqueueJob(job);
+                                    }
+                                    else {
+                                        Job job(bdlf::BindUtil::bind(
+                                                                 &incrementJob,
+                                                                 c));
+                                        rc = pool->enqueueJob(
+                                               bslmf::MovableRefUtil::move(
+                                                                         job));
+                                    }
+                                    ASSERTV(rc, 0 == rc);
+                                }
+                            }
+                        };
+                        ASSERT(0 == submitters.addThread(
+                                           bdlf::BindUtil::bind(&Submit::run,
+                                                                &mX,
+                                                                &counter)));
+                    }
+                    submitters.joinAll();
+
+                    mX.drain();
+
+                    ASSERTV(counter, NUM_SUBMITTERS * NUM_JOBS == counter);
+                    ASSERT(true == X.isStarted());
+                    ASSERT(true == X.isEnabled());
+                    ASSERT(0    == X.numPendingJobs());
+
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                               &incrementJob,
+                                                               &counter)));
+                    mX.stop();
+
+                    ASSERTV(counter, NUM_SUBMITTERS * NUM_JOBS + 1 == counter);
+                    ASSERT(false == X.isStarted());
+                    ASSERT(false == X.isEnabled());
+                    ASSERT(0     == X.numThreadsStarted());
+                }
+
+                ta.deleteObject(objPtr);
+
+                ASSERTV(cfg, numThreads, 0 == ta.numBlocksInUse());
+                ASSERTV(cfg, numThreads, 0 == da.numBlocksTotal());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT STEALING
+        //
+        // Concerns:
+        // 1. When thieves steal concurrently with the owner pushing and
+        //    popping (including while the underlying array grows), every
+        //    element is removed from the deque exactly once.
+        //
+        // Plan:
+        // 1. Create a deque, and a number of thief threads that repeatedly
+        //    steal from it.  On the owner thread, push a large number of
+        //    elements in bursts (forcing growth), interleaved with pops.
+        //    Record, for every element, the number of times it was removed,
+        //    and verify that each count is 1.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT STEALING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT STEALING" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_THIEVES  = 3;
+        const int NUM_ELEMENTS = 200000;
+
+        for (int iteration = 0; iteration < 4; ++iteration) {
+            bsl::vector<Job>             elements(NUM_ELEMENTS, &ta);
+            bsl::vector<bsls::AtomicInt> seen(NUM_ELEMENTS, &ta);
+
+            Deque            mX(&ta);
+            bsls::AtomicBool done(false);
+
+            bslmt::ThreadGroup thieves(&ta);
+            for (int i = 0; i < NUM_THIEVES; ++i) {
+                ASSERT(0 == thieves.addThread(
+                                       bdlf::BindUtil::bind(&thiefThread,
+                                                            &mX,
+                                                            &done,
+                                                            elements.data(),
+                                                            &seen)));
+            }
+
+            int next = 0;
+            int burst = 1;
+            while (next < NUM_ELEMENTS) {
+                for (int i = 0; i < burst && next < NUM_ELEMENTS; ++i) {
+                    mX.pushBack(&elements[next++]);
+                }
+                for (int i = 0; i < burst / 2; ++i) {
+                    Job *job = mX.popBack();
+                    if (job) {
+                        seen[job - elements.data()].addRelaxed(1);
+                    }
+                }
+                burst = burst < 4096 ? burst * 2 : 1;
+            }
+
+            done.storeRelease(true);
+            thieves.joinAll();
+
+            // Anything left after the thieves observed an empty deque.
+
+            while (Job *job = mX.popBack()) {
+                seen[job - elements.data()].addRelaxed(1);
+            }
+
+            int numErrors = 0;
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                if (1 != seen[i]) {
+                    ++numErrors;
+                }
+            }
+            ASSERTV(iteration, numErrors, 0 == numErrors);
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEQUE OPERATIONS
+        //
+        // Concerns:
+        // 1. A default-constructed deque is empty.
+        //
+        // 2. `popBack` removes elements in last-in first-out order, and
+        //    `steal` removes elements in first-in first-out order.
+        //
+        // 3. `popBack` and `steal` return 0 on an empty deque.
+        //
+        // 4. The deque grows beyond its initial capacity, preserving its
+        //    elements.
+        //
+        // 5. All memory is supplied by the specified allocator, and is
+        //    released on destruction.
+        //
+        // Plan:
+        // 1. Push, pop, and steal sequences of elements on a single thread,
+        //    verifying the removed elements and `length`, for sequences both
+        //    shorter and longer than the initial capacity.  (C-1..5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(bslma::Allocator *bA = 0);
+        //   ~WorkStealingThreadPool_Deque();
+        //   Job *popBack();
+        //   void pushBack(Job *job);
+        //   Job *steal();
+        //   bsls::Types::Int64 length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEQUE OPERATIONS" << endl
+                          << "================" << endl;
+
+        const int SIZES[] = { 1, 2, 3, 255, 256, 257, 1000, 5000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator ta("object",  veryVeryVerbose);
+            bslma::TestAllocator da("default", veryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            bsl::vector<Job> elements(SIZE, &sa);
+            {
+                Deque mX(&ta);  const Deque& X = mX;
+
+                ASSERT(0 == X.length());
+                ASSERT(0 == mX.popBack());
+                ASSERT(0 == mX.steal());
+
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.pushBack(&elements[i]);
+                    ASSERTV(SIZE, i, i + 1 == X.length());
+                }
+
+                // Pop the back half in LIFO order.
+
+                const int HALF = SIZE / 2;
+                for (int i = 0; i < HALF; ++i) {
+                    Job *job = mX.popBack();
+                    ASSERTV(SIZE, i, &elements[SIZE - 1 - i] == job);
+                }
+
+                // Steal the front half in FIFO order.
+
+                for (int i = 0; i < SIZE - HALF; ++i) {
+                    Job *job = mX.steal();
+                    ASSERTV(SIZE, i, &elements[i] == job);
+                }
+
+                ASSERT(0 == X.length());
+                ASSERT(0 == mX.popBack());
+                ASSERT(0 == mX.steal());
+
+                // Reuse the (possibly grown) deque.
+
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.pushBack(&elements[i]);
+                }
+                for (int i = 0; i < SIZE; ++i) {
+                    Job *job = mX.popBack();
+                    ASSERTV(SIZE, i, &elements[SIZE - 1 - i] == job);
+                }
+                ASSERT(0 == mX.popBack());
+            }
+
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+            ASSERTV(SIZE, 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a pool, start it, enqueue a few jobs, drain the pool,
+        //    verify the jobs were executed, and stop the pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4     == X.numThreads());
+            ASSERT(false == X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(true == X.isStarted());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            }
+            mX.drain();
+            ASSERTV(counter, 100 == counter);
+
+            mX.stop();
+            ASSERT(false == X.isStarted());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON
+        //   Compare the throughput of enqueuing jobs on a
+        //   `bdlmt::WorkStealingThreadPool`, a `bdlmt::ThreadPool`, and a
+        //   `bdlmt::FixedThreadPool`.
+        //
+        // Plan:
+        // 1. Use `bslmt::ThroughputBenchmark` to measure the number of jobs
+        //    enqueued per second by a varying number of submitting threads,
+        //    for a varying number of processing threads, and for short and
+        //    long jobs.  For each scenario, output the 0th to 100th
+        //    percentiles (in steps of 10) of the per-thread enqueue
+        //    throughput as a comma-separated line, prefixed with the pool
+        //    type and scenario parameters.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE COMPARISON" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator& ta = defaultAllocator;
+
+        const int NUM_CORES = bslmt::ThreadUtil::hardwareConcurrency();
+
+        fprintf(stdout,
+                "pool,push,threads,busyPool,p0,p10,p20,p30,p40,p50,p60,p70,"
+                "p80,p90,p100\n");
+
+        const int BUSY_POOL[] = { 10, 1000 };
+
+        for (int bi = 0; bi < 2; ++bi) {
+            for (int numPush = 1; numPush <= NUM_CORES; numPush *= 2) {
+                for (int numPool = 1; numPool <= NUM_CORES; numPool *= 2) {
+                    char scenario[128];
+
+                    snprintf(scenario,
+                             sizeof scenario,
+                             "%%s,%d,%d,%d",
+                             numPush,
+                             numPool,
+                             BUSY_POOL[bi]);
+
+                    char name[128];
+
+                    snprintf(name, sizeof name, scenario, "wstp");
+                    {
+                        Obj pool(numPool, &ta);
+                        PerformanceTest<Obj>::run(stdout,
+                                                  name,
+                                                  &pool,
+                                                  numPush,
+                                                  0,
+                                                  BUSY_POOL[bi]);
+                    }
+
+                    snprintf(name, sizeof name, scenario, "ftp");
+                    {
+                        bdlmt::FixedThreadPool pool(numPool, 1 << 16, &ta);
+                        PerformanceTest<bdlmt::FixedThreadPool>::run(
+                                                                stdout,
+                                                                name,
+                                                                &pool,
+                                                                numPush,
+                                                                0,
+                                                                BUSY_POOL[bi]);
+                    }
+
+                    snprintf(name, sizeof name, scenario, "tp");
+                    {
+                        bdlmt::ThreadPool pool(bslmt::ThreadAttributes(),
+                                               numPool,
+                                               numPool,
+                                               1000,
+                                               &ta);
+                        PerformanceTest<bdlmt::ThreadPool>::run(
+                                                                stdout,
+                                                                name,
+                                                                &pool,
+                                                                numPush,
+                                                                0,
+                                                                BUSY_POOL[bi]);
+                    }
+                }
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // `bslmt::ThroughputBenchmark`, used by the negative test cases, creates
+    // its threads using the global allocator.
+
+    if (0 <= test) {
+        ASSERT(0 == globalAllocator.numAllocations());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1314 @@
+// bslfmt_preparedformat.h                                            -*-C++-*-
+
+#ifndef INCLUDED_BSLFMT_PREPAREDFORMAT
+#define INCLUDED_BSLFMT_PREPAREDFORMAT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pre-parsed format string and allocation-free rendering.
+//
+//@CLASSES:
+//  bslfmt::PreparedFormat: format string parsed once into cached fields
+//  bslfmt::PreparedFormatUtil: namespace for rendering a `PreparedFormat`
+//
+//@SEE_ALSO: bslfmt_format, ball_fmt
+//
+//@DESCRIPTION: This component provides a class template,
+// `bslfmt::PreparedFormat`, that holds a `bsl::format` format string together
+// with the result of parsing it: the literal text between replacement fields,
+// and the argument index and format specification of each replacement field.
+// This component also provides a utility `struct`,
+// `bslfmt::PreparedFormatUtil`, whose functions render a `PreparedFormat` with
+// a sequence of arguments.
+//
+// `bsl::format` and `bsl::format_to` parse the whole format string on every
+// call, and write every character through a type-erased output iterator.
+// When the same format string is used many times -- as is the case for a
+// logging statement -- the parsing can be done once, and the rendering can
+// write the literal text and the formatted arguments directly into a
+// contiguous buffer:
+//
+// * The constructors of `PreparedFormat` are `constexpr` (in C++14 and later),
+//   so a `PreparedFormat` object initialized from a string literal can be
+//   created at compile time, and a malformed format string is then a
+//   compile-time error.  Otherwise a malformed format string causes the
+//   constructor to throw `bsl::format_error`.
+//
+// * `PreparedFormatUtil::formatToBuffer` writes the output directly into a
+//   caller-supplied character array, in the manner of `snprintf`: output that
+//   does not fit is discarded, and the length of the complete output is
+//   returned.  The standard formatters (e.g., those of
+//   `bslfmt_formatterintegral` and `bslfmt_formatterfloating`) write straight
+//   into that array.  Arguments of integral, floating-point, and string types
+//   whose replacement fields have no format specification (e.g., "{}") are
+//   converted without invoking a formatter at all.
+//
+// * `PreparedFormatUtil::formatToStreamBuf` renders into a buffer on the
+//   stack and writes the result to a stream buffer, a buffer-full at a time:
+//   output longer than the buffer is rendered only once.
+//
+// * `PreparedFormatUtil::formatTo` renders into a buffer on the stack and then
+//   copies the result to an output iterator (the output is rendered directly
+//   to the iterator if it does not fit in the buffer).
+//
+// No memory is allocated by these rendering functions, other than by the
+// formatters of user-defined types (and by the floating-point formatter for
+// precisions too large for its stack buffer).
+//
+// A `PreparedFormat` refers to, but does not copy, the format string supplied
+// at construction, which must therefore outlive it (a string literal always
+// does).
+//
+///Limitations
+///-----------
+// A `PreparedFormat` holds its parsed fields in a fixed-size array of
+// `k_MAX_NUM_SEGMENTS` elements, so that it needs no memory allocation and
+// can be created at compile time.  A format string that has more replacement
+// fields (or escaped braces) than fit in that array, that is longer than
+// `k_MAX_FORMAT_LENGTH` characters, or that has a replacement field with a
+// nested replacement field in its format specification (e.g., "{:{}}"), is
+// still validated, but is not prepared: it is rendered by `bsl::vformat_to`,
+// with the same result and the performance of `bsl::format_to`.
+//
+// Note that, as for `bsl::format` prior to C++20, the number of arguments is
+// checked when the format is rendered: `bsl::format_error` is thrown if a
+// replacement field refers to an argument that was not supplied.
+//
+// This component requires variadic templates, and is not available in C++03.
+//
+///Usage
+///-----
+// In this section we show the intended use of this component.
+//
+///Example 1: Formatting a Frequently Used Message
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we write a message describing an order in many places, and want to
+// avoid parsing its format string every time.
+//
+// First, we create a `PreparedFormat` once, from the format string:
+//```
+//  static const bslfmt::PreparedFormat<char> orderFormat(
+//                                       "order {} for {:>6}: {} @ {:.2f}");
+//  assert(orderFormat.isPrepared());
+//  assert(4 == orderFormat.numArguments());
+//```
+// Then, we render the message into a buffer of our own:
+//```
+//  char        buffer[64];
+//  size_t      length = bslfmt::PreparedFormatUtil::formatToBuffer(
+//                                                             buffer,
+//                                                             sizeof buffer,
+//                                                             orderFormat,
+//                                                             1234,
+//                                                             "IBM",
+//                                                             100,
+//                                                             147.5);
+//  assert(bsl::string_view(buffer, length) ==
+//                                      "order 1234 for    IBM: 100 @ 147.50");
+//```
+// Next, we see that when the buffer is too small, the output is truncated and
+// the length of the complete output is still returned:
+//```
+//  length = bslfmt::PreparedFormatUtil::formatToBuffer(buffer,
+//                                                      10,
+//                                                      orderFormat,
+//                                                      1234,
+//                                                      "IBM",
+//                                                      100,
+//                                                      147.5);
+//  assert(35 == length);
+//  assert(bsl::string_view(buffer, 10) == "order 1234");
+//```
+// Finally, we append the message to a string using an output iterator:
+//```
+//  bsl::string message("message: ");
+//  bslfmt::PreparedFormatUtil::formatTo(bsl::back_inserter(message),
+//                                       orderFormat,
+//                                       5678,
+//                                       "MSFT",
+//                                       7,
+//                                       401.125);
+//  assert(message == "message: order 5678 for   MSFT: 7 @ 401.12");
+//```
+
+#include <bslscm_version.h>
+
+#include <bslfmt_format_arg.h>
+#include <bslfmt_format_args.h>
+#include <bslfmt_format_context.h>
+#include <bslfmt_format_imp.h>
+#include <bslfmt_formaterror.h>
+#include <bslfmt_formatparsecontext.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_keyword.h>
+
+#include <bslstl_algorithm.h>
+#include <bslstl_iterator.h>
+#include <bslstl_monostate.h>
+#include <bslstl_stringview.h>
+#include <bslstl_utility.h>
+
+#include <cstddef>
+#include <cstring>
+#include <streambuf>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+namespace BloombergLP {
+namespace bslfmt {
+
+                            // ====================
+                            // class PreparedFormat
+                            // ====================
+
+/// This value-semantic class template holds a reference to a `bsl::format`
+/// format string together with the parsed form of that string: a sequence of
+/// segments, each consisting of literal text optionally followed by a
+/// replacement field.  All of the constructors and accessors of this class
+/// are `constexpr` in C++14 and later.
+template <class t_CHAR>
+class PreparedFormat {
+  public:
+    // TYPES
+    enum {
+        k_MAX_NUM_SEGMENTS  = 16,      // capacity of the segment array
+
+        k_MAX_FORMAT_LENGTH = 0xffff   // longest format string that is
+                                       // prepared
+    };
+
+    /// This `struct` describes one segment of a prepared format string.
+    /// Offsets are relative to the start of the format string.  Note that
+    /// the data members have default member initializers so that an array
+    /// of segments can be initialized in a constant expression.
+    struct Segment {
+        // DATA
+        unsigned short d_literalOffset = 0;  // offset of the literal text
+
+        unsigned short d_literalLength = 0;  // length of the literal text
+
+        unsigned short d_specOffset    = 0;  // offset of the format
+                                             // specification of the
+                                             // replacement field, which
+                                             // extends up to and including
+                                             // its closing `}`
+
+        unsigned short d_specLength    = 0;  // length of the format
+                                             // specification (including the
+                                             // closing `}`), or 0 if the
+                                             // segment has no field
+
+        short          d_argId         = -1; // argument index of the
+                                             // replacement field, or -1 if
+                                             // there is none
+    };
+
+  private:
+    // DATA
+    const t_CHAR *d_format_p;                       // format string (held,
+                                                    // not owned)
+
+    std::size_t   d_length;                         // length of the format
+                                                    // string
+
+    Segment       d_segments[k_MAX_NUM_SEGMENTS];   // parsed segments
+
+    int           d_numSegments;                    // number of segments
+
+    int           d_numArguments;                   // one more than the
+                                                    // highest argument
+                                                    // index referenced
+
+    bool          d_isPrepared;                     // `false` if the format
+                                                    // must be rendered by
+                                                    // `vformat_to`
+
+    // PRIVATE MANIPULATORS
+
+    /// Append to this object a segment having the literal text in the
+    /// specified range `[literalBegin, literalEnd)` of the format string,
+    /// followed (if the specified `argId` is not negative) by a replacement
+    /// field for the argument `argId` whose format specification (including
+    /// its closing `}`) is in the specified range `[specBegin, specEnd)`.  If
+    /// the segment array is full, mark this object as not prepared instead.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 void addSegment(std::size_t literalBegin,
+                                                 std::size_t literalEnd,
+                                                 int         argId,
+                                                 std::size_t specBegin,
+                                                 std::size_t specEnd);
+
+    /// Parse the format string held by this object and load the resulting
+    /// segments.  Throw `bsl::format_error` if the format string is not
+    /// valid.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 void parse();
+
+  public:
+    // CREATORS
+
+    /// Create a `PreparedFormat` holding the specified null-terminated
+    /// `format` string, and parse it.  Throw `bsl::format_error` if `format`
+    /// is not a valid format string (when evaluated at compile time, an
+    /// invalid `format` is ill-formed).  The behavior is undefined unless
+    /// `format` outlives the created object.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 explicit PreparedFormat(const t_CHAR *format);
+
+    /// Create a `PreparedFormat` holding the specified `format` string, and
+    /// parse it.  Throw `bsl::format_error` if `format` is not a valid format
+    /// string.  The behavior is undefined unless the characters referred to
+    /// by `format` outlive the created object.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 explicit PreparedFormat(
+                                       bsl::basic_string_view<t_CHAR> format);
+
+    // ACCESSORS
+
+    /// Return a view of the format string held by this object.
+    BSLS_KEYWORD_CONSTEXPR_CPP14
+    bsl::basic_string_view<t_CHAR> formatString() const;
+
+    /// Return `true` if the format string held by this object is rendered
+    /// from its cached segments, and `false` if it is rendered by
+    /// `bsl::vformat_to` (see {Limitations}).
+    BSLS_KEYWORD_CONSTEXPR bool isPrepared() const;
+
+    /// Return the minimum number of arguments with which the format string
+    /// held by this object can be rendered.  Note that this is 0 if the
+    /// format string is not prepared.
+    BSLS_KEYWORD_CONSTEXPR int numArguments() const;
+
+    /// Return the number of segments in this object.  Note that this is 0 if
+    /// the format string is not prepared.
+    BSLS_KEYWORD_CONSTEXPR int numSegments() const;
+
+    /// Return a reference providing non-modifiable access to the segment at
+    /// the specified `index` in this object.  The behavior is undefined
+    /// unless `0 <= index < numSegments()`.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 const Segment& segment(int index) const;
+};
+
+                    // ===================================
+                    // class PreparedFormat_BufferIterator
+                    // ===================================
+
+/// This component-private class provides an output iterator that writes
+/// characters into a contiguous buffer of fixed capacity.  The characters
+/// that do not fit are discarded (but counted) unless an overflow stream
+/// buffer is supplied, in which case the contents of the buffer are written
+/// to the stream buffer whenever it is full.
+template <class t_CHAR>
+class PreparedFormat_BufferIterator {
+    // DATA
+    t_CHAR                       *d_buffer_p;    // start of the buffer (held,
+                                                 // not owned)
+
+    std::size_t                   d_capacity;    // capacity of the buffer
+
+    std::size_t                   d_size;        // number of characters in
+                                                 // the buffer
+
+    std::size_t                   d_length;      // number of characters
+                                                 // written, including any
+                                                 // that did not fit
+
+    std::basic_streambuf<t_CHAR> *d_overflow_p;  // stream buffer receiving
+                                                 // the contents of the full
+                                                 // buffer, or 0 if none (held,
+                                                 // not owned)
+
+  public:
+    // TYPES
+    typedef bsl::output_iterator_tag iterator_category;
+    typedef void                     value_type;
+    typedef std::ptrdiff_t           difference_type;
+    typedef void                     pointer;
+    typedef void                     reference;
+
+    // CREATORS
+
+    /// Create an iterator that writes to the specified `buffer` having the
+    /// specified `capacity`.
+    PreparedFormat_BufferIterator(t_CHAR *buffer, std::size_t capacity);
+
+    /// Create an iterator that writes to the specified `buffer` having the
+    /// specified `capacity`, and writes the contents of `buffer` to the
+    /// specified `overflow` stream buffer whenever `buffer` is full.  The
+    /// behavior is undefined unless `0 < capacity`.  Note that `flush` must
+    /// be called to write the characters remaining in `buffer`.
+    PreparedFormat_BufferIterator(t_CHAR                       *buffer,
+                                  std::size_t                   capacity,
+                                  std::basic_streambuf<t_CHAR> *overflow);
+
+    // MANIPULATORS
+
+    /// Return a reference to this object.
+    PreparedFormat_BufferIterator& operator*();
+
+    /// Write the specified `character` at the current position if it is
+    /// within the buffer, and count it in any case.
+    void operator=(t_CHAR character);
+
+    /// Return a reference to this object.  Note that the position is
+    /// advanced by assignment, so that incrementing has no effect.
+    PreparedFormat_BufferIterator& operator++();
+
+    /// Return a reference to this object.  Note that, as for
+    /// `bsl::ostreambuf_iterator`, a reference rather than a copy is
+    /// returned, so that `*it++ = c` advances `it`.
+    PreparedFormat_BufferIterator& operator++(int);
+
+    /// Write the characters in the specified range `[begin, end)` at the
+    /// current position, discarding those that do not fit in the buffer
+    /// (if this iterator has no overflow stream buffer).
+    void append(const t_CHAR *begin, const t_CHAR *end);
+
+    /// Write the characters in the buffer to the overflow stream buffer of
+    /// this iterator, if any, and empty the buffer.
+    void flush();
+
+    // ACCESSORS
+
+    /// Return the number of characters written to this iterator, including
+    /// those that did not fit in the buffer.
+    std::size_t length() const;
+};
+
+                       // ==============================
+                       // struct PreparedFormat_CopyUtil
+                       // ==============================
+
+/// This component-private `struct` provides a namespace for functions that
+/// copy a range of characters to an output iterator, using a single block
+/// copy when the iterator is a `PreparedFormat_BufferIterator`.
+struct PreparedFormat_CopyUtil {
+    // CLASS METHODS
+
+    /// Write the characters in the specified range `[begin, end)`, each
+    /// converted to the character type of the specified `out` iterator, to
+    /// `out`, and return the iterator past the last character written.
+    template <class t_FROM, class t_OUT>
+    static t_OUT copy(const t_FROM *begin, const t_FROM *end, t_OUT out);
+    template <class t_CHAR>
+    static PreparedFormat_BufferIterator<t_CHAR> copy(
+                                  const t_CHAR                          *begin,
+                                  const t_CHAR                          *end,
+                                  PreparedFormat_BufferIterator<t_CHAR>  out);
+};
+
+                     // =================================
+                     // class PreparedFormat_FieldVisitor
+                     // =================================
+
+/// This component-private class provides a visitor for `basic_format_arg`
+/// objects that formats the visited argument according to the format
+/// specification held by a parse context, and writes it to a format context.
+template <class t_OUT, class t_CHAR>
+class PreparedFormat_FieldVisitor {
+    // PRIVATE TYPES
+    typedef typename basic_format_arg<
+                    basic_format_context<t_OUT, t_CHAR> >::handle Handle;
+
+    // DATA
+    basic_format_parse_context<t_CHAR>  *d_parseContext_p;   // specification
+    basic_format_context<t_OUT, t_CHAR> *d_formatContext_p;  // output
+    bool                                 d_isDefaultSpec;    // empty spec
+
+    // PRIVATE MANIPULATORS
+
+    /// Write the characters in the specified range `[begin, end)` to the
+    /// format context, converting each to `t_CHAR`.
+    template <class t_FROM>
+    void write(const t_FROM *begin, const t_FROM *end) const;
+
+    /// Write the default (decimal, or shortest round-trip for floating-point
+    /// types) representation of the specified `value` to the format context.
+    template <class t_NUMBER>
+    void writeNumber(t_NUMBER value) const;
+
+    /// Format the specified `value` using `bsl::formatter<t_VALUE, t_CHAR>`.
+    template <class t_VALUE>
+    void useFormatter(const t_VALUE& value) const;
+
+  public:
+    // CREATORS
+
+    /// Create a visitor that formats according to the specified
+    /// `parseContext` into the specified `formatContext`.  The specified
+    /// `isDefaultSpec` indicates that the specification is empty (i.e., the
+    /// field is "{}" or "{:}").
+    PreparedFormat_FieldVisitor(
+                       basic_format_parse_context<t_CHAR>  *parseContext,
+                       basic_format_context<t_OUT, t_CHAR> *formatContext,
+                       bool                                 isDefaultSpec);
+
+    // ACCESSORS
+
+    /// Format the specified `value`.
+    void operator()(bsl::monostate) const;
+    void operator()(int value) const;
+    void operator()(unsigned value) const;
+    void operator()(long long value) const;
+    void operator()(unsigned long long value) const;
+    void operator()(float value) const;
+    void operator()(double value) const;
+    void operator()(const t_CHAR *value) const;
+    void operator()(bsl::basic_string_view<t_CHAR> value) const;
+    void operator()(const Handle& value) const;
+    template <class t_VALUE>
+    void operator()(t_VALUE value) const;
+};
+
+                         // =========================
+                         // struct PreparedFormatUtil
+                         // =========================
+
+/// This `struct` provides a namespace for functions that render a
+/// `PreparedFormat` with a sequence of arguments.
+struct PreparedFormatUtil {
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_BUFFER_SIZE = 512  // size of the stack buffer used by `formatTo`
+                             // and `formatToStreamBuf`
+    };
+
+    // PRIVATE CLASS METHODS
+
+    /// Render the specified `format` with the specified `args` to the
+    /// specified `out` iterator, and return the iterator past the output.
+    /// The behavior is undefined unless `format.isPrepared()`.
+    template <class t_OUT, class t_CHAR, class t_CONTEXT>
+    static t_OUT render(t_OUT                               out,
+                        const PreparedFormat<t_CHAR>&       format,
+                        const basic_format_args<t_CONTEXT>& args);
+
+    /// Render the specified `format` with the specified `args` to the
+    /// specified `out` iterator using `vformat_to`, and return the iterator
+    /// past the output.
+    template <class t_OUT, class... t_ARGS>
+    static t_OUT vformatTo(t_OUT                         out,
+                           const PreparedFormat<char>&   format,
+                           const t_ARGS&...              args);
+    template <class t_OUT, class... t_ARGS>
+    static t_OUT vformatTo(t_OUT                          out,
+                           const PreparedFormat<wchar_t>& format,
+                           const t_ARGS&...               args);
+
+    /// Render the specified `format` with the specified `args` to the
+    /// specified `out` buffer iterator, and return the iterator past the
+    /// output.
+    template <class t_CHAR, class... t_ARGS>
+    static PreparedFormat_BufferIterator<t_CHAR> renderToBuffer(
+                                 PreparedFormat_BufferIterator<t_CHAR> out,
+                                 const PreparedFormat<t_CHAR>&         format,
+                                 const t_ARGS&...                      args);
+
+  public:
+    // CLASS METHODS
+
+    /// Render the specified `format` with the specified `args` into the
+    /// specified `buffer` having the specified `size`, and return the length
+    /// of the complete output.  If the output is longer than `size`, only
+    /// its first `size` characters are written.  Note that no null
+    /// terminator is written.  Throw `bsl::format_error` if the output
+    /// cannot be produced (e.g., a replacement field refers to an argument
+    /// that is not supplied, or its format specification is invalid for the
+    /// type of that argument).
+    template <class t_CHAR, class... t_ARGS>
+    static std::size_t formatToBuffer(t_CHAR                        *buffer,
+                                      std::size_t                    size,
+                                      const PreparedFormat<t_CHAR>&  format,
+                                      const t_ARGS&...               args);
+
+    /// Render the specified `format` with the specified `args` to the
+    /// specified `streamBuf`, and return the length of the output.  The
+    /// output is rendered into a buffer on the stack, which is written to
+    /// `streamBuf` whenever it is full and once the rendering is complete,
+    /// so that the output is rendered only once whatever its length.  Throw
+    /// `bsl::format_error` if the output cannot be produced (e.g., a
+    /// replacement field refers to an argument that is not supplied, or its
+    /// format specification is invalid for the type of that argument), in
+    /// which case nothing is written unless the output exceeds the buffer.
+    template <class t_CHAR, class... t_ARGS>
+    static std::size_t formatToStreamBuf(
+                                 std::basic_streambuf<t_CHAR>  *streamBuf,
+                                 const PreparedFormat<t_CHAR>&  format,
+                                 const t_ARGS&...               args);
+
+    /// Render the specified `format` with the specified `args` to the
+    /// specified `out` iterator, and return the iterator past the output.
+    /// Throw `bsl::format_error` if the output cannot be produced (e.g., a
+    /// replacement field refers to an argument that is not supplied, or its
+    /// format specification is invalid for the type of that argument), in
+    /// which case nothing is written unless the output exceeds an internal
+    /// buffer.
+    template <class t_OUT, class t_CHAR, class... t_ARGS>
+    static t_OUT formatTo(t_OUT                         out,
+                          const PreparedFormat<t_CHAR>& format,
+                          const t_ARGS&...              args);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class PreparedFormat
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+void PreparedFormat<t_CHAR>::addSegment(std::size_t literalBegin,
+                                        std::size_t literalEnd,
+                                        int         argId,
+                                        std::size_t specBegin,
+                                        std::size_t specEnd)
+{
+    if (k_MAX_NUM_SEGMENTS == d_numSegments) {
+        d_isPrepared = false;
+        return;                                                       // RETURN
+    }
+
+    Segment& segment = d_segments[d_numSegments++];
+
+    segment.d_literalOffset = static_cast<unsigned short>(literalBegin);
+    segment.d_literalLength = static_cast<unsigned short>(literalEnd -
+                                                          literalBegin);
+    segment.d_specOffset    = static_cast<unsigned short>(specBegin);
+    segment.d_specLength    = static_cast<unsigned short>(specEnd - specBegin);
+    segment.d_argId         = static_cast<short>(argId);
+
+    if (argId >= d_numArguments) {
+        d_numArguments = argId + 1;
+    }
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+void PreparedFormat<t_CHAR>::parse()
+{
+    // This mirrors the parsing done by `bsl::vformat_to`, except that the
+    // format specifications are only delimited here; they are parsed by the
+    // formatter of the corresponding argument when the format is rendered.
+
+    enum { e_UNKNOWN, e_AUTOMATIC, e_MANUAL };
+
+    const t_CHAR *fmt = d_format_p;
+
+    if (d_length > k_MAX_FORMAT_LENGTH) {
+        d_isPrepared = false;
+    }
+
+    int         indexing     = e_UNKNOWN;
+    int         nextArgId    = 0;
+    std::size_t literalBegin = 0;
+    std::size_t i            = 0;
+
+    while (i < d_length) {
+        if ('{' == fmt[i]) {
+            if (i + 1 == d_length) {
+                BSLS_THROW(format_error("unmatched {"));
+            }
+            if ('{' == fmt[i + 1]) {
+                // An escaped '{' ends a segment whose text includes one '{'.
+
+                addSegment(literalBegin, i + 1, -1, 0, 0);
+                i            += 2;
+                literalBegin  = i;
+                continue;                                           // CONTINUE
+            }
+
+            const std::size_t literalEnd = i;
+            ++i;
+
+            int argId = -1;
+            if ('0' <= fmt[i] && fmt[i] <= '9') {
+                argId = 0;
+                while (i < d_length && '0' <= fmt[i] && fmt[i] <= '9') {
+                    argId = 10 * argId + (fmt[i] - '0');
+                    if (argId > 0x7fff) {
+                        BSLS_THROW(format_error("arg id too large"));
+                    }
+                    ++i;
+                }
+                if (i == d_length) {
+                    BSLS_THROW(format_error("unmatched {"));
+                }
+                if (e_AUTOMATIC == indexing) {
+                    BSLS_THROW(format_error(
+                                   "Mixing of automatic and manual indexing"));
+                }
+                indexing = e_MANUAL;
+            }
+            else {
+                if (e_MANUAL == indexing) {
+                    BSLS_THROW(format_error(
+                                   "Mixing of automatic and manual indexing"));
+                }
+                indexing = e_AUTOMATIC;
+                argId    = nextArgId++;
+            }
+
+            // Separator between arg id and format specification
+
+            if (':' == fmt[i]) {
+                ++i;
+            }
+            else if ('}' != fmt[i]) {
+                BSLS_THROW(format_error("Separator ':' missing"));
+            }
+
+            // Find the '}' closing the field, noting any nested fields.
+
+            const std::size_t specBegin = i;
+            int               depth     = 0;
+            while (i < d_length && ('}' != fmt[i] || 0 < depth)) {
+                if ('{' == fmt[i]) {
+                    ++depth;
+                    d_isPrepared = false;
+                }
+                else if ('}' == fmt[i]) {
+                    --depth;
+                }
+                ++i;
+            }
+            if (i == d_length) {
+                BSLS_THROW(format_error("unmatched {"));
+            }
+            ++i;
+
+            addSegment(literalBegin, literalEnd, argId, specBegin, i);
+            literalBegin = i;
+        }
+        else if ('}' == fmt[i]) {
+            if (i + 1 == d_length || '}' != fmt[i + 1]) {
+                BSLS_THROW(format_error("} must be escaped"));
+            }
+
+            // An escaped '}' ends a segment whose text includes one '}'.
+
+            addSegment(literalBegin, i + 1, -1, 0, 0);
+            i            += 2;
+            literalBegin  = i;
+        }
+        else {
+            ++i;
+        }
+    }
+
+    if (literalBegin < d_length) {
+        addSegment(literalBegin, d_length, -1, 0, 0);
+    }
+
+    if (!d_isPrepared) {
+        d_numSegments  = 0;
+        d_numArguments = 0;
+    }
+}
+
+// CREATORS
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+PreparedFormat<t_CHAR>::PreparedFormat(const t_CHAR *format)
+: d_format_p(format)
+, d_length(0)
+, d_segments()
+, d_numSegments(0)
+, d_numArguments(0)
+, d_isPrepared(true)
+{
+    while (format[d_length]) {
+        ++d_length;
+    }
+    parse();
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+PreparedFormat<t_CHAR>::PreparedFormat(bsl::basic_string_view<t_CHAR> format)
+: d_format_p(format.data())
+, d_length(format.length())
+, d_segments()
+, d_numSegments(0)
+, d_numArguments(0)
+, d_isPrepared(true)
+{
+    parse();
+}
+
+// ACCESSORS
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+inline
+bsl::basic_string_view<t_CHAR> PreparedFormat<t_CHAR>::formatString() const
+{
+    return bsl::basic_string_view<t_CHAR>(d_format_p, d_length);
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR
+inline
+bool PreparedFormat<t_CHAR>::isPrepared() const
+{
+    return d_isPrepared;
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR
+inline
+int PreparedFormat<t_CHAR>::numArguments() const
+{
+    return d_numArguments;
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR
+inline
+int PreparedFormat<t_CHAR>::numSegments() const
+{
+    return d_numSegments;
+}
+
+template <class t_CHAR>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+inline
+const typename PreparedFormat<t_CHAR>::Segment&
+PreparedFormat<t_CHAR>::segment(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < d_numSegments);
+
+    return d_segments[index];
+}
+
+                    // -----------------------------------
+                    // class PreparedFormat_BufferIterator
+                    // -----------------------------------
+
+// CREATORS
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR>::PreparedFormat_BufferIterator(
+                                                     t_CHAR      *buffer,
+                                                     std::size_t  capacity)
+: d_buffer_p(buffer)
+, d_capacity(capacity)
+, d_size(0)
+, d_length(0)
+, d_overflow_p(0)
+{
+}
+
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR>::PreparedFormat_BufferIterator(
+                                       t_CHAR                       *buffer,
+                                       std::size_t                   capacity,
+                                       std::basic_streambuf<t_CHAR> *overflow)
+: d_buffer_p(buffer)
+, d_capacity(capacity)
+, d_size(0)
+, d_length(0)
+, d_overflow_p(overflow)
+{
+    BSLS_ASSERT(0 < capacity);
+}
+
+// MANIPULATORS
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR>&
+PreparedFormat_BufferIterator<t_CHAR>::operator*()
+{
+    return *this;
+}
+
+template <class t_CHAR>
+inline
+void PreparedFormat_BufferIterator<t_CHAR>::operator=(t_CHAR character)
+{
+    if (d_size == d_capacity && d_overflow_p) {
+        flush();
+    }
+    if (d_size < d_capacity) {
+        d_buffer_p[d_size] = character;
+        ++d_size;
+    }
+    ++d_length;
+}
+
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR>&
+PreparedFormat_BufferIterator<t_CHAR>::operator++()
+{
+    return *this;
+}
+
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR>&
+PreparedFormat_BufferIterator<t_CHAR>::operator++(int)
+{
+    return *this;
+}
+
+template <class t_CHAR>
+inline
+void PreparedFormat_BufferIterator<t_CHAR>::append(const t_CHAR *begin,
+                                                   const t_CHAR *end)
+{
+    const std::size_t length = end - begin;
+
+    d_length += length;
+
+    if (d_overflow_p && d_capacity - d_size < length) {
+        flush();
+        if (d_capacity <= length) {
+            d_overflow_p->sputn(begin, static_cast<std::streamsize>(length));
+            return;                                                   // RETURN
+        }
+    }
+
+    const std::size_t available = d_capacity - d_size;
+    const std::size_t written   = length < available ? length : available;
+
+    if (0 < written) {
+        std::memcpy(d_buffer_p + d_size, begin, written * sizeof(t_CHAR));
+        d_size += written;
+    }
+}
+
+template <class t_CHAR>
+inline
+void PreparedFormat_BufferIterator<t_CHAR>::flush()
+{
+    if (d_overflow_p && 0 < d_size) {
+        d_overflow_p->sputn(d_buffer_p, static_cast<std::streamsize>(d_size));
+        d_size = 0;
+    }
+}
+
+// ACCESSORS
+template <class t_CHAR>
+inline
+std::size_t PreparedFormat_BufferIterator<t_CHAR>::length() const
+{
+    return d_length;
+}
+
+                       // ------------------------------
+                       // struct PreparedFormat_CopyUtil
+                       // ------------------------------
+
+// CLASS METHODS
+template <class t_FROM, class t_OUT>
+inline
+t_OUT PreparedFormat_CopyUtil::copy(const t_FROM *begin,
+                                    const t_FROM *end,
+                                    t_OUT         out)
+{
+    for (; begin != end; ++begin) {
+        *out = *begin;
+        ++out;
+    }
+    return out;
+}
+
+template <class t_CHAR>
+inline
+PreparedFormat_BufferIterator<t_CHAR> PreparedFormat_CopyUtil::copy(
+                                  const t_CHAR                          *begin,
+                                  const t_CHAR                          *end,
+                                  PreparedFormat_BufferIterator<t_CHAR>  out)
+{
+    out.append(begin, end);
+    return out;
+}
+
+                     // ---------------------------------
+                     // class PreparedFormat_FieldVisitor
+                     // ---------------------------------
+
+// PRIVATE MANIPULATORS
+template <class t_OUT, class t_CHAR>
+template <class t_FROM>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::write(
+                                                   const t_FROM *begin,
+                                                   const t_FROM *end) const
+{
+    d_formatContext_p->advance_to(PreparedFormat_CopyUtil::copy(
+                                                 begin,
+                                                 end,
+                                                 d_formatContext_p->out()));
+}
+
+template <class t_OUT, class t_CHAR>
+template <class t_NUMBER>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::writeNumber(
+                                                          t_NUMBER value) const
+{
+    typedef bslalg::NumericFormatterUtil NFUtil;
+
+    char        buffer[NFUtil::ToCharsMaxLength<t_NUMBER>::k_VALUE];
+    const char *end = NFUtil::toChars(buffer, buffer + sizeof buffer, value);
+
+    write(buffer, end);
+}
+
+template <class t_OUT, class t_CHAR>
+template <class t_VALUE>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::useFormatter(
+                                                  const t_VALUE& value) const
+{
+    bsl::formatter<t_VALUE, t_CHAR> f;
+    d_parseContext_p->advance_to(f.parse(*d_parseContext_p));
+    d_formatContext_p->advance_to(bsl::as_const(f).format(value,
+                                                          *d_formatContext_p));
+}
+
+// CREATORS
+template <class t_OUT, class t_CHAR>
+inline
+PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::PreparedFormat_FieldVisitor(
+                        basic_format_parse_context<t_CHAR>  *parseContext,
+                        basic_format_context<t_OUT, t_CHAR> *formatContext,
+                        bool                                 isDefaultSpec)
+: d_parseContext_p(parseContext)
+, d_formatContext_p(formatContext)
+, d_isDefaultSpec(isDefaultSpec)
+{
+}
+
+// ACCESSORS
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                         bsl::monostate) const
+{
+    BSLS_THROW(format_error("Number of conversion specifiers exceeds "
+                            "number of arguments"));
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(int value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                         unsigned value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                        long long value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                               unsigned long long value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(float value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(double value) const
+{
+    if (d_isDefaultSpec) {
+        writeNumber(value);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                   const t_CHAR *value) const
+{
+    if (d_isDefaultSpec) {
+        const t_CHAR *end = value;
+        while (*end) {
+            ++end;
+        }
+        write(value, end);
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                   bsl::basic_string_view<t_CHAR> value) const
+{
+    if (d_isDefaultSpec) {
+        write(value.data(), value.data() + value.length());
+    }
+    else {
+        useFormatter(value);
+    }
+}
+
+template <class t_OUT, class t_CHAR>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                   const Handle& value) const
+{
+    value.format(*d_parseContext_p, *d_formatContext_p);
+}
+
+template <class t_OUT, class t_CHAR>
+template <class t_VALUE>
+inline
+void PreparedFormat_FieldVisitor<t_OUT, t_CHAR>::operator()(
+                                                         t_VALUE value) const
+{
+    useFormatter(value);
+}
+
+                         // -------------------------
+                         // struct PreparedFormatUtil
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+template <class t_OUT, class t_CHAR, class t_CONTEXT>
+t_OUT PreparedFormatUtil::render(t_OUT                               out,
+                                 const PreparedFormat<t_CHAR>&       format,
+                                 const basic_format_args<t_CONTEXT>& args)
+{
+    BSLS_ASSERT(format.isPrepared());
+
+    typedef typename PreparedFormat<t_CHAR>::Segment Segment;
+
+    const bsl::basic_string_view<t_CHAR> fmtStr  = format.formatString();
+    const t_CHAR                        *fmt     = fmtStr.data();
+    const std::size_t                    numArgs =
+                                        Format_ArgsUtil::formatArgsSize(args);
+
+    if (static_cast<std::size_t>(format.numArguments()) > numArgs) {
+        BSLS_THROW(format_error("Number of conversion specifiers exceeds "
+                                "number of arguments"));
+    }
+
+    t_CONTEXT fc(Format_ContextFactory::construct(out, args));
+
+    for (int i = 0; i < format.numSegments(); ++i) {
+        const Segment& segment = format.segment(i);
+
+        if (segment.d_literalLength) {
+            const t_CHAR *literal = fmt + segment.d_literalOffset;
+
+            fc.advance_to(PreparedFormat_CopyUtil::copy(
+                                             literal,
+                                             literal + segment.d_literalLength,
+                                             fc.out()));
+        }
+
+        if (0 > segment.d_argId) {
+            continue;                                               // CONTINUE
+        }
+
+        basic_format_parse_context<t_CHAR> pc(
+                     bsl::basic_string_view<t_CHAR>(fmt + segment.d_specOffset,
+                                                    segment.d_specLength),
+                     numArgs);
+
+        PreparedFormat_FieldVisitor<t_OUT, t_CHAR> visitor(
+                                                    &pc,
+                                                    &fc,
+                                                    1 == segment.d_specLength);
+
+        visit_format_arg(visitor, args.get(segment.d_argId));
+
+        if (pc.begin() == pc.end() || '}' != *pc.begin()) {
+            BSLS_THROW(format_error("parsing terminated before }"));
+        }
+    }
+
+    return fc.out();
+}
+
+template <class t_OUT, class... t_ARGS>
+inline
+t_OUT PreparedFormatUtil::vformatTo(t_OUT                       out,
+                                    const PreparedFormat<char>& format,
+                                    const t_ARGS&...            args)
+{
+    return bslfmt::vformat_to(out,
+                              format.formatString(),
+                              bslfmt::make_format_args(args...));
+}
+
+template <class t_OUT, class... t_ARGS>
+inline
+t_OUT PreparedFormatUtil::vformatTo(t_OUT                          out,
+                                    const PreparedFormat<wchar_t>& format,
+                                    const t_ARGS&...               args)
+{
+    return bslfmt::vformat_to(out,
+                              format.formatString(),
+                              bslfmt::make_wformat_args(args...));
+}
+
+template <class t_CHAR, class... t_ARGS>
+inline
+PreparedFormat_BufferIterator<t_CHAR> PreparedFormatUtil::renderToBuffer(
+                                 PreparedFormat_BufferIterator<t_CHAR> out,
+                                 const PreparedFormat<t_CHAR>&         format,
+                                 const t_ARGS&...                      args)
+{
+    typedef PreparedFormat_BufferIterator<t_CHAR>  Iterator;
+    typedef basic_format_context<Iterator, t_CHAR> Context;
+
+    if (!format.isPrepared()) {
+        return vformatTo(out, format, args...);                       // RETURN
+    }
+
+    return render(out,
+                  format,
+                  basic_format_args<Context>(
+                      Format_ArgsUtil::makeFormatArgs<Context>(args...)));
+}
+
+// CLASS METHODS
+template <class t_CHAR, class... t_ARGS>
+std::size_t PreparedFormatUtil::formatToBuffer(
+                                       t_CHAR                        *buffer,
+                                       std::size_t                    size,
+                                       const PreparedFormat<t_CHAR>&  format,
+                                       const t_ARGS&...               args)
+{
+    BSLS_ASSERT(buffer || 0 == size);
+
+    return renderToBuffer(PreparedFormat_BufferIterator<t_CHAR>(buffer,
+                                                                size),
+                          format,
+                          args...).length();
+}
+
+template <class t_CHAR, class... t_ARGS>
+std::size_t PreparedFormatUtil::formatToStreamBuf(
+                                 std::basic_streambuf<t_CHAR>  *streamBuf,
+                                 const PreparedFormat<t_CHAR>&  format,
+                                 const t_ARGS&...               args)
+{
+    BSLS_ASSERT(streamBuf);
+
+    t_CHAR buffer[k_BUFFER_SIZE];
+
+    PreparedFormat_BufferIterator<t_CHAR> out = renderToBuffer(
+                PreparedFormat_BufferIterator<t_CHAR>(buffer,
+                                                      k_BUFFER_SIZE,
+                                                      streamBuf),
+                format,
+                args...);
+    out.flush();
+    return out.length();
+}
+
+template <class t_OUT, class t_CHAR, class... t_ARGS>
+t_OUT PreparedFormatUtil::formatTo(t_OUT                         out,
+                                   const PreparedFormat<t_CHAR>& format,
+                                   const t_ARGS&...              args)
+{
+    typedef basic_format_context<t_OUT, t_CHAR> Context;
+
+    if (!format.isPrepared()) {
+        return vformatTo(out, format, args...);                       // RETURN
+    }
+
+    t_CHAR            buffer[k_BUFFER_SIZE];
+    const std::size_t length = formatToBuffer(buffer,
+                                              k_BUFFER_SIZE,
+                                              format,
+                                              args...);
+
+    if (length <= k_BUFFER_SIZE) {
+        return bsl::copy(buffer, buffer + length, out);               // RETURN
+    }
+
+    // The output did not fit in the buffer, so render it again, directly to
+    // `out`.
+
+    return render(out,
+                  format,
+                  basic_format_args<Context>(
+                      Format_ArgsUtil::makeFormatArgs<Context>(args...)));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+#endif  // INCLUDED_BSLFMT_PREPAREDFORMAT
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1288 @@
+// bslfmt_preparedformat.t.cpp                                        -*-C++-*-
+#include <bslfmt_preparedformat.h>
+
+#include <bslfmt_format.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_stopwatch.h>  // Testing only
+
+#include <bslstl_iterator.h>
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <streambuf>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a class template, `PreparedFormat`, that
+// parses a format string into cached segments, and a utility `struct`,
+// `PreparedFormatUtil`, that renders a `PreparedFormat` with arguments.
+//
+// The parsing is verified by checking the segments produced for a table of
+// format strings, and the errors reported for a table of invalid ones.  The
+// rendering is verified by comparing its output with that of `bsl::vformat`
+// for a table of format strings covering the fast paths (integral and string
+// arguments with empty specifications), the standard formatters, escaped
+// braces, and the format strings that are not prepared.
+//-----------------------------------------------------------------------------
+// bslfmt::PreparedFormat
+// [ 2] constexpr PreparedFormat(const t_CHAR *format);
+// [ 2] constexpr PreparedFormat(bsl::basic_string_view<t_CHAR> format);
+// [ 2] constexpr bsl::basic_string_view<t_CHAR> formatString() const;
+// [ 2] constexpr bool isPrepared() const;
+// [ 2] constexpr int numArguments() const;
+// [ 2] constexpr int numSegments() const;
+// [ 2] constexpr const Segment& segment(int index) const;
+//
+// bslfmt::PreparedFormatUtil
+// [ 4] size_t formatToBuffer(CHAR *buf, size_t n, const PF& f, args...);
+// [ 5] OUT formatTo(OUT out, const PF& f, args...);
+// [ 7] size_t formatToStreamBuf(streambuf *sb, const PF& f, args...);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] PreparedFormat_BufferIterator
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: TYPICAL LOG LINES
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+typedef bslfmt::PreparedFormat<char>    Obj;
+typedef bslfmt::PreparedFormat<wchar_t> WObj;
+typedef bslfmt::PreparedFormatUtil      Util;
+
+// The arguments used with the format strings of the rendering tests.
+
+const int                k_INT        = 42;
+const unsigned           k_UNSIGNED   = 7;
+const long long          k_LONG_LONG  = -9000000000LL;
+const double             k_DOUBLE     = 3.25;
+const char *const        k_CSTRING    = "abc";
+const bsl::string_view   k_STRING_VIEW("xyzzy");
+const char               k_CHAR       = 'q';
+const bool               k_BOOL       = true;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the result of formatting the test arguments using the specified
+/// `format` with `bsl::vformat`.
+bsl::string expected(bsl::string_view format)
+{
+    return bslfmt::vformat(format,
+                           bslfmt::make_format_args(k_INT,
+                                                    k_UNSIGNED,
+                                                    k_LONG_LONG,
+                                                    k_DOUBLE,
+                                                    k_CSTRING,
+                                                    k_STRING_VIEW,
+                                                    k_CHAR,
+                                                    k_BOOL));
+}
+
+/// Return the result of rendering the specified `format` with the test
+/// arguments using `PreparedFormatUtil::formatToBuffer`.
+bsl::string actual(const Obj& format)
+{
+    char         buffer[256];
+    const size_t length = Util::formatToBuffer(buffer,
+                                               sizeof buffer,
+                                               format,
+                                               k_INT,
+                                               k_UNSIGNED,
+                                               k_LONG_LONG,
+                                               k_DOUBLE,
+                                               k_CSTRING,
+                                               k_STRING_VIEW,
+                                               k_CHAR,
+                                               k_BOOL);
+    ASSERT(length <= sizeof buffer);
+    return bsl::string(buffer, length);
+}
+
+                            // ===============
+                            // class StreamBuf
+                            // ===============
+
+/// This class provides a stream buffer that appends the characters written
+/// to it to a string, and counts the calls writing them.
+template <class t_CHAR>
+class StreamBuf : public std::basic_streambuf<t_CHAR> {
+    // PRIVATE TYPES
+    typedef std::basic_streambuf<t_CHAR> Base;
+
+    // DATA
+    bsl::basic_string<t_CHAR> d_string;     // characters written
+    int                       d_numWrites;  // number of calls writing them
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Append the specified `character` to the string of this object, and
+    /// return `character`.
+    typename Base::int_type overflow(typename Base::int_type character)
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        d_string.push_back(Base::traits_type::to_char_type(character));
+        ++d_numWrites;
+        return character;
+    }
+
+    /// Append the specified `length` characters at the specified `data` to
+    /// the string of this object, and return `length`.
+    std::streamsize xsputn(const t_CHAR    *data,
+                           std::streamsize  length) BSLS_KEYWORD_OVERRIDE
+    {
+        d_string.append(data, static_cast<size_t>(length));
+        ++d_numWrites;
+        return length;
+    }
+
+  public:
+    // CREATORS
+
+    /// Create an empty stream buffer.
+    StreamBuf()
+    : d_numWrites(0)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return the number of calls that wrote to this stream buffer.
+    int numWrites() const
+    {
+        return d_numWrites;
+    }
+
+    /// Return the characters written to this stream buffer.
+    const bsl::basic_string<t_CHAR>& str() const
+    {
+        return d_string;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    printf("TEST %s CASE %d \n", __FILE__, test);
+
+#if !defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    (void)verbose;
+    (void)veryVerbose;
+
+    if (verbose) {
+        printf("This component requires variadic templates.\n");
+    }
+#else
+    switch (test) {  case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `formatToStreamBuf`
+        //
+        // Concerns:
+        // 1. `formatToStreamBuf` writes the same output as `formatToBuffer`
+        //    to the supplied stream buffer, and returns its length.
+        //
+        // 2. Output longer than the internal buffer is written completely,
+        //    in blocks rather than character by character.
+        //
+        // 3. Format strings that are not prepared are rendered correctly.
+        //
+        // 4. Nothing is written if the output cannot be produced.
+        //
+        // 5. `wchar_t` formats are supported.
+        //
+        // Plan:
+        // 1. Render formats to a test stream buffer and compare the result
+        //    with that of `bsl::vformat`.  (C-1, 3)
+        //
+        // 2. Render a field having a width of 2000 characters, and verify
+        //    the output and the number of writes to the stream buffer.
+        //    (C-2)
+        //
+        // 3. Render a format with too few arguments, and verify that an
+        //    exception is thrown and nothing is written.  (C-4)
+        //
+        // 4. Render a `wchar_t` format.  (C-5)
+        //
+        // Testing:
+        //   size_t formatToStreamBuf(streambuf *sb, const PF& f, args...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `formatToStreamBuf`"
+                            "\n===========================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+        } DATA[] = {
+            { L_, ""                                      },
+            { L_, "text only"                             },
+            { L_, "{0} {1} {2} {3} {4} {5} {6} {7}"       },
+            { L_, "{3:>12.4f}|{0:#x}|{4:^9}"              },
+            { L_, "{0:{1}}"                               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *FORMAT = DATA[ti].d_format;
+
+            const Obj         X(FORMAT);
+            const bsl::string EXPECTED = u::expected(FORMAT);
+
+            u::StreamBuf<char> streamBuf;
+            const size_t       length = Util::formatToStreamBuf(&streamBuf,
+                                                                X,
+                                                                k_INT,
+                                                                k_UNSIGNED,
+                                                                k_LONG_LONG,
+                                                                k_DOUBLE,
+                                                                k_CSTRING,
+                                                                k_STRING_VIEW,
+                                                                k_CHAR,
+                                                                k_BOOL);
+
+            ASSERTV(LINE, EXPECTED == streamBuf.str());
+            ASSERTV(LINE, EXPECTED.length() == length);
+            ASSERTV(LINE, (EXPECTED.empty() ? 0 : 1) == streamBuf.numWrites());
+        }
+
+        if (verbose) printf("\tOutput longer than the internal buffer.\n");
+        {
+            const Obj X("<{:*>2000}>");
+            ASSERT(X.isPrepared());
+
+            u::StreamBuf<char> streamBuf;
+            const size_t       length = Util::formatToStreamBuf(&streamBuf,
+                                                                X,
+                                                                12345);
+
+            const bsl::string& RESULT = streamBuf.str();
+
+            ASSERTV(length, 2002 == length);
+            ASSERTV(RESULT.length(), 2002 == RESULT.length());
+            ASSERT("<" == RESULT.substr(0, 1));
+            ASSERT(bsl::string(1995, '*') == RESULT.substr(1, 1995));
+            ASSERT("12345>" == RESULT.substr(1996));
+            ASSERTV(streamBuf.numWrites(), 8 >= streamBuf.numWrites());
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tNothing is written on error.\n");
+        {
+            const Obj X("{} {}");
+
+            u::StreamBuf<char> streamBuf;
+            bool               caught = false;
+            try {
+                Util::formatToStreamBuf(&streamBuf, X, 1);
+            }
+            catch (const bsl::format_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(streamBuf.str().empty());
+        }
+#endif
+
+        if (verbose) printf("\t`wchar_t` formats.\n");
+        {
+            const WObj X(L"{}:{:>4}:{:x}:{}");
+
+            u::StreamBuf<wchar_t> streamBuf;
+            Util::formatToStreamBuf(&streamBuf, X, 12, L"ab", 255, 1.5);
+
+            ASSERT(L"12:  ab:ff:1.5" == streamBuf.str());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, replace
+        //    leading comment characters with spaces, replace `assert` with
+        //    `ASSERT`, and insert `if (veryVerbose)` before all output
+        //    operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Formatting a Frequently Used Message
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we write a message describing an order in many places, and want to
+// avoid parsing its format string every time.
+//
+// First, we create a `PreparedFormat` once, from the format string:
+//```
+    static const bslfmt::PreparedFormat<char> orderFormat(
+                                         "order {} for {:>6}: {} @ {:.2f}");
+    ASSERT(orderFormat.isPrepared());
+    ASSERT(4 == orderFormat.numArguments());
+//```
+// Then, we render the message into a buffer of our own:
+//```
+    char   buffer[64];
+    size_t length = bslfmt::PreparedFormatUtil::formatToBuffer(
+                                                               buffer,
+                                                               sizeof buffer,
+                                                               orderFormat,
+                                                               1234,
+                                                               "IBM",
+                                                               100,
+                                                               147.5);
+    ASSERT(bsl::string_view(buffer, length) ==
+                                        "order 1234 for    IBM: 100 @ 147.50");
+//```
+// Next, we see that when the buffer is too small, the output is truncated and
+// the length of the complete output is still returned:
+//```
+    length = bslfmt::PreparedFormatUtil::formatToBuffer(buffer,
+                                                        10,
+                                                        orderFormat,
+                                                        1234,
+                                                        "IBM",
+                                                        100,
+                                                        147.5);
+    ASSERT(35 == length);
+    ASSERT(bsl::string_view(buffer, 10) == "order 1234");
+//```
+// Finally, we append the message to a string using an output iterator:
+//```
+    bsl::string message("message: ");
+    bslfmt::PreparedFormatUtil::formatTo(bsl::back_inserter(message),
+                                         orderFormat,
+                                         5678,
+                                         "MSFT",
+                                         7,
+                                         401.125);
+    ASSERT(message == "message: order 5678 for   MSFT: 7 @ 401.12");
+//```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `formatTo`
+        //
+        // Concerns:
+        // 1. `formatTo` writes the same output as `formatToBuffer` to the
+        //    supplied output iterator, and returns the iterator past it.
+        //
+        // 2. Output longer than the internal buffer is written completely.
+        //
+        // 3. Format strings that are not prepared are rendered correctly.
+        //
+        // 4. Nothing is written if the output cannot be produced.
+        //
+        // 5. `wchar_t` formats are supported.
+        //
+        // Plan:
+        // 1. Render formats to a `bsl::string` through a back-insert iterator
+        //    and compare the result with that of `bsl::vformat`.  (C-1, 3)
+        //
+        // 2. Render a field having a width of 2000 characters.  (C-2)
+        //
+        // 3. Render a format with too few arguments, and verify that an
+        //    exception is thrown and the string is unchanged.  (C-4)
+        //
+        // 4. Render a `wchar_t` format.  (C-5)
+        //
+        // Testing:
+        //   OUT formatTo(OUT out, const PF& f, args...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `formatTo`"
+                            "\n==================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+        } DATA[] = {
+            { L_, ""                                      },
+            { L_, "text only"                             },
+            { L_, "{0} {1} {2} {3} {4} {5} {6} {7}"       },
+            { L_, "{3:>12.4f}|{0:#x}|{4:^9}"              },
+            { L_, "{0:{1}}"                               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *FORMAT = DATA[ti].d_format;
+
+            const Obj         X(FORMAT);
+            const bsl::string EXPECTED = "prefix " + u::expected(FORMAT);
+
+            bsl::string result("prefix ");
+            Util::formatTo(bsl::back_inserter(result),
+                           X,
+                           k_INT,
+                           k_UNSIGNED,
+                           k_LONG_LONG,
+                           k_DOUBLE,
+                           k_CSTRING,
+                           k_STRING_VIEW,
+                           k_CHAR,
+                           k_BOOL);
+
+            ASSERTV(LINE, EXPECTED == result);
+        }
+
+        if (verbose) printf("\tOutput longer than the internal buffer.\n");
+        {
+            const Obj X("<{:*>2000}>");
+            ASSERT(X.isPrepared());
+
+            bsl::string result;
+            Util::formatTo(bsl::back_inserter(result), X, 12345);
+
+            ASSERTV(result.length(), 2002 == result.length());
+            ASSERT(bsl::string(1995, '*') == result.substr(1, 1995));
+            ASSERT("12345>" == result.substr(1996));
+        }
+
+        if (verbose) printf("\tReturned iterator.\n");
+        {
+            const Obj X("{}-{}");
+
+            char        buffer[16] = { 0 };
+            const char *end = Util::formatTo(buffer + 0, X, 12, "ab");
+
+            ASSERT(buffer + 5 == end);
+            ASSERT(0 == strcmp("12-ab", buffer));
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tNothing is written on error.\n");
+        {
+            const Obj X("{} {}");
+
+            bsl::string result("unchanged");
+            bool        caught = false;
+            try {
+                Util::formatTo(bsl::back_inserter(result), X, 1);
+            }
+            catch (const bsl::format_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT("unchanged" == result);
+        }
+#endif
+
+        if (verbose) printf("\t`wchar_t` formats.\n");
+        {
+            const WObj X(L"{}:{:>4}:{:x}:{}");
+
+            bsl::wstring result;
+            Util::formatTo(bsl::back_inserter(result), X, 12, L"ab", 255, 1.5);
+
+            ASSERT(L"12:  ab:ff:1.5" == result);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `formatToBuffer`
+        //
+        // Concerns:
+        // 1. The output is identical to that of `bsl::vformat` for integral,
+        //    floating-point, character, boolean, and string arguments, with
+        //    and without format specifications.
+        //
+        // 2. Escaped braces are rendered as single braces.
+        //
+        // 3. Format strings that are not prepared are rendered correctly.
+        //
+        // 4. Output that does not fit in the buffer is truncated, and the
+        //    length of the complete output is returned.
+        //
+        // 5. `bsl::format_error` is thrown if a field refers to an argument
+        //    that is not supplied, or if a format specification is not valid
+        //    for the type of its argument.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, render a set of format strings
+        //    with a fixed set of arguments, and compare the result with that
+        //    of `bsl::vformat`.  (C-1..3)
+        //
+        // 2. Render into buffers of every size from 0 to the output length,
+        //    and verify the returned length and the characters written.  Use
+        //    a guard character to verify that nothing is written past the
+        //    buffer.  (C-4)
+        //
+        // 3. Render formats with too few arguments or invalid specifications
+        //    and verify that `bsl::format_error` is thrown.  (C-5)
+        //
+        // Testing:
+        //   size_t formatToBuffer(CHAR *buf, size_t n, const PF& f, args...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `formatToBuffer`"
+                            "\n========================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+            bool        d_isPrepared;
+        } DATA[] = {
+            // LINE  FORMAT                                      PREPARED
+            // ----  ------------------------------------------  --------
+            {  L_,   "",                                         true     },
+            {  L_,   "plain text",                               true     },
+            {  L_,   "{}",                                       true     },
+            {  L_,   "{} {} {} {} {} {} {} {}",                  true     },
+            {  L_,   "{0}",                                      true     },
+            {  L_,   "{1}",                                      true     },
+            {  L_,   "{2}",                                      true     },
+            {  L_,   "{3}",                                      true     },
+            {  L_,   "{4}",                                      true     },
+            {  L_,   "{5}",                                      true     },
+            {  L_,   "{6}",                                      true     },
+            {  L_,   "{7}",                                      true     },
+            {  L_,   "{0:}|{4:}|{2:}",                           true     },
+            {  L_,   "{0:5}|{0:<5}|{0:^5}|{0:>5}",               true     },
+            {  L_,   "{0:x}|{0:#X}|{0:#010b}|{0:+}|{0:o}",       true     },
+            {  L_,   "{1:*^9}|{2:+015}|{2:x}",                   true     },
+            {  L_,   "{3:.1f}|{3:e}|{3:10.3}|{3:<+8g}|{3:a}",    true     },
+            {  L_,   "{4:>5}|{4:.2}|{5:_<8}|{5:.3s}",            true     },
+            {  L_,   "{6:d}|{6:>3}|{7:s}|{7:d}|{7:^7}",          true     },
+            {  L_,   "{3:}|{3}|{0:}",                            true     },
+            {  L_,   "{{}}{0}{{",                                true     },
+            {  L_,   "}}{{}}{{",                                 true     },
+            {  L_,   "a{0}b{1}c{2}d{3}e{4}f{5}g{6}h{7}i",        true     },
+            {  L_,   "{0:{1}}",                                  false    },
+            {  L_,   "{3:{1}.{1}f}",                             false    },
+            {  L_,   "{0}{0}{0}{0}{0}{0}{0}{0}"
+                     "{0}{0}{0}{0}{0}{0}{0}{0}",                 true     },
+            {  L_,   "{0}{0}{0}{0}{0}{0}{0}{0}"
+                     "{0}{0}{0}{0}{0}{0}{0}{0}{0}",              false    },
+            {  L_,   "{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{",       false    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *FORMAT   = DATA[ti].d_format;
+            const bool  PREPARED = DATA[ti].d_isPrepared;
+
+            const Obj X(FORMAT);
+
+            ASSERTV(LINE, PREPARED == X.isPrepared());
+
+            const bsl::string EXPECTED = u::expected(FORMAT);
+            const bsl::string RESULT   = u::actual(X);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(FORMAT) P(RESULT.c_str())
+            }
+
+            ASSERTV(LINE,
+                    EXPECTED.c_str(),
+                    RESULT.c_str(),
+                    EXPECTED == RESULT);
+        }
+
+        if (verbose) printf("\tFloating-point values.\n");
+        {
+            static const double VALUES[] = {
+                0.0, -0.0, 1.0, -2.5, 0.1, 1.0 / 3, 1e300, -1e-300,
+                123456789.0, 1e16, 5e-324
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            const Obj X("{0}|{0:}|{0:g}|{0:e}");
+
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                const double VALUE  = VALUES[ti];
+                const float  FVALUE = static_cast<float>(VALUE);
+
+                char         buffer[128];
+                const size_t LENGTH = Util::formatToBuffer(buffer,
+                                                           sizeof buffer,
+                                                           X,
+                                                           VALUE);
+
+                const bsl::string EXPECTED = bslfmt::vformat(
+                                             X.formatString(),
+                                             bslfmt::make_format_args(VALUE));
+
+                ASSERTV(ti, EXPECTED == bsl::string(buffer, LENGTH));
+
+                const size_t FLENGTH = Util::formatToBuffer(buffer,
+                                                            sizeof buffer,
+                                                            X,
+                                                            FVALUE);
+
+                const bsl::string FEXPECTED = bslfmt::vformat(
+                                            X.formatString(),
+                                            bslfmt::make_format_args(FVALUE));
+
+                ASSERTV(ti, FEXPECTED == bsl::string(buffer, FLENGTH));
+            }
+        }
+
+        if (verbose) printf("\tTruncation.\n");
+        {
+            const Obj         X("{:>6}|{}|{:.2f}|{}");
+            const bsl::string EXPECTED("    42|abc|3.25|-9000000000");
+
+            for (size_t size = 0; size <= EXPECTED.length() + 1; ++size) {
+                char buffer[64];
+                memset(buffer, '#', sizeof buffer);
+
+                const size_t LENGTH = Util::formatToBuffer(buffer,
+                                                           size,
+                                                           X,
+                                                           k_INT,
+                                                           k_CSTRING,
+                                                           k_DOUBLE,
+                                                           k_LONG_LONG);
+
+                const size_t WRITTEN = size < LENGTH ? size : LENGTH;
+
+                ASSERTV(size, EXPECTED.length() == LENGTH);
+                ASSERTV(size, EXPECTED.substr(0, WRITTEN) ==
+                                            bsl::string(buffer, WRITTEN));
+                ASSERTV(size, '#' == buffer[WRITTEN]);
+            }
+
+            ASSERT(EXPECTED.length() ==
+                   Util::formatToBuffer(static_cast<char *>(0),
+                                        0,
+                                        X,
+                                        k_INT,
+                                        k_CSTRING,
+                                        k_DOUBLE,
+                                        k_LONG_LONG));
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tRendering errors.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format;
+            } ERRORS[] = {
+                { L_, "{} {}"        },  // too few arguments
+                { L_, "{1}"          },  // too few arguments
+                { L_, "{0:s}"        },  // invalid type for `int`
+                { L_, "{0:.2}"       },  // precision for `int`
+                { L_, "{0:q}"        },  // unknown type
+                { L_, "{0:10 }"      },  // trailing characters
+            };
+            const int NUM_ERRORS = sizeof ERRORS / sizeof *ERRORS;
+
+            for (int ti = 0; ti < NUM_ERRORS; ++ti) {
+                const int   LINE   = ERRORS[ti].d_line;
+                const char *FORMAT = ERRORS[ti].d_format;
+
+                const Obj X(FORMAT);
+
+                char buffer[32];
+                bool caught = false;
+                try {
+                    Util::formatToBuffer(buffer, sizeof buffer, X, k_INT);
+                }
+                catch (const bsl::format_error&) {
+                    caught = true;
+                }
+                ASSERTV(LINE, FORMAT, caught);
+            }
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `PreparedFormat_BufferIterator`
+        //
+        // Concerns:
+        // 1. Characters assigned through the iterator are written to the
+        //    buffer until it is full, and counted in any case.
+        //
+        // 2. `append` writes as much of the range as fits, and counts all of
+        //    it.
+        //
+        // 3. Copies of the iterator continue from the position of the
+        //    original.
+        //
+        // 4. An iterator having an overflow stream buffer writes the contents
+        //    of its buffer to the stream buffer whenever the buffer is full,
+        //    and on `flush`, and writes a range longer than the buffer
+        //    directly to the stream buffer.
+        //
+        // Plan:
+        // 1. Write characters and ranges to iterators over buffers of various
+        //    sizes, and verify the buffer contents and `length`.  (C-1..3)
+        //
+        // 2. Write characters and ranges of various lengths to iterators
+        //    having an overflow stream buffer, flush them, and verify the
+        //    characters written to the stream buffer and `length`.  (C-4)
+        //
+        // Testing:
+        //   PreparedFormat_BufferIterator
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `PreparedFormat_BufferIterator`"
+                            "\n=======================================\n");
+
+        typedef bslfmt::PreparedFormat_BufferIterator<char> Iterator;
+
+        for (size_t size = 0; size < 8; ++size) {
+            char buffer[8];
+            memset(buffer, '#', sizeof buffer);
+
+            Iterator mX(buffer, size);  const Iterator& X = mX;
+            ASSERTV(size, 0 == X.length());
+
+            *mX = 'a';
+            ++mX;
+            *mX++ = 'b';
+            ASSERTV(size, 2 == X.length());
+
+            const char *text = "cdef";
+            mX.append(text, text + 4);
+            ASSERTV(size, 6 == X.length());
+
+            Iterator mY(mX);
+            *mY = 'g';
+            ASSERTV(size, 7 == mY.length());
+            ASSERTV(size, 6 == X.length());
+
+            const char   *EXPECTED = "abcdefg";
+            const size_t  WRITTEN  = size < 7 ? size : 7;
+
+            ASSERTV(size, 0 == memcmp(EXPECTED, buffer, WRITTEN));
+            for (size_t i = WRITTEN; i < sizeof buffer; ++i) {
+                ASSERTV(size, i, '#' == buffer[i]);
+            }
+        }
+
+        if (verbose) printf("\tOverflow stream buffer.\n");
+
+        const char *const TEXT = "abcdefghijklmnopqrstuvwxyz";
+
+        for (size_t size = 1; size < 8; ++size) {
+            for (size_t length = 0; length < 12; ++length) {
+                char               buffer[8];
+                u::StreamBuf<char> streamBuf;
+
+                Iterator mX(buffer, size, &streamBuf);
+                const Iterator& X = mX;
+
+                *mX++ = '<';
+                mX.append(TEXT, TEXT + length);
+                *mX++ = '>';
+                ASSERTV(size, length, length + 2 == X.length());
+                ASSERTV(size,
+                        length,
+                        length + 2 - streamBuf.str().length() <= size);
+
+                mX.flush();
+                mX.flush();
+
+                const bsl::string EXPECTED = "<" +
+                                             bsl::string(TEXT, length) +
+                                             ">";
+
+                ASSERTV(size, length, EXPECTED == streamBuf.str());
+                ASSERTV(size, length, length + 2 == X.length());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `PreparedFormat`
+        //
+        // Concerns:
+        // 1. The format string is split into segments of literal text, each
+        //    optionally followed by a replacement field whose argument index
+        //    and format specification (including the closing `}`) are
+        //    recorded.
+        //
+        // 2. Automatic and manual argument indexing are both supported, and
+        //    `numArguments` is one more than the highest index referenced.
+        //
+        // 3. An escaped brace ends a segment whose text includes one brace.
+        //
+        // 4. Format strings having nested replacement fields, or more
+        //    segments than fit in the segment array, are not prepared.
+        //
+        // 5. Invalid format strings cause `bsl::format_error` to be thrown.
+        //
+        // 6. The constructors and accessors can be used in constant
+        //    expressions (in C++14 and later).
+        //
+        // 7. Both constructors produce the same result, and `formatString`
+        //    returns the supplied format.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, construct objects from a set
+        //    of format strings and verify the segments.  (C-1..4, 7)
+        //
+        // 2. Construct objects from a set of invalid format strings and
+        //    verify that `bsl::format_error` is thrown.  (C-5)
+        //
+        // 3. Create a `constexpr` object and check its attributes with
+        //    `static_assert`.  (C-6)
+        //
+        // Testing:
+        //   constexpr PreparedFormat(const t_CHAR *format);
+        //   constexpr PreparedFormat(bsl::basic_string_view<t_CHAR> format);
+        //   constexpr bsl::basic_string_view<t_CHAR> formatString() const;
+        //   constexpr bool isPrepared() const;
+        //   constexpr int numArguments() const;
+        //   constexpr int numSegments() const;
+        //   constexpr const Segment& segment(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `PreparedFormat`"
+                            "\n========================\n");
+
+        // Each segment is described as "LITERAL|ARG|SPEC" where `ARG` is
+        // empty if the segment has no field.
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+            int         d_numArguments;
+            const char *d_segments[4];
+        } DATA[] = {
+            // LINE FORMAT            NARGS  SEGMENTS
+            // ---- ----------------  -----  ---------------------------------
+            { L_,   "",                  0,  { 0 }                           },
+            { L_,   "abc",               0,  { "abc||" }                     },
+            { L_,   "{}",                1,  { "|0|}" }                      },
+            { L_,   "{:}",               1,  { "|0|}" }                      },
+            { L_,   "a{}b{}",            2,  { "a|0|}", "b|1|}" }            },
+            { L_,   "ab{0}cd{1:x}e",     2,  { "ab|0|}", "cd|1|x}", "e||" }  },
+            { L_,   "{2:>8.3f}",         3,  { "|2|>8.3f}" }                 },
+            { L_,   "{1}{1}",            2,  { "|1|}", "|1|}" }              },
+            { L_,   "{{a}}",             0,  { "{||", "a}||" }               },
+            { L_,   "x{{{}}}y",          1,  { "x{||", "|0|}", "}||",
+                                               "y||" }                       },
+            { L_,   "{:{}}",             0,  { 0 }                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const char        *FORMAT   = DATA[ti].d_format;
+            const int          NUM_ARGS = DATA[ti].d_numArguments;
+            const char *const *SEGMENTS = DATA[ti].d_segments;
+
+            int numSegments = 0;
+            while (numSegments < 4 && SEGMENTS[numSegments]) {
+                ++numSegments;
+            }
+
+            const bsl::string_view FORMAT_VIEW(FORMAT);
+
+            const Obj X(FORMAT);
+            const Obj Y(FORMAT_VIEW);
+
+            ASSERTV(LINE, FORMAT_VIEW == X.formatString());
+            ASSERTV(LINE, FORMAT_VIEW.data() == X.formatString().data());
+            ASSERTV(LINE, FORMAT_VIEW == Y.formatString());
+
+            const bool PREPARED = 0 == bsl::string_view(FORMAT).find("{:{");
+
+            ASSERTV(LINE, !PREPARED == X.isPrepared());
+            ASSERTV(LINE, !PREPARED == Y.isPrepared());
+            ASSERTV(LINE, NUM_ARGS, X.numArguments(),
+                    NUM_ARGS == X.numArguments());
+            ASSERTV(LINE, numSegments, X.numSegments(),
+                    numSegments == X.numSegments());
+            ASSERTV(LINE, X.numSegments() == Y.numSegments());
+
+            for (int i = 0; i < numSegments && i < X.numSegments(); ++i) {
+                const Obj::Segment& S = X.segment(i);
+
+                bsl::string description(FORMAT + S.d_literalOffset,
+                                        S.d_literalLength);
+                description += '|';
+                if (0 <= S.d_argId) {
+                    description += static_cast<char>('0' + S.d_argId);
+                }
+                description += '|';
+                description.append(FORMAT + S.d_specOffset, S.d_specLength);
+
+                ASSERTV(LINE, i, SEGMENTS[i], description.c_str(),
+                        SEGMENTS[i] == description);
+
+                const Obj::Segment& T = Y.segment(i);
+                ASSERTV(LINE, i, S.d_literalOffset == T.d_literalOffset);
+                ASSERTV(LINE, i, S.d_literalLength == T.d_literalLength);
+                ASSERTV(LINE, i, S.d_specOffset    == T.d_specOffset);
+                ASSERTV(LINE, i, S.d_specLength    == T.d_specLength);
+                ASSERTV(LINE, i, S.d_argId         == T.d_argId);
+            }
+        }
+
+        if (verbose) printf("\tCapacity of the segment array.\n");
+        {
+            bsl::string format;
+            for (int i = 0; i < Obj::k_MAX_NUM_SEGMENTS; ++i) {
+                format += "x{}";
+            }
+
+            const Obj X(format);
+            ASSERT(X.isPrepared());
+            ASSERT(Obj::k_MAX_NUM_SEGMENTS == X.numSegments());
+            ASSERT(Obj::k_MAX_NUM_SEGMENTS == X.numArguments());
+
+            format += "y";
+
+            const Obj Y(format);
+            ASSERT(!Y.isPrepared());
+            ASSERT(0 == Y.numSegments());
+            ASSERT(0 == Y.numArguments());
+
+            const Obj Z(bsl::string(Obj::k_MAX_FORMAT_LENGTH + 1, 'z'));
+            ASSERT(!Z.isPrepared());
+        }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        if (verbose) printf("\tInvalid format strings.\n");
+        {
+            static const char *const INVALID[] = {
+                "{",
+                "}",
+                "a{",
+                "a}b",
+                "{0",
+                "{:",
+                "{0x}",
+                "{0}{}",
+                "{}{0}",
+                "{99999}",
+                "{:{}",
+            };
+            const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+            for (int ti = 0; ti < NUM_INVALID; ++ti) {
+                const char *FORMAT = INVALID[ti];
+
+                bool caught = false;
+                try {
+                    const Obj X(FORMAT);
+                }
+                catch (const bsl::format_error&) {
+                    caught = true;
+                }
+                ASSERTV(FORMAT, caught);
+            }
+        }
+#endif
+
+        if (verbose) printf("\tConstant expressions.\n");
+        {
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14)
+            static constexpr Obj X("abc {} def {:>4}");
+
+            static_assert(X.isPrepared(),                           "");
+            static_assert(2 == X.numArguments(),                    "");
+            static_assert(2 == X.numSegments(),                     "");
+            static_assert(4 == X.segment(0).d_literalLength,        "");
+            static_assert(3 == X.segment(1).d_specLength,           "");
+            static_assert(16 == X.formatString().length(),          "");
+
+            ASSERT(X.isPrepared());
+#endif
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Prepare a format and render it with a few arguments.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const Obj X("value {} of {:>5} is {:.1f}");
+        ASSERT(X.isPrepared());
+        ASSERT(3 == X.numArguments());
+        ASSERT(3 == X.numSegments());
+
+        char         buffer[64];
+        const size_t length = Util::formatToBuffer(buffer,
+                                                   sizeof buffer,
+                                                   X,
+                                                   1,
+                                                   "pi",
+                                                   3.14159);
+
+        ASSERT(bsl::string_view(buffer, length) == "value 1 of    pi is 3.1");
+
+        bsl::string result;
+        Util::formatTo(bsl::back_inserter(result), X, 2, "e", 2.71828);
+        ASSERT("value 2 of     e is 2.7" == result);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TYPICAL LOG LINES
+        //
+        // Concerns:
+        // 1. Rendering a prepared format is faster than `bsl::format_to` and
+        //    comparable to `snprintf` for typical log messages.
+        //
+        // Plan:
+        // 1. For a few typical log messages, time rendering into a buffer
+        //    with `snprintf`, with `bsl::format_to_n`, and with
+        //    `PreparedFormatUtil::formatToBuffer`.  The number of iterations
+        //    (in thousands) may be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: TYPICAL LOG LINES
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: TYPICAL LOG LINES"
+               "\n==============================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) * 1000 : 1000000;
+
+        char   buffer[256];
+        size_t total = 0;
+
+        const int         orderId  = 123456;
+        const char *const symbol   = "IBM";
+        const int         quantity = 250;
+        const double      price    = 147.625;
+        const long long   elapsed  = 48213;
+        const char *const user     = "jsmith";
+
+        bsls::Stopwatch timer;
+
+#define TIME_LOOP(NAME, STATEMENT)                                            \
+        timer.reset();                                                        \
+        timer.start();                                                        \
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {                            \
+            STATEMENT;                                                        \
+        }                                                                     \
+        timer.stop();                                                         \
+        printf("  %-28s %8.1f ns/op\n",                                       \
+               NAME,                                                          \
+               timer.elapsedTime() * 1.0e9 / NUM_ITERATIONS)
+
+        printf("\"order {} for {}: {} @ {:.2f}\"\n");
+        {
+            static const Obj FORMAT("order {} for {}: {} @ {:.2f}");
+
+            TIME_LOOP("snprintf",
+                      total += snprintf(buffer,
+                                        sizeof buffer,
+                                        "order %d for %s: %d @ %.2f",
+                                        orderId + i,
+                                        symbol,
+                                        quantity,
+                                        price));
+            TIME_LOOP("bsl::format_to_n",
+                      total += bsl::format_to_n(buffer,
+                                                sizeof buffer,
+                                                "order {} for {}: {} @ {:.2f}",
+                                                orderId + i,
+                                                symbol,
+                                                quantity,
+                                                price).size);
+            TIME_LOOP("formatToBuffer",
+                      total += Util::formatToBuffer(buffer,
+                                                    sizeof buffer,
+                                                    FORMAT,
+                                                    orderId + i,
+                                                    symbol,
+                                                    quantity,
+                                                    price));
+        }
+
+        printf("\"user {} completed request {} in {} us\"\n");
+        {
+            static const Obj FORMAT("user {} completed request {} in {} us");
+
+            TIME_LOOP("snprintf",
+                      total += snprintf(buffer,
+                                        sizeof buffer,
+                                        "user %s completed request %d in "
+                                        "%lld us",
+                                        user,
+                                        orderId + i,
+                                        elapsed));
+            TIME_LOOP("bsl::format_to_n",
+                      total += bsl::format_to_n(
+                                       buffer,
+                                       sizeof buffer,
+                                       "user {} completed request {} in {} us",
+                                       user,
+                                       orderId + i,
+                                       elapsed).size);
+            TIME_LOOP("formatToBuffer",
+                      total += Util::formatToBuffer(buffer,
+                                                    sizeof buffer,
+                                                    FORMAT,
+                                                    user,
+                                                    orderId + i,
+                                                    elapsed));
+        }
+
+        printf("\"[{:>8}] {:<10} retry {}/{} after {:.3f}s\"\n");
+        {
+            static const Obj FORMAT(
+                                 "[{:>8}] {:<10} retry {}/{} after {:.3f}s");
+
+            TIME_LOOP("snprintf",
+                      total += snprintf(buffer,
+                                        sizeof buffer,
+                                        "[%8d] %-10s retry %d/%d after %.3fs",
+                                        orderId + i,
+                                        user,
+                                        3,
+                                        5,
+                                        0.25));
+            TIME_LOOP("bsl::format_to_n",
+                      total += bsl::format_to_n(
+                                    buffer,
+                                    sizeof buffer,
+                                    "[{:>8}] {:<10} retry {}/{} after {:.3f}s",
+                                    orderId + i,
+                                    user,
+                                    3,
+                                    5,
+                                    0.25).size);
+            TIME_LOOP("formatToBuffer",
+                      total += Util::formatToBuffer(buffer,
+                                                    sizeof buffer,
+                                                    FORMAT,
+                                                    orderId + i,
+                                                    user,
+                                                    3,
+                                                    5,
+                                                    0.25));
+        }
+
+#undef TIME_LOOP
+
+        if (veryVerbose) {
+            P(total);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,96 @@
+// bslmt_adaptivemutex.cpp                                            -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_adaptivemutex_cpp,"$Id$ $CSID$")
+
+#include <bslmt_contentionutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+/// Hint to the processor that the calling thread is in a spin-wait loop.
+inline
+void pause()
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    _mm_pause();
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bslmt {
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void AdaptiveMutex::lockContended()
+{
+    const bool               profile = 0 != ContentionUtil::waitCallback();
+    const bsls::Types::Int64 start   = profile ? bsls::TimeUtil::getTimer()
+                                               : 0;
+
+    const int estimate = d_spinEstimate.loadRelaxed();
+    const int maxSpins = 2 * estimate + 10 < k_MAX_SPIN_COUNT
+                       ? 2 * estimate + 10
+                       : k_MAX_SPIN_COUNT;
+
+    int  spins    = 0;
+    bool acquired = false;
+    while (!acquired && spins < maxSpins) {
+        ++spins;
+        u::pause();
+        acquired = 0 == d_mutex.tryLock();
+    }
+
+    int target = spins;
+    if (!acquired) {
+        // Spinning did not pay off: block, and steer the estimate toward not
+        // spinning.
+
+        d_mutex.lock();
+        target = 0;
+    }
+
+    // The estimate is updated while holding the lock, so the updates are
+    // serialized.
+
+    d_spinEstimate.storeRelaxed(estimate + (target - estimate) / 8);
+
+    if (profile) {
+        ContentionUtil::reportWait(this,
+                                   bsls::TimeUtil::getTimer() - start);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,232 @@
+// bslmt_adaptivemutex.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLMT_ADAPTIVEMUTEX
+#define INCLUDED_BSLMT_ADAPTIVEMUTEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mutex that spins adaptively before blocking.
+//
+//@CLASSES:
+//  bslmt::AdaptiveMutex: spin-then-block mutex with contention reporting
+//
+//@SEE_ALSO: bslmt_mutex, bslmt_contentionutil,
+//           bslmt_adaptivereaderwritermutex
+//
+//@DESCRIPTION: This component provides a mutually exclusive lock,
+// `bslmt::AdaptiveMutex`, having the same interface as `bslmt::Mutex`.  When
+// the mutex is held by another thread, `lock` first *spins*, repeatedly
+// attempting to acquire the mutex for a bounded number of iterations, and only
+// then *blocks* (parks the thread in the operating system) until the mutex is
+// released.  For critical sections that are short compared to the cost of a
+// context switch, most contended acquisitions then complete without a system
+// call.
+//
+///Adaptive Spinning
+///-----------------
+// Each mutex maintains an estimate of the number of spin iterations after
+// which a contended `lock` succeeds.  A contended `lock` spins for at most
+// `2 * spinEstimate() + 10` iterations (and never more than
+// `k_MAX_SPIN_COUNT`).  When spinning succeeds, the estimate moves one eighth
+// of the way toward the number of iterations used; when spinning fails, and
+// the thread blocks, the estimate moves one eighth of the way toward zero.  A
+// mutex protecting short critical sections therefore spins long enough to
+// avoid blocking, while a mutex held for long periods quickly stops wasting
+// CPU time on spinning.
+//
+///Contention Profiling
+///--------------------
+// If a wait callback is installed with `bslmt::ContentionUtil`, a contended
+// `lock` measures the time from its call until the mutex is acquired, and
+// reports it with `bslmt::ContentionUtil::reportWait`, supplying the address
+// of the mutex.  Uncontended acquisitions are never timed.  See
+// `balb_contentionprofiler` for a profiler that records the call sites of
+// acquisitions that waited longer than a threshold.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Short Critical Section
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// `bslmt::AdaptiveMutex` is a drop-in replacement for `bslmt::Mutex` where the
+// critical section is short.  In this example, a number of threads increment
+// a shared counter.
+//
+// First, we define the shared state and the thread function:
+// ```
+// bslmt::AdaptiveMutex mutex;
+// int                  counter = 0;
+//
+// extern "C" void *incrementCounter(void *)
+// {
+//     for (int i = 0; i < 10000; ++i) {
+//         bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&mutex);
+//         ++counter;
+//     }
+//     return 0;
+// }
+// ```
+// Then, we run the function in four threads:
+// ```
+// bslmt::ThreadUtil::Handle handles[4];
+// for (int i = 0; i < 4; ++i) {
+//     bslmt::ThreadUtil::create(&handles[i], &incrementCounter, 0);
+// }
+// for (int i = 0; i < 4; ++i) {
+//     bslmt::ThreadUtil::join(handles[i]);
+// }
+// ```
+// Finally, we observe that every increment took place:
+// ```
+// assert(40000 == counter);
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                            // ===================
+                            // class AdaptiveMutex
+                            // ===================
+
+/// This class implements a mutex that, when contended, spins for an
+/// adaptively chosen number of iterations before blocking.  See
+/// {Description}.
+class AdaptiveMutex {
+
+    // DATA
+    Mutex           d_mutex;         // underlying, blocking mutex
+
+    bsls::AtomicInt d_spinEstimate;  // smoothed number of spin iterations
+                                     // after which a contended `lock`
+                                     // succeeds
+
+    // NOT IMPLEMENTED
+    AdaptiveMutex(const AdaptiveMutex&);
+    AdaptiveMutex& operator=(const AdaptiveMutex&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Acquire the lock on this mutex, which the calling thread failed to
+    /// acquire immediately, spinning and then blocking as described in
+    /// {Adaptive Spinning}.
+    void lockContended();
+
+  public:
+    // TYPES
+    enum {
+        k_MAX_SPIN_COUNT = 100  // upper bound on spin iterations per `lock`
+    };
+
+    // CREATORS
+
+    /// Create an adaptive mutex in the unlocked state.
+    AdaptiveMutex();
+
+    /// Destroy this adaptive mutex.  The behavior is undefined if the mutex
+    /// is in a locked state.
+    ~AdaptiveMutex();
+
+    // MANIPULATORS
+
+    /// Acquire a lock on this mutex.  If this mutex is currently locked by
+    /// another thread, spin and then suspend execution of the current
+    /// thread until a lock can be acquired.  The behavior is undefined if
+    /// the calling thread already owns the lock on this mutex, and may
+    /// result in deadlock.
+    void lock();
+
+    /// Attempt to acquire a lock on this mutex.  Return 0 on success, and a
+    /// non-zero value if this mutex is already locked, or if an error
+    /// occurs.  The behavior is undefined if the calling thread already
+    /// owns the lock on this mutex, and may result in deadlock.
+    int tryLock();
+
+    /// Release a lock on this mutex that was previously acquired through a
+    /// call to `lock`, or a successful call to `tryLock`.  The behavior is
+    /// undefined, unless the calling thread currently owns the lock on this
+    /// mutex.
+    void unlock();
+
+    // ACCESSORS
+
+    /// Return the current estimate of the number of spin iterations after
+    /// which a contended `lock` on this mutex succeeds.  Note that the
+    /// returned value is in the range `[0 .. k_MAX_SPIN_COUNT]`.
+    int spinEstimate() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// CREATORS
+inline
+AdaptiveMutex::AdaptiveMutex()
+: d_spinEstimate(0)
+{
+}
+
+inline
+AdaptiveMutex::~AdaptiveMutex()
+{
+}
+
+// MANIPULATORS
+inline
+void AdaptiveMutex::lock()
+{
+    if (0 != d_mutex.tryLock()) {
+        lockContended();
+    }
+}
+
+inline
+int AdaptiveMutex::tryLock()
+{
+    return d_mutex.tryLock();
+}
+
+inline
+void AdaptiveMutex::unlock()
+{
+    d_mutex.unlock();
+}
+
+// ACCESSORS
+inline
+int AdaptiveMutex::spinEstimate() const
+{
+    return d_spinEstimate.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
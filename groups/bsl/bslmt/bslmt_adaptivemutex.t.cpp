@@ -0,0 +1,583 @@
+// bslmt_adaptivemutex.t.cpp                                          -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_contentionutil.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// `bslmt::AdaptiveMutex` forwards to a `bslmt::Mutex`, except for `lock`
+// when the mutex is held, which spins and then blocks.  We verify mutual
+// exclusion with `tryLock` and with concurrent incrementing threads, that the
+// spin estimate remains in its documented range, and that contended
+// acquisitions are reported to `bslmt::ContentionUtil` when, and only when, a
+// wait callback is installed.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] AdaptiveMutex();
+// [ 1] ~AdaptiveMutex();
+//
+// MANIPULATORS
+// [ 2] void lock();
+// [ 2] int tryLock();
+// [ 2] void unlock();
+//
+// ACCESSORS
+// [ 3] int spinEstimate() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: concurrent `lock` calls are mutually exclusive
+// [ 4] CONCERN: contended acquisitions are reported
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::AdaptiveMutex Obj;
+
+// ============================================================================
+//                   GLOBAL STRUCTS AND METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace MUTUAL_EXCLUSION_TEST {
+
+enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 20000 };
+
+struct Data {
+    Obj             d_mutex;
+    bslmt::Barrier  d_barrier;
+    int             d_counter;     // protected by `d_mutex`
+    bsls::AtomicInt d_inside;      // number of threads in the critical
+                                   // section
+    bsls::AtomicInt d_maxInside;   // largest value of `d_inside` observed
+
+    Data() : d_barrier(k_NUM_THREADS), d_counter(0) {}
+};
+
+/// Repeatedly lock the mutex of the specified `arg` `Data`, and increment its
+/// counter, recording the number of threads inside the critical section.
+extern "C" void *increment(void *arg)
+{
+    Data *data = static_cast<Data *>(arg);
+
+    data->d_barrier.wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        data->d_mutex.lock();
+
+        const int inside = ++data->d_inside;
+        if (inside > data->d_maxInside) {
+            data->d_maxInside = inside;
+        }
+        ++data->d_counter;
+        --data->d_inside;
+
+        data->d_mutex.unlock();
+    }
+
+    return 0;
+}
+
+}  // close namespace MUTUAL_EXCLUSION_TEST
+
+namespace CONTENTION_TEST {
+
+bsls::AtomicInt     s_numReports(0);
+const void         *s_lastLock = 0;
+bsls::AtomicInt64   s_lastWaitTime(-1);
+
+/// Record the specified `lock` and `waitTime`.
+void recordWait(const void *lock, bsls::Types::Int64 waitTime)
+{
+    s_lastLock     = lock;
+    s_lastWaitTime = waitTime;
+    ++s_numReports;
+}
+
+struct Data {
+    Obj            d_mutex;
+    bslmt::Barrier d_barrier;
+
+    Data() : d_barrier(2) {}
+};
+
+/// Wait on the barrier of the specified `arg` `Data`, then lock and unlock
+/// its mutex.
+extern "C" void *lockAfterBarrier(void *arg)
+{
+    Data *data = static_cast<Data *>(arg);
+
+    data->d_barrier.wait();
+    data->d_mutex.lock();
+    data->d_mutex.unlock();
+
+    return 0;
+}
+
+/// Hold the mutex of the specified `data` for the specified `holdTime`
+/// microseconds while another thread calls `lock` on it.
+void contend(Data *data, int holdTime)
+{
+    bslmt::ThreadUtil::Handle handle;
+
+    data->d_mutex.lock();
+
+    ASSERT(0 == bslmt::ThreadUtil::create(&handle, &lockAfterBarrier, data));
+
+    data->d_barrier.wait();
+    bslmt::ThreadUtil::microSleep(holdTime);
+    data->d_mutex.unlock();
+
+    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+}
+
+}  // close namespace CONTENTION_TEST
+
+namespace TRY_LOCK_TEST {
+
+/// Return the result of `tryLock` on the specified `arg` `Obj`, releasing
+/// the lock if it was acquired.
+extern "C" void *tryLockOnce(void *arg)
+{
+    Obj *mutex = static_cast<Obj *>(arg);
+
+    const int rc = mutex->tryLock();
+    if (0 == rc) {
+        mutex->unlock();
+    }
+
+    return reinterpret_cast<void *>(static_cast<bsls::Types::IntPtr>(rc));
+}
+
+/// Return the result of `tryLock`, called in a separate thread, on the
+/// specified `mutex`.
+int tryLockInOtherThread(Obj *mutex)
+{
+    bslmt::ThreadUtil::Handle  handle;
+    void                      *result = 0;
+
+    ASSERT(0 == bslmt::ThreadUtil::create(&handle, &tryLockOnce, mutex));
+    ASSERT(0 == bslmt::ThreadUtil::join(handle, &result));
+
+    return static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(result));
+}
+
+}  // close namespace TRY_LOCK_TEST
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Short Critical Section
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// `bslmt::AdaptiveMutex` is a drop-in replacement for `bslmt::Mutex` where the
+// critical section is short.  In this example, a number of threads increment
+// a shared counter.
+//
+// First, we define the shared state and the thread function:
+// ```
+    bslmt::AdaptiveMutex mutex;
+    int                  counter = 0;
+
+    extern "C" void *incrementCounter(void *)
+    {
+        for (int i = 0; i < 10000; ++i) {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&mutex);
+            ++counter;
+        }
+        return 0;
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we run the function in four threads:
+// ```
+    bslmt::ThreadUtil::Handle handles[4];
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], &incrementCounter, 0);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+// ```
+// Finally, we observe that every increment took place:
+// ```
+    ASSERT(40000 == counter);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONTENTION REPORTING
+        //
+        // Concerns:
+        // 1. A contended `lock` reports its wait, with the address of the
+        //    mutex, when a wait callback is installed.
+        //
+        // 2. The reported wait covers the time the lock was held by another
+        //    thread.
+        //
+        // 3. Nothing is reported when no callback is installed, or when the
+        //    wait is below the threshold.
+        //
+        // 4. Uncontended acquisitions are not reported.
+        //
+        // Plan:
+        // 1. With a callback installed, hold the mutex for 100ms while
+        //    another thread locks it, and verify the report.  (C-1..2)
+        //
+        // 2. Repeat with no callback installed, and with a threshold of 10s,
+        //    and verify that nothing is reported.  (C-3)
+        //
+        // 3. Lock and unlock an uncontended mutex with a callback installed
+        //    and verify that nothing is reported.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: contended acquisitions are reported
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONTENTION REPORTING" << endl
+                          << "====================" << endl;
+
+        using namespace CONTENTION_TEST;
+
+        const int                HOLD_TIME = 100 * 1000;  // microseconds
+        const bsls::Types::Int64 SECOND    = 1000LL * 1000 * 1000;
+
+        if (verbose) cout << "\nReporting a contended acquisition." << endl;
+        {
+            Data data;
+
+            bslmt::ContentionUtil::setWaitCallback(&recordWait, 0);
+
+            contend(&data, HOLD_TIME);
+
+            bslmt::ContentionUtil::setWaitCallback(0, 0);
+
+            if (veryVerbose) { P_(s_numReports) P(s_lastWaitTime) }
+
+            ASSERTV(s_numReports, 1 == s_numReports);
+            ASSERT(&data.d_mutex == s_lastLock);
+
+            // Allow for coarse sleep and timer granularity.
+
+            ASSERTV(s_lastWaitTime, HOLD_TIME / 2 * 1000LL < s_lastWaitTime);
+            ASSERTV(s_lastWaitTime, 10 * SECOND > s_lastWaitTime);
+        }
+
+        if (verbose) cout << "\nNo callback installed." << endl;
+        {
+            Data data;
+
+            s_numReports = 0;
+
+            contend(&data, HOLD_TIME);
+
+            ASSERTV(s_numReports, 0 == s_numReports);
+        }
+
+        if (verbose) cout << "\nWait below the threshold." << endl;
+        {
+            Data data;
+
+            s_numReports = 0;
+
+            bslmt::ContentionUtil::setWaitCallback(&recordWait, 10 * SECOND);
+
+            contend(&data, HOLD_TIME);
+
+            bslmt::ContentionUtil::setWaitCallback(0, 0);
+
+            ASSERTV(s_numReports, 0 == s_numReports);
+        }
+
+        if (verbose) cout << "\nUncontended acquisitions." << endl;
+        {
+            Obj mX;
+
+            s_numReports = 0;
+
+            bslmt::ContentionUtil::setWaitCallback(&recordWait, 0);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.lock();
+                mX.unlock();
+            }
+
+            bslmt::ContentionUtil::setWaitCallback(0, 0);
+
+            ASSERTV(s_numReports, 0 == s_numReports);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MUTUAL EXCLUSION
+        //
+        // Concerns:
+        // 1. Concurrent calls to `lock` are mutually exclusive, whether the
+        //    mutex is acquired by spinning or by blocking.
+        //
+        // 2. `spinEstimate` remains in the range `[0 .. k_MAX_SPIN_COUNT]`.
+        //
+        // Plan:
+        // 1. Have several threads increment a counter under the mutex, while
+        //    tracking the number of threads in the critical section, and
+        //    verify the final count and that at most one thread was ever in
+        //    the critical section.  (C-1)
+        //
+        // 2. Verify the range of `spinEstimate` afterwards.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: concurrent `lock` calls are mutually exclusive
+        //   int spinEstimate() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MUTUAL EXCLUSION" << endl
+                          << "================" << endl;
+
+        using namespace MUTUAL_EXCLUSION_TEST;
+
+        Data data;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &increment,
+                                                  &data));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        if (veryVerbose) {
+            P_(data.d_counter) P_(data.d_maxInside)
+            P(data.d_mutex.spinEstimate())
+        }
+
+        ASSERTV(data.d_counter,
+                k_NUM_THREADS * k_NUM_ITERATIONS == data.d_counter);
+        ASSERTV(data.d_maxInside, 1 == data.d_maxInside);
+
+        const int ESTIMATE = data.d_mutex.spinEstimate();
+        ASSERTV(ESTIMATE, 0 <= ESTIMATE);
+        ASSERTV(ESTIMATE, Obj::k_MAX_SPIN_COUNT >= ESTIMATE);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        // 1. `tryLock` succeeds on an unlocked mutex and fails, without
+        //    blocking, on a mutex locked by another thread.
+        //
+        // 2. `lock` acquires an unlocked mutex, and `unlock` releases it.
+        //
+        // 3. A `lock` on a mutex held by another thread returns once the
+        //    mutex is released, both after a short and a long hold.
+        //
+        // Plan:
+        // 1. Lock the mutex with `lock` and with `tryLock`, and verify with
+        //    `tryLock` from another thread that the mutex is held, and that
+        //    it is free after `unlock`.  (C-1..2)
+        //
+        // 2. Hold the mutex briefly, and for 50ms, while another thread calls
+        //    `lock`, and verify that the other thread completes.  (C-3)
+        //
+        // Testing:
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        using namespace TRY_LOCK_TEST;
+
+        Obj mX;
+
+        if (verbose) cout << "\nTesting `lock` and `unlock`." << endl;
+
+        mX.lock();
+        ASSERT(0 != tryLockInOtherThread(&mX));
+        mX.unlock();
+        ASSERT(0 == tryLockInOtherThread(&mX));
+
+        if (verbose) cout << "\nTesting `tryLock`." << endl;
+
+        ASSERT(0 == mX.tryLock());
+        ASSERT(0 != tryLockInOtherThread(&mX));
+        mX.unlock();
+        ASSERT(0 == tryLockInOtherThread(&mX));
+
+        if (verbose) cout << "\nTesting contended `lock`." << endl;
+        {
+            CONTENTION_TEST::Data data;
+
+            CONTENTION_TEST::contend(&data, 0);
+            CONTENTION_TEST::contend(&data, 50 * 1000);
+
+            ASSERT(0 == tryLockInOtherThread(&data.d_mutex));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create an object, and lock and unlock it with `lock` and
+        //    `tryLock`.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   AdaptiveMutex();
+        //   ~AdaptiveMutex();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == X.spinEstimate());
+
+        mX.lock();
+        mX.unlock();
+
+        ASSERT(0 == mX.tryLock());
+        mX.unlock();
+
+        ASSERT(0 == X.spinEstimate());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
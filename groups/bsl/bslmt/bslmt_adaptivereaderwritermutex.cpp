@@ -0,0 +1,26 @@
+// bslmt_adaptivereaderwritermutex.cpp                                -*-C++-*-
+#include <bslmt_adaptivereaderwritermutex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_adaptivereaderwritermutex_cpp,"$Id$ $CSID$")
+
+#include <bslmt_readlockguard.h>   // for testing only
+#include <bslmt_semaphore.h>       // for testing only
+#include <bslmt_threadutil.h>      // for testing only
+#include <bslmt_writelockguard.h>  // for testing only
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,263 @@
+// bslmt_adaptivereaderwritermutex.h                                  -*-C++-*-
+#ifndef INCLUDED_BSLMT_ADAPTIVEREADERWRITERMUTEX
+#define INCLUDED_BSLMT_ADAPTIVEREADERWRITERMUTEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multi-reader/single-writer lock that spins adaptively.
+//
+//@CLASSES:
+//   bslmt::AdaptiveReaderWriterMutex: reader-writer lock with spinning mutex
+//
+//@SEE_ALSO: bslmt_readerwritermutex, bslmt_adaptivemutex,
+//           bslmt_contentionutil
+//
+//@DESCRIPTION: This component defines a multi-reader/single-writer lock
+// mechanism, `bslmt::AdaptiveReaderWriterMutex`, having the same interface and
+// semantics as `bslmt::ReaderWriterMutex`.  The two differ only in the mutex
+// on which a thread blocks when it cannot acquire the lock immediately (a
+// reader in the presence of an active or pending writer, or a writer in the
+// presence of another writer): `bslmt::AdaptiveReaderWriterMutex` uses a
+// `bslmt::AdaptiveMutex`, which spins adaptively before blocking, where
+// `bslmt::ReaderWriterMutex` uses a `bslmt::Mutex`.  This benefits locks whose
+// write critical sections are short.
+//
+// A writer that has acquired the internal mutex, but must wait for active
+// readers to release the lock, blocks without spinning, as it does with
+// `bslmt::ReaderWriterMutex`.
+//
+///Contention Profiling
+///--------------------
+// Waits on the internal `bslmt::AdaptiveMutex` are reported to
+// `bslmt::ContentionUtil` as described in `bslmt_adaptivemutex`.  Note that
+// the lock address supplied with such a report is that of the internal mutex,
+// not of the `bslmt::AdaptiveReaderWriterMutex` object; the call site of the
+// acquisition identifies the contended lock.  The wait of a writer for active
+// readers is not reported.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Frequently Read Configuration
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service reads a configuration value on every request, and updates
+// it rarely:
+// ```
+// bslmt::AdaptiveReaderWriterMutex mutex;
+// int                              timeout = 10;
+// ```
+// Readers acquire the lock for reading:
+// ```
+// {
+//     bslmt::ReadLockGuard<bslmt::AdaptiveReaderWriterMutex> guard(&mutex);
+//     assert(10 == timeout);
+// }
+// ```
+// A writer acquires the lock for writing:
+// ```
+// {
+//     bslmt::WriteLockGuard<bslmt::AdaptiveReaderWriterMutex> guard(&mutex);
+//     timeout = 20;
+// }
+// assert(!mutex.isLocked());
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslmt_adaptivemutex.h>
+#include <bslmt_readerwritermuteximpl.h>
+#include <bslmt_semaphore.h>
+
+#include <bsls_atomicoperations.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                     // ===============================
+                     // class AdaptiveReaderWriterMutex
+                     // ===============================
+
+/// This class provides a multi-reader/single-writer lock mechanism whose
+/// internal mutex spins adaptively before blocking.
+class AdaptiveReaderWriterMutex {
+
+    // DATA
+    ReaderWriterMutexImpl<bsls::AtomicOperations, AdaptiveMutex, Semaphore>
+                                                                   d_impl;
+
+  private:
+    // NOT IMPLEMENTED
+    AdaptiveReaderWriterMutex(const AdaptiveReaderWriterMutex&);
+    AdaptiveReaderWriterMutex& operator=(const AdaptiveReaderWriterMutex&);
+
+  public:
+    // CREATORS
+
+    /// Construct a reader/writer lock initialized to an unlocked state.
+    AdaptiveReaderWriterMutex();
+
+    /// Destroy this object
+    //! ~AdaptiveReaderWriterMutex();
+
+    // MANIPULATORS
+
+    /// Lock this reader-writer mutex for reading.  If there are no active
+    /// or pending write locks, lock this mutex for reading and return
+    /// immediately.  Otherwise, block until the read lock on this mutex is
+    /// acquired.  Use `unlockRead` or `unlock` to release the lock on this
+    /// mutex.  The behavior is undefined if this method is called from a
+    /// thread that already has a lock on this mutex.
+    void lockRead();
+
+    /// Lock this reader-writer mutex for writing.  If there are no active
+    /// or pending locks on this mutex, lock this mutex for writing and
+    /// return immediately.  Otherwise, block until the write lock on this
+    /// mutex is acquired.  Use `unlockWrite` or `unlock` to release the
+    /// lock on this mutex.  The behavior is undefined if this method is
+    /// called from a thread that already has a lock on this mutex.
+    void lockWrite();
+
+    /// Attempt to lock this reader-writer mutex for reading.  Immediately
+    /// return 0 on success, and a non-zero value if there are active or
+    /// pending writers.  If successful, `unlockRead` or `unlock` must be
+    /// used to release the lock on this mutex.  The behavior is undefined
+    /// if this method is called from a thread that already has a lock on
+    /// this mutex.
+    int tryLockRead();
+
+    /// Attempt to lock this reader-writer mutex for writing.  Immediately
+    /// return 0 on success, and a non-zero value if there are active or
+    /// pending locks on this mutex.  If successful, `unlockWrite` or
+    /// `unlock` must be used to release the lock on this mutex.  The
+    /// behavior is undefined if this method is called from a thread that
+    /// already has a lock on this mutex.
+    int tryLockWrite();
+
+    /// Release the lock that the calling thread holds on this reader-writer
+    /// mutex.  The behavior is undefined unless the calling thread
+    /// currently has a lock on this mutex.
+    void unlock();
+
+    /// Release the read lock that the calling thread holds on this
+    /// reader-writer mutex.  The behavior is undefined unless the calling
+    /// thread currently has a read lock on this mutex.
+    void unlockRead();
+
+    /// Release the write lock that the calling thread holds on this
+    /// reader-writer mutex.  The behavior is undefined unless the calling
+    /// thread currently has a write lock on this mutex.
+    void unlockWrite();
+
+    // ACCESSORS
+
+    /// Return `true` if this reader-write mutex is currently read locked or
+    /// write locked, and `false` otherwise.
+    bool isLocked() const;
+
+    /// Return `true` if this reader-write mutex is currently read locked,
+    /// and `false` otherwise.
+    bool isLockedRead() const;
+
+    /// Return `true` if this reader-write mutex is currently write locked,
+    /// and `false` otherwise.
+    bool isLockedWrite() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class AdaptiveReaderWriterMutex
+                     // -------------------------------
+
+// CREATORS
+inline
+AdaptiveReaderWriterMutex::AdaptiveReaderWriterMutex()
+{
+}
+
+// MANIPULATORS
+inline
+void AdaptiveReaderWriterMutex::lockRead()
+{
+    d_impl.lockRead();
+}
+
+inline
+void AdaptiveReaderWriterMutex::lockWrite()
+{
+    d_impl.lockWrite();
+}
+
+inline
+int AdaptiveReaderWriterMutex::tryLockRead()
+{
+    return d_impl.tryLockRead();
+}
+
+inline
+int AdaptiveReaderWriterMutex::tryLockWrite()
+{
+    return d_impl.tryLockWrite();
+}
+
+inline
+void AdaptiveReaderWriterMutex::unlock()
+{
+    d_impl.unlock();
+}
+
+inline
+void AdaptiveReaderWriterMutex::unlockRead()
+{
+    d_impl.unlockRead();
+}
+
+inline
+void AdaptiveReaderWriterMutex::unlockWrite()
+{
+    d_impl.unlockWrite();
+}
+
+// ACCESSORS
+inline
+bool AdaptiveReaderWriterMutex::isLocked() const
+{
+    return d_impl.isLocked();
+}
+
+inline
+bool AdaptiveReaderWriterMutex::isLockedRead() const
+{
+    return d_impl.isLockedRead();
+}
+
+inline
+bool AdaptiveReaderWriterMutex::isLockedWrite() const
+{
+    return d_impl.isLockedWrite();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,80 @@
+// bslmt_contentionutil.cpp                                           -*-C++-*-
+#include <bslmt_contentionutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_contentionutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_pointercastutil.h>
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Pointer g_waitCallback = { 0 };
+bsls::AtomicOperations::AtomicTypes::Int64   g_waitThreshold = { 0 };
+
+}  // close unnamed namespace
+
+namespace bslmt {
+
+                            // ---------------------
+                            // struct ContentionUtil
+                            // ---------------------
+
+// CLASS METHODS
+void ContentionUtil::reportWait(const void *lock, bsls::Types::Int64 waitTime)
+{
+    const WaitCallback callback = waitCallback();
+
+    if (callback && waitThreshold() <= waitTime) {
+        callback(lock, waitTime);
+    }
+}
+
+void ContentionUtil::setWaitCallback(WaitCallback       callback,
+                                     bsls::Types::Int64 threshold)
+{
+    BSLS_ASSERT(0 <= threshold);
+
+    // Publish the threshold before the callback, so that a thread observing
+    // the new callback also observes its threshold.
+
+    bsls::AtomicOperations::setInt64Release(&g_waitThreshold, threshold);
+    bsls::AtomicOperations::setPtrRelease(
+                            &g_waitCallback,
+                            bsls::PointerCastUtil::cast<void *>(callback));
+}
+
+ContentionUtil::WaitCallback ContentionUtil::waitCallback()
+{
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CC01 // AIX only allows this cast as a C-Style cast
+    return (WaitCallback) bsls::AtomicOperations::getPtrAcquire(
+                                                    &g_waitCallback); // RETURN
+    // BDE_VERIFY pragma: pop
+}
+
+bsls::Types::Int64 ContentionUtil::waitThreshold()
+{
+    return bsls::AtomicOperations::getInt64Acquire(&g_waitThreshold);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
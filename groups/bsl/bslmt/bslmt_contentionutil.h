@@ -0,0 +1,144 @@
+// bslmt_contentionutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLMT_CONTENTIONUTIL
+#define INCLUDED_BSLMT_CONTENTIONUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a process-wide hook for reporting lock contention.
+//
+//@CLASSES:
+//  bslmt::ContentionUtil: namespace for installing and invoking a wait hook
+//
+//@SEE_ALSO: bslmt_adaptivemutex, bslmt_adaptivereaderwritermutex,
+//           balb_contentionprofiler
+//
+//@DESCRIPTION: This component provides a `struct`, `bslmt::ContentionUtil`,
+// that holds a single, process-wide *wait* *callback* and a *wait*
+// *threshold*.  Locks that support contention profiling (currently
+// `bslmt::AdaptiveMutex` and `bslmt::AdaptiveReaderWriterMutex`) measure the
+// time spent acquiring the lock whenever the lock cannot be acquired
+// immediately and a callback is installed, and report that time with
+// `reportWait`.  `reportWait` invokes the callback if the wait time is at
+// least the threshold.
+//
+// No callback is installed by default, in which case a contended lock
+// acquisition incurs only the cost of checking that no callback is installed,
+// and the uncontended path is unaffected.
+//
+// The callback is invoked by the thread that waited, after it has acquired the
+// lock, so a callback that captures the current stack identifies the call site
+// of the contended acquisition (see `balb_contentionprofiler`, which does
+// exactly that).  The callback must not acquire a lock that itself reports
+// contention, and should return promptly, since the lock is held while the
+// callback runs.
+//
+///Thread Safety
+///-------------
+// All methods of `bslmt::ContentionUtil` are thread-safe.  Note that a
+// callback that is being replaced may still be invoked by threads that loaded
+// it before the replacement; clients that release resources used by a
+// callback must account for this (as `balb::ContentionProfiler` does).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Contended Acquisitions
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to count the lock acquisitions that waited at least one
+// millisecond.
+//
+// First, we define a callback that increments a counter:
+// ```
+// bsls::AtomicInt numSlowAcquisitions(0);
+//
+// void countSlowAcquisition(const void *, bsls::Types::Int64)
+// {
+//     ++numSlowAcquisitions;
+// }
+// ```
+// Then, we install the callback with a threshold of one millisecond:
+// ```
+// bslmt::ContentionUtil::setWaitCallback(&countSlowAcquisition, 1000 * 1000);
+// ```
+// Now, a lock reporting a wait of two milliseconds invokes the callback, while
+// a lock reporting a shorter wait does not:
+// ```
+// int lock;
+// bslmt::ContentionUtil::reportWait(&lock, 2 * 1000 * 1000);
+// bslmt::ContentionUtil::reportWait(&lock, 1000);
+// assert(1 == numSlowAcquisitions);
+// ```
+// Finally, we uninstall the callback:
+// ```
+// bslmt::ContentionUtil::setWaitCallback(0, 0);
+// assert(0 == bslmt::ContentionUtil::waitCallback());
+// ```
+
+#include <bslscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                            // =====================
+                            // struct ContentionUtil
+                            // =====================
+
+/// This `struct` provides a namespace for installing, and invoking, the
+/// process-wide callback to which contended lock acquisitions are reported.
+struct ContentionUtil {
+
+    // TYPES
+
+    /// `WaitCallback` is an alias for a pointer to a function invoked with
+    /// the address of a lock and the time, in nanoseconds, that the calling
+    /// thread waited to acquire it.
+    typedef void (*WaitCallback)(const void         *lock,
+                                 bsls::Types::Int64  waitTime);
+
+    // CLASS METHODS
+
+    /// Invoke the installed wait callback, if any, with the specified `lock`
+    /// and `waitTime` (in nanoseconds) if `waitTime` is at least the
+    /// installed wait threshold.  Otherwise, this method has no effect.
+    static void reportWait(const void *lock, bsls::Types::Int64 waitTime);
+
+    /// Install the specified `callback` as the process-wide wait callback,
+    /// invoked for waits of at least the specified `threshold`
+    /// nanoseconds.  If `callback` is 0, uninstall the current callback,
+    /// if any.  The behavior is undefined unless `0 <= threshold`.
+    static void setWaitCallback(WaitCallback       callback,
+                                bsls::Types::Int64 threshold);
+
+    /// Return the installed wait callback, or 0 if no callback is
+    /// installed.  Note that locks use this method to decide whether to
+    /// measure the time spent waiting.
+    static WaitCallback waitCallback();
+
+    /// Return the installed wait threshold, in nanoseconds.
+    static bsls::Types::Int64 waitThreshold();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
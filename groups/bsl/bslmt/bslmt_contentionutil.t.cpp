@@ -0,0 +1,377 @@
+// bslmt_contentionutil.t.cpp                                         -*-C++-*-
+#include <bslmt_contentionutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// `bslmt::ContentionUtil` holds a process-wide callback and threshold.  We
+// verify the initial state, that `setWaitCallback` installs and uninstalls
+// the callback and threshold, and that `reportWait` invokes the callback
+// exactly when a callback is installed and the reported wait reaches the
+// threshold.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void reportWait(const void *lock, bsls::Types::Int64 waitTime);
+// [ 2] void setWaitCallback(WaitCallback callback, Int64 threshold);
+// [ 1] WaitCallback waitCallback();
+// [ 1] bsls::Types::Int64 waitThreshold();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::ContentionUtil Util;
+
+// ============================================================================
+//                   GLOBAL METHODS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int                 s_numCalls = 0;
+static const void         *s_lastLock = 0;
+static bsls::Types::Int64  s_lastWaitTime = -1;
+
+/// Record the specified `lock` and `waitTime`, and increment the number of
+/// calls.
+void recordWait(const void *lock, bsls::Types::Int64 waitTime)
+{
+    ++s_numCalls;
+    s_lastLock     = lock;
+    s_lastWaitTime = waitTime;
+}
+
+/// Increment the number of calls, ignoring the arguments.
+void countWait(const void *, bsls::Types::Int64)
+{
+    ++s_numCalls;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Contended Acquisitions
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to count the lock acquisitions that waited at least one
+// millisecond.
+//
+// First, we define a callback that increments a counter:
+// ```
+    bsls::AtomicInt numSlowAcquisitions(0);
+
+    void countSlowAcquisition(const void *, bsls::Types::Int64)
+    {
+        ++numSlowAcquisitions;
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    (void) veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we install the callback with a threshold of one millisecond:
+// ```
+    bslmt::ContentionUtil::setWaitCallback(&countSlowAcquisition, 1000 * 1000);
+// ```
+// Now, a lock reporting a wait of two milliseconds invokes the callback, while
+// a lock reporting a shorter wait does not:
+// ```
+    int lock;
+    bslmt::ContentionUtil::reportWait(&lock, 2 * 1000 * 1000);
+    bslmt::ContentionUtil::reportWait(&lock, 1000);
+    ASSERT(1 == numSlowAcquisitions);
+// ```
+// Finally, we uninstall the callback:
+// ```
+    bslmt::ContentionUtil::setWaitCallback(0, 0);
+    ASSERT(0 == bslmt::ContentionUtil::waitCallback());
+// ```
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `setWaitCallback` AND `reportWait`
+        //
+        // Concerns:
+        // 1. `setWaitCallback` installs the supplied callback and threshold,
+        //    and replaces any previously installed callback.
+        //
+        // 2. `reportWait` invokes the installed callback, with the supplied
+        //    lock and wait time, if and only if the wait time is at least the
+        //    threshold.
+        //
+        // 3. Installing a null callback uninstalls the callback, after which
+        //    `reportWait` has no effect.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Install a recording callback, report waits on either side of
+        //    the threshold, and verify the recorded calls.  (C-1..2)
+        //
+        // 2. Replace the callback and verify that only the new callback is
+        //    invoked.  (C-1)
+        //
+        // 3. Install a null callback and verify that `reportWait` has no
+        //    effect.  (C-3)
+        //
+        // 4. Verify that a negative threshold is detected.  (C-4)
+        //
+        // Testing:
+        //   void reportWait(const void *lock, bsls::Types::Int64 waitTime);
+        //   void setWaitCallback(WaitCallback callback, Int64 threshold);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `setWaitCallback` AND `reportWait`"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        int lockA;
+        int lockB;
+
+        if (verbose) cout << "\nInstalling a callback." << endl;
+
+        Util::setWaitCallback(&recordWait, 100);
+
+        ASSERT(&recordWait == Util::waitCallback());
+        ASSERT(100         == Util::waitThreshold());
+
+        static const struct {
+            int                 d_line;       // source line number
+            bsls::Types::Int64  d_waitTime;   // reported wait time
+            bool                d_expCalled;  // callback expected
+        } DATA[] = {
+            //LINE  WAIT TIME  CALLED
+            //----  ---------  ------
+            { L_,           0,  false },
+            { L_,          99,  false },
+            { L_,         100,  true  },
+            { L_,         101,  true  },
+            { L_,  1000000000,  true  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                LINE       = DATA[ti].d_line;
+            const bsls::Types::Int64 WAIT_TIME  = DATA[ti].d_waitTime;
+            const bool               EXP_CALLED = DATA[ti].d_expCalled;
+
+            if (veryVerbose) { T_ P_(LINE) P_(WAIT_TIME) P(EXP_CALLED) }
+
+            s_numCalls     = 0;
+            s_lastLock     = 0;
+            s_lastWaitTime = -1;
+
+            Util::reportWait(0 == ti % 2 ? &lockA : &lockB, WAIT_TIME);
+
+            ASSERTV(LINE, s_numCalls, (EXP_CALLED ? 1 : 0) == s_numCalls);
+            if (EXP_CALLED) {
+                ASSERTV(LINE, (0 == ti % 2 ? &lockA : &lockB) == s_lastLock);
+                ASSERTV(LINE, s_lastWaitTime, WAIT_TIME == s_lastWaitTime);
+            }
+        }
+
+        if (verbose) cout << "\nReplacing the callback." << endl;
+
+        Util::setWaitCallback(&countWait, 0);
+
+        ASSERT(&countWait == Util::waitCallback());
+        ASSERT(0          == Util::waitThreshold());
+
+        s_numCalls     = 0;
+        s_lastWaitTime = -1;
+
+        Util::reportWait(&lockA, 0);
+
+        ASSERT( 1 == s_numCalls);
+        ASSERT(-1 == s_lastWaitTime);
+
+        if (verbose) cout << "\nUninstalling the callback." << endl;
+
+        Util::setWaitCallback(0, 0);
+
+        ASSERT(0 == Util::waitCallback());
+
+        s_numCalls = 0;
+
+        Util::reportWait(&lockA, 1000000000);
+
+        ASSERT(0 == s_numCalls);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::setWaitCallback(&countWait,  0));
+            ASSERT_FAIL(Util::setWaitCallback(&countWait, -1));
+
+            Util::setWaitCallback(0, 0);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. No callback is installed initially, and the threshold is 0.
+        //
+        // 2. `reportWait` has no effect when no callback is installed.
+        //
+        // Plan:
+        // 1. Verify the initial state, and call `reportWait`.  (C-1..2)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   WaitCallback waitCallback();
+        //   bsls::Types::Int64 waitThreshold();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(0 == Util::waitCallback());
+        ASSERT(0 == Util::waitThreshold());
+
+        int lock;
+        Util::reportWait(&lock, 1000);
+
+        ASSERT(0 == s_numCalls);
+
+        Util::setWaitCallback(&countWait, 10);
+        Util::reportWait(&lock, 1000);
+        Util::setWaitCallback(0, 0);
+
+        ASSERT(1 == s_numCalls);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = "
+             << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
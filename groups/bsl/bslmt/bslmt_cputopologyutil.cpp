@@ -0,0 +1,336 @@
+// bslmt_cputopologyutil.cpp                                          -*-C++-*-
+#include <bslmt_cputopologyutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_cputopologyutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#else
+#include <unistd.h>        // sysconf
+#endif
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+/// Largest CPU or NUMA node index accepted by `parseCpuList`.
+const int k_MAX_INDEX = 1 << 20;
+
+/// Size of the buffers into which `sysfs` files are read.
+const int k_BUFFER_SIZE = 4096;
+
+/// Advance the specified `*next` past any whitespace preceding the
+/// specified `end`.
+void skipWhitespace(const char **next, const char *end)
+{
+    while (*next != end && (' '  == **next || '\t' == **next
+                         || '\n' == **next || '\r' == **next)) {
+        ++*next;
+    }
+}
+
+/// Parse a non-negative decimal integer, surrounded by optional whitespace,
+/// from the characters in the range starting at the specified `*next` and
+/// ending at the specified `end`, load it into the specified `result`, and
+/// advance `*next` past the parsed characters.  Return 0 on success, and a
+/// non-zero value if there is no such integer or it exceeds `k_MAX_INDEX`.
+int parseIndex(int *result, const char **next, const char *end)
+{
+    skipWhitespace(next, end);
+
+    if (*next == end || **next < '0' || '9' < **next) {
+        return -1;                                                    // RETURN
+    }
+
+    int value = 0;
+    while (*next != end && '0' <= **next && **next <= '9') {
+        value = value * 10 + (**next - '0');
+        if (k_MAX_INDEX < value) {
+            return -1;                                                // RETURN
+        }
+        ++*next;
+    }
+
+    skipWhitespace(next, end);
+
+    *result = value;
+    return 0;
+}
+
+/// Load into the specified `buffer` of the specified `size` the first line
+/// of the file having the specified `path`.  Return `true` on success, and
+/// `false` if the file could not be read.
+bool readFirstLine(char *buffer, int size, const char *path)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    FILE *file = bsl::fopen(path, "r");
+    if (!file) {
+        return false;                                                 // RETURN
+    }
+
+    const bool rc = 0 != bsl::fgets(buffer, size, file);
+    bsl::fclose(file);
+
+    return rc;
+#else
+    (void) buffer;
+    (void) size;
+    (void) path;
+
+    return false;
+#endif
+}
+
+/// Read the file having the specified `path` as a CPU list, and load the
+/// result into the specified `result`.  Return 0 on success, and a non-zero
+/// value otherwise.
+int readCpuList(bsl::vector<int> *result, const char *path)
+{
+    char buffer[k_BUFFER_SIZE];
+
+    if (!readFirstLine(buffer, sizeof buffer, path)) {
+        return -1;                                                    // RETURN
+    }
+
+    return bslmt::CpuTopologyUtil::parseCpuList(result, buffer);
+}
+
+/// Read the file having the specified `path` as a non-negative integer, and
+/// return that integer, or -1 if the file could not be read.
+int readIndex(const char *path)
+{
+    char buffer[64];
+
+    if (!readFirstLine(buffer, sizeof buffer, path)) {
+        return -1;                                                    // RETURN
+    }
+
+    int result = -1;
+    if (1 != bsl::sscanf(buffer, "%d", &result) || result < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    return result;
+}
+
+/// Return the number of online CPUs reported by the platform, or 1 if it
+/// cannot be determined.
+int numOnlineCpus()
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    const int result = static_cast<int>(info.dwNumberOfProcessors);
+#else
+    const int result = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+
+    return 0 < result ? result : 1;
+}
+
+/// Return `true` if the specified sorted `cpus` contains the specified
+/// `cpu`, and `false` otherwise.
+bool contains(const bsl::vector<int>& cpus, int cpu)
+{
+    return bsl::binary_search(cpus.begin(), cpus.end(), cpu);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bslmt {
+
+                           // ----------------------
+                           // struct CpuTopologyUtil
+                           // ----------------------
+
+// CLASS METHODS
+int CpuTopologyUtil::coreOfCpu(int cpu)
+{
+    bsl::vector<int> online;
+    loadOnlineCpus(&online);
+
+    if (!u::contains(online, cpu)) {
+        return -1;                                                    // RETURN
+    }
+
+    char path[128];
+
+    bsl::snprintf(path,
+                  sizeof path,
+                  "/sys/devices/system/cpu/cpu%d/topology/physical_package_id",
+                  cpu);
+    const int package = u::readIndex(path);
+
+    bsl::snprintf(path,
+                  sizeof path,
+                  "/sys/devices/system/cpu/cpu%d/topology/core_id",
+                  cpu);
+    const int core = u::readIndex(path);
+
+    if (0 > package || 0 > core) {
+        return cpu;                                                   // RETURN
+    }
+
+    return (package << 16) | (core & 0xFFFF);
+}
+
+void CpuTopologyUtil::loadCpusOfNumaNode(bsl::vector<int> *result,
+                                         int               numaNode)
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    bsl::vector<int> nodes(result->get_allocator());
+    loadOnlineNumaNodes(&nodes);
+
+    if (!u::contains(nodes, numaNode)) {
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> online(result->get_allocator());
+    loadOnlineCpus(&online);
+
+    char path[128];
+    bsl::snprintf(path,
+                  sizeof path,
+                  "/sys/devices/system/node/node%d/cpulist",
+                  numaNode);
+
+    bsl::vector<int> cpus(result->get_allocator());
+    if (0 != u::readCpuList(&cpus, path)) {
+        // No NUMA information: the only node has all of the CPUs.
+
+        result->swap(online);
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        if (u::contains(online, cpus[i])) {
+            result->push_back(cpus[i]);
+        }
+    }
+}
+
+void CpuTopologyUtil::loadOnlineCpus(bsl::vector<int> *result)
+{
+    BSLS_ASSERT(result);
+
+    if (0 == u::readCpuList(result, "/sys/devices/system/cpu/online")
+     && !result->empty()) {
+        return;                                                       // RETURN
+    }
+
+    const int numCpus = u::numOnlineCpus();
+
+    result->clear();
+    for (int i = 0; i < numCpus; ++i) {
+        result->push_back(i);
+    }
+}
+
+void CpuTopologyUtil::loadOnlineNumaNodes(bsl::vector<int> *result)
+{
+    BSLS_ASSERT(result);
+
+    if (0 == u::readCpuList(result, "/sys/devices/system/node/online")
+     && !result->empty()) {
+        return;                                                       // RETURN
+    }
+
+    result->assign(1, 0);
+}
+
+int CpuTopologyUtil::numaNodeOfCpu(int cpu)
+{
+    bsl::vector<int> nodes;
+    loadOnlineNumaNodes(&nodes);
+
+    bsl::vector<int> cpus;
+    for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+        loadCpusOfNumaNode(&cpus, nodes[i]);
+
+        if (u::contains(cpus, cpu)) {
+            return nodes[i];                                          // RETURN
+        }
+    }
+
+    return -1;
+}
+
+int CpuTopologyUtil::parseCpuList(bsl::vector<int>        *result,
+                                  const bsl::string_view&  cpuList)
+{
+    BSLS_ASSERT(result);
+
+    bsl::vector<int> cpus(result->get_allocator());
+
+    const char *next = cpuList.data();
+    const char *end  = next + cpuList.size();
+
+    u::skipWhitespace(&next, end);
+
+    while (next != end) {
+        int first;
+        if (0 != u::parseIndex(&first, &next, end)) {
+            return -1;                                                // RETURN
+        }
+
+        int last = first;
+        if (next != end && '-' == *next) {
+            ++next;
+            if (0 != u::parseIndex(&last, &next, end) || last < first) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+
+        if (next != end) {
+            if (',' != *next) {
+                return -1;                                            // RETURN
+            }
+            ++next;
+            u::skipWhitespace(&next, end);
+            if (next == end) {
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    bsl::sort(cpus.begin(), cpus.end());
+    cpus.erase(bsl::unique(cpus.begin(), cpus.end()), cpus.end());
+
+    result->swap(cpus);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
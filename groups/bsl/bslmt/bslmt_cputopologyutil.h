@@ -0,0 +1,147 @@
+// bslmt_cputopologyutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLMT_CPUTOPOLOGYUTIL
+#define INCLUDED_BSLMT_CPUTOPOLOGYUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to describe the CPUs and NUMA nodes of a host.
+//
+//@CLASSES:
+//  bslmt::CpuTopologyUtil: namespace for CPU and NUMA topology queries
+//
+//@SEE_ALSO: bslmt_threadattributes, bslmt_threadutil
+//
+//@DESCRIPTION: This component defines a utility `struct`,
+// `bslmt::CpuTopologyUtil`, that is a namespace for functions describing the
+// CPUs of the host: which CPUs are online, which NUMA node each CPU belongs
+// to, and which CPUs are hardware threads of the same physical core.  These
+// functions are intended to help clients choose the CPUs to which threads
+// are bound (see the `cpuAffinity` and `numaNode` attributes of
+// `bslmt::ThreadAttributes`).
+//
+// CPUs and NUMA nodes are identified by the non-negative indices used by the
+// operating system.  On Linux, the topology is read from `sysfs`.  On other
+// platforms, and on Linux if `sysfs` is unavailable, the host is described as
+// a single NUMA node, having index 0, in which each online CPU is a distinct
+// core.
+//
+// The topology is read anew on each call, so that CPUs brought online or
+// offline are taken into account; clients calling these functions
+// frequently should cache the results.
+//
+///CPU List Format
+///---------------
+// Sets of CPUs are described by Linux in the "cpulist" format: a
+// comma-separated list of CPU indices and inclusive ranges of CPU indices,
+// such as "0-3,8,10-11".  `parseCpuList` parses this format, which is also
+// convenient for configuration files.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Listing the CPUs of Each NUMA Node
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to log the layout of the host at the start of a
+// process.
+//
+// First, we obtain the NUMA nodes that are online:
+// ```
+// bsl::vector<int> nodes;
+// bslmt::CpuTopologyUtil::loadOnlineNumaNodes(&nodes);
+// assert(!nodes.empty());
+// ```
+// Then, we obtain the CPUs of each node, and verify that each belongs to the
+// node:
+// ```
+// for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+//     bsl::vector<int> cpus;
+//     bslmt::CpuTopologyUtil::loadCpusOfNumaNode(&cpus, nodes[i]);
+//
+//     for (bsl::size_t j = 0; j < cpus.size(); ++j) {
+//         assert(nodes[i] ==
+//                        bslmt::CpuTopologyUtil::numaNodeOfCpu(cpus[j]));
+//     }
+// }
+// ```
+// Finally, we parse a CPU list supplied by configuration:
+// ```
+// bsl::vector<int> cpus;
+// int rc = bslmt::CpuTopologyUtil::parseCpuList(&cpus, "0-2,6");
+// assert(0 == rc);
+// assert(4 == cpus.size());
+// assert(0 == cpus[0] && 1 == cpus[1] && 2 == cpus[2] && 6 == cpus[3]);
+// ```
+
+#include <bslscm_version.h>
+
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                           // ======================
+                           // struct CpuTopologyUtil
+                           // ======================
+
+/// This `struct` provides a namespace for functions describing the CPUs and
+/// NUMA nodes of the host.
+struct CpuTopologyUtil {
+
+    // CLASS METHODS
+
+    /// Return an identifier of the physical core containing the specified
+    /// `cpu`, such that two CPUs have the same identifier if and only if
+    /// they are hardware threads of the same core, or -1 if `cpu` is not
+    /// online.
+    static int coreOfCpu(int cpu);
+
+    /// Load into the specified `result` the indices, in increasing order, of
+    /// the online CPUs of the specified `numaNode`.  Note that `result` is
+    /// empty if `numaNode` does not exist.
+    static void loadCpusOfNumaNode(bsl::vector<int> *result, int numaNode);
+
+    /// Load into the specified `result` the indices, in increasing order, of
+    /// the online CPUs of the host.
+    static void loadOnlineCpus(bsl::vector<int> *result);
+
+    /// Load into the specified `result` the indices, in increasing order, of
+    /// the online NUMA nodes of the host.
+    static void loadOnlineNumaNodes(bsl::vector<int> *result);
+
+    /// Return the index of the NUMA node containing the specified `cpu`, or
+    /// -1 if `cpu` is not online.
+    static int numaNodeOfCpu(int cpu);
+
+    /// Load into the specified `result` the CPU indices described by the
+    /// specified `cpuList` in the "cpulist" format (see {CPU List Format}),
+    /// in increasing order and without duplicates.  Return 0 on success,
+    /// and a non-zero value, with no effect on `result`, if `cpuList` is
+    /// not in that format.  Note that an empty (or all-whitespace)
+    /// `cpuList` describes an empty set.
+    static int parseCpuList(bsl::vector<int>        *result,
+                            const bsl::string_view&  cpuList);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,392 @@
+// bslmt_cputopologyutil.t.cpp                                        -*-C++-*-
+
+#include <bslmt_cputopologyutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test is a utility describing the CPUs and NUMA nodes of
+// the host.  `parseCpuList` is a pure function, and is tested with a table of
+// valid and invalid inputs.  The topology queries depend on the host, so we
+// verify only that their results are mutually consistent: each online CPU
+// belongs to exactly one online node, the CPUs of the nodes partition the
+// online CPUs, and each online CPU has a core.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int coreOfCpu(int cpu);
+// [ 2] void loadCpusOfNumaNode(bsl::vector<int> *result, int numaNode);
+// [ 2] void loadOnlineCpus(bsl::vector<int> *result);
+// [ 2] void loadOnlineNumaNodes(bsl::vector<int> *result);
+// [ 2] int numaNodeOfCpu(int cpu);
+// [ 1] int parseCpuList(bsl::vector<int> *, const bsl::string_view&);
+//-----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::CpuTopologyUtil Util;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Listing the CPUs of Each NUMA Node
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to log the layout of the host at the start of a
+// process.
+//
+// First, we obtain the NUMA nodes that are online:
+// ```
+    bsl::vector<int> nodes;
+    bslmt::CpuTopologyUtil::loadOnlineNumaNodes(&nodes);
+    ASSERT(!nodes.empty());
+// ```
+// Then, we obtain the CPUs of each node, and verify that each belongs to the
+// node:
+// ```
+    for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+        bsl::vector<int> cpus;
+        bslmt::CpuTopologyUtil::loadCpusOfNumaNode(&cpus, nodes[i]);
+
+        for (bsl::size_t j = 0; j < cpus.size(); ++j) {
+            ASSERT(nodes[i] ==
+                           bslmt::CpuTopologyUtil::numaNodeOfCpu(cpus[j]));
+        }
+    }
+// ```
+// Finally, we parse a CPU list supplied by configuration:
+// ```
+    bsl::vector<int> cpus;
+    int rc = bslmt::CpuTopologyUtil::parseCpuList(&cpus, "0-2,6");
+    ASSERT(0 == rc);
+    ASSERT(4 == cpus.size());
+    ASSERT(0 == cpus[0] && 1 == cpus[1] && 2 == cpus[2] && 6 == cpus[3]);
+// ```
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TOPOLOGY QUERIES
+        //
+        // Concerns:
+        // 1. At least one CPU and one NUMA node are online, and both lists
+        //    are sorted without duplicates.
+        //
+        // 2. The CPUs of the online nodes partition the online CPUs, and
+        //    `numaNodeOfCpu` agrees with `loadCpusOfNumaNode`.
+        //
+        // 3. Each online CPU has a non-negative core identifier, and an
+        //    offline or nonexistent CPU has neither a core nor a node.
+        //
+        // 4. `loadCpusOfNumaNode` loads an empty list for a nonexistent
+        //    node.
+        //
+        // Plan:
+        // 1. Load the online CPUs and nodes, and verify their ordering.
+        //    (C-1)
+        //
+        // 2. For each node, load its CPUs, and verify that each is online and
+        //    maps back to the node; verify that the total number of CPUs is
+        //    the number of online CPUs.  (C-2)
+        //
+        // 3. Query the core of each online CPU, and of a CPU index larger than
+        //    any online CPU.  (C-3)
+        //
+        // 4. Load the CPUs of a node index larger than any online node.
+        //    (C-4)
+        //
+        // Testing:
+        //   int coreOfCpu(int cpu);
+        //   void loadCpusOfNumaNode(bsl::vector<int> *result, int numaNode);
+        //   void loadOnlineCpus(bsl::vector<int> *result);
+        //   void loadOnlineNumaNodes(bsl::vector<int> *result);
+        //   int numaNodeOfCpu(int cpu);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TOPOLOGY QUERIES\n"
+                             "================\n";
+
+        bsl::vector<int> online;
+        Util::loadOnlineCpus(&online);
+
+        bsl::vector<int> nodes;
+        Util::loadOnlineNumaNodes(&nodes);
+
+        if (verbose) {
+            P_(online.size()) P(nodes.size())
+        }
+
+        ASSERT(!online.empty());
+        ASSERT(!nodes.empty());
+
+        for (bsl::size_t i = 1; i < online.size(); ++i) {
+            ASSERTV(i, online[i - 1] < online[i]);
+        }
+        for (bsl::size_t i = 1; i < nodes.size(); ++i) {
+            ASSERTV(i, nodes[i - 1] < nodes[i]);
+        }
+
+        bsl::size_t numCpus = 0;
+        for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+            bsl::vector<int> cpus;
+            Util::loadCpusOfNumaNode(&cpus, nodes[i]);
+
+            numCpus += cpus.size();
+
+            for (bsl::size_t j = 0; j < cpus.size(); ++j) {
+                const int CPU = cpus[j];
+
+                if (veryVerbose) {
+                    T_ P_(nodes[i]) P_(CPU) P(Util::coreOfCpu(CPU))
+                }
+
+                ASSERTV(CPU, bsl::binary_search(online.begin(),
+                                                online.end(),
+                                                CPU));
+                ASSERTV(CPU, nodes[i] == Util::numaNodeOfCpu(CPU));
+            }
+        }
+        ASSERTV(numCpus, online.size(), numCpus == online.size());
+
+        for (bsl::size_t i = 0; i < online.size(); ++i) {
+            ASSERTV(online[i], 0 <= Util::coreOfCpu(online[i]));
+        }
+
+        const int BAD_CPU  = online.back() + 1;
+        const int BAD_NODE = nodes.back() + 1;
+
+        ASSERT(-1 == Util::coreOfCpu(BAD_CPU));
+        ASSERT(-1 == Util::numaNodeOfCpu(BAD_CPU));
+        ASSERT(-1 == Util::coreOfCpu(-1));
+        ASSERT(-1 == Util::numaNodeOfCpu(-1));
+
+        bsl::vector<int> cpus(1, 7);
+        Util::loadCpusOfNumaNode(&cpus, BAD_NODE);
+        ASSERT(cpus.empty());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // PARSING CPU LISTS
+        //
+        // Concerns:
+        // 1. Indices and inclusive ranges separated by commas are parsed, and
+        //    whitespace around them is ignored.
+        //
+        // 2. The result is sorted and free of duplicates.
+        //
+        // 3. An empty list describes the empty set.
+        //
+        // 4. Malformed lists are rejected, leaving the result unchanged.
+        //
+        // 5. The result uses the allocator of the supplied vector, and no
+        //    memory is leaked.
+        //
+        // Plan:
+        // 1. Using a table of inputs and expected outputs, in which an
+        //    expected output of 0 indicates a malformed list, parse each input
+        //    into a vector initially holding a sentinel value, and verify the
+        //    status and the result.  (C-1..4)
+        //
+        // 2. Verify the allocator of the result, and that no memory from the
+        //    default allocator remains in use.  (C-5)
+        //
+        // Testing:
+        //   int parseCpuList(bsl::vector<int> *, const bsl::string_view&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PARSING CPU LISTS\n"
+                             "=================\n";
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            const char *d_expected_p;  // one digit per CPU, or 0 if invalid
+        } DATA[] = {
+            //LINE  INPUT                  EXPECTED
+            //----  ---------------------  ----------
+            { L_,   "",                    ""         },
+            { L_,   " ",                   ""         },
+            { L_,   "\n",                  ""         },
+            { L_,   "0",                   "0"        },
+            { L_,   "7\n",                 "7"        },
+            { L_,   " 3 ",                 "3"        },
+            { L_,   "0-3",                 "0123"     },
+            { L_,   "2-2",                 "2"        },
+            { L_,   "0,2",                 "02"       },
+            { L_,   "0-2,6",               "0126"     },
+            { L_,   "0-1,4-5\n",           "0145"     },
+            { L_,   "0 - 1 , 4 - 5",       "0145"     },
+            { L_,   "6,0-2",               "0126"     },
+            { L_,   "1,1,1",               "1"        },
+            { L_,   "0-3,2-5",             "012345"   },
+
+            { L_,   ",",                   0          },
+            { L_,   "0,",                  0          },
+            { L_,   ",0",                  0          },
+            { L_,   "0,,1",                0          },
+            { L_,   "-1",                  0          },
+            { L_,   "1-",                  0          },
+            { L_,   "3-1",                 0          },
+            { L_,   "1-2-3",               0          },
+            { L_,   "a",                   0          },
+            { L_,   "0 1",                 0          },
+            { L_,   "0;1",                 0          },
+            { L_,   "99999999999",         0          },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INPUT    = DATA[ti].d_input_p;
+            const char *const EXPECTED = DATA[ti].d_expected_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bsl::vector<int> mX(1, -7, &oa);  const bsl::vector<int>& X = mX;
+
+            const int rc = Util::parseCpuList(&mX, INPUT);
+
+            if (!EXPECTED) {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, 1 == X.size() && -7 == X[0]);
+                continue;
+            }
+
+            ASSERTV(LINE, rc, 0 == rc);
+
+            bsl::vector<int> exp;
+            for (const char *c = EXPECTED; *c; ++c) {
+                exp.push_back(*c - '0');
+            }
+
+            ASSERTV(LINE, exp == X);
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+        }
+
+        {
+            bsl::vector<int> mX(&oa);
+            ASSERT(0 == Util::parseCpuList(&mX, "0-1000,4095"));
+            ASSERT(1002 == mX.size());
+            ASSERT(4095 == mX.back());
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -27,6 +27,8 @@ bslmt::ThreadAttributes::ThreadAttributes()
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
 , d_threadName(static_cast<bslma::Allocator *>(0))
+, d_cpuAffinity(static_cast<bslma::Allocator *>(0))
+, d_numaNode(e_UNSET_NUMA_NODE)
 {
 }
 
@@ -38,6 +40,8 @@ bslmt::ThreadAttributes::ThreadAttributes(bslma::Allocator *basicAllocator)
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
 , d_threadName(basicAllocator)
+, d_cpuAffinity(basicAllocator)
+, d_numaNode(e_UNSET_NUMA_NODE)
 {
 }
 
@@ -52,6 +56,8 @@ bslmt::ThreadAttributes::ThreadAttributes(
 , d_schedulingPriority(original.d_schedulingPriority)
 , d_stackSize(original.d_stackSize)
 , d_threadName(original.d_threadName, basicAllocator)
+, d_cpuAffinity(original.d_cpuAffinity, basicAllocator)
+, d_numaNode(original.d_numaNode)
 {
 }
 
@@ -66,6 +72,8 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
     d_schedulingPriority  = rhs.d_schedulingPriority;
     d_stackSize           = rhs.d_stackSize;
     d_threadName          = rhs.d_threadName;
+    d_cpuAffinity         = rhs.d_cpuAffinity;
+    d_numaNode            = rhs.d_numaNode;
 
     return *this;
 }
@@ -86,6 +94,8 @@ bsl::ostream& bslmt::ThreadAttributes::print(
     printer.printAttribute("schedulingPriority", d_schedulingPriority);
     printer.printAttribute("stackSize", d_stackSize);
     printer.printAttribute("threadName", d_threadName);
+    printer.printAttribute("cpuAffinity", d_cpuAffinity);
+    printer.printAttribute("numaNode", d_numaNode);
 
     printer.end();
     return stream;
@@ -101,7 +111,9 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
            lhs.schedulingPriority() == rhs.schedulingPriority() &&
            lhs.stackSize()          == rhs.stackSize()          &&
-           lhs.threadName()         == rhs.threadName();
+           lhs.threadName()         == rhs.threadName()         &&
+           lhs.cpuAffinity()        == rhs.cpuAffinity()        &&
+           lhs.numaNode()           == rhs.numaNode();
 }
 
 bool bslmt::operator!=(const ThreadAttributes& lhs,
@@ -113,7 +125,9 @@ bool bslmt::operator!=(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
            lhs.schedulingPriority() != rhs.schedulingPriority() ||
            lhs.stackSize()          != rhs.stackSize()          ||
-           lhs.threadName()         != rhs.threadName();
+           lhs.threadName()         != rhs.threadName()         ||
+           lhs.cpuAffinity()        != rhs.cpuAffinity()        ||
+           lhs.numaNode()           != rhs.numaNode();
 }
 
 }  // close enterprise namespace
@@ -30,11 +30,15 @@ BSLS_IDENT("$Id: $")
 // schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 // schedulingPriority  int                    e_UNSET_PRIORITY
 // threadName          bsl::string            ""
+// cpuAffinity         bsl::vector<int>       empty
+// numaNode            int                    e_UNSET_NUMA_NODE
 //
 // Name          Constraint
 // ---------     ---------------------------------------------------
 // stackSize     'e_UNSET_STACK_SIZE == stackSize || 0 <= stackSize'
 // guardSize     'e_UNSET_GUARD_SIZE == guardSize || 0 <= guardSize'
+// cpuAffinity   '0 <= cpu' for each 'cpu' in 'cpuAffinity'
+// numaNode      'e_UNSET_NUMA_NODE == numaNode || 0 <= numaNode'
 // ```
 //
 ///`detachedState` Attribute
@@ -123,6 +127,29 @@ BSLS_IDENT("$Id: $")
 // length of 15, while on Windows, the limit is 32767, or `(1 << 15) - 1`
 // characters.
 //
+///`cpuAffinity` Attribute
+///- - - - - - - - - - - -
+// The `cpuAffinity` attribute indicates the indices of the CPUs on which the
+// created thread may run.  If `cpuAffinity` is empty (the default), the
+// thread may run on any CPU available to the process (subject to the
+// `numaNode` attribute).  Binding a thread to the CPUs of one socket
+// preserves the locality of its caches and memory; binding a thread to a
+// single CPU additionally makes its placement deterministic.  See
+// `bslmt_cputopologyutil` for functions describing the CPUs of the host.
+// At this time, only Linux supports this attribute; it is ignored on other
+// platforms.
+//
+///`numaNode` Attribute
+///- - - - - - - - - -
+// The `numaNode` attribute indicates the index of the NUMA node on whose CPUs
+// the created thread may run.  If `numaNode` is `e_UNSET_NUMA_NODE` (the
+// default), the thread may run on the CPUs of any node.  If both
+// `cpuAffinity` and `numaNode` are set, the thread may run only on the CPUs
+// of `cpuAffinity` that belong to `numaNode`, and thread creation fails if
+// there are none.  Note that memory first touched by a thread bound to a
+// node is typically allocated from that node.  At this time, only Linux
+// supports this attribute; it is ignored on other platforms.
+//
 ///Fluent Interface
 ///------------------
 // `bslmt::ThreadAttributes` provides manipulators that return a non-`const`
@@ -279,6 +306,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_c_limits.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bslmt {
@@ -340,15 +368,16 @@ class ThreadAttributes {
     };
 
     /// The following constants indicate that the `stackSize`, `guardSize`,
-    /// and `schedulingPriority` attributes, respectively, are unspecified
-    /// and the thread creation routine is use platform-specific defaults.
-    /// These attributes are initialized to these values when a thread
-    /// attributes object is default constructed.
+    /// `schedulingPriority`, and `numaNode` attributes, respectively, are
+    /// unspecified and the thread creation routine is use platform-specific
+    /// defaults.  These attributes are initialized to these values when a
+    /// thread attributes object is default constructed.
     enum {
 
         e_UNSET_STACK_SIZE = -1,
         e_UNSET_GUARD_SIZE = -1,
         e_UNSET_PRIORITY   = INT_MIN,
+        e_UNSET_NUMA_NODE  = -1,
 
         e_SCHED_MIN        = e_SCHED_OTHER,
         e_SCHED_MAX        = e_SCHED_DEFAULT
@@ -384,6 +413,12 @@ class ThreadAttributes {
 
     bsl::string      d_threadName;          // name of the thread
 
+    bsl::vector<int> d_cpuAffinity;         // CPUs on which the thread may
+                                            // run (empty if unrestricted)
+
+    int              d_numaNode;            // NUMA node on whose CPUs the
+                                            // thread may run
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ThreadAttributes,
@@ -400,6 +435,8 @@ class ThreadAttributes {
     /// * `schedulingPriority() == e_UNSET_PRIORITY`
     /// * `stackSize()          == e_UNSET_STACK_SIZE`
     /// * `threadName()         == ""`
+    /// * `cpuAffinity()        == bsl::vector<int>()`
+    /// * `numaNode()           == e_UNSET_NUMA_NODE`
     /// Optionally specify a `basicAllocator` used to supply memory.  If
     /// `basicAllocator` is 0, the currently installed default allocator is
     /// used.
@@ -421,6 +458,14 @@ class ThreadAttributes {
 
     // MANIPULATORS
 
+    /// Set the `cpuAffinity` attribute of this object to the specified
+    /// `value`, the indices of the CPUs on which a thread may run.  Return a
+    /// non-`const` reference to this object (see also {Fluent Interface}).
+    /// An empty `value` indicates that a thread may run on any CPU.  Note
+    /// that this attribute is honored only on Linux.  The behavior is
+    /// undefined unless each element of `value` is non-negative.
+    ThreadAttributes& setCpuAffinity(const bsl::vector<int>& value);
+
     /// Set the `detachedState` attribute of this object to the specified
     /// `value`.  Return a non-`const` reference to this object (see also
     /// {Fluent Interface}).  A value of `e_CREATE_JOINABLE` (the default)
@@ -453,6 +498,15 @@ class ThreadAttributes {
     /// attribute.
     ThreadAttributes& setInheritSchedule(bool value);
 
+    /// Set the `numaNode` attribute of this object to the specified
+    /// `value`, the index of the NUMA node on whose CPUs a thread may run.
+    /// Return a non-`const` reference to this object (see also
+    /// {Fluent Interface}).  `e_UNSET_NUMA_NODE == value` indicates that a
+    /// thread may run on the CPUs of any node.  Note that this attribute is
+    /// honored only on Linux.  The behavior is undefined unless
+    /// `e_UNSET_NUMA_NODE == value` or `0 <= value`.
+    ThreadAttributes& setNumaNode(int value);
+
     /// Set the value of the `schedulingPolicy` attribute of this object to
     /// the specified `value`.  Return a non-`const` reference to this
     /// object (see also {Fluent Interface}).  This attribute is ignored
@@ -486,6 +540,12 @@ class ThreadAttributes {
 
     // ACCESSORS
 
+    /// Return a reference providing non-modifiable access to the
+    /// `cpuAffinity` attribute of this object, the indices of the CPUs on
+    /// which a thread may run, or an empty vector if a thread may run on
+    /// any CPU.
+    const bsl::vector<int>& cpuAffinity() const;
+
     /// Return the value of the `detachedState` attribute of this object.  A
     /// value of `e_CREATE_JOINABLE` indicates that a thread must be joined
     /// after it terminates to clean up its resources; a value of
@@ -511,6 +571,11 @@ class ThreadAttributes {
     /// information about support for this attribute.
     bool inheritSchedule() const;
 
+    /// Return the value of the `numaNode` attribute of this object, the
+    /// index of the NUMA node on whose CPUs a thread may run, or
+    /// `e_UNSET_NUMA_NODE` if a thread may run on the CPUs of any node.
+    int numaNode() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -560,14 +625,16 @@ class ThreadAttributes {
 /// value, and `false` otherwise.  Two `ThreadAttributes` objects have the
 /// same value if the corresponding values of their `detachedState`,
 /// `guardSize`, `inheritSchedule`, `schedulingPolicy`,
-/// `schedulingPriority`, and `stackSize` attributes are the same.
+/// `schedulingPriority`, `stackSize`, `threadName`, `cpuAffinity`, and
+/// `numaNode` attributes are the same.
 bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
 
 /// Return `true` if the specified `lhs` and `rhs` objects do not have the
 /// same value, and `false` otherwise.  Two `baltzo::LocalTimeDescriptor`
 /// objects do not have the same value if the corresponding values of their
 /// `detachedState`, `guardSize`, `inheritSchedule`, `schedulingPolicy`,
-/// `schedulingPriority`, and `stackSize` attributes are not the same.
+/// `schedulingPriority`, `stackSize`, `threadName`, `cpuAffinity`, or
+/// `numaNode` attributes are not the same.
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
 
 // FREE OPERATORS
@@ -592,6 +659,15 @@ bsl::ostream& operator<<(bsl::ostream&           stream,
                           // ----------------------
 
 // MANIPULATORS
+inline
+ThreadAttributes& ThreadAttributes::setCpuAffinity(
+                                                const bsl::vector<int>& value)
+{
+    d_cpuAffinity = value;
+
+    return *this;
+}
+
 inline
 ThreadAttributes& ThreadAttributes::setDetachedState(
                                          ThreadAttributes::DetachedState value)
@@ -624,6 +700,18 @@ ThreadAttributes& ThreadAttributes::setInheritSchedule(bool value)
     return *this;
 }
 
+inline
+ThreadAttributes& ThreadAttributes::setNumaNode(int value)
+{
+    BSLMF_ASSERT(-1 == e_UNSET_NUMA_NODE);
+
+    BSLS_ASSERT_SAFE(-1 <= value);
+
+    d_numaNode = value;
+
+    return *this;
+}
+
 inline
 ThreadAttributes& ThreadAttributes::setSchedulingPolicy(
                                       ThreadAttributes::SchedulingPolicy value)
@@ -666,6 +754,12 @@ ThreadAttributes& ThreadAttributes::setThreadName(
 }
 
 // ACCESSORS
+inline
+const bsl::vector<int>& ThreadAttributes::cpuAffinity() const
+{
+    return d_cpuAffinity;
+}
+
 inline
 ThreadAttributes::DetachedState ThreadAttributes::detachedState() const
 {
@@ -684,6 +778,12 @@ bool ThreadAttributes::inheritSchedule() const
     return d_inheritScheduleFlag;
 }
 
+inline
+int ThreadAttributes::numaNode() const
+{
+    return d_numaNode;
+}
+
 inline
 ThreadAttributes::SchedulingPolicy ThreadAttributes::schedulingPolicy() const
 {
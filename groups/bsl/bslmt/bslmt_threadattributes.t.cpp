@@ -26,6 +26,7 @@
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
     #include <pthread.h>
@@ -251,7 +252,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TEST
         //
@@ -300,6 +301,88 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING PLACEMENT ATTRIBUTES
+        //
+        // Concerns:
+        // 1. `setCpuAffinity` and `setNumaNode` set the values returned by
+        //    `cpuAffinity` and `numaNode`, and return a reference to the
+        //    modified object.
+        //
+        // 2. Both attributes are salient: they participate in copying,
+        //    assignment, and comparison.
+        //
+        // 3. Memory for the CPU affinity is supplied by the object's
+        //    allocator.
+        //
+        // Plan:
+        // 1. Set each attribute on an object using a test allocator, verify
+        //    the accessors and the allocator usage, and verify that copies
+        //    compare equal and that objects differing only in one of the
+        //    attributes compare unequal.  (C-1..3)
+        //
+        // Testing:
+        //   ThreadAttributes& setCpuAffinity(const bsl::vector<int>&);
+        //   ThreadAttributes& setNumaNode(int);
+        //   const bsl::vector<int>& cpuAffinity() const;
+        //   int numaNode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PLACEMENT ATTRIBUTES\n"
+                             "============================\n";
+
+        bslma::TestAllocator ta;
+        bslma::TestAllocator da;
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<int> cpus(&ta);
+        cpus.push_back(1);
+        cpus.push_back(3);
+
+        Obj mX(&ta);    const Obj& X = mX;
+
+        ASSERT(X.cpuAffinity().empty());
+        ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
+
+        const Int64 numTaPreAlloc = ta.numAllocations();
+        {
+            Obj& rv = mX.setCpuAffinity(cpus);
+            ASSERTV(&rv, &mX, &rv == &mX);
+        }
+        ASSERT(cpus == X.cpuAffinity());
+        ASSERT(ta.numAllocations() > numTaPreAlloc);
+        ASSERT(0 == da.numAllocations());
+
+        {
+            Obj& rv = mX.setNumaNode(1);
+            ASSERTV(&rv, &mX, &rv == &mX);
+        }
+        ASSERT(1 == X.numaNode());
+
+        const Obj Y(X, &ta);
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+        ASSERT(cpus == Y.cpuAffinity());
+        ASSERT(1 == Y.numaNode());
+
+        Obj mZ(&ta);    const Obj& Z = mZ;
+        mZ = X;
+        ASSERT(X == Z);
+
+        mZ.setNumaNode(0);
+        ASSERT(X != Z);
+        ASSERT(!(X == Z));
+
+        mZ.setNumaNode(1);
+        ASSERT(X == Z);
+
+        mZ.setCpuAffinity(bsl::vector<int>());
+        ASSERT(X != Z);
+        ASSERT(Z.cpuAffinity().empty());
+
+        ASSERT(0 == da.numAllocations());
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // PRINT AND OUTPUT OPERATOR
@@ -402,6 +485,8 @@ int main(int argc, char *argv[])
             int                    d_schedulingPriority;
             int                    d_stackSize;
             const char            *d_threadName;
+            const char            *d_cpuAffinity;  // one digit per CPU
+            int                    d_numaNode;
 
             const char            *d_expected_p;
         } DATA[] = {
@@ -412,6 +497,7 @@ int main(int argc, char *argv[])
 
         { L_,  0,  0,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "detachedState = 0\n"
          "guardSize = 64\n"
@@ -420,10 +506,14 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1\n"
          "stackSize = 1024\n"
          "threadName = \"t\"\n"
+         "cpuAffinity = [\n"
+         "]\n"
+         "numaNode = -1\n"
          "]\n" },
 
         { L_,  0,  1,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          " detachedState = 0\n"
          " guardSize = 64\n"
@@ -432,10 +522,14 @@ int main(int argc, char *argv[])
          " schedulingPriority = 1\n"
          " stackSize = 1024\n"
          " threadName = \"t\"\n"
+         " cpuAffinity = [\n"
+         " ]\n"
+         " numaNode = -1\n"
          "]\n" },
 
         { L_,  0, -1,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[ "
          "detachedState = 0 "
          "guardSize = 64 "
@@ -444,10 +538,13 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1 "
          "stackSize = 1024 "
          "threadName = \"t\" "
+         "cpuAffinity = [ ] "
+         "numaNode = -1 "
          "]" },
 
         { L_,  0, -8,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "    detachedState = 0\n"
          "    guardSize = 64\n"
@@ -456,6 +553,9 @@ int main(int argc, char *argv[])
          "    schedulingPriority = 1\n"
          "    stackSize = 1024\n"
          "    threadName = \"t\"\n"
+         "    cpuAffinity = [\n"
+         "    ]\n"
+         "    numaNode = -1\n"
          "]\n" },
 
         // ------------------------------------------------------------------
@@ -464,6 +564,7 @@ int main(int argc, char *argv[])
 
         { L_,  3,  0,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "detachedState = 0\n"
          "guardSize = 64\n"
@@ -472,10 +573,14 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1\n"
          "stackSize = 1024\n"
          "threadName = \"t\"\n"
+         "cpuAffinity = [\n"
+         "]\n"
+         "numaNode = -1\n"
          "]\n" },
 
         { L_,  3,  2,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "      [\n"
          "        detachedState = 0\n"
          "        guardSize = 64\n"
@@ -484,10 +589,14 @@ int main(int argc, char *argv[])
          "        schedulingPriority = 1\n"
          "        stackSize = 1024\n"
          "        threadName = \"t\"\n"
+         "        cpuAffinity = [\n"
+         "        ]\n"
+         "        numaNode = -1\n"
          "      ]\n" },
 
         { L_,  3, -2,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "      [ "
          "detachedState = 0 "
          "guardSize = 64 "
@@ -496,10 +605,13 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1 "
          "stackSize = 1024 "
          "threadName = \"t\" "
+         "cpuAffinity = [ ] "
+         "numaNode = -1 "
          "]" },
 
         { L_,  3, -8,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "            [\n"
          "                detachedState = 0\n"
          "                guardSize = 64\n"
@@ -508,10 +620,14 @@ int main(int argc, char *argv[])
          "                schedulingPriority = 1\n"
          "                stackSize = 1024\n"
          "                threadName = \"t\"\n"
+         "                cpuAffinity = [\n"
+         "                ]\n"
+         "                numaNode = -1\n"
          "            ]\n" },
 
         { L_, -3,  0,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "detachedState = 0\n"
          "guardSize = 64\n"
@@ -520,10 +636,14 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1\n"
          "stackSize = 1024\n"
          "threadName = \"t\"\n"
+         "cpuAffinity = [\n"
+         "]\n"
+         "numaNode = -1\n"
          "]\n" },
 
         { L_, -3,  2,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "        detachedState = 0\n"
          "        guardSize = 64\n"
@@ -532,10 +652,14 @@ int main(int argc, char *argv[])
          "        schedulingPriority = 1\n"
          "        stackSize = 1024\n"
          "        threadName = \"t\"\n"
+         "        cpuAffinity = [\n"
+         "        ]\n"
+         "        numaNode = -1\n"
          "      ]\n" },
 
         { L_, -3, -2,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[ "
          "detachedState = 0 "
          "guardSize = 64 "
@@ -544,10 +668,13 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1 "
          "stackSize = 1024 "
          "threadName = \"t\" "
+         "cpuAffinity = [ ] "
+         "numaNode = -1 "
          "]" },
 
         { L_, -3, -8,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "                detachedState = 0\n"
          "                guardSize = 64\n"
@@ -556,6 +683,9 @@ int main(int argc, char *argv[])
          "                schedulingPriority = 1\n"
          "                stackSize = 1024\n"
          "                threadName = \"t\"\n"
+         "                cpuAffinity = [\n"
+         "                ]\n"
+         "                numaNode = -1\n"
          "            ]\n" },
 
         // -----------------------------------------------------------------
@@ -564,6 +694,7 @@ int main(int argc, char *argv[])
 
         { L_,  2,  3,
           Obj::e_CREATE_DETACHED, 16, false, Obj::e_SCHED_FIFO, 3, 512, "nm",
+          "13", 0,
          "      [\n"
          "         detachedState = 1\n"
          "         guardSize = 16\n"
@@ -572,6 +703,11 @@ int main(int argc, char *argv[])
          "         schedulingPriority = 3\n"
          "         stackSize = 512\n"
          "         threadName = \"nm\"\n"
+         "         cpuAffinity = [\n"
+         "            1\n"
+         "            3\n"
+         "         ]\n"
+         "         numaNode = 0\n"
          "      ]\n" },
 
         // -----------------------------------------------------------------
@@ -580,6 +716,7 @@ int main(int argc, char *argv[])
 
         { L_, -8, -8,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[\n"
          "    detachedState = 0\n"
          "    guardSize = 64\n"
@@ -588,10 +725,14 @@ int main(int argc, char *argv[])
          "    schedulingPriority = 1\n"
          "    stackSize = 1024\n"
          "    threadName = \"t\"\n"
+         "    cpuAffinity = [\n"
+         "    ]\n"
+         "    numaNode = -1\n"
          "]\n" },
 
         { L_, -8, -8,
           Obj::e_CREATE_DETACHED, 16, false, Obj::e_SCHED_FIFO, 3, 512, "nm",
+          "13", 0,
          "[\n"
          "    detachedState = 1\n"
          "    guardSize = 16\n"
@@ -600,6 +741,11 @@ int main(int argc, char *argv[])
          "    schedulingPriority = 3\n"
          "    stackSize = 512\n"
          "    threadName = \"nm\"\n"
+         "    cpuAffinity = [\n"
+         "        1\n"
+         "        3\n"
+         "    ]\n"
+         "    numaNode = 0\n"
          "]\n" },
 
         // -----------------------------------------------------------------
@@ -608,6 +754,7 @@ int main(int argc, char *argv[])
 
         { L_, -9, -9,
           Obj::e_CREATE_JOINABLE, 64, true, Obj::e_SCHED_RR, 1, 1024, "t",
+          "",  -1,
          "[ "
          "detachedState = 0 "
          "guardSize = 64 "
@@ -616,10 +763,13 @@ int main(int argc, char *argv[])
          "schedulingPriority = 1 "
          "stackSize = 1024 "
          "threadName = \"t\" "
+         "cpuAffinity = [ ] "
+         "numaNode = -1 "
          "]" },
 
         { L_, -9, -9,
           Obj::e_CREATE_DETACHED, 16, false, Obj::e_SCHED_FIFO, 3, 512, "nm",
+          "13", 0,
          "[ "
          "detachedState = 1 "
          "guardSize = 16 "
@@ -628,6 +778,8 @@ int main(int argc, char *argv[])
          "schedulingPriority = 3 "
          "stackSize = 512 "
          "threadName = \"nm\" "
+         "cpuAffinity = [ 1 3 ] "
+         "numaNode = 0 "
          "]" }
 
         };
@@ -652,13 +804,22 @@ int main(int argc, char *argv[])
                 const int                   STACK_SIZE =  DATA[ti].d_stackSize;
                 const char *const           THREAD_NAME =
                                                          DATA[ti].d_threadName;
+                const char *const           CPU_AFFINITY =
+                                                        DATA[ti].d_cpuAffinity;
+                const int                   NUMA_NODE  =   DATA[ti].d_numaNode;
+
+                bsl::vector<int> cpus;
+                for (const char *c = CPU_AFFINITY; *c; ++c) {
+                    cpus.push_back(*c - '0');
+                }
 
                 const char *const EXP = DATA[ti].d_expected_p;
 
                 if (veryVerbose) {
                     T_ P_(L) P_(SPL) P_(DETACHED_STATE) P_(GUARD_SIZE)
                     P_(INHERIT_SCHEDULE) P_(SCHEDULING_POLICY)
-                    P_(SCHEDULING_PRIORITY) P_(STACK_SIZE) P(THREAD_NAME)
+                    P_(SCHEDULING_PRIORITY) P_(STACK_SIZE) P_(THREAD_NAME)
+                    P_(CPU_AFFINITY) P(NUMA_NODE)
                 }
 
                 if (veryVeryVerbose) { T_ T_ Q(EXPECTED) cout << EXP; }
@@ -671,6 +832,8 @@ int main(int argc, char *argv[])
                     .setSchedulingPriority(SCHEDULING_PRIORITY)
                     .setStackSize(STACK_SIZE)
                     .setThreadName(THREAD_NAME)
+                    .setCpuAffinity(cpus)
+                    .setNumaNode(NUMA_NODE)
                 ;
 
                 bsl::ostringstream os;
@@ -932,6 +1095,8 @@ int main(int argc, char *argv[])
         ASSERT(X.inheritSchedule());
         ASSERT(0 != X.stackSize());
         ASSERT("" == X.threadName());
+        ASSERT(X.cpuAffinity().empty());
+        ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
       } break;
       case -1: {
         // --------------------------------------------------------------------
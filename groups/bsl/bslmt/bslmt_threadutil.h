@@ -744,6 +744,23 @@ struct ThreadUtil {
     /// Return a *hint* at the number of concurrent threads supported by
     /// this platform on success, and 0 otherwise.
     static unsigned int hardwareConcurrency();
+
+                          // *** Thread Placement ***
+
+    /// Return the index of the CPU on which the calling thread is running,
+    /// or -1 if it cannot be determined on this platform.  Note that,
+    /// unless the calling thread is bound to a single CPU (see the
+    /// `cpuAffinity` attribute of `ThreadAttributes`), it may migrate to
+    /// another CPU at any time, so that the value returned may be stale.
+    static int currentCpu();
+
+    /// Return the index of the NUMA node of the CPU on which the calling
+    /// thread is running, or -1 if it cannot be determined on this
+    /// platform.  Note that, unless the calling thread is bound to the CPUs
+    /// of a single node (see the `cpuAffinity` and `numaNode` attributes of
+    /// `ThreadAttributes`), it may migrate to another node at any time, so
+    /// that the value returned may be stale.
+    static int currentNumaNode();
 };
 
 // ============================================================================
@@ -1082,6 +1099,20 @@ unsigned int ThreadUtil::hardwareConcurrency()
     return Imp::hardwareConcurrency();
 }
 
+                          // *** Thread Placement ***
+
+inline
+int ThreadUtil::currentCpu()
+{
+    return Imp::currentCpu();
+}
+
+inline
+int ThreadUtil::currentNumaNode()
+{
+    return Imp::currentNumaNode();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -10,6 +10,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bslmt_configuration.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_platform.h>
 #include <bslmt_threadattributes.h>
 
@@ -41,6 +42,7 @@
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -835,6 +837,54 @@ const char *nonDefaultThreadName =
 }  // close namespace u
 }  // close unnamed namespace
 
+//-----------------------------------------------------------------------------
+//                          Thread Placement Test Case
+//-----------------------------------------------------------------------------
+
+namespace THREAD_PLACEMENT_TEST_CASE {
+
+/// Record the CPU and NUMA node on which the thread running this function
+/// is observed.
+struct Observation {
+    int d_cpu;
+    int d_numaNode;
+};
+
+extern "C" void *observe(void *arg)
+{
+    Observation *observation = static_cast<Observation *>(arg);
+
+    // Yield a few times, giving the scheduler the opportunity to migrate
+    // this thread if it is not bound as requested.
+
+    for (int i = 0; i < 10; ++i) {
+        Obj::yield();
+    }
+
+    observation->d_cpu      = Obj::currentCpu();
+    observation->d_numaNode = Obj::currentNumaNode();
+
+    return 0;
+}
+
+/// Run `observe` in a thread created with the specified `attr`, and load
+/// the observation into the specified `result`.  Return the status of
+/// thread creation.
+int observeThread(Observation *result, const Attr& attr)
+{
+    result->d_cpu      = -2;
+    result->d_numaNode = -2;
+
+    Obj::Handle handle;
+    int         rc = Obj::create(&handle, attr, &observe, result);
+    if (0 == rc) {
+        ASSERT(0 == Obj::join(handle));
+    }
+    return rc;
+}
+
+}  // close namespace THREAD_PLACEMENT_TEST_CASE
+
 //-----------------------------------------------------------------------------
 //                       Named Detached Threads Test Case
 //-----------------------------------------------------------------------------
@@ -1629,6 +1679,125 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 21: {
+        // --------------------------------------------------------------------
+        // THREAD PLACEMENT
+        //
+        // Concerns:
+        // 1. `currentCpu` and `currentNumaNode` return -1 or the index of an
+        //    online CPU and node, respectively, and agree with
+        //    `CpuTopologyUtil`.
+        //
+        // 2. On Linux, a thread created with a single CPU in its
+        //    `cpuAffinity` attribute runs on that CPU.
+        //
+        // 3. On Linux, a thread created with a `numaNode` attribute runs on
+        //    a CPU of that node.
+        //
+        // 4. On Linux, thread creation fails if no online CPU satisfies both
+        //    the `cpuAffinity` and `numaNode` attributes.
+        //
+        // Plan:
+        // 1. Call `currentCpu` and `currentNumaNode` from the main thread
+        //    and verify the results against the topology.  (C-1)
+        //
+        // 2. For each online CPU, create a thread bound to that CPU, and
+        //    verify the CPU observed in the thread.  (C-2)
+        //
+        // 3. For each online node, create a thread bound to that node, and
+        //    verify the node and CPU observed in the thread.  (C-3)
+        //
+        // 4. Create a thread whose affinity names only a CPU beyond the last
+        //    online CPU, and one whose node does not exist, and verify that
+        //    creation fails.  (C-4)
+        //
+        // Testing:
+        //   int currentCpu();
+        //   int currentNumaNode();
+        //   CONCERN: `cpuAffinity` and `numaNode` attributes are honored
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "THREAD PLACEMENT\n"
+                             "================\n";
+
+        namespace TC = THREAD_PLACEMENT_TEST_CASE;
+
+        typedef bslmt::CpuTopologyUtil Topology;
+
+        bsl::vector<int> cpus;
+        Topology::loadOnlineCpus(&cpus);
+
+        bsl::vector<int> nodes;
+        Topology::loadOnlineNumaNodes(&nodes);
+
+        {
+            const int CPU  = Obj::currentCpu();
+            const int NODE = Obj::currentNumaNode();
+
+            if (verbose) { P_(CPU) P(NODE) }
+
+            ASSERTV(CPU, -1 == CPU
+                      || bsl::binary_search(cpus.begin(), cpus.end(), CPU));
+            ASSERTV(NODE, -1 == NODE
+                     || bsl::binary_search(nodes.begin(), nodes.end(), NODE));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(CPU,  0 <= CPU);
+            ASSERTV(NODE, 0 <= NODE);
+#endif
+        }
+
+        for (bsl::size_t i = 0; i < cpus.size() && i < 64; ++i) {
+            const int CPU = cpus[i];
+
+            Attr attr;
+            attr.setCpuAffinity(bsl::vector<int>(1, CPU));
+
+            TC::Observation observation;
+            ASSERTV(CPU, 0 == TC::observeThread(&observation, attr));
+
+            if (veryVerbose) { T_ P_(CPU) P(observation.d_cpu) }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(CPU, observation.d_cpu, CPU == observation.d_cpu);
+            ASSERTV(CPU, observation.d_numaNode,
+                    Topology::numaNodeOfCpu(CPU) == observation.d_numaNode);
+#endif
+        }
+
+        for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+            const int NODE = nodes[i];
+
+            Attr attr;
+            attr.setNumaNode(NODE);
+
+            TC::Observation observation;
+            ASSERTV(NODE, 0 == TC::observeThread(&observation, attr));
+
+            if (veryVerbose) { T_ P_(NODE) P(observation.d_numaNode) }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERTV(NODE, observation.d_numaNode,
+                    NODE == observation.d_numaNode);
+            ASSERTV(NODE, observation.d_cpu,
+                    NODE == Topology::numaNodeOfCpu(observation.d_cpu));
+#endif
+        }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        {
+            TC::Observation observation;
+
+            Attr attr;
+            attr.setCpuAffinity(bsl::vector<int>(1, cpus.back() + 1));
+            ASSERT(0 != TC::observeThread(&observation, attr));
+
+            attr.setCpuAffinity(bsl::vector<int>());
+            attr.setNumaNode(nodes.back() + 1);
+            ASSERT(0 != TC::observeThread(&observation, attr));
+        }
+#endif
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // THREAD LIBRARY CONSISTENCY
@@ -7,6 +7,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
 
 #include <bslmt_configuration.h>
+#include <bslmt_cputopologyutil.h>
 #include <bslmt_saturatedtimeconversionimputil.h>
 #include <bslmt_threadattributes.h>
 
@@ -22,6 +23,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
 #include <bsl_c_limits.h>
+#include <bsl_vector.h>
 
 #include <pthread.h>
 #include <unistd.h>        // sysconf, geteuid
@@ -35,7 +37,9 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
 #elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // sched_getcpu, cpu_set_t
 # include <sys/prctl.h>
+# include <sys/syscall.h>  // SYS_getcpu
 #endif
 
 #include <errno.h>         // constant 'EINTR'
@@ -85,6 +89,57 @@ int localPthreadsPolicy(int policy)
     return SCHED_OTHER;
 }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+/// Configure the specified pthreads attribute type `destination` to bind a
+/// thread to the CPUs described by the `cpuAffinity` and `numaNode`
+/// attributes of the specified `src`.  Return 0 on success, and a non-zero
+/// value if no online CPU satisfies both attributes.
+static int setPthreadAffinity(pthread_attr_t                 *destination,
+                              const bslmt::ThreadAttributes&  src)
+{
+    typedef bslmt::ThreadAttributes Attr;
+
+    const bsl::vector<int>& affinity = src.cpuAffinity();
+    const int               node     = src.numaNode();
+
+    bsl::vector<int> nodeCpus(src.allocator());
+    if (Attr::e_UNSET_NUMA_NODE != node) {
+        bslmt::CpuTopologyUtil::loadCpusOfNumaNode(&nodeCpus, node);
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    int numCpus = 0;
+    if (affinity.empty()) {
+        for (bsl::size_t i = 0; i < nodeCpus.size(); ++i) {
+            if (nodeCpus[i] < CPU_SETSIZE) {
+                CPU_SET(nodeCpus[i], &set);
+                ++numCpus;
+            }
+        }
+    }
+    else {
+        for (bsl::size_t i = 0; i < affinity.size(); ++i) {
+            const int cpu = affinity[i];
+
+            if (cpu < CPU_SETSIZE
+             && (Attr::e_UNSET_NUMA_NODE == node
+              || bsl::binary_search(nodeCpus.begin(), nodeCpus.end(), cpu))) {
+                CPU_SET(cpu, &set);
+                ++numCpus;
+            }
+        }
+    }
+
+    if (0 == numCpus) {
+        return -1;                                                    // RETURN
+    }
+
+    return pthread_attr_setaffinity_np(destination, sizeof set, &set);
+}
+#endif
+
 /// Initialize the specified pthreads attribute type `destination`,
 /// configuring it with information from the specified thread attributes
 /// object `src`.  Note that it is assumed that `destination` is
@@ -170,6 +225,13 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!src.cpuAffinity().empty()
+     || Attr::e_UNSET_NUMA_NODE != src.numaNode()) {
+        rc |= u::setPthreadAffinity(destination, src);
+    }
+#endif
+
     return rc;
 }
 
@@ -569,6 +631,31 @@ bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::hardwareConcurrency()
     return 0 > result ? 0 : static_cast<unsigned int>(result);
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::currentCpu()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::currentNumaNode()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+
+    if (0 != syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return -1;                                                    // RETURN
+    }
+
+    return static_cast<int>(node);
+#else
+    return -1;
+#endif
+}
+
 }  // close enterprise namespace
 
 #endif
@@ -787,6 +787,24 @@ bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::hardwareConcurrency()
     return sysinfo.dwNumberOfProcessors;
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::currentCpu()
+{
+    return static_cast<int>(GetCurrentProcessorNumber());
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::currentNumaNode()
+{
+    PROCESSOR_NUMBER processor;
+    GetCurrentProcessorNumberEx(&processor);
+
+    USHORT node = 0;
+    if (!GetNumaProcessorNodeEx(&processor, &node)) {
+        return -1;                                                    // RETURN
+    }
+
+    return static_cast<int>(node);
+}
+
 }  // close enterprise namespace
 
 #endif  // BSLMT_PLATFORM_WIN32_THREADS
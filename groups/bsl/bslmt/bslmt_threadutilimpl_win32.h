@@ -348,6 +348,14 @@ struct ThreadUtilImpl<Platform::Win32Threads> {
     /// Return the number of concurrent threads supported by the
     /// implementation on success, and 0 otherwise.
     static unsigned int hardwareConcurrency();
+
+    /// Return the index of the CPU on which the calling thread is running,
+    /// or -1 if it cannot be determined.
+    static int currentCpu();
+
+    /// Return the index of the NUMA node of the CPU on which the calling
+    /// thread is running, or -1 if it cannot be determined.
+    static int currentNumaNode();
 };
 
 // FREE OPERATORS